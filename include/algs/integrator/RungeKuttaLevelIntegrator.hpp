@@ -92,6 +92,19 @@ using namespace SAMRAI;
  *       indicates whether ghost data must be filled before timestep is computed on each patch
  *       (possible communication optimization)
  *
+ *    - \b    use_threaded_patch_loop
+ *       indicates whether the local patches of a level are processed concurrently by a team of
+ *       OpenMP threads with dynamic scheduling when advancing the level (only effective when the
+ *       code is compiled with OpenMP and the patch strategy is safe to be called concurrently on
+ *       different patches)
+ *
+ *    - \b    LowStorageRungeKuttaWeights
+ *       optional database with the number of steps ("number_steps") and the coefficient arrays
+ *       "A" and "B" of a low-storage (2N) Runge-Kutta scheme of Williamson type. When it is given,
+ *       it is used instead of the "RungeKuttaWeights" database and only two intermediate data
+ *       contexts of time-dependent, flux and source data are allocated whatever the number of
+ *       steps. A[0] has to be zero
+ *
  * Note that when continuing from restart, the input parameters in the input database override all
  * values read in from the restart database.
  *
@@ -137,6 +150,14 @@ using namespace SAMRAI;
  *     <td>opt</td>
  *     <td>Parameter read from restart db may be overridden by input db</td>
  *   </tr>
+ *   <tr>
+ *     <td>use_threaded_patch_loop</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE, FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db is used.</td>
+ *   </tr>
  * </table>
  *
  * A sample input file entry might look like:
@@ -823,6 +844,15 @@ class RungeKuttaLevelIntegrator:
             const double statistics_data_time,
             const bool output_statistics = false);
         
+        /**
+         * Output the statistics of data whose output is deferred by computeAndOutputDataStatistics()
+         * if there are any. It is called after the next time step such that the reductions of the
+         * statistics still in progress can overlap with the time step.
+         */
+        void
+        outputDeferredDataStatistics(
+            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& hierarchy);
+        
         /**
          * Return pointer to "current" variable context used by integrator. Current data corresponds
          * to state data at the beginning of a timestep, or when a new level is initialized.
@@ -1017,6 +1047,13 @@ class RungeKuttaLevelIntegrator:
             const hier::PatchLevel& patch_level,
             double current_time);
         
+        /*
+         * Compute the alpha, beta, and gamma values of the steps from the coefficients of the
+         * low-storage Runge-Kutta scheme.
+         */
+        void
+        computeLowStorageRungeKuttaWeights();
+        
         /*
          * The patch strategy supplies the application-specific operations needed to treat data on
          * patches in the AMR hierarchy.
@@ -1061,6 +1098,23 @@ class RungeKuttaLevelIntegrator:
         bool d_lag_dt_computation;
         bool d_use_ghosts_for_dt;
         
+        /*
+         * d_use_threaded_patch_loop indicates whether the loops over the local patches in advanceLevel()
+         * are shared by a team of OpenMP threads. It is turned off automatically if the code is not
+         * compiled with OpenMP or the patch strategy object does not support concurrent patch
+         * operations. The default is false.
+         */
+        bool d_use_threaded_patch_loop;
+        
+        /*
+         * d_defer_output_data_statistics indicates whether the output of the statistics of data is
+         * deferred until after the next time step when the patch strategy allows it. The time of the
+         * statistics whose output is deferred is kept until they are output. The default is false.
+         */
+        bool d_defer_output_data_statistics;
+        bool d_is_output_data_statistics_deferred;
+        double d_deferred_output_data_statistics_time;
+        
         /*
          * dt to use at the finest level if dt_use_cfl is false.
          */
@@ -1075,6 +1129,22 @@ class RungeKuttaLevelIntegrator:
         std::vector<std::vector<double> > d_beta;
         std::vector<std::vector<double> > d_gamma;
         
+        /*
+         * Whether the low-storage (2N) Runge-Kutta scheme is used and the coefficients of the
+         * scheme. With the low-storage scheme, the solution of each step is assembled from the data
+         * of the current and the previous steps only, and the alpha, beta, and gamma values of each
+         * step are those of these two data contexts.
+         */
+        bool d_use_low_storage_RK;
+        std::vector<double> d_low_storage_RK_A;
+        std::vector<double> d_low_storage_RK_B;
+        
+        /*
+         * Number of intermediate data contexts. It is equal to the number of steps unless the
+         * low-storage Runge-Kutta scheme is used.
+         */
+        int d_number_intermediate;
+        
         /*
          * Number of times of filtering before computing statistics.
          */
@@ -1129,6 +1199,19 @@ class RungeKuttaLevelIntegrator:
         
         std::vector<HAMERS_SHARED_PTR<xfer::RefineAlgorithm> > d_bdry_fill_intermediate;
         
+        /*
+         * The "intermediate" schedules fill the ghost cells of the intermediate data of the
+         * Runge-Kutta sub-steps after the first one. They are indexed by level number and sub-step
+         * number, created the first time they are needed in advanceLevel() and kept until the
+         * hierarchy configuration of the level is reset. The wall clock time used to create each of
+         * the cached schedules is recorded so that the time saved by reusing them can be reported.
+         */
+        std::vector<std::vector<HAMERS_SHARED_PTR<xfer::RefineSchedule> > > d_bdry_sched_intermediate;
+        std::vector<std::vector<double> > d_bdry_sched_intermediate_create_time;
+        int d_num_bdry_sched_intermediate_created;
+        int d_num_bdry_sched_intermediate_reused;
+        double d_bdry_sched_intermediate_create_time_saved;
+        
         /*
          * Coarsen algorithms for conservative data synchronization (e.g., flux correction or
          * refluxing).
@@ -1278,6 +1361,7 @@ class RungeKuttaLevelIntegrator:
         static HAMERS_SHARED_PTR<tbox::Timer> t_init_level_fill_interior;
         static HAMERS_SHARED_PTR<tbox::Timer> t_advance_bdry_fill_create;
         static HAMERS_SHARED_PTR<tbox::Timer> t_new_advance_bdry_fill_create;
+        static HAMERS_SHARED_PTR<tbox::Timer> t_intermediate_bdry_fill_create;
         static HAMERS_SHARED_PTR<tbox::Timer> t_apply_value_detector;
         static HAMERS_SHARED_PTR<tbox::Timer> t_apply_gradient_detector;
         static HAMERS_SHARED_PTR<tbox::Timer> t_apply_multiresolution_detector;
@@ -104,6 +104,30 @@ class RungeKuttaPatchStrategy:
             RungeKuttaLevelIntegrator* integrator,
             mesh::GriddingAlgorithm* gridding_algorithm);
         
+        /**
+         * Return whether computeFluxesAndSourcesOnPatch(), advanceSingleStepOnPatch() and
+         * computeSpectralRadiusesAndStableDtOnPatch() can be called concurrently on different patches
+         * of the same level by different threads. The Runge-Kutta level integrator only shares its
+         * patch loops among a team of threads when this returns true.
+         *
+         * Note that this function is not pure virtual. It is given a dummy implementation here that
+         * returns false so that users may ignore it when inheriting from this class.
+         */
+        virtual bool
+        supportsConcurrentPatchOperations() const;
+        
+        /**
+         * Create the objects needed by concurrent patch operations, e.g. the objects used by each of
+         * the threads. The Runge-Kutta level integrator calls this once before asking
+         * supportsConcurrentPatchOperations() and only if it is going to share its patch loops among
+         * a team of threads, so that runs without threaded patch loops do not pay for these objects.
+         *
+         * Note that this function is not pure virtual. It is given a dummy implementation here that
+         * does nothing so that users may ignore it when inheriting from this class.
+         */
+        virtual void
+        setupConcurrentPatchOperations();
+        
         /**
          * Set the initial data on a patch interior only. Note that no ghost cells need to be set in
          * this routine regardless of whether the patch data corresponding to the context requires
@@ -194,6 +218,25 @@ class RungeKuttaPatchStrategy:
             const double time,
             const double dt) = 0;
         
+        /**
+         * This is an optional routine for user to process any application-specific patch strategy
+         * data BEFORE the boundary data of patches (i.e., ghosts) is filled to advance the given level.
+         * This routine is called before the ghost cells of the scratch data are filled for the first
+         * Runge-Kutta sub-step and before preprocessAdvanceLevelState(). The arguments are the same
+         * as the ones of preprocessAdvanceLevelState().
+         *
+         * Note that this function is not pure virtual. It is given a dummy implementation here so
+         * that users may ignore it when inheriting from this class.
+         */
+        virtual void
+        preprocessFillBoundaryDataBeforeAdvance(
+            const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+            double current_time,
+            double dt,
+            bool first_step,
+            bool last_step,
+            bool regrid_advance);
+        
         /**
          * This is an optional routine for user to process any application-specific patch strategy
          * data BEFORE patches are advanced on the given level. This routine is called after patch
@@ -596,6 +639,14 @@ class RungeKuttaPatchStrategy:
             const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const double output_time);
         
+        /**
+         * Return whether the output of the statistics of data computed last can be deferred until
+         * after the next time step, i.e. the output does not use the data on the patch hierarchy.
+         * The default is false.
+         */
+        virtual bool
+        canDeferOutputDataStatistics() const;
+        
         /**
          * Get object of storing ensemble statistics.
          */
@@ -16,6 +16,7 @@
 #include "flow/refinement_taggers/GradientTagger.hpp"
 #include "flow/refinement_taggers/MultiresolutionTagger.hpp"
 #include "flow/refinement_taggers/ValueTagger.hpp"
+#include "util/load_balancing/PatchWorkloadMeasurer.hpp"
 
 #include "SAMRAI/appu/VisDerivedDataStrategy.h"
 // #include "SAMRAI/appu/VisItDataWriter.h"
@@ -89,16 +90,34 @@ class Euler:
          * Set up parameters in the load balancer object (owned by the gridding algorithm) if needed.
          * The Euler model allows non-uniform load balancing to be used based on the input file
          * parameter called "use_nonuniform_workload". The default case is to use uniform load
-         * balancing (i.e., use_nonuniform_workload == false). For illustrative and testing purposes,
-         * when non-uniform load balancing is turned on, a weight of one will be applied to every
-         * grid cell. This should produce an identical patch configuration to the uniform load balance
-         * case.
+         * balancing (i.e., use_nonuniform_workload == false). When non-uniform load balancing is
+         * turned on, the cost of every grid cell is measured from the patch operations when the levels
+         * are advanced (see preprocessFillBoundaryDataBeforeAdvance() and
+         * postprocessAdvanceLevelState()). The TreeLoadBalancer and the CascadePartitioner are
+         * supported.
          */
         void
         setupLoadBalancer(
             RungeKuttaLevelIntegrator* integrator,
             mesh::GriddingAlgorithm* gridding_algorithm);
         
+        /**
+         * Return whether the patch operations can be called concurrently on different patches by
+         * different threads. This is true when a worker flow model and worker flux reconstructors
+         * have been created for every thread.
+         */
+        bool
+        supportsConcurrentPatchOperations() const
+        {
+            return d_supports_concurrent_patch_operations;
+        }
+        
+        /**
+         * Create a worker flow model and worker flux reconstructors for each of the other threads.
+         */
+        void
+        setupConcurrentPatchOperations();
+        
         /**
          * Set the data on the patch interior to some initial values, epending on the input parameters
          * and numerical routines. If the "initial_time" flag is false, indicating that the routine
@@ -171,6 +190,34 @@ class Euler:
             const double time,
             const double dt);
         
+        /**
+         * Reset the workload on the patches of the level before the ghost cells are filled to advance
+         * the level if non-uniform load balancing is used. The cost of the patch operations, including
+         * the fill of the ghost cells at the physical boundaries, is then measured into the workload
+         * while the level is advanced.
+         */
+        void
+        preprocessFillBoundaryDataBeforeAdvance(
+            const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+            double current_time,
+            double dt,
+            bool first_step,
+            bool last_step,
+            bool regrid_advance);
+        
+        /**
+         * Scale the workload measured while the level was advanced such that the mean cost of the
+         * cells on the level is one.
+         */
+        void
+        postprocessAdvanceLevelState(
+            const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+            double current_time,
+            double dt,
+            bool first_step,
+            bool last_step,
+            bool regrid_advance);
+        
         /**
          * Preprocess before tagging cells using value detector.
          */
@@ -511,6 +558,16 @@ class Euler:
         
         void getFromRestart();
         
+        /*
+         * Create the first worker flow model and flux reconstructors for the patch operations.
+         */
+        void setupWorkers();
+        
+        /*
+         * Get the index of the worker used by the calling thread.
+         */
+        int getWorkerIndex() const;
+        
         /*
          * The object name is used for error/warning reporting.
          */
@@ -554,6 +611,11 @@ class Euler:
         int d_workload_data_id;
         bool d_use_nonuniform_workload;
         
+        /*
+         * Measurer of the cost of the patch operations into the workload.
+         */
+        HAMERS_SHARED_PTR<PatchWorkloadMeasurer> d_workload_measurer;
+        
         /*
          * A string variable to describe the flow model used.
          */
@@ -631,6 +693,19 @@ class Euler:
          */
         HAMERS_SHARED_PTR<ConvectiveFluxReconstructorManager> d_convective_flux_reconstructor_manager;
         
+        /*
+         * Flow models and convective flux reconstructors of the workers used by different threads in
+         * concurrent patch operations. The objects of the first worker are the ones owned by the
+         * managers above.
+         */
+        std::vector<HAMERS_SHARED_PTR<FlowModel> > d_worker_flow_models;
+        std::vector<HAMERS_SHARED_PTR<ConvectiveFluxReconstructor> > d_worker_convective_flux_reconstructors;
+        
+        /*
+         * Whether workers are created for all threads.
+         */
+        bool d_supports_concurrent_patch_operations;
+        
         /*
          * HAMERS_SHARED_PTR to side variable of convective flux.
          */
@@ -18,6 +18,7 @@
 #include "SAMRAI/hier/HierarchyNeighbors.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -141,6 +142,21 @@ class ExtendedFlattenedHierarchy
             return itr->second;
         }
         
+        /*!
+         * @brief Get the numbers of times that the cells of a given Box are visible.
+         *
+         * For every cell of the Box, the returned mask holds one plus the number of overlapped visible
+         * boxes of the Box containing the cell.  The cells are ordered with the first index varying
+         * fastest.  The mask of a Box is built the first time it is requested and then kept with the
+         * other containers of this object.
+         *
+         * @param box  The Box for a local patch on the PatchLevel having level number ln.
+         * @param ln   Level number of the box's level of resolution
+         *
+         * @pre ln <= d_finest_level && ln >= d_coarsest_level 
+         */
+        const std::vector<int>& getOverlappedVisibleCellCounts(const SAMRAI::hier::Box& box, int ln) const;
+        
         /*
          * @brief Get the PatchHierachy associated with this ExtendedFlattenedHierarchy.
          */
@@ -190,6 +206,15 @@ class ExtendedFlattenedHierarchy
          */
         std::vector<std::map<SAMRAI::hier::BoxId, SAMRAI::hier::BoxContainer> > d_overlapped_visible_boxes;
         
+        /*!
+         * @brief Container for the masks of the numbers of times that the cells are visible
+         *
+         * The vector is indexed by level number, and for each level, the BoxId of a Patch is mapped to
+         * the mask of the numbers of times that the cells of that Patch's box are visible.  The masks
+         * are built on request.
+         */
+        mutable std::vector<std::map<SAMRAI::hier::BoxId, std::vector<int> > > d_overlapped_visible_cell_counts;
+        
         /*!
          * @brief Pointer to the PatchHierarchy that was used to create this object.
          */
@@ -27,12 +27,17 @@
 #include "SAMRAI/tbox/IOStream.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/tbox/HDFDatabase.h"
+#include "SAMRAI/tbox/MemoryDatabase.h"
 #include "SAMRAI/tbox/Timer.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/tbox/SAMRAI_MPI.h"
 
+#include <condition_variable>
+#include <deque>
 #include <string>
 #include <list>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 /*!
@@ -120,6 +125,14 @@
  *       Minimally, only a hierarchy and the time step number is needed.  A simulation time can also
  *       be specified which will be included as part of the file information in the dump
  *
+ *     - Optionally, turn on asynchronous dumps with setAsynchronousDumps().  The data of each
+ *       processor is then packed in memory by writePlotData() and written to its file by a background
+ *       I/O thread.  waitForPendingPlotData() must be called before any other HDF5 file (e.g. a
+ *       restart file) is written, unless the HDF5 library is built to be thread-safe.
+ *
+ *     - Optionally, with an HDF5 library built with parallel support, turn on the single file
+ *       written collectively by all processors with setParallelHDF5SingleFile().
+ *
  *     - The document "Generating VisIt Visualization Data Files in SAMRAI" in the SAMRAI documentation
  *       directory (docs/userdocs/VisIt-writer.pdf) gives in-depth details on the use of the original
  *       VDW and materials, as well as example code fragments showing how the various
@@ -580,6 +593,48 @@ class ExtendedVisItDataWriter
             int time_step,
             double simulation_time = 0.0);
         
+        /*!
+         * @brief Turn on or off asynchronous dumps.
+         *
+         * With asynchronous dumps, writePlotData() packs the data of each processor into memory and
+         * returns once the summary file is written.  The packed data is written to the processor file
+         * by a background I/O thread on each processor.  If max_number_pending_dumps dumps are not
+         * written yet, writePlotData() waits for the oldest one to be written before packing a new one.
+         *
+         * @pre max_number_pending_dumps > 0
+         */
+        void
+        setAsynchronousDumps(
+            const bool use_asynchronous_dumps,
+            const int max_number_pending_dumps = 1);
+        
+        /*!
+         * @brief Wait until all the pending asynchronous dumps are written.
+         */
+        void
+        waitForPendingPlotData();
+        
+        /*!
+         * @brief Turn on or off the single file written collectively by parallel HDF5.
+         *
+         * With the single file, the data of all processors at each dump is written into one file with
+         * the MPI-IO driver of HDF5 instead of one file per processor.  The groups and datasets are the
+         * same as in a file shared by all processors so the summary file is unchanged.  The number of
+         * processors per file given to the constructor is kept and used again if the single file is
+         * turned off.  The number of MPI-IO aggregators is passed as the "cb_nodes" hint if it is
+         * positive; otherwise, the default of the MPI-IO library is used.
+         *
+         * An error results and the program will halt if:
+         *     - the HDF5 library is not built with parallel support.
+         *     - asynchronous dumps are turned on.
+         *
+         * @pre number_io_aggregators >= 0
+         */
+        void
+        setParallelHDF5SingleFile(
+            const bool use_parallel_HDF5_single_file,
+            const int number_io_aggregators = 0);
+        
         /*!
          * @brief Set the name of the summary file.
          *
@@ -674,6 +729,28 @@ class ExtendedVisItDataWriter
             double xhi[VISIT_FIXED_DIM];
         };
         
+        /*
+         * Struct to hold the packed data of a processor waiting to be written by the I/O thread.
+         */
+        struct pendingPlotDataStruct
+        {
+            std::string file_name;
+            std::string processor_group_name;
+            HAMERS_SHARED_PTR<SAMRAI::tbox::MemoryDatabase> processor_database;
+        };
+        
+        /*
+         * Struct to hold a group or a dataset of the packed data written by parallel HDF5.
+         */
+        struct parallelHDF5EntryStruct
+        {
+            std::string path;
+            int data_type;
+            int number_elements;
+            HAMERS_SHARED_PTR<SAMRAI::tbox::Database> database;
+            std::string key;
+        };
+        
         /*
          * Struct to hold patch processor mapping info.
          */
@@ -867,6 +944,78 @@ class ExtendedVisItDataWriter
             const HAMERS_SHARED_PTR<SAMRAI::hier::PatchHierarchy>& hierarchy,
             double simulation_time);
         
+        /*
+         * Wait until at most number_pending_dumps asynchronous dumps are not written yet. An error of
+         * the I/O thread is raised here.
+         */
+        void
+        waitForPendingPlotData(
+            const int number_pending_dumps);
+        
+        /*
+         * Hand the packed data of this processor to the I/O thread. The I/O thread is started if it
+         * is not running yet. An error of the I/O thread is raised here.
+         */
+        void
+        addPendingPlotData(
+            const pendingPlotDataStruct& pending_plot_data);
+        
+        /*
+         * Main loop of the I/O thread which writes the pending packed data to the processor files. On
+         * a failure, the error message is recorded, the pending packed data is dropped and the loop
+         * returns.
+         */
+        void
+        writePendingPlotData();
+        
+        /*
+         * Stop the I/O thread after all the pending packed data is written. An error of the I/O thread
+         * is raised here.
+         */
+        void
+        stopIOThread();
+        
+        /*
+         * Write the packed data of all processors collectively into a single file with parallel HDF5.
+         */
+        void
+        writeParallelHDF5File(
+            const pendingPlotDataStruct& pending_plot_data);
+        
+        /*
+         * Recursively list the groups and datasets of a database with their paths prefixed by path.
+         */
+        static void
+        flattenDatabase(
+            const HAMERS_SHARED_PTR<SAMRAI::tbox::Database>& database,
+            const std::string& path,
+            std::vector<parallelHDF5EntryStruct>& entries);
+        
+        /*
+         * Get the native HDF5 type of a type of data in the packed data.
+         */
+        static hid_t
+        getParallelHDF5NativeType(
+            const int data_type);
+        
+        /*
+         * Copy the data of a dataset in the packed data into a buffer of bytes.
+         */
+        static void
+        getParallelHDF5Buffer(
+            const parallelHDF5EntryStruct& entry,
+            std::vector<char>& buffer);
+        
+        /*
+         * Recursively copy all the keys of a database into another database. Returns false and sets the
+         * error message if a key has an unsupported type of data.
+         */
+        static bool
+        copyDatabase(
+            const HAMERS_SHARED_PTR<SAMRAI::tbox::Database>& source_database,
+            const HAMERS_SHARED_PTR<SAMRAI::tbox::Database>& destination_database,
+            std::string& error_message);
+        
         /*
          * Allocate and initialize the min/max structs that hold summary information about each
          * plotted variable.
@@ -1201,9 +1350,48 @@ class ExtendedVisItDataWriter
         std::vector<std::string> d_visit_expressions;
         std::vector<std::string> d_visit_expression_types;
         
+        /*
+         * Settings of the asynchronous dumps.
+         */
+        bool d_use_asynchronous_dumps;
+        int d_max_number_pending_dumps;
+        
+        /*
+         * Background I/O thread and the queue of packed data it writes. The packed data being written
+         * stays at the front of the queue until it is written. The mutex and the condition variable
+         * guard the queue, the flag to stop the I/O thread and the error of the I/O thread.
+         */
+        std::thread d_io_thread;
+        std::deque<pendingPlotDataStruct> d_pending_plot_data;
+        std::mutex d_pending_plot_data_mutex;
+        std::condition_variable d_pending_plot_data_condition;
+        bool d_stop_io_thread;
+        
+        /*
+         * Error message recorded by the I/O thread when it fails to write the packed data. The I/O
+         * thread stops and the error is raised by the main thread, since TBOX_ERROR aborts through MPI
+         * which may only be used by the main thread. Empty if there is no error.
+         */
+        std::string d_io_thread_error_message;
+        
+        /*
+         * Mutex to serialize the HDF5 calls of the I/O thread and of the summary file since the HDF5
+         * library is in general not thread-safe.
+         */
+        std::mutex d_hdf5_mutex;
+        
+        /*
+         * Settings of the single file written collectively by parallel HDF5.
+         */
+        bool d_use_parallel_HDF5_single_file;
+        int d_number_io_aggregators;
+        
         //! @brief Timer for writePlotData().
         static HAMERS_SHARED_PTR<SAMRAI::tbox::Timer> t_write_plot_data;
         
+        //! @brief Timer for waiting for the pending asynchronous dumps.
+        static HAMERS_SHARED_PTR<SAMRAI::tbox::Timer> t_wait_for_pending_plot_data;
+        
         /*!
          * @brief Initialize static objects and register shutdown routine.
          *
@@ -1214,6 +1402,8 @@ class ExtendedVisItDataWriter
         {
             t_write_plot_data = SAMRAI::tbox::TimerManager::getManager()->getTimer(
                 "appu:ExtendedVisItDataWriter::writePlotData()");
+            t_wait_for_pending_plot_data = SAMRAI::tbox::TimerManager::getManager()->getTimer(
+                "appu:ExtendedVisItDataWriter::waitForPendingPlotData()");
         }
         
         /*!
@@ -1225,6 +1415,7 @@ class ExtendedVisItDataWriter
         finalizeCallback()
         {
            t_write_plot_data.reset();
+           t_wait_for_pending_plot_data.reset();
         }
         
         /*
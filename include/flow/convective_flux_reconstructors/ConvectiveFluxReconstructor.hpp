@@ -6,6 +6,7 @@
 #include "HAMeRS_memory.hpp"
 
 #include "flow/flow_models/FlowModels.hpp"
+#include "util/scratch_arena/ScratchPatchDataArena.hpp"
 
 #include "SAMRAI/geom/CartesianGridGeometry.h"
 #include "SAMRAI/hier/IntVector.h"
@@ -18,6 +19,10 @@
 #include <string>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace SAMRAI;
 
 class ConvectiveFluxReconstructor
@@ -38,7 +43,10 @@ class ConvectiveFluxReconstructor
                 d_num_eqn(num_eqn),
                 d_flow_model_type(flow_model_type),
                 d_flow_model(flow_model),
-                d_convective_flux_reconstructor_db(convective_flux_reconstructor_db)
+                d_convective_flux_reconstructor_db(convective_flux_reconstructor_db),
+                d_scratch_arena(HAMERS_MAKE_SHARED<ScratchPatchDataArena>(
+                    object_name + "::d_scratch_arena",
+                    dim))
         {}
         
         virtual ~ConvectiveFluxReconstructor() {}
@@ -67,6 +75,16 @@ class ConvectiveFluxReconstructor
         putToRestart(
             const HAMERS_SHARED_PTR<tbox::Database>& restart_db) const = 0;
         
+        /*
+         * Return whether different objects of the convective flux reconstruction class can compute
+         * the convective flux on different patches at the same time.
+         */
+        virtual bool
+        supportsConcurrentPatchOperations() const
+        {
+            return true;
+        }
+        
         /*
          * Compute the convective flux and source due to splitting of convective term on a patch.
          */
@@ -81,6 +99,21 @@ class ConvectiveFluxReconstructor
             const int RK_step_number) = 0;
     
     protected:
+        /*
+         * Return whether the calling thread is the first worker of the threaded patch loops. The
+         * timers are shared by all objects of a class and are not thread-safe, so only the first
+         * worker is timed.
+         */
+        bool
+        isFirstWorker() const
+        {
+#ifdef _OPENMP
+            return omp_get_thread_num() == 0;
+#else
+            return true;
+#endif
+        }
+        
         /*
          * The object name is used for error/warning reporting.
          */
@@ -121,6 +154,12 @@ class ConvectiveFluxReconstructor
          */
         const HAMERS_SHARED_PTR<tbox::Database> d_convective_flux_reconstructor_db;
         
+        /*
+         * Arena of the temporary patch data. Each worker of the convective flux reconstructor has
+         * its own arena.
+         */
+        const HAMERS_SHARED_PTR<ScratchPatchDataArena> d_scratch_arena;
+        
 };
 
 #endif /* CONVECTIVE_FLUX_RECONSTRUCTOR_HPP */
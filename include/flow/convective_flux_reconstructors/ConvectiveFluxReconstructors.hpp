@@ -11,6 +11,7 @@
 #include "flow/convective_flux_reconstructors/central/ConvectiveFluxReconstructorCentral.hpp"
 #include "flow/convective_flux_reconstructors/central/ConvectiveFluxReconstructorDRP4.hpp"
 #include "flow/convective_flux_reconstructors/central/ConvectiveFluxReconstructorKEP.hpp"
+#include "flow/convective_flux_reconstructors/hybrid/ConvectiveFluxReconstructorHybridKEP-WCNS.hpp"
 
 #include <map>
 #include <string>
@@ -26,7 +27,8 @@ namespace CONVECTIVE_FLUX_RECONSTRUCTOR
                 WCNS6_TEST,
                 CENTRAL,
                 DRP4,
-                KEP };
+                KEP,
+                HYBRID_KEP_WCNS };
 }
 
 /*
@@ -49,6 +51,7 @@ inline std::ostream& operator<<(std::ostream& os, const CONVECTIVE_FLUX_RECONSTR
         INSERT_ELEMENT(CONVECTIVE_FLUX_RECONSTRUCTOR::CENTRAL);
         INSERT_ELEMENT(CONVECTIVE_FLUX_RECONSTRUCTOR::DRP4);
         INSERT_ELEMENT(CONVECTIVE_FLUX_RECONSTRUCTOR::KEP);
+        INSERT_ELEMENT(CONVECTIVE_FLUX_RECONSTRUCTOR::HYBRID_KEP_WCNS);
 #undef INSERT_ELEMENT
     }
     
@@ -2,6 +2,7 @@
 #define CONVECTIVE_FLUX_RECONSTRUCTOR_WCNS5_JS_HLLC_HLL_HPP
 
 #include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS56-HLLC-HLL.hpp"
+#include "util/CPUDispatch.hpp"
 
 class ConvectiveFluxReconstructorWCNS5_JS_HLLC_HLL: public ConvectiveFluxReconstructorWCNS56
 {
@@ -33,13 +34,28 @@ class ConvectiveFluxReconstructorWCNS5_JS_HLLC_HLL: public ConvectiveFluxReconst
     
     private:
         /*
-         * Perform WENO interpolation.
+         * Perform WENO interpolation on a line of faces.
          */
         void
         performWENOInterpolation(
-            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_minus,
-            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_plus,
-            const std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > >& variables);
+            std::vector<double*>& variables_minus,
+            std::vector<double*>& variables_plus,
+            const std::vector<std::vector<double*> >& variables,
+            const DIRECTION::TYPE& direction,
+            const int num_faces);
+        
+        /*
+         * Perform WENO interpolation on a line of faces with the exponent P of the nonlinear weights
+         * fixed at compile time.
+         */
+        template<int P>
+        HAMERS_CPU_DISPATCH void
+        performWENOInterpolationWithExponent(
+            std::vector<double*>& variables_minus,
+            std::vector<double*>& variables_plus,
+            const std::vector<std::vector<double*> >& variables,
+            const DIRECTION::TYPE& direction,
+            const int num_faces);
         
         /*
          * Constant used by the scheme.
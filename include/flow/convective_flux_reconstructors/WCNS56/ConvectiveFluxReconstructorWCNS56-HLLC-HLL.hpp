@@ -5,6 +5,8 @@
 #include "util/derivatives/DerivativeFirstOrder.hpp"
 #include "util/Directions.hpp"
 
+#include "SAMRAI/hier/BoxContainer.h"
+
 class ConvectiveFluxReconstructorWCNS56: public ConvectiveFluxReconstructor
 {
     public:
@@ -46,15 +48,32 @@ class ConvectiveFluxReconstructorWCNS56: public ConvectiveFluxReconstructor
             const double dt,
             const int RK_step_number);
         
+        /*
+         * Restrict the WENO interpolation and the Riemann solver of the next patch operation to the
+         * mid-points marked with one in the mask, e.g. the mid-points in the shock bands of a hybrid
+         * scheme. The mask has the box of the patch and one ghost cell. The other mid-points take the
+         * first order values of the neighboring cells and a zero flux. The mask is dropped at the end
+         * of the patch operation.
+         */
+        void
+        setMidpointMask(
+            const HAMERS_SHARED_PTR<pdat::SideData<int> >& midpoint_mask)
+        {
+            d_midpoint_mask = midpoint_mask;
+        }
+        
     protected:
         /*
-         * Perform WENO interpolation.
+         * Perform WENO interpolation on a line of faces. variables[m] are the variables at the faces
+         * shifted by the stencil offset (m - 3).
          */
         virtual void
         performWENOInterpolation(
-            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_minus,
-            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_plus,
-            const std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > >& variables) = 0;
+            std::vector<double*>& variables_minus,
+            std::vector<double*>& variables_plus,
+            const std::vector<std::vector<double*> >& variables,
+            const DIRECTION::TYPE& direction,
+            const int num_faces) = 0;
         
         /*
          * Forms of equations.
@@ -62,6 +81,68 @@ class ConvectiveFluxReconstructorWCNS56: public ConvectiveFluxReconstructor
         std::vector<EQN_FORM::TYPE> d_eqn_form;
         bool d_has_advective_eqn_form;
         
+    private:
+        /*
+         * Compute the primitive variables on both sides of the faces with WENO interpolation of the
+         * characteristic variables, one line of faces at a time. DIM is the number of dimensions of
+         * the problem.
+         */
+        template<int DIM>
+        void
+        computeInterpolatedPrimitiveVariablesOnFaces(
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_minus,
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_plus,
+            const std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > >& primitive_variables,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& projection_variables,
+            const HAMERS_SHARED_PTR<FlowModelBasicUtilities>& basic_utilities);
+        
+        /*
+         * Compute the boxes of cells whose faces in each direction cover the runs of consecutive marked
+         * mid-points of the mask. The runs with the same extent on adjacent lines share a box. DIM is
+         * the number of dimensions of the problem.
+         */
+        template<int DIM>
+        void
+        computeMidpointBoxes(const hier::Box& interior_box);
+        
+        /*
+         * Compute the mid-point flux with the Riemann solver on the boxes of the marked mid-points in
+         * the direction, or on all mid-points if there is no mask.
+         */
+        void
+        computeMidpointConvectiveFlux(
+            const HAMERS_SHARED_PTR<FlowModelRiemannSolver>& riemann_solver,
+            const HAMERS_SHARED_PTR<pdat::SideData<double> >& convective_flux_midpoint,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_minus,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_plus,
+            const DIRECTION::TYPE& direction,
+            const RIEMANN_SOLVER::TYPE& riemann_solver_type) const;
+        
+        /*
+         * Compute the mid-point flux and velocity with the Riemann solver on the boxes of the marked
+         * mid-points in the direction, or on all mid-points if there is no mask.
+         */
+        void
+        computeMidpointConvectiveFluxAndVelocity(
+            const HAMERS_SHARED_PTR<FlowModelRiemannSolver>& riemann_solver,
+            const HAMERS_SHARED_PTR<pdat::SideData<double> >& convective_flux_midpoint,
+            const HAMERS_SHARED_PTR<pdat::SideData<double> >& velocity_midpoint,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_minus,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_plus,
+            const DIRECTION::TYPE& direction,
+            const RIEMANN_SOLVER::TYPE& riemann_solver_type) const;
+        
+        /*
+         * Mask of the mid-points where the WENO interpolation and the Riemann solver are used. All
+         * mid-points are used if it is not set.
+         */
+        HAMERS_SHARED_PTR<pdat::SideData<int> > d_midpoint_mask;
+        
+        /*
+         * Boxes of the marked mid-points of the mask in each direction.
+         */
+        std::vector<hier::BoxContainer> d_midpoint_boxes;
+        
 };
 
 #endif /* CONVECTIVE_FLUX_RECONSTRUCTOR_56_HLLC_HLL_HPP */
@@ -0,0 +1,77 @@
+#ifndef WCNS56_NONLINEAR_WEIGHTS_HPP
+#define WCNS56_NONLINEAR_WEIGHTS_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "util/IntegerPower.hpp"
+
+#include <cmath>
+
+/*
+ * Nonlinear weights of the WCNS schemes computed from the smoothness indicators of the
+ * substencils. The exponents are fixed at compile time through IntegerPower unless the template
+ * argument is zero. They are shared by the reconstructors and by benchmark_WENO_weights.
+ */
+
+/*
+ * Compute the normalized WCNS5-JS weights with exponent p.
+ */
+template<int P>
+static inline __attribute__((always_inline)) void computeWeightsWCNS5JS(
+    double& omega_0,
+    double& omega_1,
+    double& omega_2,
+    const double& beta_0,
+    const double& beta_1,
+    const double& beta_2,
+    const int& p)
+{
+    omega_0 = double(1)/double(16)/IntegerPower<P>::compute((beta_0 + HAMERS_EPSILON), p);
+    omega_1 = double(5)/double(8)/IntegerPower<P>::compute((beta_1 + HAMERS_EPSILON), p);
+    omega_2 = double(5)/double(16)/IntegerPower<P>::compute((beta_2 + HAMERS_EPSILON), p);
+    
+    const double omega_sum = omega_0 + omega_1 + omega_2;
+    
+    omega_0 = omega_0/omega_sum;
+    omega_1 = omega_1/omega_sum;
+    omega_2 = omega_2/omega_sum;
+}
+
+
+/*
+ * Compute the normalized central WCNS6-LD weights with exponent q and constant C. The reference
+ * smoothness indicators beta_avg and tau_6 are returned as well since the reconstructor needs them
+ * to switch to the upwind weights.
+ */
+template<int Q>
+static inline __attribute__((always_inline)) void computeCentralWeightsWCNS6LD(
+    double& omega_0,
+    double& omega_1,
+    double& omega_2,
+    double& omega_3,
+    double& beta_avg,
+    double& tau_6,
+    const double& beta_0,
+    const double& beta_1,
+    const double& beta_2,
+    const double& beta_3,
+    const int& q,
+    const double& C)
+{
+    beta_avg = double(1)/double(8)*(beta_0 + beta_2 + double(6)*beta_1);
+    tau_6 = fabs(beta_3 - beta_avg);
+    
+    omega_0 = double(1)/double(32)*(C + IntegerPower<Q>::compute(tau_6/(beta_0 + HAMERS_EPSILON), q));
+    omega_1 = double(15)/double(32)*(C + IntegerPower<Q>::compute(tau_6/(beta_1 + HAMERS_EPSILON), q));
+    omega_2 = double(15)/double(32)*(C + IntegerPower<Q>::compute(tau_6/(beta_2 + HAMERS_EPSILON), q));
+    omega_3 = double(1)/double(32)*(C + IntegerPower<Q>::compute(tau_6/(beta_3 + HAMERS_EPSILON), q));
+    
+    const double omega_sum = omega_0 + omega_1 + omega_2 + omega_3;
+    
+    omega_0 = omega_0/omega_sum;
+    omega_1 = omega_1/omega_sum;
+    omega_2 = omega_2/omega_sum;
+    omega_3 = omega_3/omega_sum;
+}
+
+#endif /* WCNS56_NONLINEAR_WEIGHTS_HPP */
@@ -6,6 +6,7 @@
 #include "util/Directions.hpp"
 
 #include "SAMRAI/pdat/SideVariable.h"
+#include "util/CPUDispatch.hpp"
 
 // Follow the kinetic energy preserving schemes in
 // Pirozzoli, Sergio.
@@ -54,6 +55,93 @@ class ConvectiveFluxReconstructorKEP: public ConvectiveFluxReconstructor
             const int RK_step_number);
         
     private:
+        /*
+         * Types of the kernels adding the linear, quadratic and cubic terms to the convective flux in a
+         * direction.
+         */
+        typedef void (ConvectiveFluxReconstructorKEP::*LinearTermFunction)(
+            HAMERS_SHARED_PTR<pdat::SideData<double> >&,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >&,
+            const int,
+            const int,
+            const double,
+            const int) const;
+        
+        typedef void (ConvectiveFluxReconstructorKEP::*QuadraticTermFunction)(
+            HAMERS_SHARED_PTR<pdat::SideData<double> >&,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >&,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >&,
+            const int,
+            const int,
+            const int,
+            const double,
+            const int) const;
+        
+        typedef void (ConvectiveFluxReconstructorKEP::*CubicTermFunction)(
+            HAMERS_SHARED_PTR<pdat::SideData<double> >&,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >&,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >&,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >&,
+            const int,
+            const int,
+            const int,
+            const int,
+            const double,
+            const int) const;
+        
+        /*
+         * Set the kernels adding the terms to the convective flux. HALF_WIDTH is the number of cells on
+         * each side of a face in the stencil.
+         */
+        template<int HALF_WIDTH>
+        void
+        setConvectiveFluxFunctions();
+        
+        /*
+         * Add linear term to convective flux in a direction.
+         */
+        template<int DIM, int HALF_WIDTH>
+        HAMERS_CPU_DISPATCH void
+        addLinearTermToConvectiveFlux(
+            HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+            const int component_idx_flux,
+            const int component_idx_f,
+            const double dt,
+            const int direction) const;
+        
+        /*
+         * Add quadratic term to convective flux in a direction.
+         */
+        template<int DIM, int HALF_WIDTH>
+        HAMERS_CPU_DISPATCH void
+        addQuadraticTermToConvectiveFlux(
+            HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+            const int component_idx_flux,
+            const int component_idx_f,
+            const int component_idx_g,
+            const double dt,
+            const int direction) const;
+        
+        /*
+         * Add cubic term to convective flux in a direction.
+         */
+        template<int DIM, int HALF_WIDTH>
+        HAMERS_CPU_DISPATCH void
+        addCubicTermToConvectiveFlux(
+            HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_h,
+            const int component_idx_flux,
+            const int component_idx_f,
+            const int component_idx_g,
+            const int component_idx_h,
+            const double dt,
+            const int direction) const;
+        
         /*
          * Add linear term to convective flux in x-direction.
          */
@@ -175,7 +263,7 @@ class ConvectiveFluxReconstructorKEP: public ConvectiveFluxReconstructor
          * Add source terms to the advection equations of volume fractions.
          * (for five-equation model by Allaire et al.)
          */
-        void
+        HAMERS_CPU_DISPATCH void
         addSourceTermsToVolumeFractionEquations(
             HAMERS_SHARED_PTR<pdat::CellData<double> > data_source,
             HAMERS_SHARED_PTR<pdat::CellData<double> > data_velocity,
@@ -203,7 +291,9 @@ class ConvectiveFluxReconstructorKEP: public ConvectiveFluxReconstructor
         static HAMERS_SHARED_PTR<tbox::Timer> t_compute_source;
         
         /*
-         * Coefficients for finite differencing.
+         * Coefficients for finite differencing. The kernels copy the coefficients to local constants such
+         * that they are kept in registers through the loops instead of being reloaded after every store
+         * through the data pointers, which may alias the members of the class.
          */
          
         double d_coef_a;
@@ -212,6 +302,15 @@ class ConvectiveFluxReconstructorKEP: public ConvectiveFluxReconstructor
         double d_coef_d;
         double d_coef_e;
         double d_coef_f;
+        
+        /*
+         * Kernels adding the terms to the convective flux for the number of dimensions and the stencil
+         * width of the problem.
+         */
+        LinearTermFunction d_add_linear_term_to_convective_flux;
+        QuadraticTermFunction d_add_quadratic_term_to_convective_flux;
+        CubicTermFunction d_add_cubic_term_to_convective_flux;
+        
 };
 
 #endif /* CONVECTIVE_FLUX_RECONSTRUCTOR_KEP_HPP */
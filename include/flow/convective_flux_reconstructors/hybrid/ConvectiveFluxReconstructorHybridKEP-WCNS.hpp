@@ -0,0 +1,157 @@
+#ifndef CONVECTIVE_FLUX_RECONSTRUCTOR_HYBRID_KEP_WCNS_HPP
+#define CONVECTIVE_FLUX_RECONSTRUCTOR_HYBRID_KEP_WCNS_HPP
+
+#include "flow/convective_flux_reconstructors/ConvectiveFluxReconstructor.hpp"
+#include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS5-JS-HLLC-HLL.hpp"
+#include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS5-Z-HLLC-HLL.hpp"
+#include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS6-CU-M2-HLLC-HLL.hpp"
+#include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS6-LD-HLLC-HLL.hpp"
+#include "flow/convective_flux_reconstructors/central/ConvectiveFluxReconstructorKEP.hpp"
+#include "util/derivatives/DerivativeFirstOrder.hpp"
+#include "util/Directions.hpp"
+
+#include "SAMRAI/pdat/SideVariable.h"
+#include "SAMRAI/tbox/Timer.h"
+
+// Hybrid scheme that uses the kinetic energy preserving central scheme (ConvectiveFluxReconstructorKEP)
+// in smooth regions and a WCNS scheme in bands around shocks. The shocks are detected with the
+// Ducros-like sensor of the WCNS56 schemes combined with a dilatation criterion following
+// Larsson, Johan, et al.
+// "Effect of numerical dissipation on the predicted spectra for compressible turbulence."
+// Journal of Computational Physics 231.2 (2012): 499-508.
+//
+// The WCNS scheme is only run on patches that contain a shock band. On these patches, the faces
+// inside the band take the WCNS flux and the other faces take the central flux. The WENO
+// interpolation of the WCNS scheme is restricted to the mid-points in the stencils of the faces
+// inside the band.
+
+class ConvectiveFluxReconstructorHybridKEP_WCNS: public ConvectiveFluxReconstructor
+{
+    public:
+        ConvectiveFluxReconstructorHybridKEP_WCNS(
+            const std::string& object_name,
+            const tbox::Dimension& dim,
+            const HAMERS_SHARED_PTR<geom::CartesianGridGeometry>& grid_geometry,
+            const int& num_eqn,
+            const FLOW_MODEL::TYPE& flow_model_type,
+            const HAMERS_SHARED_PTR<FlowModel>& flow_model,
+            const HAMERS_SHARED_PTR<tbox::Database>& convective_flux_reconstructor_db);
+        
+        ~ConvectiveFluxReconstructorHybridKEP_WCNS();
+        
+        /*
+         * Print all characteristics of the convective flux reconstruction class.
+         */
+        void
+        printClassData(std::ostream& os) const;
+        
+        /*
+         * Put the characteristics of the convective flux reconstruction class
+         * into the restart database.
+         */
+        void
+        putToRestart(
+            const HAMERS_SHARED_PTR<tbox::Database>& restart_db) const;
+        
+        /*
+         * Compute the convective flux and source due to splitting of convective term on a patch.
+         */
+        void
+        computeConvectiveFluxAndSourceOnPatch(
+            hier::Patch& patch,
+            const HAMERS_SHARED_PTR<pdat::SideVariable<double> >& variable_convective_flux,
+            const HAMERS_SHARED_PTR<pdat::CellVariable<double> >& variable_source,
+            const HAMERS_SHARED_PTR<hier::VariableContext>& data_context,
+            const double time,
+            const double dt,
+            const int RK_step_number);
+    
+    private:
+        /*
+         * Compute the cell data of the shock band on a patch. The shock band is one at the cells within
+         * d_shock_band_width cells from a cell marked by the shock sensor and zero elsewhere.
+         */
+        void
+        computeShockBand(
+            HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band,
+            hier::Patch& patch,
+            const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
+        
+        /*
+         * Extend the marked cells by d_shock_band_width cells in a direction. DIM is the number of
+         * dimensions of the problem.
+         */
+        template<int DIM>
+        void
+        dilateShockBand(
+            HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band_dilated,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band,
+            const int direction) const;
+        
+        /*
+         * Mark the faces that use the flux of the WCNS scheme and return the number of marked faces.
+         * A face is marked if any of its two neighboring cells is inside the shock band. DIM is the
+         * number of dimensions of the problem.
+         */
+        template<int DIM>
+        int
+        computeShockBandFaces(
+            HAMERS_SHARED_PTR<pdat::SideData<int> >& shock_band_faces,
+            const HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band) const;
+        
+        /*
+         * Mark the mid-points in the stencils of the fluxes on the marked faces, which are the
+         * mid-points within one mid-point from a marked face in the direction normal to the face, and
+         * return the number of marked mid-points. DIM is the number of dimensions of the problem.
+         */
+        template<int DIM>
+        int
+        computeShockBandMidpoints(
+            HAMERS_SHARED_PTR<pdat::SideData<int> >& shock_band_midpoints,
+            const HAMERS_SHARED_PTR<pdat::SideData<int> >& shock_band_faces) const;
+        
+        /*
+         * Name of the WCNS scheme used inside the shock bands.
+         */
+        std::string d_shock_capturing_scheme_str;
+        
+        /*
+         * Central and shock-capturing convective flux reconstructors.
+         */
+        HAMERS_SHARED_PTR<ConvectiveFluxReconstructorKEP> d_central_reconstructor;
+        HAMERS_SHARED_PTR<ConvectiveFluxReconstructorWCNS56> d_shock_capturing_reconstructor;
+        
+        /*
+         * Options of the shock sensor.
+         */
+        double d_shock_sensor_threshold;
+        double d_dilatation_threshold;
+        int d_shock_band_width;
+        
+        /*
+         * Whether to print the fractions of faces and mid-points using each scheme on every patch.
+         */
+        bool d_print_patch_statistics;
+        
+        /*
+         * Numbers of faces, mid-points and patches using each scheme since the start of the run. The
+         * mid-points using the shock-capturing scheme are the ones where the WENO interpolation and
+         * the Riemann solver are used.
+         */
+        unsigned long d_num_faces_central;
+        unsigned long d_num_faces_shock_capturing;
+        unsigned long d_num_midpoints;
+        unsigned long d_num_midpoints_shock_capturing;
+        unsigned long d_num_patches_central_only;
+        unsigned long d_num_patches_hybrid;
+        unsigned long d_num_patches_shock_capturing_only;
+        
+        /*
+         * Timers interspersed throughout the class.
+         */
+        static HAMERS_SHARED_PTR<tbox::Timer> t_compute_shock_band;
+        static HAMERS_SHARED_PTR<tbox::Timer> t_blend_flux;
+        
+};
+
+#endif /* CONVECTIVE_FLUX_RECONSTRUCTOR_HYBRID_KEP_WCNS_HPP */
@@ -283,6 +283,21 @@ class DiffusiveFluxReconstructorMidpoint: public DiffusiveFluxReconstructor
             const hier::Patch& patch,
             const double dt) const;
         
+        /*
+         * Accumulate the products of the diffusivities and the derivatives at the midpoints in a direction
+         * into the diffusive flux at the midpoints for three-dimensional problems, one line of midpoints at
+         * a time. The derivatives of each product are either given at the midpoints or given at the nodes
+         * and interpolated to the midpoints on the line.
+         */
+        void accumulateDiffusiveFluxAtMidpoints3D(
+            double* F_midpoint,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& diffusivities_data,
+            const std::vector<int>& diffusivities_component_idx,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& derivatives_midpoint,
+            const std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > >& derivatives_node,
+            const DIRECTION::TYPE& direction,
+            const hier::Box& interior_box) const;
+        
     protected:
         /*
          * Kernel to compute the derivatives in x-direction at midpoints.
@@ -407,6 +422,18 @@ class DiffusiveFluxReconstructorMidpoint: public DiffusiveFluxReconstructor
             const hier::IntVector& domain_lo,
             const hier::IntVector& domain_dims) const = 0;
         
+        /*
+         * Kernel to accumulate the products of the diffusivities and the derivatives interpolated from nodes
+         * to midpoints on a line of midpoints into the diffusive flux.
+         */
+        virtual void accumulateDiffusiveFluxWithDerivativesFromNodeOnLine(
+            double* F_line,
+            const double* const mu_line,
+            const double* const du_node_line,
+            const int& stride_node,
+            const int& i_lo,
+            const int& i_hi) const = 0;
+        
         /*
          * Kernel to reconstruct the flux using flux at midpoints in x-direction.
          */
@@ -154,6 +154,18 @@ class DiffusiveFluxReconstructorMidpointSecondOrder: public DiffusiveFluxReconst
             const hier::IntVector& domain_lo,
             const hier::IntVector& domain_dims) const;
         
+        /*
+         * Kernel to accumulate the products of the diffusivities and the derivatives interpolated from nodes
+         * to midpoints on a line of midpoints into the diffusive flux.
+         */
+        void accumulateDiffusiveFluxWithDerivativesFromNodeOnLine(
+            double* F_line,
+            const double* const mu_line,
+            const double* const du_node_line,
+            const int& stride_node,
+            const int& i_lo,
+            const int& i_hi) const;
+        
         /*
          * Kernel to reconstruct the flux using flux at midpoints in x-direction.
          */
@@ -207,6 +207,18 @@ class FlowModel:
         putToRestart(
             const HAMERS_SHARED_PTR<tbox::Database>& restart_db) const;
         
+        /*
+         * Create a worker flow model for concurrent patch operations. The worker shares the database,
+         * equation of state and mixing rules with this flow model but has its own patch registration,
+         * derived cell data, Riemann solver, basic utilities, diffusive flux utilities and source
+         * utilities, so that different patches can be processed by this flow model and its workers at
+         * the same time. The boundary, monitoring statistics and statistics utilities are shared and
+         * should only be used through this flow model. No patch should be registered when the worker
+         * is created.
+         */
+        virtual HAMERS_SHARED_PTR<FlowModel>
+        createWorkerFlowModel() const = 0;
+        
         /*
          * Register the conservative variables.
          */
@@ -291,6 +303,28 @@ class FlowModel:
          */
         void setSubdomainBox(const hier::Box& subdomain_box);
         
+        /*
+         * Start caching the cell data of derived variables. The cell data is kept when the patch is
+         * unregistered and is reused when the same patch is registered again with the same data
+         * context. Only the cell data of newly registered derived variables or derived variables
+         * requiring more sub-ghost cells is computed again. The conservative variables must not be
+         * changed while the cell data is cached.
+         */
+        void startCachingDerivedCellData();
+        
+        /*
+         * Stop caching the cell data of derived variables. The cached cell data is cleared.
+         */
+        void stopCachingDerivedCellData();
+        
+        /*
+         * Check whether the cell data of derived variables is cached or not.
+         */
+        bool isCachingDerivedCellData() const
+        {
+            return d_cache_derived_cell_data;
+        }
+        
         /*
          * Allocate memory for cell data of different registered derived variables.
          */
@@ -437,6 +471,177 @@ class FlowModel:
            d_data_context.reset();
         }
         
+        /*
+         * Clear the cell data of all derived variables and their numbers of sub-ghost cells.
+         */
+        virtual void
+        clearDerivedCellData() = 0;
+        
+        /*
+         * Split a box into tiles such that the cell data of the given number of variables on a tile
+         * fits in cache. The tiles are used to compute the cell data of several derived variables in
+         * a single pass over the cells.
+         */
+        void
+        getTilesOfDerivedCellData(
+            std::vector<hier::Box>& tiles,
+            const hier::Box& box,
+            const int num_variables) const;
+        
+        /*
+         * Compute the cell data of the quotient of two variables on a domain. The loops of this and the
+         * following kernels over the domain are templated on the number of dimensions.
+         */
+        void
+        computeCellDataOfQuotient(
+            double* const quotient,
+            const double* const numerator,
+            const double* const denominator,
+            const hier::IntVector& num_ghosts_quotient,
+            const hier::IntVector& num_ghosts_numerator,
+            const hier::IntVector& num_ghosts_denominator,
+            const hier::IntVector& ghostcell_dims_quotient,
+            const hier::IntVector& ghostcell_dims_numerator,
+            const hier::IntVector& ghostcell_dims_denominator,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims) const;
+        
+        /*
+         * Compute the cell data of velocity from momentum and density on a domain.
+         */
+        void
+        computeCellDataOfVelocityFromMomentum(
+            const std::vector<double*>& velocity,
+            const std::vector<const double*>& momentum,
+            const double* const rho,
+            const hier::IntVector& num_ghosts_velocity,
+            const hier::IntVector& num_ghosts_momentum,
+            const hier::IntVector& num_ghosts_density,
+            const hier::IntVector& ghostcell_dims_velocity,
+            const hier::IntVector& ghostcell_dims_momentum,
+            const hier::IntVector& ghostcell_dims_density,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims) const;
+        
+        /*
+         * Compute the cell data of the product of two variables on a domain.
+         */
+        void
+        computeCellDataOfProduct(
+            double* const product,
+            const double* const factor_a,
+            const double* const factor_b,
+            const hier::IntVector& num_ghosts_product,
+            const hier::IntVector& num_ghosts_factor_a,
+            const hier::IntVector& num_ghosts_factor_b,
+            const hier::IntVector& ghostcell_dims_product,
+            const hier::IntVector& ghostcell_dims_factor_a,
+            const hier::IntVector& ghostcell_dims_factor_b,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims) const;
+        
+        /*
+         * Compute the cell data of a copy of a variable on a domain.
+         */
+        void
+        computeCellDataOfCopy(
+            double* const copy,
+            const double* const data,
+            const hier::IntVector& num_ghosts_copy,
+            const hier::IntVector& num_ghosts_data,
+            const hier::IntVector& ghostcell_dims_copy,
+            const hier::IntVector& ghostcell_dims_data,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims) const;
+        
+        /*
+         * Compute the cell data of internal energy from total energy, density and velocity on a domain.
+         */
+        void
+        computeCellDataOfInternalEnergyFromTotalEnergy(
+            double* const epsilon,
+            const double* const E,
+            const double* const rho,
+            const std::vector<const double*>& velocity,
+            const hier::IntVector& num_ghosts_internal_energy,
+            const hier::IntVector& num_ghosts_total_energy,
+            const hier::IntVector& num_ghosts_density,
+            const hier::IntVector& num_ghosts_velocity,
+            const hier::IntVector& ghostcell_dims_internal_energy,
+            const hier::IntVector& ghostcell_dims_total_energy,
+            const hier::IntVector& ghostcell_dims_density,
+            const hier::IntVector& ghostcell_dims_velocity,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims) const;
+        
+        /*
+         * Compute the cell data of the components of the convective flux of momentum and total energy in
+         * a direction on a domain. The components of momentum start at ei_momentum in the convective flux
+         * and are followed by the one of total energy. Momentum and total energy have the same ghost cells.
+         */
+        void
+        computeCellDataOfConvectiveFluxOfMomentumAndTotalEnergy(
+            const std::vector<double*>& convective_flux,
+            const int ei_momentum,
+            const std::vector<const double*>& momentum,
+            const double* const E,
+            const double* const velocity_component,
+            const double* const p,
+            const hier::IntVector& num_ghosts_convective_flux,
+            const hier::IntVector& num_ghosts_conservative_variables,
+            const hier::IntVector& num_ghosts_velocity,
+            const hier::IntVector& num_ghosts_pressure,
+            const hier::IntVector& ghostcell_dims_convective_flux,
+            const hier::IntVector& ghostcell_dims_conservative_variables,
+            const hier::IntVector& ghostcell_dims_velocity,
+            const hier::IntVector& ghostcell_dims_pressure,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims,
+            const DIRECTION::TYPE& direction) const;
+        
+        /*
+         * Compute the cell data of maximum wave speed from the velocity component in a direction and sound
+         * speed on a domain.
+         */
+        void
+        computeCellDataOfMaxWaveSpeedFromVelocityComponent(
+            double* const lambda_max,
+            const double* const velocity_component,
+            const double* const c,
+            const hier::IntVector& num_ghosts_max_wave_speed,
+            const hier::IntVector& num_ghosts_velocity,
+            const hier::IntVector& num_ghosts_sound_speed,
+            const hier::IntVector& ghostcell_dims_max_wave_speed,
+            const hier::IntVector& ghostcell_dims_velocity,
+            const hier::IntVector& ghostcell_dims_sound_speed,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims) const;
+        
+        /*
+         * Compute the cell data of sound speed of a multi-species mixture from the Gruneisen parameter and the
+         * partial derivatives of pressure with respect to the partial densities on a domain. The Gruneisen
+         * parameter and the partial derivatives have the same ghost cells as sound speed. The loops are also
+         * templated on the number of species when it is two or three.
+         */
+        void
+        computeCellDataOfSoundSpeedFromPressureDerivatives(
+            double* const c,
+            const double* const rho,
+            const std::vector<const double*>& Y,
+            const double* const p,
+            const double* const Gamma,
+            const std::vector<const double*>& Psi,
+            const hier::IntVector& num_ghosts_sound_speed,
+            const hier::IntVector& num_ghosts_density,
+            const hier::IntVector& num_ghosts_mass_fractions,
+            const hier::IntVector& num_ghosts_pressure,
+            const hier::IntVector& ghostcell_dims_sound_speed,
+            const hier::IntVector& ghostcell_dims_density,
+            const hier::IntVector& ghostcell_dims_mass_fractions,
+            const hier::IntVector& ghostcell_dims_pressure,
+            const hier::IntVector& domain_lo,
+            const hier::IntVector& domain_dims) const;
+        
         /*
          * The object name is used for error/warning reporting.
          */
@@ -529,6 +734,20 @@ class FlowModel:
          */
         bool d_derived_cell_data_computed;
         
+        /*
+         * Whether the cell data of derived variables is cached, and the patch and data context of
+         * the cached cell data.
+         */
+        bool d_cache_derived_cell_data;
+        const hier::Patch* d_cached_patch;
+        HAMERS_SHARED_PTR<hier::VariableContext> d_cached_data_context;
+        
+        /*
+         * Whether the cell data of the derived variables is computed tile by tile in a single pass
+         * over the cells instead of one sweep over the whole patch per derived variable.
+         */
+        bool d_use_single_pass_derived_cell_data;
+        
         /*
          * HAMERS_SHARED_PTR to the plotting context.
          */
@@ -6,6 +6,7 @@
 #include "HAMeRS_memory.hpp"
 
 #include "flow/flow_models/FlowModel.hpp"
+#include "util/Directions.hpp"
 
 #include "SAMRAI/geom/CartesianGridGeometry.h"
 #include "SAMRAI/pdat/CellData.h"
@@ -199,7 +200,47 @@ class FlowModelBasicUtilities
             const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& characteristic_variables,
             const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& projection_variables) = 0;
         
+        /*
+         * Compute the characteristic variables from primitive variables on a line of faces in a
+         * direction. The primitive variables are the values in the cells at a fixed stencil offset
+         * from each face and the projection variables are the values at the faces.
+         */
+        virtual void
+        computeCharacteristicVariablesFromPrimitiveVariablesOnFaceLine(
+            const std::vector<double*>& characteristic_variables,
+            const std::vector<const double*>& primitive_variables,
+            const std::vector<const double*>& projection_variables,
+            const DIRECTION::TYPE& direction,
+            const int num_faces) = 0;
+        
+        /*
+         * Compute the primitive variables from characteristic variables on a line of faces in a
+         * direction.
+         */
+        virtual void
+        computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine(
+            const std::vector<double*>& primitive_variables,
+            const std::vector<const double*>& characteristic_variables,
+            const std::vector<const double*>& projection_variables,
+            const DIRECTION::TYPE& direction,
+            const int num_faces) = 0;
+        
 protected:
+        /*
+         * Compute the simple averages of cell data of a variable at the faces in a direction, including
+         * the ghost faces of the side data in that direction.
+         */
+        void
+        computeSideDataOfSimpleAverageOfCellData(
+            double* const data_average,
+            const double* const data,
+            const hier::IntVector& num_ghosts_average,
+            const hier::IntVector& num_ghosts_data,
+            const hier::IntVector& ghostcell_dims_average,
+            const hier::IntVector& ghostcell_dims_data,
+            const hier::IntVector& interior_dims,
+            const int direction) const;
+        
         /*
          * The object name is used for error/warning reporting.
          */
@@ -7,6 +7,7 @@
 
 #include "flow/flow_models/FlowModel.hpp"
 #include "util/Directions.hpp"
+#include "util/scratch_arena/ScratchPatchDataArena.hpp"
 
 #include "SAMRAI/geom/CartesianGridGeometry.h"
 #include "SAMRAI/pdat/SideData.h"
@@ -32,7 +33,10 @@ class FlowModelRiemannSolver
                 d_object_name(object_name),
                 d_dim(dim),
                 d_grid_geometry(grid_geometry),
-                d_num_species(num_species)
+                d_num_species(num_species),
+                d_scratch_arena(HAMERS_MAKE_SHARED<ScratchPatchDataArena>(
+                    object_name + "::d_scratch_arena",
+                    dim))
         {}
         
         virtual ~FlowModelRiemannSolver() {}
@@ -45,6 +49,15 @@ class FlowModelRiemannSolver
             d_flow_model = flow_model;
         }
         
+        /*
+         * Get the arena of the temporary patch data of the Riemann solver.
+         */
+        HAMERS_SHARED_PTR<ScratchPatchDataArena>
+        getScratchArena() const
+        {
+            return d_scratch_arena;
+        }
+        
         /*
          * Compute the convective flux from conservative variables.
          */
@@ -209,6 +222,12 @@ class FlowModelRiemannSolver
          */
         HAMERS_WEAK_PTR<FlowModel> d_flow_model;
         
+        /*
+         * Arena of the temporary patch data. The Riemann solver is owned by a single flow model so
+         * the arena is never shared between threads.
+         */
+        const HAMERS_SHARED_PTR<ScratchPatchDataArena> d_scratch_arena;
+        
 };
 
 #endif /* FLOW_MODEL_RIEMANN_SOLVER_HPP */
@@ -28,7 +28,8 @@ class FlowModelStatisticsUtilities
                 d_dim(dim),
                 d_grid_geometry(grid_geometry),
                 d_num_species(num_species),
-                d_is_ensemble_statistics_initialized(false)
+                d_is_ensemble_statistics_initialized(false),
+                d_can_defer_output_of_statistical_quantities(false)
         {
             /*
              * Get the names of statistical quantities to output.
@@ -135,6 +136,16 @@ class FlowModelStatisticsUtilities
             const HAMERS_SHARED_PTR<hier::VariableContext>& data_context,
             const double output_time) = 0;
         
+        /*
+         * Whether the output of the statistical quantities computed last only uses the data stored when they are
+         * computed such that the output can be deferred until after the next time step.
+         */
+        bool
+        canDeferOutputOfStatisticalQuantities() const
+        {
+            return d_can_defer_output_of_statistical_quantities;
+        }
+        
         /*
          * Get object of storing ensemble statistics.
          */
@@ -199,6 +210,12 @@ class FlowModelStatisticsUtilities
         HAMERS_SHARED_PTR<EnsembleStatistics> d_ensemble_statistics;
         
         bool d_is_ensemble_statistics_initialized;
+        
+        /*
+         * Whether the output of the statistical quantities computed last can be deferred until after the next
+         * time step.
+         */
+        bool d_can_defer_output_of_statistical_quantities;
 };
 
 #endif /* FLOW_MODEL_STATISTICS_UTILITIES_HPP */
@@ -6,6 +6,7 @@
 #include "flow/flow_models/MPI_helpers/FlowModelMPIHelper.hpp"
 
 #include <string>
+#include <vector>
 
 class FlowModelMPIHelperAverage: public FlowModelMPIHelper
 {
@@ -23,7 +24,9 @@ class FlowModelMPIHelperAverage: public FlowModelMPIHelper
                     grid_geometry,
                     patch_hierarchy,
                     flow_model,
-                    use_diffusive_flux_utilities)
+                    use_diffusive_flux_utilities),
+                d_num_profiles(0),
+                d_is_profile_reduction_in_progress(false)
         {}
         
         /*
@@ -232,6 +235,44 @@ class FlowModelMPIHelperAverage: public FlowModelMPIHelper
             const int num_ghosts_derivative,
             const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
         
+        /*
+         * Compute averaged values (on products of variables) of several products with only x-direction as
+         * inhomogeneous direction. The hierarchy is traversed once and a single reduction is done for all the
+         * products.
+         */
+        std::vector<std::vector<double> > getAveragedQuantitiesWithInhomogeneousXDirection(
+            const std::vector<std::vector<std::string> >& quantity_names,
+            const std::vector<std::vector<int> >& component_indices,
+            const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
+        
+        /*
+         * Compute averaged values (on products of variables) of several products with only x-direction as
+         * inhomogeneous direction. The hierarchy is traversed once and a single reduction is done for all the
+         * products.
+         */
+        std::vector<std::vector<double> > getAveragedQuantitiesWithInhomogeneousXDirection(
+            const std::vector<std::vector<std::string> >& quantity_names,
+            const std::vector<std::vector<int> >& component_indices,
+            const std::vector<std::vector<bool> >& use_reciprocal,
+            const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
+        
+        /*
+         * Start computing averaged values (on products of variables) of several products with only x-direction
+         * as inhomogeneous direction. The reduction of the averages is left in progress, e.g. to overlap it with
+         * the next time step, and the averages are only available after
+         * finishAveragedQuantitiesWithInhomogeneousXDirection() is called.
+         */
+        void startAveragedQuantitiesWithInhomogeneousXDirection(
+            const std::vector<std::vector<std::string> >& quantity_names,
+            const std::vector<std::vector<int> >& component_indices,
+            const std::vector<std::vector<bool> >& use_reciprocal,
+            const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
+        
+        /*
+         * Finish computing the averaged values started by startAveragedQuantitiesWithInhomogeneousXDirection().
+         */
+        std::vector<std::vector<double> > finishAveragedQuantitiesWithInhomogeneousXDirection();
+        
         /*
          * Compute averaged value with only y-direction as inhomogeneous direction.
          */
@@ -367,6 +408,19 @@ class FlowModelMPIHelperAverage: public FlowModelMPIHelper
             const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
         
     private:
+        /*
+         * Number of profiles, local profiles and global profiles of the averages being computed by
+         * startAveragedQuantitiesWithInhomogeneousXDirection().
+         */
+        int d_num_profiles;
+        std::vector<double> d_profiles_local;
+        std::vector<double> d_profiles_global;
+        
+        /*
+         * Whether the reduction of the profiles is still in progress and its request.
+         */
+        bool d_is_profile_reduction_in_progress;
+        tbox::SAMRAI_MPI::Request d_profile_reduction_request;
         
 };
 
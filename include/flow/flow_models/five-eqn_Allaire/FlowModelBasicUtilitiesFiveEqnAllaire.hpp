@@ -179,6 +179,31 @@ class FlowModelBasicUtilitiesFiveEqnAllaire: public FlowModelBasicUtilities
             const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& characteristic_variables,
             const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& projection_variables);
         
+        /*
+         * Compute the characteristic variables from primitive variables on a line of faces in a
+         * direction. The primitive variables are the values in the cells at a fixed stencil offset
+         * from each face and the projection variables are the values at the faces.
+         */
+        void
+        computeCharacteristicVariablesFromPrimitiveVariablesOnFaceLine(
+            const std::vector<double*>& characteristic_variables,
+            const std::vector<const double*>& primitive_variables,
+            const std::vector<const double*>& projection_variables,
+            const DIRECTION::TYPE& direction,
+            const int num_faces);
+        
+        /*
+         * Compute the primitive variables from characteristic variables on a line of faces in a
+         * direction.
+         */
+        void
+        computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine(
+            const std::vector<double*>& primitive_variables,
+            const std::vector<const double*>& characteristic_variables,
+            const std::vector<const double*>& projection_variables,
+            const DIRECTION::TYPE& direction,
+            const int num_faces);
+        
     private:
         /*
          * Upper and lower bounds on variables.
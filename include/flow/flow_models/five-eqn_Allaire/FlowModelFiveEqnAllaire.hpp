@@ -29,6 +29,11 @@ class FlowModelFiveEqnAllaire: public FlowModel
         void putToRestart(
             const HAMERS_SHARED_PTR<tbox::Database>& restart_db) const;
         
+        /*
+         * Create a worker flow model for concurrent patch operations.
+         */
+        HAMERS_SHARED_PTR<FlowModel> createWorkerFlowModel() const;
+        
         /*
          * Register the conservative variables.
          */
@@ -180,6 +185,12 @@ class FlowModelFiveEqnAllaire: public FlowModel
         void
         setDerivedCellVariableGhostBoxes();
         
+        /*
+         * Clear the cell data of all derived variables and their numbers of sub-ghost cells.
+         */
+        void
+        clearDerivedCellData();
+        
         /*
          * Get the cell data of partial densities in the registered patch.
          */
@@ -204,6 +215,12 @@ class FlowModelFiveEqnAllaire: public FlowModel
         HAMERS_SHARED_PTR<pdat::CellData<double> >
         getCellDataOfVolumeFractions();
         
+        /*
+         * Compute the cell data of the registered derived variables that are not yet computed tile
+         * by tile in a single pass over the cells of the registered patch.
+         */
+        void computeDerivedCellDataInSinglePass();
+        
         /*
          * Compute the cell data of density in the registered patch.
          */
@@ -362,6 +379,14 @@ class FlowModelFiveEqnAllaire: public FlowModel
         std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > d_data_species_densities;
         std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > d_data_species_temperatures;
         
+        /*
+         * HAMERS_SHARED_PTR to the partial derivatives of pressure used to compute sound speed. They
+         * are kept between calls so that computing sound speed tile by tile does not allocate the
+         * cell data for every tile.
+         */
+        HAMERS_SHARED_PTR<pdat::CellData<double> > d_data_sound_speed_gruneisen_parameter;
+        HAMERS_SHARED_PTR<pdat::CellData<double> > d_data_sound_speed_partial_pressure_partial_partial_densities;
+        
         /*
          * Whether derived cell data is computed.
          */
@@ -2,6 +2,8 @@
 #define FLOW_MODEL_RIEMANN_SOLVER_FIVE_EQN_ALLAIRE_HPP
 
 #include "flow/flow_models/FlowModelRiemannSolver.hpp"
+#include "util/CPUDispatch.hpp"
+#include "util/SIMDBlend.hpp"
 
 class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
 {
@@ -16,7 +18,10 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
                     dim,
                     grid_geometry,
                     num_species)
-        {}
+        {
+            setConvectiveFluxFunctionsHLLC();
+            setConvectiveFluxFunctionsHLLC_HLL();
+        }
         
         ~FlowModelRiemannSolverFiveEqnAllaire() {}
         
@@ -71,11 +76,36 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
             const hier::Box& domain) const;
         
     private:
+        /*
+         * Type of the functions computing the convective flux and velocity in a direction with a Riemann
+         * solver.
+         */
+        typedef void (FlowModelRiemannSolverFiveEqnAllaire::*ConvectiveFluxFunction)(
+            HAMERS_SHARED_PTR<pdat::SideData<double> >,
+            HAMERS_SHARED_PTR<pdat::SideData<double> >,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >&,
+            const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >&,
+            const hier::Box&,
+            bool) const;
+        
+        /*
+         * Set the functions computing the convective flux and velocity with HLLC Riemann solver.
+         */
+        void
+        setConvectiveFluxFunctionsHLLC();
+        
+        /*
+         * Set the functions computing the convective flux and velocity with HLLC-HLL Riemann solver.
+         */
+        void
+        setConvectiveFluxFunctionsHLLC_HLL();
+        
         /*
          * Compute the convective flux and velocity in the x-direction from conservative variables with
          * HLLC Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -88,7 +118,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from conservative variables with
          * HLLC Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -101,7 +132,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from conservative variables with
          * HLLC Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -114,7 +146,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the x-direction from primitive variables with
          * HLLC Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -127,7 +160,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from primitive variables with
          * HLLC Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -140,7 +174,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from primitive variables with
          * HLLC Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -153,7 +188,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the x-direction from conservative variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -166,7 +202,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from conservative variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -179,7 +216,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from conservative variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -192,7 +230,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the x-direction from primitive variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -205,7 +244,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from primitive variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -218,7 +258,8 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from primitive variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        template<int NUM_SPECIES>
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -227,6 +268,17 @@ class FlowModelRiemannSolverFiveEqnAllaire: public FlowModelRiemannSolver
             const hier::Box& domain,
             bool compute_velocity) const;
         
+        /*
+         * Functions computing the convective flux and velocity in each direction with the Riemann solvers.
+         * The template parameter of the functions is the number of species if the number of species is two
+         * or three and zero otherwise such that the loops over the species are unrolled for the common
+         * numbers of species.
+         */
+        ConvectiveFluxFunction d_compute_convective_flux_from_conservative_variables_HLLC[3];
+        ConvectiveFluxFunction d_compute_convective_flux_from_primitive_variables_HLLC[3];
+        ConvectiveFluxFunction d_compute_convective_flux_from_conservative_variables_HLLC_HLL[3];
+        ConvectiveFluxFunction d_compute_convective_flux_from_primitive_variables_HLLC_HLL[3];
+        
 };
 
 #endif /* FLOW_MODEL_RIEMANN_SOLVER_FIVE_EQN_ALLAIRE_HPP */
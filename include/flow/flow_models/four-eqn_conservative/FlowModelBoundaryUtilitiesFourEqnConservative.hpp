@@ -240,6 +240,13 @@ class FlowModelBoundaryUtilitiesFourEqnConservative: public FlowModelBoundaryUti
             std::string& db_name,
             int bdry_location_index);
         
+        /*
+         * Workspaces reused by the boundary fills to gather the states for the batched evaluation of the
+         * equation of state.
+         */
+        std::vector<double> d_bdry_fill_workspace;
+        std::vector<int> d_bdry_fill_idx_workspace;
+        
         /*
          * Vectors of node (1D), edge (2D) or face (3D) boundary values for ADIABATIC_NO_SLIP case.
          */
@@ -241,9 +241,17 @@ class FlowModelBoundaryUtilitiesSingleSpecies: public FlowModelBoundaryUtilities
             int bdry_location_index);
         
         /*
-         * Thermodynamic properties of the species.
+         * Thermodynamic properties of the species and the pointers to them.
          */
         std::vector<double> d_thermo_properties;
+        std::vector<const double*> d_thermo_properties_ptr;
+        
+        /*
+         * Workspaces reused by the boundary fills to gather the states for the batched evaluation of the
+         * equation of state.
+         */
+        std::vector<double> d_bdry_fill_workspace;
+        std::vector<int> d_bdry_fill_idx_workspace;
         
         /*
          * Vectors of node (1D), edge (2D) or face (3D) boundary values for ADIABATIC_NO_SLIP case.
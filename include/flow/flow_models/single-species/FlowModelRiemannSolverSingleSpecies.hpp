@@ -2,6 +2,8 @@
 #define FLOW_MODEL_RIEMANN_SOLVER_SINGLE_SPECIES_HPP
 
 #include "flow/flow_models/FlowModelRiemannSolver.hpp"
+#include "util/CPUDispatch.hpp"
+#include "util/SIMDBlend.hpp"
 
 class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
 {
@@ -75,7 +77,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the x-direction from conservative variables with
          * HLLC Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -88,7 +90,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from conservative variables with
          * HLLC Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -101,7 +103,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from conservative variables with
          * HLLC Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -114,7 +116,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the x-direction from primitive variables with
          * HLLC Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -127,7 +129,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from primitive variables with
          * HLLC Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -140,7 +142,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from primitive variables with
          * HLLC Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -153,7 +155,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the x-direction from conservative variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -166,7 +168,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from conservative variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -179,7 +181,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from conservative variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -192,7 +194,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the x-direction from primitive variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -205,7 +207,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the y-direction from primitive variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -218,7 +220,7 @@ class FlowModelRiemannSolverSingleSpecies: public FlowModelRiemannSolver
          * Compute the convective flux and velocity in the z-direction from primitive variables with
          * HLLC-HLL Riemann solver.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL(
             HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
             HAMERS_SHARED_PTR<pdat::SideData<double> > velocity,
@@ -30,6 +30,11 @@ class FlowModelSingleSpecies: public FlowModel
         void putToRestart(
             const HAMERS_SHARED_PTR<tbox::Database>& restart_db) const;
         
+        /*
+         * Create a worker flow model for concurrent patch operations.
+         */
+        HAMERS_SHARED_PTR<FlowModel> createWorkerFlowModel() const;
+        
         /*
          * Register the conservative variables.
          */
@@ -181,6 +186,12 @@ class FlowModelSingleSpecies: public FlowModel
         void
         setDerivedCellVariableGhostBoxes();
         
+        /*
+         * Clear the cell data of all derived variables and their numbers of sub-ghost cells.
+         */
+        void
+        clearDerivedCellData();
+        
         /*
          * Get the cell data of density in the registered patch.
          */
@@ -199,6 +210,12 @@ class FlowModelSingleSpecies: public FlowModel
         HAMERS_SHARED_PTR<pdat::CellData<double> >
         getCellDataOfTotalEnergy();
         
+        /*
+         * Compute the cell data of the registered derived variables that are not yet computed tile
+         * by tile in a single pass over the cells of the registered patch.
+         */
+        void computeDerivedCellDataInSinglePass();
+        
         /*
          * Compute the cell data of velocity in the registered patch.
          */
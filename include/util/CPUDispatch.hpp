@@ -0,0 +1,37 @@
+#ifndef CPU_DISPATCH_HPP
+#define CPU_DISPATCH_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include <string>
+
+/*
+ * Attribute that builds a function for several instruction sets inside one executable. The variant
+ * matching the instruction set of the CPU is selected once by the dynamic loader when the program
+ * starts. The attribute is only used with GNU and Clang compilers on x86-64. The Intel compilers
+ * generate the variants of all functions with the -ax option instead. The attribute cannot be used on
+ * virtual functions.
+ *
+ * Note that the variants may differ in the last bits of the results since the AVX-512 variant can use
+ * fused multiply-add instructions.
+ */
+#if defined(HAMERS_ENABLE_CPU_DISPATCH) && defined(__x86_64__) && defined(__GNUC__) && \
+    !defined(__INTEL_COMPILER) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+#define HAMERS_CPU_DISPATCH __attribute__((target_clones("avx512f", "avx2", "default")))
+#endif
+#endif
+
+#ifndef HAMERS_CPU_DISPATCH
+#define HAMERS_CPU_DISPATCH
+#endif
+
+namespace CPU_DISPATCH
+{
+    /*
+     * Get the name of the variant of the kernels selected for the CPU running the program.
+     */
+    std::string getSelectedVariant();
+}
+
+#endif /* CPU_DISPATCH_HPP */
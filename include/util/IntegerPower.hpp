@@ -0,0 +1,45 @@
+#ifndef INTEGER_POWER_HPP
+#define INTEGER_POWER_HPP
+
+/*
+ * Integer based power function with the exponent EXP fixed at compile time. The multiplications are
+ * unrolled so that the function can be vectorized inside loops over faces or cells. The exponent
+ * exp is only used if EXP is zero, in which case the exponent is known at run time only.
+ */
+template<int EXP>
+struct IntegerPower
+{
+    static inline __attribute__((always_inline)) double compute(const double base, const int exp)
+    {
+        return IntegerPower<EXP - 1>::compute(base, exp)*base;
+    }
+};
+
+
+template<>
+struct IntegerPower<1>
+{
+    static inline __attribute__((always_inline)) double compute(const double base, const int exp)
+    {
+        (void)exp;
+        return base;
+    }
+};
+
+
+template<>
+struct IntegerPower<0>
+{
+    static inline __attribute__((always_inline)) double compute(const double base, const int exp)
+    {
+        double result = base;
+        for (int i = 1; i < exp; i++)
+        {
+            result *= base;
+        }
+
+        return result;
+    }
+};
+
+#endif /* INTEGER_POWER_HPP */
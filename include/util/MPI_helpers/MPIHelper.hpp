@@ -5,14 +5,34 @@
 
 #include "HAMeRS_memory.hpp"
 
+#include "extn/patch_hierarchies/ExtendedFlattenedHierarchy.hpp"
+
 #include "SAMRAI/geom/CartesianGridGeometry.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/tbox/Dimension.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace SAMRAI;
 
+/*
+ * How the local profiles of the MPI helpers are reduced across the processes:
+ * ALL_REDUCE:     every process gets the whole global profile.
+ * REDUCE_TO_ROOT: only process 0 gets the global profile, e.g. when only process 0 writes it out.
+ * REDUCE_SCATTER: every process gets its own contiguous block of the global profile (see
+ *                 MPIHelper::getProfileBlockOfProcess()).
+ */
+namespace PROFILE_REDUCTION
+{
+    enum TYPE { ALL_REDUCE,
+                REDUCE_TO_ROOT,
+                REDUCE_SCATTER };
+}
+
 class MPIHelper
 {
     public:
@@ -67,7 +87,77 @@ class MPIHelper
             return d_dx_finest_level_dims;
         }
         
+        /*
+         * Set how the profiles are reduced across the processes. The entries of the returned profiles
+         * that are not reduced to the current process are zero.
+         */
+        void
+        setProfileReductionType(const PROFILE_REDUCTION::TYPE profile_reduction_type)
+        {
+            d_profile_reduction_type = profile_reduction_type;
+        }
+        
+        /*
+         * Get how the profiles are reduced across the processes.
+         */
+        PROFILE_REDUCTION::TYPE
+        getProfileReductionType() const
+        {
+            return d_profile_reduction_type;
+        }
+        
+        /*
+         * Get the range [index_lo, index_hi) of the entries of a profile with num_points entries that
+         * a process gets with PROFILE_REDUCTION::REDUCE_SCATTER.
+         */
+        void
+        getProfileBlockOfProcess(
+            const int num_points,
+            const int rank,
+            int& index_lo,
+            int& index_hi) const;
+        
     protected:
+        /*
+         * Reduce the local profiles of all processes into the global profile with the profile
+         * reduction type.
+         */
+        void
+        reduceProfile(
+            double* profile_local,
+            double* profile_global,
+            const int num_points) const;
+        
+        /*
+         * Start the reduction of the local profiles of all processes into the global profile with the
+         * profile reduction type without waiting for it to complete. Both buffers must stay untouched
+         * until finishProfileReduction() is called with the same request. Return whether the reduction
+         * is still in progress (false when it could only be done as a blocking reduction).
+         */
+        bool
+        startProfileReduction(
+            double* profile_local,
+            double* profile_global,
+            const int num_points,
+            tbox::SAMRAI_MPI::Request& request) const;
+        
+        /*
+         * Wait for a reduction started by startProfileReduction() that is still in progress to complete.
+         */
+        void
+        finishProfileReduction(
+            tbox::SAMRAI_MPI::Request& request) const;
+        
+        /*
+         * Get the flattened hierarchy of a range of levels of the patch hierarchy. The flattened
+         * hierarchies are cached and shared by all MPI helpers until the patch levels of the hierarchy
+         * are changed, e.g. by regridding.
+         */
+        HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy>
+        getFlattenedHierarchy(
+            const int coarsest_level,
+            const int finest_level) const;
+        
         /*
          * The object name is used for error/warning reporting.
          */
@@ -118,6 +208,21 @@ class MPIHelper
          */
         std::vector<double> d_dx_finest_level_dims;
         
+        /*
+         * How the profiles are reduced across the processes.
+         */
+        PROFILE_REDUCTION::TYPE d_profile_reduction_type;
+        
+    private:
+        /*
+         * Cached flattened hierarchies for the ranges of levels, and the patch hierarchy and patch
+         * levels that the cached flattened hierarchies are built from.
+         */
+        static std::map<std::pair<int, int>, HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> >
+            s_flattened_hierarchies;
+        static HAMERS_WEAK_PTR<hier::PatchHierarchy> s_flattened_hierarchies_patch_hierarchy;
+        static std::vector<HAMERS_WEAK_PTR<hier::PatchLevel> > s_flattened_hierarchies_patch_levels;
+        
 };
 
 #endif /* MPI_HELPER_HPP */
@@ -0,0 +1,72 @@
+#ifndef PADDED_3D_INDEXING_HPP
+#define PADDED_3D_INDEXING_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "SAMRAI/hier/IntVector.h"
+
+using namespace SAMRAI;
+
+/*
+ * Index arithmetic shared by the kernels over cell and side data of the flux reconstructors and the flow
+ * models. The loops of the kernels are padded to three dimensions. The number of dimensions DIM is a
+ * template parameter such that the bounds and strides of the missing directions are folded at compile time.
+ */
+
+/*
+ * Get the lower and upper bounds of the loops over the domain padded to three dimensions.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeLoopBoundsPadded3D(
+    int* lo,
+    int* hi,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    for (int di = 0; di < 3; di++)
+    {
+        if (di < DIM)
+        {
+            lo[di] = domain_lo[di];
+            hi[di] = domain_lo[di] + domain_dims[di];
+        }
+        else
+        {
+            lo[di] = 0;
+            hi[di] = 1;
+        }
+    }
+}
+
+
+/*
+ * Get the linear index offset of the ghost cells and the strides in the three directions of cell data
+ * (side_direction < 0) or side data in the direction side_direction.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeOffsetAndStridesPadded3D(
+    int& offset,
+    int* stride,
+    const hier::IntVector& num_ghosts,
+    const hier::IntVector& ghostcell_dims,
+    const int& side_direction)
+{
+    const int dim_0 = ghostcell_dims[0] + (side_direction == 0 ? 1 : 0);
+    const int dim_1 = (DIM > 1 ? ghostcell_dims[1] : 1) + (side_direction == 1 ? 1 : 0);
+    
+    stride[0] = 1;
+    stride[1] = (DIM > 1 ? dim_0 : 0);
+    stride[2] = (DIM > 2 ? dim_0*dim_1 : 0);
+    
+    offset = num_ghosts[0];
+    if (DIM > 1)
+    {
+        offset += num_ghosts[1]*stride[1];
+    }
+    if (DIM > 2)
+    {
+        offset += num_ghosts[2]*stride[2];
+    }
+}
+
+#endif /* PADDED_3D_INDEXING_HPP */
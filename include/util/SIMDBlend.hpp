@@ -0,0 +1,80 @@
+#ifndef SIMD_BLEND_HPP
+#define SIMD_BLEND_HPP
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Masked blends of the values of a lane inside loops over faces or cells. A mask has all its bits set
+ * if the condition holds and none otherwise, and the blend picks the bits of the first or the second
+ * value with bitwise operations. The blends are written for a single lane, so the vector width is
+ * the one of the instruction set the loop is compiled for: the compare and the blend become SSE2,
+ * AVX2 or AVX-512 mask operations in the variants of the functions with the HAMERS_CPU_DISPATCH
+ * attribute. Since the bits of the selected value are copied, a blend gives the same result bit for
+ * bit as a branch on the same condition.
+ */
+namespace SIMD_BLEND
+{
+    typedef uint64_t MASK;
+
+    /*
+     * Get the bits of a value.
+     */
+    static inline __attribute__((always_inline)) MASK getBits(const double value)
+    {
+        MASK bits;
+        memcpy(&bits, &value, sizeof(double));
+
+        return bits;
+    }
+
+    /*
+     * Get the value of some bits.
+     */
+    static inline __attribute__((always_inline)) double getValue(const MASK bits)
+    {
+        double value;
+        memcpy(&value, &bits, sizeof(double));
+
+        return value;
+    }
+
+    /*
+     * Get the mask of a condition.
+     */
+    static inline __attribute__((always_inline)) MASK getMask(const bool condition)
+    {
+        return MASK(0) - MASK(condition);
+    }
+
+    /*
+     * Select a if all the bits of the mask are set and b otherwise.
+     */
+    static inline __attribute__((always_inline)) double blend(
+        const MASK mask,
+        const double a,
+        const double b)
+    {
+        return getValue((getBits(a) & mask) | (getBits(b) & ~mask));
+    }
+
+    /*
+     * Get the minimum of two values that are not NaN with a masked blend. b is returned if the values
+     * are equal, as fmin does on x86-64, so that the sign of zero is the same.
+     */
+    static inline __attribute__((always_inline)) double min(const double a, const double b)
+    {
+        return blend(getMask(a < b), a, b);
+    }
+
+    /*
+     * Get the maximum of two values that are not NaN with a masked blend. b is returned if the values
+     * are equal, as fmax does on x86-64, so that the sign of zero is the same.
+     */
+    static inline __attribute__((always_inline)) double max(const double a, const double b)
+    {
+        return blend(getMask(a > b), a, b);
+    }
+}
+
+#endif /* SIMD_BLEND_HPP */
@@ -0,0 +1,107 @@
+#ifndef PATCH_WORKLOAD_MEASURER_HPP
+#define PATCH_WORKLOAD_MEASURER_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "HAMeRS_memory.hpp"
+
+#include "SAMRAI/hier/BoxContainer.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/tbox/Dimension.h"
+
+#include <string>
+
+using namespace SAMRAI;
+
+/*
+ * PatchWorkloadMeasurer measures the cost of the patch operations of an application into the
+ * workload patch data read by the load balancer for non-uniform load balancing.
+ *
+ * The workload on a level is reset when the measurement is started before the level is advanced.
+ * The wall time of the patch operations is then added to the cells of the patches while the level
+ * is advanced. When the measurement is finished, the workload is scaled such that the mean cost of
+ * the cells on the level is one, so that it can be compared with the uniform workload of the
+ * levels that are not advanced yet.
+ *
+ * Only the flag of the measurement is shared among the patches. The costs may be added on
+ * different patches concurrently.
+ */
+class PatchWorkloadMeasurer
+{
+    public:
+        PatchWorkloadMeasurer(
+            const std::string& object_name,
+            const tbox::Dimension& dim,
+            const int workload_data_id);
+        
+        /*
+         * Reset the workload on the patches of the level and start measuring the cost of the patch
+         * operations.
+         */
+        void
+        startMeasuringOnLevel(
+            const HAMERS_SHARED_PTR<hier::PatchLevel>& level);
+        
+        /*
+         * Stop measuring and scale the workload measured on the level such that the mean cost of the
+         * cells on the level is one. Nothing is done if the measurement was not started.
+         */
+        void
+        finishMeasuringOnLevel(
+            const HAMERS_SHARED_PTR<hier::PatchLevel>& level);
+        
+        /*
+         * Whether the cost of the patch operations is being measured.
+         */
+        bool isMeasuring() const
+        {
+            return d_is_measuring;
+        }
+        
+        /*
+         * Add the measured cost of an operation on a patch to the workload. The cost is shared evenly
+         * among the cells of the given boxes.
+         */
+        void
+        addCostToWorkload(
+            hier::Patch& patch,
+            const hier::BoxContainer& cost_boxes,
+            const double cost) const;
+        
+        /*
+         * Add the measured cost of filling the ghost cells at the physical boundaries of a patch to
+         * the workload. The cost is put on the interior cells within the filled ghost cell width from
+         * the physical boundaries.
+         */
+        void
+        addPhysicalBoundaryFillCostToWorkload(
+            hier::Patch& patch,
+            const hier::IntVector& ghost_width_to_fill,
+            const double cost) const;
+    
+    private:
+        /*
+         * The object name is used for error/warning reporting.
+         */
+        const std::string d_object_name;
+        
+        /*
+         * Problem dimension.
+         */
+        const tbox::Dimension d_dim;
+        
+        /*
+         * Index of the workload patch data.
+         */
+        const int d_workload_data_id;
+        
+        /*
+         * Whether the cost of the patch operations is being measured.
+         */
+        bool d_is_measuring;
+        
+};
+
+#endif /* PATCH_WORKLOAD_MEASURER_HPP */
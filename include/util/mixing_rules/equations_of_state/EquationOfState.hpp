@@ -41,6 +41,20 @@ class EquationOfState
             const double* const internal_energy,
             const std::vector<const double*>& thermo_properties) const = 0;
         
+        /*
+         * Compute the pressure of a batch of states stored contiguously.
+         * thermo_properties_stride is zero if each thermodynamic property is shared by all
+         * states and one if it is given for every state.
+         */
+        virtual void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const = 0;
+        
         /*
          * Compute the pressure.
          */
@@ -176,6 +190,20 @@ class EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const = 0;
         
+        /*
+         * Compute the sound speed of a batch of states stored contiguously.
+         * thermo_properties_stride is zero if each thermodynamic property is shared by all
+         * states and one if it is given for every state.
+         */
+        virtual void
+        computeSoundSpeed(
+            double* const sound_speed,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const = 0;
+        
         /*
          * Compute the sound speed.
          */
@@ -311,6 +339,20 @@ class EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const = 0;
         
+        /*
+         * Compute the specific internal energy of a batch of states stored contiguously.
+         * thermo_properties_stride is zero if each thermodynamic property is shared by all
+         * states and one if it is given for every state.
+         */
+        virtual void
+        computeInternalEnergy(
+            double* const internal_energy,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const = 0;
+        
         /*
          * Compute the specific internal energy.
          */
@@ -581,6 +623,20 @@ class EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const = 0;
         
+        /*
+         * Compute the temperature of a batch of states stored contiguously.
+         * thermo_properties_stride is zero if each thermodynamic property is shared by all
+         * states and one if it is given for every state.
+         */
+        virtual void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const = 0;
+        
         /*
          * Compute the temperature.
          */
@@ -716,6 +772,20 @@ class EquationOfState
             const double* const temperature,
             const std::vector<const double*>& thermo_properties) const = 0;
         
+        /*
+         * Compute the specific internal energy from temperature of a batch of states stored contiguously.
+         * thermo_properties_stride is zero if each thermodynamic property is shared by all
+         * states and one if it is given for every state.
+         */
+        virtual void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const = 0;
+        
         /*
          * Compute the specific internal energy from temperature.
          */
@@ -1122,6 +1192,20 @@ class EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const = 0;
         
+        /*
+         * Compute the Gruneisen parameter of a batch of states stored contiguously.
+         * thermo_properties_stride is zero if each thermodynamic property is shared by all
+         * states and one if it is given for every state.
+         */
+        virtual void
+        computeGruneisenParameter(
+            double* const gruneisen_parameter,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const = 0;
+        
         /*
          * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
          * constant density divided by density).
@@ -1400,6 +1484,20 @@ class EquationOfState
             const double* const temperature,
             const std::vector<const double*>& thermo_properties) const = 0;
         
+        /*
+         * Compute the density of a batch of states stored contiguously.
+         * thermo_properties_stride is zero if each thermodynamic property is shared by all
+         * states and one if it is given for every state.
+         */
+        virtual void
+        computeDensity(
+            double* const density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const = 0;
+        
         /*
          * Compute the density.
          */
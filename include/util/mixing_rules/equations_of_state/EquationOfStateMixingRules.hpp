@@ -59,6 +59,19 @@ class EquationOfStateMixingRules
             const double* const internal_energy,
             const std::vector<const double*>& mass_fractions) const = 0;
         
+        /*
+         * Compute the pressure of the mixture of a batch of states stored contiguously with isothermal
+         * and isobaric equilibrium assumptions.
+         */
+        virtual void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const = 0;
+        
         /*
          * Compute the pressure of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -210,6 +223,19 @@ class EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const = 0;
         
+        /*
+         * Compute the specific internal energy of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        virtual void
+        computeInternalEnergy(
+            double* const internal_energy,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const = 0;
+        
         /*
          * Compute the specific internal energy of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -361,6 +387,19 @@ class EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const = 0;
         
+        /*
+         * Compute the temperature of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        virtual void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const = 0;
+        
         /*
          * Compute the temperature of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -434,6 +473,19 @@ class EquationOfStateMixingRules
             const double* const temperature,
             const std::vector<const double*>& mass_fractions) const = 0;
         
+        /*
+         * Compute the specific internal energy of the mixture from temperature of a batch of states stored
+         * contiguously with isothermal and isobaric equilibrium assumptions.
+         */
+        virtual void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const = 0;
+        
         /*
          * Compute the specific internal energy of the mixture from temperature with isothermal
          * and isobaric equilibrium assumptions.
@@ -666,6 +718,19 @@ class EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const = 0;
         
+        /*
+         * Compute the Gruneisen parameter of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        virtual void
+        computeGruneisenParameter(
+            double* const gruneisen_parameter,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const = 0;
+        
         /*
          * Compute the Gruneisen parameter of the mixture with isothermal and isobaric equilibrium assumptions
          * (partial derivative of pressure w.r.t. specific internal energy under constant partial densities
@@ -836,6 +901,20 @@ class EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const = 0;
         
+        /*
+         * Compute the mixture partial derivative of pressure w.r.t. partial densities of a batch of states
+         * stored contiguously under constant specific internal energy with isothermal and isobaric equilibrium
+         * assumptions.
+         */
+        virtual void
+        computePressureDerivativeWithPartialDensities(
+            double* const* const partial_pressure_partial_partial_densities,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const = 0;
+        
         /*
          * Compute the mixture partial derivative of pressure w.r.t. partial densities under constant specific
          * internal energy with isothermal and isobaric equilibrium assumptions.
@@ -1080,6 +1159,19 @@ class EquationOfStateMixingRules
             const double* const temperature,
             const std::vector<const double*>& mass_fractions) const = 0;
         
+        /*
+         * Compute the density of mixture of a batch of states stored contiguously with isothermal and
+         * isobaric equilibrium assumptions.
+         */
+        virtual void
+        computeMixtureDensity(
+            double* const mixture_density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const = 0;
+        
         /*
          * Compute the density of mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -2,6 +2,7 @@
 #define EQUATION_OF_STATE_IDEAL_GAS_HPP
 
 #include "util/mixing_rules/equations_of_state/EquationOfState.hpp"
+#include "util/CPUDispatch.hpp"
 
 #include <cmath>
 
@@ -33,6 +34,18 @@ class EquationOfStateIdealGas: public EquationOfState
             const double* const internal_energy,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the pressure of a batch of states stored contiguously.
+         */
+        void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the pressure.
          */
@@ -88,6 +101,18 @@ class EquationOfStateIdealGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the sound speed of a batch of states stored contiguously.
+         */
+        void
+        computeSoundSpeed(
+            double* const sound_speed,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the sound speed.
          */
@@ -143,6 +168,18 @@ class EquationOfStateIdealGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the specific internal energy of a batch of states stored contiguously.
+         */
+        void
+        computeInternalEnergy(
+            double* const internal_energy,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy.
          */
@@ -253,6 +290,18 @@ class EquationOfStateIdealGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the temperature of a batch of states stored contiguously.
+         */
+        void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the temperature.
          */
@@ -308,6 +357,18 @@ class EquationOfStateIdealGas: public EquationOfState
             const double* const temperature,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the specific internal energy from temperature of a batch of states stored contiguously.
+         */
+        void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy from temperature.
          */
@@ -474,6 +535,18 @@ class EquationOfStateIdealGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the Gruneisen parameter of a batch of states stored contiguously.
+         */
+        void
+        computeGruneisenParameter(
+            double* const gruneisen_parameter,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
          * constant density divided by density).
@@ -588,6 +661,18 @@ class EquationOfStateIdealGas: public EquationOfState
             const double* const temperature,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the density of a batch of states stored contiguously.
+         */
+        void
+        computeDensity(
+            double* const density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the density.
          */
@@ -638,7 +723,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the pressure.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computePressure(
             double* const p,
             const double* const rho,
@@ -656,7 +741,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the pressure.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computePressure(
             double* const p,
             const double* const rho,
@@ -676,7 +761,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the sound speed.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeSoundSpeed(
             double* const c,
             const double* const rho,
@@ -694,7 +779,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the sound speed.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeSoundSpeed(
             double* const c,
             const double* const rho,
@@ -714,7 +799,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the specific internal energy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergy(
             double* const epsilon,
             const double* const rho,
@@ -732,7 +817,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the specific internal energy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergy(
             double* const epsilon,
             const double* const rho,
@@ -752,7 +837,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the specific enthalpy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeEnthalpy(
             double* const h,
             const double* const rho,
@@ -770,7 +855,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the specific enthalpy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeEnthalpy(
             double* const h,
             const double* const rho,
@@ -790,7 +875,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeTemperature(
             double* const T,
             const double* const rho,
@@ -809,7 +894,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeTemperature(
             double* const T,
             const double* const rho,
@@ -830,7 +915,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the specific internal energy from temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergyFromTemperature(
             double* const epsilon,
             const double* const T,
@@ -845,7 +930,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the specific internal energy from temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergyFromTemperature(
             double* const epsilon,
             const double* const T,
@@ -862,7 +947,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the isochoric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsochoricSpecificHeatCapacity(
             double* const c_v,
             const double& c_v_src,
@@ -874,7 +959,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the isochoric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsochoricSpecificHeatCapacity(
             double* const c_v,
             const double* const c_v_src,
@@ -888,7 +973,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the isobaric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsobaricSpecificHeatCapacity(
             double* const c_p,
             const double& c_p_src,
@@ -900,7 +985,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the isobaric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsobaricSpecificHeatCapacity(
             double* const c_p,
             const double* const c_p_src,
@@ -915,7 +1000,7 @@ class EquationOfStateIdealGas: public EquationOfState
          * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
          * constant density divided by density).
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeGruneisenParameter(
             double* const Gamma,
             const double& gamma,
@@ -928,7 +1013,7 @@ class EquationOfStateIdealGas: public EquationOfState
          * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
          * constant density divided by density).
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeGruneisenParameter(
             double* const Gamma,
             const double* const gamma,
@@ -942,7 +1027,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the partial derivative of pressure w.r.t. density under constant specific internal energy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computePressureDerivativeWithDensity(
             double* const Psi,
             const double* const rho,
@@ -959,7 +1044,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the density.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeDensity(
             double* const rho,
             const double* const p,
@@ -977,7 +1062,7 @@ class EquationOfStateIdealGas: public EquationOfState
         /*
          * Compute the density.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeDensity(
             double* const rho,
             const double* const p,
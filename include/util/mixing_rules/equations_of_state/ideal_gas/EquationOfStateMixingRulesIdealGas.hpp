@@ -50,6 +50,19 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             const double* const internal_energy,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the pressure of the mixture of a batch of states stored contiguously with isothermal
+         * and isobaric equilibrium assumptions.
+         */
+        void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the pressure of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -117,6 +130,19 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the specific internal energy of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeInternalEnergy(
+            double* const internal_energy,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -184,6 +210,19 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the temperature of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the temperature of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -217,6 +256,19 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             const double* const temperature,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the specific internal energy of the mixture from temperature of a batch of states stored
+         * contiguously with isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy of the mixture from temperature with isothermal
          * and isobaric equilibrium assumptions.
@@ -323,6 +375,19 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the Gruneisen parameter of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeGruneisenParameter(
+            double* const gruneisen_parameter,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the Gruneisen parameter of the mixture with isothermal and isobaric equilibrium assumptions
          * (partial derivative of pressure w.r.t. specific internal energy under constant partial densities
@@ -401,6 +466,20 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the mixture partial derivative of pressure w.r.t. partial densities of a batch of states
+         * stored contiguously under constant specific internal energy with isothermal and isobaric equilibrium
+         * assumptions.
+         */
+        void
+        computePressureDerivativeWithPartialDensities(
+            double* const* const partial_pressure_partial_partial_densities,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the mixture partial derivative of pressure w.r.t. partial densities under constant specific
          * internal energy with isothermal and isobaric equilibrium assumptions.
@@ -511,6 +590,19 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             const double* const temperature,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the density of mixture of a batch of states stored contiguously with isothermal and
+         * isobaric equilibrium assumptions.
+         */
+        void
+        computeMixtureDensity(
+            double* const mixture_density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the density of mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -594,6 +686,18 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
             std::vector<double*>& mixture_thermo_properties,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the thermodynamic properties of the mixture with mass fractions of the states
+         * [offset, offset + num_states) of a batch of states stored contiguously.
+         */
+        void
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            double* const* const mixture_thermo_properties,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int offset,
+            const int num_states) const;
+        
         /*
          * Compute the thermodynamic properties of the mixture with mass fractions.
          */
@@ -850,6 +954,12 @@ class EquationOfStateMixingRulesIdealGas: public EquationOfStateMixingRules
          */
         HAMERS_SHARED_PTR<EquationOfState> d_equation_of_state;
         
+        /*
+         * Maximum number of states of which the mixture thermodynamic properties are stored on the
+         * stack at once by the batched functions.
+         */
+        static const int s_max_num_states_batch = 64;
+        
 };
 
 #endif /* EQUATION_OF_STATE_MIXING_RULES_IDEAL_GAS_HPP */
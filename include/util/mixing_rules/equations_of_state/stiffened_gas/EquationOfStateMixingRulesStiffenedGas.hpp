@@ -50,6 +50,19 @@ class EquationOfStateMixingRulesStiffenedGas: public EquationOfStateMixingRules
             const double* const internal_energy,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the pressure of the mixture of a batch of states stored contiguously with isothermal
+         * and isobaric equilibrium assumptions.
+         */
+        void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the pressure of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -117,6 +130,19 @@ class EquationOfStateMixingRulesStiffenedGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the specific internal energy of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeInternalEnergy(
+            double* const internal_energy,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -184,6 +210,19 @@ class EquationOfStateMixingRulesStiffenedGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the temperature of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the temperature of the mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -217,6 +256,19 @@ class EquationOfStateMixingRulesStiffenedGas: public EquationOfStateMixingRules
             const double* const temperature,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the specific internal energy of the mixture from temperature of a batch of states stored
+         * contiguously with isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy of the mixture from temperature with isothermal
          * and isobaric equilibrium assumptions.
@@ -323,6 +375,19 @@ class EquationOfStateMixingRulesStiffenedGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the Gruneisen parameter of the mixture of a batch of states stored contiguously with
+         * isothermal and isobaric equilibrium assumptions.
+         */
+        void
+        computeGruneisenParameter(
+            double* const gruneisen_parameter,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the Gruneisen parameter of the mixture with isothermal and isobaric equilibrium assumptions
          * (partial derivative of pressure w.r.t. specific internal energy under constant partial densities
@@ -401,6 +466,20 @@ class EquationOfStateMixingRulesStiffenedGas: public EquationOfStateMixingRules
             const double* const pressure,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the mixture partial derivative of pressure w.r.t. partial densities of a batch of states
+         * stored contiguously under constant specific internal energy with isothermal and isobaric equilibrium
+         * assumptions.
+         */
+        void
+        computePressureDerivativeWithPartialDensities(
+            double* const* const partial_pressure_partial_partial_densities,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the mixture partial derivative of pressure w.r.t. partial densities under constant specific
          * internal energy with isothermal and isobaric equilibrium assumptions.
@@ -511,6 +590,19 @@ class EquationOfStateMixingRulesStiffenedGas: public EquationOfStateMixingRules
             const double* const temperature,
             const std::vector<const double*>& mass_fractions) const;
         
+        /*
+         * Compute the density of mixture of a batch of states stored contiguously with isothermal and
+         * isobaric equilibrium assumptions.
+         */
+        void
+        computeMixtureDensity(
+            double* const mixture_density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const* const mass_fractions,
+            const int num_mass_fractions,
+            const int num_states) const;
+        
         /*
          * Compute the density of mixture with isothermal and isobaric equilibrium assumptions.
          */
@@ -2,6 +2,7 @@
 #define EQUATION_OF_STATE_STIFFENED_GAS_HPP
 
 #include "util/mixing_rules/equations_of_state/EquationOfState.hpp"
+#include "util/CPUDispatch.hpp"
 
 #include <cmath>
 
@@ -33,6 +34,18 @@ class EquationOfStateStiffenedGas: public EquationOfState
             const double* const internal_energy,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the pressure of a batch of states stored contiguously.
+         */
+        void
+        computePressure(
+            double* const pressure,
+            const double* const density,
+            const double* const internal_energy,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the pressure.
          */
@@ -88,6 +101,18 @@ class EquationOfStateStiffenedGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the sound speed of a batch of states stored contiguously.
+         */
+        void
+        computeSoundSpeed(
+            double* const sound_speed,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the sound speed.
          */
@@ -143,6 +168,18 @@ class EquationOfStateStiffenedGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the specific internal energy of a batch of states stored contiguously.
+         */
+        void
+        computeInternalEnergy(
+            double* const internal_energy,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy.
          */
@@ -253,6 +290,18 @@ class EquationOfStateStiffenedGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the temperature of a batch of states stored contiguously.
+         */
+        void
+        computeTemperature(
+            double* const temperature,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the temperature.
          */
@@ -308,6 +357,18 @@ class EquationOfStateStiffenedGas: public EquationOfState
             const double* const temperature,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the specific internal energy from temperature of a batch of states stored contiguously.
+         */
+        void
+        computeInternalEnergyFromTemperature(
+            double* const internal_energy,
+            const double* const density,
+            const double* const temperature,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the specific internal energy from temperature.
          */
@@ -474,6 +535,18 @@ class EquationOfStateStiffenedGas: public EquationOfState
             const double* const pressure,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the Gruneisen parameter of a batch of states stored contiguously.
+         */
+        void
+        computeGruneisenParameter(
+            double* const gruneisen_parameter,
+            const double* const density,
+            const double* const pressure,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
          * constant density divided by density).
@@ -588,6 +661,18 @@ class EquationOfStateStiffenedGas: public EquationOfState
             const double* const temperature,
             const std::vector<const double*>& thermo_properties) const;
         
+        /*
+         * Compute the density of a batch of states stored contiguously.
+         */
+        void
+        computeDensity(
+            double* const density,
+            const double* const pressure,
+            const double* const temperature,
+            const double* const* const thermo_properties,
+            const int thermo_properties_stride,
+            const int num_states) const;
+        
         /*
          * Compute the density.
          */
@@ -638,7 +723,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the pressure.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computePressure(
             double* const p,
             const double* const rho,
@@ -657,7 +742,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the pressure.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computePressure(
             double* const p,
             const double* const rho,
@@ -678,7 +763,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the sound speed.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeSoundSpeed(
             double* const c,
             const double* const rho,
@@ -697,7 +782,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the sound speed.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeSoundSpeed(
             double* const c,
             const double* const rho,
@@ -718,7 +803,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the specific internal energy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergy(
             double* const epsilon,
             const double* const rho,
@@ -737,7 +822,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the specific internal energy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergy(
             double* const epsilon,
             const double* const rho,
@@ -758,7 +843,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the specific enthalpy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeEnthalpy(
             double* const h,
             const double* const rho,
@@ -777,7 +862,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the specific enthalpy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeEnthalpy(
             double* const h,
             const double* const rho,
@@ -798,7 +883,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeTemperature(
             double* const T,
             const double* const rho,
@@ -818,7 +903,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeTemperature(
             double* const T,
             const double* const rho,
@@ -840,7 +925,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the specific internal energy from temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergyFromTemperature(
             double* const epsilon,
             const double* const rho,
@@ -859,7 +944,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the specific internal energy from temperature.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeInternalEnergyFromTemperature(
             double* const epsilon,
             const double* const rho,
@@ -880,7 +965,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the isochoric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsochoricSpecificHeatCapacity(
             double* const c_v,
             const double& c_v_src,
@@ -892,7 +977,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the isochoric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsochoricSpecificHeatCapacity(
             double* const c_v,
             const double* const c_v_src,
@@ -906,7 +991,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the isobaric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsobaricSpecificHeatCapacity(
             double* const c_p,
             const double& c_p_src,
@@ -918,7 +1003,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the isobaric specific heat capacity.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeIsobaricSpecificHeatCapacity(
             double* const c_p,
             const double* const c_p_src,
@@ -933,7 +1018,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
          * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
          * constant density divided by density).
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeGruneisenParameter(
             double* const Gamma,
             const double& gamma,
@@ -946,7 +1031,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
          * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
          * constant density divided by density).
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeGruneisenParameter(
             double* const Gamma,
             const double* const gamma,
@@ -960,7 +1045,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the partial derivative of pressure w.r.t. density under constant specific internal energy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computePressureDerivativeWithDensity(
             double* const Psi,
             const double* const rho,
@@ -979,7 +1064,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the partial derivative of pressure w.r.t. density under constant specific internal energy.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computePressureDerivativeWithDensity(
             double* const Psi,
             const double* const rho,
@@ -1000,7 +1085,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the density.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeDensity(
             double* const rho,
             const double* const p,
@@ -1020,7 +1105,7 @@ class EquationOfStateStiffenedGas: public EquationOfState
         /*
          * Compute the density.
          */
-        void
+        HAMERS_CPU_DISPATCH void
         computeDensity(
             double* const rho,
             const double* const p,
@@ -0,0 +1,341 @@
+#ifndef SCRATCH_PATCH_DATA_ARENA_HPP
+#define SCRATCH_PATCH_DATA_ARENA_HPP
+
+#include "HAMeRS_config.hpp"
+
+#include "HAMeRS_memory.hpp"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/PatchData.h"
+#include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/pdat/SideData.h"
+#include "SAMRAI/tbox/Dimension.h"
+#include "SAMRAI/tbox/Statistic.h"
+
+#include <list>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace SAMRAI;
+
+/*
+ * ScratchPatchDataArena hands out temporary patch data that is needed only for the duration of a
+ * patch operation (e.g. the mid-point fluxes of a convective flux reconstructor or the face
+ * quantities of a Riemann solver) and keeps the data alive after the caller has released it so
+ * that the next request of the same kind can be served without going through the heap.
+ *
+ * The data is bucketed by size class (centering, depth, ghost cell width, side directions and box
+ * dimensions). A request is served by a free entry of its size class on exactly the same box, e.g.
+ * when the same patch is visited again in the next Runge-Kutta stage; otherwise new data is
+ * allocated. Since SAMRAI patch data cannot be moved to another box or wrap external storage, the
+ * heap is only avoided for the hits, and the hit rate drops when the arena cycles through more
+ * patches than the working sets it keeps. An entry is in use as long as the caller holds a pointer
+ * to it; dropping the last pointer returns the entry to the arena.
+ *
+ * The hit/miss counts of all arenas can be recorded in the SAMRAI statistician and printed with
+ * the sums over all processors.
+ *
+ * The arena is not thread-safe. It is meant to be owned by an object that is only used by one
+ * thread at a time (e.g. a per-thread worker of a flux reconstructor or a flow model).
+ */
+class ScratchPatchDataArena
+{
+    public:
+        ScratchPatchDataArena(
+            const std::string& object_name,
+            const tbox::Dimension& dim,
+            const int max_num_working_sets = 4);
+        
+        ~ScratchPatchDataArena();
+        
+        /*
+         * Get side data of doubles in all directions.
+         */
+        HAMERS_SHARED_PTR<pdat::SideData<double> >
+        getSideData(
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts);
+        
+        /*
+         * Get side data of doubles in the directions given by the direction vector.
+         */
+        HAMERS_SHARED_PTR<pdat::SideData<double> >
+        getSideData(
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts,
+            const hier::IntVector& directions);
+        
+        /*
+         * Get side data of integers in all directions.
+         */
+        HAMERS_SHARED_PTR<pdat::SideData<int> >
+        getSideDataOfIntegers(
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts);
+        
+        /*
+         * Get cell data of doubles.
+         */
+        HAMERS_SHARED_PTR<pdat::CellData<double> >
+        getCellData(
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts);
+        
+        /*
+         * Mark the end of a patch operation. Free entries are released in least-recently-used order
+         * until the memory held by the arena is within the maximum number of working sets, where
+         * the size of a working set is the peak memory in use during a patch operation.
+         */
+        void
+        reset();
+        
+        /*
+         * Release all free entries.
+         */
+        void
+        clear();
+        
+        /*
+         * Get the number of requests served from cached entries.
+         */
+        unsigned long
+        getNumberOfHits() const
+        {
+            return d_num_hits;
+        }
+        
+        /*
+         * Get the number of requests that required a new allocation.
+         */
+        unsigned long
+        getNumberOfMisses() const
+        {
+            return d_num_misses;
+        }
+        
+        /*
+         * Get the number of bytes currently held by the arena.
+         */
+        size_t
+        getNumberOfBytesHeld() const
+        {
+            return d_num_bytes_held;
+        }
+        
+        /*
+         * Print all characteristics of the arena.
+         */
+        void
+        printClassData(std::ostream& os) const;
+        
+        /*
+         * Record the hit/miss statistics of all live arenas, accumulated by object name, as
+         * processor statistics of the SAMRAI statistician.
+         */
+        static void
+        recordStatistics();
+        
+        /*
+         * Print the hit/miss statistics of all live arenas of this processor, accumulated by object
+         * name, and the sums over all processors of the statistics last recorded in the SAMRAI
+         * statistician.
+         */
+        static void
+        printStatistics(std::ostream& os);
+    
+    private:
+        /*
+         * Centering of the data in an entry.
+         */
+        enum CENTERING { SIDE_DOUBLE,
+                         SIDE_INT,
+                         CELL_DOUBLE };
+        
+        /*
+         * Cached patch data and its bookkeeping.
+         */
+        struct Entry
+        {
+            Entry(
+                const HAMERS_SHARED_PTR<hier::PatchData>& data,
+                const size_t num_bytes,
+                const unsigned long last_used):
+                    d_data(data),
+                    d_num_bytes(num_bytes),
+                    d_last_used(last_used),
+                    d_in_use(false)
+            {}
+            
+            HAMERS_SHARED_PTR<hier::PatchData> d_data;
+            size_t d_num_bytes;
+            unsigned long d_last_used;
+            bool d_in_use;
+        };
+        
+        /*
+         * Deleter of the pointers handed out to the callers. It returns the entry to the arena
+         * instead of deleting the data.
+         */
+        struct EntryReleaser
+        {
+            EntryReleaser(
+                ScratchPatchDataArena* arena,
+                Entry* entry):
+                    d_arena(arena),
+                    d_entry(entry)
+            {}
+            
+            void
+            operator()(hier::PatchData*) const
+            {
+                d_arena->releaseEntry(*d_entry);
+            }
+            
+            ScratchPatchDataArena* d_arena;
+            Entry* d_entry;
+        };
+        
+        /*
+         * Statistics of the arenas with the same object name.
+         */
+        struct Statistics
+        {
+            Statistics():
+                d_num_arenas(0),
+                d_num_hits(0),
+                d_num_misses(0),
+                d_num_releases(0),
+                d_num_bytes_held_peak(0)
+            {}
+            
+            int d_num_arenas;
+            unsigned long d_num_hits;
+            unsigned long d_num_misses;
+            unsigned long d_num_releases;
+            size_t d_num_bytes_held_peak;
+        };
+        
+        /*
+         * Accumulate the statistics of all live arenas by object name.
+         */
+        static std::map<std::string, Statistics>
+        accumulateStatistics();
+        
+        /*
+         * Find a free entry matching the request or allocate a new one.
+         */
+        HAMERS_SHARED_PTR<hier::PatchData>
+        getPatchData(
+            const CENTERING centering,
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts,
+            const hier::IntVector& directions);
+        
+        /*
+         * Hand out an entry to a caller.
+         */
+        HAMERS_SHARED_PTR<hier::PatchData>
+        acquireEntry(
+            Entry& entry);
+        
+        /*
+         * Return an entry released by a caller to the arena.
+         */
+        void
+        releaseEntry(
+            Entry& entry);
+        
+        /*
+         * Allocate the patch data of a request.
+         */
+        HAMERS_SHARED_PTR<hier::PatchData>
+        allocatePatchData(
+            const CENTERING centering,
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts,
+            const hier::IntVector& directions) const;
+        
+        /*
+         * Compute the size class of a request.
+         */
+        std::vector<int>
+        computeSizeClass(
+            const CENTERING centering,
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts,
+            const hier::IntVector& directions) const;
+        
+        /*
+         * Compute the number of bytes of the array data of a request.
+         */
+        size_t
+        computeNumberOfBytes(
+            const CENTERING centering,
+            const hier::Box& box,
+            const int depth,
+            const hier::IntVector& ghosts,
+            const hier::IntVector& directions) const;
+        
+        /*
+         * The object name is used for error/warning reporting and for grouping the statistics.
+         */
+        const std::string d_object_name;
+        
+        /*
+         * Problem dimension.
+         */
+        const tbox::Dimension d_dim;
+        
+        /*
+         * Maximum number of working sets kept after a patch operation.
+         */
+        const int d_max_num_working_sets;
+        
+        /*
+         * Cached entries bucketed by size class. Lists are used so that the entries referred to by
+         * the pointers handed out are not moved.
+         */
+        std::map<std::vector<int>, std::list<Entry> > d_buckets;
+        
+        /*
+         * Counter of patch operations, used as the clock of the least-recently-used release.
+         */
+        unsigned long d_epoch;
+        
+        /*
+         * Statistics of the arena.
+         */
+        unsigned long d_num_hits;
+        unsigned long d_num_misses;
+        unsigned long d_num_releases;
+        size_t d_num_bytes_held;
+        size_t d_num_bytes_in_use;
+        size_t d_num_bytes_in_use_peak_epoch;
+        size_t d_num_bytes_in_use_peak;
+        size_t d_num_bytes_held_peak;
+        
+        /*
+         * All live arenas, used for printing the statistics.
+         */
+        static std::vector<const ScratchPatchDataArena*> s_arenas;
+        
+        /*
+         * Statistics of the hits, misses, releases and peak bytes held recorded in the SAMRAI
+         * statistician for each object name.
+         */
+        static std::map<std::string, std::vector<HAMERS_SHARED_PTR<tbox::Statistic> > >
+            s_statistics;
+        
+};
+
+#endif /* SCRATCH_PATCH_DATA_ARENA_HPP */
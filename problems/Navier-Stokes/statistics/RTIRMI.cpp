@@ -329,6 +329,9 @@ RTIRMIStatisticsUtilities::outputMixingWidthInXDirection(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -415,6 +418,9 @@ RTIRMIStatisticsUtilities::outputMixednessInXDirection(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<double> Y_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -2079,6 +2085,9 @@ RTIRMIStatisticsUtilities::outputEnstrophyIntegrated(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -2528,6 +2537,9 @@ RTIRMIStatisticsUtilities::outputScalarDissipationRateIntegrated(
         flow_model_tmp,
         true);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -3029,6 +3041,9 @@ RTIRMIStatisticsUtilities::outputInterfaceMinInXDirection(
         d_grid_geometry,
         patch_hierarchy,
         flow_model_tmp);
+    
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
 
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
 
@@ -3123,6 +3138,9 @@ RTIRMIStatisticsUtilities::outputInterfaceMaxInXDirection(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
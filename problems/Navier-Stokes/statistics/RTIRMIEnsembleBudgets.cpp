@@ -13,7 +13,10 @@ class EnsembleBudgetsRTIRMI: public EnsembleStatistics
     public:
         EnsembleBudgetsRTIRMI(const std::string& object_name):
             EnsembleStatistics(
-                object_name)
+                object_name),
+            dx_coarsest(double(0)),
+            dx_finest(double(0)),
+            ratio_finest_level_to_coarsest_level(1)
         {
             setVariablesNotComputed();
         }
@@ -129,6 +132,8 @@ class EnsembleBudgetsRTIRMI: public EnsembleStatistics
         
         void clearAllData()
         {
+            finishAveragedQuantitiesInProgress();
+            
             grid_level_num_avg_realizations.clear();
             
             rho_avg_coarsest_realizations.clear();
@@ -238,6 +243,27 @@ class EnsembleBudgetsRTIRMI: public EnsembleStatistics
             setVariablesNotComputed();
         }
         
+        /*
+         * Finish the reduction of the averaged quantities still in progress and append them to their
+         * realizations.
+         */
+        void finishAveragedQuantitiesInProgress()
+        {
+            if (MPI_helper_average_in_progress)
+            {
+                const std::vector<std::vector<double> > averaged_quantities =
+                    MPI_helper_average_in_progress->finishAveragedQuantitiesWithInhomogeneousXDirection();
+                
+                for (int pi = 0; pi < static_cast<int>(realizations_in_progress.size()); pi++)
+                {
+                    realizations_in_progress[pi]->push_back(averaged_quantities[pi]);
+                }
+                
+                MPI_helper_average_in_progress.reset();
+                realizations_in_progress.clear();
+            }
+        }
+        
         // Scratch arrays.
         // Number of realizalizations; number of cells.
         
@@ -455,6 +481,22 @@ class EnsembleBudgetsRTIRMI: public EnsembleStatistics
         bool rho_inv_ddy_tau12_avg_computed;
         bool rho_inv_ddz_tau13_avg_computed;
         
+        /*
+         * MPI helper with the reduction of the queued averaged quantities of the last realization still in
+         * progress and the realizations to append the averaged quantities to.
+         */
+        HAMERS_SHARED_PTR<FlowModelMPIHelperAverage> MPI_helper_average_in_progress;
+        std::vector<std::vector<std::vector<double> >*> realizations_in_progress;
+        
+        /*
+         * Grid spacings in the x-direction of the coarsest level and of the finest refined domain and the
+         * refinement ratio in the x-direction from the finest level to the coarsest level of the patch hierarchy
+         * that the last realization is computed on.
+         */
+        double dx_coarsest;
+        double dx_finest;
+        int ratio_finest_level_to_coarsest_level;
+        
     private:
         
 };
@@ -591,7 +633,6 @@ class RTIRMIBudgetsUtilities
         void
         outputBudgetFavreMeanTKEWithInhomogeneousXDirection(
             const std::string& stat_dump_filename,
-            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const double output_time) const;
         
         /*
@@ -600,7 +641,6 @@ class RTIRMIBudgetsUtilities
         void
         outputBudgetTurbMassFluxXWithInhomogeneousXDirection(
             const std::string& stat_dump_filename,
-            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const double output_time) const;
         
         /*
@@ -609,7 +649,6 @@ class RTIRMIBudgetsUtilities
         void
         outputBudgetReynoldsNormalStressInXDirectionWithInhomogeneousXDirection(
             const std::string& stat_dump_filename,
-            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const double output_time) const;
         
         /*
@@ -618,7 +657,6 @@ class RTIRMIBudgetsUtilities
         void
         outputBudgetReynoldsNormalStressInYDirectionWithInhomogeneousXDirection(
             const std::string& stat_dump_filename,
-            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const double output_time) const;
         
         /*
@@ -627,7 +665,6 @@ class RTIRMIBudgetsUtilities
         void
         outputBudgetReynoldsNormalStressInZDirectionWithInhomogeneousXDirection(
             const std::string& stat_dump_filename,
-            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const double output_time) const;
         
         /*
@@ -708,6 +745,36 @@ class RTIRMIBudgetsUtilities
             const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const HAMERS_SHARED_PTR<hier::VariableContext>& data_context) const;
         
+        /*
+         * Queue an averaged value (on product of variables) with only x direction as inhomogeneous direction.
+         * The queued products are computed together by startQueuedAveragedQuantitiesWithInhomogeneousXDirection()
+         * and appended to the realizations once their reduction is finished.
+         */
+        void
+        queueAveragedQuantityWithInhomogeneousXDirection(
+            const std::vector<std::string>& quantity_names,
+            const std::vector<int>& component_indices,
+            const std::vector<bool>& use_reciprocal,
+            std::vector<std::vector<double> >& realizations);
+        
+        /*
+         * Compute all the queued averaged values with a single traversal of the patch hierarchy. The reduction of
+         * the averaged values is left in progress in the ensemble statistics and is only finished by
+         * EnsembleBudgetsRTIRMI::finishAveragedQuantitiesInProgress() before the output.
+         */
+        void
+        startQueuedAveragedQuantitiesWithInhomogeneousXDirection(
+            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
+            const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
+        
+        /*
+         * Store the grid spacings and the refinement ratio of the patch hierarchy needed for the output of the
+         * budgets in the ensemble statistics.
+         */
+        void
+        storeGridSpacingsAndRefinementRatio(
+            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy);
+        
         /*
          * Get gravity vector from the flow model database.
          */
@@ -793,6 +860,14 @@ class RTIRMIBudgetsUtilities
          */
         const int d_num_ghosts_derivative;
         
+        /*
+         * Averaged values queued to be computed together and the realizations to append them to.
+         */
+        std::vector<std::vector<std::string> > d_queued_quantity_names;
+        std::vector<std::vector<int> > d_queued_component_indices;
+        std::vector<std::vector<bool> > d_queued_use_reciprocal;
+        std::vector<std::vector<std::vector<double> >*> d_queued_realizations;
+        
 };
 
 
@@ -837,6 +912,9 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     // Scratch data containers to pass to MPI helper.
     
     std::vector<std::string> quantity_names;
@@ -1096,85 +1174,71 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     
     // Compute Y_0_avg.
     
-    std::vector<double> Y_0_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MASS_FRACTIONS",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& Y_0_avg_realizations = d_ensemble_statistics->Y_0_avg_realizations;
-    Y_0_avg_realizations.push_back(Y_0_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MASS_FRACTIONS"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->Y_0_avg_realizations);
     
     d_ensemble_statistics->Y_0_avg_computed = true;
     
     // Compute X_0_avg.
     
-    std::vector<double> X_0_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MOLE_FRACTIONS",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& X_0_avg_realizations = d_ensemble_statistics->X_0_avg_realizations;
-    X_0_avg_realizations.push_back(X_0_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MOLE_FRACTIONS"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->X_0_avg_realizations);
     
     d_ensemble_statistics->X_0_avg_computed = true;
     
     // Compute Z_0_avg.
     
-    std::vector<double> Z_0_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "VOLUME_FRACTIONS",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& Z_0_avg_realizations = d_ensemble_statistics->Z_0_avg_realizations;
-    Z_0_avg_realizations.push_back(Z_0_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "VOLUME_FRACTIONS"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->Z_0_avg_realizations);
     
     d_ensemble_statistics->Z_0_avg_computed = true;
     
     // Compute rho_avg.
     
-    std::vector<double> rho_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "DENSITY",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& rho_avg_realizations = d_ensemble_statistics->rho_avg_realizations;
-    rho_avg_realizations.push_back(rho_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "DENSITY"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->rho_avg_realizations);
     
     d_ensemble_statistics->rho_avg_computed = true;
     
     // Compute rho_inv_avg.
     
-    std::vector<double> rho_inv_avg = MPI_helper_average.getAveragedReciprocalOfQuantityWithInhomogeneousXDirection(
-        "DENSITY",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& rho_inv_avg_realizations = d_ensemble_statistics->rho_inv_avg_realizations;
-    rho_inv_avg_realizations.push_back(rho_inv_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "DENSITY"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, true),
+        d_ensemble_statistics->rho_inv_avg_realizations);
     
     d_ensemble_statistics->rho_inv_avg_computed = true;
     
     // Compute p_avg.
     
-    std::vector<double> p_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "PRESSURE",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& p_avg_realizations = d_ensemble_statistics->p_avg_realizations;
-    p_avg_realizations.push_back(p_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "PRESSURE"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->p_avg_realizations);
     
     d_ensemble_statistics->p_avg_computed = true;
     
     // Compute u_avg.
     
-    std::vector<double> u_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "VELOCITY",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& u_avg_realizations = d_ensemble_statistics->u_avg_realizations;
-    u_avg_realizations.push_back(u_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "VELOCITY"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->u_avg_realizations);
     
     d_ensemble_statistics->u_avg_computed = true;
     
@@ -1182,13 +1246,11 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     
     if (d_dim == tbox::Dimension(2) || d_dim == tbox::Dimension(3))
     {
-        std::vector<double> v_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-            "VELOCITY",
-            1,
-            data_context);
-        
-        std::vector<std::vector<double> >& v_avg_realizations = d_ensemble_statistics->v_avg_realizations;
-        v_avg_realizations.push_back(v_avg);
+        queueAveragedQuantityWithInhomogeneousXDirection(
+            std::vector<std::string>(1, "VELOCITY"),
+            std::vector<int>(1, 1),
+            std::vector<bool>(1, false),
+            d_ensemble_statistics->v_avg_realizations);
         
         d_ensemble_statistics->v_avg_computed = true;
     }
@@ -1197,13 +1259,11 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     
     if (d_dim == tbox::Dimension(3))
     {
-        std::vector<double> w_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-            "VELOCITY",
-            2,
-            data_context);
-        
-        std::vector<std::vector<double> >& w_avg_realizations = d_ensemble_statistics->w_avg_realizations;
-        w_avg_realizations.push_back(w_avg);
+        queueAveragedQuantityWithInhomogeneousXDirection(
+            std::vector<std::string>(1, "VELOCITY"),
+            std::vector<int>(1, 2),
+            std::vector<bool>(1, false),
+            d_ensemble_statistics->w_avg_realizations);
         
         d_ensemble_statistics->w_avg_computed = true;
     }
@@ -1216,28 +1276,24 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(0);
     
-    std::vector<double> u_sq_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->u_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& u_sq_avg_realizations = d_ensemble_statistics->u_sq_avg_realizations;
-    u_sq_avg_realizations.push_back(u_sq_avg);
-    
     d_ensemble_statistics->u_sq_avg_computed = true;
     
     // Compute rho_u_avg.
     
-    std::vector<double> rho_u_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MOMENTUM",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& rho_u_avg_realizations = d_ensemble_statistics->rho_u_avg_realizations;
-    rho_u_avg_realizations.push_back(rho_u_avg);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MOMENTUM"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->rho_u_avg_realizations);
     
     d_ensemble_statistics->rho_u_avg_computed = true;
     
@@ -1245,13 +1301,11 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     
     if (d_dim == tbox::Dimension(2) || d_dim == tbox::Dimension(3))
     {
-        std::vector<double> rho_v_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-            "MOMENTUM",
-            1,
-            data_context);
-        
-        std::vector<std::vector<double> >& rho_v_avg_realizations = d_ensemble_statistics->rho_v_avg_realizations;
-        rho_v_avg_realizations.push_back(rho_v_avg);
+        queueAveragedQuantityWithInhomogeneousXDirection(
+            std::vector<std::string>(1, "MOMENTUM"),
+            std::vector<int>(1, 1),
+            std::vector<bool>(1, false),
+            d_ensemble_statistics->rho_v_avg_realizations);
         
         d_ensemble_statistics->rho_v_avg_computed = true;
     }
@@ -1260,13 +1314,11 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     
     if (d_dim == tbox::Dimension(3))
     {
-        std::vector<double> rho_w_avg = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-            "MOMENTUM",
-            2,
-            data_context);
-        
-        std::vector<std::vector<double> >& rho_w_avg_realizations = d_ensemble_statistics->rho_w_avg_realizations;
-        rho_w_avg_realizations.push_back(rho_w_avg);
+        queueAveragedQuantityWithInhomogeneousXDirection(
+            std::vector<std::string>(1, "MOMENTUM"),
+            std::vector<int>(1, 2),
+            std::vector<bool>(1, false),
+            d_ensemble_statistics->rho_w_avg_realizations);
         
         d_ensemble_statistics->rho_w_avg_computed = true;
     }
@@ -1282,17 +1334,15 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(0);
     
-    std::vector<double> rho_u_u_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->rho_u_u_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& rho_u_u_avg_realizations = d_ensemble_statistics->rho_u_u_avg_realizations;
-    rho_u_u_avg_realizations.push_back(rho_u_u_avg_global);
-    
     d_ensemble_statistics->rho_u_u_avg_computed = true;
     
     // Compute rho_v_v_avg.
@@ -1308,17 +1358,15 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
         quantity_names.push_back("VELOCITY");
         component_indices.push_back(1);
         
-        std::vector<double> rho_v_v_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+        queueAveragedQuantityWithInhomogeneousXDirection(
             quantity_names,
             component_indices,
-            data_context);
+            std::vector<bool>(quantity_names.size(), false),
+            d_ensemble_statistics->rho_v_v_avg_realizations);
         
         quantity_names.clear();
         component_indices.clear();
         
-        std::vector<std::vector<double> >& rho_v_v_avg_realizations = d_ensemble_statistics->rho_v_v_avg_realizations;
-        rho_v_v_avg_realizations.push_back(rho_v_v_avg_global);
-        
         d_ensemble_statistics->rho_v_v_avg_computed = true;
     }
     
@@ -1335,17 +1383,15 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
         quantity_names.push_back("VELOCITY");
         component_indices.push_back(2);
         
-        std::vector<double> rho_w_w_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+        queueAveragedQuantityWithInhomogeneousXDirection(
             quantity_names,
             component_indices,
-            data_context);
+            std::vector<bool>(quantity_names.size(), false),
+            d_ensemble_statistics->rho_w_w_avg_realizations);
         
         quantity_names.clear();
         component_indices.clear();
         
-        std::vector<std::vector<double> >& rho_w_w_avg_realizations = d_ensemble_statistics->rho_w_w_avg_realizations;
-        rho_w_w_avg_realizations.push_back(rho_w_w_avg_global);
-        
         d_ensemble_statistics->rho_w_w_avg_computed = true;
     }
     
@@ -1362,17 +1408,15 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
         quantity_names.push_back("VELOCITY");
         component_indices.push_back(1);
         
-        std::vector<double> rho_u_v_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+        queueAveragedQuantityWithInhomogeneousXDirection(
             quantity_names,
             component_indices,
-            data_context);
+            std::vector<bool>(quantity_names.size(), false),
+            d_ensemble_statistics->rho_u_v_avg_realizations);
         
         quantity_names.clear();
         component_indices.clear();
         
-        std::vector<std::vector<double> >& rho_u_v_avg_realizations = d_ensemble_statistics->rho_u_v_avg_realizations;
-        rho_u_v_avg_realizations.push_back(rho_u_v_avg_global);
-        
         d_ensemble_statistics->rho_u_v_avg_computed = true;
     }
     
@@ -1389,17 +1433,15 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
         quantity_names.push_back("VELOCITY");
         component_indices.push_back(2);
         
-        std::vector<double> rho_u_w_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+        queueAveragedQuantityWithInhomogeneousXDirection(
             quantity_names,
             component_indices,
-            data_context);
+            std::vector<bool>(quantity_names.size(), false),
+            d_ensemble_statistics->rho_u_w_avg_realizations);
         
         quantity_names.clear();
         component_indices.clear();
         
-        std::vector<std::vector<double> >& rho_u_w_avg_realizations = d_ensemble_statistics->rho_u_w_avg_realizations;
-        rho_u_w_avg_realizations.push_back(rho_u_w_avg_global);
-        
         d_ensemble_statistics->rho_u_w_avg_computed = true;
     }
     
@@ -1411,17 +1453,15 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
     quantity_names.push_back("PRESSURE");
     component_indices.push_back(0);
     
-    std::vector<double> p_u_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->p_u_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& p_u_avg_realizations = d_ensemble_statistics->p_u_avg_realizations;
-    p_u_avg_realizations.push_back(p_u_avg_global);
-    
     d_ensemble_statistics->p_u_avg_computed = true;
     
     // Compute ddx_rho_avg.
@@ -2908,6 +2948,12 @@ RTIRMIBudgetsUtilities::computeAveragedQuantitiesWithHomogeneityInYDirectionOrIn
         
         d_ensemble_statistics->rho_inv_ddz_tau13_avg_computed = true;
     }
+    
+    // Compute the queued averaged quantities together and leave their reduction in progress.
+    
+    startQueuedAveragedQuantitiesWithInhomogeneousXDirection(
+        patch_hierarchy,
+        data_context);
 }
 
 
@@ -3502,7 +3548,6 @@ RTIRMIBudgetsUtilities::outputSpatialProfileEnsembleAveragedPressureGradientXWit
 void
 RTIRMIBudgetsUtilities::outputBudgetFavreMeanTKEWithInhomogeneousXDirection(
     const std::string& stat_dump_filename,
-    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const double output_time) const
 {
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
@@ -3513,14 +3558,7 @@ RTIRMIBudgetsUtilities::outputBudgetFavreMeanTKEWithInhomogeneousXDirection(
     
     std::ofstream f_out;
     
-    MPIHelper MPI_helper = MPIHelper(
-        "MPI_helper",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy);
-    
-    const std::vector<double>& dx_vec = MPI_helper.getFinestRefinedDomainGridSpacing();
-    const double dx = dx_vec[0];
+    const double dx = d_ensemble_statistics->dx_finest;
     
     /*
      * Output the spatial profiles (only done by process 0).
@@ -3914,7 +3952,6 @@ RTIRMIBudgetsUtilities::outputBudgetFavreMeanTKEWithInhomogeneousXDirection(
 void
 RTIRMIBudgetsUtilities::outputBudgetTurbMassFluxXWithInhomogeneousXDirection(
     const std::string& stat_dump_filename,
-    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const double output_time) const
 {
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
@@ -3925,14 +3962,7 @@ RTIRMIBudgetsUtilities::outputBudgetTurbMassFluxXWithInhomogeneousXDirection(
     
     std::ofstream f_out;
     
-    MPIHelper MPI_helper = MPIHelper(
-        "MPI_helper",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy);
-    
-    const std::vector<double>& dx_vec = MPI_helper.getFinestRefinedDomainGridSpacing();
-    const double dx = dx_vec[0];
+    const double dx = d_ensemble_statistics->dx_finest;
     
     /*
      * Output the spatial profiles (only done by process 0).
@@ -4391,7 +4421,6 @@ RTIRMIBudgetsUtilities::outputBudgetTurbMassFluxXWithInhomogeneousXDirection(
 void
 RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInXDirectionWithInhomogeneousXDirection(
     const std::string& stat_dump_filename,
-    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const double output_time) const
 {
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
@@ -4402,30 +4431,15 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInXDirectionWithInhomoge
     
     std::ofstream f_out;
     
-    MPIHelper MPI_helper = MPIHelper(
-        "MPI_helper",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy);
-    
-    const std::vector<double>& dx_vec_coarsest = MPI_helper.getCoarsestDomainGridSpacing();
-    const double dx_coarsest = dx_vec_coarsest[0];
+    const double dx_coarsest = d_ensemble_statistics->dx_coarsest;
     
-    const std::vector<double>& dx_vec = MPI_helper.getFinestRefinedDomainGridSpacing();
-    const double dx = dx_vec[0];
+    const double dx = d_ensemble_statistics->dx_finest;
     
     /*
      * Get the refinement ratio from the finest level to the coarsest level.
      */
     
-    const int num_levels = patch_hierarchy->getNumberOfLevels();
-    
-    hier::IntVector ratio_finest_level_to_coarsest_level =
-        patch_hierarchy->getRatioToCoarserLevel(num_levels - 1);
-    for (int li = num_levels - 2; li > 0 ; li--)
-    {
-        ratio_finest_level_to_coarsest_level *= patch_hierarchy->getRatioToCoarserLevel(li);
-    }
+    const int ratio_finest_level_to_coarsest_level = d_ensemble_statistics->ratio_finest_level_to_coarsest_level;
     
     /*
      * Output the spatial profiles (only done by process 0).
@@ -4715,7 +4729,7 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInXDirectionWithInhomoge
         
         std::vector<double> two_a1_ddx_p_coarsest_refined = interpolateVectorToFinestLevel1D(
             two_a1_ddx_p_coarsest,
-            ratio_finest_level_to_coarsest_level[0]);
+            ratio_finest_level_to_coarsest_level);
         
         /*
          * Compute term III(2).
@@ -4784,7 +4798,7 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInXDirectionWithInhomoge
         
         std::vector<double> m_2ddx_u_p_p_p_coarsest_refined = interpolateVectorToFinestLevel1D(
             m_2ddx_u_p_p_p_coarsest,
-            ratio_finest_level_to_coarsest_level[0]);
+            ratio_finest_level_to_coarsest_level);
         
         /*
          * Compute term IV(3).
@@ -4823,7 +4837,7 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInXDirectionWithInhomoge
         
         std::vector<double> two_p_p_ddx_u_p_coarsest_refined = interpolateVectorToFinestLevel1D(
             two_p_p_ddx_u_p_coarsest,
-            ratio_finest_level_to_coarsest_level[0]);
+            ratio_finest_level_to_coarsest_level);
         
         /*
          * Compute term VI.
@@ -4937,7 +4951,6 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInXDirectionWithInhomoge
 void
 RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInYDirectionWithInhomogeneousXDirection(
     const std::string& stat_dump_filename,
-    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const double output_time) const
 {
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
@@ -4956,27 +4969,13 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInYDirectionWithInhomoge
     
     std::ofstream f_out;
     
-    MPIHelper MPI_helper = MPIHelper(
-        "MPI_helper",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy);
-    
-    const std::vector<double>& dx_vec = MPI_helper.getFinestRefinedDomainGridSpacing();
-    const double dx = dx_vec[0];
+    const double dx = d_ensemble_statistics->dx_finest;
     
     /*
      * Get the refinement ratio from the finest level to the coarsest level.
      */
     
-    const int num_levels = patch_hierarchy->getNumberOfLevels();
-    
-    hier::IntVector ratio_finest_level_to_coarsest_level =
-        patch_hierarchy->getRatioToCoarserLevel(num_levels - 1);
-    for (int li = num_levels - 2; li > 0 ; li--)
-    {
-        ratio_finest_level_to_coarsest_level *= patch_hierarchy->getRatioToCoarserLevel(li);
-    }
+    const int ratio_finest_level_to_coarsest_level = d_ensemble_statistics->ratio_finest_level_to_coarsest_level;
     
     /*
      * Output the spatial profiles (only done by process 0).
@@ -5269,7 +5268,7 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInYDirectionWithInhomoge
         
         std::vector<double> two_p_p_ddy_v_p_coarsest_refined = interpolateVectorToFinestLevel1D(
             two_p_p_ddy_v_p_coarsest,
-            ratio_finest_level_to_coarsest_level[0]);
+            ratio_finest_level_to_coarsest_level);
         
         /*
          * Compute term VI.
@@ -5358,7 +5357,6 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInYDirectionWithInhomoge
 void
 RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInZDirectionWithInhomogeneousXDirection(
     const std::string& stat_dump_filename,
-    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const double output_time) const
 {
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
@@ -5377,27 +5375,13 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInZDirectionWithInhomoge
     
     std::ofstream f_out;
     
-    MPIHelper MPI_helper = MPIHelper(
-        "MPI_helper",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy);
-    
-    const std::vector<double>& dx_vec = MPI_helper.getFinestRefinedDomainGridSpacing();
-    const double dx = dx_vec[0];
+    const double dx = d_ensemble_statistics->dx_finest;
     
     /*
      * Get the refinement ratio from the finest level to the coarsest level.
      */
     
-    const int num_levels = patch_hierarchy->getNumberOfLevels();
-    
-    hier::IntVector ratio_finest_level_to_coarsest_level =
-        patch_hierarchy->getRatioToCoarserLevel(num_levels - 1);
-    for (int li = num_levels - 2; li > 0 ; li--)
-    {
-        ratio_finest_level_to_coarsest_level *= patch_hierarchy->getRatioToCoarserLevel(li);
-    }
+    const int ratio_finest_level_to_coarsest_level = d_ensemble_statistics->ratio_finest_level_to_coarsest_level;
     
     /*
      * Output the spatial profiles (only done by process 0).
@@ -5677,7 +5661,7 @@ RTIRMIBudgetsUtilities::outputBudgetReynoldsNormalStressInZDirectionWithInhomoge
         
         std::vector<double> two_p_p_ddz_w_p_coarsest_refined = interpolateVectorToFinestLevel1D(
             two_p_p_ddz_w_p_coarsest,
-            ratio_finest_level_to_coarsest_level[0]);
+            ratio_finest_level_to_coarsest_level);
         
         /*
          * Compute term VI.
@@ -6060,15 +6044,17 @@ RTIRMIBudgetsUtilities::getAveragedShearStressComponentWithInhomogeneousXDirecti
         }
         
         /*
-         * Reduction to get the global average of shear stress component.
+         * Reduction to get the global average of shear stress component. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             tau_ij_avg_local,
             tau_ij_avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(tau_ij_avg_local);
     }
@@ -6446,15 +6432,17 @@ RTIRMIBudgetsUtilities::getAveragedShearStressComponentWithInhomogeneousXDirecti
         }
         
         /*
-         * Reduction to get the global average of shear stress component.
+         * Reduction to get the global average of shear stress component. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             tau_ij_avg_local,
             tau_ij_avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(tau_ij_avg_local);
     }
@@ -7360,15 +7348,17 @@ RTIRMIBudgetsUtilities::getAveragedShearStressComponentWithInhomogeneousXDirecti
         }
         
         /*
-         * Reduction to get the global average of shear stress component.
+         * Reduction to get the global average of shear stress component. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             tau_ij_avg_local,
             tau_ij_avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(tau_ij_avg_local);
     }
@@ -7712,15 +7702,17 @@ RTIRMIBudgetsUtilities::getAveragedDerivativeOfShearStressComponentWithInhomogen
         }
         
         /*
-         * Reduction to get the global average of derivative of shear stress component.
+         * Reduction to get the global average of derivative of shear stress component. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             tau_ij_der_avg_local,
             tau_ij_der_avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(tau_ij_der_avg_local);
     }
@@ -8389,15 +8381,17 @@ RTIRMIBudgetsUtilities::getAveragedDerivativeOfShearStressComponentWithInhomogen
         }
         
         /*
-         * Reduction to get the global average of derivative of shear stress component.
+         * Reduction to get the global average of derivative of shear stress component. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             tau_ij_der_avg_local,
             tau_ij_der_avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(tau_ij_der_avg_local);
     }
@@ -10005,15 +9999,17 @@ RTIRMIBudgetsUtilities::getAveragedDerivativeOfShearStressComponentWithInhomogen
         }
         
         /*
-         * Reduction to get the global average of derivative of shear stress component.
+         * Reduction to get the global average of derivative of shear stress component. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             tau_ij_der_avg_local,
             tau_ij_der_avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(tau_ij_der_avg_local);
     }
@@ -10522,15 +10518,17 @@ RTIRMIBudgetsUtilities::getAveragedQuantityWithShearStressComponentWithInhomogen
         }
         
         /*
-         * Reduction to get the global average.
+         * Reduction to get the global average. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             avg_local,
             avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(avg_local);
     }
@@ -11056,15 +11054,17 @@ RTIRMIBudgetsUtilities::getAveragedQuantityWithShearStressComponentWithInhomogen
         }
         
         /*
-         * Reduction to get the global average.
+         * Reduction to get the global average. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             avg_local,
             avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(avg_local);
     }
@@ -12149,15 +12149,17 @@ RTIRMIBudgetsUtilities::getAveragedQuantityWithShearStressComponentWithInhomogen
         }
         
         /*
-         * Reduction to get the global average.
+         * Reduction to get the global average. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             avg_local,
             avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(avg_local);
     }
@@ -12689,15 +12691,17 @@ RTIRMIBudgetsUtilities::getAveragedQuantityWithDerivativeOfShearStressComponentW
         }
         
         /*
-         * Reduction to get the global average.
+         * Reduction to get the global average. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             avg_local,
             avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(avg_local);
     }
@@ -13509,15 +13513,17 @@ RTIRMIBudgetsUtilities::getAveragedQuantityWithDerivativeOfShearStressComponentW
         }
         
         /*
-         * Reduction to get the global average.
+         * Reduction to get the global average. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             avg_local,
             avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(avg_local);
     }
@@ -15292,15 +15298,17 @@ RTIRMIBudgetsUtilities::getAveragedQuantityWithDerivativeOfShearStressComponentW
         }
         
         /*
-         * Reduction to get the global average.
+         * Reduction to get the global average. The realizations are only used for the
+         * output on the root process, so the average is only reduced to the root process.
          */
         
-        mpi.Allreduce(
+        mpi.Reduce(
             avg_local,
             avg_global,
             finest_level_dim_0,
             MPI_DOUBLE,
-            MPI_SUM);
+            MPI_SUM,
+            0);
         
         std::free(avg_local);
     }
@@ -15309,6 +15317,108 @@ RTIRMIBudgetsUtilities::getAveragedQuantityWithDerivativeOfShearStressComponentW
 }
 
 
+/*
+ * Queue an averaged value (on product of variables) with only x direction as inhomogeneous direction.
+ */
+void
+RTIRMIBudgetsUtilities::queueAveragedQuantityWithInhomogeneousXDirection(
+    const std::vector<std::string>& quantity_names,
+    const std::vector<int>& component_indices,
+    const std::vector<bool>& use_reciprocal,
+    std::vector<std::vector<double> >& realizations)
+{
+    d_queued_quantity_names.push_back(quantity_names);
+    d_queued_component_indices.push_back(component_indices);
+    d_queued_use_reciprocal.push_back(use_reciprocal);
+    d_queued_realizations.push_back(&realizations);
+}
+
+
+/*
+ * Compute all the queued averaged values with a single traversal of the patch hierarchy. The reduction of the
+ * averaged values is left in progress in the ensemble statistics.
+ */
+void
+RTIRMIBudgetsUtilities::startQueuedAveragedQuantitiesWithInhomogeneousXDirection(
+    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
+    const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
+{
+    if (d_queued_realizations.empty())
+    {
+        return;
+    }
+    
+    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    
+    HAMERS_SHARED_PTR<FlowModelMPIHelperAverage> MPI_helper_average(
+        new FlowModelMPIHelperAverage(
+            "MPI_helper_average",
+            d_dim,
+            d_grid_geometry,
+            patch_hierarchy,
+            flow_model_tmp));
+    
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average->setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
+    MPI_helper_average->startAveragedQuantitiesWithInhomogeneousXDirection(
+        d_queued_quantity_names,
+        d_queued_component_indices,
+        d_queued_use_reciprocal,
+        data_context);
+    
+    /*
+     * The averaged values are appended to the realizations by
+     * EnsembleBudgetsRTIRMI::finishAveragedQuantitiesInProgress() such that the reduction can overlap with the
+     * next time step when the output of the statistics is deferred.
+     */
+    
+    d_ensemble_statistics->MPI_helper_average_in_progress = MPI_helper_average;
+    d_ensemble_statistics->realizations_in_progress = d_queued_realizations;
+    
+    d_queued_quantity_names.clear();
+    d_queued_component_indices.clear();
+    d_queued_use_reciprocal.clear();
+    d_queued_realizations.clear();
+}
+
+
+/*
+ * Store the grid spacings and the refinement ratio of the patch hierarchy needed for the output of the budgets
+ * in the ensemble statistics.
+ */
+void
+RTIRMIBudgetsUtilities::storeGridSpacingsAndRefinementRatio(
+    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy)
+{
+    MPIHelper MPI_helper = MPIHelper(
+        "MPI_helper",
+        d_dim,
+        d_grid_geometry,
+        patch_hierarchy);
+    
+    const std::vector<double>& dx_vec_coarsest = MPI_helper.getCoarsestDomainGridSpacing();
+    const std::vector<double>& dx_vec = MPI_helper.getFinestRefinedDomainGridSpacing();
+    
+    /*
+     * Get the refinement ratio from the finest level to the coarsest level.
+     */
+    
+    const int num_levels = patch_hierarchy->getNumberOfLevels();
+    
+    hier::IntVector ratio_finest_level_to_coarsest_level =
+        patch_hierarchy->getRatioToCoarserLevel(num_levels - 1);
+    for (int li = num_levels - 2; li > 0 ; li--)
+    {
+        ratio_finest_level_to_coarsest_level *= patch_hierarchy->getRatioToCoarserLevel(li);
+    }
+    
+    d_ensemble_statistics->dx_coarsest = dx_vec_coarsest[0];
+    d_ensemble_statistics->dx_finest = dx_vec[0];
+    d_ensemble_statistics->ratio_finest_level_to_coarsest_level = ratio_finest_level_to_coarsest_level[0];
+}
+
+
 /*
  * Get gravity vector from the flow model database.
  */
@@ -15524,6 +15634,14 @@ FlowModelStatisticsUtilitiesFourEqnConservative::computeStatisticalQuantities(
         d_is_ensemble_statistics_initialized = true;
     }
     
+    /*
+     * The output of the budgets only uses the realizations and the grid spacings stored in the ensemble
+     * statistics, so it can be deferred until after the next time step while the reduction of the queued
+     * averaged quantities is in progress.
+     */
+    
+    d_can_defer_output_of_statistical_quantities = true;
+    
     HAMERS_SHARED_PTR<RTIRMIBudgetsUtilities> rti_rmi_budgets_utilities(
         new RTIRMIBudgetsUtilities(
             "RTI RMI budgets utilities",
@@ -15538,6 +15656,9 @@ FlowModelStatisticsUtilitiesFourEqnConservative::computeStatisticalQuantities(
             d_equation_of_thermal_conductivity_mixing_rules,
             HAMERS_DYNAMIC_POINTER_CAST<EnsembleBudgetsRTIRMI>(d_ensemble_statistics)));
     
+    // Finish the averaged quantities of the previous realization that are still in progress.
+    rti_rmi_budgets_utilities->d_ensemble_statistics->finishAveragedQuantitiesInProgress();
+    
     // Statistics are not computed for this realization yet.
     rti_rmi_budgets_utilities->d_ensemble_statistics->setVariablesNotComputed();
     
@@ -15546,6 +15667,9 @@ FlowModelStatisticsUtilitiesFourEqnConservative::computeStatisticalQuantities(
         computeAveragedGridLevelNumberWithHomogeneityInYDirectionOrInYZPlane(
             patch_hierarchy);
     
+    // Store the grid spacings and the refinement ratio for the output.
+    rti_rmi_budgets_utilities->storeGridSpacingsAndRefinementRatio(patch_hierarchy);
+    
     // Loop over statistical quantities.
     for (int qi = 0; qi < static_cast<int>(d_statistical_quantities.size()); qi++)
     {
@@ -15602,6 +15726,9 @@ FlowModelStatisticsUtilitiesFourEqnConservative::outputStatisticalQuantities(
     TBOX_ASSERT(!stat_dump_filename.empty());
 #endif
     
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
+    
     HAMERS_SHARED_PTR<RTIRMIBudgetsUtilities> rti_rmi_budgets_utilities(
         new RTIRMIBudgetsUtilities(
             "RTI RMI budgets utilities",
@@ -15616,6 +15743,9 @@ FlowModelStatisticsUtilitiesFourEqnConservative::outputStatisticalQuantities(
             d_equation_of_thermal_conductivity_mixing_rules,
             HAMERS_DYNAMIC_POINTER_CAST<EnsembleBudgetsRTIRMI>(d_ensemble_statistics)));
     
+    // Finish the averaged quantities that are still in progress.
+    rti_rmi_budgets_utilities->d_ensemble_statistics->finishAveragedQuantitiesInProgress();
+    
     // Output the averaged grid level number no matter what.
     rti_rmi_budgets_utilities->outputSpatialProfileEnsembleAveragedGridLevelNumberWithHomogeneityInYDirectionOrInYZPlane(
         "grid_level_num_avg.dat",
@@ -15689,7 +15819,6 @@ FlowModelStatisticsUtilitiesFourEqnConservative::outputStatisticalQuantities(
             rti_rmi_budgets_utilities->
                 outputBudgetTurbMassFluxXWithInhomogeneousXDirection(
                     "rho_a1_budget.dat",
-                    patch_hierarchy,
                     output_time);
         }
         else if (statistical_quantity_key == "rho_K_budget_SP")
@@ -15697,7 +15826,6 @@ FlowModelStatisticsUtilitiesFourEqnConservative::outputStatisticalQuantities(
             rti_rmi_budgets_utilities->
                 outputBudgetFavreMeanTKEWithInhomogeneousXDirection(
                     "rho_K_budget.dat",
-                    patch_hierarchy,
                     output_time);
         }
         else if (statistical_quantity_key == "rho_R11_budget_SP")
@@ -15705,7 +15833,6 @@ FlowModelStatisticsUtilitiesFourEqnConservative::outputStatisticalQuantities(
             rti_rmi_budgets_utilities->
                 outputBudgetReynoldsNormalStressInXDirectionWithInhomogeneousXDirection(
                     "rho_R11_budget.dat",
-                    patch_hierarchy,
                     output_time);
         }
         else if (statistical_quantity_key == "rho_R22_budget_SP")
@@ -15713,7 +15840,6 @@ FlowModelStatisticsUtilitiesFourEqnConservative::outputStatisticalQuantities(
             rti_rmi_budgets_utilities->
                 outputBudgetReynoldsNormalStressInYDirectionWithInhomogeneousXDirection(
                     "rho_R22_budget.dat",
-                    patch_hierarchy,
                     output_time);
         }
         else if (statistical_quantity_key == "rho_R33_budget_SP")
@@ -15721,7 +15847,6 @@ FlowModelStatisticsUtilitiesFourEqnConservative::outputStatisticalQuantities(
             rti_rmi_budgets_utilities->
                 outputBudgetReynoldsNormalStressInZDirectionWithInhomogeneousXDirection(
                     "rho_R33_budget.dat",
-                    patch_hierarchy,
                     output_time);
         }
         else
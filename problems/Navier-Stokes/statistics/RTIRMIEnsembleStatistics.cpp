@@ -1367,6 +1367,26 @@ class RTIRMIStatisticsUtilities
             const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
             const HAMERS_SHARED_PTR<hier::VariableContext>& data_context) const;
         
+        /*
+         * Queue an averaged value (on product of variables) with only x direction as inhomogeneous direction.
+         * The queued products are computed together and appended to the realizations by
+         * computeQueuedAveragedQuantitiesWithInhomogeneousXDirection().
+         */
+        void
+        queueAveragedQuantityWithInhomogeneousXDirection(
+            const std::vector<std::string>& quantity_names,
+            const std::vector<int>& component_indices,
+            const std::vector<bool>& use_reciprocal,
+            std::vector<std::vector<double> >& realizations);
+        
+        /*
+         * Compute all the queued averaged values with a single traversal of the patch hierarchy.
+         */
+        void
+        computeQueuedAveragedQuantitiesWithInhomogeneousXDirection(
+            const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
+            const HAMERS_SHARED_PTR<hier::VariableContext>& data_context);
+        
         /*
          * Get gravity vector from the flow model database.
          */
@@ -1445,6 +1465,14 @@ class RTIRMIStatisticsUtilities
          */
         const int d_num_ghosts_derivative;
         
+        /*
+         * Averaged values queued to be computed together and the realizations to append them to.
+         */
+        std::vector<std::vector<std::string> > d_queued_quantity_names;
+        std::vector<std::vector<int> > d_queued_component_indices;
+        std::vector<std::vector<bool> > d_queued_use_reciprocal;
+        std::vector<std::vector<std::vector<double> >*> d_queued_realizations;
+        
 };
 
 
@@ -1472,22 +1500,14 @@ RTIRMIStatisticsUtilities::computeAveragedMassFractionWithHomogeneityInYDirectio
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> Y_0_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MASS_FRACTIONS",
-        0,
-        data_context);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    std::vector<std::vector<double> >& Y_0_avg_realizations = d_ensemble_statistics->Y_0_avg_realizations;
-    Y_0_avg_realizations.push_back(Y_0_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MASS_FRACTIONS"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->Y_0_avg_realizations);
     
     d_ensemble_statistics->Y_0_avg_computed = true;
 }
@@ -1517,22 +1537,14 @@ RTIRMIStatisticsUtilities::computeAveragedMoleFractionWithHomogeneityInYDirectio
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> X_0_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MOLE_FRACTIONS",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& X_0_avg_realizations = d_ensemble_statistics->X_0_avg_realizations;
-    X_0_avg_realizations.push_back(X_0_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MOLE_FRACTIONS"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->X_0_avg_realizations);
     
     d_ensemble_statistics->X_0_avg_computed = true;
 }
@@ -1562,22 +1574,14 @@ RTIRMIStatisticsUtilities::computeAveragedVolumeFractionWithHomogeneityInYDirect
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> Z_0_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "VOLUME_FRACTIONS",
-        0,
-        data_context);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    std::vector<std::vector<double> >& Z_0_avg_realizations = d_ensemble_statistics->Z_0_avg_realizations;
-    Z_0_avg_realizations.push_back(Z_0_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "VOLUME_FRACTIONS"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->Z_0_avg_realizations);
     
     d_ensemble_statistics->Z_0_avg_computed = true;
 }
@@ -1607,14 +1611,8 @@ RTIRMIStatisticsUtilities::computeMassFractionVarianceWithHomogeneityInYDirectio
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -1625,17 +1623,15 @@ RTIRMIStatisticsUtilities::computeMassFractionVarianceWithHomogeneityInYDirectio
     quantity_names.push_back("MASS_FRACTIONS");
     component_indices.push_back(0);
     
-    std::vector<double> Y_0_sq_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->Y_0_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& Y_0_sq_avg_realizations = d_ensemble_statistics->Y_0_sq_avg_realizations;
-    Y_0_sq_avg_realizations.push_back(Y_0_sq_avg_global);
-    
     d_ensemble_statistics->Y_0_sq_avg_computed = true;
 }
 
@@ -1664,14 +1660,8 @@ RTIRMIStatisticsUtilities::computeMoleFractionVarianceWithHomogeneityInYDirectio
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -1682,17 +1672,15 @@ RTIRMIStatisticsUtilities::computeMoleFractionVarianceWithHomogeneityInYDirectio
     quantity_names.push_back("MOLE_FRACTIONS");
     component_indices.push_back(0);
     
-    std::vector<double> X_0_sq_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->X_0_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& X_0_sq_avg_realizations = d_ensemble_statistics->X_0_sq_avg_realizations;
-    X_0_sq_avg_realizations.push_back(X_0_sq_avg_global);
-    
     d_ensemble_statistics->X_0_sq_avg_computed = true;
 }
 
@@ -1721,14 +1709,8 @@ RTIRMIStatisticsUtilities::computeVolumeFractionVarianceWithHomogeneityInYDirect
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -1739,17 +1721,15 @@ RTIRMIStatisticsUtilities::computeVolumeFractionVarianceWithHomogeneityInYDirect
     quantity_names.push_back("VOLUME_FRACTIONS");
     component_indices.push_back(0);
     
-    std::vector<double> Z_0_sq_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->Z_0_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& Z_0_sq_avg_realizations = d_ensemble_statistics->Z_0_sq_avg_realizations;
-    Z_0_sq_avg_realizations.push_back(Z_0_sq_avg_global);
-    
     d_ensemble_statistics->Z_0_sq_avg_computed = true;
 }
 
@@ -1778,14 +1758,8 @@ RTIRMIStatisticsUtilities::computeMassFractionProductWithHomogeneityInYDirection
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -1796,17 +1770,15 @@ RTIRMIStatisticsUtilities::computeMassFractionProductWithHomogeneityInYDirection
     quantity_names.push_back("MASS_FRACTIONS");
     component_indices.push_back(1);
     
-    std::vector<double> Y_0_Y_1_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->Y_0_Y_1_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& Y_0_Y_1_avg_realizations = d_ensemble_statistics->Y_0_Y_1_avg_realizations;
-    Y_0_Y_1_avg_realizations.push_back(Y_0_Y_1_avg_global);
-    
     d_ensemble_statistics->Y_0_Y_1_avg_computed = true;
 }
 
@@ -1835,14 +1807,8 @@ RTIRMIStatisticsUtilities::computeMoleFractionProductWithHomogeneityInYDirection
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -1853,17 +1819,15 @@ RTIRMIStatisticsUtilities::computeMoleFractionProductWithHomogeneityInYDirection
     quantity_names.push_back("MOLE_FRACTIONS");
     component_indices.push_back(1);
     
-    std::vector<double> X_0_X_1_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->X_0_X_1_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& X_0_X_1_avg_realizations = d_ensemble_statistics->X_0_X_1_avg_realizations;
-    X_0_X_1_avg_realizations.push_back(X_0_X_1_avg_global);
-    
     d_ensemble_statistics->X_0_X_1_avg_computed = true;
 }
 
@@ -1892,14 +1856,8 @@ RTIRMIStatisticsUtilities::computeVolumeFractionProductWithHomogeneityInYDirecti
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -1910,17 +1868,15 @@ RTIRMIStatisticsUtilities::computeVolumeFractionProductWithHomogeneityInYDirecti
     quantity_names.push_back("VOLUME_FRACTIONS");
     component_indices.push_back(1);
     
-    std::vector<double> Z_0_Z_1_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->Z_0_Z_1_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& Z_0_Z_1_avg_realizations = d_ensemble_statistics->Z_0_Z_1_avg_realizations;
-    Z_0_Z_1_avg_realizations.push_back(Z_0_Z_1_avg_global);
-    
     d_ensemble_statistics->Z_0_Z_1_avg_computed = true;
 }
 
@@ -1933,22 +1889,14 @@ RTIRMIStatisticsUtilities::computeAveragedDensityWithHomogeneityInYDirectionOrIn
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> rho_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "DENSITY",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& rho_avg_realizations = d_ensemble_statistics->rho_avg_realizations;
-    rho_avg_realizations.push_back(rho_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "DENSITY"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->rho_avg_realizations);
     
     d_ensemble_statistics->rho_avg_computed = true;
 }
@@ -1970,14 +1918,8 @@ RTIRMIStatisticsUtilities::computeDensityVarianceWithHomogeneityInYDirectionOrIn
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -1988,17 +1930,15 @@ RTIRMIStatisticsUtilities::computeDensityVarianceWithHomogeneityInYDirectionOrIn
     quantity_names.push_back("DENSITY");
     component_indices.push_back(0);
     
-    std::vector<double> rho_sq_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->rho_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& rho_sq_avg_realizations = d_ensemble_statistics->rho_sq_avg_realizations;
-    rho_sq_avg_realizations.push_back(rho_sq_avg_global);
-    
     d_ensemble_statistics->rho_sq_avg_computed = true;
 }
 
@@ -2011,22 +1951,14 @@ RTIRMIStatisticsUtilities::computeAveragedSpecificVolumeWithHomogeneityInYDirect
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> rho_inv_avg_global = MPI_helper_average.getAveragedReciprocalOfQuantityWithInhomogeneousXDirection(
-        "DENSITY",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& rho_inv_avg_realizations = d_ensemble_statistics->rho_inv_avg_realizations;
-    rho_inv_avg_realizations.push_back(rho_inv_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "DENSITY"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, true),
+        d_ensemble_statistics->rho_inv_avg_realizations);
     
     d_ensemble_statistics->rho_inv_avg_computed = true;
 }
@@ -2040,22 +1972,14 @@ RTIRMIStatisticsUtilities::computeAveragedPressureWithHomogeneityInYDirectionOrI
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> p_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "PRESSURE",
-        0,
-        data_context);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    std::vector<std::vector<double> >& p_avg_realizations = d_ensemble_statistics->p_avg_realizations;
-    p_avg_realizations.push_back(p_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "PRESSURE"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->p_avg_realizations);
     
     d_ensemble_statistics->p_avg_computed = true;
 }
@@ -2069,22 +1993,14 @@ RTIRMIStatisticsUtilities::computeAveragedVelocityXWithHomogeneityInYDirectionOr
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> u_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "VELOCITY",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& u_avg_realizations = d_ensemble_statistics->u_avg_realizations;
-    u_avg_realizations.push_back(u_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "VELOCITY"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->u_avg_realizations);
     
     d_ensemble_statistics->u_avg_computed = true;
 }
@@ -2098,22 +2014,14 @@ RTIRMIStatisticsUtilities::computeAveragedVelocityYWithHomogeneityInYDirectionOr
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    std::vector<double> v_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "VELOCITY",
-        1,
-        data_context);
-    
-    std::vector<std::vector<double> >& v_avg_realizations = d_ensemble_statistics->v_avg_realizations;
-    v_avg_realizations.push_back(v_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "VELOCITY"),
+        std::vector<int>(1, 1),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->v_avg_realizations);
     
     d_ensemble_statistics->v_avg_computed = true;
 }
@@ -2127,22 +2035,14 @@ RTIRMIStatisticsUtilities::computeAveragedVelocityZWithHomogeneityInYZPlane(
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> w_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "VELOCITY",
-        2,
-        data_context);
-    
-    std::vector<std::vector<double> >& w_avg_realizations = d_ensemble_statistics->w_avg_realizations;
-    w_avg_realizations.push_back(w_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "VELOCITY"),
+        std::vector<int>(1, 2),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->w_avg_realizations);
     
     d_ensemble_statistics->w_avg_computed = true;
 }
@@ -2164,14 +2064,8 @@ RTIRMIStatisticsUtilities::computeVelocityXVarianceWithHomogeneityInYDirectionOr
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -2182,17 +2076,15 @@ RTIRMIStatisticsUtilities::computeVelocityXVarianceWithHomogeneityInYDirectionOr
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(0);
     
-    std::vector<double> u_sq_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->u_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& u_sq_avg_realizations = d_ensemble_statistics->u_sq_avg_realizations;
-    u_sq_avg_realizations.push_back(u_sq_avg_global);
-    
     d_ensemble_statistics->u_sq_avg_computed = true;
 }
 
@@ -2213,14 +2105,8 @@ RTIRMIStatisticsUtilities::computeVelocityYVarianceWithHomogeneityInYDirectionOr
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -2231,17 +2117,15 @@ RTIRMIStatisticsUtilities::computeVelocityYVarianceWithHomogeneityInYDirectionOr
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(1);
     
-    std::vector<double> v_sq_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->v_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& v_sq_avg_realizations = d_ensemble_statistics->v_sq_avg_realizations;
-    v_sq_avg_realizations.push_back(v_sq_avg_global);
-    
     d_ensemble_statistics->v_sq_avg_computed = true;
 }
 
@@ -2262,14 +2146,8 @@ RTIRMIStatisticsUtilities::computeVelocityZVarianceWithHomogeneityInYZPlane(
             << std::endl);
     }
     
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -2280,17 +2158,15 @@ RTIRMIStatisticsUtilities::computeVelocityZVarianceWithHomogeneityInYZPlane(
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(2);
     
-    std::vector<double> w_sq_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->w_sq_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& w_sq_avg_realizations = d_ensemble_statistics->w_sq_avg_realizations;
-    w_sq_avg_realizations.push_back(w_sq_avg_global);
-    
     d_ensemble_statistics->w_sq_avg_computed = true;
 }
 
@@ -2303,22 +2179,14 @@ RTIRMIStatisticsUtilities::computeAveragedMomentumXWithHomogeneityInYDirectionOr
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> rho_u_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MOMENTUM",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& rho_u_avg_realizations = d_ensemble_statistics->rho_u_avg_realizations;
-    rho_u_avg_realizations.push_back(rho_u_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MOMENTUM"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->rho_u_avg_realizations);
     
     d_ensemble_statistics->rho_u_avg_computed = true;
 }
@@ -2332,22 +2200,14 @@ RTIRMIStatisticsUtilities::computeAveragedMomentumYWithHomogeneityInYDirectionOr
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> rho_v_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MOMENTUM",
-        1,
-        data_context);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    std::vector<std::vector<double> >& rho_v_avg_realizations = d_ensemble_statistics->rho_v_avg_realizations;
-    rho_v_avg_realizations.push_back(rho_v_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MOMENTUM"),
+        std::vector<int>(1, 1),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->rho_v_avg_realizations);
     
     d_ensemble_statistics->rho_v_avg_computed = true;
 }
@@ -2361,22 +2221,14 @@ RTIRMIStatisticsUtilities::computeAveragedMomentumZWithHomogeneityInYZPlane(
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> rho_w_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "MOMENTUM",
-        2,
-        data_context);
-    
-    std::vector<std::vector<double> >& rho_w_avg_realizations = d_ensemble_statistics->rho_w_avg_realizations;
-    rho_w_avg_realizations.push_back(rho_w_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "MOMENTUM"),
+        std::vector<int>(1, 2),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->rho_w_avg_realizations);
     
     d_ensemble_statistics->rho_w_avg_computed = true;
 }
@@ -2390,14 +2242,8 @@ RTIRMIStatisticsUtilities::computeReynoldsNormalStressXWithHomogeneityInYDirecti
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -2411,17 +2257,15 @@ RTIRMIStatisticsUtilities::computeReynoldsNormalStressXWithHomogeneityInYDirecti
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(0);
     
-    std::vector<double> rho_u_u_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->rho_u_u_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& rho_u_u_avg_realizations = d_ensemble_statistics->rho_u_u_avg_realizations;
-    rho_u_u_avg_realizations.push_back(rho_u_u_avg_global);
-    
     d_ensemble_statistics->rho_u_u_avg_computed = true;
 }
 
@@ -2434,14 +2278,8 @@ RTIRMIStatisticsUtilities::computeReynoldsNormalStressYWithHomogeneityInYDirecti
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -2455,17 +2293,15 @@ RTIRMIStatisticsUtilities::computeReynoldsNormalStressYWithHomogeneityInYDirecti
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(1);
     
-    std::vector<double> rho_v_v_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->rho_v_v_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& rho_v_v_avg_realizations = d_ensemble_statistics->rho_v_v_avg_realizations;
-    rho_v_v_avg_realizations.push_back(rho_v_v_avg_global);
-    
     d_ensemble_statistics->rho_v_v_avg_computed = true;
 }
 
@@ -2478,14 +2314,8 @@ RTIRMIStatisticsUtilities::computeReynoldsNormalStressZWithHomogeneityInYZPlane(
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
-    
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
@@ -2499,17 +2329,15 @@ RTIRMIStatisticsUtilities::computeReynoldsNormalStressZWithHomogeneityInYZPlane(
     quantity_names.push_back("VELOCITY");
     component_indices.push_back(2);
     
-    std::vector<double> rho_w_w_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
+    queueAveragedQuantityWithInhomogeneousXDirection(
         quantity_names,
         component_indices,
-        data_context);
+        std::vector<bool>(quantity_names.size(), false),
+        d_ensemble_statistics->rho_w_w_avg_realizations);
     
     quantity_names.clear();
     component_indices.clear();
     
-    std::vector<std::vector<double> >& rho_w_w_avg_realizations = d_ensemble_statistics->rho_w_w_avg_realizations;
-    rho_w_w_avg_realizations.push_back(rho_w_w_avg_global);
-    
     d_ensemble_statistics->rho_w_w_avg_computed = true;
 }
 
@@ -2522,22 +2350,14 @@ RTIRMIStatisticsUtilities::computeAveragedSoundSpeedWithHomogeneityInYDirectionO
     const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    NULL_USE(patch_hierarchy);
+    NULL_USE(data_context);
     
-    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
-        "MPI_helper_average",
-        d_dim,
-        d_grid_geometry,
-        patch_hierarchy,
-        flow_model_tmp);
-    
-    std::vector<double> c_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
-        "SOUND_SPEED",
-        0,
-        data_context);
-    
-    std::vector<std::vector<double> >& c_avg_realizations = d_ensemble_statistics->c_avg_realizations;
-    c_avg_realizations.push_back(c_avg_global);
+    queueAveragedQuantityWithInhomogeneousXDirection(
+        std::vector<std::string>(1, "SOUND_SPEED"),
+        std::vector<int>(1, 0),
+        std::vector<bool>(1, false),
+        d_ensemble_statistics->c_avg_realizations);
     
     d_ensemble_statistics->c_avg_computed = true;
 }
@@ -2568,6 +2388,9 @@ RTIRMIStatisticsUtilities::computeAveragedEnstrophyWithHomogeneityInYDirectionOr
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<std::vector<double> >& Omega_avg_realizations = d_ensemble_statistics->Omega_avg_realizations;
@@ -2954,6 +2777,9 @@ RTIRMIStatisticsUtilities::computeAveragedScalarDissipationRateWithHomogeneityIn
         flow_model_tmp,
         true);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<std::vector<double> >& chi_avg_realizations = d_ensemble_statistics->chi_avg_realizations;
@@ -3185,6 +3011,9 @@ RTIRMIStatisticsUtilities::computeAveragedShearViscosityWithHomogeneityInYDirect
         flow_model_tmp,
         true);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<std::vector<double> >& mu_avg_realizations = d_ensemble_statistics->mu_avg_realizations;
     
     std::vector<double> shear_viscosity = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -3232,6 +3061,9 @@ RTIRMIStatisticsUtilities::computeAveragedMassDiffusivityWithHomogeneityInYDirec
         flow_model_tmp,
         true);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<std::vector<double> >& D_avg_realizations = d_ensemble_statistics->D_avg_realizations;
     
     std::vector<double> mass_diffusivity = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -3270,6 +3102,9 @@ RTIRMIStatisticsUtilities::computeAveragedXDerivativeOfPressureWithHomogeneityIn
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<std::vector<double> >& ddx_p_avg_realizations = d_ensemble_statistics->ddx_p_avg_realizations;
     
     std::vector<std::string> quantity_names;
@@ -3364,6 +3199,9 @@ RTIRMIStatisticsUtilities::computeAveragedYDerivativeOfPressureWithHomogeneityIn
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<std::vector<double> >& ddy_p_avg_realizations = d_ensemble_statistics->ddy_p_avg_realizations;
     
     std::vector<std::string> quantity_names;
@@ -3428,6 +3266,9 @@ RTIRMIStatisticsUtilities::computeAveragedZDerivativeOfPressureWithHomogeneityIn
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<std::vector<double> >& ddz_p_avg_realizations = d_ensemble_statistics->ddz_p_avg_realizations;
     
     std::vector<std::string> quantity_names;
@@ -3493,6 +3334,9 @@ RTIRMIStatisticsUtilities::computeAveragedSquaredBaroclinicTorqueZWithHomogeneit
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<std::string> quantity_names;
@@ -3736,6 +3580,9 @@ RTIRMIStatisticsUtilities::computeAveragedSquaredBaroclinicTorqueXWithHomogeneit
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<std::string> quantity_names;
@@ -3980,6 +3827,9 @@ RTIRMIStatisticsUtilities::computeAveragedSquaredBaroclinicTorqueYWithHomogeneit
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<std::string> quantity_names;
@@ -4215,6 +4065,9 @@ RTIRMIStatisticsUtilities::computeAveragedQuantiitesForTKEDissipationWithHomogen
         patch_hierarchy,
         flow_model_tmp);
     
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<std::string> quantity_names;
     std::vector<int> component_indices;
     std::vector<bool> use_derivative;
@@ -18198,6 +18051,67 @@ RTIRMIStatisticsUtilities::getAveragedQuantityWithShearStressComponentWithInhomo
 }
 
 
+/*
+ * Queue an averaged value (on product of variables) with only x direction as inhomogeneous direction.
+ */
+void
+RTIRMIStatisticsUtilities::queueAveragedQuantityWithInhomogeneousXDirection(
+    const std::vector<std::string>& quantity_names,
+    const std::vector<int>& component_indices,
+    const std::vector<bool>& use_reciprocal,
+    std::vector<std::vector<double> >& realizations)
+{
+    d_queued_quantity_names.push_back(quantity_names);
+    d_queued_component_indices.push_back(component_indices);
+    d_queued_use_reciprocal.push_back(use_reciprocal);
+    d_queued_realizations.push_back(&realizations);
+}
+
+
+/*
+ * Compute all the queued averaged values with a single traversal of the patch hierarchy.
+ */
+void
+RTIRMIStatisticsUtilities::computeQueuedAveragedQuantitiesWithInhomogeneousXDirection(
+    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& patch_hierarchy,
+    const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
+{
+    if (d_queued_realizations.empty())
+    {
+        return;
+    }
+    
+    HAMERS_SHARED_PTR<FlowModel> flow_model_tmp = d_flow_model.lock();
+    
+    FlowModelMPIHelperAverage MPI_helper_average = FlowModelMPIHelperAverage(
+        "MPI_helper_average",
+        d_dim,
+        d_grid_geometry,
+        patch_hierarchy,
+        flow_model_tmp);
+    
+    // The realizations are only used for the output on the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
+    std::vector<std::vector<double> > averaged_quantities =
+        MPI_helper_average.getAveragedQuantitiesWithInhomogeneousXDirection(
+            d_queued_quantity_names,
+            d_queued_component_indices,
+            d_queued_use_reciprocal,
+            data_context);
+    
+    for (int pi = 0; pi < static_cast<int>(d_queued_realizations.size()); pi++)
+    {
+        d_queued_realizations[pi]->push_back(averaged_quantities[pi]);
+    }
+    
+    d_queued_quantity_names.clear();
+    d_queued_component_indices.clear();
+    d_queued_use_reciprocal.clear();
+    d_queued_realizations.clear();
+}
+
+
 /*
  * Get gravity vector from the flow model database.
  */
@@ -20142,6 +20056,12 @@ FlowModelStatisticsUtilitiesFourEqnConservative::computeStatisticalQuantities(
         }
     }
     
+    // Compute the averaged quantities queued by the statistical quantities together.
+    rti_rmi_statistics_utilities->
+        computeQueuedAveragedQuantitiesWithInhomogeneousXDirection(
+            patch_hierarchy,
+            data_context);
+    
     d_ensemble_statistics->incrementNumberOfEnsembles();
 }
 
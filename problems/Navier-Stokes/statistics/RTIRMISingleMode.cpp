@@ -306,6 +306,9 @@ RTIRMISingleModeStatisticsUtilities::outputMixingWidthInXDirection(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -392,6 +395,9 @@ RTIRMISingleModeStatisticsUtilities::outputMixingWidthInXDirectionWithMoleFracti
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -478,6 +484,9 @@ RTIRMISingleModeStatisticsUtilities::outputMixingWidthInXDirectionWithVolumeFrac
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -564,6 +573,9 @@ RTIRMISingleModeStatisticsUtilities::outputMixednessInXDirection(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<double> Y_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -670,6 +682,9 @@ RTIRMISingleModeStatisticsUtilities::outputMixednessInXDirectionWithMoleFraction
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<double> X_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -776,6 +791,9 @@ RTIRMISingleModeStatisticsUtilities::outputMixednessInXDirectionWithVolumeFracti
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<double> Z_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -874,6 +892,9 @@ RTIRMISingleModeStatisticsUtilities::outputEnstrophyIntegrated(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -1323,6 +1344,9 @@ RTIRMISingleModeStatisticsUtilities::outputScalarDissipationRateIntegrated(
         flow_model_tmp,
         true);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
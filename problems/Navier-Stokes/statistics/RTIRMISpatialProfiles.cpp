@@ -414,6 +414,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedMassFractionWithHomogeneityInYDire
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> Y_0_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "MASS_FRACTIONS",
         0,
@@ -593,6 +596,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedMoleFractionWithHomogeneityInYDire
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> X_0_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "MOLE_FRACTIONS",
         0,
@@ -764,6 +770,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedDensityWithHomogeneityInYDirection
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> rho_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "DENSITY",
         0,
@@ -927,6 +936,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedSpecificVolumeWithHomogeneityInYDi
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> v_avg_global = MPI_helper_average.getAveragedReciprocalOfQuantityWithInhomogeneousXDirection(
         "DENSITY",
         0,
@@ -994,6 +1006,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedPressureWithHomogeneityInYDirectio
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> p_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "PRESSURE",
         0,
@@ -1061,6 +1076,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedTemperatureWithHomogeneityInYDirec
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> T_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "TEMPERATURE",
         0,
@@ -1128,6 +1146,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedVelocityXWithHomogeneityInYDirecti
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> u_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "VELOCITY",
         0,
@@ -1195,6 +1216,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedVelocityYWithHomogeneityInYDirecti
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> v_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "VELOCITY",
         1,
@@ -1269,6 +1293,9 @@ RTIRMISpatialProfilesUtilities::outputAveragedVelocityZWithHomogeneityInYZPlane(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     std::vector<double> w_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
         "VELOCITY",
         2,
@@ -1336,6 +1363,9 @@ RTIRMISpatialProfilesUtilities::outputFavreAveragedVelocityXWithHomogeneityInYDi
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<double> rho_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -1417,6 +1447,9 @@ RTIRMISpatialProfilesUtilities::outputFavreAveragedVelocityYWithHomogeneityInYDi
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<double> rho_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -1505,6 +1538,9 @@ RTIRMISpatialProfilesUtilities::outputFavreAveragedVelocityZWithHomogeneityInYZP
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
     
     std::vector<double> rho_avg_global = MPI_helper_average.getAveragedQuantityWithInhomogeneousXDirection(
@@ -271,6 +271,9 @@ SBIStatisticsUtilities::outputMixingWidthInXDirection(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -1443,6 +1446,9 @@ SBIStatisticsUtilities::outputScalarDissipationRateIntegrated(
         flow_model_tmp,
         true);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
@@ -1750,6 +1756,9 @@ SBIStatisticsUtilities::outputEnstrophyIntegrated(
         patch_hierarchy,
         flow_model_tmp);
     
+    // The averages are only written by the root process.
+    MPI_helper_average.setProfileReductionType(PROFILE_REDUCTION::REDUCE_TO_ROOT);
+    
     const std::vector<double>& dx_finest = MPI_helper_average.getFinestRefinedDomainGridSpacing();
     
     const hier::IntVector& finest_level_dims = MPI_helper_average.getFinestRefinedDomainNumberOfPoints();
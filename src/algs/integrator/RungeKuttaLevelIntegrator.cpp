@@ -38,10 +38,15 @@
 #include "SAMRAI/tbox/Utilities.h"
 #include "SAMRAI/tbox/MathUtilities.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <string>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /*
  **************************************************************************************************
  *
@@ -213,6 +218,7 @@ HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_init_level_fill_data
 HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_init_level_fill_interior;
 HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_advance_bdry_fill_create;
 HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_new_advance_bdry_fill_create;
+HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_intermediate_bdry_fill_create;
 HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_apply_value_detector;
 HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_apply_gradient_detector;
 HAMERS_SHARED_PTR<tbox::Timer> RungeKuttaLevelIntegrator::t_apply_multiresolution_detector;
@@ -267,10 +273,19 @@ RungeKuttaLevelIntegrator::RungeKuttaLevelIntegrator(
     d_cfl_init(tbox::MathUtilities<double>::getSignalingNaN()),
     d_lag_dt_computation(true),
     d_use_ghosts_for_dt(false),
+    d_use_threaded_patch_loop(false),
+    d_defer_output_data_statistics(false),
+    d_is_output_data_statistics_deferred(false),
+    d_deferred_output_data_statistics_time(0.0),
     d_dt(tbox::MathUtilities<double>::getSignalingNaN()),
+    d_use_low_storage_RK(false),
+    d_number_intermediate(0),
     d_flux_is_face(true),
     d_flux_face_registered(false),
     d_flux_side_registered(false),
+    d_num_bdry_sched_intermediate_created(0),
+    d_num_bdry_sched_intermediate_reused(0),
+    d_bdry_sched_intermediate_create_time_saved(0.0),
     d_number_time_data_levels(2),
     d_scratch(hier::VariableDatabase::getDatabase()->getContext("SCRATCH")),
     d_current(hier::VariableDatabase::getDatabase()->getContext("CURRENT")),
@@ -296,11 +311,51 @@ RungeKuttaLevelIntegrator::RungeKuttaLevelIntegrator(
     }
     getFromInput(input_db, from_restart);
     
-    d_intermediate.resize(d_number_steps);
-    d_intermediate_time_dep_data.resize(d_number_steps);
-    d_intermediate_flux_var_data.resize(d_number_steps);
-    d_intermediate_source_var_data.resize(d_number_steps);
-    for (int sn = 0; sn < d_number_steps; sn++)
+    /*
+     * The threaded patch loops are turned off automatically if they cannot be used.
+     */
+    if (d_use_threaded_patch_loop)
+    {
+#ifdef _OPENMP
+        d_patch_strategy->setupConcurrentPatchOperations();
+        
+        if (!d_patch_strategy->supportsConcurrentPatchOperations())
+        {
+            TBOX_WARNING(d_object_name
+                << ": RungeKuttaLevelIntegrator::RungeKuttaLevelIntegrator()\n"
+                << "The patch strategy does not support concurrent patch operations.\n"
+                << "'use_threaded_patch_loop' is turned off."
+                << std::endl);
+            
+            d_use_threaded_patch_loop = false;
+        }
+#else
+        TBOX_WARNING(d_object_name
+            << ": RungeKuttaLevelIntegrator::RungeKuttaLevelIntegrator()\n"
+            << "The code is not compiled with OpenMP.\n"
+            << "'use_threaded_patch_loop' is turned off."
+            << std::endl);
+        
+        d_use_threaded_patch_loop = false;
+#endif
+    }
+    
+    if (d_use_low_storage_RK)
+    {
+        computeLowStorageRungeKuttaWeights();
+        
+        d_number_intermediate = std::min(d_number_steps, 2);
+    }
+    else
+    {
+        d_number_intermediate = d_number_steps;
+    }
+    
+    d_intermediate.resize(d_number_intermediate);
+    d_intermediate_time_dep_data.resize(d_number_intermediate);
+    d_intermediate_flux_var_data.resize(d_number_intermediate);
+    d_intermediate_source_var_data.resize(d_number_intermediate);
+    for (int sn = 0; sn < d_number_intermediate; sn++)
     {
         std::string context_string = "INTERMEDIATE_" + tbox::Utilities::intToString(sn);
         d_intermediate[sn] = hier::VariableDatabase::getDatabase()->getContext(context_string);
@@ -504,11 +559,23 @@ RungeKuttaLevelIntegrator::resetHierarchyConfiguration(
     
     d_bdry_sched_advance.resize(finest_hiera_level + 1);
     d_bdry_sched_advance_new.resize(finest_hiera_level + 1);
+    d_bdry_sched_intermediate.resize(finest_hiera_level + 1);
+    d_bdry_sched_intermediate_create_time.resize(finest_hiera_level + 1);
     
     for (int ln = coarsest_level; ln <= finest_hiera_level; ln++)
     {
         HAMERS_SHARED_PTR<hier::PatchLevel> level(hierarchy->getPatchLevel(ln));
         
+        /*
+         * Invalidate the cached intermediate schedules of the level. They are created again when
+         * the level is advanced.
+         */
+        
+        d_bdry_sched_intermediate[ln].clear();
+        d_bdry_sched_intermediate[ln].resize(d_number_intermediate);
+        d_bdry_sched_intermediate_create_time[ln].clear();
+        d_bdry_sched_intermediate_create_time[ln].resize(d_number_intermediate, 0.0);
+        
         t_advance_bdry_fill_create->start();
         
         d_bdry_sched_advance[ln] =
@@ -1384,8 +1451,9 @@ RungeKuttaLevelIntegrator::getMaxFinerLevelDt(
  *
  * Integrate data on all patches in patch level from current time to new time (new_time) using a
  * single time step. Before the advance can occur, proper ghost cell information is obtained for all
- * patches on the level. Then, local patches are advanced sequentially in the loop over patches. The
- * details of the routine are as follows:
+ * patches on the level. Then, local patches are advanced in the loop over patches, either sequentially
+ * or concurrently by a team of OpenMP threads if d_use_threaded_patch_loop is true. The details of the
+ * routine are as follows:
  *
  *  0) Allocate storage for new time level data. Also, allocate necessary FLUX, flux integral and
  *     SOURCE storage if needed. (i.e., if regrid_advance is false, first_step is true, and coarser
@@ -1488,7 +1556,7 @@ RungeKuttaLevelIntegrator::advanceLevel(
     level->allocatePatchData(d_new_time_dep_data, new_time);
     level->allocatePatchData(d_saved_var_scratch_data, current_time);
     
-    for (int sn = 0; sn < d_number_steps; sn++)
+    for (int sn = 0; sn < d_number_intermediate; sn++)
     {
         level->allocatePatchData(d_intermediate_time_dep_data[sn], current_time);
         level->allocatePatchData(d_intermediate_flux_var_data[sn], current_time);
@@ -1554,6 +1622,18 @@ RungeKuttaLevelIntegrator::advanceLevel(
         fill_schedule = d_bdry_sched_advance[level_number];
     }
     
+    /*
+     * Call user-routine to pre-process state data before the ghost cell data is filled, if needed.
+     */
+    
+    d_patch_strategy->preprocessFillBoundaryDataBeforeAdvance(
+        level,
+        current_time,
+        dt,
+        first_step,
+        last_step,
+        regrid_advance);
+    
     d_patch_strategy->setDataContext(d_scratch);
     
     if (regrid_advance)
@@ -1668,13 +1748,38 @@ RungeKuttaLevelIntegrator::advanceLevel(
         }
     }
     
+    /*
+     * Gather the local patches so that the patch loops can be shared by a team of threads.
+     */
+    
+    std::vector<HAMERS_SHARED_PTR<hier::Patch> > local_patches;
+    local_patches.reserve(static_cast<size_t>(level->getLocalNumberOfPatches()));
+    
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
+    {
+        local_patches.push_back(*ip);
+    }
+    
+    const int num_local_patches = static_cast<int>(local_patches.size());
+    
     const tbox::SAMRAI_MPI& mpi(hierarchy->getMPI());
+    std::vector<HAMERS_SHARED_PTR<hier::VariableContext> > low_storage_intermediate;
+    
     for (int sn = 0; sn < d_number_steps; sn++)
     {
-        d_patch_strategy->setDataContext(d_intermediate[sn]);
+        /*
+         * Get the intermediate data context of current step. The two intermediate data contexts
+         * are used alternately in the low-storage Runge-Kutta scheme.
+         */
+        
+        const int ci = sn % d_number_intermediate;
+        
+        d_patch_strategy->setDataContext(d_intermediate[ci]);
         
         // Copy scratch data to intermediate data corresponding to current step.
-        copyTimeDependentData(level, d_scratch, d_intermediate[sn]);
+        copyTimeDependentData(level, d_scratch, d_intermediate[ci]);
         
         /*
          * Fill the ghost cell data for current intemediate data factory.
@@ -1684,10 +1789,50 @@ RungeKuttaLevelIntegrator::advanceLevel(
         
         if (sn > 0)
         {
-            fill_schedule_intermediate = 
-                d_bdry_fill_intermediate[sn]->createSchedule(
-                    level,
-                    d_patch_strategy);
+            if (level->inHierarchy())
+            {
+                /*
+                 * Reuse the cached schedule of the level if it is available.
+                 */
+                
+                if (d_bdry_sched_intermediate[level_number][ci])
+                {
+                    d_num_bdry_sched_intermediate_reused++;
+                    d_bdry_sched_intermediate_create_time_saved +=
+                        d_bdry_sched_intermediate_create_time[level_number][ci];
+                }
+                else
+                {
+                    t_intermediate_bdry_fill_create->start();
+                    
+                    const double create_start_time = tbox::SAMRAI_MPI::Wtime();
+                    
+                    d_bdry_sched_intermediate[level_number][ci] =
+                        d_bdry_fill_intermediate[ci]->createSchedule(
+                            level,
+                            d_patch_strategy);
+                    
+                    d_bdry_sched_intermediate_create_time[level_number][ci] =
+                        tbox::SAMRAI_MPI::Wtime() - create_start_time;
+                    
+                    d_num_bdry_sched_intermediate_created++;
+                    
+                    t_intermediate_bdry_fill_create->stop();
+                }
+                
+                fill_schedule_intermediate = d_bdry_sched_intermediate[level_number][ci];
+            }
+            else
+            {
+                t_intermediate_bdry_fill_create->start();
+                
+                fill_schedule_intermediate = 
+                    d_bdry_fill_intermediate[ci]->createSchedule(
+                        level,
+                        d_patch_strategy);
+                
+                t_intermediate_bdry_fill_create->stop();
+            }
             
             if (regrid_advance)
             {
@@ -1711,36 +1856,59 @@ RungeKuttaLevelIntegrator::advanceLevel(
         }
         
         d_patch_strategy->setDataContext(d_scratch);
-            
-        for (hier::PatchLevel::iterator ip(level->begin());
-             ip != level->end();
-             ip++)
+        
+        /*
+         * In the low-storage Runge-Kutta scheme, the solution is advanced with the data of current
+         * and previous steps.
+         */
+        
+        if (d_use_low_storage_RK)
         {
-            const HAMERS_SHARED_PTR<hier::Patch>& patch = *ip;
-            
-            t_patch_num_kernel->start();
+            low_storage_intermediate.clear();
+            low_storage_intermediate.push_back(d_intermediate[ci]);
+            if (sn > 0)
+            {
+                low_storage_intermediate.push_back(d_intermediate[(sn - 1) % d_number_intermediate]);
+            }
+        }
+        
+        const std::vector<HAMERS_SHARED_PTR<hier::VariableContext> >& step_intermediate =
+            d_use_low_storage_RK ? low_storage_intermediate : d_intermediate;
+        
+        /*
+         * The timer is not thread-safe. It is started and stopped around the whole patch loop.
+         */
+        
+        t_patch_num_kernel->start();
+        
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (d_use_threaded_patch_loop)
+#endif
+        for (int pi = 0; pi < num_local_patches; pi++)
+        {
+            hier::Patch& patch = *local_patches[pi];
             
             // Compute flux corresponding to this sub-step.
             d_patch_strategy->computeFluxesAndSourcesOnPatch(
-                *patch,
+                patch,
                 current_time,
                 dt,
                 sn,
-                d_intermediate[sn]);
+                d_intermediate[ci]);
             
             // Advance a Runge-Kutta sub-step.
             d_patch_strategy->advanceSingleStepOnPatch(
-                *patch,
+                patch,
                 current_time,
                 dt,
                 d_alpha[sn],
                 d_beta[sn],
                 d_gamma[sn],
-                d_intermediate);
-            
-            t_patch_num_kernel->stop();
+                step_intermediate);
         }
         
+        t_patch_num_kernel->stop();
+        
         fill_schedule_intermediate.reset();
     }
     
@@ -1826,36 +1994,59 @@ RungeKuttaLevelIntegrator::advanceLevel(
                 }
             }
           
-            for (hier::PatchLevel::iterator ip(level->begin());
-                 ip != level->end();
-                 ip++)
+            t_patch_num_kernel->start();
+            
+#ifdef _OPENMP
+#pragma omp parallel if (d_use_threaded_patch_loop)
+#endif
             {
-                const HAMERS_SHARED_PTR<hier::Patch>& patch = *ip;
-                
-                patch->allocatePatchData(d_temp_var_scratch_data, new_time);
-                
-                // "false" argument indicates "initial_time" is false.
-                t_patch_num_kernel->start();
+                std::vector<double> thread_spectral_radiuses(spectral_radiuses.size(), 0.0);
+                double thread_dt_next = tbox::MathUtilities<double>::getMax();
                 
-                std::vector<double> patch_spectral_radiuses_and_dt =
-                    d_patch_strategy->computeSpectralRadiusesAndStableDtOnPatch(
-                        *patch,
-                        false,
-                        new_time);
-                
-                t_patch_num_kernel->stop();
-                
-                for (int si = 0; si < static_cast<int>(spectral_radiuses.size()); si++)
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+                for (int pi = 0; pi < num_local_patches; pi++)
                 {
-                    spectral_radiuses[si] = tbox::MathUtilities<double>::Max(
-                        spectral_radiuses[si], patch_spectral_radiuses_and_dt[si]);
+                    hier::Patch& patch = *local_patches[pi];
+                    
+                    patch.allocatePatchData(d_temp_var_scratch_data, new_time);
+                    
+                    // "false" argument indicates "initial_time" is false.
+                    std::vector<double> patch_spectral_radiuses_and_dt =
+                        d_patch_strategy->computeSpectralRadiusesAndStableDtOnPatch(
+                            patch,
+                            false,
+                            new_time);
+                    
+                    for (int si = 0; si < static_cast<int>(thread_spectral_radiuses.size()); si++)
+                    {
+                        thread_spectral_radiuses[si] = tbox::MathUtilities<double>::Max(
+                            thread_spectral_radiuses[si], patch_spectral_radiuses_and_dt[si]);
+                    }
+                    
+                    thread_dt_next = tbox::MathUtilities<double>::Min(thread_dt_next,
+                        patch_spectral_radiuses_and_dt.back());
+                    
+                    patch.deallocatePatchData(d_temp_var_scratch_data);
                 }
                 
-                dt_next = tbox::MathUtilities<double>::Min(dt_next, patch_spectral_radiuses_and_dt.back());
-                
-                patch->deallocatePatchData(d_temp_var_scratch_data);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+                {
+                    for (int si = 0; si < static_cast<int>(spectral_radiuses.size()); si++)
+                    {
+                        spectral_radiuses[si] = tbox::MathUtilities<double>::Max(
+                            spectral_radiuses[si], thread_spectral_radiuses[si]);
+                    }
+                    
+                    dt_next = tbox::MathUtilities<double>::Min(dt_next, thread_dt_next);
+                }
             }
             
+            t_patch_num_kernel->stop();
+            
             double spectral_radius_sum = 0.0;
             for (int si = 0; si < static_cast<int>(spectral_radiuses.size()); si++)
             {
@@ -1880,7 +2071,7 @@ RungeKuttaLevelIntegrator::advanceLevel(
     
     level->deallocatePatchData(d_saved_var_scratch_data);
     
-    for (int sn = 0; sn < d_number_steps; sn++)
+    for (int sn = 0; sn < d_number_intermediate; sn++)
     {
       level->deallocatePatchData(d_intermediate_time_dep_data[sn]);
       level->deallocatePatchData(d_intermediate_flux_var_data[sn]);
@@ -2415,8 +2606,8 @@ RungeKuttaLevelIntegrator::registerVariable(
         d_bdry_fill_advance_new.reset(new xfer::RefineAlgorithm());
         d_bdry_fill_advance_old.reset(new xfer::RefineAlgorithm());
         
-        d_bdry_fill_intermediate.resize(d_number_steps);
-        for (int sn = 0; sn < d_number_steps; sn++)
+        d_bdry_fill_intermediate.resize(d_number_intermediate);
+        for (int sn = 0; sn < d_number_intermediate; sn++)
         {
             d_bdry_fill_intermediate[sn].reset(new xfer::RefineAlgorithm());
         }
@@ -2461,8 +2652,8 @@ RungeKuttaLevelIntegrator::registerVariable(
                 d_scratch,
                 ghosts);
             
-            std::vector<int> intermediate_id(d_number_steps);
-            for (int sn = 0; sn < d_number_steps; sn++)
+            std::vector<int> intermediate_id(d_number_intermediate);
+            for (int sn = 0; sn < d_number_intermediate; sn++)
             {
                 intermediate_id[sn] = variable_db->registerVariableAndContext(
                     var,
@@ -2476,7 +2667,7 @@ RungeKuttaLevelIntegrator::registerVariable(
             
             d_new_time_dep_data.setFlag(new_id);
             
-            for (int sn = 0; sn < d_number_steps; sn++)
+            for (int sn = 0; sn < d_number_intermediate; sn++)
             {
                 d_intermediate_time_dep_data[sn].setFlag(intermediate_id[sn]);
             }
@@ -2512,7 +2703,7 @@ RungeKuttaLevelIntegrator::registerVariable(
              * Set boundary fill schedules for data used in the intermediate steps of the Runge-Kutta
              * integration.
              */
-            for (int sn = 0; sn < d_number_steps; sn++)
+            for (int sn = 0; sn < d_number_intermediate; sn++)
             {
                 d_bdry_fill_intermediate[sn]->registerRefine(
                     intermediate_id[sn],
@@ -2716,8 +2907,8 @@ RungeKuttaLevelIntegrator::registerVariable(
             
             d_flux_var_data.setFlag(scr_id);
             
-            std::vector<int> intermediate_id(d_number_steps);
-            for (int sn = 0; sn < d_number_steps; sn++)
+            std::vector<int> intermediate_id(d_number_intermediate);
+            for (int sn = 0; sn < d_number_intermediate; sn++)
             {
                 intermediate_id[sn] = variable_db->registerVariableAndContext(
                     var,
@@ -2725,7 +2916,7 @@ RungeKuttaLevelIntegrator::registerVariable(
                     ghosts_intermediate);
             }
             
-            for (int sn = 0; sn < d_number_steps; sn++)
+            for (int sn = 0; sn < d_number_intermediate; sn++)
             {
                 d_intermediate_flux_var_data[sn].setFlag(intermediate_id[sn]);
             }
@@ -2789,8 +2980,8 @@ RungeKuttaLevelIntegrator::registerVariable(
             
             d_source_var_data.setFlag(scr_id);
             
-            std::vector<int> intermediate_id(d_number_steps);
-            for (int sn = 0; sn < d_number_steps; sn++)
+            std::vector<int> intermediate_id(d_number_intermediate);
+            for (int sn = 0; sn < d_number_intermediate; sn++)
             {
                 intermediate_id[sn] = variable_db->registerVariableAndContext(
                     var,
@@ -2798,7 +2989,7 @@ RungeKuttaLevelIntegrator::registerVariable(
                     ghosts_intermediate);
             }
             
-            for (int sn = 0; sn < d_number_steps; sn++)
+            for (int sn = 0; sn < d_number_intermediate; sn++)
             {
                 d_intermediate_source_var_data[sn].setFlag(intermediate_id[sn]);
             }
@@ -2864,6 +3055,82 @@ RungeKuttaLevelIntegrator::registerVariable(
 }
 
 
+/*
+ **************************************************************************************************
+ *
+ * Compute the alpha, beta, and gamma values of the steps from the coefficients A and B of the
+ * low-storage (2N) Runge-Kutta scheme:
+ *
+ *    dQ_s    = A_s*dQ_{s-1} + dt*L(Q_s)
+ *    Q_{s+1} = Q_s + B_s*dQ_s
+ *
+ * Since dQ_{s-1} = (Q_s - Q_{s-1})/B_{s-1}, the solution of each step only depends on the data of
+ * current and previous steps:
+ *
+ *    Q_{s+1} = (1 + c_s)*Q_s - c_s*Q_{s-1} + B_s*dt*L(Q_s),  c_s = B_s*A_s/B_{s-1}
+ *
+ * The flux of each step is accumulated with the weight of that step in the final solution.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::computeLowStorageRungeKuttaWeights()
+{
+    TBOX_ASSERT(static_cast<int>(d_low_storage_RK_A.size()) == d_number_steps);
+    TBOX_ASSERT(static_cast<int>(d_low_storage_RK_B.size()) == d_number_steps);
+    
+    d_alpha.resize(d_number_steps);
+    d_beta.resize(d_number_steps);
+    d_gamma.resize(d_number_steps);
+    
+    for (int sn = 0; sn < d_number_steps; sn++)
+    {
+        /*
+         * Compute the weight of the flux of current step in the final solution.
+         */
+        
+        double weight = 0.0;
+        double A_product = 1.0;
+        for (int si = sn; si < d_number_steps; si++)
+        {
+            if (si > sn)
+            {
+                A_product *= d_low_storage_RK_A[si];
+            }
+            weight += d_low_storage_RK_B[si]*A_product;
+        }
+        
+        if (sn == 0)
+        {
+            d_alpha[sn].assign(1, 1.0);
+            d_beta[sn].assign(1, d_low_storage_RK_B[sn]);
+            d_gamma[sn].assign(1, weight);
+        }
+        else
+        {
+            double c = 0.0;
+            if (d_low_storage_RK_A[sn] != 0.0)
+            {
+                c = d_low_storage_RK_B[sn]*d_low_storage_RK_A[sn]/d_low_storage_RK_B[sn - 1];
+            }
+            
+            d_alpha[sn].resize(2);
+            d_beta[sn].resize(2);
+            d_gamma[sn].resize(2);
+            
+            d_alpha[sn][0] = 1.0 + c;
+            d_alpha[sn][1] = -c;
+            
+            d_beta[sn][0] = d_low_storage_RK_B[sn];
+            d_beta[sn][1] = 0.0;
+            
+            d_gamma[sn][0] = weight;
+            d_gamma[sn][1] = 0.0;
+        }
+    }
+}
+
+
 /*
  **************************************************************************************************
  *
@@ -3442,11 +3709,45 @@ RungeKuttaLevelIntegrator::printClassData(
         os << "d_dt = " << d_dt << std::endl;
     }
     
+    os << "d_use_threaded_patch_loop = " << d_use_threaded_patch_loop << std::endl;
+    os << "d_defer_output_data_statistics = " << d_defer_output_data_statistics << std::endl;
+#ifdef _OPENMP
+    if (d_use_threaded_patch_loop)
+    {
+        os << "Maximum number of OpenMP threads = " << omp_get_max_threads() << std::endl;
+    }
+#endif
+    
     os << "d_patch_strategy = "
        << (RungeKuttaPatchStrategy *)d_patch_strategy << std::endl;
     
+    os << "Number of intermediate schedules created = "
+       << d_num_bdry_sched_intermediate_created << "\n"
+       << "Number of intermediate schedules reused = "
+       << d_num_bdry_sched_intermediate_reused << "\n"
+       << "Wall clock time saved by reusing intermediate schedules = "
+       << d_bdry_sched_intermediate_create_time_saved << std::endl;
+    
     os << std::endl;
     
+    os << "d_use_low_storage_RK = " << d_use_low_storage_RK << std::endl;
+    if (d_use_low_storage_RK)
+    {
+        os << "Low-storage Runge-Kutta coefficients:" << std::endl;
+        os << "   A = " << d_low_storage_RK_A[0];
+        for (int i = 1; i < static_cast<int>(d_low_storage_RK_A.size()); i++)
+        {
+            os << " , " << d_low_storage_RK_A[i];
+        }
+        os << std::endl;
+        os << "   B = " << d_low_storage_RK_B[0];
+        for (int i = 1; i < static_cast<int>(d_low_storage_RK_B.size()); i++)
+        {
+            os << " , " << d_low_storage_RK_B[i];
+        }
+        os << std::endl;
+    }
+    
     os << "Runge-Kutta weights:" << std::endl;
     for (int i = 0; i < static_cast<int>(d_alpha.size()); i++)
     {
@@ -3534,6 +3835,20 @@ RungeKuttaLevelIntegrator::putToRestart(
     restart_db->putBool("DEV_distinguish_mpi_reduction_costs",
         d_distinguish_mpi_reduction_costs);
     
+    restart_db->putBool("use_low_storage_RK", d_use_low_storage_RK);
+    
+    if (d_use_low_storage_RK)
+    {
+        restart_db->putDatabase("LowStorageRungeKuttaWeights");
+        
+        HAMERS_SHARED_PTR<tbox::Database> LSRK_db(
+            restart_db->getDatabase("LowStorageRungeKuttaWeights"));
+        
+        LSRK_db->putInteger("number_steps", d_number_steps);
+        LSRK_db->putDoubleVector("A", d_low_storage_RK_A);
+        LSRK_db->putDoubleVector("B", d_low_storage_RK_B);
+    }
+    
     restart_db->putDatabase("RungeKuttaWeights");
     
     HAMERS_SHARED_PTR<tbox::Database> RK_db(restart_db->getDatabase("RungeKuttaWeights"));
@@ -3613,6 +3928,12 @@ RungeKuttaLevelIntegrator::computeAndOutputDataStatistics(
     const double statistics_data_time,
     const bool output_statistics)
 {
+    /*
+     * The statistics whose output is still deferred are output first.
+     */
+    
+    outputDeferredDataStatistics(hierarchy);
+    
     t_output_data_statistics->start();
     
     int num_levels = hierarchy->getNumberOfLevels();
@@ -3739,7 +4060,19 @@ RungeKuttaLevelIntegrator::computeAndOutputDataStatistics(
     
     if (output_statistics)
     {
-        d_patch_strategy->outputDataStatistics(hierarchy, statistics_data_time);
+        /*
+         * The output is deferred until after the next time step if the patch strategy allows it.
+         */
+        
+        if (d_defer_output_data_statistics && d_patch_strategy->canDeferOutputDataStatistics())
+        {
+            d_is_output_data_statistics_deferred = true;
+            d_deferred_output_data_statistics_time = statistics_data_time;
+        }
+        else
+        {
+            d_patch_strategy->outputDataStatistics(hierarchy, statistics_data_time);
+        }
     }
     
     for (int li = 0; li < num_levels; li++)
@@ -3756,6 +4089,30 @@ RungeKuttaLevelIntegrator::computeAndOutputDataStatistics(
 }
 
 
+/*
+ **************************************************************************************************
+ *
+ * Output statistics of data whose output is deferred.
+ *
+ **************************************************************************************************
+ */
+void
+RungeKuttaLevelIntegrator::outputDeferredDataStatistics(
+    const HAMERS_SHARED_PTR<hier::PatchHierarchy>& hierarchy)
+{
+    if (d_is_output_data_statistics_deferred)
+    {
+        t_output_data_statistics->start();
+        
+        d_patch_strategy->outputDataStatistics(hierarchy, d_deferred_output_data_statistics_time);
+        
+        d_is_output_data_statistics_deferred = false;
+        
+        t_output_data_statistics->stop();
+    }
+}
+
+
 /*
  **************************************************************************************************
  *
@@ -3793,7 +4150,65 @@ RungeKuttaLevelIntegrator::getFromInput(
         
         d_distinguish_mpi_reduction_costs = input_db->getBoolWithDefault("DEV_distinguish_mpi_reduction_costs", false);
         
-        if (input_db->keyExists("RungeKuttaWeights"))
+        if (input_db->keyExists("LowStorageRungeKuttaWeights"))
+        {
+            if (input_db->keyExists("RungeKuttaWeights"))
+            {
+                TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                           << "Only one of 'RungeKuttaWeights' and 'LowStorageRungeKuttaWeights' "
+                           << "can be given in input."
+                           << std::endl);
+            }
+            
+            HAMERS_SHARED_PTR<tbox::Database> LSRK_db(input_db->getDatabase("LowStorageRungeKuttaWeights"));
+            
+            d_use_low_storage_RK = true;
+            
+            d_number_steps = LSRK_db->getInteger("number_steps");
+            
+            if (d_number_steps < 1)
+            {
+                TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                           << "'number_steps' of the low-storage Runge-Kutta scheme must be > 0."
+                           << std::endl);
+            }
+            
+            d_low_storage_RK_A = LSRK_db->getDoubleVector("A");
+            d_low_storage_RK_B = LSRK_db->getDoubleVector("B");
+            
+            if (static_cast<int>(d_low_storage_RK_A.size()) != d_number_steps ||
+                static_cast<int>(d_low_storage_RK_B.size()) != d_number_steps)
+            {
+                TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                           << "number of 'A' and 'B' entries of the low-storage Runge-Kutta scheme "
+                           << "must be = "
+                           << d_number_steps
+                           << std::endl);
+            }
+            
+            if (d_low_storage_RK_A[0] != 0.0)
+            {
+                TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                           << "'A[0]' of the low-storage Runge-Kutta scheme must be zero."
+                           << std::endl);
+            }
+            
+            for (int sn = 1; sn < d_number_steps; sn++)
+            {
+                if (d_low_storage_RK_A[sn] != 0.0 && d_low_storage_RK_B[sn - 1] == 0.0)
+                {
+                    TBOX_ERROR(": RungeKuttaLevelIntegrator::getFromInput()\n"
+                               << "'B["
+                               << (sn - 1)
+                               << "]' of the low-storage Runge-Kutta scheme must be non-zero when "
+                               << "'A["
+                               << sn
+                               << "]' is non-zero."
+                               << std::endl);
+                }
+            }
+        }
+        else if (input_db->keyExists("RungeKuttaWeights"))
         {
             HAMERS_SHARED_PTR<tbox::Database> RK_db(input_db->getDatabase("RungeKuttaWeights"));
             
@@ -3962,6 +4377,14 @@ RungeKuttaLevelIntegrator::getFromInput(
         
         d_num_filtering_stats = input_db->getIntegerWithDefault("num_filtering_stats", 0); 
     }
+    
+    if (input_db)
+    {
+        d_use_threaded_patch_loop = input_db->getBoolWithDefault("use_threaded_patch_loop", false);
+        
+        d_defer_output_data_statistics =
+            input_db->getBoolWithDefault("defer_output_data_statistics", false);
+    }
 }
 
 
@@ -4008,6 +4431,16 @@ RungeKuttaLevelIntegrator::getFromRestart()
     d_dt = db->getDouble("dt");
     d_distinguish_mpi_reduction_costs = db->getBool("DEV_distinguish_mpi_reduction_costs");
     
+    d_use_low_storage_RK = db->getBoolWithDefault("use_low_storage_RK", false);
+    
+    if (d_use_low_storage_RK)
+    {
+        HAMERS_SHARED_PTR<tbox::Database> LSRK_db(db->getDatabase("LowStorageRungeKuttaWeights"));
+        
+        d_low_storage_RK_A = LSRK_db->getDoubleVector("A");
+        d_low_storage_RK_B = LSRK_db->getDoubleVector("B");
+    }
+    
     HAMERS_SHARED_PTR<tbox::Database> RK_db(db->getDatabase("RungeKuttaWeights"));
     
     d_number_steps = RK_db->getInteger("number_steps");
@@ -4064,6 +4497,8 @@ RungeKuttaLevelIntegrator::initializeCallback()
         getTimer("RungeKuttaLevelIntegrator::advance_bdry_fill_create");
     t_new_advance_bdry_fill_create = tbox::TimerManager::getManager()->
         getTimer("RungeKuttaLevelIntegrator::new_advance_bdry_fill_create");
+    t_intermediate_bdry_fill_create = tbox::TimerManager::getManager()->
+        getTimer("RungeKuttaLevelIntegrator::intermediate_bdry_fill_create");
     t_apply_value_detector = tbox::TimerManager::getManager()->
         getTimer("RungeKuttaLevelIntegrator::applyValueDetector()");
     t_apply_gradient_detector = tbox::TimerManager::getManager()->
@@ -4128,6 +4563,7 @@ RungeKuttaLevelIntegrator::finalizeCallback()
     t_init_level_fill_interior.reset();
     t_advance_bdry_fill_create.reset();
     t_new_advance_bdry_fill_create.reset();
+    t_intermediate_bdry_fill_create.reset();
     t_apply_value_detector.reset();
     t_apply_gradient_detector.reset();
     t_apply_multiresolution_detector.reset();
@@ -409,6 +409,17 @@ RungeKuttaPatchStrategy::outputDataStatistics(
 }
 
 
+/**
+ * Return whether the output of the statistics of data computed last can be deferred until after the
+ * next time step.
+ */
+bool
+RungeKuttaPatchStrategy::canDeferOutputDataStatistics() const
+{
+    return false;
+}
+
+
 void
 RungeKuttaPatchStrategy::setupLoadBalancer(
     RungeKuttaLevelIntegrator* integrator,
@@ -419,6 +430,37 @@ RungeKuttaPatchStrategy::setupLoadBalancer(
 }
 
 
+bool
+RungeKuttaPatchStrategy::supportsConcurrentPatchOperations() const
+{
+    return false;
+}
+
+
+void
+RungeKuttaPatchStrategy::setupConcurrentPatchOperations()
+{
+}
+
+
+void
+RungeKuttaPatchStrategy::preprocessFillBoundaryDataBeforeAdvance(
+    const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+    double current_time,
+    double dt,
+    bool first_step,
+    bool last_step,
+    bool regrid_advance)
+{
+    NULL_USE(level);
+    NULL_USE(current_time);
+    NULL_USE(dt);
+    NULL_USE(first_step);
+    NULL_USE(last_step);
+    NULL_USE(regrid_advance);
+}
+
+
 void
 RungeKuttaPatchStrategy::preprocessAdvanceLevelState(
     const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
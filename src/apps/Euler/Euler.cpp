@@ -1,11 +1,14 @@
 #include "apps/Euler/Euler.hpp"
 
+#include "util/CPUDispatch.hpp"
+
 #include "SAMRAI/geom/CartesianPatchGeometry.h"
 #include "SAMRAI/hier/BoxContainer.h"
 #include "SAMRAI/hier/Index.h"
 #include "SAMRAI/hier/PatchDataRestartManager.h"
 #include "SAMRAI/hier/VariableDatabase.h"
 #include "SAMRAI/math/HierarchyCellDataOpsReal.h"
+#include "SAMRAI/mesh/CascadePartitioner.h"
 #include "SAMRAI/mesh/TreeLoadBalancer.h"
 #include "SAMRAI/pdat/CellData.h"
 #include "SAMRAI/pdat/CellIndex.h"
@@ -26,6 +29,10 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <limits>
 #include <fstream>
 
@@ -64,7 +71,8 @@ Euler::Euler(
         d_monitoring_stat_dump_filename("monitoring_stats.txt"),
         d_stat_dump_filename(stat_dump_filename),
         d_use_nonuniform_workload(false),
-        d_Euler_boundary_conditions_db_is_from_restart(false)
+        d_Euler_boundary_conditions_db_is_from_restart(false),
+        d_supports_concurrent_patch_operations(false)
 {
     TBOX_ASSERT(!object_name.empty());
     TBOX_ASSERT(input_db);
@@ -136,6 +144,13 @@ Euler::Euler(
     
     d_convective_flux_reconstructor = d_convective_flux_reconstructor_manager->getConvectiveFluxReconstructor();
     
+    /*
+     * Create the first worker of the patch operations. The workers of the other threads are only
+     * created if the level integrator shares its patch loops among threads.
+     */
+    
+    setupWorkers();
+    
     /*
      * Initialize d_Euler_initial_conditions.
      */
@@ -413,11 +428,15 @@ Euler::setupLoadBalancer(
     
     if (d_use_nonuniform_workload && gridding_algorithm)
     {
-        HAMERS_SHARED_PTR<mesh::TreeLoadBalancer> load_balancer(
+        HAMERS_SHARED_PTR<mesh::TreeLoadBalancer> tree_load_balancer(
             HAMERS_DYNAMIC_POINTER_CAST<mesh::TreeLoadBalancer, mesh::LoadBalanceStrategy>(
                 gridding_algorithm->getLoadBalanceStrategy()));
         
-        if (load_balancer)
+        HAMERS_SHARED_PTR<mesh::CascadePartitioner> cascade_partitioner(
+            HAMERS_DYNAMIC_POINTER_CAST<mesh::CascadePartitioner, mesh::LoadBalanceStrategy>(
+                gridding_algorithm->getLoadBalanceStrategy()));
+        
+        if (tree_load_balancer || cascade_partitioner)
         {
             d_workload_variable.reset(new pdat::CellVariable<double>(
                 d_dim,
@@ -427,8 +446,20 @@ Euler::setupLoadBalancer(
                 d_workload_variable,
                 vardb->getContext("WORKLOAD"),
                 zero_vec);
-            load_balancer->setWorkloadPatchDataIndex(d_workload_data_id);
+            if (tree_load_balancer)
+            {
+                tree_load_balancer->setWorkloadPatchDataIndex(d_workload_data_id);
+            }
+            else
+            {
+                cascade_partitioner->setWorkloadPatchDataIndex(d_workload_data_id);
+            }
             pdrm->registerPatchDataForRestart(d_workload_data_id);
+            
+            d_workload_measurer.reset(new PatchWorkloadMeasurer(
+                "d_workload_measurer",
+                d_dim,
+                d_workload_data_id));
         }
         else
         {
@@ -478,6 +509,8 @@ Euler::initializeDataOnPatch(
             HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
                 patch.getPatchData(d_workload_data_id)));
         TBOX_ASSERT(workload_data);
+        
+        // The cost of the cells is taken as uniform until it is measured when the level is advanced.
         workload_data->fillAll(1.0);
     }
 
@@ -491,7 +524,15 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
     const bool initial_time,
     const double dt_time)
 {
-    t_compute_dt->start();
+    const int wi = getWorkerIndex();
+    
+    // The timers are not thread-safe and only the first worker is timed.
+    if (wi == 0)
+    {
+        t_compute_dt->start();
+    }
+    
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model = d_worker_flow_models[wi];
     
     std::vector<double> spectral_radiuses_and_dt;
     
@@ -525,35 +566,35 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * Register the patch and maximum wave speed in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+        flow_model->registerPatchWithDataContext(patch, getDataContext());
         
-        hier::IntVector num_ghosts = d_flow_model->getNumberOfGhostCells();
+        hier::IntVector num_ghosts = flow_model->getNumberOfGhostCells();
         
-        d_flow_model->setupSourceUtilities();
+        flow_model->setupSourceUtilities();
         
         HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-            d_flow_model->getFlowModelSourceUtilities();
+            flow_model->getFlowModelSourceUtilities();
         
         std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         num_subghosts_of_data.insert(
             std::pair<std::string, hier::IntVector>(
                 "MAX_WAVE_SPEED_X", num_ghosts));
         
-        d_flow_model->registerDerivedVariables(num_subghosts_of_data);
+        flow_model->registerDerivedVariables(num_subghosts_of_data);
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->registerDerivedVariablesForSourceTermsStableDt(hier::IntVector::getZero(d_dim));
         }
         
-        d_flow_model->allocateMemoryForDerivedCellData();
+        flow_model->allocateMemoryForDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->allocateMemoryForDerivedCellData();
         }
         
-        d_flow_model->computeDerivedCellData();
+        flow_model->computeDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
@@ -565,7 +606,7 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
          */
         
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = d_flow_model->getCellData("MAX_WAVE_SPEED_X");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = flow_model->getCellData("MAX_WAVE_SPEED_X");
         
         hier::IntVector num_subghosts_max_wave_speed_x = max_wave_speed_x->getGhostCellWidth();
         
@@ -610,7 +651,7 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
     }
     else if (d_dim == tbox::Dimension(2))
     {
@@ -630,18 +671,18 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * Register the patch and maximum wave speeds in the flow model and compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+        flow_model->registerPatchWithDataContext(patch, getDataContext());
         
-        hier::IntVector num_ghosts = d_flow_model->getNumberOfGhostCells();
+        hier::IntVector num_ghosts = flow_model->getNumberOfGhostCells();
         
         hier::Box ghost_box = interior_box;
         ghost_box.grow(num_ghosts);
         const hier::IntVector ghostcell_dims = ghost_box.numberCells();
         
-        d_flow_model->setupSourceUtilities();
+        flow_model->setupSourceUtilities();
         
         HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-            d_flow_model->getFlowModelSourceUtilities();
+            flow_model->getFlowModelSourceUtilities();
         
         std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         num_subghosts_of_data.insert(
@@ -651,21 +692,21 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
             std::pair<std::string, hier::IntVector>(
                 "MAX_WAVE_SPEED_Y", num_ghosts));
         
-        d_flow_model->registerDerivedVariables(num_subghosts_of_data);
+        flow_model->registerDerivedVariables(num_subghosts_of_data);
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->registerDerivedVariablesForSourceTermsStableDt(hier::IntVector::getZero(d_dim));
         }
         
-        d_flow_model->allocateMemoryForDerivedCellData();
+        flow_model->allocateMemoryForDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->allocateMemoryForDerivedCellData();
         }
         
-        d_flow_model->computeDerivedCellData();
+        flow_model->computeDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
@@ -677,8 +718,8 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
          */
         
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = d_flow_model->getCellData("MAX_WAVE_SPEED_X");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = d_flow_model->getCellData("MAX_WAVE_SPEED_Y");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = flow_model->getCellData("MAX_WAVE_SPEED_X");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = flow_model->getCellData("MAX_WAVE_SPEED_Y");
         
         hier::IntVector num_subghosts_max_wave_speed_x = max_wave_speed_x->getGhostCellWidth();
         hier::IntVector num_subghosts_max_wave_speed_y = max_wave_speed_y->getGhostCellWidth();
@@ -739,7 +780,7 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
     }
     else if (d_dim == tbox::Dimension(3))
     {
@@ -762,18 +803,18 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+        flow_model->registerPatchWithDataContext(patch, getDataContext());
         
-        hier::IntVector num_ghosts = d_flow_model->getNumberOfGhostCells();
+        hier::IntVector num_ghosts = flow_model->getNumberOfGhostCells();
         
         hier::Box ghost_box = interior_box;
         ghost_box.grow(num_ghosts);
         const hier::IntVector ghostcell_dims = ghost_box.numberCells();
         
-        d_flow_model->setupSourceUtilities();
+        flow_model->setupSourceUtilities();
         
         HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-            d_flow_model->getFlowModelSourceUtilities();
+            flow_model->getFlowModelSourceUtilities();
         
         std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         num_subghosts_of_data.insert(
@@ -786,21 +827,21 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
             std::pair<std::string, hier::IntVector>(
                 "MAX_WAVE_SPEED_Z", num_ghosts));
         
-        d_flow_model->registerDerivedVariables(num_subghosts_of_data);
+        flow_model->registerDerivedVariables(num_subghosts_of_data);
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->registerDerivedVariablesForSourceTermsStableDt(hier::IntVector::getZero(d_dim));
         }
         
-        d_flow_model->allocateMemoryForDerivedCellData();
+        flow_model->allocateMemoryForDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->allocateMemoryForDerivedCellData();
         }
         
-        d_flow_model->computeDerivedCellData();
+        flow_model->computeDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
@@ -812,9 +853,9 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
          */
         
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = d_flow_model->getCellData("MAX_WAVE_SPEED_X");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = d_flow_model->getCellData("MAX_WAVE_SPEED_Y");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_z = d_flow_model->getCellData("MAX_WAVE_SPEED_Z");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = flow_model->getCellData("MAX_WAVE_SPEED_X");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = flow_model->getCellData("MAX_WAVE_SPEED_Y");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_z = flow_model->getCellData("MAX_WAVE_SPEED_Z");
         
         hier::IntVector num_subghosts_max_wave_speed_x = max_wave_speed_x->getGhostCellWidth();
         hier::IntVector num_subghosts_max_wave_speed_y = max_wave_speed_y->getGhostCellWidth();
@@ -891,10 +932,13 @@ Euler::computeSpectralRadiusesAndStableDtOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
     }
     
-    t_compute_dt->stop();
+    if (wi == 0)
+    {
+        t_compute_dt->stop();
+    }
     
     return spectral_radiuses_and_dt;
 }
@@ -908,7 +952,25 @@ Euler::computeFluxesAndSourcesOnPatch(
     const int RK_step_number,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    t_compute_fluxes_sources->start();
+    const int wi = getWorkerIndex();
+    
+    // The timers are not thread-safe and only the first worker is timed.
+    if (wi == 0)
+    {
+        t_compute_fluxes_sources->start();
+    }
+    
+    const bool is_measuring_workload = d_workload_measurer && d_workload_measurer->isMeasuring();
+    
+    double workload_start_time = 0.0;
+    if (is_measuring_workload)
+    {
+        workload_start_time = tbox::SAMRAI_MPI::Wtime();
+    }
+    
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model = d_worker_flow_models[wi];
+    const HAMERS_SHARED_PTR<ConvectiveFluxReconstructor>& convective_flux_reconstructor =
+        d_worker_convective_flux_reconstructors[wi];
     
     /*
      * Set zero for the source.
@@ -931,13 +993,20 @@ Euler::computeFluxesAndSourcesOnPatch(
         data_source->fillAll(0.0);
     }
     
+    /*
+     * Cache the derived cell data of the flow model such that the derived cell data shared by the
+     * convective flux and source terms is only computed once on the patch.
+     */
+    
+    flow_model->startCachingDerivedCellData();
+    
     /*
      * Compute the convective flux and source due to splitting of convective term.
      */
     
     if (data_context)
     {
-        d_convective_flux_reconstructor->
+        convective_flux_reconstructor->
             computeConvectiveFluxAndSourceOnPatch(
                 patch,
                 d_variable_convective_flux,
@@ -949,7 +1018,7 @@ Euler::computeFluxesAndSourcesOnPatch(
     }
     else
     {
-        d_convective_flux_reconstructor->
+        convective_flux_reconstructor->
             computeConvectiveFluxAndSourceOnPatch(
                 patch,
                 d_variable_convective_flux,
@@ -964,20 +1033,20 @@ Euler::computeFluxesAndSourcesOnPatch(
      * Compute the source terms.
      */
     
-    d_flow_model->setupSourceUtilities();
+    flow_model->setupSourceUtilities();
     
     HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-        d_flow_model->getFlowModelSourceUtilities();
+        flow_model->getFlowModelSourceUtilities();
     
     if (source_utilities->hasSourceTerms())
     {
         if (data_context)
         {
-            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            flow_model->registerPatchWithDataContext(patch, data_context);
         }
         else
         {
-            d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+            flow_model->registerPatchWithDataContext(patch, getDataContext());
         }
         
         source_utilities->registerDerivedVariablesForSourceTerms(hier::IntVector::getZero(d_dim));
@@ -992,10 +1061,28 @@ Euler::computeFluxesAndSourcesOnPatch(
             dt,
             RK_step_number);
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
     }
     
-    t_compute_fluxes_sources->stop();
+    flow_model->stopCachingDerivedCellData();
+    
+    /*
+     * Add the measured cost of the fluxes and sources to the workload. The patches near shocks and
+     * the patches with active source terms are more costly than the smooth patches.
+     */
+    
+    if (is_measuring_workload)
+    {
+        d_workload_measurer->addCostToWorkload(
+            patch,
+            hier::BoxContainer(patch.getBox()),
+            tbox::SAMRAI_MPI::Wtime() - workload_start_time);
+    }
+    
+    if (wi == 0)
+    {
+        t_compute_fluxes_sources->stop();
+    }
 }
 
 
@@ -1012,7 +1099,15 @@ Euler::advanceSingleStepOnPatch(
     NULL_USE(time);
     NULL_USE(dt);
     
-    t_advance_step->start();
+    const int wi = getWorkerIndex();
+    
+    // The timers are not thread-safe and only the first worker is timed.
+    if (wi == 0)
+    {
+        t_advance_step->start();
+    }
+    
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model = d_worker_flow_models[wi];
     
     const HAMERS_SHARED_PTR<geom::CartesianPatchGeometry> patch_geom(
         HAMERS_SHARED_PTR_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
@@ -1033,19 +1128,19 @@ Euler::advanceSingleStepOnPatch(
      * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
      */
     
-    d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+    flow_model->registerPatchWithDataContext(patch, getDataContext());
     
     std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > conservative_variables =
-        d_flow_model->getCellDataOfConservativeVariables();
+        flow_model->getCellDataOfConservativeVariables();
     
     std::vector<hier::IntVector> num_ghosts_conservative_var;
-    num_ghosts_conservative_var.reserve(d_flow_model->getNumberOfEquations());
+    num_ghosts_conservative_var.reserve(flow_model->getNumberOfEquations());
     
     std::vector<hier::IntVector> ghostcell_dims_conservative_var;
-    ghostcell_dims_conservative_var.reserve(d_flow_model->getNumberOfEquations());
+    ghostcell_dims_conservative_var.reserve(flow_model->getNumberOfEquations());
     
     std::vector<double*> Q;
-    Q.reserve(d_flow_model->getNumberOfEquations());
+    Q.reserve(flow_model->getNumberOfEquations());
     
     int count_eqn = 0;
     
@@ -1057,7 +1152,7 @@ Euler::advanceSingleStepOnPatch(
         {
             // If the last element of the conservative variable vector is not in the system of
             // equations, ignore it.
-            if (count_eqn >= d_flow_model->getNumberOfEquations())
+            if (count_eqn >= flow_model->getNumberOfEquations())
                 break;
             
             Q.push_back(conservative_variables[vi]->getPointer(di));
@@ -1068,10 +1163,10 @@ Euler::advanceSingleStepOnPatch(
         }
     }
     
-    d_flow_model->fillCellDataOfConservativeVariablesWithZero();
+    flow_model->fillCellDataOfConservativeVariablesWithZero();
     
     // Unregister the patch.
-    d_flow_model->unregisterPatch();
+    flow_model->unregisterPatch();
     
     /*
      * Use alpha, beta and gamma values to update the time-dependent solution, flux and source.
@@ -1118,19 +1213,19 @@ Euler::advanceSingleStepOnPatch(
          * current intermediate data context.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, intermediate_context[n]);
+        flow_model->registerPatchWithDataContext(patch, intermediate_context[n]);
         
         std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > conservative_variables_intermediate =
-            d_flow_model->getCellDataOfConservativeVariables();
+            flow_model->getCellDataOfConservativeVariables();
         
         std::vector<hier::IntVector> num_ghosts_conservative_var_intermediate;
-        num_ghosts_conservative_var_intermediate.reserve(d_flow_model->getNumberOfEquations());
+        num_ghosts_conservative_var_intermediate.reserve(flow_model->getNumberOfEquations());
         
         std::vector<hier::IntVector> ghostcell_dims_conservative_var_intermediate;
-        ghostcell_dims_conservative_var_intermediate.reserve(d_flow_model->getNumberOfEquations());
+        ghostcell_dims_conservative_var_intermediate.reserve(flow_model->getNumberOfEquations());
         
         std::vector<double*> Q_intermediate;
-        Q_intermediate.reserve(d_flow_model->getNumberOfEquations());
+        Q_intermediate.reserve(flow_model->getNumberOfEquations());
         
         count_eqn = 0;
         
@@ -1142,7 +1237,7 @@ Euler::advanceSingleStepOnPatch(
             {
                 // If the last element of the conservative variable vector is not in the system of
                 // equations, ignore it.
-                if (count_eqn >= d_flow_model->getNumberOfEquations())
+                if (count_eqn >= flow_model->getNumberOfEquations())
                     break;
                 
                 Q_intermediate.push_back(conservative_variables_intermediate[vi]->getPointer(di));
@@ -1156,7 +1251,7 @@ Euler::advanceSingleStepOnPatch(
         }
         
         // Unregister the patch.
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
         
         if (d_dim == tbox::Dimension(1))
         {
@@ -1170,7 +1265,7 @@ Euler::advanceSingleStepOnPatch(
             
             if (alpha[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     const int num_ghosts_0_conservative_var = num_ghosts_conservative_var[ei][0];
                     const int num_ghosts_0_conservative_var_intermediate =
@@ -1192,7 +1287,7 @@ Euler::advanceSingleStepOnPatch(
             
             if (beta[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                     double* S_intermediate = source_intermediate->getPointer(ei);
@@ -1219,7 +1314,7 @@ Euler::advanceSingleStepOnPatch(
             if (gamma[n] != 0.0)
             {
                 // Accumulate the flux in the x direction.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_x = convective_flux->getPointer(0, ei);
                     double* F_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -1237,7 +1332,7 @@ Euler::advanceSingleStepOnPatch(
                 }
                 
                 // Accumulate the source.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* S = source->getPointer(ei);
                     double* S_intermediate = source_intermediate->getPointer(ei);
@@ -1269,7 +1364,7 @@ Euler::advanceSingleStepOnPatch(
             
             if (alpha[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     const int num_ghosts_0_conservative_var = num_ghosts_conservative_var[ei][0];
                     const int num_ghosts_1_conservative_var = num_ghosts_conservative_var[ei][1];
@@ -1305,7 +1400,7 @@ Euler::advanceSingleStepOnPatch(
             
             if (beta[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                     double* F_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1353,7 +1448,7 @@ Euler::advanceSingleStepOnPatch(
             if (gamma[n] != 0.0)
             {
                 // Accumulate the flux in the x direction.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_x = convective_flux->getPointer(0, ei);
                     double* F_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -1375,7 +1470,7 @@ Euler::advanceSingleStepOnPatch(
                 }
                 
                 // Accumulate the flux in the y direction.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_y = convective_flux->getPointer(1, ei);
                     double* F_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1397,7 +1492,7 @@ Euler::advanceSingleStepOnPatch(
                 }
                 
                 // Accumulate the source.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* S = source->getPointer(ei);
                     double* S_intermediate = source_intermediate->getPointer(ei);
@@ -1435,7 +1530,7 @@ Euler::advanceSingleStepOnPatch(
             
             if (alpha[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     const int num_ghosts_0_conservative_var = num_ghosts_conservative_var[ei][0];
                     const int num_ghosts_1_conservative_var = num_ghosts_conservative_var[ei][1];
@@ -1485,7 +1580,7 @@ Euler::advanceSingleStepOnPatch(
             
             if (beta[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                     double* F_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1555,7 +1650,7 @@ Euler::advanceSingleStepOnPatch(
             if (gamma[n] != 0.0)
             {
                 // Accumulate the flux in the x direction.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_x = convective_flux->getPointer(0, ei);
                     double* F_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -1581,7 +1676,7 @@ Euler::advanceSingleStepOnPatch(
                 }
                 
                 // Accumulate the flux in the y direction.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_y = convective_flux->getPointer(1, ei);
                     double* F_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1607,7 +1702,7 @@ Euler::advanceSingleStepOnPatch(
                 }
                 
                 // Accumulate the flux in the z direction.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* F_z = convective_flux->getPointer(2, ei);
                     double* F_z_intermediate = convective_flux_intermediate->getPointer(2, ei);
@@ -1633,7 +1728,7 @@ Euler::advanceSingleStepOnPatch(
                 }
                 
                 // Accumulate the source.
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     double* S = source->getPointer(ei);
                     double* S_intermediate = source_intermediate->getPointer(ei);
@@ -1666,15 +1761,18 @@ Euler::advanceSingleStepOnPatch(
         
         if (beta[n] != 0.0)
         {
-            d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+            flow_model->registerPatchWithDataContext(patch, getDataContext());
             
-            d_flow_model->updateCellDataOfConservativeVariables();
+            flow_model->updateCellDataOfConservativeVariables();
             
-            d_flow_model->unregisterPatch();
+            flow_model->unregisterPatch();
         }
     }
     
-    t_advance_step->stop();
+    if (wi == 0)
+    {
+        t_advance_step->stop();
+    }
 }
 
 
@@ -1988,6 +2086,58 @@ Euler::preprocessTagCellsValueDetector(
 }
 
 
+/*
+ * Reset the workload on the patches of the level and start measuring the cost of the patch operations
+ * before the ghost cells are filled to advance the level. The workload is only measured when the level is
+ * advanced to integrate the data on the hierarchy.
+ */
+void
+Euler::preprocessFillBoundaryDataBeforeAdvance(
+    const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+    double current_time,
+    double dt,
+    bool first_step,
+    bool last_step,
+    bool regrid_advance)
+{
+    NULL_USE(current_time);
+    NULL_USE(dt);
+    NULL_USE(first_step);
+    NULL_USE(last_step);
+    
+    if (d_workload_measurer && !regrid_advance)
+    {
+        d_workload_measurer->startMeasuringOnLevel(level);
+    }
+}
+
+
+/*
+ * Stop measuring the cost of the patch operations and scale the workload measured while the level was
+ * advanced such that the mean cost of the cells on the level is one.
+ */
+void
+Euler::postprocessAdvanceLevelState(
+    const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+    double current_time,
+    double dt,
+    bool first_step,
+    bool last_step,
+    bool regrid_advance)
+{
+    NULL_USE(current_time);
+    NULL_USE(dt);
+    NULL_USE(first_step);
+    NULL_USE(last_step);
+    NULL_USE(regrid_advance);
+    
+    if (d_workload_measurer)
+    {
+        d_workload_measurer->finishMeasuringOnLevel(level);
+    }
+}
+
+
 /*
  * Tag cells for refinement using value detector.
  */
@@ -2239,12 +2389,33 @@ Euler::setPhysicalBoundaryConditions(
 {
     t_setphysbcs->start();
     
+    const bool is_measuring_workload = d_workload_measurer && d_workload_measurer->isMeasuring();
+    
+    double workload_start_time = 0.0;
+    if (is_measuring_workload)
+    {
+        workload_start_time = tbox::SAMRAI_MPI::Wtime();
+    }
+    
     d_Euler_boundary_conditions->setPhysicalBoundaryConditions(
         patch,
         fill_time,
         ghost_width_to_fill,
         getDataContext());
     
+    /*
+     * Add the measured cost of the boundary fill to the workload. The cost is put on the interior
+     * cells within the ghost cell width from the physical boundaries.
+     */
+    
+    if (is_measuring_workload)
+    {
+        d_workload_measurer->addPhysicalBoundaryFillCostToWorkload(
+            patch,
+            ghost_width_to_fill,
+            tbox::SAMRAI_MPI::Wtime() - workload_start_time);
+    }
+    
     t_setphysbcs->stop();
 }
 
@@ -2347,6 +2518,7 @@ void Euler::printClassData(std::ostream& os) const
     os << "d_project_name = " << d_project_name << std::endl;
     os << "d_dim = " << d_dim.getValue() << std::endl;
     os << "d_grid_geometry = " << d_grid_geometry.get() << std::endl;
+    os << "Variant of kernels selected by CPU dispatch = " << CPU_DISPATCH::getSelectedVariant() << std::endl;
     
     // Print all characteristics of d_flow_model.
     d_flow_model_manager->printClassData(os);
@@ -3003,3 +3175,91 @@ void Euler::getFromRestart()
         d_multiresolution_tagger_db = db->getDatabase("d_multiresolution_tagger_db");
     }
 }
+
+
+/*
+ * Create the first worker for the patch operations. It uses the objects owned by the managers. The
+ * workers of the other OpenMP threads are only created by setupConcurrentPatchOperations().
+ */
+void
+Euler::setupWorkers()
+{
+    d_worker_flow_models.push_back(d_flow_model);
+    d_worker_convective_flux_reconstructors.push_back(d_convective_flux_reconstructor);
+}
+
+
+/*
+ * Create one more worker for each of the other OpenMP threads if the convective flux reconstructor
+ * supports concurrent patch operations. This is only called by the level integrator when the patch
+ * loops are shared among threads.
+ */
+void
+Euler::setupConcurrentPatchOperations()
+{
+    if (d_supports_concurrent_patch_operations)
+    {
+        return;
+    }
+    
+    d_supports_concurrent_patch_operations = true;
+    
+#ifdef _OPENMP
+    const int num_workers = omp_get_max_threads();
+    
+    if (num_workers > 1)
+    {
+        if (!d_convective_flux_reconstructor->supportsConcurrentPatchOperations())
+        {
+            d_supports_concurrent_patch_operations = false;
+            
+            return;
+        }
+        
+        for (int wi = 1; wi < num_workers; wi++)
+        {
+            HAMERS_SHARED_PTR<FlowModel> worker_flow_model = d_flow_model->createWorkerFlowModel();
+            
+            ConvectiveFluxReconstructorManager worker_convective_flux_reconstructor_manager(
+                "d_convective_flux_reconstructor_manager",
+                d_dim,
+                d_grid_geometry,
+                worker_flow_model->getNumberOfEquations(),
+                d_flow_model_manager->getFlowModelType(),
+                worker_flow_model,
+                d_convective_flux_reconstructor_db,
+                d_convective_flux_reconstructor_str);
+            
+            d_worker_flow_models.push_back(worker_flow_model);
+            d_worker_convective_flux_reconstructors.push_back(
+                worker_convective_flux_reconstructor_manager.getConvectiveFluxReconstructor());
+        }
+    }
+#endif
+}
+
+
+/*
+ * Get the index of the worker used by the calling thread.
+ */
+int
+Euler::getWorkerIndex() const
+{
+#ifdef _OPENMP
+    const int wi = omp_get_thread_num();
+    
+    if (wi >= static_cast<int>(d_worker_flow_models.size()))
+    {
+        TBOX_ERROR(d_object_name
+            << ": Euler::getWorkerIndex()\n"
+            << "No worker is created for thread "
+            << wi
+            << "."
+            << std::endl);
+    }
+    
+    return wi;
+#else
+    return 0;
+#endif
+}
@@ -1,11 +1,14 @@
 #include "apps/Navier-Stokes/NavierStokes.hpp"
 
+#include "util/CPUDispatch.hpp"
+
 #include "SAMRAI/geom/CartesianPatchGeometry.h"
 #include "SAMRAI/hier/BoxContainer.h"
 #include "SAMRAI/hier/Index.h"
 #include "SAMRAI/hier/PatchDataRestartManager.h"
 #include "SAMRAI/hier/VariableDatabase.h"
 #include "SAMRAI/math/HierarchyCellDataOpsReal.h"
+#include "SAMRAI/mesh/CascadePartitioner.h"
 #include "SAMRAI/mesh/TreeLoadBalancer.h"
 #include "SAMRAI/pdat/CellData.h"
 #include "SAMRAI/pdat/CellIndex.h"
@@ -27,6 +30,10 @@
 #include <iomanip>
 #include <iostream>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifndef LACKS_SSTREAM
 #ifndef included_sstream
 #define included_sstream
@@ -63,7 +70,8 @@ NavierStokes::NavierStokes(
         d_stat_dump_filename(stat_dump_filename),
         d_use_nonuniform_workload(false),
         d_use_conservative_form_diffusive_flux(true),
-        d_Navier_Stokes_boundary_conditions_db_is_from_restart(false)
+        d_Navier_Stokes_boundary_conditions_db_is_from_restart(false),
+        d_supports_concurrent_patch_operations(false)
 {
     TBOX_ASSERT(!object_name.empty());
     TBOX_ASSERT(input_db);
@@ -174,6 +182,13 @@ NavierStokes::NavierStokes(
                 getNonconservativeDiffusiveFluxDivergenceOperator();
     }
     
+    /*
+     * Create the first worker of the patch operations. The workers of the other threads are only
+     * created if the level integrator shares its patch loops among threads.
+     */
+    
+    setupWorkers();
+    
     /*
      * Initialize d_Navier_Stokes_initial_conditions.
      */
@@ -519,11 +534,15 @@ NavierStokes::setupLoadBalancer(
     
     if (d_use_nonuniform_workload && gridding_algorithm)
     {
-        HAMERS_SHARED_PTR<mesh::TreeLoadBalancer> load_balancer(
+        HAMERS_SHARED_PTR<mesh::TreeLoadBalancer> tree_load_balancer(
             HAMERS_DYNAMIC_POINTER_CAST<mesh::TreeLoadBalancer, mesh::LoadBalanceStrategy>(
                 gridding_algorithm->getLoadBalanceStrategy()));
         
-        if (load_balancer)
+        HAMERS_SHARED_PTR<mesh::CascadePartitioner> cascade_partitioner(
+            HAMERS_DYNAMIC_POINTER_CAST<mesh::CascadePartitioner, mesh::LoadBalanceStrategy>(
+                gridding_algorithm->getLoadBalanceStrategy()));
+        
+        if (tree_load_balancer || cascade_partitioner)
         {
             d_workload_variable.reset(new pdat::CellVariable<double>(
                 d_dim,
@@ -533,8 +552,20 @@ NavierStokes::setupLoadBalancer(
                 d_workload_variable,
                 vardb->getContext("WORKLOAD"),
                 zero_vec);
-            load_balancer->setWorkloadPatchDataIndex(d_workload_data_id);
+            if (tree_load_balancer)
+            {
+                tree_load_balancer->setWorkloadPatchDataIndex(d_workload_data_id);
+            }
+            else
+            {
+                cascade_partitioner->setWorkloadPatchDataIndex(d_workload_data_id);
+            }
             pdrm->registerPatchDataForRestart(d_workload_data_id);
+            
+            d_workload_measurer.reset(new PatchWorkloadMeasurer(
+                "d_workload_measurer",
+                d_dim,
+                d_workload_data_id));
         }
         else
         {
@@ -584,6 +615,8 @@ NavierStokes::initializeDataOnPatch(
             HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
                 patch.getPatchData(d_workload_data_id)));
         TBOX_ASSERT(workload_data);
+        
+        // The cost of the cells is taken as uniform until it is measured when the level is advanced.
         workload_data->fillAll(1.0);
     }
 
@@ -597,7 +630,15 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
     const bool initial_time,
     const double dt_time)
 {
-    t_compute_dt->start();
+    const int wi = getWorkerIndex();
+    
+    // The timers are not thread-safe and only the first worker is timed.
+    if (wi == 0)
+    {
+        t_compute_dt->start();
+    }
+    
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model = d_worker_flow_models[wi];
     
     std::vector<double> spectral_radiuses_and_dt;
     
@@ -632,14 +673,14 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+        flow_model->registerPatchWithDataContext(patch, getDataContext());
         
-        hier::IntVector num_ghosts = d_flow_model->getNumberOfGhostCells();
+        hier::IntVector num_ghosts = flow_model->getNumberOfGhostCells();
         
-        d_flow_model->setupSourceUtilities();
+        flow_model->setupSourceUtilities();
         
         HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-            d_flow_model->getFlowModelSourceUtilities();
+            flow_model->getFlowModelSourceUtilities();
         
         std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         num_subghosts_of_data.insert(
@@ -649,21 +690,21 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
             std::pair<std::string, hier::IntVector>(
                 "MAX_DIFFUSIVITY", num_ghosts));
         
-        d_flow_model->registerDerivedVariables(num_subghosts_of_data);
+        flow_model->registerDerivedVariables(num_subghosts_of_data);
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->registerDerivedVariablesForSourceTermsStableDt(hier::IntVector::getZero(d_dim));
         }
         
-        d_flow_model->allocateMemoryForDerivedCellData();
+        flow_model->allocateMemoryForDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->allocateMemoryForDerivedCellData();
         }
         
-        d_flow_model->computeDerivedCellData();
+        flow_model->computeDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
@@ -675,8 +716,8 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
          */
         
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = d_flow_model->getCellData("MAX_WAVE_SPEED_X");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_diffusivity = d_flow_model->getCellData("MAX_DIFFUSIVITY");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = flow_model->getCellData("MAX_WAVE_SPEED_X");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_diffusivity = flow_model->getCellData("MAX_DIFFUSIVITY");
         
         hier::IntVector num_subghosts_max_wave_speed_x = max_wave_speed_x->getGhostCellWidth();
         hier::IntVector num_subghosts_max_diffusivity = max_diffusivity->getGhostCellWidth();
@@ -741,7 +782,7 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
     }
     else if (d_dim == tbox::Dimension(2))
     {
@@ -762,18 +803,18 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+        flow_model->registerPatchWithDataContext(patch, getDataContext());
         
-        hier::IntVector num_ghosts = d_flow_model->getNumberOfGhostCells();
+        hier::IntVector num_ghosts = flow_model->getNumberOfGhostCells();
         
         hier::Box ghost_box = interior_box;
         ghost_box.grow(num_ghosts);
         const hier::IntVector ghostcell_dims = ghost_box.numberCells();
         
-        d_flow_model->setupSourceUtilities();
+        flow_model->setupSourceUtilities();
         
         HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-            d_flow_model->getFlowModelSourceUtilities();
+            flow_model->getFlowModelSourceUtilities();
         
         std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         num_subghosts_of_data.insert(
@@ -786,21 +827,21 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
             std::pair<std::string, hier::IntVector>(
                 "MAX_DIFFUSIVITY", num_ghosts));
         
-        d_flow_model->registerDerivedVariables(num_subghosts_of_data);
+        flow_model->registerDerivedVariables(num_subghosts_of_data);
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->registerDerivedVariablesForSourceTermsStableDt(hier::IntVector::getZero(d_dim));
         }
         
-        d_flow_model->allocateMemoryForDerivedCellData();
+        flow_model->allocateMemoryForDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->allocateMemoryForDerivedCellData();
         }
         
-        d_flow_model->computeDerivedCellData();
+        flow_model->computeDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
@@ -812,9 +853,9 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
          */
         
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = d_flow_model->getCellData("MAX_WAVE_SPEED_X");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = d_flow_model->getCellData("MAX_WAVE_SPEED_Y");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_diffusivity = d_flow_model->getCellData("MAX_DIFFUSIVITY");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = flow_model->getCellData("MAX_WAVE_SPEED_X");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = flow_model->getCellData("MAX_WAVE_SPEED_Y");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_diffusivity = flow_model->getCellData("MAX_DIFFUSIVITY");
         
         hier::IntVector num_subghosts_max_wave_speed_x = max_wave_speed_x->getGhostCellWidth();
         hier::IntVector num_subghosts_max_wave_speed_y = max_wave_speed_y->getGhostCellWidth();
@@ -903,7 +944,7 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
     }
     else if (d_dim == tbox::Dimension(3))
     {
@@ -926,18 +967,18 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * compute the corresponding cell data.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+        flow_model->registerPatchWithDataContext(patch, getDataContext());
         
-        hier::IntVector num_ghosts = d_flow_model->getNumberOfGhostCells();
+        hier::IntVector num_ghosts = flow_model->getNumberOfGhostCells();
         
         hier::Box ghost_box = interior_box;
         ghost_box.grow(num_ghosts);
         const hier::IntVector ghostcell_dims = ghost_box.numberCells();
         
-        d_flow_model->setupSourceUtilities();
+        flow_model->setupSourceUtilities();
         
         HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-            d_flow_model->getFlowModelSourceUtilities();
+            flow_model->getFlowModelSourceUtilities();
         
         std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
         num_subghosts_of_data.insert(
@@ -953,21 +994,21 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
             std::pair<std::string, hier::IntVector>(
                 "MAX_DIFFUSIVITY", num_ghosts));
         
-        d_flow_model->registerDerivedVariables(num_subghosts_of_data);
+        flow_model->registerDerivedVariables(num_subghosts_of_data);
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->registerDerivedVariablesForSourceTermsStableDt(hier::IntVector::getZero(d_dim));
         }
         
-        d_flow_model->allocateMemoryForDerivedCellData();
+        flow_model->allocateMemoryForDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
             source_utilities->allocateMemoryForDerivedCellData();
         }
         
-        d_flow_model->computeDerivedCellData();
+        flow_model->computeDerivedCellData();
         
         if (source_utilities->hasSourceTerms())
         {
@@ -979,10 +1020,10 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
          */
         
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = d_flow_model->getCellData("MAX_WAVE_SPEED_X");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = d_flow_model->getCellData("MAX_WAVE_SPEED_Y");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_z = d_flow_model->getCellData("MAX_WAVE_SPEED_Z");
-        HAMERS_SHARED_PTR<pdat::CellData<double> > max_diffusivity = d_flow_model->getCellData("MAX_DIFFUSIVITY");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_x = flow_model->getCellData("MAX_WAVE_SPEED_X");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_y = flow_model->getCellData("MAX_WAVE_SPEED_Y");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_wave_speed_z = flow_model->getCellData("MAX_WAVE_SPEED_Z");
+        HAMERS_SHARED_PTR<pdat::CellData<double> > max_diffusivity = flow_model->getCellData("MAX_DIFFUSIVITY");
         
         hier::IntVector num_subghosts_max_wave_speed_x = max_wave_speed_x->getGhostCellWidth();
         hier::IntVector num_subghosts_max_wave_speed_y = max_wave_speed_y->getGhostCellWidth();
@@ -1095,10 +1136,13 @@ NavierStokes::computeSpectralRadiusesAndStableDtOnPatch(
          * Unregister the patch and data of all registered derived cell variables in the flow model.
          */
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
     }
     
-    t_compute_dt->stop();
+    if (wi == 0)
+    {
+        t_compute_dt->stop();
+    }
     
     return spectral_radiuses_and_dt;
 }
@@ -1112,7 +1156,30 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
     const int RK_step_number,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    t_compute_fluxes_sources->start();
+    const int wi = getWorkerIndex();
+    
+    // The timers are not thread-safe and only the first worker is timed.
+    if (wi == 0)
+    {
+        t_compute_fluxes_sources->start();
+    }
+    
+    const bool is_measuring_workload = d_workload_measurer && d_workload_measurer->isMeasuring();
+    
+    double workload_start_time = 0.0;
+    if (is_measuring_workload)
+    {
+        workload_start_time = tbox::SAMRAI_MPI::Wtime();
+    }
+    
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model = d_worker_flow_models[wi];
+    const HAMERS_SHARED_PTR<ConvectiveFluxReconstructor>& convective_flux_reconstructor =
+        d_worker_convective_flux_reconstructors[wi];
+    const HAMERS_SHARED_PTR<DiffusiveFluxReconstructor>& diffusive_flux_reconstructor =
+        d_worker_diffusive_flux_reconstructors[wi];
+    const HAMERS_SHARED_PTR<NonconservativeDiffusiveFluxDivergenceOperator>&
+        nonconservative_diffusive_flux_divergence_operator =
+            d_worker_nonconservative_diffusive_flux_divergence_operators[wi];
     
     /*
      * Set zero for the source.
@@ -1135,13 +1202,20 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
         data_source->fillAll(0.0);
     }
     
+    /*
+     * Cache the derived cell data of the flow model such that the derived cell data shared by the
+     * convective flux, diffusive flux and source terms is only computed once on the patch.
+     */
+    
+    flow_model->startCachingDerivedCellData();
+    
     /*
      * Compute the convective flux, source due to splitting of convective term and diffusive flux.
      */
     
     if (data_context)
     {
-        d_convective_flux_reconstructor->computeConvectiveFluxAndSourceOnPatch(
+        convective_flux_reconstructor->computeConvectiveFluxAndSourceOnPatch(
             patch,
             d_variable_convective_flux,
             d_variable_source,
@@ -1152,7 +1226,7 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
         
         if (d_use_conservative_form_diffusive_flux)
         {
-            d_diffusive_flux_reconstructor->computeDiffusiveFluxOnPatch(
+            diffusive_flux_reconstructor->computeDiffusiveFluxOnPatch(
                 patch,
                 d_variable_diffusive_flux,
                 data_context,
@@ -1162,7 +1236,7 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
         }
         else
         {
-            d_nonconservative_diffusive_flux_divergence_operator->
+            nonconservative_diffusive_flux_divergence_operator->
                 computeNonconservativeDiffusiveFluxDivergenceOnPatch(
                     patch,
                     d_variable_diffusive_flux_divergence,
@@ -1174,7 +1248,7 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
     }
     else
     {
-        d_convective_flux_reconstructor->computeConvectiveFluxAndSourceOnPatch(
+        convective_flux_reconstructor->computeConvectiveFluxAndSourceOnPatch(
             patch,
             d_variable_convective_flux,
             d_variable_source,
@@ -1185,7 +1259,7 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
         
         if (d_use_conservative_form_diffusive_flux)
         {
-            d_diffusive_flux_reconstructor->computeDiffusiveFluxOnPatch(
+            diffusive_flux_reconstructor->computeDiffusiveFluxOnPatch(
                 patch,
                 d_variable_diffusive_flux,
                 getDataContext(),
@@ -1195,7 +1269,7 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
         }
         else
         {
-            d_nonconservative_diffusive_flux_divergence_operator->
+            nonconservative_diffusive_flux_divergence_operator->
                 computeNonconservativeDiffusiveFluxDivergenceOnPatch(
                     patch,
                     d_variable_diffusive_flux_divergence,
@@ -1210,20 +1284,20 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
      * Compute the source terms.
      */
     
-    d_flow_model->setupSourceUtilities();
+    flow_model->setupSourceUtilities();
     
     HAMERS_SHARED_PTR<FlowModelSourceUtilities> source_utilities =
-        d_flow_model->getFlowModelSourceUtilities();
+        flow_model->getFlowModelSourceUtilities();
     
     if (source_utilities->hasSourceTerms())
     {
         if (data_context)
         {
-            d_flow_model->registerPatchWithDataContext(patch, data_context);
+            flow_model->registerPatchWithDataContext(patch, data_context);
         }
         else
         {
-            d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+            flow_model->registerPatchWithDataContext(patch, getDataContext());
         }
         
         source_utilities->registerDerivedVariablesForSourceTerms(hier::IntVector::getZero(d_dim));
@@ -1238,10 +1312,28 @@ NavierStokes::computeFluxesAndSourcesOnPatch(
             dt,
             RK_step_number);
         
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
+    }
+    
+    flow_model->stopCachingDerivedCellData();
+    
+    /*
+     * Add the measured cost of the fluxes and sources to the workload. The patches near shocks and
+     * the patches with active source terms are more costly than the smooth patches.
+     */
+    
+    if (is_measuring_workload)
+    {
+        d_workload_measurer->addCostToWorkload(
+            patch,
+            hier::BoxContainer(patch.getBox()),
+            tbox::SAMRAI_MPI::Wtime() - workload_start_time);
     }
     
-    t_compute_fluxes_sources->stop();
+    if (wi == 0)
+    {
+        t_compute_fluxes_sources->stop();
+    }
 }
 
 
@@ -1258,7 +1350,15 @@ NavierStokes::advanceSingleStepOnPatch(
     NULL_USE(time);
     NULL_USE(dt);
     
-    t_advance_step->start();
+    const int wi = getWorkerIndex();
+    
+    // The timers are not thread-safe and only the first worker is timed.
+    if (wi == 0)
+    {
+        t_advance_step->start();
+    }
+    
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model = d_worker_flow_models[wi];
     
     const HAMERS_SHARED_PTR<geom::CartesianPatchGeometry> patch_geom(
         HAMERS_SHARED_PTR_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
@@ -1279,19 +1379,19 @@ NavierStokes::advanceSingleStepOnPatch(
      * The numbers of ghost cells and the dimensions of the ghost cell boxes are also determined.
      */
     
-    d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+    flow_model->registerPatchWithDataContext(patch, getDataContext());
     
     std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > conservative_variables =
-        d_flow_model->getCellDataOfConservativeVariables();
+        flow_model->getCellDataOfConservativeVariables();
     
     std::vector<hier::IntVector> num_ghosts_conservative_var;
-    num_ghosts_conservative_var.reserve(d_flow_model->getNumberOfEquations());
+    num_ghosts_conservative_var.reserve(flow_model->getNumberOfEquations());
     
     std::vector<hier::IntVector> ghostcell_dims_conservative_var;
-    ghostcell_dims_conservative_var.reserve(d_flow_model->getNumberOfEquations());
+    ghostcell_dims_conservative_var.reserve(flow_model->getNumberOfEquations());
     
     std::vector<double*> Q;
-    Q.reserve(d_flow_model->getNumberOfEquations());
+    Q.reserve(flow_model->getNumberOfEquations());
     
     int count_eqn = 0;
     
@@ -1303,7 +1403,7 @@ NavierStokes::advanceSingleStepOnPatch(
         {
             // If the last element of the conservative variable vector is not in the system of
             // equations, ignore it.
-            if (count_eqn >= d_flow_model->getNumberOfEquations())
+            if (count_eqn >= flow_model->getNumberOfEquations())
                 break;
             
             Q.push_back(conservative_variables[vi]->getPointer(di));
@@ -1314,10 +1414,10 @@ NavierStokes::advanceSingleStepOnPatch(
         }
     }
     
-    d_flow_model->fillCellDataOfConservativeVariablesWithZero();
+    flow_model->fillCellDataOfConservativeVariablesWithZero();
     
     // Unregister the patch.
-    d_flow_model->unregisterPatch();
+    flow_model->unregisterPatch();
     
     /*
      * Use alpha, beta and gamma values to update the time-dependent solution,
@@ -1429,19 +1529,19 @@ NavierStokes::advanceSingleStepOnPatch(
          * current intermediate data context.
          */
         
-        d_flow_model->registerPatchWithDataContext(patch, intermediate_context[n]);
+        flow_model->registerPatchWithDataContext(patch, intermediate_context[n]);
         
         std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > conservative_variables_intermediate =
-            d_flow_model->getCellDataOfConservativeVariables();
+            flow_model->getCellDataOfConservativeVariables();
         
         std::vector<hier::IntVector> num_ghosts_conservative_var_intermediate;
-        num_ghosts_conservative_var_intermediate.reserve(d_flow_model->getNumberOfEquations());
+        num_ghosts_conservative_var_intermediate.reserve(flow_model->getNumberOfEquations());
         
         std::vector<hier::IntVector> ghostcell_dims_conservative_var_intermediate;
-        ghostcell_dims_conservative_var_intermediate.reserve(d_flow_model->getNumberOfEquations());
+        ghostcell_dims_conservative_var_intermediate.reserve(flow_model->getNumberOfEquations());
         
         std::vector<double*> Q_intermediate;
-        Q_intermediate.reserve(d_flow_model->getNumberOfEquations());
+        Q_intermediate.reserve(flow_model->getNumberOfEquations());
         
         count_eqn = 0;
         
@@ -1453,7 +1553,7 @@ NavierStokes::advanceSingleStepOnPatch(
             {
                 // If the last element of the conservative variable vector is not in the system of
                 // equations, ignore it.
-                if (count_eqn >= d_flow_model->getNumberOfEquations())
+                if (count_eqn >= flow_model->getNumberOfEquations())
                     break;
                 
                 Q_intermediate.push_back(conservative_variables_intermediate[vi]->getPointer(di));
@@ -1467,7 +1567,7 @@ NavierStokes::advanceSingleStepOnPatch(
         }
         
         // Unregister the patch.
-        d_flow_model->unregisterPatch();
+        flow_model->unregisterPatch();
         
         if (d_dim == tbox::Dimension(1))
         {
@@ -1481,7 +1581,7 @@ NavierStokes::advanceSingleStepOnPatch(
             
             if (alpha[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     const int num_ghosts_0_conservative_var = num_ghosts_conservative_var[ei][0];
                     const int num_ghosts_0_conservative_var_intermediate =
@@ -1505,7 +1605,7 @@ NavierStokes::advanceSingleStepOnPatch(
             {
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                         double* F_d_x_intermediate = diffusive_flux_intermediate->getPointer(0, ei);
@@ -1532,7 +1632,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                         double* nabla_F_d_intermediate = diffusive_flux_divergence_intermediate->getPointer(ei);
@@ -1564,7 +1664,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 // Accumulate the flux in the x direction.
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x = convective_flux->getPointer(0, ei);
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -1587,7 +1687,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x = convective_flux->getPointer(0, ei);
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -1608,7 +1708,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 // Accumulate the source terms.
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* S = source->getPointer(ei);
                         double* S_intermediate = source_intermediate->getPointer(ei);
@@ -1627,7 +1727,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* nabla_F_d = diffusive_flux_divergence->getPointer(ei);
                         double* nabla_F_d_intermediate = diffusive_flux_divergence_intermediate->getPointer(ei);
@@ -1664,7 +1764,7 @@ NavierStokes::advanceSingleStepOnPatch(
             
             if (alpha[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     const int num_ghosts_0_conservative_var = num_ghosts_conservative_var[ei][0];
                     const int num_ghosts_1_conservative_var = num_ghosts_conservative_var[ei][1];
@@ -1702,7 +1802,7 @@ NavierStokes::advanceSingleStepOnPatch(
             {
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1752,7 +1852,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1805,7 +1905,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 // Accumulate the flux in the x direction.
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x = convective_flux->getPointer(0, ei);
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -1831,7 +1931,7 @@ NavierStokes::advanceSingleStepOnPatch(
                     }
                     
                     // Accumulate the flux in the y direction.
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_y = convective_flux->getPointer(1, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1858,7 +1958,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x = convective_flux->getPointer(0, ei);
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -1880,7 +1980,7 @@ NavierStokes::advanceSingleStepOnPatch(
                     }
                     
                     // Accumulate the flux in the y direction.
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_y = convective_flux->getPointer(1, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -1905,7 +2005,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 // Accumulate the source.
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* S = source->getPointer(ei);
                         double* S_intermediate = source_intermediate->getPointer(ei);
@@ -1928,7 +2028,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* nabla_F_d = diffusive_flux_divergence->getPointer(ei);
                         double* nabla_F_d_intermediate = diffusive_flux_divergence_intermediate->getPointer(ei);
@@ -1971,7 +2071,7 @@ NavierStokes::advanceSingleStepOnPatch(
             
             if (alpha[n] != 0.0)
             {
-                for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                 {
                     const int num_ghosts_0_conservative_var = num_ghosts_conservative_var[ei][0];
                     const int num_ghosts_1_conservative_var = num_ghosts_conservative_var[ei][1];
@@ -2023,7 +2123,7 @@ NavierStokes::advanceSingleStepOnPatch(
             {
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -2097,7 +2197,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -2172,7 +2272,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 // Accumulate the flux in the x direction.
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x = convective_flux->getPointer(0, ei);
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -2202,7 +2302,7 @@ NavierStokes::advanceSingleStepOnPatch(
                     }
                     
                     // Accumulate the flux in the y direction.
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_y = convective_flux->getPointer(1, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -2232,7 +2332,7 @@ NavierStokes::advanceSingleStepOnPatch(
                     }
                     
                     // Accumulate the flux in the z direction.
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_z = convective_flux->getPointer(2, ei);
                         double* F_c_z_intermediate = convective_flux_intermediate->getPointer(2, ei);
@@ -2263,7 +2363,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_x = convective_flux->getPointer(0, ei);
                         double* F_c_x_intermediate = convective_flux_intermediate->getPointer(0, ei);
@@ -2289,7 +2389,7 @@ NavierStokes::advanceSingleStepOnPatch(
                     }
                     
                     // Accumulate the flux in the y direction.
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_y = convective_flux->getPointer(1, ei);
                         double* F_c_y_intermediate = convective_flux_intermediate->getPointer(1, ei);
@@ -2315,7 +2415,7 @@ NavierStokes::advanceSingleStepOnPatch(
                     }
                     
                     // Accumulate the flux in the z direction.
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* F_c_z = convective_flux->getPointer(2, ei);
                         double* F_c_z_intermediate = convective_flux_intermediate->getPointer(2, ei);
@@ -2344,7 +2444,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 // Accumulate the source.
                 if (d_use_conservative_form_diffusive_flux)
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* S = source->getPointer(ei);
                         double* S_intermediate = source_intermediate->getPointer(ei);
@@ -2371,7 +2471,7 @@ NavierStokes::advanceSingleStepOnPatch(
                 }
                 else
                 {
-                    for (int ei = 0; ei < d_flow_model->getNumberOfEquations(); ei++)
+                    for (int ei = 0; ei < flow_model->getNumberOfEquations(); ei++)
                     {
                         double* nabla_F_d = diffusive_flux_divergence->getPointer(ei);
                         double* nabla_F_d_intermediate = diffusive_flux_divergence_intermediate->getPointer(ei);
@@ -2409,15 +2509,18 @@ NavierStokes::advanceSingleStepOnPatch(
         
         if (beta[n] != 0.0)
         {
-            d_flow_model->registerPatchWithDataContext(patch, getDataContext());
+            flow_model->registerPatchWithDataContext(patch, getDataContext());
             
-            d_flow_model->updateCellDataOfConservativeVariables();
+            flow_model->updateCellDataOfConservativeVariables();
             
-            d_flow_model->unregisterPatch();
+            flow_model->unregisterPatch();
         }
     }
     
-    t_advance_step->stop();
+    if (wi == 0)
+    {
+        t_advance_step->stop();
+    }
 }
 
 
@@ -2928,6 +3031,58 @@ NavierStokes::preprocessTagCellsValueDetector(
 }
 
 
+/*
+ * Reset the workload on the patches of the level and start measuring the cost of the patch operations
+ * before the ghost cells are filled to advance the level. The workload is only measured when the level is
+ * advanced to integrate the data on the hierarchy.
+ */
+void
+NavierStokes::preprocessFillBoundaryDataBeforeAdvance(
+    const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+    double current_time,
+    double dt,
+    bool first_step,
+    bool last_step,
+    bool regrid_advance)
+{
+    NULL_USE(current_time);
+    NULL_USE(dt);
+    NULL_USE(first_step);
+    NULL_USE(last_step);
+    
+    if (d_workload_measurer && !regrid_advance)
+    {
+        d_workload_measurer->startMeasuringOnLevel(level);
+    }
+}
+
+
+/*
+ * Stop measuring the cost of the patch operations and scale the workload measured while the level was
+ * advanced such that the mean cost of the cells on the level is one.
+ */
+void
+NavierStokes::postprocessAdvanceLevelState(
+    const HAMERS_SHARED_PTR<hier::PatchLevel>& level,
+    double current_time,
+    double dt,
+    bool first_step,
+    bool last_step,
+    bool regrid_advance)
+{
+    NULL_USE(current_time);
+    NULL_USE(dt);
+    NULL_USE(first_step);
+    NULL_USE(last_step);
+    NULL_USE(regrid_advance);
+    
+    if (d_workload_measurer)
+    {
+        d_workload_measurer->finishMeasuringOnLevel(level);
+    }
+}
+
+
 /*
  * Tag cells for refinement using value detector.
  */
@@ -3179,12 +3334,33 @@ NavierStokes::setPhysicalBoundaryConditions(
 {
     t_setphysbcs->start();
     
+    const bool is_measuring_workload = d_workload_measurer && d_workload_measurer->isMeasuring();
+    
+    double workload_start_time = 0.0;
+    if (is_measuring_workload)
+    {
+        workload_start_time = tbox::SAMRAI_MPI::Wtime();
+    }
+    
     d_Navier_Stokes_boundary_conditions->setPhysicalBoundaryConditions(
         patch,
         fill_time,
         ghost_width_to_fill,
         getDataContext());
     
+    /*
+     * Add the measured cost of the boundary fill to the workload. The cost is put on the interior
+     * cells within the ghost cell width from the physical boundaries.
+     */
+    
+    if (is_measuring_workload)
+    {
+        d_workload_measurer->addPhysicalBoundaryFillCostToWorkload(
+            patch,
+            ghost_width_to_fill,
+            tbox::SAMRAI_MPI::Wtime() - workload_start_time);
+    }
+    
     t_setphysbcs->stop();
 }
 
@@ -3310,6 +3486,7 @@ void NavierStokes::printClassData(std::ostream& os) const
     os << "d_project_name = " << d_project_name << std::endl;
     os << "d_dim = " << d_dim.getValue() << std::endl;
     os << "d_grid_geometry = " << d_grid_geometry.get() << std::endl;
+    os << "Variant of kernels selected by CPU dispatch = " << CPU_DISPATCH::getSelectedVariant() << std::endl;
     
     // Print all characteristics of d_flow_model.
     d_flow_model_manager->printClassData(os);
@@ -3722,6 +3899,17 @@ NavierStokes::outputDataStatistics(
 }
 
 
+/**
+ * Return whether the output of the statistics of data computed last can be deferred until after the
+ * next time step.
+ */
+bool
+NavierStokes::canDeferOutputDataStatistics() const
+{
+    return d_flow_model->getFlowModelStatisticsUtilities()->canDeferOutputOfStatisticalQuantities();
+}
+
+
 /**
  * Get object of storing ensemble statistics.
  */
@@ -4068,3 +4256,129 @@ void NavierStokes::getFromRestart()
         d_multiresolution_tagger_db = db->getDatabase("d_multiresolution_tagger_db");
     }
 }
+
+
+/*
+ * Create the first worker for the patch operations. It uses the objects owned by the managers. The
+ * workers of the other OpenMP threads are only created by setupConcurrentPatchOperations().
+ */
+void
+NavierStokes::setupWorkers()
+{
+    d_worker_flow_models.push_back(d_flow_model);
+    d_worker_convective_flux_reconstructors.push_back(d_convective_flux_reconstructor);
+    d_worker_diffusive_flux_reconstructors.push_back(d_diffusive_flux_reconstructor);
+    d_worker_nonconservative_diffusive_flux_divergence_operators.push_back(
+        d_nonconservative_diffusive_flux_divergence_operator);
+}
+
+
+/*
+ * Create one more worker for each of the other OpenMP threads if the convective flux reconstructor
+ * supports concurrent patch operations. This is only called by the level integrator when the patch
+ * loops are shared among threads.
+ */
+void
+NavierStokes::setupConcurrentPatchOperations()
+{
+    if (d_supports_concurrent_patch_operations)
+    {
+        return;
+    }
+    
+    d_supports_concurrent_patch_operations = true;
+    
+#ifdef _OPENMP
+    const int num_workers = omp_get_max_threads();
+    
+    if (num_workers > 1)
+    {
+        if (!d_convective_flux_reconstructor->supportsConcurrentPatchOperations())
+        {
+            d_supports_concurrent_patch_operations = false;
+            
+            return;
+        }
+        
+        for (int wi = 1; wi < num_workers; wi++)
+        {
+            HAMERS_SHARED_PTR<FlowModel> worker_flow_model = d_flow_model->createWorkerFlowModel();
+            
+            ConvectiveFluxReconstructorManager worker_convective_flux_reconstructor_manager(
+                "d_convective_flux_reconstructor_manager",
+                d_dim,
+                d_grid_geometry,
+                worker_flow_model->getNumberOfEquations(),
+                d_flow_model_manager->getFlowModelType(),
+                worker_flow_model,
+                d_convective_flux_reconstructor_db,
+                d_convective_flux_reconstructor_str);
+            
+            d_worker_flow_models.push_back(worker_flow_model);
+            d_worker_convective_flux_reconstructors.push_back(
+                worker_convective_flux_reconstructor_manager.getConvectiveFluxReconstructor());
+            
+            if (d_use_conservative_form_diffusive_flux)
+            {
+                DiffusiveFluxReconstructorManager worker_diffusive_flux_reconstructor_manager(
+                    "d_diffusive_flux_reconstructor_manager",
+                    d_dim,
+                    d_grid_geometry,
+                    worker_flow_model->getNumberOfEquations(),
+                    worker_flow_model,
+                    d_diffusive_flux_reconstructor_db,
+                    d_diffusive_flux_reconstructor_str);
+                
+                d_worker_diffusive_flux_reconstructors.push_back(
+                    worker_diffusive_flux_reconstructor_manager.getDiffusiveFluxReconstructor());
+                d_worker_nonconservative_diffusive_flux_divergence_operators.push_back(
+                    HAMERS_SHARED_PTR<NonconservativeDiffusiveFluxDivergenceOperator>());
+            }
+            else
+            {
+                NonconservativeDiffusiveFluxDivergenceOperatorManager
+                    worker_nonconservative_diffusive_flux_divergence_operator_manager(
+                        "d_nonconservative_diffusive_flux_divergence_operator_manager",
+                        d_dim,
+                        d_grid_geometry,
+                        worker_flow_model->getNumberOfEquations(),
+                        worker_flow_model,
+                        d_nonconservative_diffusive_flux_divergence_operator_db,
+                        d_nonconservative_diffusive_flux_divergence_operator_str);
+                
+                d_worker_diffusive_flux_reconstructors.push_back(
+                    HAMERS_SHARED_PTR<DiffusiveFluxReconstructor>());
+                d_worker_nonconservative_diffusive_flux_divergence_operators.push_back(
+                    worker_nonconservative_diffusive_flux_divergence_operator_manager.
+                        getNonconservativeDiffusiveFluxDivergenceOperator());
+            }
+        }
+    }
+#endif
+}
+
+
+/*
+ * Get the index of the worker used by the calling thread.
+ */
+int
+NavierStokes::getWorkerIndex() const
+{
+#ifdef _OPENMP
+    const int wi = omp_get_thread_num();
+    
+    if (wi >= static_cast<int>(d_worker_flow_models.size()))
+    {
+        TBOX_ERROR(d_object_name
+            << ": NavierStokes::getWorkerIndex()\n"
+            << "No worker is created for thread "
+            << wi
+            << "."
+            << std::endl);
+    }
+    
+    return wi;
+#else
+    return 0;
+#endif
+}
@@ -7,6 +7,7 @@
 #include "apps/Euler/Euler.hpp"
 #include "apps/Navier-Stokes/NavierStokes.hpp"
 #include "extn/visit_data_writer/ExtendedVisItDataWriter.hpp"
+#include "util/scratch_arena/ScratchPatchDataArena.hpp"
 
 // Headers for basic SAMRAI objects
 
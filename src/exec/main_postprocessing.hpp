@@ -444,6 +444,7 @@ void runPostProcessing(
             patch_hierarchy,
             time_integrator->getIntegratorTime(),
             output_statistics);
+        RK_level_integrator->outputDeferredDataStatistics(patch_hierarchy);
         t_write_stat->stop();
     }
     else
@@ -458,6 +459,7 @@ void runPostProcessing(
             patch_hierarchy,
             time_integrator->getIntegratorTime(),
             true);
+        RK_level_integrator->outputDeferredDataStatistics(patch_hierarchy);
         t_write_stat->stop();
     }
     
@@ -53,6 +53,10 @@ void runSimulation(
     std::string visit_dump_dirname = "";
     int visit_dump_directory_name_zero_padding_length = 5;
     int visit_number_procs_per_file = 1;
+    bool visit_use_asynchronous_dumps = false;
+    int visit_max_number_pending_dumps = 1;
+    bool visit_use_parallel_HDF5_single_file = false;
+    int visit_number_io_aggregators = 0;
     
     if (main_db->keyExists("viz_dump_setting"))
     {
@@ -109,6 +113,18 @@ void runSimulation(
         {
             visit_number_procs_per_file = main_db->getInteger("visit_number_procs_per_file");
         }
+        
+        visit_use_asynchronous_dumps =
+            main_db->getBoolWithDefault("visit_use_asynchronous_dumps", false);
+        
+        visit_max_number_pending_dumps =
+            main_db->getIntegerWithDefault("visit_max_number_pending_dumps", 1);
+        
+        visit_use_parallel_HDF5_single_file =
+            main_db->getBoolWithDefault("visit_use_parallel_HDF5_single_file", false);
+        
+        visit_number_io_aggregators =
+            main_db->getIntegerWithDefault("visit_number_io_aggregators", 0);
     }
     
     bool is_stat_dumping = false;
@@ -491,6 +507,14 @@ void runSimulation(
             break;
         }
     }
+    
+    visit_data_writer->setAsynchronousDumps(
+        visit_use_asynchronous_dumps,
+        visit_max_number_pending_dumps);
+    
+    visit_data_writer->setParallelHDF5SingleFile(
+        visit_use_parallel_HDF5_single_file,
+        visit_number_io_aggregators);
 #endif
     
     /*
@@ -673,6 +697,19 @@ void runSimulation(
         // Advance the solution.
         double dt_new = time_integrator->advanceHierarchy(dt_now);
         
+        /*
+         * Output the statistics deferred at the last dump now that their reductions could overlap
+         * with the time step.
+         */
+        if (is_stat_dumping)
+        {
+            t_write_stat->start();
+            
+            RK_level_integrator->outputDeferredDataStatistics(patch_hierarchy);
+            
+            t_write_stat->stop();
+        }
+        
         loop_time += dt_now;
         
         if (!(RK_level_integrator->usingRefinedTimestepping()))
@@ -734,6 +771,8 @@ void runSimulation(
                     {
                         t_write_restart->start();
                         
+                        visit_data_writer->waitForPendingPlotData();
+                        
                         restart_manager->writeRestartFile(restart_write_dirname,
                             iteration_num);
                         
@@ -762,6 +801,8 @@ void runSimulation(
                     {
                         t_write_restart->start();
                         
+                        visit_data_writer->waitForPendingPlotData();
+                        
                         restart_manager->writeRestartFile(restart_write_dirname,
                             iteration_num);
                         
@@ -829,6 +870,14 @@ void runSimulation(
             {
                 t_write_restart->start();
                 
+#ifdef HAVE_HDF5
+                /*
+                 * The pending asynchronous dumps must be written before the restart files since the
+                 * HDF5 library is in general not thread-safe.
+                 */
+                visit_data_writer->waitForPendingPlotData();
+#endif
+                
                 restart_manager->writeRestartFile(restart_write_dirname,
                     iteration_num);
                 
@@ -864,6 +913,8 @@ void runSimulation(
             {
                 t_write_restart->start();
                 
+                visit_data_writer->waitForPendingPlotData();
+                
                 restart_manager->writeRestartFile(restart_write_dirname,
                     iteration_num);
                 
@@ -872,6 +923,12 @@ void runSimulation(
                 tbox::pout << "Files for restart at last time step are written." << std::endl;
             }
         }
+        
+        t_write_viz->start();
+        
+        visit_data_writer->waitForPendingPlotData();
+        
+        t_write_viz->stop();
     }
 #endif
     
@@ -889,6 +946,12 @@ void runSimulation(
             
             tbox::pout << "File of statistics at last time step is updated." << std::endl;
         }
+        
+        t_write_stat->start();
+        
+        RK_level_integrator->outputDeferredDataStatistics(patch_hierarchy);
+        
+        t_write_stat->stop();
     }
     
     tbox::plog << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++";
@@ -919,6 +982,13 @@ void runSimulation(
     
     tbox::TimerManager::getManager()->print(tbox::plog);
     
+    /*
+     * Record and output hit/miss statistics of the arenas of temporary patch data.
+     */
+    
+    ScratchPatchDataArena::recordStatistics();
+    ScratchPatchDataArena::printStatistics(tbox::plog);
+    
     /*
      * At conclusion of simulation, deallocate objects.
      */
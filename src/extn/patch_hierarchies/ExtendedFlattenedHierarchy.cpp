@@ -34,6 +34,7 @@ ExtendedFlattenedHierarchy::ExtendedFlattenedHierarchy(
     
     d_visible_boxes.resize(num_levels);
     d_overlapped_visible_boxes.resize(num_levels);
+    d_overlapped_visible_cell_counts.resize(num_levels);
     
     SAMRAI::hier::LocalId local_id(0);
     SAMRAI::hier::LocalId local_id_overlapped(0);
@@ -211,3 +212,80 @@ ExtendedFlattenedHierarchy::ExtendedFlattenedHierarchy(
 ExtendedFlattenedHierarchy::~ExtendedFlattenedHierarchy()
 {
 }
+
+
+/*
+ **************************************************************************
+ * Get the numbers of times that the cells of a given Box are visible. The
+ * mask is built from the overlapped visible boxes of the Box on the first
+ * request.
+ **************************************************************************
+ */
+
+const std::vector<int>&
+ExtendedFlattenedHierarchy::getOverlappedVisibleCellCounts(
+    const SAMRAI::hier::Box& box,
+    int ln) const
+{
+    TBOX_ASSERT(ln <= d_finest_level && ln >= d_coarsest_level);
+    
+    std::map<SAMRAI::hier::BoxId, std::vector<int> >::const_iterator itr =
+        d_overlapped_visible_cell_counts[ln].find(box.getBoxId());
+    
+    if (itr != d_overlapped_visible_cell_counts[ln].end())
+    {
+        return itr->second;
+    }
+    
+    const SAMRAI::hier::BoxContainer& overlapped_visible_boxes = getOverlappedVisibleBoxes(box, ln);
+    
+    std::vector<int>& cell_counts = d_overlapped_visible_cell_counts[ln][box.getBoxId()];
+    cell_counts.resize(static_cast<size_t>(box.size()), 1);
+    
+    const int dim_val = box.getDim().getValue();
+    const SAMRAI::hier::IntVector box_dims = box.numberCells();
+    
+    for (SAMRAI::hier::BoxContainer::const_iterator ib = overlapped_visible_boxes.begin();
+         ib != overlapped_visible_boxes.end();
+         ib++)
+    {
+        const SAMRAI::hier::Box overlapped_box = (*ib)*box;
+        
+        if (overlapped_box.empty())
+        {
+            continue;
+        }
+        
+        /*
+         * Get the ranges of the overlapped box relative to the Box and the strides of the mask. The
+         * unused dimensions have a range of one cell.
+         */
+        
+        int lo[3] = {0, 0, 0};
+        int hi[3] = {0, 0, 0};
+        int stride[3] = {1, 0, 0};
+        
+        for (int di = 0; di < dim_val; di++)
+        {
+            lo[di] = overlapped_box.lower(di) - box.lower(di);
+            hi[di] = overlapped_box.upper(di) - box.lower(di);
+            if (di > 0)
+            {
+                stride[di] = stride[di - 1]*box_dims[di - 1];
+            }
+        }
+        
+        for (int k = lo[2]; k <= hi[2]; k++)
+        {
+            for (int j = lo[1]; j <= hi[1]; j++)
+            {
+                for (int i = lo[0]; i <= hi[0]; i++)
+                {
+                    cell_counts[i*stride[0] + j*stride[1] + k*stride[2]]++;
+                }
+            }
+        }
+    }
+    
+    return cell_counts;
+}
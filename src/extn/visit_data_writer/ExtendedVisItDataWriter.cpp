@@ -22,6 +22,7 @@
 
 #include <cstring>
 #include <ctime>
+#include <sstream>
 #include <vector>
 
 extern "C"
@@ -97,6 +98,7 @@ ExtendedVisItDataWriter::s_initialize_handler(
     SAMRAI::tbox::StartupShutdownManager::priorityTimers);
 
 HAMERS_SHARED_PTR<SAMRAI::tbox::Timer> ExtendedVisItDataWriter::t_write_plot_data;
+HAMERS_SHARED_PTR<SAMRAI::tbox::Timer> ExtendedVisItDataWriter::t_wait_for_pending_plot_data;
 
 /*
  **************************************************************************************************
@@ -157,6 +159,13 @@ ExtendedVisItDataWriter::ExtendedVisItDataWriter(
     d_dump_directory_name_zero_padding_length = dump_directory_name_zero_padding_length;
     
     d_is_multiblock = is_multiblock;
+    
+    d_use_asynchronous_dumps = false;
+    d_max_number_pending_dumps = 1;
+    d_stop_io_thread = false;
+    
+    d_use_parallel_HDF5_single_file = false;
+    d_number_io_aggregators = 0;
 }
 
 
@@ -169,6 +178,11 @@ ExtendedVisItDataWriter::ExtendedVisItDataWriter(
  */
 ExtendedVisItDataWriter::~ExtendedVisItDataWriter()
 {
+    /*
+     * Write all the pending asynchronous dumps before the data writer goes away.
+     */
+    stopIOThread();
+    
     /*
      * De-allocate min/max structs for each variable.
      */
@@ -1527,6 +1541,88 @@ ExtendedVisItDataWriter::writePlotData(
 }
 
 
+/*
+ **************************************************************************************************
+ *
+ * Turn on or off asynchronous dumps.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::setAsynchronousDumps(
+    const bool use_asynchronous_dumps,
+    const int max_number_pending_dumps)
+{
+    TBOX_ASSERT(max_number_pending_dumps > 0);
+    
+    if (use_asynchronous_dumps && d_use_parallel_HDF5_single_file)
+    {
+        TBOX_ERROR("ExtendedVisItDataWriter::setAsynchronousDumps"
+            << "\n    data writer with name " << d_object_name
+            << "\n    Asynchronous dumps cannot be used with the single file written"
+            << " collectively by parallel HDF5." << std::endl);
+    }
+    
+    if (!use_asynchronous_dumps)
+    {
+        stopIOThread();
+    }
+    
+    d_use_asynchronous_dumps = use_asynchronous_dumps;
+    d_max_number_pending_dumps = max_number_pending_dumps;
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Wait until all the pending asynchronous dumps are written.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::waitForPendingPlotData()
+{
+    waitForPendingPlotData(0);
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Turn on or off the single file written collectively by parallel HDF5.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::setParallelHDF5SingleFile(
+    const bool use_parallel_HDF5_single_file,
+    const int number_io_aggregators)
+{
+    TBOX_ASSERT(number_io_aggregators >= 0);
+    
+#ifndef H5_HAVE_PARALLEL
+    if (use_parallel_HDF5_single_file)
+    {
+        TBOX_ERROR("ExtendedVisItDataWriter::setParallelHDF5SingleFile"
+            << "\n    data writer with name " << d_object_name
+            << "\n    The HDF5 library is not built with parallel support." << std::endl);
+    }
+#endif
+    
+    if (use_parallel_HDF5_single_file && d_use_asynchronous_dumps)
+    {
+        TBOX_ERROR("ExtendedVisItDataWriter::setParallelHDF5SingleFile"
+            << "\n    data writer with name " << d_object_name
+            << "\n    The single file written collectively by parallel HDF5 cannot be used with"
+            << " asynchronous dumps." << std::endl);
+    }
+    
+    d_use_parallel_HDF5_single_file = use_parallel_HDF5_single_file;
+    d_number_io_aggregators = number_io_aggregators;
+}
+
+
 /*
  **************************************************************************************************
  *
@@ -1684,8 +1780,19 @@ ExtendedVisItDataWriter::writeHDFFiles(
     {
         d_file_cluster_size = num_procs;
     }
-    d_my_file_cluster_number = my_proc / d_file_cluster_size;
-    d_my_rank_in_file_cluster = my_proc % d_file_cluster_size;
+    
+    /*
+     * All processors share a single file written collectively with parallel HDF5. The file cluster
+     * size from the input is kept for the dumps written without it.
+     */
+    int file_cluster_size = d_file_cluster_size;
+    if (d_use_parallel_HDF5_single_file)
+    {
+        file_cluster_size = num_procs;
+    }
+    
+    d_my_file_cluster_number = my_proc / file_cluster_size;
+    d_my_rank_in_file_cluster = my_proc % file_cluster_size;
     
     if (d_my_rank_in_file_cluster == 0)
     {
@@ -1697,24 +1804,24 @@ ExtendedVisItDataWriter::writeHDFFiles(
     }
     
     d_number_file_clusters = static_cast<int>(ceil(static_cast<double>(num_procs)
-        /static_cast<double>(d_file_cluster_size)));
-    d_number_files_this_file_cluster = d_file_cluster_size;
+        /static_cast<double>(file_cluster_size)));
+    d_number_files_this_file_cluster = file_cluster_size;
     
     if (d_my_file_cluster_number == (d_number_file_clusters - 1))
     {
         // set d_number_files_this_file_cluster for last cluster
-        d_number_files_this_file_cluster = num_procs - (d_file_cluster_size*(static_cast<int>(
-            floor(static_cast<double>(num_procs)/static_cast<double>(d_file_cluster_size)))));
+        d_number_files_this_file_cluster = num_procs - (file_cluster_size*(static_cast<int>(
+            floor(static_cast<double>(num_procs)/static_cast<double>(file_cluster_size)))));
         if (d_number_files_this_file_cluster == 0)
         {
-            d_number_files_this_file_cluster = d_file_cluster_size;
+            d_number_files_this_file_cluster = file_cluster_size;
         }
     }
     
     d_processor_in_file_cluster_number.resize(num_procs);
     for (int i = 0; i < num_procs; ++i)
     {
-        d_processor_in_file_cluster_number[i] = i / d_file_cluster_size;
+        d_processor_in_file_cluster_number[i] = i / file_cluster_size;
     }
     
     sprintf(temp_buf, "%0*d", d_dump_directory_name_zero_padding_length, d_time_step_number);
@@ -1736,54 +1843,93 @@ ExtendedVisItDataWriter::writeHDFFiles(
     
 //#define USE_BATON_BARRIERS
     
-#ifdef USE_BATON_BARRIERS
-    dumpWriteBarrierBegin();
-#endif
+    pendingPlotDataStruct pending_plot_data;
+    
+    if (d_use_asynchronous_dumps || d_use_parallel_HDF5_single_file)
     {
-        // cluster_leader guaranteed to enter this section before anyone else
+        /*
+         * Pack the data of this processor into memory. With asynchronous dumps, it is written to the
+         * processor file by the I/O thread once the summary file is written and the older dumps are
+         * waited for first so that the number of dumps kept in memory is bounded. With a single file,
+         * it is written collectively by all processors.
+         */
+        if (d_use_asynchronous_dumps)
+        {
+            waitForPendingPlotData(d_max_number_pending_dumps - 1);
+        }
+        
         sprintf(temp_buf, "/processor_cluster.%0*d.samrai",
             5,
             d_my_file_cluster_number);
-        std::string database_name(temp_buf);
-        std::string visit_HDFFilename = dump_dirname + database_name;
-        visit_HDFFilePointer = new SAMRAI::tbox::HDFDatabase(database_name);
-        if (d_file_cluster_leader)
-        {
-             // creates the HDF file:
-             //     dirname/visit_dump.000n/processor_cluster.000m.samrai where n is timestep #,
-             //     m is processor number
-             visit_HDFFilePointer->create(visit_HDFFilename);
-        }
-        else
-        {
-            // file already created other procs just need to open it
-            const bool read_write_mode(true);
-            if (!visit_HDFFilePointer->open(visit_HDFFilename, read_write_mode))
-            {
-                TBOX_ERROR("ExtendedVisItDataWriter::writeHDFFiles"
-                    << "\n    data writer with name "
-                    << d_object_name
-                    << "\n    Error attempting to open visit file "
-                    << visit_HDFFilename << std::endl);
-            }
-        }
+        pending_plot_data.file_name = dump_dirname + std::string(temp_buf);
         
-        // create group for this proc
         sprintf(temp_buf, "processor.%0*d", 5, my_proc);
-        HAMERS_SHARED_PTR<SAMRAI::tbox::Database> processor_HDFGroup(
-            visit_HDFFilePointer->putDatabase(std::string(temp_buf)));
-        writeVisItVariablesToHDFFile(processor_HDFGroup,
+        pending_plot_data.processor_group_name = std::string(temp_buf);
+        pending_plot_data.processor_database =
+            HAMERS_MAKE_SHARED<SAMRAI::tbox::MemoryDatabase>(pending_plot_data.processor_group_name);
+        
+        writeVisItVariablesToHDFFile(pending_plot_data.processor_database,
             hierarchy,
             0,
             hierarchy->getFinestLevelNumber(),
             simulation_time);
-        visit_HDFFilePointer->close(); // invokes H5FClose
-        delete visit_HDFFilePointer; // deletes SAMRAI::tbox::HDFDatabase object
+        
+        if (d_use_parallel_HDF5_single_file)
+        {
+            writeParallelHDF5File(pending_plot_data);
+        }
     }
-    
+    else
+    {
 #ifdef USE_BATON_BARRIERS
-    dumpWriteBarrierEnd();
+        dumpWriteBarrierBegin();
 #endif
+        {
+            // cluster_leader guaranteed to enter this section before anyone else
+            sprintf(temp_buf, "/processor_cluster.%0*d.samrai",
+                5,
+                d_my_file_cluster_number);
+            std::string database_name(temp_buf);
+            std::string visit_HDFFilename = dump_dirname + database_name;
+            visit_HDFFilePointer = new SAMRAI::tbox::HDFDatabase(database_name);
+            if (d_file_cluster_leader)
+            {
+                 // creates the HDF file:
+                 //     dirname/visit_dump.000n/processor_cluster.000m.samrai where n is timestep #,
+                 //     m is processor number
+                 visit_HDFFilePointer->create(visit_HDFFilename);
+            }
+            else
+            {
+                // file already created other procs just need to open it
+                const bool read_write_mode(true);
+                if (!visit_HDFFilePointer->open(visit_HDFFilename, read_write_mode))
+                {
+                    TBOX_ERROR("ExtendedVisItDataWriter::writeHDFFiles"
+                        << "\n    data writer with name "
+                        << d_object_name
+                        << "\n    Error attempting to open visit file "
+                        << visit_HDFFilename << std::endl);
+                }
+            }
+            
+            // create group for this proc
+            sprintf(temp_buf, "processor.%0*d", 5, my_proc);
+            HAMERS_SHARED_PTR<SAMRAI::tbox::Database> processor_HDFGroup(
+                visit_HDFFilePointer->putDatabase(std::string(temp_buf)));
+            writeVisItVariablesToHDFFile(processor_HDFGroup,
+                hierarchy,
+                0,
+                hierarchy->getFinestLevelNumber(),
+                simulation_time);
+            visit_HDFFilePointer->close(); // invokes H5FClose
+            delete visit_HDFFilePointer; // deletes SAMRAI::tbox::HDFDatabase object
+        }
+        
+#ifdef USE_BATON_BARRIERS
+        dumpWriteBarrierEnd();
+#endif
+    }
 
    /*
     * When using DLBG, the globalized data is not saved by default, so it must be generated, requiring
@@ -1802,6 +1948,757 @@ ExtendedVisItDataWriter::writeHDFFiles(
         0,
         hierarchy->getFinestLevelNumber(),
         simulation_time);
+    
+    if (d_use_asynchronous_dumps)
+    {
+        addPendingPlotData(pending_plot_data);
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to wait until at most the given number of asynchronous dumps are not written yet.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::waitForPendingPlotData(
+    const int number_pending_dumps)
+{
+    TBOX_ASSERT(number_pending_dumps >= 0);
+    
+    t_wait_for_pending_plot_data->start();
+    
+    std::unique_lock<std::mutex> lock(d_pending_plot_data_mutex);
+    while (static_cast<int>(d_pending_plot_data.size()) > number_pending_dumps &&
+           d_io_thread_error_message.empty())
+    {
+        d_pending_plot_data_condition.wait(lock);
+    }
+    const std::string io_thread_error_message = d_io_thread_error_message;
+    lock.unlock();
+    
+    t_wait_for_pending_plot_data->stop();
+    
+    if (!io_thread_error_message.empty())
+    {
+        TBOX_ERROR("ExtendedVisItDataWriter::waitForPendingPlotData"
+            << "\n    data writer with name "
+            << d_object_name
+            << "\n    " << io_thread_error_message << std::endl);
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to hand the packed data of this processor to the I/O thread.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::addPendingPlotData(
+    const pendingPlotDataStruct& pending_plot_data)
+{
+    TBOX_ASSERT(pending_plot_data.processor_database);
+    
+    std::unique_lock<std::mutex> lock(d_pending_plot_data_mutex);
+    
+    if (!d_io_thread_error_message.empty())
+    {
+        const std::string io_thread_error_message = d_io_thread_error_message;
+        lock.unlock();
+        
+        TBOX_ERROR("ExtendedVisItDataWriter::addPendingPlotData"
+            << "\n    data writer with name "
+            << d_object_name
+            << "\n    " << io_thread_error_message << std::endl);
+    }
+    
+    if (!d_io_thread.joinable())
+    {
+        d_stop_io_thread = false;
+        d_io_thread = std::thread(&ExtendedVisItDataWriter::writePendingPlotData, this);
+    }
+    
+    d_pending_plot_data.push_back(pending_plot_data);
+    lock.unlock();
+    
+    d_pending_plot_data_condition.notify_all();
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function run by the I/O thread to write the pending packed data to the processor files.
+ * Only HDF5 calls are made here since MPI and the SAMRAI timers may only be used by the main thread.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::writePendingPlotData()
+{
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(d_pending_plot_data_mutex);
+        while (d_pending_plot_data.empty() && !d_stop_io_thread)
+        {
+            d_pending_plot_data_condition.wait(lock);
+        }
+        
+        if (d_pending_plot_data.empty())
+        {
+            return;
+        }
+        
+        /*
+         * The packed data stays at the front of the queue until it is written so that it is counted
+         * as pending by the main thread.
+         */
+        const pendingPlotDataStruct pending_plot_data = d_pending_plot_data.front();
+        lock.unlock();
+        
+        std::string error_message;
+        
+        {
+            std::lock_guard<std::mutex> hdf5_lock(d_hdf5_mutex);
+            
+            HAMERS_SHARED_PTR<SAMRAI::tbox::HDFDatabase> visit_HDFFilePointer(
+                HAMERS_MAKE_SHARED<SAMRAI::tbox::HDFDatabase>(pending_plot_data.file_name));
+            
+            if (visit_HDFFilePointer->create(pending_plot_data.file_name))
+            {
+                copyDatabase(pending_plot_data.processor_database,
+                    visit_HDFFilePointer->putDatabase(pending_plot_data.processor_group_name),
+                    error_message);
+                
+                visit_HDFFilePointer->close(); // invokes H5FClose
+            }
+            else
+            {
+                error_message = "Error attempting to create visit file " + pending_plot_data.file_name;
+            }
+        }
+        
+        if (!error_message.empty())
+        {
+            /*
+             * TBOX_ERROR may not be called from the I/O thread. Record the error for the main thread
+             * and stop.
+             */
+            
+            lock.lock();
+            d_io_thread_error_message = error_message;
+            d_pending_plot_data.clear();
+            lock.unlock();
+            
+            d_pending_plot_data_condition.notify_all();
+            
+            return;
+        }
+        
+        lock.lock();
+        d_pending_plot_data.pop_front();
+        lock.unlock();
+        
+        d_pending_plot_data_condition.notify_all();
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to stop the I/O thread after all the pending packed data is written.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::stopIOThread()
+{
+    if (d_io_thread.joinable())
+    {
+        std::unique_lock<std::mutex> lock(d_pending_plot_data_mutex);
+        d_stop_io_thread = true;
+        lock.unlock();
+        
+        d_pending_plot_data_condition.notify_all();
+        
+        d_io_thread.join();
+        
+        if (!d_io_thread_error_message.empty())
+        {
+            TBOX_ERROR("ExtendedVisItDataWriter::stopIOThread"
+                << "\n    data writer with name "
+                << d_object_name
+                << "\n    " << d_io_thread_error_message << std::endl);
+        }
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to write the packed data of all processors collectively into a single file with
+ * parallel HDF5. The file has the same layout as a file shared by all processors in a file cluster,
+ * so VisIt reads it through the same summary file. Since HDF5 requires the groups and datasets of a
+ * parallel file to be created by all processors, the layouts of the packed data of all processors are
+ * gathered first. The data of the patches of all processors are then written with a single collective
+ * call when the HDF5 library supports multi-dataset I/O, so that MPI-IO aggregates the writes, and
+ * independently otherwise.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::writeParallelHDF5File(
+    const pendingPlotDataStruct& pending_plot_data)
+{
+    TBOX_ASSERT(pending_plot_data.processor_database);
+    
+#ifdef H5_HAVE_PARALLEL
+    const int num_procs = d_mpi.getSize();
+    const int my_proc = d_mpi.getRank();
+    
+    /*
+     * Get the layout of the packed data of this processor and pack it into a string with one line of
+     * data type, number of elements and path per group or dataset.
+     */
+    std::vector<parallelHDF5EntryStruct> local_entries;
+    flattenDatabase(pending_plot_data.processor_database,
+        pending_plot_data.processor_group_name,
+        local_entries);
+    
+    std::ostringstream local_layout_stream;
+    for (int ei = 0; ei < static_cast<int>(local_entries.size()); ei++)
+    {
+        local_layout_stream << local_entries[ei].data_type << " "
+                            << local_entries[ei].number_elements << " "
+                            << local_entries[ei].path << "\n";
+    }
+    std::string local_layout(local_layout_stream.str());
+    
+    /*
+     * Gather the layouts of all processors.
+     */
+    int local_layout_length = static_cast<int>(local_layout.size());
+    std::vector<int> layout_lengths(num_procs);
+    d_mpi.Allgather(
+        &local_layout_length,
+        1,
+        MPI_INT,
+        layout_lengths.data(),
+        1,
+        MPI_INT);
+    
+    std::vector<int> layout_displacements(num_procs, 0);
+    for (int pi = 1; pi < num_procs; pi++)
+    {
+        layout_displacements[pi] = layout_displacements[pi - 1] + layout_lengths[pi - 1];
+    }
+    
+    std::vector<char> global_layout(layout_displacements[num_procs - 1] + layout_lengths[num_procs - 1] + 1, '\0');
+    d_mpi.Allgatherv(
+        &local_layout[0],
+        local_layout_length,
+        MPI_CHAR,
+        global_layout.data(),
+        layout_lengths.data(),
+        layout_displacements.data(),
+        MPI_CHAR);
+    
+    /*
+     * Create the file with the MPI-IO driver. The number of aggregators of the collective buffering
+     * is passed to MPI-IO as a hint.
+     */
+    MPI_Info info;
+    MPI_Info_create(&info);
+    if (d_number_io_aggregators > 0)
+    {
+        std::ostringstream number_io_aggregators_stream;
+        number_io_aggregators_stream << d_number_io_aggregators;
+        MPI_Info_set(info, const_cast<char*>("cb_nodes"),
+            const_cast<char*>(number_io_aggregators_stream.str().c_str()));
+        MPI_Info_set(info, const_cast<char*>("romio_cb_write"), const_cast<char*>("enable"));
+    }
+    
+    herr_t errf;
+    
+    hid_t file_access_plist = H5Pcreate(H5P_FILE_ACCESS);
+    TBOX_ASSERT(file_access_plist >= 0);
+    
+    errf = H5Pset_fapl_mpio(file_access_plist, d_mpi.getCommunicator(), info);
+    TBOX_ASSERT(errf >= 0);
+    
+#if H5_VERSION_GE(1, 10, 0)
+    // Metadata is read and written collectively instead of by every processor.
+    errf = H5Pset_all_coll_metadata_ops(file_access_plist, true);
+    TBOX_ASSERT(errf >= 0);
+    
+    errf = H5Pset_coll_metadata_write(file_access_plist, true);
+    TBOX_ASSERT(errf >= 0);
+#endif
+    
+    hid_t file_id = H5Fcreate(
+        pending_plot_data.file_name.c_str(),
+        H5F_ACC_TRUNC,
+        H5P_DEFAULT,
+        file_access_plist);
+    
+    if (file_id < 0)
+    {
+        TBOX_ERROR("ExtendedVisItDataWriter::writeParallelHDF5File"
+            << "\n    data writer with name "
+            << d_object_name
+            << "\n    Error attempting to create visit file "
+            << pending_plot_data.file_name << std::endl);
+    }
+    
+    errf = H5Pclose(file_access_plist);
+    TBOX_ASSERT(errf >= 0);
+    
+    MPI_Info_free(&info);
+    
+    /*
+     * Create the groups and datasets of all processors. The datasets of this processor are kept open
+     * for writing.
+     */
+    std::vector<hid_t> local_dataset_ids;
+    std::vector<hid_t> local_mem_type_ids;
+    std::vector<std::vector<char> > local_buffers;
+    
+    /*
+     * A processor without any data to write still has to take part in the collective write. The
+     * first non-empty dataset of the other processors is kept open for it to write an empty selection
+     * into.
+     */
+    bool has_local_data = false;
+    for (int ei = 0; ei < static_cast<int>(local_entries.size()); ei++)
+    {
+        if ((local_entries[ei].data_type != SAMRAI::tbox::Database::SAMRAI_DATABASE) &&
+            (local_entries[ei].number_elements > 0))
+        {
+            has_local_data = true;
+            break;
+        }
+    }
+    
+    hid_t empty_write_dataset_id = -1;
+    hid_t empty_write_mem_type_id = -1;
+    
+    for (int pi = 0; pi < num_procs; pi++)
+    {
+        int ei_local = 0;
+        
+        std::istringstream processor_layout_stream(
+            std::string(global_layout.data() + layout_displacements[pi], layout_lengths[pi]));
+        
+        int data_type;
+        int number_elements;
+        std::string path;
+        while (processor_layout_stream >> data_type >> number_elements >> path)
+        {
+            if (data_type == SAMRAI::tbox::Database::SAMRAI_DATABASE)
+            {
+#if (H5_VERS_MAJOR > 1) || ((H5_VERS_MAJOR == 1) && (H5_VERS_MINOR > 6))
+                hid_t group_id = H5Gcreate(file_id, path.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+#else
+                hid_t group_id = H5Gcreate(file_id, path.c_str(), 0);
+#endif
+                TBOX_ASSERT(group_id >= 0);
+                
+                errf = H5Gclose(group_id);
+                TBOX_ASSERT(errf >= 0);
+            }
+            else
+            {
+                hid_t mem_type_id = getParallelHDF5NativeType(data_type);
+                
+                hid_t space;
+                if (number_elements > 0)
+                {
+                    hsize_t dim[] = { static_cast<hsize_t>(number_elements) };
+                    space = H5Screate_simple(1, dim, 0);
+                }
+                else
+                {
+                    space = H5Screate(H5S_NULL);
+                }
+                TBOX_ASSERT(space >= 0);
+                
+#if (H5_VERS_MAJOR > 1) || ((H5_VERS_MAJOR == 1) && (H5_VERS_MINOR > 6))
+                hid_t dataset = H5Dcreate(
+                    file_id,
+                    path.c_str(),
+                    mem_type_id,
+                    space,
+                    H5P_DEFAULT,
+                    H5P_DEFAULT,
+                    H5P_DEFAULT);
+#else
+                hid_t dataset = H5Dcreate(
+                    file_id,
+                    path.c_str(),
+                    mem_type_id,
+                    space,
+                    H5P_DEFAULT);
+#endif
+                TBOX_ASSERT(dataset >= 0);
+                
+                errf = H5Sclose(space);
+                TBOX_ASSERT(errf >= 0);
+                
+                if ((pi == my_proc) && (number_elements > 0))
+                {
+                    /*
+                     * The entries of this processor are gathered in the same order as they are
+                     * flattened.
+                     */
+                    while (local_entries[ei_local].path != path)
+                    {
+                        ei_local++;
+                    }
+                    
+                    local_dataset_ids.push_back(dataset);
+                    local_mem_type_ids.push_back(mem_type_id);
+                    local_buffers.push_back(std::vector<char>());
+                    getParallelHDF5Buffer(local_entries[ei_local], local_buffers.back());
+                }
+                else if (!has_local_data && (empty_write_dataset_id < 0) && (number_elements > 0))
+                {
+                    empty_write_dataset_id = dataset;
+                    empty_write_mem_type_id = mem_type_id;
+                }
+                else
+                {
+                    errf = H5Dclose(dataset);
+                    TBOX_ASSERT(errf >= 0);
+                }
+            }
+        }
+    }
+    
+    /*
+     * Write the datasets of this processor.
+     */
+    const int num_local_datasets = static_cast<int>(local_dataset_ids.size());
+    
+#if H5_VERSION_GE(1, 14, 0)
+    hid_t transfer_plist = H5Pcreate(H5P_DATASET_XFER);
+    TBOX_ASSERT(transfer_plist >= 0);
+    
+    errf = H5Pset_dxpl_mpio(transfer_plist, H5FD_MPIO_COLLECTIVE);
+    TBOX_ASSERT(errf >= 0);
+    
+    std::vector<hid_t> local_space_ids(num_local_datasets, H5S_ALL);
+    std::vector<const void*> local_buffer_pointers(num_local_datasets);
+    for (int di = 0; di < num_local_datasets; di++)
+    {
+        local_buffer_pointers[di] = local_buffers[di].data();
+    }
+    
+    if (num_local_datasets > 0)
+    {
+        errf = H5Dwrite_multi(
+            static_cast<size_t>(num_local_datasets),
+            local_dataset_ids.data(),
+            local_mem_type_ids.data(),
+            local_space_ids.data(),
+            local_space_ids.data(),
+            transfer_plist,
+            local_buffer_pointers.data());
+        TBOX_ASSERT(errf >= 0);
+    }
+    else if (empty_write_dataset_id >= 0)
+    {
+        /*
+         * The collective write needs every processor to take part, which is not guaranteed when
+         * H5Dwrite_multi is given no dataset. Write an empty selection of a dataset of another
+         * processor instead.
+         */
+        hid_t file_space_id = H5Dget_space(empty_write_dataset_id);
+        TBOX_ASSERT(file_space_id >= 0);
+        
+        errf = H5Sselect_none(file_space_id);
+        TBOX_ASSERT(errf >= 0);
+        
+        hsize_t mem_dim[] = { 1 };
+        hid_t mem_space_id = H5Screate_simple(1, mem_dim, 0);
+        TBOX_ASSERT(mem_space_id >= 0);
+        
+        errf = H5Sselect_none(mem_space_id);
+        TBOX_ASSERT(errf >= 0);
+        
+        std::vector<char> empty_buffer(H5Tget_size(empty_write_mem_type_id));
+        const void* empty_buffer_pointer = empty_buffer.data();
+        
+        errf = H5Dwrite_multi(
+            1,
+            &empty_write_dataset_id,
+            &empty_write_mem_type_id,
+            &mem_space_id,
+            &file_space_id,
+            transfer_plist,
+            &empty_buffer_pointer);
+        TBOX_ASSERT(errf >= 0);
+        
+        errf = H5Sclose(mem_space_id);
+        TBOX_ASSERT(errf >= 0);
+        
+        errf = H5Sclose(file_space_id);
+        TBOX_ASSERT(errf >= 0);
+    }
+    
+    errf = H5Pclose(transfer_plist);
+    TBOX_ASSERT(errf >= 0);
+#else
+    for (int di = 0; di < num_local_datasets; di++)
+    {
+        errf = H5Dwrite(
+            local_dataset_ids[di],
+            local_mem_type_ids[di],
+            H5S_ALL,
+            H5S_ALL,
+            H5P_DEFAULT,
+            local_buffers[di].data());
+        TBOX_ASSERT(errf >= 0);
+    }
+#endif
+    
+    for (int di = 0; di < num_local_datasets; di++)
+    {
+        errf = H5Dclose(local_dataset_ids[di]);
+        TBOX_ASSERT(errf >= 0);
+    }
+    
+    if (empty_write_dataset_id >= 0)
+    {
+        errf = H5Dclose(empty_write_dataset_id);
+        TBOX_ASSERT(errf >= 0);
+    }
+    
+    errf = H5Fclose(file_id);
+    TBOX_ASSERT(errf >= 0);
+    NULL_USE(errf);
+#else
+    NULL_USE(pending_plot_data);
+    
+    TBOX_ERROR("ExtendedVisItDataWriter::writeParallelHDF5File"
+        << "\n    data writer with name " << d_object_name
+        << "\n    The HDF5 library is not built with parallel support." << std::endl);
+#endif
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to recursively list the groups and datasets of a database. The path of a group
+ * is listed before the paths of its members.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::flattenDatabase(
+    const HAMERS_SHARED_PTR<SAMRAI::tbox::Database>& database,
+    const std::string& path,
+    std::vector<parallelHDF5EntryStruct>& entries)
+{
+    TBOX_ASSERT(database);
+    
+    parallelHDF5EntryStruct group_entry;
+    group_entry.path = path;
+    group_entry.data_type = SAMRAI::tbox::Database::SAMRAI_DATABASE;
+    group_entry.number_elements = 0;
+    entries.push_back(group_entry);
+    
+    const std::vector<std::string> keys(database->getAllKeys());
+    
+    for (int ki = 0; ki < static_cast<int>(keys.size()); ki++)
+    {
+        const std::string& key = keys[ki];
+        const SAMRAI::tbox::Database::DataType data_type = database->getArrayType(key);
+        
+        if (data_type == SAMRAI::tbox::Database::SAMRAI_DATABASE)
+        {
+            flattenDatabase(database->getDatabase(key), path + "/" + key, entries);
+        }
+        else if ((data_type == SAMRAI::tbox::Database::SAMRAI_INT) ||
+                 (data_type == SAMRAI::tbox::Database::SAMRAI_FLOAT) ||
+                 (data_type == SAMRAI::tbox::Database::SAMRAI_DOUBLE))
+        {
+            parallelHDF5EntryStruct dataset_entry;
+            dataset_entry.path = path + "/" + key;
+            dataset_entry.data_type = data_type;
+            dataset_entry.number_elements = static_cast<int>(database->getArraySize(key));
+            dataset_entry.database = database;
+            dataset_entry.key = key;
+            entries.push_back(dataset_entry);
+        }
+        else
+        {
+            TBOX_ERROR("ExtendedVisItDataWriter::flattenDatabase"
+                << "\n    Unsupported type of data with key '"
+                << key
+                << "' in the packed data." << std::endl);
+        }
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to get the native HDF5 type of a type of data in the packed data.
+ *
+ **************************************************************************************************
+ */
+hid_t
+ExtendedVisItDataWriter::getParallelHDF5NativeType(
+    const int data_type)
+{
+    hid_t native_type = H5T_NATIVE_FLOAT;
+    
+    if (data_type == SAMRAI::tbox::Database::SAMRAI_INT)
+    {
+        native_type = H5T_NATIVE_INT;
+    }
+    else if (data_type == SAMRAI::tbox::Database::SAMRAI_FLOAT)
+    {
+        native_type = H5T_NATIVE_FLOAT;
+    }
+    else if (data_type == SAMRAI::tbox::Database::SAMRAI_DOUBLE)
+    {
+        native_type = H5T_NATIVE_DOUBLE;
+    }
+    else
+    {
+        TBOX_ERROR("ExtendedVisItDataWriter::getParallelHDF5NativeType"
+            << "\n    Unsupported type of data " << data_type
+            << " in the packed data." << std::endl);
+    }
+    
+    return native_type;
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to copy the data of a dataset in the packed data into a buffer of bytes.
+ *
+ **************************************************************************************************
+ */
+void
+ExtendedVisItDataWriter::getParallelHDF5Buffer(
+    const parallelHDF5EntryStruct& entry,
+    std::vector<char>& buffer)
+{
+    TBOX_ASSERT(entry.database);
+    
+    if (entry.data_type == SAMRAI::tbox::Database::SAMRAI_INT)
+    {
+        const std::vector<int> data(entry.database->getIntegerVector(entry.key));
+        buffer.resize(data.size()*sizeof(int));
+        memcpy(buffer.data(), data.data(), buffer.size());
+    }
+    else if (entry.data_type == SAMRAI::tbox::Database::SAMRAI_FLOAT)
+    {
+        const std::vector<float> data(entry.database->getFloatVector(entry.key));
+        buffer.resize(data.size()*sizeof(float));
+        memcpy(buffer.data(), data.data(), buffer.size());
+    }
+    else if (entry.data_type == SAMRAI::tbox::Database::SAMRAI_DOUBLE)
+    {
+        const std::vector<double> data(entry.database->getDoubleVector(entry.key));
+        buffer.resize(data.size()*sizeof(double));
+        memcpy(buffer.data(), data.data(), buffer.size());
+    }
+    else
+    {
+        TBOX_ERROR("ExtendedVisItDataWriter::getParallelHDF5Buffer"
+            << "\n    Unsupported type of data with key '"
+            << entry.key
+            << "' in the packed data." << std::endl);
+    }
+}
+
+
+/*
+ **************************************************************************************************
+ *
+ * Private function to recursively copy all the keys of a database into another database. Only the
+ * types of data written by the packing functions are supported. This is run on the I/O thread, so
+ * an unsupported type is reported through the error message instead of TBOX_ERROR.
+ *
+ **************************************************************************************************
+ */
+bool
+ExtendedVisItDataWriter::copyDatabase(
+    const HAMERS_SHARED_PTR<SAMRAI::tbox::Database>& source_database,
+    const HAMERS_SHARED_PTR<SAMRAI::tbox::Database>& destination_database,
+    std::string& error_message)
+{
+    TBOX_ASSERT(source_database);
+    TBOX_ASSERT(destination_database);
+    
+    const std::vector<std::string> keys(source_database->getAllKeys());
+    
+    for (int ki = 0; ki < static_cast<int>(keys.size()); ki++)
+    {
+        const std::string& key = keys[ki];
+        
+        switch (source_database->getArrayType(key))
+        {
+            case SAMRAI::tbox::Database::SAMRAI_DATABASE:
+            {
+                if (!copyDatabase(source_database->getDatabase(key),
+                        destination_database->putDatabase(key),
+                        error_message))
+                {
+                    return false;
+                }
+                
+                break;
+            }
+            case SAMRAI::tbox::Database::SAMRAI_INT:
+            {
+                destination_database->putIntegerVector(key, source_database->getIntegerVector(key));
+                
+                break;
+            }
+            case SAMRAI::tbox::Database::SAMRAI_FLOAT:
+            {
+                destination_database->putFloatVector(key, source_database->getFloatVector(key));
+                
+                break;
+            }
+            case SAMRAI::tbox::Database::SAMRAI_DOUBLE:
+            {
+                destination_database->putDoubleVector(key, source_database->getDoubleVector(key));
+                
+                break;
+            }
+            case SAMRAI::tbox::Database::SAMRAI_STRING:
+            {
+                destination_database->putStringVector(key, source_database->getStringVector(key));
+                
+                break;
+            }
+            default:
+            {
+                error_message = "Unsupported type of data with key '" + key + "' in the packed data.";
+                
+                return false;
+            }
+        }
+    }
+    
+    return true;
 }
 
 
@@ -2935,6 +3832,9 @@ ExtendedVisItDataWriter::writeSummaryToHDFFile(
     int my_proc = d_mpi.getRank();
     if (my_proc == VISIT_MASTER)
     {
+        // The I/O thread may still be writing a processor file of an asynchronous dump.
+        std::lock_guard<std::mutex> hdf5_lock(d_hdf5_mutex);
+        
         char temp_buf[VISIT_NAME_BUFSIZE];
         //sprintf(temp_buf, "/summary.samrai");
         //string summary_HDFFilename = dump_dirname + temp_buf;
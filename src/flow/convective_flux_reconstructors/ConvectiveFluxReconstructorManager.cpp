@@ -141,6 +141,19 @@ ConvectiveFluxReconstructorManager::ConvectiveFluxReconstructorManager(
             flow_model,
             convective_flux_reconstructor_db));
     }
+    else if (convective_flux_reconstructor_str == "HYBRID_KEP_WCNS")
+    {
+        d_convective_flux_reconstructor_type = CONVECTIVE_FLUX_RECONSTRUCTOR::HYBRID_KEP_WCNS;
+        
+        d_conv_flux_reconstructor.reset(new ConvectiveFluxReconstructorHybridKEP_WCNS(
+            "d_convective_flux_reconstructor",
+            dim,
+            grid_geometry,
+            flow_model->getNumberOfEquations(),
+            flow_model_type,
+            flow_model,
+            convective_flux_reconstructor_db));
+    }
     else
     {
         TBOX_ERROR(d_object_name
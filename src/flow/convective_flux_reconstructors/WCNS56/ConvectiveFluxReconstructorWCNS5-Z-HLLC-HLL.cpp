@@ -1,23 +1,9 @@
 #include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS5-Z-HLLC-HLL.hpp"
+#include "util/IntegerPower.hpp"
 
 #define EPSILON HAMERS_EPSILON
 
 
-/*
- * Interger based power function.
- */
-static inline __attribute__((always_inline)) double ipow(double base, const int& exp)
-{
-    double result = base;
-    for (int i = 1; i < exp; i++)
-    {
-        result *= base;
-    }
-
-    return result;
-}
-
-
 /*
  * Compute local beta's.
  */
@@ -75,6 +61,7 @@ static inline __attribute__((always_inline)) void computeLocalBetaTilde(
 /*
  * Perform local WENO interpolation of U_minus.
  */
+template<int P>
 static inline __attribute__((always_inline)) void performLocalWENOInterpolationMinus(
     double* U_minus,
     double** U_array,
@@ -97,9 +84,9 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationM
     
     double tau_5 = fabs(beta_0 - beta_2);
     
-    omega_0 = double(1)/double(16)*(double(1) + ipow(tau_5/(beta_0 + EPSILON), p));
-    omega_1 = double(5)/double(8)*(double(1) + ipow(tau_5/(beta_1 + EPSILON), p));
-    omega_2 = double(5)/double(16)*(double(1) + ipow(tau_5/(beta_2 + EPSILON), p));
+    omega_0 = double(1)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5/(beta_0 + EPSILON), p));
+    omega_1 = double(5)/double(8)*(double(1) + IntegerPower<P>::compute(tau_5/(beta_1 + EPSILON), p));
+    omega_2 = double(5)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5/(beta_2 + EPSILON), p));
     
     double omega_sum = omega_0 + omega_1 + omega_2;
     
@@ -123,6 +110,7 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationM
 /*
  * Perform local WENO interpolation of U_plus.
  */
+template<int P>
 static inline __attribute__((always_inline)) void performLocalWENOInterpolationPlus(
     double* U_plus,
     double** U_array,
@@ -145,9 +133,9 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationP
     
     double tau_5_tilde = fabs(beta_tilde_0 - beta_tilde_2);
     
-    omega_tilde_0 = double(1)/double(16)*(double(1) + ipow(tau_5_tilde/(beta_tilde_0 + EPSILON), p));
-    omega_tilde_1 = double(5)/double(8)*(double(1) + ipow(tau_5_tilde/(beta_tilde_1 + EPSILON), p));
-    omega_tilde_2 = double(5)/double(16)*(double(1) + ipow(tau_5_tilde/(beta_tilde_2 + EPSILON), p));
+    omega_tilde_0 = double(1)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5_tilde/(beta_tilde_0 + EPSILON), p));
+    omega_tilde_1 = double(5)/double(8)*(double(1) + IntegerPower<P>::compute(tau_5_tilde/(beta_tilde_1 + EPSILON), p));
+    omega_tilde_2 = double(5)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5_tilde/(beta_tilde_2 + EPSILON), p));
     
     double omega_tilde_sum = omega_tilde_0 + omega_tilde_1 + omega_tilde_2;
     
@@ -233,509 +221,120 @@ ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::putToRestart(
 
 
 /*
- * Perform WENO interpolation.
+ * Perform WENO interpolation on a line of faces with the exponent P of the nonlinear weights fixed at
+ * compile time. The exponent p of the input database is used if P is zero.
  */
+template<int P>
 void
-ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
-    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_minus,
-    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_plus,
-    const std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > >& variables)
+ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolationWithExponent(
+    std::vector<double*>& variables_minus,
+    std::vector<double*>& variables_plus,
+    const std::vector<std::vector<double*> >& variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
 {
 #ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
     TBOX_ASSERT(static_cast<int>(variables_minus.size()) == d_num_eqn);
     TBOX_ASSERT(static_cast<int>(variables_plus.size()) == d_num_eqn);
     
     TBOX_ASSERT(static_cast<int>(variables.size()) == 6);
-#endif
-    
-    /*
-     * Get the interior dimensions.
-     */
-    
-    const hier::IntVector interior_dims = variables_minus[0]->getBox().numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
-    for (int ei = 0; ei < d_num_eqn; ei++)
-    {
-        TBOX_ASSERT(variables_minus[ei]->getBox().numberCells() == interior_dims);
-        TBOX_ASSERT(variables_plus[ei]->getBox().numberCells() == interior_dims);
-        
-        TBOX_ASSERT(variables_minus[ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-        TBOX_ASSERT(variables_plus[ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-    }
-    
-    TBOX_ASSERT(static_cast<int>(variables.size()) == 6);
     
     for (int m = 0; m < 6; m++)
     {
         TBOX_ASSERT(static_cast<int>(variables[m].size()) == d_num_eqn);
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(variables[m][ei]->getBox().numberCells() == interior_dims);
-            TBOX_ASSERT(variables[m][ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-        }
     }
 #endif
     
-    if (d_dim == tbox::Dimension(1))
-    {
-        /*
-         * Get the dimension.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = -1; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index of the mid-point.
-                const int idx_midpoint_x = i + 1;
-                
-                performLocalWENOInterpolationMinus(
-                    U_L,
-                    U_array.data(),
-                    idx_midpoint_x,
-                    d_constant_p);
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = -1; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index of the mid-point.
-                const int idx_midpoint_x = i + 1;
-                
-                performLocalWENOInterpolationPlus(
-                    U_R,
-                    U_array.data(),
-                    idx_midpoint_x,
-                    d_constant_p);
-            }
-        }
-        
-    } // if (d_dim == tbox::Dimension(1))
-    else if (d_dim == tbox::Dimension(2))
+    NULL_USE(direction);
+    
+    for (int ei = 0; ei < d_num_eqn; ei++)
     {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -1; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_x = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 3);
-                    
-                    performLocalWENOInterpolationMinus(
-                        U_L,
-                        U_array.data(),
-                        idx_midpoint_x,
-                        d_constant_p);
-                }
-            }
-        }
+        double* U_array[6];
         
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        for (int m = 0; m < 6; m++)
         {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -1; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_x = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 3);
-                    
-                    performLocalWENOInterpolationPlus(
-                        U_R,
-                        U_array.data(),
-                        idx_midpoint_x,
-                        d_constant_p);
-                }
-            }
+            U_array[m] = variables[m][ei];
         }
         
-        /*
-         * Peform WENO interpolation in the y-direction.
-         */
+        double* U_minus = variables_minus[ei];
+        double* U_plus = variables_plus[ei];
         
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(1);
-            
-            for (int j = -1; j < interior_dim_1 + 2; j++)
-            {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
+        #pragma omp simd
 #endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_y = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2);
-                    
-                    performLocalWENOInterpolationMinus(
-                        U_B,
-                        U_array.data(),
-                        idx_midpoint_y,
-                        d_constant_p);
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        for (int idx_face = 0; idx_face < num_faces; idx_face++)
         {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_T = variables_plus[ei]->getPointer(1);
-            
-            for (int j = -1; j < interior_dim_1 + 2; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_y = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2);
-                    
-                    performLocalWENOInterpolationPlus(
-                        U_T,
-                        U_array.data(),
-                        idx_midpoint_y,
-                        d_constant_p);
-                }
-            }
+            performLocalWENOInterpolationMinus<P>(
+                U_minus,
+                U_array,
+                idx_face,
+                d_constant_p);
+            
+            performLocalWENOInterpolationPlus<P>(
+                U_plus,
+                U_array,
+                idx_face,
+                d_constant_p);
         }
-        
-    } // if (d_dim == tbox::Dimension(2))
-    else if (d_dim == tbox::Dimension(3))
+    }
+}
+
+
+/*
+ * Perform WENO interpolation on a line of faces. The kernel with the exponent of the nonlinear weights
+ * fixed at compile time is used for the common values of the exponent.
+ */
+void
+ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL::performWENOInterpolation(
+    std::vector<double*>& variables_minus,
+    std::vector<double*>& variables_plus,
+    const std::vector<std::vector<double*> >& variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
+{
+    if (d_constant_p == 1)
     {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -1; i < interior_dim_0 + 2; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_x = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 3) +
-                            (k + 1)*(interior_dim_0 + 3)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_L,
-                            U_array.data(),
-                            idx_midpoint_x,
-                            d_constant_p);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -1; i < interior_dim_0 + 2; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_x = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 3) +
-                            (k + 1)*(interior_dim_0 + 3)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_R,
-                            U_array.data(),
-                            idx_midpoint_x,
-                            d_constant_p);
-                    }
-                }
-            }
-        }
-        
-        /*
-         * Peform WENO interpolation in the y-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(1);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = -1; j < interior_dim_1 + 2; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_y = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 3);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_B,
-                            U_array.data(),
-                            idx_midpoint_y,
-                            d_constant_p);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_T = variables_plus[ei]->getPointer(1);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = -1; j < interior_dim_1 + 2; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_y = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 3);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_T,
-                            U_array.data(),
-                            idx_midpoint_y,
-                            d_constant_p);
-                    }
-                }
-            }
-        }
-        
-        /*
-         * Peform WENO interpolation in the z-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(2));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(2);
-            
-            for (int k = -1; k < interior_dim_2 + 2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_z = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_B,
-                            U_array.data(),
-                            idx_midpoint_z,
-                            d_constant_p);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(2));
-            }
-            
-            double* U_F = variables_plus[ei]->getPointer(2);
-            
-            for (int k = -1; k < interior_dim_2 + 2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_z = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_F,
-                            U_array.data(),
-                            idx_midpoint_z,
-                            d_constant_p);
-                    }
-                }
-            }
-        }
-        
-    } // if (d_dim == tbox::Dimension(3))
+        performWENOInterpolationWithExponent<1>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_p == 2)
+    {
+        performWENOInterpolationWithExponent<2>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_p == 3)
+    {
+        performWENOInterpolationWithExponent<3>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_p == 4)
+    {
+        performWENOInterpolationWithExponent<4>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else
+    {
+        performWENOInterpolationWithExponent<0>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
 }
@@ -1,7 +1,46 @@
 #include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS56-HLLC-HLL.hpp"
 
+#include <algorithm>
+
 #define EPSILON HAMERS_EPSILON
 
+
+/*
+ * Compute the linear index of the first element and the stride of a line of data in a direction. The
+ * number of dimensions DIM is fixed at compile time such that the loop over the directions is unrolled.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeLineStartAndStride(
+    int& idx_start,
+    int& stride_line,
+    const int* const idx_line,
+    const int& idx_first,
+    const int* const num_ghosts,
+    const int* const ghostcell_dims,
+    const int& di,
+    const bool& is_side_data)
+{
+    idx_start = 0;
+    stride_line = 1;
+    
+    int stride = 1;
+    for (int dj = 0; dj < DIM; dj++)
+    {
+        if (dj == di)
+        {
+            idx_start += (idx_first + num_ghosts[dj])*stride;
+            stride_line = stride;
+            stride *= (is_side_data ? ghostcell_dims[dj] + 1 : ghostcell_dims[dj]);
+        }
+        else
+        {
+            idx_start += (idx_line[dj] + num_ghosts[dj])*stride;
+            stride *= ghostcell_dims[dj];
+        }
+    }
+}
+
+
 ConvectiveFluxReconstructorWCNS56::ConvectiveFluxReconstructorWCNS56(
     const std::string& object_name,
     const tbox::Dimension& dim,
@@ -95,22 +134,22 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
     
     if (d_has_advective_eqn_form)
     {
-        velocity_midpoint.reset(new pdat::SideData<double>(
-            interior_box, d_dim.getValue(), hier::IntVector::getOne(d_dim)));
+        velocity_midpoint = d_scratch_arena->getSideData(
+            interior_box, d_dim.getValue(), hier::IntVector::getOne(d_dim));
     }
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux_midpoint(
-        new pdat::SideData<double>(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+        d_scratch_arena->getSideData(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux_midpoint_HLLC(
-        new pdat::SideData<double>(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+        d_scratch_arena->getSideData(interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux_midpoint_HLLC_HLL;
     
     if (d_dim > tbox::Dimension(1))
     {
-        convective_flux_midpoint_HLLC_HLL.reset(new pdat::SideData<double>(
-            interior_box, d_num_eqn, hier::IntVector::getOne(d_dim)));
+        convective_flux_midpoint_HLLC_HLL = d_scratch_arena->getSideData(
+            interior_box, d_num_eqn, hier::IntVector::getOne(d_dim));
     }
     
     HAMERS_SHARED_PTR<pdat::CellData<double> > velocity_derivatives;
@@ -120,17 +159,51 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
     
     if (d_dim > tbox::Dimension(1))
     {
-        velocity_derivatives.reset(new pdat::CellData<double>(
-            interior_box, d_dim.getValue()*d_dim.getValue(), hier::IntVector::getOne(d_dim)*2));
+        velocity_derivatives = d_scratch_arena->getCellData(
+            interior_box, d_dim.getValue()*d_dim.getValue(), hier::IntVector::getOne(d_dim)*2);
         
-        dilatation.reset(new pdat::CellData<double>(
-            interior_box, 1, hier::IntVector::getOne(d_dim)*2));
+        dilatation = d_scratch_arena->getCellData(
+            interior_box, 1, hier::IntVector::getOne(d_dim)*2);
         
-        vorticity_magnitude.reset(new pdat::CellData<double>(
-            interior_box, 1, hier::IntVector::getOne(d_dim)*2));
+        vorticity_magnitude = d_scratch_arena->getCellData(
+            interior_box, 1, hier::IntVector::getOne(d_dim)*2);
         
-        shock_sensor.reset(new pdat::SideData<double>(
-            interior_box, 1, hier::IntVector::getOne(d_dim)));
+        shock_sensor = d_scratch_arena->getSideData(
+            interior_box, 1, hier::IntVector::getOne(d_dim));
+    }
+    
+    /*
+     * If there is a mask of the mid-points, get the boxes of the marked mid-points for the Riemann
+     * solver. The mid-point fluxes outside the boxes are set to zero.
+     */
+    
+    if (d_midpoint_mask)
+    {
+        if (d_dim == tbox::Dimension(1))
+        {
+            computeMidpointBoxes<1>(interior_box);
+        }
+        else if (d_dim == tbox::Dimension(2))
+        {
+            computeMidpointBoxes<2>(interior_box);
+        }
+        else if (d_dim == tbox::Dimension(3))
+        {
+            computeMidpointBoxes<3>(interior_box);
+        }
+        
+        convective_flux_midpoint->fillAll(double(0));
+        convective_flux_midpoint_HLLC->fillAll(double(0));
+        
+        if (convective_flux_midpoint_HLLC_HLL)
+        {
+            convective_flux_midpoint_HLLC_HLL->fillAll(double(0));
+        }
+        
+        if (velocity_midpoint)
+        {
+            velocity_midpoint->fillAll(double(0));
+        }
     }
     
     if (d_dim == tbox::Dimension(1))
@@ -264,11 +337,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > projection_variables;
         
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > characteristic_variables;
-        
-        std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > characteristic_variables_minus;
-        std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > characteristic_variables_plus;
-        
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > primitive_variables_minus;
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > primitive_variables_plus;
         
@@ -284,47 +352,27 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         for (int vi = 0; vi < num_projection_var; vi++)
         {
-            projection_variables.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            projection_variables.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
         }
         
-        characteristic_variables.resize(6);
-        
-        for (int m = 0; m < 6; m++)
-        {
-            characteristic_variables[m].reserve(d_num_eqn);
-            for (int ei = 0; ei < d_num_eqn; ei++)
-            {
-                characteristic_variables[m].push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                    interior_box, 1, hier::IntVector::getOne(d_dim)));
-            }
-        }
-        
-        characteristic_variables_minus.reserve(d_num_eqn);
-        characteristic_variables_plus.reserve(d_num_eqn);
         primitive_variables_minus.reserve(d_num_eqn);
         primitive_variables_plus.reserve(d_num_eqn);
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            characteristic_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            characteristic_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            primitive_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            primitive_variables_minus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
             
-            primitive_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            primitive_variables_plus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
         }
         
-        bounded_flag_minus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        bounded_flag_minus = d_scratch_arena->getSideDataOfIntegers(
+            interior_box, 1, hier::IntVector::getOne(d_dim));
         
-        bounded_flag_plus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        bounded_flag_plus = d_scratch_arena->getSideDataOfIntegers(
+            interior_box, 1, hier::IntVector::getOne(d_dim));
         
         /*
          * Compute the side data of the projection variables for transformation between primitive variables and
@@ -335,40 +383,16 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             projection_variables);
         
         /*
-         * Transform primitive variables to characteristic variables.
+         * Transform primitive variables to characteristic variables, perform WENO interpolation and transform
+         * characteristic variables back to primitive variables in a single pass over each line of faces.
          */
         
-        for (int m = 0; m < 6; m++)
-        {
-            basic_utilities->computeSideDataOfCharacteristicVariablesFromPrimitiveVariables(
-                characteristic_variables[m],
-                primitive_variables,
-                projection_variables,
-                m - 3);
-        }
-        
-        /*
-         * Peform WENO interpolation.
-         */
-        
-        performWENOInterpolation(
-            characteristic_variables_minus,
-            characteristic_variables_plus,
-            characteristic_variables);
-        
-        /*
-         * Transform characteristic variables back to primitive variables.
-         */
-        
-        basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
+        computeInterpolatedPrimitiveVariablesOnFaces<1>(
             primitive_variables_minus,
-            characteristic_variables_minus,
-            projection_variables);
-        
-        basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
             primitive_variables_plus,
-            characteristic_variables_plus,
-            projection_variables);
+            primitive_variables,
+            projection_variables,
+            basic_utilities);
         
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
@@ -436,7 +460,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         if (d_has_advective_eqn_form)
         {
-            riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            computeMidpointConvectiveFluxAndVelocity(
+                riemann_solver,
                 convective_flux_midpoint,
                 velocity_midpoint,
                 primitive_variables_minus,
@@ -446,7 +471,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         else
         {
-            riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            computeMidpointConvectiveFlux(
+                riemann_solver,
                 convective_flux_midpoint,
                 primitive_variables_minus,
                 primitive_variables_plus,
@@ -809,11 +835,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > projection_variables;
         
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > characteristic_variables;
-        
-        std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > characteristic_variables_minus;
-        std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > characteristic_variables_plus;
-        
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > primitive_variables_minus;
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > primitive_variables_plus;
         
@@ -829,47 +850,27 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         for (int vi = 0; vi < num_projection_var; vi++)
         {
-            projection_variables.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            projection_variables.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
         }
         
-        characteristic_variables.resize(6);
-        
-        for (int m = 0; m < 6; m++)
-        {
-            characteristic_variables[m].reserve(d_num_eqn);
-            for (int ei = 0; ei < d_num_eqn; ei++)
-            {
-                characteristic_variables[m].push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                    interior_box, 1, hier::IntVector::getOne(d_dim)));
-            }
-        }
-        
-        characteristic_variables_minus.reserve(d_num_eqn);
-        characteristic_variables_plus.reserve(d_num_eqn);
         primitive_variables_minus.reserve(d_num_eqn);
         primitive_variables_plus.reserve(d_num_eqn);
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            characteristic_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            primitive_variables_minus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
             
-            characteristic_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            primitive_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            primitive_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            primitive_variables_plus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
         }
         
-        bounded_flag_minus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        bounded_flag_minus = d_scratch_arena->getSideDataOfIntegers(
+            interior_box, 1, hier::IntVector::getOne(d_dim));
         
-        bounded_flag_plus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        bounded_flag_plus = d_scratch_arena->getSideDataOfIntegers(
+            interior_box, 1, hier::IntVector::getOne(d_dim));
         
         /*
          * Compute the side data of the projection variables for transformation between primitive variables and
@@ -880,40 +881,16 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             projection_variables);
         
         /*
-         * Transform primitive variables to characteristic variables.
-         */
-        
-        for (int m = 0; m < 6; m++)
-        {
-            basic_utilities->computeSideDataOfCharacteristicVariablesFromPrimitiveVariables(
-                characteristic_variables[m],
-                primitive_variables,
-                projection_variables,
-                m - 3);
-        }
-        
-        /*
-         * Peform WENO interpolation.
+         * Transform primitive variables to characteristic variables, perform WENO interpolation and transform
+         * characteristic variables back to primitive variables in a single pass over each line of faces.
          */
         
-        performWENOInterpolation(
-            characteristic_variables_minus,
-            characteristic_variables_plus,
-            characteristic_variables);
-        
-        /*
-         * Transform characteristic variables back to primitive variables.
-         */
-        
-        basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
+        computeInterpolatedPrimitiveVariablesOnFaces<2>(
             primitive_variables_minus,
-            characteristic_variables_minus,
-            projection_variables);
-        
-        basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
             primitive_variables_plus,
-            characteristic_variables_plus,
-            projection_variables);
+            primitive_variables,
+            projection_variables,
+            basic_utilities);
         
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
@@ -1037,7 +1014,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         if (d_has_advective_eqn_form)
         {
-            riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            computeMidpointConvectiveFluxAndVelocity(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 velocity_midpoint,
                 primitive_variables_minus,
@@ -1047,7 +1025,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         else
         {
-            riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            computeMidpointConvectiveFlux(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 primitive_variables_minus,
                 primitive_variables_plus,
@@ -1055,7 +1034,9 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
                 RIEMANN_SOLVER::HLLC);
         }
         
-        riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+        computeMidpointConvectiveFlux(
+        
+            riemann_solver,
             convective_flux_midpoint_HLLC_HLL,
             primitive_variables_minus,
             primitive_variables_plus,
@@ -1118,7 +1099,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         if (d_has_advective_eqn_form)
         {
-            riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            computeMidpointConvectiveFluxAndVelocity(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 velocity_midpoint,
                 primitive_variables_minus,
@@ -1128,7 +1110,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         else
         {
-            riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            computeMidpointConvectiveFlux(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 primitive_variables_minus,
                 primitive_variables_plus,
@@ -1136,7 +1119,9 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
                 RIEMANN_SOLVER::HLLC);
         }
         
-        riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+        computeMidpointConvectiveFlux(
+        
+            riemann_solver,
             convective_flux_midpoint_HLLC_HLL,
             primitive_variables_minus,
             primitive_variables_plus,
@@ -1737,11 +1722,6 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > projection_variables;
         
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > characteristic_variables;
-        
-        std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > characteristic_variables_minus;
-        std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > characteristic_variables_plus;
-        
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > primitive_variables_minus;
         std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > primitive_variables_plus;
         
@@ -1757,47 +1737,27 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         for (int vi = 0; vi < num_projection_var; vi++)
         {
-            projection_variables.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            projection_variables.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
         }
         
-        characteristic_variables.resize(6);
-        
-        for (int m = 0; m < 6; m++)
-        {
-            characteristic_variables[m].reserve(d_num_eqn);
-            for (int ei = 0; ei < d_num_eqn; ei++)
-            {
-                characteristic_variables[m].push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                    interior_box, 1, hier::IntVector::getOne(d_dim)));
-            }
-        }
-        
-        characteristic_variables_minus.reserve(d_num_eqn);
-        characteristic_variables_plus.reserve(d_num_eqn);
         primitive_variables_minus.reserve(d_num_eqn);
         primitive_variables_plus.reserve(d_num_eqn);
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            characteristic_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            characteristic_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
-                interior_box, 1, hier::IntVector::getOne(d_dim)));
-            
-            primitive_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            primitive_variables_minus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
             
-            primitive_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            primitive_variables_plus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getOne(d_dim)));
         }
         
-        bounded_flag_minus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        bounded_flag_minus = d_scratch_arena->getSideDataOfIntegers(
+            interior_box, 1, hier::IntVector::getOne(d_dim));
         
-        bounded_flag_plus.reset(
-            new pdat::SideData<int>(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        bounded_flag_plus = d_scratch_arena->getSideDataOfIntegers(
+            interior_box, 1, hier::IntVector::getOne(d_dim));
         
         /*
          * Compute the side data of the projection variables for transformation between primitive variables and
@@ -1808,40 +1768,16 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
             projection_variables);
         
         /*
-         * Transform primitive variables to characteristic variables.
+         * Transform primitive variables to characteristic variables, perform WENO interpolation and transform
+         * characteristic variables back to primitive variables in a single pass over each line of faces.
          */
         
-        for (int m = 0; m < 6; m++)
-        {
-            basic_utilities->computeSideDataOfCharacteristicVariablesFromPrimitiveVariables(
-                characteristic_variables[m],
-                primitive_variables,
-                projection_variables,
-                m - 3);
-        }
-        
-        /*
-         * Peform WENO interpolation.
-         */
-        
-        performWENOInterpolation(
-            characteristic_variables_minus,
-            characteristic_variables_plus,
-            characteristic_variables);
-        
-        /*
-         * Transform characteristic variables back to primitive variables.
-         */
-        
-        basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
+        computeInterpolatedPrimitiveVariablesOnFaces<3>(
             primitive_variables_minus,
-            characteristic_variables_minus,
-            projection_variables);
-        
-        basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
             primitive_variables_plus,
-            characteristic_variables_plus,
-            projection_variables);
+            primitive_variables,
+            projection_variables,
+            basic_utilities);
         
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
@@ -2044,7 +1980,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         if (d_has_advective_eqn_form)
         {
-            riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            computeMidpointConvectiveFluxAndVelocity(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 velocity_midpoint,
                 primitive_variables_minus,
@@ -2054,7 +1991,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         else
         {
-            riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            computeMidpointConvectiveFlux(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 primitive_variables_minus,
                 primitive_variables_plus,
@@ -2062,7 +2000,9 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
                 RIEMANN_SOLVER::HLLC);
         }
         
-        riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+        computeMidpointConvectiveFlux(
+        
+            riemann_solver,
             convective_flux_midpoint_HLLC_HLL,
             primitive_variables_minus,
             primitive_variables_plus,
@@ -2139,7 +2079,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         if (d_has_advective_eqn_form)
         {
-            riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            computeMidpointConvectiveFluxAndVelocity(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 velocity_midpoint,
                 primitive_variables_minus,
@@ -2149,7 +2090,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         else
         {
-            riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            computeMidpointConvectiveFlux(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 primitive_variables_minus,
                 primitive_variables_plus,
@@ -2157,7 +2099,9 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
                 RIEMANN_SOLVER::HLLC);
         }
         
-        riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+        computeMidpointConvectiveFlux(
+        
+            riemann_solver,
             convective_flux_midpoint_HLLC_HLL,
             primitive_variables_minus,
             primitive_variables_plus,
@@ -2234,7 +2178,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         
         if (d_has_advective_eqn_form)
         {
-            riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            computeMidpointConvectiveFluxAndVelocity(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 velocity_midpoint,
                 primitive_variables_minus,
@@ -2244,7 +2189,8 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         }
         else
         {
-            riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            computeMidpointConvectiveFlux(
+                riemann_solver,
                 convective_flux_midpoint_HLLC,
                 primitive_variables_minus,
                 primitive_variables_plus,
@@ -2252,7 +2198,9 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
                 RIEMANN_SOLVER::HLLC);
         }
         
-        riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+        computeMidpointConvectiveFlux(
+        
+            riemann_solver,
             convective_flux_midpoint_HLLC_HLL,
             primitive_variables_minus,
             primitive_variables_plus,
@@ -2653,4 +2601,700 @@ ConvectiveFluxReconstructorWCNS56::computeConvectiveFluxAndSourceOnPatch(
         d_flow_model->unregisterPatch();
         
     } // if (d_dim == tbox::Dimension(3))
+    
+    /*
+     * Mark the end of the patch operation in the arenas of the temporary patch data.
+     */
+    
+    d_midpoint_mask.reset();
+    d_midpoint_boxes.clear();
+    
+    d_scratch_arena->reset();
+    riemann_solver->getScratchArena()->reset();
+}
+
+
+/*
+ * Compute the primitive variables on both sides of the faces with WENO interpolation of the characteristic
+ * variables. The transformation of the primitive variables to characteristic variables at the six stencil
+ * offsets, the WENO interpolation and the transformation back to primitive variables are fused into a single
+ * pass over each line of faces such that only temporary buffers of the size of a line are required. The
+ * number of dimensions DIM is a template parameter such that the index arithmetic of the lines is resolved
+ * at compile time.
+ */
+template<int DIM>
+void
+ConvectiveFluxReconstructorWCNS56::computeInterpolatedPrimitiveVariablesOnFaces(
+    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_minus,
+    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_plus,
+    const std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > >& primitive_variables,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& projection_variables,
+    const HAMERS_SHARED_PTR<FlowModelBasicUtilities>& basic_utilities)
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(d_dim.getValue() == DIM);
+#endif
+    
+    const int num_projection_var = static_cast<int>(projection_variables.size());
+    
+    const hier::IntVector interior_dims_vec = primitive_variables_minus[0]->getBox().numberCells();
+    
+    int interior_dims[DIM];
+    for (int dj = 0; dj < DIM; dj++)
+    {
+        interior_dims[dj] = interior_dims_vec[dj];
+    }
+    
+    /*
+     * Get the pointers to the primitive variables. The numbers of ghost cells and the dimensions of the ghost
+     * cell boxes are also determined.
+     */
+    
+    std::vector<const double*> V;
+    V.reserve(d_num_eqn);
+    
+    std::vector<int> num_ghosts_primitive_var;
+    num_ghosts_primitive_var.reserve(d_num_eqn*DIM);
+    
+    std::vector<int> ghostcell_dims_primitive_var;
+    ghostcell_dims_primitive_var.reserve(d_num_eqn*DIM);
+    
+    int count_eqn = 0;
+    
+    for (int vi = 0; vi < static_cast<int>(primitive_variables.size()); vi++)
+    {
+        int depth = primitive_variables[vi]->getDepth();
+        
+        for (int di = 0; di < depth; di++)
+        {
+            // If the last element of the primitive variable vector is not in the system of equations,
+            // ignore it.
+            if (count_eqn >= d_num_eqn)
+                break;
+            
+            V.push_back(primitive_variables[vi]->getPointer(di));
+            
+            const hier::IntVector& num_ghosts_V = primitive_variables[vi]->getGhostCellWidth();
+            const hier::IntVector ghostcell_dims_V = primitive_variables[vi]->getGhostBox().numberCells();
+            
+            for (int dj = 0; dj < DIM; dj++)
+            {
+                num_ghosts_primitive_var.push_back(num_ghosts_V[dj]);
+                ghostcell_dims_primitive_var.push_back(ghostcell_dims_V[dj]);
+            }
+            
+            count_eqn++;
+        }
+    }
+    
+    const hier::IntVector num_ghosts_side_var_vec = primitive_variables_minus[0]->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims_side_var_vec = primitive_variables_minus[0]->getGhostBox().numberCells();
+    
+    const hier::IntVector num_ghosts_projection_var_vec = projection_variables[0]->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims_projection_var_vec = projection_variables[0]->getGhostBox().numberCells();
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(static_cast<int>(V.size()) == d_num_eqn);
+    
+    for (int ei = 0; ei < d_num_eqn; ei++)
+    {
+        for (int dj = 0; dj < DIM; dj++)
+        {
+            TBOX_ASSERT(num_ghosts_primitive_var[ei*DIM + dj] >= 4);
+        }
+        
+        TBOX_ASSERT(primitive_variables_minus[ei]->getGhostCellWidth() == num_ghosts_side_var_vec);
+        TBOX_ASSERT(primitive_variables_plus[ei]->getGhostCellWidth() == num_ghosts_side_var_vec);
+    }
+    
+    TBOX_ASSERT(num_ghosts_side_var_vec >= hier::IntVector::getOne(d_dim));
+    TBOX_ASSERT(num_ghosts_projection_var_vec >= hier::IntVector::getOne(d_dim));
+#endif
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    if (d_midpoint_mask)
+    {
+        TBOX_ASSERT(d_midpoint_mask->getGhostBox().isSpatiallyEqual(primitive_variables_minus[0]->getGhostBox()));
+    }
+#endif
+    
+    int num_ghosts_side_var[DIM];
+    int ghostcell_dims_side_var[DIM];
+    int num_ghosts_projection_var[DIM];
+    int ghostcell_dims_projection_var[DIM];
+    
+    for (int dj = 0; dj < DIM; dj++)
+    {
+        num_ghosts_side_var[dj] = num_ghosts_side_var_vec[dj];
+        ghostcell_dims_side_var[dj] = ghostcell_dims_side_var_vec[dj];
+        num_ghosts_projection_var[dj] = num_ghosts_projection_var_vec[dj];
+        ghostcell_dims_projection_var[dj] = ghostcell_dims_projection_var_vec[dj];
+    }
+    
+    /*
+     * Allocate the temporary buffers of a line. The faces of a line range from the face before the first
+     * interior face to the face after the last interior face. The cells of the stencils of these faces range
+     * from four cells before the first interior cell to four cells after the last interior cell.
+     */
+    
+    const int max_num_faces = interior_dims_vec.max() + 3;
+    const int max_num_cells = interior_dims_vec.max() + 8;
+    
+    std::vector<double> V_line_buffer(d_num_eqn*max_num_cells);
+    std::vector<double> projection_line_buffer(num_projection_var*max_num_faces);
+    std::vector<double> W_line_buffer(6*d_num_eqn*max_num_faces);
+    std::vector<double> W_minus_line_buffer(d_num_eqn*max_num_faces);
+    std::vector<double> W_plus_line_buffer(d_num_eqn*max_num_faces);
+    std::vector<double> V_minus_line_buffer(d_num_eqn*max_num_faces);
+    std::vector<double> V_plus_line_buffer(d_num_eqn*max_num_faces);
+    
+    std::vector<double*> V_line(d_num_eqn);
+    std::vector<std::vector<const double*> > V_line_shifted(6, std::vector<const double*>(d_num_eqn));
+    std::vector<double*> projection_line(num_projection_var);
+    std::vector<const double*> projection_line_const(num_projection_var);
+    std::vector<std::vector<double*> > W_line(6, std::vector<double*>(d_num_eqn));
+    std::vector<double*> W_minus_line(d_num_eqn);
+    std::vector<double*> W_plus_line(d_num_eqn);
+    std::vector<const double*> W_minus_line_const(d_num_eqn);
+    std::vector<const double*> W_plus_line_const(d_num_eqn);
+    std::vector<double*> V_minus_line(d_num_eqn);
+    std::vector<double*> V_plus_line(d_num_eqn);
+    
+    std::vector<int> idx_start_V(d_num_eqn);
+    std::vector<int> stride_line_V(d_num_eqn);
+    
+    // A line has at most one run of faces for every two faces.
+    std::vector<int> run_first((max_num_faces + 1)/2);
+    std::vector<int> run_size((max_num_faces + 1)/2);
+    
+    for (int ei = 0; ei < d_num_eqn; ei++)
+    {
+        V_line[ei] = V_line_buffer.data() + ei*max_num_cells;
+        
+        for (int m = 0; m < 6; m++)
+        {
+            // The stencil of each face at offset (m - 3) is the line of cells shifted by m.
+            V_line_shifted[m][ei] = V_line[ei] + m;
+            W_line[m][ei] = W_line_buffer.data() + (m*d_num_eqn + ei)*max_num_faces;
+        }
+        
+        W_minus_line[ei] = W_minus_line_buffer.data() + ei*max_num_faces;
+        W_plus_line[ei] = W_plus_line_buffer.data() + ei*max_num_faces;
+        W_minus_line_const[ei] = W_minus_line[ei];
+        W_plus_line_const[ei] = W_plus_line[ei];
+        V_minus_line[ei] = V_minus_line_buffer.data() + ei*max_num_faces;
+        V_plus_line[ei] = V_plus_line_buffer.data() + ei*max_num_faces;
+    }
+    
+    for (int vi = 0; vi < num_projection_var; vi++)
+    {
+        projection_line[vi] = projection_line_buffer.data() + vi*max_num_faces;
+        projection_line_const[vi] = projection_line[vi];
+    }
+    
+    for (int di = 0; di < DIM; di++)
+    {
+        const DIRECTION::TYPE direction = static_cast<DIRECTION::TYPE>(di);
+        
+        const int num_faces = interior_dims[di] + 3;
+        const int num_cells = interior_dims[di] + 8;
+        
+        /*
+         * The lines of faces in the direction cover the interior of the patch in the other directions.
+         */
+        
+        int line_dims[DIM];
+        int num_lines = 1;
+        for (int dj = 0; dj < DIM; dj++)
+        {
+            line_dims[dj] = (dj == di ? 1 : interior_dims[dj]);
+            num_lines *= line_dims[dj];
+        }
+        
+        int idx_line[DIM];
+        
+        for (int li = 0; li < num_lines; li++)
+        {
+            int li_remainder = li;
+            for (int dj = 0; dj < DIM; dj++)
+            {
+                idx_line[dj] = li_remainder%line_dims[dj];
+                li_remainder /= line_dims[dj];
+            }
+            
+            int idx_start = 0;
+            int stride_line = 1;
+            
+            int idx_start_side = 0;
+            int stride_line_side = 1;
+            
+            computeLineStartAndStride<DIM>(
+                idx_start_side,
+                stride_line_side,
+                idx_line,
+                -1,
+                num_ghosts_side_var,
+                ghostcell_dims_side_var,
+                di,
+                true);
+            
+            for (int ei = 0; ei < d_num_eqn; ei++)
+            {
+                computeLineStartAndStride<DIM>(
+                    idx_start_V[ei],
+                    stride_line_V[ei],
+                    idx_line,
+                    -4,
+                    &num_ghosts_primitive_var[ei*DIM],
+                    &ghostcell_dims_primitive_var[ei*DIM],
+                    di,
+                    false);
+            }
+            
+            /*
+             * Find the runs of consecutive faces of the line that are interpolated. If there is a mask of
+             * the mid-points, the runs are the marked faces of the line and the other faces take the first
+             * order values of the neighboring cells. Otherwise, the whole line is a single run.
+             */
+            
+            int num_runs = 0;
+            
+            if (d_midpoint_mask)
+            {
+                const int* const mask = d_midpoint_mask->getPointer(di);
+                
+                for (int fi = 0; fi < num_faces; fi++)
+                {
+                    if (mask[idx_start_side + fi*stride_line_side] == 1)
+                    {
+                        if (fi == 0 || mask[idx_start_side + (fi - 1)*stride_line_side] != 1)
+                        {
+                            run_first[num_runs] = fi;
+                            run_size[num_runs] = 0;
+                            num_runs++;
+                        }
+                        
+                        run_size[num_runs - 1]++;
+                    }
+                }
+                
+                for (int ei = 0; ei < d_num_eqn; ei++)
+                {
+                    const double* const V_ei = V[ei];
+                    double* const V_minus_ei = primitive_variables_minus[ei]->getPointer(di);
+                    double* const V_plus_ei = primitive_variables_plus[ei]->getPointer(di);
+                    
+                    for (int fi = 0; fi < num_faces; fi++)
+                    {
+                        if (mask[idx_start_side + fi*stride_line_side] != 1)
+                        {
+                            // The face fi is between the cells (fi + 2) and (fi + 3) of the line of cells.
+                            V_minus_ei[idx_start_side + fi*stride_line_side] =
+                                V_ei[idx_start_V[ei] + (fi + 2)*stride_line_V[ei]];
+                            V_plus_ei[idx_start_side + fi*stride_line_side] =
+                                V_ei[idx_start_V[ei] + (fi + 3)*stride_line_V[ei]];
+                        }
+                    }
+                }
+            }
+            else
+            {
+                run_first[0] = 0;
+                run_size[0] = num_faces;
+                num_runs = 1;
+            }
+            
+            if (num_runs == 0)
+            {
+                continue;
+            }
+            
+            computeLineStartAndStride<DIM>(
+                idx_start,
+                stride_line,
+                idx_line,
+                -1,
+                num_ghosts_projection_var,
+                ghostcell_dims_projection_var,
+                di,
+                true);
+            
+            for (int ri = 0; ri < num_runs; ri++)
+            {
+                const int fi_first = run_first[ri];
+                const int num_faces_interpolated = run_size[ri];
+                
+                /*
+                 * Gather the primitive variables in the cells of the stencils of the faces of the run.
+                 */
+                
+                for (int ei = 0; ei < d_num_eqn; ei++)
+                {
+                    const double* const V_ei = V[ei];
+                    double* const V_line_ei = V_line[ei];
+                    
+                    for (int ci = 0; ci < num_faces_interpolated + 5; ci++)
+                    {
+                        V_line_ei[ci] = V_ei[idx_start_V[ei] + (fi_first + ci)*stride_line_V[ei]];
+                    }
+                }
+                
+                /*
+                 * Gather the projection variables at the faces of the run.
+                 */
+                
+                for (int vi = 0; vi < num_projection_var; vi++)
+                {
+                    const double* const projection_vi = projection_variables[vi]->getPointer(di);
+                    double* const projection_line_vi = projection_line[vi];
+                    
+                    for (int fi = 0; fi < num_faces_interpolated; fi++)
+                    {
+                        projection_line_vi[fi] = projection_vi[idx_start + (fi_first + fi)*stride_line];
+                    }
+                }
+                
+                /*
+                 * Transform primitive variables to characteristic variables at the six stencil offsets.
+                 */
+                
+                for (int m = 0; m < 6; m++)
+                {
+                    basic_utilities->computeCharacteristicVariablesFromPrimitiveVariablesOnFaceLine(
+                        W_line[m],
+                        V_line_shifted[m],
+                        projection_line_const,
+                        direction,
+                        num_faces_interpolated);
+                }
+                
+                /*
+                 * Peform WENO interpolation.
+                 */
+                
+                performWENOInterpolation(
+                    W_minus_line,
+                    W_plus_line,
+                    W_line,
+                    direction,
+                    num_faces_interpolated);
+                
+                /*
+                 * Transform characteristic variables back to primitive variables.
+                 */
+                
+                basic_utilities->computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine(
+                    V_minus_line,
+                    W_minus_line_const,
+                    projection_line_const,
+                    direction,
+                    num_faces_interpolated);
+                
+                basic_utilities->computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine(
+                    V_plus_line,
+                    W_plus_line_const,
+                    projection_line_const,
+                    direction,
+                    num_faces_interpolated);
+                
+                /*
+                 * Scatter the interpolated primitive variables to the faces of the run.
+                 */
+                
+                for (int ei = 0; ei < d_num_eqn; ei++)
+                {
+                    double* const V_minus_ei = primitive_variables_minus[ei]->getPointer(di);
+                    double* const V_plus_ei = primitive_variables_plus[ei]->getPointer(di);
+                    
+                    const double* const V_minus_line_ei = V_minus_line[ei];
+                    const double* const V_plus_line_ei = V_plus_line[ei];
+                    
+                    for (int fi = 0; fi < num_faces_interpolated; fi++)
+                    {
+                        V_minus_ei[idx_start_side + (fi_first + fi)*stride_line_side] = V_minus_line_ei[fi];
+                        V_plus_ei[idx_start_side + (fi_first + fi)*stride_line_side] = V_plus_line_ei[fi];
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Compute the boxes of cells whose faces in each direction cover the runs of consecutive marked mid-points of
+ * the mask. A run of the mid-points from a to b of a line is covered by the faces of the cells from a to b - 1,
+ * or by the faces of a single cell if the run has only one mid-point. The runs with the same extent on lines
+ * that are adjacent in the first of the other directions are merged into a single box such that the Riemann
+ * solver is called once for a band of runs. The number of dimensions DIM is a template parameter such that the
+ * index arithmetic of the lines is resolved at compile time.
+ */
+template<int DIM>
+void
+ConvectiveFluxReconstructorWCNS56::computeMidpointBoxes(
+    const hier::Box& interior_box)
+{
+    const hier::IntVector interior_dims_vec = interior_box.numberCells();
+    const hier::IntVector num_ghosts_mask_vec = d_midpoint_mask->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims_mask_vec = d_midpoint_mask->getGhostBox().numberCells();
+    
+    int interior_dims[DIM];
+    int num_ghosts_mask[DIM];
+    int ghostcell_dims_mask[DIM];
+    
+    for (int dj = 0; dj < DIM; dj++)
+    {
+        interior_dims[dj] = interior_dims_vec[dj];
+        num_ghosts_mask[dj] = num_ghosts_mask_vec[dj];
+        ghostcell_dims_mask[dj] = ghostcell_dims_mask_vec[dj];
+    }
+    
+    d_midpoint_boxes.resize(DIM);
+    
+    /*
+     * Allocate the extents of the runs in the direction and the first lines of the open boxes. A line has at
+     * most one run of mid-points for every two mid-points.
+     */
+    
+    const int max_num_runs = (interior_dims_vec.max() + 4)/2;
+    
+    std::vector<int> open_lo(max_num_runs);
+    std::vector<int> open_hi(max_num_runs);
+    std::vector<int> open_first(max_num_runs);
+    std::vector<int> line_lo(max_num_runs);
+    std::vector<int> line_hi(max_num_runs);
+    std::vector<int> line_first(max_num_runs);
+    
+    for (int di = 0; di < DIM; di++)
+    {
+        d_midpoint_boxes[di].clear();
+        
+        const int* const mask = d_midpoint_mask->getPointer(di);
+        
+        const int num_midpoints = interior_dims[di] + 3;
+        
+        // The lines are merged in the first of the other directions. There is no other direction in 1D.
+        const int dm = (di == 0 && DIM > 1 ? 1 : 0);
+        
+        int line_dims[DIM];
+        int num_lines = 1;
+        for (int dj = 0; dj < DIM; dj++)
+        {
+            line_dims[dj] = (dj == di ? 1 : interior_dims[dj]);
+            num_lines *= line_dims[dj];
+        }
+        
+        int idx_line[DIM];
+        int idx_line_last[DIM];
+        
+        int num_open = 0;
+        
+        for (int li = 0; li <= num_lines; li++)
+        {
+            int num_line = 0;
+            
+            if (li < num_lines)
+            {
+                int li_remainder = li;
+                for (int dj = 0; dj < DIM; dj++)
+                {
+                    idx_line[dj] = li_remainder%line_dims[dj];
+                    li_remainder /= line_dims[dj];
+                }
+                
+                int idx_start = 0;
+                int stride_line = 1;
+                
+                computeLineStartAndStride<DIM>(
+                    idx_start,
+                    stride_line,
+                    idx_line,
+                    -1,
+                    num_ghosts_mask,
+                    ghostcell_dims_mask,
+                    di,
+                    true);
+                
+                /*
+                 * Find the cells whose faces cover the runs of the line. The mid-point mi is at the face
+                 * (mi - 1) of the patch.
+                 */
+                
+                for (int mi = 0; mi < num_midpoints; mi++)
+                {
+                    if (mask[idx_start + mi*stride_line] == 1)
+                    {
+                        if (mi == 0 || mask[idx_start + (mi - 1)*stride_line] != 1)
+                        {
+                            line_lo[num_line] = std::min(mi - 1, interior_dims[di]);
+                            num_line++;
+                        }
+                        
+                        if (mi == num_midpoints - 1 || mask[idx_start + (mi + 1)*stride_line] != 1)
+                        {
+                            line_hi[num_line - 1] = std::max(mi - 2, line_lo[num_line - 1]);
+                        }
+                    }
+                }
+            }
+            
+            /*
+             * Extend the open boxes with the runs of the same extent on the next line in the direction dm.
+             * The other open boxes are closed.
+             */
+            
+            const bool is_adjacent = (DIM > 1 && li < num_lines && idx_line[dm] > 0);
+            
+            int oi = 0;
+            for (int ri = 0; ri < num_line; ri++)
+            {
+                line_first[ri] = (DIM > 1 ? idx_line[dm] : 0);
+                
+                if (is_adjacent)
+                {
+                    while (oi < num_open && open_lo[oi] < line_lo[ri])
+                    {
+                        oi++;
+                    }
+                    
+                    if (oi < num_open && open_lo[oi] == line_lo[ri] && open_hi[oi] == line_hi[ri])
+                    {
+                        line_first[ri] = open_first[oi];
+                        open_first[oi] = -1;
+                    }
+                }
+            }
+            
+            for (oi = 0; oi < num_open; oi++)
+            {
+                if (open_first[oi] >= 0)
+                {
+                    hier::Index box_lo(interior_box.lower());
+                    hier::Index box_hi(interior_box.lower());
+                    
+                    for (int dj = 0; dj < DIM; dj++)
+                    {
+                        if (dj == di)
+                        {
+                            box_lo[dj] += open_lo[oi];
+                            box_hi[dj] += open_hi[oi];
+                        }
+                        else if (dj == dm)
+                        {
+                            box_lo[dj] += open_first[oi];
+                            box_hi[dj] += idx_line_last[dj];
+                        }
+                        else
+                        {
+                            box_lo[dj] += idx_line_last[dj];
+                            box_hi[dj] += idx_line_last[dj];
+                        }
+                    }
+                    
+                    d_midpoint_boxes[di].pushBack(hier::Box(box_lo, box_hi, interior_box.getBlockId()));
+                }
+            }
+            
+            for (int ri = 0; ri < num_line; ri++)
+            {
+                open_lo[ri] = line_lo[ri];
+                open_hi[ri] = line_hi[ri];
+                open_first[ri] = line_first[ri];
+            }
+            
+            num_open = num_line;
+            
+            for (int dj = 0; dj < DIM; dj++)
+            {
+                idx_line_last[dj] = idx_line[dj];
+            }
+        }
+    }
+}
+
+
+/*
+ * Compute the mid-point flux with the Riemann solver on the boxes of the marked mid-points in the direction, or
+ * on all mid-points if there is no mask.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::computeMidpointConvectiveFlux(
+    const HAMERS_SHARED_PTR<FlowModelRiemannSolver>& riemann_solver,
+    const HAMERS_SHARED_PTR<pdat::SideData<double> >& convective_flux_midpoint,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_minus,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_plus,
+    const DIRECTION::TYPE& direction,
+    const RIEMANN_SOLVER::TYPE& riemann_solver_type) const
+{
+    if (d_midpoint_mask)
+    {
+        const hier::BoxContainer& midpoint_boxes = d_midpoint_boxes[static_cast<int>(direction)];
+        
+        for (hier::BoxContainer::const_iterator ib(midpoint_boxes.begin());
+             ib != midpoint_boxes.end();
+             ib++)
+        {
+            riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+                convective_flux_midpoint,
+                primitive_variables_minus,
+                primitive_variables_plus,
+                direction,
+                riemann_solver_type,
+                *ib);
+        }
+    }
+    else
+    {
+        riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            convective_flux_midpoint,
+            primitive_variables_minus,
+            primitive_variables_plus,
+            direction,
+            riemann_solver_type);
+    }
+}
+
+
+/*
+ * Compute the mid-point flux and velocity with the Riemann solver on the boxes of the marked mid-points in the
+ * direction, or on all mid-points if there is no mask.
+ */
+void
+ConvectiveFluxReconstructorWCNS56::computeMidpointConvectiveFluxAndVelocity(
+    const HAMERS_SHARED_PTR<FlowModelRiemannSolver>& riemann_solver,
+    const HAMERS_SHARED_PTR<pdat::SideData<double> >& convective_flux_midpoint,
+    const HAMERS_SHARED_PTR<pdat::SideData<double> >& velocity_midpoint,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_minus,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& primitive_variables_plus,
+    const DIRECTION::TYPE& direction,
+    const RIEMANN_SOLVER::TYPE& riemann_solver_type) const
+{
+    if (d_midpoint_mask)
+    {
+        const hier::BoxContainer& midpoint_boxes = d_midpoint_boxes[static_cast<int>(direction)];
+        
+        for (hier::BoxContainer::const_iterator ib(midpoint_boxes.begin());
+             ib != midpoint_boxes.end();
+             ib++)
+        {
+            riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+                convective_flux_midpoint,
+                velocity_midpoint,
+                primitive_variables_minus,
+                primitive_variables_plus,
+                direction,
+                riemann_solver_type,
+                *ib);
+        }
+    }
+    else
+    {
+        riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            convective_flux_midpoint,
+            velocity_midpoint,
+            primitive_variables_minus,
+            primitive_variables_plus,
+            direction,
+            riemann_solver_type);
+    }
 }
@@ -1,25 +1,11 @@
 #include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS6-CU-M2-HLLC-HLL.hpp"
+#include "util/IntegerPower.hpp"
 
 #include <cfloat>
 
 #include "SAMRAI/geom/CartesianPatchGeometry.h"
 
 
-/*
- * Interger based power function.
- */
-static inline __attribute__((always_inline)) double ipow(double base, const int& exp)
-{
-    double result = base;
-    for (int i = 1; i < exp; i++)
-    {
-        result *= base;
-    }
-
-    return result;
-}
-
-
 /*
  * Compute local beta's.
  */
@@ -109,6 +95,7 @@ static inline __attribute__((always_inline)) void computeLocalBetaTilde(
 /*
  * Perform local WENO interpolation of U_minus.
  */
+template<int Q>
 static inline __attribute__((always_inline)) void performLocalWENOInterpolationMinus(
     double* U_minus,
     double** U_array,
@@ -136,13 +123,13 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationM
     double beta_avg = double(1)/double(8)*(beta_0 + beta_2 + 6*beta_1);
     double tau_6 = fabs(beta_3 - beta_avg);
     
-    omega_0 = double(1)/double(32)*ipow(C + tau_6/(beta_0 + epsilon*dx*dx)*
+    omega_0 = double(1)/double(32)*IntegerPower<Q>::compute(C + tau_6/(beta_0 + epsilon*dx*dx)*
         (beta_avg + Chi*dx*dx)/(beta_0 + Chi*dx*dx), q);
-    omega_1 = double(15)/double(32)*ipow(C + tau_6/(beta_1 + epsilon*dx*dx)*
+    omega_1 = double(15)/double(32)*IntegerPower<Q>::compute(C + tau_6/(beta_1 + epsilon*dx*dx)*
         (beta_avg + Chi*dx*dx)/(beta_1 + Chi*dx*dx), q);
-    omega_2 = double(15)/double(32)*ipow(C + tau_6/(beta_2 + epsilon*dx*dx)*
+    omega_2 = double(15)/double(32)*IntegerPower<Q>::compute(C + tau_6/(beta_2 + epsilon*dx*dx)*
         (beta_avg + Chi*dx*dx)/(beta_2 + Chi*dx*dx), q);
-    omega_3 = double(1)/double(32)*ipow(C + tau_6/(beta_3 + epsilon*dx*dx)*
+    omega_3 = double(1)/double(32)*IntegerPower<Q>::compute(C + tau_6/(beta_3 + epsilon*dx*dx)*
         (beta_avg + Chi*dx*dx)/(beta_3 + Chi*dx*dx), q);
     
     double omega_sum = omega_0 + omega_1 + omega_2 + omega_3;
@@ -170,6 +157,7 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationM
 /*
  * Perform local WENO interpolation of U_plus.
  */
+template<int Q>
 static inline __attribute__((always_inline)) void performLocalWENOInterpolationPlus(
     double* U_plus,
     double** U_array,
@@ -197,13 +185,13 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationP
     double beta_avg_tilde = double(1)/double(8)*(beta_tilde_0 + beta_tilde_2 + 6*beta_tilde_1);
     double tau_6_tilde = fabs(beta_tilde_3 - beta_avg_tilde);
     
-    omega_tilde_0 = double(1)/double(32)*ipow(C + tau_6_tilde/(beta_tilde_0 + epsilon*dx*dx)*
+    omega_tilde_0 = double(1)/double(32)*IntegerPower<Q>::compute(C + tau_6_tilde/(beta_tilde_0 + epsilon*dx*dx)*
         (beta_avg_tilde + Chi*dx*dx)/(beta_tilde_0 + Chi*dx*dx), q);
-    omega_tilde_1 = double(15)/double(32)*ipow(C + tau_6_tilde/(beta_tilde_1 + epsilon*dx*dx)*
+    omega_tilde_1 = double(15)/double(32)*IntegerPower<Q>::compute(C + tau_6_tilde/(beta_tilde_1 + epsilon*dx*dx)*
         (beta_avg_tilde + Chi*dx*dx)/(beta_tilde_1 + Chi*dx*dx), q);
-    omega_tilde_2 = double(15)/double(32)*ipow(C + tau_6_tilde/(beta_tilde_2 + epsilon*dx*dx)*
+    omega_tilde_2 = double(15)/double(32)*IntegerPower<Q>::compute(C + tau_6_tilde/(beta_tilde_2 + epsilon*dx*dx)*
         (beta_avg_tilde + Chi*dx*dx)/(beta_tilde_2 + Chi*dx*dx), q);
-    omega_tilde_3 = double(1)/double(32)*ipow(C + tau_6_tilde/(beta_tilde_3 + epsilon*dx*dx)*
+    omega_tilde_3 = double(1)/double(32)*IntegerPower<Q>::compute(C + tau_6_tilde/(beta_tilde_3 + epsilon*dx*dx)*
         (beta_avg_tilde + Chi*dx*dx)/(beta_tilde_3 + Chi*dx*dx), q);
     
     double omega_tilde_sum = omega_tilde_0 + omega_tilde_1 + omega_tilde_2 + omega_tilde_3;
@@ -320,572 +308,120 @@ ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::putToRestart(
 
 
 /*
- * Perform WENO interpolation.
+ * Perform WENO interpolation on a line of faces with the exponent Q of the nonlinear weights fixed at
+ * compile time. The exponent q of the input database is used if Q is zero.
  */
+template<int Q>
 void
-ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
-    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_minus,
-    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_plus,
-    const std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > >& variables)
+ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolationWithExponent(
+    std::vector<double*>& variables_minus,
+    std::vector<double*>& variables_plus,
+    const std::vector<std::vector<double*> >& variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
 {
 #ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
     TBOX_ASSERT(static_cast<int>(variables_minus.size()) == d_num_eqn);
     TBOX_ASSERT(static_cast<int>(variables_plus.size()) == d_num_eqn);
     
     TBOX_ASSERT(static_cast<int>(variables.size()) == 6);
-#endif
-    
-    /*
-     * Get the interior dimensions.
-     */
-    
-    const hier::IntVector interior_dims = variables_minus[0]->getBox().numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
-    for (int ei = 0; ei < d_num_eqn; ei++)
-    {
-        TBOX_ASSERT(variables_minus[ei]->getBox().numberCells() == interior_dims);
-        TBOX_ASSERT(variables_plus[ei]->getBox().numberCells() == interior_dims);
-        
-        TBOX_ASSERT(variables_minus[ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-        TBOX_ASSERT(variables_plus[ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-    }
-    
-    TBOX_ASSERT(static_cast<int>(variables.size()) == 6);
     
     for (int m = 0; m < 6; m++)
     {
         TBOX_ASSERT(static_cast<int>(variables[m].size()) == d_num_eqn);
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(variables[m][ei]->getBox().numberCells() == interior_dims);
-            TBOX_ASSERT(variables[m][ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-        }
     }
 #endif
     
     const double* const grid_spacing = d_grid_geometry->getDx();
-    double dx = 0.0;
+    const double dx = grid_spacing[static_cast<int>(direction)];
     
-    if (d_dim == tbox::Dimension(1))
+    for (int ei = 0; ei < d_num_eqn; ei++)
     {
-        /*
-         * Get the dimension.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
+        double* U_array[6];
         
-        dx = grid_spacing[0];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        for (int m = 0; m < 6; m++)
         {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = -1; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index of the mid-point.
-                const int idx_midpoint_x = i + 1;
-                
-                performLocalWENOInterpolationMinus(
-                    U_L,
-                    U_array.data(),
-                    idx_midpoint_x,
-                    d_constant_q,
-                    d_constant_C,
-                    d_constant_Chi,
-                    d_constant_epsilon,
-                    dx);
-            }
+            U_array[m] = variables[m][ei];
         }
         
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = -1; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index of the mid-point.
-                const int idx_midpoint_x = i + 1;
-                
-                performLocalWENOInterpolationPlus(
-                    U_R,
-                    U_array.data(),
-                    idx_midpoint_x,
-                    d_constant_q,
-                    d_constant_C,
-                    d_constant_Chi,
-                    d_constant_epsilon,
-                    dx);
-            }
-        }
-        
-    } // if (d_dim == tbox::Dimension(1))
-    else if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
+        double* U_minus = variables_minus[ei];
+        double* U_plus = variables_plus[ei];
         
-        dx = grid_spacing[0];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-            for (int j = 0; j < interior_dim_1; j++)
-            {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
+        #pragma omp simd
 #endif
-                for (int i = -1; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_x = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 3);
-                    
-                    performLocalWENOInterpolationMinus(
-                        U_L,
-                        U_array.data(),
-                        idx_midpoint_x,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_Chi,
-                        d_constant_epsilon,
-                        dx);
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        for (int idx_face = 0; idx_face < num_faces; idx_face++)
         {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -1; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_x = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 3);
-                    
-                    performLocalWENOInterpolationPlus(
-                        U_R,
-                        U_array.data(),
-                        idx_midpoint_x,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_Chi,
-                        d_constant_epsilon,
-                        dx);
-                }
-            }
-        }
-        
-        /*
-         * Peform WENO interpolation in the y-direction.
-         */
-        
-        dx = grid_spacing[1];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(1);
-            
-            for (int j = -1; j < interior_dim_1 + 2; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_y = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2);
-                    
-                    performLocalWENOInterpolationMinus(
-                        U_B,
-                        U_array.data(),
-                        idx_midpoint_y,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_Chi,
-                        d_constant_epsilon,
-                        dx);
-                }
-            }
+            performLocalWENOInterpolationMinus<Q>(
+                U_minus,
+                U_array,
+                idx_face,
+                d_constant_q,
+                d_constant_C,
+                d_constant_Chi,
+                d_constant_epsilon,
+                dx);
+            
+            performLocalWENOInterpolationPlus<Q>(
+                U_plus,
+                U_array,
+                idx_face,
+                d_constant_q,
+                d_constant_C,
+                d_constant_Chi,
+                d_constant_epsilon,
+                dx);
         }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_T = variables_plus[ei]->getPointer(1);
-            
-            for (int j = -1; j < interior_dim_1 + 2; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_y = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2);
-                    
-                    performLocalWENOInterpolationPlus(
-                        U_T,
-                        U_array.data(),
-                        idx_midpoint_y,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_Chi,
-                        d_constant_epsilon,
-                        dx);
-                }
-            }
-        }
-        
-    } // if (d_dim == tbox::Dimension(2))
-    else if (d_dim == tbox::Dimension(3))
+    }
+}
+
+
+/*
+ * Perform WENO interpolation on a line of faces. The kernel with the exponent of the nonlinear weights
+ * fixed at compile time is used for the common values of the exponent.
+ */
+void
+ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL::performWENOInterpolation(
+    std::vector<double*>& variables_minus,
+    std::vector<double*>& variables_plus,
+    const std::vector<std::vector<double*> >& variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
+{
+    if (d_constant_q == 2)
     {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
-        
-        dx = grid_spacing[0];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -1; i < interior_dim_0 + 2; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_x = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 3) +
-                            (k + 1)*(interior_dim_0 + 3)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_L,
-                            U_array.data(),
-                            idx_midpoint_x,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_Chi,
-                            d_constant_epsilon,
-                            dx);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -1; i < interior_dim_0 + 2; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_x = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 3) +
-                            (k + 1)*(interior_dim_0 + 3)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_R,
-                            U_array.data(),
-                            idx_midpoint_x,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_Chi,
-                            d_constant_epsilon,
-                            dx);
-                    }
-                }
-            }
-        }
-        
-        /*
-         * Peform WENO interpolation in the y-direction.
-         */
-        
-        dx = grid_spacing[1];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(1);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = -1; j < interior_dim_1 + 2; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_y = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 3);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_B,
-                            U_array.data(),
-                            idx_midpoint_y,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_Chi,
-                            d_constant_epsilon,
-                            dx);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_T = variables_plus[ei]->getPointer(1);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = -1; j < interior_dim_1 + 2; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_y = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 3);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_T,
-                            U_array.data(),
-                            idx_midpoint_y,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_Chi,
-                            d_constant_epsilon,
-                            dx);
-                    }
-                }
-            }
-        }
-        
-        /*
-         * Peform WENO interpolation in the z-direction.
-         */
-        
-        dx = grid_spacing[2];
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(2));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(2);
-            
-            for (int k = -1; k < interior_dim_2 + 2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_z = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_B,
-                            U_array.data(),
-                            idx_midpoint_z,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_Chi,
-                            d_constant_epsilon,
-                            dx);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(2));
-            }
-            
-            double* U_F = variables_plus[ei]->getPointer(2);
-            
-            for (int k = -1; k < interior_dim_2 + 2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_z = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_F,
-                            U_array.data(),
-                            idx_midpoint_z,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_Chi,
-                            d_constant_epsilon,
-                            dx);
-                    }
-                }
-            }
-        }
-        
-    } // if (d_dim == tbox::Dimension(3))
+        performWENOInterpolationWithExponent<2>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_q == 4)
+    {
+        performWENOInterpolationWithExponent<4>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_q == 6)
+    {
+        performWENOInterpolationWithExponent<6>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else
+    {
+        performWENOInterpolationWithExponent<0>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
 }
@@ -1,23 +1,9 @@
 #include "flow/convective_flux_reconstructors/WCNS56/ConvectiveFluxReconstructorWCNS6-LD-HLLC-HLL.hpp"
+#include "flow/convective_flux_reconstructors/WCNS56/WCNS56NonlinearWeights.hpp"
 
 #define EPSILON HAMERS_EPSILON
 
 
-/*
- * Interger based power function.
- */
-static inline __attribute__((always_inline)) double ipow(double base, const int& exp)
-{
-    double result = base;
-    for (int i = 1; i < exp; i++)
-    {
-        result *= base;
-    }
-
-    return result;
-}
-
-
 /*
  * Compute local sigma.
  */
@@ -130,6 +116,7 @@ static inline __attribute__((always_inline)) void computeLocalBetaTilde(
 /*
  * Perform local WENO interpolation of U_minus.
  */
+template<int P, int Q>
 static inline __attribute__((always_inline)) void performLocalWENOInterpolationMinus(
     double* U_minus,
     double** U_array,
@@ -163,9 +150,9 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationM
     
     double tau_5 = fabs(beta_0 - beta_2);
     
-    omega_upwind_0 = double(1)/double(16)*(double(1) + ipow(tau_5/(beta_0 + EPSILON), p));
-    omega_upwind_1 = double(5)/double(8)*(double(1) + ipow(tau_5/(beta_1 + EPSILON), p));
-    omega_upwind_2 = double(5)/double(16)*(double(1) + ipow(tau_5/(beta_2 + EPSILON), p));
+    omega_upwind_0 = double(1)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5/(beta_0 + EPSILON), p));
+    omega_upwind_1 = double(5)/double(8)*(double(1) + IntegerPower<P>::compute(tau_5/(beta_1 + EPSILON), p));
+    omega_upwind_2 = double(5)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5/(beta_2 + EPSILON), p));
     
     double omega_upwind_sum = omega_upwind_0 + omega_upwind_1 + omega_upwind_2;
     
@@ -178,21 +165,10 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationM
      */
     
     double omega_0, omega_1, omega_2, omega_3;
+    double beta_avg, tau_6;
     
-    double beta_avg = double(1)/double(8)*(beta_0 + beta_2 + double(6)*beta_1);
-    double tau_6 = fabs(beta_3 - beta_avg);
-    
-    omega_0 = double(1)/double(32)*(C + ipow(tau_6/(beta_0 + EPSILON), q));
-    omega_1 = double(15)/double(32)*(C + ipow(tau_6/(beta_1 + EPSILON), q));
-    omega_2 = double(15)/double(32)*(C + ipow(tau_6/(beta_2 + EPSILON), q));
-    omega_3 = double(1)/double(32)*(C + ipow(tau_6/(beta_3 + EPSILON), q));
-    
-    double omega_sum = omega_0 + omega_1 + omega_2 + omega_3;
-    
-    omega_0 = omega_0/omega_sum;
-    omega_1 = omega_1/omega_sum;
-    omega_2 = omega_2/omega_sum;
-    omega_3 = omega_3/omega_sum;
+    computeCentralWeightsWCNS6LD<Q>(omega_0, omega_1, omega_2, omega_3, beta_avg, tau_6,
+        beta_0, beta_1, beta_2, beta_3, q, C);
     
     /*
      * Compute the weights omega.
@@ -226,6 +202,7 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationM
 /*
  * Perform local WENO interpolation of U_plus.
  */
+template<int P, int Q>
 static inline __attribute__((always_inline)) void performLocalWENOInterpolationPlus(
     double* U_plus,
     double** U_array,
@@ -259,9 +236,9 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationP
     
     double tau_5_tilde = fabs(beta_tilde_0 - beta_tilde_2);
     
-    omega_upwind_tilde_0 = double(1)/double(16)*(double(1) + ipow(tau_5_tilde/(beta_tilde_0 + EPSILON), p));
-    omega_upwind_tilde_1 = double(5)/double(8)*(double(1) + ipow(tau_5_tilde/(beta_tilde_1 + EPSILON), p));
-    omega_upwind_tilde_2 = double(5)/double(16)*(double(1) + ipow(tau_5_tilde/(beta_tilde_2 + EPSILON), p));
+    omega_upwind_tilde_0 = double(1)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5_tilde/(beta_tilde_0 + EPSILON), p));
+    omega_upwind_tilde_1 = double(5)/double(8)*(double(1) + IntegerPower<P>::compute(tau_5_tilde/(beta_tilde_1 + EPSILON), p));
+    omega_upwind_tilde_2 = double(5)/double(16)*(double(1) + IntegerPower<P>::compute(tau_5_tilde/(beta_tilde_2 + EPSILON), p));
     
     double omega_upwind_tilde_sum = omega_upwind_tilde_0 + omega_upwind_tilde_1 + omega_upwind_tilde_2;
     
@@ -274,21 +251,10 @@ static inline __attribute__((always_inline)) void performLocalWENOInterpolationP
      */
     
     double omega_tilde_0, omega_tilde_1, omega_tilde_2, omega_tilde_3;
+    double beta_avg_tilde, tau_6_tilde;
     
-    double beta_avg_tilde = double(1)/double(8)*(beta_tilde_0 + beta_tilde_2 + double(6)*beta_tilde_1);
-    double tau_6_tilde = fabs(beta_tilde_3 - beta_avg_tilde);
-    
-    omega_tilde_0 = double(1)/double(32)*(C + ipow(tau_6_tilde/(beta_tilde_0 + EPSILON), q));
-    omega_tilde_1 = double(15)/double(32)*(C + ipow(tau_6_tilde/(beta_tilde_1 + EPSILON), q));
-    omega_tilde_2 = double(15)/double(32)*(C + ipow(tau_6_tilde/(beta_tilde_2 + EPSILON), q));
-    omega_tilde_3 = double(1)/double(32)*(C + ipow(tau_6_tilde/(beta_tilde_3 + EPSILON), q));
-    
-    double omega_tilde_sum = omega_tilde_0 + omega_tilde_1 + omega_tilde_2 + omega_tilde_3;
-    
-    omega_tilde_0 = omega_tilde_0/omega_tilde_sum;
-    omega_tilde_1 = omega_tilde_1/omega_tilde_sum;
-    omega_tilde_2 = omega_tilde_2/omega_tilde_sum;
-    omega_tilde_3 = omega_tilde_3/omega_tilde_sum;
+    computeCentralWeightsWCNS6LD<Q>(omega_tilde_0, omega_tilde_1, omega_tilde_2, omega_tilde_3,
+        beta_avg_tilde, tau_6_tilde, beta_tilde_0, beta_tilde_1, beta_tilde_2, beta_tilde_3, q, C);
     
     /*
      * Compute the weights omega_tilde.
@@ -411,545 +377,135 @@ ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::putToRestart(
 
 
 /*
- * Perform WENO interpolation.
+ * Perform WENO interpolation on a line of faces with the exponents P and Q of the nonlinear weights
+ * fixed at compile time. The exponents p and q of the input database are used if P and Q are zero.
  */
+template<int P, int Q>
 void
-ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
-    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_minus,
-    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_plus,
-    const std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > >& variables)
+ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolationWithExponents(
+    std::vector<double*>& variables_minus,
+    std::vector<double*>& variables_plus,
+    const std::vector<std::vector<double*> >& variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
 {
 #ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
     TBOX_ASSERT(static_cast<int>(variables_minus.size()) == d_num_eqn);
     TBOX_ASSERT(static_cast<int>(variables_plus.size()) == d_num_eqn);
     
     TBOX_ASSERT(static_cast<int>(variables.size()) == 6);
-#endif
-    
-    /*
-     * Get the interior dimensions.
-     */
-    
-    const hier::IntVector interior_dims = variables_minus[0]->getBox().numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
-    for (int ei = 0; ei < d_num_eqn; ei++)
-    {
-        TBOX_ASSERT(variables_minus[ei]->getBox().numberCells() == interior_dims);
-        TBOX_ASSERT(variables_plus[ei]->getBox().numberCells() == interior_dims);
-        
-        TBOX_ASSERT(variables_minus[ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-        TBOX_ASSERT(variables_plus[ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-    }
-    
-    TBOX_ASSERT(static_cast<int>(variables.size()) == 6);
     
     for (int m = 0; m < 6; m++)
     {
         TBOX_ASSERT(static_cast<int>(variables[m].size()) == d_num_eqn);
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            TBOX_ASSERT(variables[m][ei]->getBox().numberCells() == interior_dims);
-            TBOX_ASSERT(variables[m][ei]->getGhostCellWidth() == hier::IntVector::getOne(d_dim));
-        }
     }
 #endif
     
-    if (d_dim == tbox::Dimension(1))
-    {
-        /*
-         * Get the dimension.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = -1; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index of the mid-point.
-                const int idx_midpoint_x = i + 1;
-                
-                performLocalWENOInterpolationMinus(
-                    U_L,
-                    U_array.data(),
-                    idx_midpoint_x,
-                    d_constant_p,
-                    d_constant_q,
-                    d_constant_C,
-                    d_constant_alpha_tau);
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = -1; i < interior_dim_0 + 2; i++)
-            {
-                // Compute the linear index of the mid-point.
-                const int idx_midpoint_x = i + 1;
-                
-                performLocalWENOInterpolationPlus(
-                    U_R,
-                    U_array.data(),
-                    idx_midpoint_x,
-                    d_constant_p,
-                    d_constant_q,
-                    d_constant_C,
-                    d_constant_alpha_tau);
-            }
-        }
-        
-    } // if (d_dim == tbox::Dimension(1))
-    else if (d_dim == tbox::Dimension(2))
+    NULL_USE(direction);
+    
+    for (int ei = 0; ei < d_num_eqn; ei++)
     {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -1; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_x = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 3);
-                    
-                    performLocalWENOInterpolationMinus(
-                        U_L,
-                        U_array.data(),
-                        idx_midpoint_x,
-                        d_constant_p,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_alpha_tau);
-                }
-            }
-        }
+        double* U_array[6];
         
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        for (int m = 0; m < 6; m++)
         {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -1; i < interior_dim_0 + 2; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_x = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 3);
-                    
-                    performLocalWENOInterpolationPlus(
-                        U_R,
-                        U_array.data(),
-                        idx_midpoint_x,
-                        d_constant_p,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_alpha_tau);
-                }
-            }
+            U_array[m] = variables[m][ei];
         }
         
-        /*
-         * Peform WENO interpolation in the y-direction.
-         */
+        double* U_minus = variables_minus[ei];
+        double* U_plus = variables_plus[ei];
         
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(1);
-            
-            for (int j = -1; j < interior_dim_1 + 2; j++)
-            {
 #ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
+        #pragma omp simd
 #endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_y = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2);
-                    
-                    performLocalWENOInterpolationMinus(
-                        U_B,
-                        U_array.data(),
-                        idx_midpoint_y,
-                        d_constant_p,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_alpha_tau);
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
+        for (int idx_face = 0; idx_face < num_faces; idx_face++)
         {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_T = variables_plus[ei]->getPointer(1);
-            
-            for (int j = -1; j < interior_dim_1 + 2; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    // Compute the linear index of the mid-point.
-                    const int idx_midpoint_y = (i + 1) +
-                        (j + 1)*(interior_dim_0 + 2);
-                    
-                    performLocalWENOInterpolationPlus(
-                        U_T,
-                        U_array.data(),
-                        idx_midpoint_y,
-                        d_constant_p,
-                        d_constant_q,
-                        d_constant_C,
-                        d_constant_alpha_tau);
-                }
-            }
+            performLocalWENOInterpolationMinus<P, Q>(
+                U_minus,
+                U_array,
+                idx_face,
+                d_constant_p,
+                d_constant_q,
+                d_constant_C,
+                d_constant_alpha_tau);
+            
+            performLocalWENOInterpolationPlus<P, Q>(
+                U_plus,
+                U_array,
+                idx_face,
+                d_constant_p,
+                d_constant_q,
+                d_constant_C,
+                d_constant_alpha_tau);
         }
-        
-    } // if (d_dim == tbox::Dimension(2))
-    else if (d_dim == tbox::Dimension(3))
+    }
+}
+
+
+/*
+ * Perform WENO interpolation on a line of faces. The kernel with the exponents of the nonlinear weights
+ * fixed at compile time is used for the common combinations of the exponents.
+ */
+void
+ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL::performWENOInterpolation(
+    std::vector<double*>& variables_minus,
+    std::vector<double*>& variables_plus,
+    const std::vector<std::vector<double*> >& variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
+{
+    if (d_constant_p == 1 && d_constant_q == 2)
     {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Peform WENO interpolation in the x-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_L = variables_minus[ei]->getPointer(0);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -1; i < interior_dim_0 + 2; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_x = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 3) +
-                            (k + 1)*(interior_dim_0 + 3)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_L,
-                            U_array.data(),
-                            idx_midpoint_x,
-                            d_constant_p,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_alpha_tau);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(0));
-            }
-            
-            double* U_R = variables_plus[ei]->getPointer(0);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -1; i < interior_dim_0 + 2; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_x = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 3) +
-                            (k + 1)*(interior_dim_0 + 3)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_R,
-                            U_array.data(),
-                            idx_midpoint_x,
-                            d_constant_p,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_alpha_tau);
-                    }
-                }
-            }
-        }
-        
-        /*
-         * Peform WENO interpolation in the y-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(1);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = -1; j < interior_dim_1 + 2; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_y = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 3);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_B,
-                            U_array.data(),
-                            idx_midpoint_y,
-                            d_constant_p,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_alpha_tau);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(1));
-            }
-            
-            double* U_T = variables_plus[ei]->getPointer(1);
-            
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = -1; j < interior_dim_1 + 2; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_y = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 3);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_T,
-                            U_array.data(),
-                            idx_midpoint_y,
-                            d_constant_p,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_alpha_tau);
-                    }
-                }
-            }
-        }
-        
-        /*
-         * Peform WENO interpolation in the z-direction.
-         */
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(2));
-            }
-            
-            double* U_B = variables_minus[ei]->getPointer(2);
-            
-            for (int k = -1; k < interior_dim_2 + 2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_z = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationMinus(
-                            U_B,
-                            U_array.data(),
-                            idx_midpoint_z,
-                            d_constant_p,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_alpha_tau);
-                    }
-                }
-            }
-        }
-        
-        for (int ei = 0; ei < d_num_eqn; ei++)
-        {
-            std::vector<double*> U_array;
-            U_array.reserve(6);
-            
-            for (int m = 0; m < 6; m++)
-            {
-                U_array.push_back(variables[m][ei]->getPointer(2));
-            }
-            
-            double* U_F = variables_plus[ei]->getPointer(2);
-            
-            for (int k = -1; k < interior_dim_2 + 2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear index of the mid-point.
-                        const int idx_midpoint_z = (i + 1) +
-                            (j + 1)*(interior_dim_0 + 2) +
-                            (k + 1)*(interior_dim_0 + 2)*
-                                (interior_dim_1 + 2);
-                        
-                        performLocalWENOInterpolationPlus(
-                            U_F,
-                            U_array.data(),
-                            idx_midpoint_z,
-                            d_constant_p,
-                            d_constant_q,
-                            d_constant_C,
-                            d_constant_alpha_tau);
-                    }
-                }
-            }
-        }
-        
-    } // if (d_dim == tbox::Dimension(3))
+        performWENOInterpolationWithExponents<1, 2>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_p == 1 && d_constant_q == 4)
+    {
+        performWENOInterpolationWithExponents<1, 4>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_p == 2 && d_constant_q == 2)
+    {
+        performWENOInterpolationWithExponents<2, 2>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_p == 2 && d_constant_q == 4)
+    {
+        performWENOInterpolationWithExponents<2, 4>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else if (d_constant_p == 2 && d_constant_q == 6)
+    {
+        performWENOInterpolationWithExponents<2, 6>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
+    else
+    {
+        performWENOInterpolationWithExponents<0, 0>(
+            variables_minus,
+            variables_plus,
+            variables,
+            direction,
+            num_faces);
+    }
 }
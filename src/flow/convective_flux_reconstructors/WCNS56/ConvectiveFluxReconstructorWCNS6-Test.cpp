@@ -467,6 +467,8 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
     const double dt,
     const int RK_step_number)
 {
+    const bool is_first_worker = isFirstWorker();
+    
     NULL_USE(time);
     NULL_USE(RK_step_number);
     
@@ -752,18 +754,27 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * characteristic variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         basic_utilities->computeSideDataOfProjectionVariablesForPrimitiveVariables(
             projection_variables);
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Transform primitive variables to characteristic variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         for (int m = 0; m < 6; m++)
         {
@@ -774,26 +785,38 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
                 m - 3);
         }
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Peform WENO interpolation.
          */
         
-        t_WENO_interpolation->start();
+        if (is_first_worker)
+        {
+            t_WENO_interpolation->start();
+        }
         
         performWENOInterpolation(
             characteristic_variables_minus,
             characteristic_variables_plus,
             characteristic_variables);
         
-        t_WENO_interpolation->stop();
+        if (is_first_worker)
+        {
+            t_WENO_interpolation->stop();
+        }
         
         /*
          * Transform characteristic variables back to primitive variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
             primitive_variables_minus,
@@ -805,7 +828,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             characteristic_variables_plus,
             projection_variables);
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
@@ -871,7 +897,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Compute mid-point flux in the x-direction.
          */
         
-        t_Riemann_solver->start();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -893,13 +922,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
                 RIEMANN_SOLVER::HLLC);
         }
         
-        t_Riemann_solver->stop();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->stop();
+        }
         
         /*
          * Reconstruct the flux in the x-direction.
          */
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
@@ -927,13 +962,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Compute the source.
          */
         
-        t_compute_source->start();
+        if (is_first_worker)
+        {
+            t_compute_source->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -981,7 +1022,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_compute_source->stop();
+        if (is_first_worker)
+        {
+            t_compute_source->stop();
+        }
         
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
@@ -1325,18 +1369,27 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * characteristic variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         basic_utilities->computeSideDataOfProjectionVariablesForPrimitiveVariables(
             projection_variables);
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Transform primitive variables to characteristic variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         for (int m = 0; m < 6; m++)
         {
@@ -1347,26 +1400,38 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
                 m - 3);
         }
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Peform WENO interpolation.
          */
         
-        t_WENO_interpolation->start();
+        if (is_first_worker)
+        {
+            t_WENO_interpolation->start();
+        }
         
         performWENOInterpolation(
             characteristic_variables_minus,
             characteristic_variables_plus,
             characteristic_variables);
         
-        t_WENO_interpolation->stop();
+        if (is_first_worker)
+        {
+            t_WENO_interpolation->stop();
+        }
         
         /*
          * Transform characteristic variables back to primitive variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
             primitive_variables_minus,
@@ -1378,7 +1443,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             characteristic_variables_plus,
             projection_variables);
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
@@ -1500,7 +1568,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Compute mid-point flux in the x-direction.
          */
         
-        t_Riemann_solver->start();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -1579,13 +1650,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_Riemann_solver->stop();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->stop();
+        }
         
         /*
          * Compute mid-point flux in the y-direction.
          */
         
-        t_Riemann_solver->start();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -1664,13 +1741,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_Riemann_solver->stop();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->stop();
+        }
         
         /*
          * Reconstruct the flux in the x-direction.
          */
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
@@ -1712,13 +1795,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Reconstruct the flux in the y-direction.
          */
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
@@ -1760,13 +1849,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Compute the source.
          */
         
-        t_compute_source->start();
+        if (is_first_worker)
+        {
+            t_compute_source->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -1851,7 +1946,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_compute_source->stop();
+        if (is_first_worker)
+        {
+            t_compute_source->stop();
+        }
         
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
@@ -2289,18 +2387,27 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * characteristic variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         basic_utilities->computeSideDataOfProjectionVariablesForPrimitiveVariables(
             projection_variables);
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Transform primitive variables to characteristic variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         for (int m = 0; m < 6; m++)
         {
@@ -2311,26 +2418,38 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
                 m - 3);
         }
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Peform WENO interpolation.
          */
         
-        t_WENO_interpolation->start();
+        if (is_first_worker)
+        {
+            t_WENO_interpolation->start();
+        }
         
         performWENOInterpolation(
             characteristic_variables_minus,
             characteristic_variables_plus,
             characteristic_variables);
         
-        t_WENO_interpolation->stop();
+        if (is_first_worker)
+        {
+            t_WENO_interpolation->stop();
+        }
         
         /*
          * Transform characteristic variables back to primitive variables.
          */
         
-        t_characteristic_decomposition->start();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->start();
+        }
         
         basic_utilities->computeSideDataOfPrimitiveVariablesFromCharacteristicVariables(
             primitive_variables_minus,
@@ -2342,7 +2461,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             characteristic_variables_plus,
             projection_variables);
         
-        t_characteristic_decomposition->stop();
+        if (is_first_worker)
+        {
+            t_characteristic_decomposition->stop();
+        }
         
         /*
          * Declare containers to store pointers for computing mid-point fluxes.
@@ -2543,7 +2665,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
          * Compute mid-point flux in the x-direction.
          */
         
-        t_Riemann_solver->start();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -2636,13 +2761,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_Riemann_solver->stop();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->stop();
+        }
         
         /*
          * Compute mid-point flux in the y-direction.
          */
         
-        t_Riemann_solver->start();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -2735,13 +2866,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_Riemann_solver->stop();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->stop();
+        }
         
         /*
          * Compute mid-point flux in the z-direction.
          */
         
-        t_Riemann_solver->start();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -2834,13 +2971,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_Riemann_solver->stop();
+        if (is_first_worker)
+        {
+            t_Riemann_solver->stop();
+        }
         
         /*
          * Reconstruct the flux in the x-direction.
          */
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
@@ -2897,13 +3040,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Reconstruct the flux in the y-direction.
          */
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
@@ -2956,13 +3105,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Reconstruct the flux in the z-direction.
          */
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
@@ -3015,13 +3170,19 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Compute the source.
          */
         
-        t_compute_source->start();
+        if (is_first_worker)
+        {
+            t_compute_source->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -3177,7 +3338,10 @@ ConvectiveFluxReconstructorWCNS6_Test::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_compute_source->stop();
+        if (is_first_worker)
+        {
+            t_compute_source->stop();
+        }
         
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
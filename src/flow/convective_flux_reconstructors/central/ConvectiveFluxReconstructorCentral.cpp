@@ -122,6 +122,8 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
     const double dt,
     const int RK_step_number)
 {
+    const bool is_first_worker = isFirstWorker();
+    
     NULL_USE(time);
     NULL_USE(RK_step_number);
     
@@ -269,7 +271,10 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             F_node_x.push_back(convective_flux_node[0]->getPointer(ei));
         }
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         /*
          * Reconstruct the flux in the x-direction.
@@ -381,13 +386,19 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Compute the source.
          */
         
-        t_compute_source->start();
+        if (is_first_worker)
+        {
+            t_compute_source->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -538,7 +549,10 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_compute_source->stop();
+        if (is_first_worker)
+        {
+            t_compute_source->stop();
+        }
         
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
@@ -611,7 +625,10 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             F_node_y.push_back(convective_flux_node[1]->getPointer(ei));
         }
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         /*
          * Reconstruct the flux in the x-direction.
@@ -971,13 +988,19 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Compute the source.
          */
         
-        t_compute_source->start();
+        if (is_first_worker)
+        {
+            t_compute_source->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -1323,7 +1346,10 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_compute_source->stop();
+        if (is_first_worker)
+        {
+            t_compute_source->stop();
+        }
         
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
@@ -1415,7 +1441,10 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             F_node_z.push_back(convective_flux_node[2]->getPointer(ei));
         }
         
-        t_reconstruct_flux->start();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->start();
+        }
         
         /*
          * Reconstruct the flux in the x-direction.
@@ -2170,13 +2199,19 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_reconstruct_flux->stop();
+        if (is_first_worker)
+        {
+            t_reconstruct_flux->stop();
+        }
         
         /*
          * Compute the source.
          */
         
-        t_compute_source->start();
+        if (is_first_worker)
+        {
+            t_compute_source->start();
+        }
         
         if (d_has_advective_eqn_form)
         {
@@ -2842,7 +2877,10 @@ ConvectiveFluxReconstructorCentral::computeConvectiveFluxAndSourceOnPatch(
             }
         }
         
-        t_compute_source->stop();
+        if (is_first_worker)
+        {
+            t_compute_source->stop();
+        }
         
         /*
          * Unregister the patch and data of all registered derived cell variables in the flow model.
@@ -1,4 +1,138 @@
 #include "flow/convective_flux_reconstructors/central/ConvectiveFluxReconstructorKEP.hpp"
+#include "util/Padded3DIndexing.hpp"
+
+/*
+ * Compute the linear term of the flux at a face with HALF_WIDTH cells on each side of the face in the stencil.
+ * idx_f_L and idx_f_R are the linear indices of the cells on the left and right of the face and stride_f is
+ * the stride of the data in the direction of the flux. The terms of the stencil are summed in the same order for
+ * all stencil widths. The loops over the terms are unrolled explicitly: their bounds are known at compile time
+ * but the wide stencils exceed the default limits of complete unrolling.
+ */
+template<int HALF_WIDTH>
+static inline __attribute__((always_inline)) double computeLinearTerm(
+    const double* const f,
+    const double* const coef,
+    const int idx_f_L,
+    const int idx_f_R,
+    const int stride_f)
+{
+    double term = coef[0]*((f[idx_f_L] + f[idx_f_R]));
+    
+#ifdef __GNUC__
+    #pragma GCC unroll 6
+#endif
+    for (int m = 1; m < HALF_WIDTH; m++)
+    {
+        double sum = (f[idx_f_L - m*stride_f] + f[idx_f_R]);
+#ifdef __GNUC__
+        #pragma GCC unroll 6
+#endif
+        for (int a = 1; a <= m; a++)
+        {
+            sum += (f[idx_f_L - (m - a)*stride_f] + f[idx_f_R + a*stride_f]);
+        }
+        
+        term += coef[m]*sum;
+    }
+    
+    return term;
+}
+
+
+/*
+ * Compute the quadratic term of the flux at a face with HALF_WIDTH cells on each side of the face in the
+ * stencil.
+ */
+template<int HALF_WIDTH>
+static inline __attribute__((always_inline)) double computeQuadraticTerm(
+    const double* const f,
+    const double* const g,
+    const double* const coef,
+    const int idx_f_L,
+    const int idx_f_R,
+    const int idx_g_L,
+    const int idx_g_R,
+    const int stride_f,
+    const int stride_g)
+{
+    if (HALF_WIDTH == 1)
+    {
+        return coef[0]*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R]);
+    }
+    
+    double term = coef[0]*((f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R]));
+    
+#ifdef __GNUC__
+    #pragma GCC unroll 6
+#endif
+    for (int m = 1; m < HALF_WIDTH; m++)
+    {
+        double sum = (f[idx_f_L - m*stride_f] + f[idx_f_R])*(g[idx_g_L - m*stride_g] + g[idx_g_R]);
+#ifdef __GNUC__
+        #pragma GCC unroll 6
+#endif
+        for (int a = 1; a <= m; a++)
+        {
+            sum += (f[idx_f_L - (m - a)*stride_f] + f[idx_f_R + a*stride_f])*
+                (g[idx_g_L - (m - a)*stride_g] + g[idx_g_R + a*stride_g]);
+        }
+        
+        term += coef[m]*sum;
+    }
+    
+    return term;
+}
+
+
+/*
+ * Compute the cubic term of the flux at a face with HALF_WIDTH cells on each side of the face in the stencil.
+ */
+template<int HALF_WIDTH>
+static inline __attribute__((always_inline)) double computeCubicTerm(
+    const double* const f,
+    const double* const g,
+    const double* const h,
+    const double* const coef,
+    const int idx_f_L,
+    const int idx_f_R,
+    const int idx_g_L,
+    const int idx_g_R,
+    const int idx_h_L,
+    const int idx_h_R,
+    const int stride_f,
+    const int stride_g,
+    const int stride_h)
+{
+    if (HALF_WIDTH == 1)
+    {
+        return coef[0]*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R])*(h[idx_h_L] + h[idx_h_R]);
+    }
+    
+    double term = coef[0]*((f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R])*(h[idx_h_L] + h[idx_h_R]));
+    
+#ifdef __GNUC__
+    #pragma GCC unroll 6
+#endif
+    for (int m = 1; m < HALF_WIDTH; m++)
+    {
+        double sum = (f[idx_f_L - m*stride_f] + f[idx_f_R])*(g[idx_g_L - m*stride_g] + g[idx_g_R])*
+            (h[idx_h_L - m*stride_h] + h[idx_h_R]);
+#ifdef __GNUC__
+        #pragma GCC unroll 6
+#endif
+        for (int a = 1; a <= m; a++)
+        {
+            sum += (f[idx_f_L - (m - a)*stride_f] + f[idx_f_R + a*stride_f])*
+                (g[idx_g_L - (m - a)*stride_g] + g[idx_g_R + a*stride_g])*
+                (h[idx_h_L - (m - a)*stride_h] + h[idx_h_R + a*stride_h]);
+        }
+        
+        term += coef[m]*sum;
+    }
+    
+    return term;
+}
+
 
 /*
  * Timers interspersed throughout the class.
@@ -179,6 +313,40 @@ ConvectiveFluxReconstructorKEP::ConvectiveFluxReconstructorKEP(
         }
     }
     
+    /*
+     * Set the kernels for the stencil width.
+     */
+    
+    if (d_stencil_width == 3)
+    {
+        setConvectiveFluxFunctions<1>();
+    }
+    else if (d_stencil_width == 5)
+    {
+        setConvectiveFluxFunctions<2>();
+    }
+    else if (d_stencil_width == 7)
+    {
+        setConvectiveFluxFunctions<3>();
+    }
+    else if (d_stencil_width == 9)
+    {
+        setConvectiveFluxFunctions<4>();
+    }
+    else if (d_stencil_width == 11)
+    {
+        setConvectiveFluxFunctions<5>();
+    }
+    else if (d_stencil_width == 13)
+    {
+        setConvectiveFluxFunctions<6>();
+    }
+    else
+    {
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::ConvectiveFluxReconstructorKEP:"
+            " Stencil width of " << d_stencil_width << " is not supported!");
+    }
+    
     d_eqn_form = d_flow_model->getEquationsForm();
     d_has_advective_eqn_form = false;
     for (int ei = 0; ei < d_num_eqn; ei++)
@@ -255,6 +423,8 @@ ConvectiveFluxReconstructorKEP::computeConvectiveFluxAndSourceOnPatch(
     const double dt,
     const int RK_step_number)
 {
+    const bool is_first_worker = isFirstWorker();
+    
     if (d_flow_model_type != FLOW_MODEL::SINGLE_SPECIES &&
         d_flow_model_type != FLOW_MODEL::FOUR_EQN_CONSERVATIVE &&
         d_flow_model_type != FLOW_MODEL::FIVE_EQN_ALLAIRE)
@@ -380,7 +550,10 @@ ConvectiveFluxReconstructorKEP::computeConvectiveFluxAndSourceOnPatch(
     
     // Compute the specific total enthalpy.
     
-    t_reconstruct_flux->start();
+    if (is_first_worker)
+    {
+        t_reconstruct_flux->start();
+    }
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -536,13 +709,19 @@ ConvectiveFluxReconstructorKEP::computeConvectiveFluxAndSourceOnPatch(
         }
     }
     
-    t_reconstruct_flux->stop();
+    if (is_first_worker)
+    {
+        t_reconstruct_flux->stop();
+    }
     
     /*
      * Compute the flux.
      */
     
-    t_reconstruct_flux->start();
+    if (is_first_worker)
+    {
+        t_reconstruct_flux->start();
+    }
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -1325,13 +1504,19 @@ ConvectiveFluxReconstructorKEP::computeConvectiveFluxAndSourceOnPatch(
         }
     }
     
-    t_reconstruct_flux->stop();
+    if (is_first_worker)
+    {
+        t_reconstruct_flux->stop();
+    }
     
     /*
      * Compute the source.
      */
     
-    t_compute_source->start();
+    if (is_first_worker)
+    {
+        t_compute_source->start();
+    }
     
     if (d_flow_model_type == FLOW_MODEL::FIVE_EQN_ALLAIRE)
     {
@@ -1343,7 +1528,10 @@ ConvectiveFluxReconstructorKEP::computeConvectiveFluxAndSourceOnPatch(
             dt);
     }
     
-    t_compute_source->stop();
+    if (is_first_worker)
+    {
+        t_compute_source->stop();
+    }
     
     /*
      * Unregister the patch and data of all registered derived cell variables in the flow model.
@@ -1353,6 +1541,43 @@ ConvectiveFluxReconstructorKEP::computeConvectiveFluxAndSourceOnPatch(
 }
 
 
+/*
+ * Set the kernels adding the terms to the convective flux for the number of dimensions of the problem.
+ */
+template<int HALF_WIDTH>
+void
+ConvectiveFluxReconstructorKEP::setConvectiveFluxFunctions()
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        d_add_linear_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFlux<1, HALF_WIDTH>;
+        d_add_quadratic_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFlux<1, HALF_WIDTH>;
+        d_add_cubic_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFlux<1, HALF_WIDTH>;
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        d_add_linear_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFlux<2, HALF_WIDTH>;
+        d_add_quadratic_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFlux<2, HALF_WIDTH>;
+        d_add_cubic_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFlux<2, HALF_WIDTH>;
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        d_add_linear_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFlux<3, HALF_WIDTH>;
+        d_add_quadratic_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFlux<3, HALF_WIDTH>;
+        d_add_cubic_term_to_convective_flux =
+            &ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFlux<3, HALF_WIDTH>;
+    }
+}
+
+
 /*
  * Add linear term to convective flux in x-direction.
  */
@@ -1364,8488 +1589,494 @@ ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxX(
     const int component_idx_f,
     const double dt) const
 {
-    const hier::Box interior_box = data_convective_flux->getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
+    (this->*d_add_linear_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        component_idx_flux,
+        component_idx_f,
+        dt,
+        DIRECTION::X_DIRECTION);
+}
+
+
+/*
+ * Add quadratic term to convective flux in x-direction.
+ */
+void
+ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxX(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const int component_idx_g,
+    const double dt) const
+{
+    (this->*d_add_quadratic_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        data_g,
+        component_idx_flux,
+        component_idx_f,
+        component_idx_g,
+        dt,
+        DIRECTION::X_DIRECTION);
+}
+
+
+/*
+ * Add cubic term to convective flux in x-direction.
+ */
+void
+ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxX(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_h,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const int component_idx_g,
+    const int component_idx_h,
+    const double dt) const
+{
+    (this->*d_add_cubic_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        data_g,
+        data_h,
+        component_idx_flux,
+        component_idx_f,
+        component_idx_g,
+        component_idx_h,
+        dt,
+        DIRECTION::X_DIRECTION);
+}
+
+
+/*
+ * Add linear term to convective flux in y-direction.
+ */
+void
+ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxY(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const double dt) const
+{
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
+    if (d_dim == tbox::Dimension(1))
+    {
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxY:"
+            " Cannot compute linear term in y-direction for one-dimensional problem!");
+    }
 #endif
     
-    // Get the dimensions of the ghost cell box.
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    /*
-     * Get the pointers to the data.
-     */
-    
-    double* F_face_x = data_convective_flux->getPointer(0, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
+    (this->*d_add_linear_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        component_idx_flux,
+        component_idx_f,
+        dt,
+        DIRECTION::Y_DIRECTION);
+}
+
+
+/*
+ * Add quadratic term to convective flux in y-direction.
+ */
+void
+ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxY(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const int component_idx_g,
+    const double dt) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    if (d_dim == tbox::Dimension(1))
+    {
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxY:"
+            " Cannot compute quadratic term in y-direction for one-dimensional problem!");
+    }
+#endif
     
+    (this->*d_add_quadratic_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        data_g,
+        component_idx_flux,
+        component_idx_f,
+        component_idx_g,
+        dt,
+        DIRECTION::Y_DIRECTION);
+}
+
+
+/*
+ * Add cubic term to convective flux in y-direction.
+ */
+void
+ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxY(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_h,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const int component_idx_g,
+    const int component_idx_h,
+    const double dt) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the dimension.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        /*
-         * Get the numbers of ghost cells.
-         */
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        
-        if (d_stencil_width == 3)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxY:"
+            " Cannot compute cubic term in y-direction for one-dimensional problem!");
+    }
 #endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_L = i - 1 + num_ghosts_0_f;
-                const int idx_f_R = i     + num_ghosts_0_f;
-                
-                F_face_x[idx_face_x] += dt*(
-                    d_coef_a*(f[idx_f_L] + f[idx_f_R]));
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
+    
+    (this->*d_add_cubic_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        data_g,
+        data_h,
+        component_idx_flux,
+        component_idx_f,
+        component_idx_g,
+        component_idx_h,
+        dt,
+        DIRECTION::Y_DIRECTION);
+}
+
+
+/*
+ * Add linear term to convective flux in z-direction.
+ */
+void
+ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxZ(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const double dt) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    if (d_dim == tbox::Dimension(1))
+    {
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxZ:"
+            " Cannot compute linear term in z-direction for one-dimensional problem!");
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxZ:"
+            " Cannot compute linear term in z-direction for two-dimensional problem!");
+    }
 #endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LL = i - 2 + num_ghosts_0_f;
-                const int idx_f_L  = i - 1 + num_ghosts_0_f;
-                const int idx_f_R  = i     + num_ghosts_0_f;
-                const int idx_f_RR = i + 1 + num_ghosts_0_f;
-                
-                F_face_x[idx_face_x] += dt*(
-                    d_coef_a*((f[idx_f_L]  + f[idx_f_R] )) +
-                    d_coef_b*((f[idx_f_LL] + f[idx_f_R] )  +
-                              (f[idx_f_L]  + f[idx_f_RR])));
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLL = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL  = i - 2 + num_ghosts_0_f;
-                const int idx_f_L   = i - 1 + num_ghosts_0_f;
-                const int idx_f_R   = i     + num_ghosts_0_f;
-                const int idx_f_RR  = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR = i + 2 + num_ghosts_0_f;
-                
-                F_face_x[idx_face_x] += dt*(
-                    d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )) +
-                    d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )  +
-                              (f[idx_f_L]   + f[idx_f_RR] )) +
-                    d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )  +
-                              (f[idx_f_LL]  + f[idx_f_RR] )  +
-                              (f[idx_f_L]   + f[idx_f_RRR])));
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLL = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL  = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL   = i - 2 + num_ghosts_0_f;
-                const int idx_f_L    = i - 1 + num_ghosts_0_f;
-                const int idx_f_R    = i     + num_ghosts_0_f;
-                const int idx_f_RR   = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR  = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR = i + 3 + num_ghosts_0_f;
-                
-                F_face_x[idx_face_x] += dt*(
-                    d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )) +
-                    d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )  +
-                              (f[idx_f_L]    + f[idx_f_RR]  )) +
-                    d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )  +
-                              (f[idx_f_LL]   + f[idx_f_RR]  )  +
-                              (f[idx_f_L]    + f[idx_f_RRR] )) +
-                    d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )  +
-                              (f[idx_f_LLL]  + f[idx_f_RR]  )  +
-                              (f[idx_f_LL]   + f[idx_f_RRR] )  +
-                              (f[idx_f_L]    + f[idx_f_RRRR])));
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLLL = i - 5 + num_ghosts_0_f;
-                const int idx_f_LLLL  = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL   = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL    = i - 2 + num_ghosts_0_f;
-                const int idx_f_L     = i - 1 + num_ghosts_0_f;
-                const int idx_f_R     = i     + num_ghosts_0_f;
-                const int idx_f_RR    = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR   = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR  = i + 3 + num_ghosts_0_f;
-                const int idx_f_RRRRR = i + 4 + num_ghosts_0_f;
-                
-                F_face_x[idx_face_x] += dt*(
-                    d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )) +
-                    d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )  +
-                              (f[idx_f_L]     + f[idx_f_RR]   )) +
-                    d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )  +
-                              (f[idx_f_LL]    + f[idx_f_RR]   )  +
-                              (f[idx_f_L]     + f[idx_f_RRR]  )) +
-                    d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )  +
-                              (f[idx_f_LLL]   + f[idx_f_RR]   )  +
-                              (f[idx_f_LL]    + f[idx_f_RRR]  )  +
-                              (f[idx_f_L]     + f[idx_f_RRRR] )) +
-                    d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )  +
-                              (f[idx_f_LLLL]  + f[idx_f_RR]   )  +
-                              (f[idx_f_LLL]   + f[idx_f_RRR]  )  +
-                              (f[idx_f_LL]    + f[idx_f_RRRR] )  +
-                              (f[idx_f_L]     + f[idx_f_RRRRR])));
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLLLL = i - 6 + num_ghosts_0_f;
-                const int idx_f_LLLLL  = i - 5 + num_ghosts_0_f;
-                const int idx_f_LLLL   = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL    = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL     = i - 2 + num_ghosts_0_f;
-                const int idx_f_L      = i - 1 + num_ghosts_0_f;
-                const int idx_f_R      = i     + num_ghosts_0_f;
-                const int idx_f_RR     = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR    = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR   = i + 3 + num_ghosts_0_f;
-                const int idx_f_RRRRR  = i + 4 + num_ghosts_0_f;
-                const int idx_f_RRRRRR = i + 5 + num_ghosts_0_f;
-                
-                F_face_x[idx_face_x] += dt*(
-                    d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )) +
-                    d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )  +
-                              (f[idx_f_L]      + f[idx_f_RR]    )) +
-                    d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )  +
-                              (f[idx_f_LL]     + f[idx_f_RR]    )  +
-                              (f[idx_f_L]      + f[idx_f_RRR]   )) +
-                    d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )  +
-                              (f[idx_f_LLL]    + f[idx_f_RR]    )  +
-                              (f[idx_f_LL]     + f[idx_f_RRR]   )  +
-                              (f[idx_f_L]      + f[idx_f_RRRR]  )) +
-                    d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )  +
-                              (f[idx_f_LLLL]   + f[idx_f_RR]    )  +
-                              (f[idx_f_LLL]    + f[idx_f_RRR]   )  +
-                              (f[idx_f_LL]     + f[idx_f_RRRR]  )  +
-                              (f[idx_f_L]      + f[idx_f_RRRRR] )) +
-                    d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )  +
-                              (f[idx_f_LLLLL]  + f[idx_f_RR]    )  +
-                              (f[idx_f_LLLL]   + f[idx_f_RRR]   )  +
-                              (f[idx_f_LLL]    + f[idx_f_RRRR]  )  +
-                              (f[idx_f_LL]     + f[idx_f_RRRRR] )  +
-                              (f[idx_f_L]      + f[idx_f_RRRRRR])));
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell box.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_L = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_x[idx_face_x] += dt*(
-                        d_coef_a*(f[idx_f_L] + f[idx_f_R]));
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LL = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L  = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R  = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_x[idx_face_x] += dt*(
-                        d_coef_a*((f[idx_f_L]  + f[idx_f_R] )) +
-                        d_coef_b*((f[idx_f_LL] + f[idx_f_R] )  +
-                                  (f[idx_f_L]  + f[idx_f_RR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLL = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL  = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L   = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R   = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR  = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_x[idx_face_x] += dt*(
-                        d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )) +
-                        d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )  +
-                                  (f[idx_f_L]   + f[idx_f_RR] )) +
-                        d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )  +
-                                  (f[idx_f_LL]  + f[idx_f_RR] )  +
-                                  (f[idx_f_L]   + f[idx_f_RRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLL = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL  = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL   = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L    = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R    = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR   = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR  = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_x[idx_face_x] += dt*(
-                        d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )) +
-                        d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )  +
-                                  (f[idx_f_L]    + f[idx_f_RR]  )) +
-                        d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )  +
-                                  (f[idx_f_LL]   + f[idx_f_RR]  )  +
-                                  (f[idx_f_L]    + f[idx_f_RRR] )) +
-                        d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )  +
-                                  (f[idx_f_LLL]  + f[idx_f_RR]  )  +
-                                  (f[idx_f_LL]   + f[idx_f_RRR] )  +
-                                  (f[idx_f_L]    + f[idx_f_RRRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLLL = (i - 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLL  = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL   = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL    = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L     = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R     = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR    = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR   = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR  = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRR = (i + 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_x[idx_face_x] += dt*(
-                        d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )) +
-                        d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )  +
-                                  (f[idx_f_L]     + f[idx_f_RR]   )) +
-                        d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )  +
-                                  (f[idx_f_LL]    + f[idx_f_RR]   )  +
-                                  (f[idx_f_L]     + f[idx_f_RRR]  )) +
-                        d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )  +
-                                  (f[idx_f_LLL]   + f[idx_f_RR]   )  +
-                                  (f[idx_f_LL]    + f[idx_f_RRR]  )  +
-                                  (f[idx_f_L]     + f[idx_f_RRRR] )) +
-                        d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )  +
-                                  (f[idx_f_LLLL]  + f[idx_f_RR]   )  +
-                                  (f[idx_f_LLL]   + f[idx_f_RRR]  )  +
-                                  (f[idx_f_LL]    + f[idx_f_RRRR] )  +
-                                  (f[idx_f_L]     + f[idx_f_RRRRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLLLL = (i - 6 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLLL  = (i - 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLL   = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL    = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL     = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L      = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R      = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR     = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR    = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR   = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRR  = (i + 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRRR = (i + 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_x[idx_face_x] += dt*(
-                        d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )) +
-                        d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )  +
-                                  (f[idx_f_L]      + f[idx_f_RR]    )) +
-                        d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )  +
-                                  (f[idx_f_LL]     + f[idx_f_RR]    )  +
-                                  (f[idx_f_L]      + f[idx_f_RRR]   )) +
-                        d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RR]    )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRR]   )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRR]  )) +
-                        d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )  +
-                                  (f[idx_f_LLLL]   + f[idx_f_RR]    )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RRR]   )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRRR]  )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRRR] )) +
-                        d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )  +
-                                  (f[idx_f_LLLLL]  + f[idx_f_RR]    )  +
-                                  (f[idx_f_LLLL]   + f[idx_f_RRR]   )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RRRR]  )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRRRR] )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRRRR])));
-                }
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell box.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_L = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_x[idx_face_x] += dt*(
-                            d_coef_a*(f[idx_f_L] + f[idx_f_R]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LL = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L  = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_x[idx_face_x] += dt*(
-                            d_coef_a*((f[idx_f_L]  + f[idx_f_R] )) +
-                            d_coef_b*((f[idx_f_LL] + f[idx_f_R] )  +
-                                      (f[idx_f_L]  + f[idx_f_RR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLL = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL  = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L   = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR  = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_x[idx_face_x] += dt*(
-                            d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )) +
-                            d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )  +
-                                      (f[idx_f_L]   + f[idx_f_RR] )) +
-                            d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )  +
-                                      (f[idx_f_LL]  + f[idx_f_RR] )  +
-                                      (f[idx_f_L]   + f[idx_f_RRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLL = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL  = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL   = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L    = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR   = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR  = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_x[idx_face_x] += dt*(
-                            d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )) +
-                            d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )  +
-                                      (f[idx_f_L]    + f[idx_f_RR]  )) +
-                            d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )  +
-                                      (f[idx_f_LL]   + f[idx_f_RR]  )  +
-                                      (f[idx_f_L]    + f[idx_f_RRR] )) +
-                            d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )  +
-                                      (f[idx_f_LLL]  + f[idx_f_RR]  )  +
-                                      (f[idx_f_LL]   + f[idx_f_RRR] )  +
-                                      (f[idx_f_L]    + f[idx_f_RRRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLLL = (i - 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLL  = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL   = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL    = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L     = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR    = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR   = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR  = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRR = (i + 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_x[idx_face_x] += dt*(
-                            d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )) +
-                            d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )  +
-                                      (f[idx_f_L]     + f[idx_f_RR]   )) +
-                            d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )  +
-                                      (f[idx_f_LL]    + f[idx_f_RR]   )  +
-                                      (f[idx_f_L]     + f[idx_f_RRR]  )) +
-                            d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )  +
-                                      (f[idx_f_LLL]   + f[idx_f_RR]   )  +
-                                      (f[idx_f_LL]    + f[idx_f_RRR]  )  +
-                                      (f[idx_f_L]     + f[idx_f_RRRR] )) +
-                            d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )  +
-                                      (f[idx_f_LLLL]  + f[idx_f_RR]   )  +
-                                      (f[idx_f_LLL]   + f[idx_f_RRR]  )  +
-                                      (f[idx_f_LL]    + f[idx_f_RRRR] )  +
-                                      (f[idx_f_L]     + f[idx_f_RRRRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLLLL = (i - 6 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLLL  = (i - 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLL   = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL    = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL     = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L      = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR     = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR    = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR   = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRR  = (i + 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRRR = (i + 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_x[idx_face_x] += dt*(
-                            d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )) +
-                            d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )  +
-                                      (f[idx_f_L]      + f[idx_f_RR]    )) +
-                            d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )  +
-                                      (f[idx_f_LL]     + f[idx_f_RR]    )  +
-                                      (f[idx_f_L]      + f[idx_f_RRR]   )) +
-                            d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RR]    )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRR]   )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRR]  )) +
-                            d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )  +
-                                      (f[idx_f_LLLL]   + f[idx_f_RR]    )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RRR]   )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRRR]  )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRRR] )) +
-                            d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )  +
-                                      (f[idx_f_LLLLL]  + f[idx_f_RR]    )  +
-                                      (f[idx_f_LLLL]   + f[idx_f_RRR]   )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RRRR]  )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRRRR] )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRRRR])));
-                    }
-                }
-            }
-        }
-    }
-}
-
-
-/*
- * Add quadratic term to convective flux in x-direction.
- */
-void
-ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxX(
-    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
-    const int component_idx_flux,
-    const int component_idx_f,
-    const int component_idx_g,
-    const double dt) const
-{
-    const hier::Box interior_box = data_convective_flux->getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
-#endif
-    
-    // Get the dimensions of the ghost cell boxes.
-    
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    const hier::Box ghost_box_g = data_g->getGhostBox();
-    const hier::IntVector ghostcell_dims_g = ghost_box_g.numberCells();
-    const hier::IntVector num_ghosts_g = data_g->getGhostCellWidth();
-    
-    /*
-     * Get the pointers to the data.
-     */
-    
-    double* F_face_x = data_convective_flux->getPointer(0, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    double* g        = data_g->getPointer(component_idx_g);
-    
-    const double half = double(1)/double(2);
-    
-    if (d_dim == tbox::Dimension(1))
-    {
-        /*
-         * Get the dimension.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        /*
-         * Get the numbers of ghost cells.
-         */
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        
-        if (d_stencil_width == 3)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_L = i - 1 + num_ghosts_0_f;
-                const int idx_f_R = i     + num_ghosts_0_f;
-                
-                const int idx_g_L = i - 1 + num_ghosts_0_g;
-                const int idx_g_R = i     + num_ghosts_0_g;
-                
-                F_face_x[idx_face_x] += dt*half*(
-                    d_coef_a*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R]));
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LL = i - 2 + num_ghosts_0_f;
-                const int idx_f_L  = i - 1 + num_ghosts_0_f;
-                const int idx_f_R  = i     + num_ghosts_0_f;
-                const int idx_f_RR = i + 1 + num_ghosts_0_f;
-                
-                const int idx_g_LL = i - 2 + num_ghosts_0_g;
-                const int idx_g_L  = i - 1 + num_ghosts_0_g;
-                const int idx_g_R  = i     + num_ghosts_0_g;
-                const int idx_g_RR = i + 1 + num_ghosts_0_g;
-                
-                F_face_x[idx_face_x] += dt*half*(
-                    d_coef_a*((f[idx_f_L]  + f[idx_f_R] )*(g[idx_g_L]  + g[idx_g_R] )) +
-                    d_coef_b*((f[idx_f_LL] + f[idx_f_R] )*(g[idx_g_LL] + g[idx_g_R] )  +
-                              (f[idx_f_L]  + f[idx_f_RR])*(g[idx_g_L]  + g[idx_g_RR])));
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLL = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL  = i - 2 + num_ghosts_0_f;
-                const int idx_f_L   = i - 1 + num_ghosts_0_f;
-                const int idx_f_R   = i     + num_ghosts_0_f;
-                const int idx_f_RR  = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR = i + 2 + num_ghosts_0_f;
-                
-                const int idx_g_LLL = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL  = i - 2 + num_ghosts_0_g;
-                const int idx_g_L   = i - 1 + num_ghosts_0_g;
-                const int idx_g_R   = i     + num_ghosts_0_g;
-                const int idx_g_RR  = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR = i + 2 + num_ghosts_0_g;
-                
-                F_face_x[idx_face_x] += dt*half*(
-                    d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )*(g[idx_g_L]   + g[idx_g_R]  )) +
-                    d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )*(g[idx_g_LL]  + g[idx_g_R]  )  +
-                              (f[idx_f_L]   + f[idx_f_RR] )*(g[idx_g_L]   + g[idx_g_RR] )) +
-                    d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )*(g[idx_g_LLL] + g[idx_g_R]  )  +
-                              (f[idx_f_LL]  + f[idx_f_RR] )*(g[idx_g_LL]  + g[idx_g_RR] )  +
-                              (f[idx_f_L]   + f[idx_f_RRR])*(g[idx_g_L]   + g[idx_g_RRR])));
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLL = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL  = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL   = i - 2 + num_ghosts_0_f;
-                const int idx_f_L    = i - 1 + num_ghosts_0_f;
-                const int idx_f_R    = i     + num_ghosts_0_f;
-                const int idx_f_RR   = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR  = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR = i + 3 + num_ghosts_0_f;
-                
-                const int idx_g_LLLL = i - 4 + num_ghosts_0_g;
-                const int idx_g_LLL  = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL   = i - 2 + num_ghosts_0_g;
-                const int idx_g_L    = i - 1 + num_ghosts_0_g;
-                const int idx_g_R    = i     + num_ghosts_0_g;
-                const int idx_g_RR   = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR  = i + 2 + num_ghosts_0_g;
-                const int idx_g_RRRR = i + 3 + num_ghosts_0_g;
-                
-                F_face_x[idx_face_x] += dt*half*(
-                    d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )*(g[idx_g_L]    + g[idx_g_R]   )) +
-                    d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )*(g[idx_g_LL]   + g[idx_g_R]   )  +
-                              (f[idx_f_L]    + f[idx_f_RR]  )*(g[idx_g_L]    + g[idx_g_RR]  )) +
-                    d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )*(g[idx_g_LLL]  + g[idx_g_R]   )  +
-                              (f[idx_f_LL]   + f[idx_f_RR]  )*(g[idx_g_LL]   + g[idx_g_RR]  )  +
-                              (f[idx_f_L]    + f[idx_f_RRR] )*(g[idx_g_L]    + g[idx_g_RRR] )) +
-                    d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )*(g[idx_g_LLLL] + g[idx_g_R]   )  +
-                              (f[idx_f_LLL]  + f[idx_f_RR]  )*(g[idx_g_LLL]  + g[idx_g_RR]  )  +
-                              (f[idx_f_LL]   + f[idx_f_RRR] )*(g[idx_g_LL]   + g[idx_g_RRR] )  +
-                              (f[idx_f_L]    + f[idx_f_RRRR])*(g[idx_g_L]    + g[idx_g_RRRR])));
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLLL = i - 5 + num_ghosts_0_f;
-                const int idx_f_LLLL  = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL   = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL    = i - 2 + num_ghosts_0_f;
-                const int idx_f_L     = i - 1 + num_ghosts_0_f;
-                const int idx_f_R     = i     + num_ghosts_0_f;
-                const int idx_f_RR    = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR   = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR  = i + 3 + num_ghosts_0_f;
-                const int idx_f_RRRRR = i + 4 + num_ghosts_0_f;
-                
-                const int idx_g_LLLLL = i - 5 + num_ghosts_0_g;
-                const int idx_g_LLLL  = i - 4 + num_ghosts_0_g;
-                const int idx_g_LLL   = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL    = i - 2 + num_ghosts_0_g;
-                const int idx_g_L     = i - 1 + num_ghosts_0_g;
-                const int idx_g_R     = i     + num_ghosts_0_g;
-                const int idx_g_RR    = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR   = i + 2 + num_ghosts_0_g;
-                const int idx_g_RRRR  = i + 3 + num_ghosts_0_g;
-                const int idx_g_RRRRR = i + 4 + num_ghosts_0_g;
-                
-                F_face_x[idx_face_x] += dt*half*(
-                    d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )*(g[idx_g_L]     + g[idx_g_R]    )) +
-                    d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )*(g[idx_g_LL]    + g[idx_g_R]    )  +
-                              (f[idx_f_L]     + f[idx_f_RR]   )*(g[idx_g_L]     + g[idx_g_RR]   )) +
-                    d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )*(g[idx_g_LLL]   + g[idx_g_R]    )  +
-                              (f[idx_f_LL]    + f[idx_f_RR]   )*(g[idx_g_LL]    + g[idx_g_RR]   )  +
-                              (f[idx_f_L]     + f[idx_f_RRR]  )*(g[idx_g_L]     + g[idx_g_RRR]  )) +
-                    d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )*(g[idx_g_LLLL]  + g[idx_g_R]    )  +
-                              (f[idx_f_LLL]   + f[idx_f_RR]   )*(g[idx_g_LLL]   + g[idx_g_RR]   )  +
-                              (f[idx_f_LL]    + f[idx_f_RRR]  )*(g[idx_g_LL]    + g[idx_g_RRR]  )  +
-                              (f[idx_f_L]     + f[idx_f_RRRR] )*(g[idx_g_L]     + g[idx_g_RRRR] )) +
-                    d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )*(g[idx_g_LLLLL] + g[idx_g_R]    )  +
-                              (f[idx_f_LLLL]  + f[idx_f_RR]   )*(g[idx_g_LLLL]  + g[idx_g_RR]   )  +
-                              (f[idx_f_LLL]   + f[idx_f_RRR]  )*(g[idx_g_LLL]   + g[idx_g_RRR]  )  +
-                              (f[idx_f_LL]    + f[idx_f_RRRR] )*(g[idx_g_LL]    + g[idx_g_RRRR] )  +
-                              (f[idx_f_L]     + f[idx_f_RRRRR])*(g[idx_g_L]     + g[idx_g_RRRRR])));
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLLLL = i - 6 + num_ghosts_0_f;
-                const int idx_f_LLLLL  = i - 5 + num_ghosts_0_f;
-                const int idx_f_LLLL   = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL    = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL     = i - 2 + num_ghosts_0_f;
-                const int idx_f_L      = i - 1 + num_ghosts_0_f;
-                const int idx_f_R      = i     + num_ghosts_0_f;
-                const int idx_f_RR     = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR    = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR   = i + 3 + num_ghosts_0_f;
-                const int idx_f_RRRRR  = i + 4 + num_ghosts_0_f;
-                const int idx_f_RRRRRR = i + 5 + num_ghosts_0_f;
-                
-                const int idx_g_LLLLLL = i - 6 + num_ghosts_0_g;
-                const int idx_g_LLLLL  = i - 5 + num_ghosts_0_g;
-                const int idx_g_LLLL   = i - 4 + num_ghosts_0_g;
-                const int idx_g_LLL    = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL     = i - 2 + num_ghosts_0_g;
-                const int idx_g_L      = i - 1 + num_ghosts_0_g;
-                const int idx_g_R      = i     + num_ghosts_0_g;
-                const int idx_g_RR     = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR    = i + 2 + num_ghosts_0_g;
-                const int idx_g_RRRR   = i + 3 + num_ghosts_0_g;
-                const int idx_g_RRRRR  = i + 4 + num_ghosts_0_g;
-                const int idx_g_RRRRRR = i + 5 + num_ghosts_0_g;
-                
-                F_face_x[idx_face_x] += dt*half*(
-                    d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )*(g[idx_g_L]      + g[idx_g_R]     )) +
-                    d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )*(g[idx_g_LL]     + g[idx_g_R]     )  +
-                              (f[idx_f_L]      + f[idx_f_RR]    )*(g[idx_g_L]      + g[idx_g_RR]    )) +
-                    d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )*(g[idx_g_LLL]    + g[idx_g_R]     )  +
-                              (f[idx_f_LL]     + f[idx_f_RR]    )*(g[idx_g_LL]     + g[idx_g_RR]    )  +
-                              (f[idx_f_L]      + f[idx_f_RRR]   )*(g[idx_g_L]      + g[idx_g_RRR]   )) +
-                    d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )*(g[idx_g_LLLL]   + g[idx_g_R]     )  +
-                              (f[idx_f_LLL]    + f[idx_f_RR]    )*(g[idx_g_LLL]    + g[idx_g_RR]    )  +
-                              (f[idx_f_LL]     + f[idx_f_RRR]   )*(g[idx_g_LL]     + g[idx_g_RRR]   )  +
-                              (f[idx_f_L]      + f[idx_f_RRRR]  )*(g[idx_g_L]      + g[idx_g_RRRR]  )) +
-                    d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )*(g[idx_g_LLLLL]  + g[idx_g_R]     )  +
-                              (f[idx_f_LLLL]   + f[idx_f_RR]    )*(g[idx_g_LLLL]   + g[idx_g_RR]    )  +
-                              (f[idx_f_LLL]    + f[idx_f_RRR]   )*(g[idx_g_LLL]    + g[idx_g_RRR]   )  +
-                              (f[idx_f_LL]     + f[idx_f_RRRR]  )*(g[idx_g_LL]     + g[idx_g_RRRR]  )  +
-                              (f[idx_f_L]      + f[idx_f_RRRRR] )*(g[idx_g_L]      + g[idx_g_RRRRR] )) +
-                    d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )*(g[idx_g_LLLLLL] + g[idx_g_R]     )  +
-                              (f[idx_f_LLLLL]  + f[idx_f_RR]    )*(g[idx_g_LLLLL]  + g[idx_g_RR]    )  +
-                              (f[idx_f_LLLL]   + f[idx_f_RRR]   )*(g[idx_g_LLLL]   + g[idx_g_RRR]   )  +
-                              (f[idx_f_LLL]    + f[idx_f_RRRR]  )*(g[idx_g_LLL]    + g[idx_g_RRRR]  )  +
-                              (f[idx_f_LL]     + f[idx_f_RRRRR] )*(g[idx_g_LL]     + g[idx_g_RRRRR] )  +
-                              (f[idx_f_L]      + f[idx_f_RRRRRR])*(g[idx_g_L]      + g[idx_g_RRRRRR])));
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_L = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_L = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_x[idx_face_x] += dt*half*(
-                        d_coef_a*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R]));
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LL = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L  = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R  = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LL = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L  = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R  = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_x[idx_face_x] += dt*half*(
-                        d_coef_a*((f[idx_f_L]  + f[idx_f_R] )*(g[idx_g_L]  + g[idx_g_R] )) +
-                        d_coef_b*((f[idx_f_LL] + f[idx_f_R] )*(g[idx_g_LL] + g[idx_g_R] )  +
-                                  (f[idx_f_L]  + f[idx_f_RR])*(g[idx_g_L]  + g[idx_g_RR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLL = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL  = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L   = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R   = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR  = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLL = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL  = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L   = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R   = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR  = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_x[idx_face_x] += dt*half*(
-                        d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )*(g[idx_g_L]   + g[idx_g_R]  )) +
-                        d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )*(g[idx_g_LL]  + g[idx_g_R]  )  +
-                                  (f[idx_f_L]   + f[idx_f_RR] )*(g[idx_g_L]   + g[idx_g_RR] )) +
-                        d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )*(g[idx_g_LLL] + g[idx_g_R]  )  +
-                                  (f[idx_f_LL]  + f[idx_f_RR] )*(g[idx_g_LL]  + g[idx_g_RR] )  +
-                                  (f[idx_f_L]   + f[idx_f_RRR])*(g[idx_g_L]   + g[idx_g_RRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLL = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL  = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL   = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L    = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R    = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR   = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR  = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLLL = (i - 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLL  = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL   = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L    = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R    = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR   = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR  = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRR = (i + 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_x[idx_face_x] += dt*half*(
-                        d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )*(g[idx_g_L]    + g[idx_g_R]   )) +
-                        d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )*(g[idx_g_LL]   + g[idx_g_R]   )  +
-                                  (f[idx_f_L]    + f[idx_f_RR]  )*(g[idx_g_L]    + g[idx_g_RR]  )) +
-                        d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )*(g[idx_g_LLL]  + g[idx_g_R]   )  +
-                                  (f[idx_f_LL]   + f[idx_f_RR]  )*(g[idx_g_LL]   + g[idx_g_RR]  )  +
-                                  (f[idx_f_L]    + f[idx_f_RRR] )*(g[idx_g_L]    + g[idx_g_RRR] )) +
-                        d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )*(g[idx_g_LLLL] + g[idx_g_R]   )  +
-                                  (f[idx_f_LLL]  + f[idx_f_RR]  )*(g[idx_g_LLL]  + g[idx_g_RR]  )  +
-                                  (f[idx_f_LL]   + f[idx_f_RRR] )*(g[idx_g_LL]   + g[idx_g_RRR] )  +
-                                  (f[idx_f_L]    + f[idx_f_RRRR])*(g[idx_g_L]    + g[idx_g_RRRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLLL = (i - 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLL  = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL   = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL    = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L     = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R     = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR    = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR   = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR  = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRR = (i + 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLLLL = (i - 5 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLLL  = (i - 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLL   = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL    = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L     = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R     = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR    = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR   = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRR  = (i + 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRRR = (i + 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_x[idx_face_x] += dt*half*(
-                        d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )*(g[idx_g_L]     + g[idx_g_R]    )) +
-                        d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )*(g[idx_g_LL]    + g[idx_g_R]    )  +
-                                  (f[idx_f_L]     + f[idx_f_RR]   )*(g[idx_g_L]     + g[idx_g_RR]   )) +
-                        d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )*(g[idx_g_LLL]   + g[idx_g_R]    )  +
-                                  (f[idx_f_LL]    + f[idx_f_RR]   )*(g[idx_g_LL]    + g[idx_g_RR]   )  +
-                                  (f[idx_f_L]     + f[idx_f_RRR]  )*(g[idx_g_L]     + g[idx_g_RRR]  )) +
-                        d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )*(g[idx_g_LLLL]  + g[idx_g_R]    )  +
-                                  (f[idx_f_LLL]   + f[idx_f_RR]   )*(g[idx_g_LLL]   + g[idx_g_RR]   )  +
-                                  (f[idx_f_LL]    + f[idx_f_RRR]  )*(g[idx_g_LL]    + g[idx_g_RRR]  )  +
-                                  (f[idx_f_L]     + f[idx_f_RRRR] )*(g[idx_g_L]     + g[idx_g_RRRR] )) +
-                        d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )*(g[idx_g_LLLLL] + g[idx_g_R]    )  +
-                                  (f[idx_f_LLLL]  + f[idx_f_RR]   )*(g[idx_g_LLLL]  + g[idx_g_RR]   )  +
-                                  (f[idx_f_LLL]   + f[idx_f_RRR]  )*(g[idx_g_LLL]   + g[idx_g_RRR]  )  +
-                                  (f[idx_f_LL]    + f[idx_f_RRRR] )*(g[idx_g_LL]    + g[idx_g_RRRR] )  +
-                                  (f[idx_f_L]     + f[idx_f_RRRRR])*(g[idx_g_L]     + g[idx_g_RRRRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLLLL = (i - 6 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLLL  = (i - 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLL   = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL    = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL     = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L      = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R      = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR     = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR    = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR   = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRR  = (i + 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRRR = (i + 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLLLLL = (i - 6 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLLLL  = (i - 5 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLLL   = (i - 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLL    = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL     = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L      = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R      = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR     = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR    = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRR   = (i + 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRRR  = (i + 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRRRR = (i + 5 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_x[idx_face_x] += dt*half*(
-                        d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )*(g[idx_g_L]      + g[idx_g_R]     )) +
-                        d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )*(g[idx_g_LL]     + g[idx_g_R]     )  +
-                                  (f[idx_f_L]      + f[idx_f_RR]    )*(g[idx_g_L]      + g[idx_g_RR]    )) +
-                        d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )*(g[idx_g_LLL]    + g[idx_g_R]     )  +
-                                  (f[idx_f_LL]     + f[idx_f_RR]    )*(g[idx_g_LL]     + g[idx_g_RR]    )  +
-                                  (f[idx_f_L]      + f[idx_f_RRR]   )*(g[idx_g_L]      + g[idx_g_RRR]   )) +
-                        d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )*(g[idx_g_LLLL]   + g[idx_g_R]     )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RR]    )*(g[idx_g_LLL]    + g[idx_g_RR]    )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRR]   )*(g[idx_g_LL]     + g[idx_g_RRR]   )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRR]  )*(g[idx_g_L]      + g[idx_g_RRRR]  )) +
-                        d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )*(g[idx_g_LLLLL]  + g[idx_g_R]     )  +
-                                  (f[idx_f_LLLL]   + f[idx_f_RR]    )*(g[idx_g_LLLL]   + g[idx_g_RR]    )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RRR]   )*(g[idx_g_LLL]    + g[idx_g_RRR]   )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRRR]  )*(g[idx_g_LL]     + g[idx_g_RRRR]  )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRRR] )*(g[idx_g_L]      + g[idx_g_RRRRR] )) +
-                        d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )*(g[idx_g_LLLLLL] + g[idx_g_R]     )  +
-                                  (f[idx_f_LLLLL]  + f[idx_f_RR]    )*(g[idx_g_LLLLL]  + g[idx_g_RR]    )  +
-                                  (f[idx_f_LLLL]   + f[idx_f_RRR]   )*(g[idx_g_LLLL]   + g[idx_g_RRR]   )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RRRR]  )*(g[idx_g_LLL]    + g[idx_g_RRRR]  )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRRRR] )*(g[idx_g_LL]     + g[idx_g_RRRRR] )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRRRR])*(g[idx_g_L]      + g[idx_g_RRRRRR])));
-                }
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int num_ghosts_2_g = num_ghosts_g[2];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        const int ghostcell_dim_1_g = ghostcell_dims_g[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_L = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_L = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_x[idx_face_x] += dt*half*(
-                            d_coef_a*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LL = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L  = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LL = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L  = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_x[idx_face_x] += dt*half*(
-                            d_coef_a*((f[idx_f_L]  + f[idx_f_R] )*(g[idx_g_L]  + g[idx_g_R] )) +
-                            d_coef_b*((f[idx_f_LL] + f[idx_f_R] )*(g[idx_g_LL] + g[idx_g_R] )  +
-                                      (f[idx_f_L]  + f[idx_f_RR])*(g[idx_g_L]  + g[idx_g_RR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLL = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL  = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L   = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR  = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLL = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL  = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L   = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR  = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_x[idx_face_x] += dt*half*(
-                            d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )*(g[idx_g_L]   + g[idx_g_R]  )) +
-                            d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )*(g[idx_g_LL]  + g[idx_g_R]  )  +
-                                      (f[idx_f_L]   + f[idx_f_RR] )*(g[idx_g_L]   + g[idx_g_RR] )) +
-                            d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )*(g[idx_g_LLL] + g[idx_g_R]  )  +
-                                      (f[idx_f_LL]  + f[idx_f_RR] )*(g[idx_g_LL]  + g[idx_g_RR] )  +
-                                      (f[idx_f_L]   + f[idx_f_RRR])*(g[idx_g_L]   + g[idx_g_RRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLL = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL  = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL   = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L    = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR   = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR  = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLLL = (i - 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLL  = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL   = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L    = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR   = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR  = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRR = (i + 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_x[idx_face_x] += dt*half*(
-                            d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )*(g[idx_g_L]    + g[idx_g_R]   )) +
-                            d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )*(g[idx_g_LL]   + g[idx_g_R]   )  +
-                                      (f[idx_f_L]    + f[idx_f_RR]  )*(g[idx_g_L]    + g[idx_g_RR]  )) +
-                            d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )*(g[idx_g_LLL]  + g[idx_g_R]   )  +
-                                      (f[idx_f_LL]   + f[idx_f_RR]  )*(g[idx_g_LL]   + g[idx_g_RR]  )  +
-                                      (f[idx_f_L]    + f[idx_f_RRR] )*(g[idx_g_L]    + g[idx_g_RRR] )) +
-                            d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )*(g[idx_g_LLLL] + g[idx_g_R]   )  +
-                                      (f[idx_f_LLL]  + f[idx_f_RR]  )*(g[idx_g_LLL]  + g[idx_g_RR]  )  +
-                                      (f[idx_f_LL]   + f[idx_f_RRR] )*(g[idx_g_LL]   + g[idx_g_RRR] )  +
-                                      (f[idx_f_L]    + f[idx_f_RRRR])*(g[idx_g_L]    + g[idx_g_RRRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLLL = (i - 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLL  = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL   = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL    = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L     = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR    = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR   = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR  = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRR = (i + 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLLLL = (i - 5 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLLL  = (i - 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLL   = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL    = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L     = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR    = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR   = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRR  = (i + 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRRR = (i + 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_x[idx_face_x] += dt*half*(
-                            d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )*(g[idx_g_L]     + g[idx_g_R]    )) +
-                            d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )*(g[idx_g_LL]    + g[idx_g_R]    )  +
-                                      (f[idx_f_L]     + f[idx_f_RR]   )*(g[idx_g_L]     + g[idx_g_RR]   )) +
-                            d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )*(g[idx_g_LLL]   + g[idx_g_R]    )  +
-                                      (f[idx_f_LL]    + f[idx_f_RR]   )*(g[idx_g_LL]    + g[idx_g_RR]   )  +
-                                      (f[idx_f_L]     + f[idx_f_RRR]  )*(g[idx_g_L]     + g[idx_g_RRR]  )) +
-                            d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )*(g[idx_g_LLLL]  + g[idx_g_R]    )  +
-                                      (f[idx_f_LLL]   + f[idx_f_RR]   )*(g[idx_g_LLL]   + g[idx_g_RR]   )  +
-                                      (f[idx_f_LL]    + f[idx_f_RRR]  )*(g[idx_g_LL]    + g[idx_g_RRR]  )  +
-                                      (f[idx_f_L]     + f[idx_f_RRRR] )*(g[idx_g_L]     + g[idx_g_RRRR] )) +
-                            d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )*(g[idx_g_LLLLL] + g[idx_g_R]    )  +
-                                      (f[idx_f_LLLL]  + f[idx_f_RR]   )*(g[idx_g_LLLL]  + g[idx_g_RR]   )  +
-                                      (f[idx_f_LLL]   + f[idx_f_RRR]  )*(g[idx_g_LLL]   + g[idx_g_RRR]  )  +
-                                      (f[idx_f_LL]    + f[idx_f_RRRR] )*(g[idx_g_LL]    + g[idx_g_RRRR] )  +
-                                      (f[idx_f_L]     + f[idx_f_RRRRR])*(g[idx_g_L]     + g[idx_g_RRRRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLLLL = (i - 6 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLLL  = (i - 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLL   = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL    = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL     = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L      = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR     = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR    = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR   = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRR  = (i + 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRRR = (i + 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLLLLL = (i - 6 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLLLL  = (i - 5 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLLL   = (i - 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLL    = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL     = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L      = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR     = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR    = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRR   = (i + 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRRR  = (i + 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRRRR = (i + 5 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_x[idx_face_x] += dt*half*(
-                            d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )*(g[idx_g_L]      + g[idx_g_R]     )) +
-                            d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )*(g[idx_g_LL]     + g[idx_g_R]     )  +
-                                      (f[idx_f_L]      + f[idx_f_RR]    )*(g[idx_g_L]      + g[idx_g_RR]    )) +
-                            d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )*(g[idx_g_LLL]    + g[idx_g_R]     )  +
-                                      (f[idx_f_LL]     + f[idx_f_RR]    )*(g[idx_g_LL]     + g[idx_g_RR]    )  +
-                                      (f[idx_f_L]      + f[idx_f_RRR]   )*(g[idx_g_L]      + g[idx_g_RRR]   )) +
-                            d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )*(g[idx_g_LLLL]   + g[idx_g_R]     )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RR]    )*(g[idx_g_LLL]    + g[idx_g_RR]    )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRR]   )*(g[idx_g_LL]     + g[idx_g_RRR]   )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRR]  )*(g[idx_g_L]      + g[idx_g_RRRR]  )) +
-                            d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )*(g[idx_g_LLLLL]  + g[idx_g_R]     )  +
-                                      (f[idx_f_LLLL]   + f[idx_f_RR]    )*(g[idx_g_LLLL]   + g[idx_g_RR]    )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RRR]   )*(g[idx_g_LLL]    + g[idx_g_RRR]   )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRRR]  )*(g[idx_g_LL]     + g[idx_g_RRRR]  )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRRR] )*(g[idx_g_L]      + g[idx_g_RRRRR] )) +
-                            d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )*(g[idx_g_LLLLLL] + g[idx_g_R]     )  +
-                                      (f[idx_f_LLLLL]  + f[idx_f_RR]    )*(g[idx_g_LLLLL]  + g[idx_g_RR]    )  +
-                                      (f[idx_f_LLLL]   + f[idx_f_RRR]   )*(g[idx_g_LLLL]   + g[idx_g_RRR]   )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RRRR]  )*(g[idx_g_LLL]    + g[idx_g_RRRR]  )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRRRR] )*(g[idx_g_LL]     + g[idx_g_RRRRR] )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRRRR])*(g[idx_g_L]      + g[idx_g_RRRRRR])));
-                    }
-                }
-            }
-        }
-    }
-}
-
-
-/*
- * Add cubic term to convective flux in x-direction.
- */
-void
-ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxX(
-    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_h,
-    const int component_idx_flux,
-    const int component_idx_f,
-    const int component_idx_g,
-    const int component_idx_h,
-    const double dt) const
-{
-    const hier::Box interior_box = data_convective_flux->getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_h->getBox().isSpatiallyEqual(interior_box));
-#endif
-    
-    // Get the dimensions of the ghost cell boxes.
-    
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    const hier::Box ghost_box_g = data_g->getGhostBox();
-    const hier::IntVector ghostcell_dims_g = ghost_box_g.numberCells();
-    const hier::IntVector num_ghosts_g = data_g->getGhostCellWidth();
-    
-    const hier::Box ghost_box_h = data_h->getGhostBox();
-    const hier::IntVector ghostcell_dims_h = ghost_box_h.numberCells();
-    const hier::IntVector num_ghosts_h = data_h->getGhostCellWidth();
-    
-    /*
-     * Get the pointers to the data.
-     */
-    
-    double* F_face_x = data_convective_flux->getPointer(0, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    double* g        = data_g->getPointer(component_idx_g);
-    double* h        = data_h->getPointer(component_idx_h);
-    
-    const double quarter = double(1)/double(4);
-    
-    if (d_dim == tbox::Dimension(1))
-    {
-        /*
-         * Get the dimension.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        /*
-         * Get the numbers of ghost cells.
-         */
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_0_h = num_ghosts_h[0];
-        
-        if (d_stencil_width == 3)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_L = i - 1 + num_ghosts_0_f;
-                const int idx_f_R = i     + num_ghosts_0_f;
-                
-                const int idx_g_L = i - 1 + num_ghosts_0_g;
-                const int idx_g_R = i     + num_ghosts_0_g;
-                
-                const int idx_h_L = i - 1 + num_ghosts_0_h;
-                const int idx_h_R = i     + num_ghosts_0_h;
-                
-                F_face_x[idx_face_x] += dt*quarter*(
-                    d_coef_a*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R])*(h[idx_h_L] + h[idx_h_R]));
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LL = i - 2 + num_ghosts_0_f;
-                const int idx_f_L  = i - 1 + num_ghosts_0_f;
-                const int idx_f_R  = i     + num_ghosts_0_f;
-                const int idx_f_RR = i + 1 + num_ghosts_0_f;
-                
-                const int idx_g_LL = i - 2 + num_ghosts_0_g;
-                const int idx_g_L  = i - 1 + num_ghosts_0_g;
-                const int idx_g_R  = i     + num_ghosts_0_g;
-                const int idx_g_RR = i + 1 + num_ghosts_0_g;
-                
-                const int idx_h_LL = i - 2 + num_ghosts_0_h;
-                const int idx_h_L  = i - 1 + num_ghosts_0_h;
-                const int idx_h_R  = i     + num_ghosts_0_h;
-                const int idx_h_RR = i + 1 + num_ghosts_0_h;
-                
-                F_face_x[idx_face_x] += dt*quarter*(
-                    d_coef_a*((f[idx_f_L]  + f[idx_f_R] )*(g[idx_g_L]  + g[idx_g_R] )*(h[idx_h_L]  + h[idx_h_R] )) +
-                    d_coef_b*((f[idx_f_LL] + f[idx_f_R] )*(g[idx_g_LL] + g[idx_g_R] )*(h[idx_h_LL] + h[idx_h_R] )  +
-                              (f[idx_f_L]  + f[idx_f_RR])*(g[idx_g_L]  + g[idx_g_RR])*(h[idx_h_L]  + h[idx_h_RR])));
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLL = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL  = i - 2 + num_ghosts_0_f;
-                const int idx_f_L   = i - 1 + num_ghosts_0_f;
-                const int idx_f_R   = i     + num_ghosts_0_f;
-                const int idx_f_RR  = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR = i + 2 + num_ghosts_0_f;
-                
-                const int idx_g_LLL = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL  = i - 2 + num_ghosts_0_g;
-                const int idx_g_L   = i - 1 + num_ghosts_0_g;
-                const int idx_g_R   = i     + num_ghosts_0_g;
-                const int idx_g_RR  = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR = i + 2 + num_ghosts_0_g;
-                
-                const int idx_h_LLL = i - 3 + num_ghosts_0_h;
-                const int idx_h_LL  = i - 2 + num_ghosts_0_h;
-                const int idx_h_L   = i - 1 + num_ghosts_0_h;
-                const int idx_h_R   = i     + num_ghosts_0_h;
-                const int idx_h_RR  = i + 1 + num_ghosts_0_h;
-                const int idx_h_RRR = i + 2 + num_ghosts_0_h;
-                
-                F_face_x[idx_face_x] += dt*quarter*(
-                    d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )*(g[idx_g_L]   + g[idx_g_R]  )*(h[idx_h_L]   + h[idx_h_R]  )) +
-                    d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )*(g[idx_g_LL]  + g[idx_g_R]  )*(h[idx_h_LL]  + h[idx_h_R]  )  +
-                              (f[idx_f_L]   + f[idx_f_RR] )*(g[idx_g_L]   + g[idx_g_RR] )*(h[idx_h_L]   + h[idx_h_RR] )) +
-                    d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )*(g[idx_g_LLL] + g[idx_g_R]  )*(h[idx_h_LLL] + h[idx_h_R]  )  +
-                              (f[idx_f_LL]  + f[idx_f_RR] )*(g[idx_g_LL]  + g[idx_g_RR] )*(h[idx_h_LL]  + h[idx_h_RR] )  +
-                              (f[idx_f_L]   + f[idx_f_RRR])*(g[idx_g_L]   + g[idx_g_RRR])*(h[idx_h_L]   + h[idx_h_RRR])));
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLL = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL  = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL   = i - 2 + num_ghosts_0_f;
-                const int idx_f_L    = i - 1 + num_ghosts_0_f;
-                const int idx_f_R    = i     + num_ghosts_0_f;
-                const int idx_f_RR   = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR  = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR = i + 3 + num_ghosts_0_f;
-                
-                const int idx_g_LLLL = i - 4 + num_ghosts_0_g;
-                const int idx_g_LLL  = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL   = i - 2 + num_ghosts_0_g;
-                const int idx_g_L    = i - 1 + num_ghosts_0_g;
-                const int idx_g_R    = i     + num_ghosts_0_g;
-                const int idx_g_RR   = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR  = i + 2 + num_ghosts_0_g;
-                const int idx_g_RRRR = i + 3 + num_ghosts_0_g;
-                
-                const int idx_h_LLLL = i - 4 + num_ghosts_0_h;
-                const int idx_h_LLL  = i - 3 + num_ghosts_0_h;
-                const int idx_h_LL   = i - 2 + num_ghosts_0_h;
-                const int idx_h_L    = i - 1 + num_ghosts_0_h;
-                const int idx_h_R    = i     + num_ghosts_0_h;
-                const int idx_h_RR   = i + 1 + num_ghosts_0_h;
-                const int idx_h_RRR  = i + 2 + num_ghosts_0_h;
-                const int idx_h_RRRR = i + 3 + num_ghosts_0_h;
-                
-                F_face_x[idx_face_x] += dt*quarter*(
-                    d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )*(g[idx_g_L]    + g[idx_g_R]   )*(h[idx_h_L]    + h[idx_h_R]   )) +
-                    d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )*(g[idx_g_LL]   + g[idx_g_R]   )*(h[idx_h_LL]   + h[idx_h_R]   )  +
-                              (f[idx_f_L]    + f[idx_f_RR]  )*(g[idx_g_L]    + g[idx_g_RR]  )*(h[idx_h_L]    + h[idx_h_RR]  )) +
-                    d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )*(g[idx_g_LLL]  + g[idx_g_R]   )*(h[idx_h_LLL]  + h[idx_h_R]   )  +
-                              (f[idx_f_LL]   + f[idx_f_RR]  )*(g[idx_g_LL]   + g[idx_g_RR]  )*(h[idx_h_LL]   + h[idx_h_RR]  )  +
-                              (f[idx_f_L]    + f[idx_f_RRR] )*(g[idx_g_L]    + g[idx_g_RRR] )*(h[idx_h_L]    + h[idx_h_RRR] )) +
-                    d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )*(g[idx_g_LLLL] + g[idx_g_R]   )*(h[idx_h_LLLL] + h[idx_h_R]   )  +
-                              (f[idx_f_LLL]  + f[idx_f_RR]  )*(g[idx_g_LLL]  + g[idx_g_RR]  )*(h[idx_h_LLL]  + h[idx_h_RR]  )  +
-                              (f[idx_f_LL]   + f[idx_f_RRR] )*(g[idx_g_LL]   + g[idx_g_RRR] )*(h[idx_h_LL]   + h[idx_h_RRR] )  +
-                              (f[idx_f_L]    + f[idx_f_RRRR])*(g[idx_g_L]    + g[idx_g_RRRR])*(h[idx_h_L]    + h[idx_h_RRRR])));
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLLL = i - 5 + num_ghosts_0_f;
-                const int idx_f_LLLL  = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL   = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL    = i - 2 + num_ghosts_0_f;
-                const int idx_f_L     = i - 1 + num_ghosts_0_f;
-                const int idx_f_R     = i     + num_ghosts_0_f;
-                const int idx_f_RR    = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR   = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR  = i + 3 + num_ghosts_0_f;
-                const int idx_f_RRRRR = i + 4 + num_ghosts_0_f;
-                
-                const int idx_g_LLLLL = i - 5 + num_ghosts_0_g;
-                const int idx_g_LLLL  = i - 4 + num_ghosts_0_g;
-                const int idx_g_LLL   = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL    = i - 2 + num_ghosts_0_g;
-                const int idx_g_L     = i - 1 + num_ghosts_0_g;
-                const int idx_g_R     = i     + num_ghosts_0_g;
-                const int idx_g_RR    = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR   = i + 2 + num_ghosts_0_g;
-                const int idx_g_RRRR  = i + 3 + num_ghosts_0_g;
-                const int idx_g_RRRRR = i + 4 + num_ghosts_0_g;
-                
-                const int idx_h_LLLLL = i - 5 + num_ghosts_0_h;
-                const int idx_h_LLLL  = i - 4 + num_ghosts_0_h;
-                const int idx_h_LLL   = i - 3 + num_ghosts_0_h;
-                const int idx_h_LL    = i - 2 + num_ghosts_0_h;
-                const int idx_h_L     = i - 1 + num_ghosts_0_h;
-                const int idx_h_R     = i     + num_ghosts_0_h;
-                const int idx_h_RR    = i + 1 + num_ghosts_0_h;
-                const int idx_h_RRR   = i + 2 + num_ghosts_0_h;
-                const int idx_h_RRRR  = i + 3 + num_ghosts_0_h;
-                const int idx_h_RRRRR = i + 4 + num_ghosts_0_h;
-                
-                F_face_x[idx_face_x] += dt*quarter*(
-                    d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )*(g[idx_g_L]     + g[idx_g_R]    )*(h[idx_h_L]     + h[idx_h_R]    )) +
-                    d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )*(g[idx_g_LL]    + g[idx_g_R]    )*(h[idx_h_LL]    + h[idx_h_R]    )  +
-                              (f[idx_f_L]     + f[idx_f_RR]   )*(g[idx_g_L]     + g[idx_g_RR]   )*(h[idx_h_L]     + h[idx_h_RR]   )) +
-                    d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )*(g[idx_g_LLL]   + g[idx_g_R]    )*(h[idx_h_LLL]   + h[idx_h_R]    )  +
-                              (f[idx_f_LL]    + f[idx_f_RR]   )*(g[idx_g_LL]    + g[idx_g_RR]   )*(h[idx_h_LL]    + h[idx_h_RR]   )  +
-                              (f[idx_f_L]     + f[idx_f_RRR]  )*(g[idx_g_L]     + g[idx_g_RRR]  )*(h[idx_h_L]     + h[idx_h_RRR]  )) +
-                    d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )*(g[idx_g_LLLL]  + g[idx_g_R]    )*(h[idx_h_LLLL]  + h[idx_h_R]    )  +
-                              (f[idx_f_LLL]   + f[idx_f_RR]   )*(g[idx_g_LLL]   + g[idx_g_RR]   )*(h[idx_h_LLL]   + h[idx_h_RR]   )  +
-                              (f[idx_f_LL]    + f[idx_f_RRR]  )*(g[idx_g_LL]    + g[idx_g_RRR]  )*(h[idx_h_LL]    + h[idx_h_RRR]  )  +
-                              (f[idx_f_L]     + f[idx_f_RRRR] )*(g[idx_g_L]     + g[idx_g_RRRR] )*(h[idx_h_L]     + h[idx_h_RRRR] )) +
-                    d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )*(g[idx_g_LLLLL] + g[idx_g_R]    )*(h[idx_h_LLLLL] + h[idx_h_R]    )  +
-                              (f[idx_f_LLLL]  + f[idx_f_RR]   )*(g[idx_g_LLLL]  + g[idx_g_RR]   )*(h[idx_h_LLLL]  + h[idx_h_RR]   )  +
-                              (f[idx_f_LLL]   + f[idx_f_RRR]  )*(g[idx_g_LLL]   + g[idx_g_RRR]  )*(h[idx_h_LLL]   + h[idx_h_RRR]  )  +
-                              (f[idx_f_LL]    + f[idx_f_RRRR] )*(g[idx_g_LL]    + g[idx_g_RRRR] )*(h[idx_h_LL]    + h[idx_h_RRRR] )  +
-                              (f[idx_f_L]     + f[idx_f_RRRRR])*(g[idx_g_L]     + g[idx_g_RRRRR])*(h[idx_h_L]     + h[idx_h_RRRRR])));
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = 0; i < interior_dim_0 + 1; i++)
-            {
-                // Compute the linear indices.
-                
-                const int idx_face_x = i;
-                
-                const int idx_f_LLLLLL = i - 6 + num_ghosts_0_f;
-                const int idx_f_LLLLL  = i - 5 + num_ghosts_0_f;
-                const int idx_f_LLLL   = i - 4 + num_ghosts_0_f;
-                const int idx_f_LLL    = i - 3 + num_ghosts_0_f;
-                const int idx_f_LL     = i - 2 + num_ghosts_0_f;
-                const int idx_f_L      = i - 1 + num_ghosts_0_f;
-                const int idx_f_R      = i     + num_ghosts_0_f;
-                const int idx_f_RR     = i + 1 + num_ghosts_0_f;
-                const int idx_f_RRR    = i + 2 + num_ghosts_0_f;
-                const int idx_f_RRRR   = i + 3 + num_ghosts_0_f;
-                const int idx_f_RRRRR  = i + 4 + num_ghosts_0_f;
-                const int idx_f_RRRRRR = i + 5 + num_ghosts_0_f;
-                
-                const int idx_g_LLLLLL = i - 6 + num_ghosts_0_g;
-                const int idx_g_LLLLL  = i - 5 + num_ghosts_0_g;
-                const int idx_g_LLLL   = i - 4 + num_ghosts_0_g;
-                const int idx_g_LLL    = i - 3 + num_ghosts_0_g;
-                const int idx_g_LL     = i - 2 + num_ghosts_0_g;
-                const int idx_g_L      = i - 1 + num_ghosts_0_g;
-                const int idx_g_R      = i     + num_ghosts_0_g;
-                const int idx_g_RR     = i + 1 + num_ghosts_0_g;
-                const int idx_g_RRR    = i + 2 + num_ghosts_0_g;
-                const int idx_g_RRRR   = i + 3 + num_ghosts_0_g;
-                const int idx_g_RRRRR  = i + 4 + num_ghosts_0_g;
-                const int idx_g_RRRRRR = i + 5 + num_ghosts_0_g;
-                
-                const int idx_h_LLLLLL = i - 6 + num_ghosts_0_h;
-                const int idx_h_LLLLL  = i - 5 + num_ghosts_0_h;
-                const int idx_h_LLLL   = i - 4 + num_ghosts_0_h;
-                const int idx_h_LLL    = i - 3 + num_ghosts_0_h;
-                const int idx_h_LL     = i - 2 + num_ghosts_0_h;
-                const int idx_h_L      = i - 1 + num_ghosts_0_h;
-                const int idx_h_R      = i     + num_ghosts_0_h;
-                const int idx_h_RR     = i + 1 + num_ghosts_0_h;
-                const int idx_h_RRR    = i + 2 + num_ghosts_0_h;
-                const int idx_h_RRRR   = i + 3 + num_ghosts_0_h;
-                const int idx_h_RRRRR  = i + 4 + num_ghosts_0_h;
-                const int idx_h_RRRRRR = i + 5 + num_ghosts_0_h;
-                
-                F_face_x[idx_face_x] += dt*quarter*(
-                    d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )*(g[idx_g_L]      + g[idx_g_R]     )*(h[idx_h_L]      + h[idx_h_R]     )) +
-                    d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )*(g[idx_g_LL]     + g[idx_g_R]     )*(h[idx_h_LL]     + h[idx_h_R]     )  +
-                              (f[idx_f_L]      + f[idx_f_RR]    )*(g[idx_g_L]      + g[idx_g_RR]    )*(h[idx_h_L]      + h[idx_h_RR]    )) +
-                    d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )*(g[idx_g_LLL]    + g[idx_g_R]     )*(h[idx_h_LLL]    + h[idx_h_R]     )  +
-                              (f[idx_f_LL]     + f[idx_f_RR]    )*(g[idx_g_LL]     + g[idx_g_RR]    )*(h[idx_h_LL]     + h[idx_h_RR]    )  +
-                              (f[idx_f_L]      + f[idx_f_RRR]   )*(g[idx_g_L]      + g[idx_g_RRR]   )*(h[idx_h_L]      + h[idx_h_RRR]   )) +
-                    d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )*(g[idx_g_LLLL]   + g[idx_g_R]     )*(h[idx_h_LLLL]   + h[idx_h_R]     )  +
-                              (f[idx_f_LLL]    + f[idx_f_RR]    )*(g[idx_g_LLL]    + g[idx_g_RR]    )*(h[idx_h_LLL]    + h[idx_h_RR]    )  +
-                              (f[idx_f_LL]     + f[idx_f_RRR]   )*(g[idx_g_LL]     + g[idx_g_RRR]   )*(h[idx_h_LL]     + h[idx_h_RRR]   )  +
-                              (f[idx_f_L]      + f[idx_f_RRRR]  )*(g[idx_g_L]      + g[idx_g_RRRR]  )*(h[idx_h_L]      + h[idx_h_RRRR]  )) +
-                    d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )*(g[idx_g_LLLLL]  + g[idx_g_R]     )*(h[idx_h_LLLLL]  + h[idx_h_R]     )  +
-                              (f[idx_f_LLLL]   + f[idx_f_RR]    )*(g[idx_g_LLLL]   + g[idx_g_RR]    )*(h[idx_h_LLLL]   + h[idx_h_RR]    )  +
-                              (f[idx_f_LLL]    + f[idx_f_RRR]   )*(g[idx_g_LLL]    + g[idx_g_RRR]   )*(h[idx_h_LLL]    + h[idx_h_RRR]   )  +
-                              (f[idx_f_LL]     + f[idx_f_RRRR]  )*(g[idx_g_LL]     + g[idx_g_RRRR]  )*(h[idx_h_LL]     + h[idx_h_RRRR]  )  +
-                              (f[idx_f_L]      + f[idx_f_RRRRR] )*(g[idx_g_L]      + g[idx_g_RRRRR] )*(h[idx_h_L]      + h[idx_h_RRRRR] )) +
-                    d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )*(g[idx_g_LLLLLL] + g[idx_g_R]     )*(h[idx_h_LLLLLL] + h[idx_h_R]     )  +
-                              (f[idx_f_LLLLL]  + f[idx_f_RR]    )*(g[idx_g_LLLLL]  + g[idx_g_RR]    )*(h[idx_h_LLLLL]  + h[idx_h_RR]    )  +
-                              (f[idx_f_LLLL]   + f[idx_f_RRR]   )*(g[idx_g_LLLL]   + g[idx_g_RRR]   )*(h[idx_h_LLLL]   + h[idx_h_RRR]   )  +
-                              (f[idx_f_LLL]    + f[idx_f_RRRR]  )*(g[idx_g_LLL]    + g[idx_g_RRRR]  )*(h[idx_h_LLL]    + h[idx_h_RRRR]  )  +
-                              (f[idx_f_LL]     + f[idx_f_RRRRR] )*(g[idx_g_LL]     + g[idx_g_RRRRR] )*(h[idx_h_LL]     + h[idx_h_RRRRR] )  +
-                              (f[idx_f_L]      + f[idx_f_RRRRRR])*(g[idx_g_L]      + g[idx_g_RRRRRR])*(h[idx_h_L]      + h[idx_h_RRRRRR])));
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        
-        const int num_ghosts_0_h = num_ghosts_h[0];
-        const int num_ghosts_1_h = num_ghosts_h[1];
-        const int ghostcell_dim_0_h = ghostcell_dims_h[0];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_L = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_L = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_L = (i - 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_R = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_x[idx_face_x] += dt*quarter*(
-                        d_coef_a*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R])*(h[idx_h_L] + h[idx_h_R]));
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LL = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L  = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R  = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LL = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L  = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R  = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_LL = (i - 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_L  = (i - 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_R  = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RR = (i + 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_x[idx_face_x] += dt*quarter*(
-                        d_coef_a*((f[idx_f_L]  + f[idx_f_R] )*(g[idx_g_L]  + g[idx_g_R] )*(h[idx_h_L]  + h[idx_h_R] )) +
-                        d_coef_b*((f[idx_f_LL] + f[idx_f_R] )*(g[idx_g_LL] + g[idx_g_R] )*(h[idx_h_LL] + h[idx_h_R] )  +
-                                  (f[idx_f_L]  + f[idx_f_RR])*(g[idx_g_L]  + g[idx_g_RR])*(h[idx_h_L]  + h[idx_h_RR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLL = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL  = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L   = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R   = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR  = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLL = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL  = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L   = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R   = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR  = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_LLL = (i - 3 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LL  = (i - 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_L   = (i - 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_R   = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RR  = (i + 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRR = (i + 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_x[idx_face_x] += dt*quarter*(
-                        d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )*(g[idx_g_L]   + g[idx_g_R]  )*(h[idx_h_L]   + h[idx_h_R]  )) +
-                        d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )*(g[idx_g_LL]  + g[idx_g_R]  )*(h[idx_h_LL]  + h[idx_h_R]  )  +
-                                  (f[idx_f_L]   + f[idx_f_RR] )*(g[idx_g_L]   + g[idx_g_RR] )*(h[idx_h_L]   + h[idx_h_RR] )) +
-                        d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )*(g[idx_g_LLL] + g[idx_g_R]  )*(h[idx_h_LLL] + h[idx_h_R]  )  +
-                                  (f[idx_f_LL]  + f[idx_f_RR] )*(g[idx_g_LL]  + g[idx_g_RR] )*(h[idx_h_LL]  + h[idx_h_RR] )  +
-                                  (f[idx_f_L]   + f[idx_f_RRR])*(g[idx_g_L]   + g[idx_g_RRR])*(h[idx_h_L]   + h[idx_h_RRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLL = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL  = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL   = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L    = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R    = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR   = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR  = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLLL = (i - 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLL  = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL   = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L    = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R    = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR   = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR  = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRR = (i + 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_LLLL = (i - 4 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LLL  = (i - 3 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LL   = (i - 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_L    = (i - 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_R    = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RR   = (i + 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRR  = (i + 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRRR = (i + 3 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_x[idx_face_x] += dt*quarter*(
-                        d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )*(g[idx_g_L]    + g[idx_g_R]   )*(h[idx_h_L]    + h[idx_h_R]   )) +
-                        d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )*(g[idx_g_LL]   + g[idx_g_R]   )*(h[idx_h_LL]   + h[idx_h_R]   )  +
-                                  (f[idx_f_L]    + f[idx_f_RR]  )*(g[idx_g_L]    + g[idx_g_RR]  )*(h[idx_h_L]    + h[idx_h_RR]  )) +
-                        d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )*(g[idx_g_LLL]  + g[idx_g_R]   )*(h[idx_h_LLL]  + h[idx_h_R]   )  +
-                                  (f[idx_f_LL]   + f[idx_f_RR]  )*(g[idx_g_LL]   + g[idx_g_RR]  )*(h[idx_h_LL]   + h[idx_h_RR]  )  +
-                                  (f[idx_f_L]    + f[idx_f_RRR] )*(g[idx_g_L]    + g[idx_g_RRR] )*(h[idx_h_L]    + h[idx_h_RRR] )) +
-                        d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )*(g[idx_g_LLLL] + g[idx_g_R]   )*(h[idx_h_LLLL] + h[idx_h_R]   )  +
-                                  (f[idx_f_LLL]  + f[idx_f_RR]  )*(g[idx_g_LLL]  + g[idx_g_RR]  )*(h[idx_h_LLL]  + h[idx_h_RR]  )  +
-                                  (f[idx_f_LL]   + f[idx_f_RRR] )*(g[idx_g_LL]   + g[idx_g_RRR] )*(h[idx_h_LL]   + h[idx_h_RRR] )  +
-                                  (f[idx_f_L]    + f[idx_f_RRRR])*(g[idx_g_L]    + g[idx_g_RRRR])*(h[idx_h_L]    + h[idx_h_RRRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLLL = (i - 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLL  = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL   = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL    = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L     = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R     = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR    = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR   = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR  = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRR = (i + 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLLLL = (i - 5 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLLL  = (i - 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLL   = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL    = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L     = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R     = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR    = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR   = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRR  = (i + 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRRR = (i + 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_LLLLL = (i - 5 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LLLL  = (i - 4 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LLL   = (i - 3 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LL    = (i - 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_L     = (i - 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_R     = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RR    = (i + 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRR   = (i + 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRRR  = (i + 3 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRRRR = (i + 4 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_x[idx_face_x] += dt*quarter*(
-                        d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )*(g[idx_g_L]     + g[idx_g_R]    )*(h[idx_h_L]     + h[idx_h_R]    )) +
-                        d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )*(g[idx_g_LL]    + g[idx_g_R]    )*(h[idx_h_LL]    + h[idx_h_R]    )  +
-                                  (f[idx_f_L]     + f[idx_f_RR]   )*(g[idx_g_L]     + g[idx_g_RR]   )*(h[idx_h_L]     + h[idx_h_RR]   )) +
-                        d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )*(g[idx_g_LLL]   + g[idx_g_R]    )*(h[idx_h_LLL]   + h[idx_h_R]    )  +
-                                  (f[idx_f_LL]    + f[idx_f_RR]   )*(g[idx_g_LL]    + g[idx_g_RR]   )*(h[idx_h_LL]    + h[idx_h_RR]   )  +
-                                  (f[idx_f_L]     + f[idx_f_RRR]  )*(g[idx_g_L]     + g[idx_g_RRR]  )*(h[idx_h_L]     + h[idx_h_RRR]  )) +
-                        d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )*(g[idx_g_LLLL]  + g[idx_g_R]    )*(h[idx_h_LLLL]  + h[idx_h_R]    )  +
-                                  (f[idx_f_LLL]   + f[idx_f_RR]   )*(g[idx_g_LLL]   + g[idx_g_RR]   )*(h[idx_h_LLL]   + h[idx_h_RR]   )  +
-                                  (f[idx_f_LL]    + f[idx_f_RRR]  )*(g[idx_g_LL]    + g[idx_g_RRR]  )*(h[idx_h_LL]    + h[idx_h_RRR]  )  +
-                                  (f[idx_f_L]     + f[idx_f_RRRR] )*(g[idx_g_L]     + g[idx_g_RRRR] )*(h[idx_h_L]     + h[idx_h_RRRR] )) +
-                        d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )*(g[idx_g_LLLLL] + g[idx_g_R]    )*(h[idx_h_LLLLL] + h[idx_h_R]    )  +
-                                  (f[idx_f_LLLL]  + f[idx_f_RR]   )*(g[idx_g_LLLL]  + g[idx_g_RR]   )*(h[idx_h_LLLL]  + h[idx_h_RR]   )  +
-                                  (f[idx_f_LLL]   + f[idx_f_RRR]  )*(g[idx_g_LLL]   + g[idx_g_RRR]  )*(h[idx_h_LLL]   + h[idx_h_RRR]  )  +
-                                  (f[idx_f_LL]    + f[idx_f_RRRR] )*(g[idx_g_LL]    + g[idx_g_RRRR] )*(h[idx_h_LL]    + h[idx_h_RRRR] )  +
-                                  (f[idx_f_L]     + f[idx_f_RRRRR])*(g[idx_g_L]     + g[idx_g_RRRRR])*(h[idx_h_L]     + h[idx_h_RRRRR])));
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int j = 0; j < interior_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0 + 1; i++)
-                {
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1);
-                    
-                    const int idx_f_LLLLLL = (i - 6 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLLL  = (i - 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLLL   = (i - 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LLL    = (i - 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_LL     = (i - 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_L      = (i - 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_R      = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RR     = (i + 1 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRR    = (i + 2 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRR   = (i + 3 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRR  = (i + 4 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_RRRRRR = (i + 5 + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_LLLLLL = (i - 6 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLLLL  = (i - 5 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLLL   = (i - 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LLL    = (i - 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_LL     = (i - 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_L      = (i - 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_R      = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RR     = (i + 1 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRR    = (i + 2 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRR   = (i + 3 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRRR  = (i + 4 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_RRRRRR = (i + 5 + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_LLLLLL = (i - 6 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LLLLL  = (i - 5 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LLLL   = (i - 4 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LLL    = (i - 3 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_LL     = (i - 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_L      = (i - 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_R      = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RR     = (i + 1 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRR    = (i + 2 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRRR   = (i + 3 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRRRR  = (i + 4 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_RRRRRR = (i + 5 + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_x[idx_face_x] += dt*quarter*(
-                        d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )*(g[idx_g_L]      + g[idx_g_R]     )*(h[idx_h_L]      + h[idx_h_R]     )) +
-                        d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )*(g[idx_g_LL]     + g[idx_g_R]     )*(h[idx_h_LL]     + h[idx_h_R]     )  +
-                                  (f[idx_f_L]      + f[idx_f_RR]    )*(g[idx_g_L]      + g[idx_g_RR]    )*(h[idx_h_L]      + h[idx_h_RR]    )) +
-                        d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )*(g[idx_g_LLL]    + g[idx_g_R]     )*(h[idx_h_LLL]    + h[idx_h_R]     )  +
-                                  (f[idx_f_LL]     + f[idx_f_RR]    )*(g[idx_g_LL]     + g[idx_g_RR]    )*(h[idx_h_LL]     + h[idx_h_RR]    )  +
-                                  (f[idx_f_L]      + f[idx_f_RRR]   )*(g[idx_g_L]      + g[idx_g_RRR]   )*(h[idx_h_L]      + h[idx_h_RRR]   )) +
-                        d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )*(g[idx_g_LLLL]   + g[idx_g_R]     )*(h[idx_h_LLLL]   + h[idx_h_R]     )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RR]    )*(g[idx_g_LLL]    + g[idx_g_RR]    )*(h[idx_h_LLL]    + h[idx_h_RR]    )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRR]   )*(g[idx_g_LL]     + g[idx_g_RRR]   )*(h[idx_h_LL]     + h[idx_h_RRR]   )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRR]  )*(g[idx_g_L]      + g[idx_g_RRRR]  )*(h[idx_h_L]      + h[idx_h_RRRR]  )) +
-                        d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )*(g[idx_g_LLLLL]  + g[idx_g_R]     )*(h[idx_h_LLLLL]  + h[idx_h_R]     )  +
-                                  (f[idx_f_LLLL]   + f[idx_f_RR]    )*(g[idx_g_LLLL]   + g[idx_g_RR]    )*(h[idx_h_LLLL]   + h[idx_h_RR]    )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RRR]   )*(g[idx_g_LLL]    + g[idx_g_RRR]   )*(h[idx_h_LLL]    + h[idx_h_RRR]   )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRRR]  )*(g[idx_g_LL]     + g[idx_g_RRRR]  )*(h[idx_h_LL]     + h[idx_h_RRRR]  )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRRR] )*(g[idx_g_L]      + g[idx_g_RRRRR] )*(h[idx_h_L]      + h[idx_h_RRRRR] )) +
-                        d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )*(g[idx_g_LLLLLL] + g[idx_g_R]     )*(h[idx_h_LLLLLL] + h[idx_h_R]     )  +
-                                  (f[idx_f_LLLLL]  + f[idx_f_RR]    )*(g[idx_g_LLLLL]  + g[idx_g_RR]    )*(h[idx_h_LLLLL]  + h[idx_h_RR]    )  +
-                                  (f[idx_f_LLLL]   + f[idx_f_RRR]   )*(g[idx_g_LLLL]   + g[idx_g_RRR]   )*(h[idx_h_LLLL]   + h[idx_h_RRR]   )  +
-                                  (f[idx_f_LLL]    + f[idx_f_RRRR]  )*(g[idx_g_LLL]    + g[idx_g_RRRR]  )*(h[idx_h_LLL]    + h[idx_h_RRRR]  )  +
-                                  (f[idx_f_LL]     + f[idx_f_RRRRR] )*(g[idx_g_LL]     + g[idx_g_RRRRR] )*(h[idx_h_LL]     + h[idx_h_RRRRR] )  +
-                                  (f[idx_f_L]      + f[idx_f_RRRRRR])*(g[idx_g_L]      + g[idx_g_RRRRRR])*(h[idx_h_L]      + h[idx_h_RRRRRR])));
-                }
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int num_ghosts_2_g = num_ghosts_g[2];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        const int ghostcell_dim_1_g = ghostcell_dims_g[1];
-        
-        const int num_ghosts_0_h = num_ghosts_h[0];
-        const int num_ghosts_1_h = num_ghosts_h[1];
-        const int num_ghosts_2_h = num_ghosts_h[2];
-        const int ghostcell_dim_0_h = ghostcell_dims_h[0];
-        const int ghostcell_dim_1_h = ghostcell_dims_h[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_L = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_L = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_L = (i - 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_R = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_x[idx_face_x] += dt*quarter*(
-                            d_coef_a*(f[idx_f_L] + f[idx_f_R])*(g[idx_g_L] + g[idx_g_R])*(h[idx_h_L] + h[idx_h_R]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LL = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L  = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LL = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L  = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_LL = (i - 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_L  = (i - 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_R  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RR = (i + 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_x[idx_face_x] += dt*quarter*(
-                            d_coef_a*((f[idx_f_L]  + f[idx_f_R] )*(g[idx_g_L]  + g[idx_g_R] )*(h[idx_h_L]  + h[idx_h_R] )) +
-                            d_coef_b*((f[idx_f_LL] + f[idx_f_R] )*(g[idx_g_LL] + g[idx_g_R] )*(h[idx_h_LL] + h[idx_h_R] )  +
-                                      (f[idx_f_L]  + f[idx_f_RR])*(g[idx_g_L]  + g[idx_g_RR])*(h[idx_h_L]  + h[idx_h_RR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLL = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL  = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L   = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR  = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLL = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL  = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L   = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR  = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_LLL = (i - 3 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LL  = (i - 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_L   = (i - 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_R   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RR  = (i + 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRR = (i + 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_x[idx_face_x] += dt*quarter*(
-                            d_coef_a*((f[idx_f_L]   + f[idx_f_R]  )*(g[idx_g_L]   + g[idx_g_R]  )*(h[idx_h_L]   + h[idx_h_R]  )) +
-                            d_coef_b*((f[idx_f_LL]  + f[idx_f_R]  )*(g[idx_g_LL]  + g[idx_g_R]  )*(h[idx_h_LL]  + h[idx_h_R]  )  +
-                                      (f[idx_f_L]   + f[idx_f_RR] )*(g[idx_g_L]   + g[idx_g_RR] )*(h[idx_h_L]   + h[idx_h_RR] )) +
-                            d_coef_c*((f[idx_f_LLL] + f[idx_f_R]  )*(g[idx_g_LLL] + g[idx_g_R]  )*(h[idx_h_LLL] + h[idx_h_R]  )  +
-                                      (f[idx_f_LL]  + f[idx_f_RR] )*(g[idx_g_LL]  + g[idx_g_RR] )*(h[idx_h_LL]  + h[idx_h_RR] )  +
-                                      (f[idx_f_L]   + f[idx_f_RRR])*(g[idx_g_L]   + g[idx_g_RRR])*(h[idx_h_L]   + h[idx_h_RRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLL = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL  = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL   = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L    = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR   = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR  = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLLL = (i - 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLL  = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL   = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L    = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR   = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR  = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRR = (i + 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_LLLL = (i - 4 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LLL  = (i - 3 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LL   = (i - 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_L    = (i - 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_R    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RR   = (i + 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRR  = (i + 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRRR = (i + 3 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_x[idx_face_x] += dt*quarter*(
-                            d_coef_a*((f[idx_f_L]    + f[idx_f_R]   )*(g[idx_g_L]    + g[idx_g_R]   )*(h[idx_h_L]    + h[idx_h_R]   )) +
-                            d_coef_b*((f[idx_f_LL]   + f[idx_f_R]   )*(g[idx_g_LL]   + g[idx_g_R]   )*(h[idx_h_LL]   + h[idx_h_R]   )  +
-                                      (f[idx_f_L]    + f[idx_f_RR]  )*(g[idx_g_L]    + g[idx_g_RR]  )*(h[idx_h_L]    + h[idx_h_RR]  )) +
-                            d_coef_c*((f[idx_f_LLL]  + f[idx_f_R]   )*(g[idx_g_LLL]  + g[idx_g_R]   )*(h[idx_h_LLL]  + h[idx_h_R]   )  +
-                                      (f[idx_f_LL]   + f[idx_f_RR]  )*(g[idx_g_LL]   + g[idx_g_RR]  )*(h[idx_h_LL]   + h[idx_h_RR]  )  +
-                                      (f[idx_f_L]    + f[idx_f_RRR] )*(g[idx_g_L]    + g[idx_g_RRR] )*(h[idx_h_L]    + h[idx_h_RRR] )) +
-                            d_coef_d*((f[idx_f_LLLL] + f[idx_f_R]   )*(g[idx_g_LLLL] + g[idx_g_R]   )*(h[idx_h_LLLL] + h[idx_h_R]   )  +
-                                      (f[idx_f_LLL]  + f[idx_f_RR]  )*(g[idx_g_LLL]  + g[idx_g_RR]  )*(h[idx_h_LLL]  + h[idx_h_RR]  )  +
-                                      (f[idx_f_LL]   + f[idx_f_RRR] )*(g[idx_g_LL]   + g[idx_g_RRR] )*(h[idx_h_LL]   + h[idx_h_RRR] )  +
-                                      (f[idx_f_L]    + f[idx_f_RRRR])*(g[idx_g_L]    + g[idx_g_RRRR])*(h[idx_h_L]    + h[idx_h_RRRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLLL = (i - 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLL  = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL   = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL    = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L     = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR    = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR   = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR  = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRR = (i + 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLLLL = (i - 5 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLLL  = (i - 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLL   = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL    = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L     = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR    = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR   = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRR  = (i + 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRRR = (i + 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_LLLLL = (i - 5 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LLLL  = (i - 4 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LLL   = (i - 3 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LL    = (i - 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_L     = (i - 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_R     = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RR    = (i + 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRR   = (i + 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRRR  = (i + 3 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRRRR = (i + 4 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_x[idx_face_x] += dt*quarter*(
-                            d_coef_a*((f[idx_f_L]     + f[idx_f_R]    )*(g[idx_g_L]     + g[idx_g_R]    )*(h[idx_h_L]     + h[idx_h_R]    )) +
-                            d_coef_b*((f[idx_f_LL]    + f[idx_f_R]    )*(g[idx_g_LL]    + g[idx_g_R]    )*(h[idx_h_LL]    + h[idx_h_R]    )  +
-                                      (f[idx_f_L]     + f[idx_f_RR]   )*(g[idx_g_L]     + g[idx_g_RR]   )*(h[idx_h_L]     + h[idx_h_RR]   )) +
-                            d_coef_c*((f[idx_f_LLL]   + f[idx_f_R]    )*(g[idx_g_LLL]   + g[idx_g_R]    )*(h[idx_h_LLL]   + h[idx_h_R]    )  +
-                                      (f[idx_f_LL]    + f[idx_f_RR]   )*(g[idx_g_LL]    + g[idx_g_RR]   )*(h[idx_h_LL]    + h[idx_h_RR]   )  +
-                                      (f[idx_f_L]     + f[idx_f_RRR]  )*(g[idx_g_L]     + g[idx_g_RRR]  )*(h[idx_h_L]     + h[idx_h_RRR]  )) +
-                            d_coef_d*((f[idx_f_LLLL]  + f[idx_f_R]    )*(g[idx_g_LLLL]  + g[idx_g_R]    )*(h[idx_h_LLLL]  + h[idx_h_R]    )  +
-                                      (f[idx_f_LLL]   + f[idx_f_RR]   )*(g[idx_g_LLL]   + g[idx_g_RR]   )*(h[idx_h_LLL]   + h[idx_h_RR]   )  +
-                                      (f[idx_f_LL]    + f[idx_f_RRR]  )*(g[idx_g_LL]    + g[idx_g_RRR]  )*(h[idx_h_LL]    + h[idx_h_RRR]  )  +
-                                      (f[idx_f_L]     + f[idx_f_RRRR] )*(g[idx_g_L]     + g[idx_g_RRRR] )*(h[idx_h_L]     + h[idx_h_RRRR] )) +
-                            d_coef_e*((f[idx_f_LLLLL] + f[idx_f_R]    )*(g[idx_g_LLLLL] + g[idx_g_R]    )*(h[idx_h_LLLLL] + h[idx_h_R]    )  +
-                                      (f[idx_f_LLLL]  + f[idx_f_RR]   )*(g[idx_g_LLLL]  + g[idx_g_RR]   )*(h[idx_h_LLLL]  + h[idx_h_RR]   )  +
-                                      (f[idx_f_LLL]   + f[idx_f_RRR]  )*(g[idx_g_LLL]   + g[idx_g_RRR]  )*(h[idx_h_LLL]   + h[idx_h_RRR]  )  +
-                                      (f[idx_f_LL]    + f[idx_f_RRRR] )*(g[idx_g_LL]    + g[idx_g_RRRR] )*(h[idx_h_LL]    + h[idx_h_RRRR] )  +
-                                      (f[idx_f_L]     + f[idx_f_RRRRR])*(g[idx_g_L]     + g[idx_g_RRRRR])*(h[idx_h_L]     + h[idx_h_RRRRR])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0 + 1; i++)
-                    {
-                        // Compute the linear indices.
-                        
-                        const int idx_face_x = i +
-                            j*(interior_dim_0 + 1) +
-                            k*(interior_dim_0 + 1)*interior_dim_1;
-                        
-                        const int idx_f_LLLLLL = (i - 6 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLLL  = (i - 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLLL   = (i - 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LLL    = (i - 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_LL     = (i - 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_L      = (i - 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f + 
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_R      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RR     = (i + 1 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRR    = (i + 2 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRR   = (i + 3 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRR  = (i + 4 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_RRRRRR = (i + 5 + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_LLLLLL = (i - 6 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLLLL  = (i - 5 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLLL   = (i - 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LLL    = (i - 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_LL     = (i - 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_L      = (i - 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g + 
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_R      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RR     = (i + 1 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRR    = (i + 2 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRR   = (i + 3 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRRR  = (i + 4 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_RRRRRR = (i + 5 + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_LLLLLL = (i - 6 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LLLLL  = (i - 5 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LLLL   = (i - 4 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LLL    = (i - 3 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_LL     = (i - 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_L      = (i - 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h + 
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_R      = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RR     = (i + 1 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRR    = (i + 2 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRRR   = (i + 3 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRRRR  = (i + 4 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_RRRRRR = (i + 5 + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_x[idx_face_x] += dt*quarter*(
-                            d_coef_a*((f[idx_f_L]      + f[idx_f_R]     )*(g[idx_g_L]      + g[idx_g_R]     )*(h[idx_h_L]      + h[idx_h_R]     )) +
-                            d_coef_b*((f[idx_f_LL]     + f[idx_f_R]     )*(g[idx_g_LL]     + g[idx_g_R]     )*(h[idx_h_LL]     + h[idx_h_R]     )  +
-                                      (f[idx_f_L]      + f[idx_f_RR]    )*(g[idx_g_L]      + g[idx_g_RR]    )*(h[idx_h_L]      + h[idx_h_RR]    )) +
-                            d_coef_c*((f[idx_f_LLL]    + f[idx_f_R]     )*(g[idx_g_LLL]    + g[idx_g_R]     )*(h[idx_h_LLL]    + h[idx_h_R]     )  +
-                                      (f[idx_f_LL]     + f[idx_f_RR]    )*(g[idx_g_LL]     + g[idx_g_RR]    )*(h[idx_h_LL]     + h[idx_h_RR]    )  +
-                                      (f[idx_f_L]      + f[idx_f_RRR]   )*(g[idx_g_L]      + g[idx_g_RRR]   )*(h[idx_h_L]      + h[idx_h_RRR]   )) +
-                            d_coef_d*((f[idx_f_LLLL]   + f[idx_f_R]     )*(g[idx_g_LLLL]   + g[idx_g_R]     )*(h[idx_h_LLLL]   + h[idx_h_R]     )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RR]    )*(g[idx_g_LLL]    + g[idx_g_RR]    )*(h[idx_h_LLL]    + h[idx_h_RR]    )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRR]   )*(g[idx_g_LL]     + g[idx_g_RRR]   )*(h[idx_h_LL]     + h[idx_h_RRR]   )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRR]  )*(g[idx_g_L]      + g[idx_g_RRRR]  )*(h[idx_h_L]      + h[idx_h_RRRR]  )) +
-                            d_coef_e*((f[idx_f_LLLLL]  + f[idx_f_R]     )*(g[idx_g_LLLLL]  + g[idx_g_R]     )*(h[idx_h_LLLLL]  + h[idx_h_R]     )  +
-                                      (f[idx_f_LLLL]   + f[idx_f_RR]    )*(g[idx_g_LLLL]   + g[idx_g_RR]    )*(h[idx_h_LLLL]   + h[idx_h_RR]    )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RRR]   )*(g[idx_g_LLL]    + g[idx_g_RRR]   )*(h[idx_h_LLL]    + h[idx_h_RRR]   )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRRR]  )*(g[idx_g_LL]     + g[idx_g_RRRR]  )*(h[idx_h_LL]     + h[idx_h_RRRR]  )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRRR] )*(g[idx_g_L]      + g[idx_g_RRRRR] )*(h[idx_h_L]      + h[idx_h_RRRRR] )) +
-                            d_coef_f*((f[idx_f_LLLLLL] + f[idx_f_R]     )*(g[idx_g_LLLLLL] + g[idx_g_R]     )*(h[idx_h_LLLLLL] + h[idx_h_R]     )  +
-                                      (f[idx_f_LLLLL]  + f[idx_f_RR]    )*(g[idx_g_LLLLL]  + g[idx_g_RR]    )*(h[idx_h_LLLLL]  + h[idx_h_RR]    )  +
-                                      (f[idx_f_LLLL]   + f[idx_f_RRR]   )*(g[idx_g_LLLL]   + g[idx_g_RRR]   )*(h[idx_h_LLLL]   + h[idx_h_RRR]   )  +
-                                      (f[idx_f_LLL]    + f[idx_f_RRRR]  )*(g[idx_g_LLL]    + g[idx_g_RRRR]  )*(h[idx_h_LLL]    + h[idx_h_RRRR]  )  +
-                                      (f[idx_f_LL]     + f[idx_f_RRRRR] )*(g[idx_g_LL]     + g[idx_g_RRRRR] )*(h[idx_h_LL]     + h[idx_h_RRRRR] )  +
-                                      (f[idx_f_L]      + f[idx_f_RRRRRR])*(g[idx_g_L]      + g[idx_g_RRRRRR])*(h[idx_h_L]      + h[idx_h_RRRRRR])));
-                    }
-                }
-            }
-        }
-    }
-}
-
-
-/*
- * Add linear term to convective flux in y-direction.
- */
-void
-ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxY(
-    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
-    const int component_idx_flux,
-    const int component_idx_f,
-    const double dt) const
-{
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-    if (d_dim == tbox::Dimension(1))
-    {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxY:"
-            " Cannot compute linear term in y-direction for one-dimensional problem!");
-    }
-#endif
-    
-    const hier::Box interior_box = data_convective_flux->getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-#endif
-    
-    // Get the dimensions of the ghost cell box.
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    /*
-     * Get the pointers to the data.
-     */
-    
-    double* F_face_y = data_convective_flux->getPointer(1, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    
-    if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell box.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_B = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_y[idx_face_y] += dt*(
-                        d_coef_a*(f[idx_f_B] + f[idx_f_T]));
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BB = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B  = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T  = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_y[idx_face_y] += dt*(
-                        d_coef_a*((f[idx_f_B]  + f[idx_f_T] )) +
-                        d_coef_b*((f[idx_f_BB] + f[idx_f_T] )  +
-                                  (f[idx_f_B]  + f[idx_f_TT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBB = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB  = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B   = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T   = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT  = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_y[idx_face_y] += dt*(
-                        d_coef_a*((f[idx_f_B]   + f[idx_f_T]  )) +
-                        d_coef_b*((f[idx_f_BB]  + f[idx_f_T]  )  +
-                                  (f[idx_f_B]   + f[idx_f_TT] )) +
-                        d_coef_c*((f[idx_f_BBB] + f[idx_f_T]  )  +
-                                  (f[idx_f_BB]  + f[idx_f_TT] )  +
-                                  (f[idx_f_B]   + f[idx_f_TTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB   = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B    = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T    = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT   = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT  = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_y[idx_face_y] += dt*(
-                        d_coef_a*((f[idx_f_B]    + f[idx_f_T]   )) +
-                        d_coef_b*((f[idx_f_BB]   + f[idx_f_T]   )  +
-                                  (f[idx_f_B]    + f[idx_f_TT]  )) +
-                        d_coef_c*((f[idx_f_BBB]  + f[idx_f_T]   )  +
-                                  (f[idx_f_BB]   + f[idx_f_TT]  )  +
-                                  (f[idx_f_B]    + f[idx_f_TTT] )) +
-                        d_coef_d*((f[idx_f_BBBB] + f[idx_f_T]   )  +
-                                  (f[idx_f_BBB]  + f[idx_f_TT]  )  +
-                                  (f[idx_f_BB]   + f[idx_f_TTT] )  +
-                                  (f[idx_f_B]    + f[idx_f_TTTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                        (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB    = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B     = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T     = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT    = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT   = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT  = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTT = (i + num_ghosts_0_f) +
-                        (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_y[idx_face_y] += dt*(
-                        d_coef_a*((f[idx_f_B]     + f[idx_f_T]    )) +
-                        d_coef_b*((f[idx_f_BB]    + f[idx_f_T]    )  +
-                                  (f[idx_f_B]     + f[idx_f_TT]   )) +
-                        d_coef_c*((f[idx_f_BBB]   + f[idx_f_T]    )  +
-                                  (f[idx_f_BB]    + f[idx_f_TT]   )  +
-                                  (f[idx_f_B]     + f[idx_f_TTT]  )) +
-                        d_coef_d*((f[idx_f_BBBB]  + f[idx_f_T]    )  +
-                                  (f[idx_f_BBB]   + f[idx_f_TT]   )  +
-                                  (f[idx_f_BB]    + f[idx_f_TTT]  )  +
-                                  (f[idx_f_B]     + f[idx_f_TTTT] )) +
-                        d_coef_e*((f[idx_f_BBBBB] + f[idx_f_T]    )  +
-                                  (f[idx_f_BBBB]  + f[idx_f_TT]   )  +
-                                  (f[idx_f_BBB]   + f[idx_f_TTT]  )  +
-                                  (f[idx_f_BB]    + f[idx_f_TTTT] )  +
-                                  (f[idx_f_B]     + f[idx_f_TTTTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                        (j - 6 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                        (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB     = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B      = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T      = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT     = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT    = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT   = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTT  = (i + num_ghosts_0_f) +
-                        (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTTT = (i + num_ghosts_0_f) +
-                        (j + 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    F_face_y[idx_face_y] += dt*(
-                        d_coef_a*((f[idx_f_B]      + f[idx_f_T]     )) +
-                        d_coef_b*((f[idx_f_BB]     + f[idx_f_T]     )  +
-                                  (f[idx_f_B]      + f[idx_f_TT]    )) +
-                        d_coef_c*((f[idx_f_BBB]    + f[idx_f_T]     )  +
-                                  (f[idx_f_BB]     + f[idx_f_TT]    )  +
-                                  (f[idx_f_B]      + f[idx_f_TTT]   )) +
-                        d_coef_d*((f[idx_f_BBBB]   + f[idx_f_T]     )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TT]    )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTT]   )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTT]  )) +
-                        d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_T]     )  +
-                                  (f[idx_f_BBBB]   + f[idx_f_TT]    )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TTT]   )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTTT]  )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTTT] )) +
-                        d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_T]     )  +
-                                  (f[idx_f_BBBBB]  + f[idx_f_TT]    )  +
-                                  (f[idx_f_BBBB]   + f[idx_f_TTT]   )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TTTT]  )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTTTT] )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTTTT])));
-                }
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell box.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_B = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_y[idx_face_y] += dt*(
-                            d_coef_a*(f[idx_f_B] + f[idx_f_T]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BB = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B  = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_y[idx_face_y] += dt*(
-                            d_coef_a*((f[idx_f_B]  + f[idx_f_T] )) +
-                            d_coef_b*((f[idx_f_BB] + f[idx_f_T] )  +
-                                      (f[idx_f_B]  + f[idx_f_TT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBB = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB  = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B   = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT  = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_y[idx_face_y] += dt*(
-                            d_coef_a*((f[idx_f_B]   + f[idx_f_T]  )) +
-                            d_coef_b*((f[idx_f_BB]  + f[idx_f_T]  )  +
-                                      (f[idx_f_B]   + f[idx_f_TT] )) +
-                            d_coef_c*((f[idx_f_BBB] + f[idx_f_T]  )  +
-                                      (f[idx_f_BB]  + f[idx_f_TT] )  +
-                                      (f[idx_f_B]   + f[idx_f_TTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB   = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B    = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT   = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT  = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_y[idx_face_y] += dt*(
-                            d_coef_a*((f[idx_f_B]    + f[idx_f_T]   )) +
-                            d_coef_b*((f[idx_f_BB]   + f[idx_f_T]   )  +
-                                      (f[idx_f_B]    + f[idx_f_TT]  )) +
-                            d_coef_c*((f[idx_f_BBB]  + f[idx_f_T]   )  +
-                                      (f[idx_f_BB]   + f[idx_f_TT]  )  +
-                                      (f[idx_f_B]    + f[idx_f_TTT] )) +
-                            d_coef_d*((f[idx_f_BBBB] + f[idx_f_T]   )  +
-                                      (f[idx_f_BBB]  + f[idx_f_TT]  )  +
-                                      (f[idx_f_BB]   + f[idx_f_TTT] )  +
-                                      (f[idx_f_B]    + f[idx_f_TTTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                            (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB    = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B     = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT    = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT   = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT  = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTT = (i + num_ghosts_0_f) +
-                            (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_y[idx_face_y] += dt*(
-                            d_coef_a*((f[idx_f_B]     + f[idx_f_T]    )) +
-                            d_coef_b*((f[idx_f_BB]    + f[idx_f_T]    )  +
-                                      (f[idx_f_B]     + f[idx_f_TT]   )) +
-                            d_coef_c*((f[idx_f_BBB]   + f[idx_f_T]    )  +
-                                      (f[idx_f_BB]    + f[idx_f_TT]   )  +
-                                      (f[idx_f_B]     + f[idx_f_TTT]  )) +
-                            d_coef_d*((f[idx_f_BBBB]  + f[idx_f_T]    )  +
-                                      (f[idx_f_BBB]   + f[idx_f_TT]   )  +
-                                      (f[idx_f_BB]    + f[idx_f_TTT]  )  +
-                                      (f[idx_f_B]     + f[idx_f_TTTT] )) +
-                            d_coef_e*((f[idx_f_BBBBB] + f[idx_f_T]    )  +
-                                      (f[idx_f_BBBB]  + f[idx_f_TT]   )  +
-                                      (f[idx_f_BBB]   + f[idx_f_TTT]  )  +
-                                      (f[idx_f_BB]    + f[idx_f_TTTT] )  +
-                                      (f[idx_f_B]     + f[idx_f_TTTTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                            (j - 6 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                            (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB     = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B      = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT     = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT    = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT   = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTT  = (i + num_ghosts_0_f) +
-                            (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTTT = (i + num_ghosts_0_f) +
-                            (j + 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_y[idx_face_y] += dt*(
-                            d_coef_a*((f[idx_f_B]      + f[idx_f_T]     )) +
-                            d_coef_b*((f[idx_f_BB]     + f[idx_f_T]     )  +
-                                      (f[idx_f_B]      + f[idx_f_TT]    )) +
-                            d_coef_c*((f[idx_f_BBB]    + f[idx_f_T]     )  +
-                                      (f[idx_f_BB]     + f[idx_f_TT]    )  +
-                                      (f[idx_f_B]      + f[idx_f_TTT]   )) +
-                            d_coef_d*((f[idx_f_BBBB]   + f[idx_f_T]     )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TT]    )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTT]   )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTT]  )) +
-                            d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_T]     )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_TT]    )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TTT]   )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTTT]  )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTTT] )) +
-                            d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_T]     )  +
-                                      (f[idx_f_BBBBB]  + f[idx_f_TT]    )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_TTT]   )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TTTT]  )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTTTT] )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTTTT])));
-                    }
-                }
-            }
-        }
-    }
-}
-
-
-/*
- * Add quadratic term to convective flux in y-direction.
- */
-void
-ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxY(
-    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
-    const int component_idx_flux,
-    const int component_idx_f,
-    const int component_idx_g,
-    const double dt) const
-{
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-    if (d_dim == tbox::Dimension(1))
-    {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxY:"
-            " Cannot compute quadratic term in y-direction for one-dimensional problem!");
-    }
-#endif
-    
-    const hier::Box interior_box = data_convective_flux->getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
-#endif
-    
-    // Get the dimensions of the ghost cell boxes.
-    
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    const hier::Box ghost_box_g = data_g->getGhostBox();
-    const hier::IntVector ghostcell_dims_g = ghost_box_g.numberCells();
-    const hier::IntVector num_ghosts_g = data_g->getGhostCellWidth();
-    
-    /*
-     * Get the pointers to the data.
-     */
-    
-    double* F_face_y = data_convective_flux->getPointer(1, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    double* g        = data_g->getPointer(component_idx_g);
-    
-    const double half = double(1)/double(2);
-    
-    if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_B = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_B = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_y[idx_face_y] += dt*half*(
-                        d_coef_a*(f[idx_f_B] + f[idx_f_T])*(g[idx_g_B] + g[idx_g_T]));
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BB = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B  = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T  = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BB = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B  = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T  = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_y[idx_face_y] += dt*half*(
-                        d_coef_a*((f[idx_f_B]  + f[idx_f_T] )*(g[idx_g_B]  + g[idx_g_T] )) +
-                        d_coef_b*((f[idx_f_BB] + f[idx_f_T] )*(g[idx_g_BB] + g[idx_g_T] )  +
-                                  (f[idx_f_B]  + f[idx_f_TT])*(g[idx_g_B]  + g[idx_g_TT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBB = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB  = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B   = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T   = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT  = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBB = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB  = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B   = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T   = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT  = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_y[idx_face_y] += dt*half*(
-                        d_coef_a*((f[idx_f_B]   + f[idx_f_T]  )*(g[idx_g_B]   + g[idx_g_T]  )) +
-                        d_coef_b*((f[idx_f_BB]  + f[idx_f_T]  )*(g[idx_g_BB]  + g[idx_g_T]  )  +
-                                  (f[idx_f_B]   + f[idx_f_TT] )*(g[idx_g_B]   + g[idx_g_TT] )) +
-                        d_coef_c*((f[idx_f_BBB] + f[idx_f_T]  )*(g[idx_g_BBB] + g[idx_g_T]  )  +
-                                  (f[idx_f_BB]  + f[idx_f_TT] )*(g[idx_g_BB]  + g[idx_g_TT] )  +
-                                  (f[idx_f_B]   + f[idx_f_TTT])*(g[idx_g_B]   + g[idx_g_TTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB   = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B    = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T    = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT   = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT  = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBBB = (i + num_ghosts_0_g) +
-                        (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBB  = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB   = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B    = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T    = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT   = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT  = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTT = (i + num_ghosts_0_g) +
-                        (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_y[idx_face_y] += dt*half*(
-                        d_coef_a*((f[idx_f_B]    + f[idx_f_T]   )*(g[idx_g_B]    + g[idx_g_T]   )) +
-                        d_coef_b*((f[idx_f_BB]   + f[idx_f_T]   )*(g[idx_g_BB]   + g[idx_g_T]   )  +
-                                  (f[idx_f_B]    + f[idx_f_TT]  )*(g[idx_g_B]    + g[idx_g_TT]  )) +
-                        d_coef_c*((f[idx_f_BBB]  + f[idx_f_T]   )*(g[idx_g_BBB]  + g[idx_g_T]   )  +
-                                  (f[idx_f_BB]   + f[idx_f_TT]  )*(g[idx_g_BB]   + g[idx_g_TT]  )  +
-                                  (f[idx_f_B]    + f[idx_f_TTT] )*(g[idx_g_B]    + g[idx_g_TTT] )) +
-                        d_coef_d*((f[idx_f_BBBB] + f[idx_f_T]   )*(g[idx_g_BBBB] + g[idx_g_T]   )  +
-                                  (f[idx_f_BBB]  + f[idx_f_TT]  )*(g[idx_g_BBB]  + g[idx_g_TT]  )  +
-                                  (f[idx_f_BB]   + f[idx_f_TTT] )*(g[idx_g_BB]   + g[idx_g_TTT] )  +
-                                  (f[idx_f_B]    + f[idx_f_TTTT])*(g[idx_g_B]    + g[idx_g_TTTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                        (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB    = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B     = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T     = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT    = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT   = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT  = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTT = (i + num_ghosts_0_f) +
-                        (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBBBB = (i + num_ghosts_0_g) +
-                        (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBBB  = (i + num_ghosts_0_g) +
-                        (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBB   = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB    = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B     = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T     = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT    = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT   = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTT  = (i + num_ghosts_0_g) +
-                        (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTTT = (i + num_ghosts_0_g) +
-                        (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_y[idx_face_y] += dt*half*(
-                        d_coef_a*((f[idx_f_B]     + f[idx_f_T]    )*(g[idx_g_B]     + g[idx_g_T]    )) +
-                        d_coef_b*((f[idx_f_BB]    + f[idx_f_T]    )*(g[idx_g_BB]    + g[idx_g_T]    )  +
-                                  (f[idx_f_B]     + f[idx_f_TT]   )*(g[idx_g_B]     + g[idx_g_TT]   )) +
-                        d_coef_c*((f[idx_f_BBB]   + f[idx_f_T]    )*(g[idx_g_BBB]   + g[idx_g_T]    )  +
-                                  (f[idx_f_BB]    + f[idx_f_TT]   )*(g[idx_g_BB]    + g[idx_g_TT]   )  +
-                                  (f[idx_f_B]     + f[idx_f_TTT]  )*(g[idx_g_B]     + g[idx_g_TTT]  )) +
-                        d_coef_d*((f[idx_f_BBBB]  + f[idx_f_T]    )*(g[idx_g_BBBB]  + g[idx_g_T]    )  +
-                                  (f[idx_f_BBB]   + f[idx_f_TT]   )*(g[idx_g_BBB]   + g[idx_g_TT]   )  +
-                                  (f[idx_f_BB]    + f[idx_f_TTT]  )*(g[idx_g_BB]    + g[idx_g_TTT]  )  +
-                                  (f[idx_f_B]     + f[idx_f_TTTT] )*(g[idx_g_B]     + g[idx_g_TTTT] )) +
-                        d_coef_e*((f[idx_f_BBBBB] + f[idx_f_T]    )*(g[idx_g_BBBBB] + g[idx_g_T]    )  +
-                                  (f[idx_f_BBBB]  + f[idx_f_TT]   )*(g[idx_g_BBBB]  + g[idx_g_TT]   )  +
-                                  (f[idx_f_BBB]   + f[idx_f_TTT]  )*(g[idx_g_BBB]   + g[idx_g_TTT]  )  +
-                                  (f[idx_f_BB]    + f[idx_f_TTTT] )*(g[idx_g_BB]    + g[idx_g_TTTT] )  +
-                                  (f[idx_f_B]     + f[idx_f_TTTTT])*(g[idx_g_B]     + g[idx_g_TTTTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                        (j - 6 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                        (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB     = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B      = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T      = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT     = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT    = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT   = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTT  = (i + num_ghosts_0_f) +
-                        (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTTT = (i + num_ghosts_0_f) +
-                        (j + 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBBBBB = (i + num_ghosts_0_g) +
-                        (j - 6 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBBBB  = (i + num_ghosts_0_g) +
-                        (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBBB   = (i + num_ghosts_0_g) +
-                        (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBB    = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB     = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B      = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T      = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT     = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT    = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTT   = (i + num_ghosts_0_g) +
-                        (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTTT  = (i + num_ghosts_0_g) +
-                        (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTTTT = (i + num_ghosts_0_g) +
-                        (j + 5 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    F_face_y[idx_face_y] += dt*half*(
-                        d_coef_a*((f[idx_f_B]      + f[idx_f_T]     )*(g[idx_g_B]      + g[idx_g_T]     )) +
-                        d_coef_b*((f[idx_f_BB]     + f[idx_f_T]     )*(g[idx_g_BB]     + g[idx_g_T]     )  +
-                                  (f[idx_f_B]      + f[idx_f_TT]    )*(g[idx_g_B]      + g[idx_g_TT]    )) +
-                        d_coef_c*((f[idx_f_BBB]    + f[idx_f_T]     )*(g[idx_g_BBB]    + g[idx_g_T]     )  +
-                                  (f[idx_f_BB]     + f[idx_f_TT]    )*(g[idx_g_BB]     + g[idx_g_TT]    )  +
-                                  (f[idx_f_B]      + f[idx_f_TTT]   )*(g[idx_g_B]      + g[idx_g_TTT]   )) +
-                        d_coef_d*((f[idx_f_BBBB]   + f[idx_f_T]     )*(g[idx_g_BBBB]   + g[idx_g_T]     )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TT]    )*(g[idx_g_BBB]    + g[idx_g_TT]    )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTT]   )*(g[idx_g_BB]     + g[idx_g_TTT]   )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTT]  )*(g[idx_g_B]      + g[idx_g_TTTT]  )) +
-                        d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_T]     )*(g[idx_g_BBBBB]  + g[idx_g_T]     )  +
-                                  (f[idx_f_BBBB]   + f[idx_f_TT]    )*(g[idx_g_BBBB]   + g[idx_g_TT]    )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TTT]   )*(g[idx_g_BBB]    + g[idx_g_TTT]   )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTTT]  )*(g[idx_g_BB]     + g[idx_g_TTTT]  )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTTT] )*(g[idx_g_B]      + g[idx_g_TTTTT] )) +
-                        d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_T]     )*(g[idx_g_BBBBBB] + g[idx_g_T]     )  +
-                                  (f[idx_f_BBBBB]  + f[idx_f_TT]    )*(g[idx_g_BBBBB]  + g[idx_g_TT]    )  +
-                                  (f[idx_f_BBBB]   + f[idx_f_TTT]   )*(g[idx_g_BBBB]   + g[idx_g_TTT]   )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TTTT]  )*(g[idx_g_BBB]    + g[idx_g_TTTT]  )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTTTT] )*(g[idx_g_BB]     + g[idx_g_TTTTT] )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTTTT])*(g[idx_g_B]      + g[idx_g_TTTTTT])));
-                }
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int num_ghosts_2_g = num_ghosts_g[2];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        const int ghostcell_dim_1_g = ghostcell_dims_g[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_B = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_B = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_y[idx_face_y] += dt*half*(
-                            d_coef_a*(f[idx_f_B] + f[idx_f_T])*(g[idx_g_B] + g[idx_g_T]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BB = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B  = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BB = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B  = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_y[idx_face_y] += dt*half*(
-                            d_coef_a*((f[idx_f_B]  + f[idx_f_T] )*(g[idx_g_B]  + g[idx_g_T] )) +
-                            d_coef_b*((f[idx_f_BB] + f[idx_f_T] )*(g[idx_g_BB] + g[idx_g_T] )  +
-                                      (f[idx_f_B]  + f[idx_f_TT])*(g[idx_g_B]  + g[idx_g_TT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBB = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB  = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B   = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT  = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBB = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB  = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B   = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT  = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_y[idx_face_y] += dt*half*(
-                            d_coef_a*((f[idx_f_B]   + f[idx_f_T]  )*(g[idx_g_B]   + g[idx_g_T]  )) +
-                            d_coef_b*((f[idx_f_BB]  + f[idx_f_T]  )*(g[idx_g_BB]  + g[idx_g_T]  )  +
-                                      (f[idx_f_B]   + f[idx_f_TT] )*(g[idx_g_B]   + g[idx_g_TT] )) +
-                            d_coef_c*((f[idx_f_BBB] + f[idx_f_T]  )*(g[idx_g_BBB] + g[idx_g_T]  )  +
-                                      (f[idx_f_BB]  + f[idx_f_TT] )*(g[idx_g_BB]  + g[idx_g_TT] )  +
-                                      (f[idx_f_B]   + f[idx_f_TTT])*(g[idx_g_B]   + g[idx_g_TTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB   = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B    = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT   = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT  = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBB = (i + num_ghosts_0_g) +
-                            (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB  = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB   = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B    = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT   = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT  = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTT = (i + num_ghosts_0_g) +
-                            (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_y[idx_face_y] += dt*half*(
-                            d_coef_a*((f[idx_f_B]    + f[idx_f_T]   )*(g[idx_g_B]    + g[idx_g_T]   )) +
-                            d_coef_b*((f[idx_f_BB]   + f[idx_f_T]   )*(g[idx_g_BB]   + g[idx_g_T]   )  +
-                                      (f[idx_f_B]    + f[idx_f_TT]  )*(g[idx_g_B]    + g[idx_g_TT]  )) +
-                            d_coef_c*((f[idx_f_BBB]  + f[idx_f_T]   )*(g[idx_g_BBB]  + g[idx_g_T]   )  +
-                                      (f[idx_f_BB]   + f[idx_f_TT]  )*(g[idx_g_BB]   + g[idx_g_TT]  )  +
-                                      (f[idx_f_B]    + f[idx_f_TTT] )*(g[idx_g_B]    + g[idx_g_TTT] )) +
-                            d_coef_d*((f[idx_f_BBBB] + f[idx_f_T]   )*(g[idx_g_BBBB] + g[idx_g_T]   )  +
-                                      (f[idx_f_BBB]  + f[idx_f_TT]  )*(g[idx_g_BBB]  + g[idx_g_TT]  )  +
-                                      (f[idx_f_BB]   + f[idx_f_TTT] )*(g[idx_g_BB]   + g[idx_g_TTT] )  +
-                                      (f[idx_f_B]    + f[idx_f_TTTT])*(g[idx_g_B]    + g[idx_g_TTTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                            (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB    = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B     = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT    = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT   = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT  = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTT = (i + num_ghosts_0_f) +
-                            (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBB = (i + num_ghosts_0_g) +
-                            (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB  = (i + num_ghosts_0_g) +
-                            (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB   = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB    = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B     = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT    = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT   = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTT  = (i + num_ghosts_0_g) +
-                            (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTTT = (i + num_ghosts_0_g) +
-                            (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_y[idx_face_y] += dt*half*(
-                            d_coef_a*((f[idx_f_B]     + f[idx_f_T]    )*(g[idx_g_B]     + g[idx_g_T]    )) +
-                            d_coef_b*((f[idx_f_BB]    + f[idx_f_T]    )*(g[idx_g_BB]    + g[idx_g_T]    )  +
-                                      (f[idx_f_B]     + f[idx_f_TT]   )*(g[idx_g_B]     + g[idx_g_TT]   )) +
-                            d_coef_c*((f[idx_f_BBB]   + f[idx_f_T]    )*(g[idx_g_BBB]   + g[idx_g_T]    )  +
-                                      (f[idx_f_BB]    + f[idx_f_TT]   )*(g[idx_g_BB]    + g[idx_g_TT]   )  +
-                                      (f[idx_f_B]     + f[idx_f_TTT]  )*(g[idx_g_B]     + g[idx_g_TTT]  )) +
-                            d_coef_d*((f[idx_f_BBBB]  + f[idx_f_T]    )*(g[idx_g_BBBB]  + g[idx_g_T]    )  +
-                                      (f[idx_f_BBB]   + f[idx_f_TT]   )*(g[idx_g_BBB]   + g[idx_g_TT]   )  +
-                                      (f[idx_f_BB]    + f[idx_f_TTT]  )*(g[idx_g_BB]    + g[idx_g_TTT]  )  +
-                                      (f[idx_f_B]     + f[idx_f_TTTT] )*(g[idx_g_B]     + g[idx_g_TTTT] )) +
-                            d_coef_e*((f[idx_f_BBBBB] + f[idx_f_T]    )*(g[idx_g_BBBBB] + g[idx_g_T]    )  +
-                                      (f[idx_f_BBBB]  + f[idx_f_TT]   )*(g[idx_g_BBBB]  + g[idx_g_TT]   )  +
-                                      (f[idx_f_BBB]   + f[idx_f_TTT]  )*(g[idx_g_BBB]   + g[idx_g_TTT]  )  +
-                                      (f[idx_f_BB]    + f[idx_f_TTTT] )*(g[idx_g_BB]    + g[idx_g_TTTT] )  +
-                                      (f[idx_f_B]     + f[idx_f_TTTTT])*(g[idx_g_B]     + g[idx_g_TTTTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                            (j - 6 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                            (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB     = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B      = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT     = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT    = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT   = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTT  = (i + num_ghosts_0_f) +
-                            (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTTT = (i + num_ghosts_0_f) +
-                            (j + 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBBB = (i + num_ghosts_0_g) +
-                            (j - 6 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBBB  = (i + num_ghosts_0_g) +
-                            (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB   = (i + num_ghosts_0_g) +
-                            (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB    = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB     = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B      = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT     = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT    = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTT   = (i + num_ghosts_0_g) +
-                            (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTTT  = (i + num_ghosts_0_g) +
-                            (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTTTT = (i + num_ghosts_0_g) +
-                            (j + 5 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_y[idx_face_y] += dt*half*(
-                            d_coef_a*((f[idx_f_B]      + f[idx_f_T]     )*(g[idx_g_B]      + g[idx_g_T]     )) +
-                            d_coef_b*((f[idx_f_BB]     + f[idx_f_T]     )*(g[idx_g_BB]     + g[idx_g_T]     )  +
-                                      (f[idx_f_B]      + f[idx_f_TT]    )*(g[idx_g_B]      + g[idx_g_TT]    )) +
-                            d_coef_c*((f[idx_f_BBB]    + f[idx_f_T]     )*(g[idx_g_BBB]    + g[idx_g_T]     )  +
-                                      (f[idx_f_BB]     + f[idx_f_TT]    )*(g[idx_g_BB]     + g[idx_g_TT]    )  +
-                                      (f[idx_f_B]      + f[idx_f_TTT]   )*(g[idx_g_B]      + g[idx_g_TTT]   )) +
-                            d_coef_d*((f[idx_f_BBBB]   + f[idx_f_T]     )*(g[idx_g_BBBB]   + g[idx_g_T]     )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TT]    )*(g[idx_g_BBB]    + g[idx_g_TT]    )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTT]   )*(g[idx_g_BB]     + g[idx_g_TTT]   )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTT]  )*(g[idx_g_B]      + g[idx_g_TTTT]  )) +
-                            d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_T]     )*(g[idx_g_BBBBB]  + g[idx_g_T]     )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_TT]    )*(g[idx_g_BBBB]   + g[idx_g_TT]    )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TTT]   )*(g[idx_g_BBB]    + g[idx_g_TTT]   )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTTT]  )*(g[idx_g_BB]     + g[idx_g_TTTT]  )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTTT] )*(g[idx_g_B]      + g[idx_g_TTTTT] )) +
-                            d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_T]     )*(g[idx_g_BBBBBB] + g[idx_g_T]     )  +
-                                      (f[idx_f_BBBBB]  + f[idx_f_TT]    )*(g[idx_g_BBBBB]  + g[idx_g_TT]    )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_TTT]   )*(g[idx_g_BBBB]   + g[idx_g_TTT]   )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TTTT]  )*(g[idx_g_BBB]    + g[idx_g_TTTT]  )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTTTT] )*(g[idx_g_BB]     + g[idx_g_TTTTT] )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTTTT])*(g[idx_g_B]      + g[idx_g_TTTTTT])));
-                    }
-                }
-            }
-        }
-    }
-}
-
-
-/*
- * Add cubic term to convective flux in y-direction.
- */
-void
-ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxY(
-    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_h,
-    const int component_idx_flux,
-    const int component_idx_f,
-    const int component_idx_g,
-    const int component_idx_h,
-    const double dt) const
-{
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-    if (d_dim == tbox::Dimension(1))
-    {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxY:"
-            " Cannot compute cubic term in y-direction for one-dimensional problem!");
-    }
-#endif
-    
-    const hier::Box interior_box = data_convective_flux->getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_h->getBox().isSpatiallyEqual(interior_box));
-#endif
-    
-    // Get the dimensions of the ghost cell boxes.
-    
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    const hier::Box ghost_box_g = data_g->getGhostBox();
-    const hier::IntVector ghostcell_dims_g = ghost_box_g.numberCells();
-    const hier::IntVector num_ghosts_g = data_g->getGhostCellWidth();
-    
-    const hier::Box ghost_box_h = data_h->getGhostBox();
-    const hier::IntVector ghostcell_dims_h = ghost_box_h.numberCells();
-    const hier::IntVector num_ghosts_h = data_h->getGhostCellWidth();
-    
-    /*
-     * Get the pointers to the data.
-     */
-    
-    double* F_face_y = data_convective_flux->getPointer(1, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    double* g        = data_g->getPointer(component_idx_g);
-    double* h        = data_h->getPointer(component_idx_h);
-    
-    const double quarter = double(1)/double(4);
-    
-    if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        
-        const int num_ghosts_0_h = num_ghosts_h[0];
-        const int num_ghosts_1_h = num_ghosts_h[1];
-        const int ghostcell_dim_0_h = ghostcell_dims_h[0];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_B = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_B = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_B = (i + num_ghosts_0_h) +
-                        (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_T = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_y[idx_face_y] += dt*quarter*(
-                        d_coef_a*(f[idx_f_B] + f[idx_f_T])*(g[idx_g_B] + g[idx_g_T])*(h[idx_h_B] + h[idx_h_T]));
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BB = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B  = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T  = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BB = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B  = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T  = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_BB = (i + num_ghosts_0_h) +
-                        (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_B  = (i + num_ghosts_0_h) +
-                        (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_T  = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TT = (i + num_ghosts_0_h) +
-                        (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_y[idx_face_y] += dt*quarter*(
-                        d_coef_a*((f[idx_f_B]  + f[idx_f_T] )*(g[idx_g_B]  + g[idx_g_T] )*(h[idx_h_B]  + h[idx_h_T] )) +
-                        d_coef_b*((f[idx_f_BB] + f[idx_f_T] )*(g[idx_g_BB] + g[idx_g_T] )*(h[idx_h_BB] + h[idx_h_T] )  +
-                                  (f[idx_f_B]  + f[idx_f_TT])*(g[idx_g_B]  + g[idx_g_TT])*(h[idx_h_B]  + h[idx_h_TT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBB = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB  = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B   = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T   = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT  = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBB = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB  = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B   = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T   = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT  = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_BBB = (i + num_ghosts_0_h) +
-                        (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BB  = (i + num_ghosts_0_h) +
-                        (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_B   = (i + num_ghosts_0_h) +
-                        (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_T   = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TT  = (i + num_ghosts_0_h) +
-                        (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTT = (i + num_ghosts_0_h) +
-                        (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_y[idx_face_y] += dt*quarter*(
-                        d_coef_a*((f[idx_f_B]   + f[idx_f_T]  )*(g[idx_g_B]   + g[idx_g_T]  )*(h[idx_h_B]   + h[idx_h_T]  )) +
-                        d_coef_b*((f[idx_f_BB]  + f[idx_f_T]  )*(g[idx_g_BB]  + g[idx_g_T]  )*(h[idx_h_BB]  + h[idx_h_T]  )  +
-                                  (f[idx_f_B]   + f[idx_f_TT] )*(g[idx_g_B]   + g[idx_g_TT] )*(h[idx_h_B]   + h[idx_h_TT] )) +
-                        d_coef_c*((f[idx_f_BBB] + f[idx_f_T]  )*(g[idx_g_BBB] + g[idx_g_T]  )*(h[idx_h_BBB] + h[idx_h_T]  )  +
-                                  (f[idx_f_BB]  + f[idx_f_TT] )*(g[idx_g_BB]  + g[idx_g_TT] )*(h[idx_h_BB]  + h[idx_h_TT] )  +
-                                  (f[idx_f_B]   + f[idx_f_TTT])*(g[idx_g_B]   + g[idx_g_TTT])*(h[idx_h_B]   + h[idx_h_TTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB   = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B    = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T    = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT   = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT  = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBBB = (i + num_ghosts_0_g) +
-                        (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBB  = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB   = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B    = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T    = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT   = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT  = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTT = (i + num_ghosts_0_g) +
-                        (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_BBBB = (i + num_ghosts_0_h) +
-                        (j - 4 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BBB  = (i + num_ghosts_0_h) +
-                        (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BB   = (i + num_ghosts_0_h) +
-                        (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_B    = (i + num_ghosts_0_h) +
-                        (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_T    = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TT   = (i + num_ghosts_0_h) +
-                        (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTT  = (i + num_ghosts_0_h) +
-                        (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTTT = (i + num_ghosts_0_h) +
-                        (j + 3 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_y[idx_face_y] += dt*quarter*(
-                        d_coef_a*((f[idx_f_B]    + f[idx_f_T]   )*(g[idx_g_B]    + g[idx_g_T]   )*(h[idx_h_B]    + h[idx_h_T]   )) +
-                        d_coef_b*((f[idx_f_BB]   + f[idx_f_T]   )*(g[idx_g_BB]   + g[idx_g_T]   )*(h[idx_h_BB]   + h[idx_h_T]   )  +
-                                  (f[idx_f_B]    + f[idx_f_TT]  )*(g[idx_g_B]    + g[idx_g_TT]  )*(h[idx_h_B]    + h[idx_h_TT]  )) +
-                        d_coef_c*((f[idx_f_BBB]  + f[idx_f_T]   )*(g[idx_g_BBB]  + g[idx_g_T]   )*(h[idx_h_BBB]  + h[idx_h_T]   )  +
-                                  (f[idx_f_BB]   + f[idx_f_TT]  )*(g[idx_g_BB]   + g[idx_g_TT]  )*(h[idx_h_BB]   + h[idx_h_TT]  )  +
-                                  (f[idx_f_B]    + f[idx_f_TTT] )*(g[idx_g_B]    + g[idx_g_TTT] )*(h[idx_h_B]    + h[idx_h_TTT] )) +
-                        d_coef_d*((f[idx_f_BBBB] + f[idx_f_T]   )*(g[idx_g_BBBB] + g[idx_g_T]   )*(h[idx_h_BBBB] + h[idx_h_T]   )  +
-                                  (f[idx_f_BBB]  + f[idx_f_TT]  )*(g[idx_g_BBB]  + g[idx_g_TT]  )*(h[idx_h_BBB]  + h[idx_h_TT]  )  +
-                                  (f[idx_f_BB]   + f[idx_f_TTT] )*(g[idx_g_BB]   + g[idx_g_TTT] )*(h[idx_h_BB]   + h[idx_h_TTT] )  +
-                                  (f[idx_f_B]    + f[idx_f_TTTT])*(g[idx_g_B]    + g[idx_g_TTTT])*(h[idx_h_B]    + h[idx_h_TTTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                        (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB    = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B     = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T     = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT    = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT   = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT  = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTT = (i + num_ghosts_0_f) +
-                        (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBBBB = (i + num_ghosts_0_g) +
-                        (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBBB  = (i + num_ghosts_0_g) +
-                        (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBB   = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB    = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B     = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T     = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT    = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT   = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTT  = (i + num_ghosts_0_g) +
-                        (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTTT = (i + num_ghosts_0_g) +
-                        (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_BBBBB = (i + num_ghosts_0_h) +
-                        (j - 5 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BBBB  = (i + num_ghosts_0_h) +
-                        (j - 4 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BBB   = (i + num_ghosts_0_h) +
-                        (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BB    = (i + num_ghosts_0_h) +
-                        (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_B     = (i + num_ghosts_0_h) +
-                        (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_T     = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TT    = (i + num_ghosts_0_h) +
-                        (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTT   = (i + num_ghosts_0_h) +
-                        (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTTT  = (i + num_ghosts_0_h) +
-                        (j + 3 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTTTT = (i + num_ghosts_0_h) +
-                        (j + 4 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_y[idx_face_y] += dt*quarter*(
-                        d_coef_a*((f[idx_f_B]     + f[idx_f_T]    )*(g[idx_g_B]     + g[idx_g_T]    )*(h[idx_h_B]     + h[idx_h_T]    )) +
-                        d_coef_b*((f[idx_f_BB]    + f[idx_f_T]    )*(g[idx_g_BB]    + g[idx_g_T]    )*(h[idx_h_BB]    + h[idx_h_T]    )  +
-                                  (f[idx_f_B]     + f[idx_f_TT]   )*(g[idx_g_B]     + g[idx_g_TT]   )*(h[idx_h_B]     + h[idx_h_TT]   )) +
-                        d_coef_c*((f[idx_f_BBB]   + f[idx_f_T]    )*(g[idx_g_BBB]   + g[idx_g_T]    )*(h[idx_h_BBB]   + h[idx_h_T]    )  +
-                                  (f[idx_f_BB]    + f[idx_f_TT]   )*(g[idx_g_BB]    + g[idx_g_TT]   )*(h[idx_h_BB]    + h[idx_h_TT]   )  +
-                                  (f[idx_f_B]     + f[idx_f_TTT]  )*(g[idx_g_B]     + g[idx_g_TTT]  )*(h[idx_h_B]     + h[idx_h_TTT]  )) +
-                        d_coef_d*((f[idx_f_BBBB]  + f[idx_f_T]    )*(g[idx_g_BBBB]  + g[idx_g_T]    )*(h[idx_h_BBBB]  + h[idx_h_T]    )  +
-                                  (f[idx_f_BBB]   + f[idx_f_TT]   )*(g[idx_g_BBB]   + g[idx_g_TT]   )*(h[idx_h_BBB]   + h[idx_h_TT]   )  +
-                                  (f[idx_f_BB]    + f[idx_f_TTT]  )*(g[idx_g_BB]    + g[idx_g_TTT]  )*(h[idx_h_BB]    + h[idx_h_TTT]  )  +
-                                  (f[idx_f_B]     + f[idx_f_TTTT] )*(g[idx_g_B]     + g[idx_g_TTTT] )*(h[idx_h_B]     + h[idx_h_TTTT] )) +
-                        d_coef_e*((f[idx_f_BBBBB] + f[idx_f_T]    )*(g[idx_g_BBBBB] + g[idx_g_T]    )*(h[idx_h_BBBBB] + h[idx_h_T]    )  +
-                                  (f[idx_f_BBBB]  + f[idx_f_TT]   )*(g[idx_g_BBBB]  + g[idx_g_TT]   )*(h[idx_h_BBBB]  + h[idx_h_TT]   )  +
-                                  (f[idx_f_BBB]   + f[idx_f_TTT]  )*(g[idx_g_BBB]   + g[idx_g_TTT]  )*(h[idx_h_BBB]   + h[idx_h_TTT]  )  +
-                                  (f[idx_f_BB]    + f[idx_f_TTTT] )*(g[idx_g_BB]    + g[idx_g_TTTT] )*(h[idx_h_BB]    + h[idx_h_TTTT] )  +
-                                  (f[idx_f_B]     + f[idx_f_TTTTT])*(g[idx_g_B]     + g[idx_g_TTTTT])*(h[idx_h_B]     + h[idx_h_TTTTT])));
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int j = 0; j < interior_dim_1 + 1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = 0; i < interior_dim_0; i++)
-                {
-                    const int idx_face_y = i +
-                        j*interior_dim_0;
-                    
-                    const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                        (j - 6 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                        (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                        (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                        (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_BB     = (i + num_ghosts_0_f) +
-                        (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_B      = (i + num_ghosts_0_f) +
-                        (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_T      = (i + num_ghosts_0_f) +
-                        (j + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TT     = (i + num_ghosts_0_f) +
-                        (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTT    = (i + num_ghosts_0_f) +
-                        (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTT   = (i + num_ghosts_0_f) +
-                        (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTT  = (i + num_ghosts_0_f) +
-                        (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_f_TTTTTT = (i + num_ghosts_0_f) +
-                        (j + 5 + num_ghosts_1_f)*ghostcell_dim_0_f;
-                    
-                    const int idx_g_BBBBBB = (i + num_ghosts_0_g) +
-                        (j - 6 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBBBB  = (i + num_ghosts_0_g) +
-                        (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBBB   = (i + num_ghosts_0_g) +
-                        (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BBB    = (i + num_ghosts_0_g) +
-                        (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_BB     = (i + num_ghosts_0_g) +
-                        (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_B      = (i + num_ghosts_0_g) +
-                        (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_T      = (i + num_ghosts_0_g) +
-                        (j + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TT     = (i + num_ghosts_0_g) +
-                        (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTT    = (i + num_ghosts_0_g) +
-                        (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTT   = (i + num_ghosts_0_g) +
-                        (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTTT  = (i + num_ghosts_0_g) +
-                        (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_g_TTTTTT = (i + num_ghosts_0_g) +
-                        (j + 5 + num_ghosts_1_g)*ghostcell_dim_0_g;
-                    
-                    const int idx_h_BBBBBB = (i + num_ghosts_0_h) +
-                        (j - 6 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BBBBB  = (i + num_ghosts_0_h) +
-                        (j - 5 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BBBB   = (i + num_ghosts_0_h) +
-                        (j - 4 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BBB    = (i + num_ghosts_0_h) +
-                        (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_BB     = (i + num_ghosts_0_h) +
-                        (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_B      = (i + num_ghosts_0_h) +
-                        (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_T      = (i + num_ghosts_0_h) +
-                        (j + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TT     = (i + num_ghosts_0_h) +
-                        (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTT    = (i + num_ghosts_0_h) +
-                        (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTTT   = (i + num_ghosts_0_h) +
-                        (j + 3 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTTTT  = (i + num_ghosts_0_h) +
-                        (j + 4 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    const int idx_h_TTTTTT = (i + num_ghosts_0_h) +
-                        (j + 5 + num_ghosts_1_h)*ghostcell_dim_0_h;
-                    
-                    F_face_y[idx_face_y] += dt*quarter*(
-                        d_coef_a*((f[idx_f_B]      + f[idx_f_T]     )*(g[idx_g_B]      + g[idx_g_T]     )*(h[idx_h_B]      + h[idx_h_T]     )) +
-                        d_coef_b*((f[idx_f_BB]     + f[idx_f_T]     )*(g[idx_g_BB]     + g[idx_g_T]     )*(h[idx_h_BB]     + h[idx_h_T]     )  +
-                                  (f[idx_f_B]      + f[idx_f_TT]    )*(g[idx_g_B]      + g[idx_g_TT]    )*(h[idx_h_B]      + h[idx_h_TT]    )) +
-                        d_coef_c*((f[idx_f_BBB]    + f[idx_f_T]     )*(g[idx_g_BBB]    + g[idx_g_T]     )*(h[idx_h_BBB]    + h[idx_h_T]     )  +
-                                  (f[idx_f_BB]     + f[idx_f_TT]    )*(g[idx_g_BB]     + g[idx_g_TT]    )*(h[idx_h_BB]     + h[idx_h_TT]    )  +
-                                  (f[idx_f_B]      + f[idx_f_TTT]   )*(g[idx_g_B]      + g[idx_g_TTT]   )*(h[idx_h_B]      + h[idx_h_TTT]   )) +
-                        d_coef_d*((f[idx_f_BBBB]   + f[idx_f_T]     )*(g[idx_g_BBBB]   + g[idx_g_T]     )*(h[idx_h_BBBB]   + h[idx_h_T]     )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TT]    )*(g[idx_g_BBB]    + g[idx_g_TT]    )*(h[idx_h_BBB]    + h[idx_h_TT]    )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTT]   )*(g[idx_g_BB]     + g[idx_g_TTT]   )*(h[idx_h_BB]     + h[idx_h_TTT]   )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTT]  )*(g[idx_g_B]      + g[idx_g_TTTT]  )*(h[idx_h_B]      + h[idx_h_TTTT]  )) +
-                        d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_T]     )*(g[idx_g_BBBBB]  + g[idx_g_T]     )*(h[idx_h_BBBBB]  + h[idx_h_T]     )  +
-                                  (f[idx_f_BBBB]   + f[idx_f_TT]    )*(g[idx_g_BBBB]   + g[idx_g_TT]    )*(h[idx_h_BBBB]   + h[idx_h_TT]    )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TTT]   )*(g[idx_g_BBB]    + g[idx_g_TTT]   )*(h[idx_h_BBB]    + h[idx_h_TTT]   )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTTT]  )*(g[idx_g_BB]     + g[idx_g_TTTT]  )*(h[idx_h_BB]     + h[idx_h_TTTT]  )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTTT] )*(g[idx_g_B]      + g[idx_g_TTTTT] )*(h[idx_h_B]      + h[idx_h_TTTTT] )) +
-                        d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_T]     )*(g[idx_g_BBBBBB] + g[idx_g_T]     )*(h[idx_h_BBBBBB] + h[idx_h_T]     )  +
-                                  (f[idx_f_BBBBB]  + f[idx_f_TT]    )*(g[idx_g_BBBBB]  + g[idx_g_TT]    )*(h[idx_h_BBBBB]  + h[idx_h_TT]    )  +
-                                  (f[idx_f_BBBB]   + f[idx_f_TTT]   )*(g[idx_g_BBBB]   + g[idx_g_TTT]   )*(h[idx_h_BBBB]   + h[idx_h_TTT]   )  +
-                                  (f[idx_f_BBB]    + f[idx_f_TTTT]  )*(g[idx_g_BBB]    + g[idx_g_TTTT]  )*(h[idx_h_BBB]    + h[idx_h_TTTT]  )  +
-                                  (f[idx_f_BB]     + f[idx_f_TTTTT] )*(g[idx_g_BB]     + g[idx_g_TTTTT] )*(h[idx_h_BB]     + h[idx_h_TTTTT] )  +
-                                  (f[idx_f_B]      + f[idx_f_TTTTTT])*(g[idx_g_B]      + g[idx_g_TTTTTT])*(h[idx_h_B]      + h[idx_h_TTTTTT])));
-                }
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int num_ghosts_2_g = num_ghosts_g[2];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        const int ghostcell_dim_1_g = ghostcell_dims_g[1];
-        
-        const int num_ghosts_0_h = num_ghosts_h[0];
-        const int num_ghosts_1_h = num_ghosts_h[1];
-        const int num_ghosts_2_h = num_ghosts_h[2];
-        const int ghostcell_dim_0_h = ghostcell_dims_h[0];
-        const int ghostcell_dim_1_h = ghostcell_dims_h[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_B = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_B = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_B = (i + num_ghosts_0_h) +
-                            (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_T = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_y[idx_face_y] += dt*quarter*(
-                            d_coef_a*(f[idx_f_B] + f[idx_f_T])*(g[idx_g_B] + g[idx_g_T])*(h[idx_h_B] + h[idx_h_T]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BB = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B  = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BB = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B  = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BB = (i + num_ghosts_0_h) +
-                            (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B  = (i + num_ghosts_0_h) +
-                            (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_T  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TT = (i + num_ghosts_0_h) +
-                            (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_y[idx_face_y] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]  + f[idx_f_T] )*(g[idx_g_B]  + g[idx_g_T] )*(h[idx_h_B]  + h[idx_h_T] )) +
-                            d_coef_b*((f[idx_f_BB] + f[idx_f_T] )*(g[idx_g_BB] + g[idx_g_T] )*(h[idx_h_BB] + h[idx_h_T] )  +
-                                      (f[idx_f_B]  + f[idx_f_TT])*(g[idx_g_B]  + g[idx_g_TT])*(h[idx_h_B]  + h[idx_h_TT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBB = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB  = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B   = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT  = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBB = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB  = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B   = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT  = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBB = (i + num_ghosts_0_h) +
-                            (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB  = (i + num_ghosts_0_h) +
-                            (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B   = (i + num_ghosts_0_h) +
-                            (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_T   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TT  = (i + num_ghosts_0_h) +
-                            (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTT = (i + num_ghosts_0_h) +
-                            (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_y[idx_face_y] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]   + f[idx_f_T]  )*(g[idx_g_B]   + g[idx_g_T]  )*(h[idx_h_B]   + h[idx_h_T]  )) +
-                            d_coef_b*((f[idx_f_BB]  + f[idx_f_T]  )*(g[idx_g_BB]  + g[idx_g_T]  )*(h[idx_h_BB]  + h[idx_h_T]  )  +
-                                      (f[idx_f_B]   + f[idx_f_TT] )*(g[idx_g_B]   + g[idx_g_TT] )*(h[idx_h_B]   + h[idx_h_TT] )) +
-                            d_coef_c*((f[idx_f_BBB] + f[idx_f_T]  )*(g[idx_g_BBB] + g[idx_g_T]  )*(h[idx_h_BBB] + h[idx_h_T]  )  +
-                                      (f[idx_f_BB]  + f[idx_f_TT] )*(g[idx_g_BB]  + g[idx_g_TT] )*(h[idx_h_BB]  + h[idx_h_TT] )  +
-                                      (f[idx_f_B]   + f[idx_f_TTT])*(g[idx_g_B]   + g[idx_g_TTT])*(h[idx_h_B]   + h[idx_h_TTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB   = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B    = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT   = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT  = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBB = (i + num_ghosts_0_g) +
-                            (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB  = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB   = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B    = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT   = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT  = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTT = (i + num_ghosts_0_g) +
-                            (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBBB = (i + num_ghosts_0_h) +
-                            (j - 4 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBB  = (i + num_ghosts_0_h) +
-                            (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB   = (i + num_ghosts_0_h) +
-                            (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B    = (i + num_ghosts_0_h) +
-                            (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_T    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TT   = (i + num_ghosts_0_h) +
-                            (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTT  = (i + num_ghosts_0_h) +
-                            (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTTT = (i + num_ghosts_0_h) +
-                            (j + 3 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_y[idx_face_y] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]    + f[idx_f_T]   )*(g[idx_g_B]    + g[idx_g_T]   )*(h[idx_h_B]    + h[idx_h_T]   )) +
-                            d_coef_b*((f[idx_f_BB]   + f[idx_f_T]   )*(g[idx_g_BB]   + g[idx_g_T]   )*(h[idx_h_BB]   + h[idx_h_T]   )  +
-                                      (f[idx_f_B]    + f[idx_f_TT]  )*(g[idx_g_B]    + g[idx_g_TT]  )*(h[idx_h_B]    + h[idx_h_TT]  )) +
-                            d_coef_c*((f[idx_f_BBB]  + f[idx_f_T]   )*(g[idx_g_BBB]  + g[idx_g_T]   )*(h[idx_h_BBB]  + h[idx_h_T]   )  +
-                                      (f[idx_f_BB]   + f[idx_f_TT]  )*(g[idx_g_BB]   + g[idx_g_TT]  )*(h[idx_h_BB]   + h[idx_h_TT]  )  +
-                                      (f[idx_f_B]    + f[idx_f_TTT] )*(g[idx_g_B]    + g[idx_g_TTT] )*(h[idx_h_B]    + h[idx_h_TTT] )) +
-                            d_coef_d*((f[idx_f_BBBB] + f[idx_f_T]   )*(g[idx_g_BBBB] + g[idx_g_T]   )*(h[idx_h_BBBB] + h[idx_h_T]   )  +
-                                      (f[idx_f_BBB]  + f[idx_f_TT]  )*(g[idx_g_BBB]  + g[idx_g_TT]  )*(h[idx_h_BBB]  + h[idx_h_TT]  )  +
-                                      (f[idx_f_BB]   + f[idx_f_TTT] )*(g[idx_g_BB]   + g[idx_g_TTT] )*(h[idx_h_BB]   + h[idx_h_TTT] )  +
-                                      (f[idx_f_B]    + f[idx_f_TTTT])*(g[idx_g_B]    + g[idx_g_TTTT])*(h[idx_h_B]    + h[idx_h_TTTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                            (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB    = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B     = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT    = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT   = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT  = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTT = (i + num_ghosts_0_f) +
-                            (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBB = (i + num_ghosts_0_g) +
-                            (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB  = (i + num_ghosts_0_g) +
-                            (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB   = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB    = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B     = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT    = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT   = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTT  = (i + num_ghosts_0_g) +
-                            (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTTT = (i + num_ghosts_0_g) +
-                            (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBBBB = (i + num_ghosts_0_h) +
-                            (j - 5 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBBB  = (i + num_ghosts_0_h) +
-                            (j - 4 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBB   = (i + num_ghosts_0_h) +
-                            (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB    = (i + num_ghosts_0_h) +
-                            (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B     = (i + num_ghosts_0_h) +
-                            (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_T     = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TT    = (i + num_ghosts_0_h) +
-                            (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTT   = (i + num_ghosts_0_h) +
-                            (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTTT  = (i + num_ghosts_0_h) +
-                            (j + 3 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTTTT = (i + num_ghosts_0_h) +
-                            (j + 4 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_y[idx_face_y] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]     + f[idx_f_T]    )*(g[idx_g_B]     + g[idx_g_T]    )*(h[idx_h_B]     + h[idx_h_T]    )) +
-                            d_coef_b*((f[idx_f_BB]    + f[idx_f_T]    )*(g[idx_g_BB]    + g[idx_g_T]    )*(h[idx_h_BB]    + h[idx_h_T]    )  +
-                                      (f[idx_f_B]     + f[idx_f_TT]   )*(g[idx_g_B]     + g[idx_g_TT]   )*(h[idx_h_B]     + h[idx_h_TT]   )) +
-                            d_coef_c*((f[idx_f_BBB]   + f[idx_f_T]    )*(g[idx_g_BBB]   + g[idx_g_T]    )*(h[idx_h_BBB]   + h[idx_h_T]    )  +
-                                      (f[idx_f_BB]    + f[idx_f_TT]   )*(g[idx_g_BB]    + g[idx_g_TT]   )*(h[idx_h_BB]    + h[idx_h_TT]   )  +
-                                      (f[idx_f_B]     + f[idx_f_TTT]  )*(g[idx_g_B]     + g[idx_g_TTT]  )*(h[idx_h_B]     + h[idx_h_TTT]  )) +
-                            d_coef_d*((f[idx_f_BBBB]  + f[idx_f_T]    )*(g[idx_g_BBBB]  + g[idx_g_T]    )*(h[idx_h_BBBB]  + h[idx_h_T]    )  +
-                                      (f[idx_f_BBB]   + f[idx_f_TT]   )*(g[idx_g_BBB]   + g[idx_g_TT]   )*(h[idx_h_BBB]   + h[idx_h_TT]   )  +
-                                      (f[idx_f_BB]    + f[idx_f_TTT]  )*(g[idx_g_BB]    + g[idx_g_TTT]  )*(h[idx_h_BB]    + h[idx_h_TTT]  )  +
-                                      (f[idx_f_B]     + f[idx_f_TTTT] )*(g[idx_g_B]     + g[idx_g_TTTT] )*(h[idx_h_B]     + h[idx_h_TTTT] )) +
-                            d_coef_e*((f[idx_f_BBBBB] + f[idx_f_T]    )*(g[idx_g_BBBBB] + g[idx_g_T]    )*(h[idx_h_BBBBB] + h[idx_h_T]    )  +
-                                      (f[idx_f_BBBB]  + f[idx_f_TT]   )*(g[idx_g_BBBB]  + g[idx_g_TT]   )*(h[idx_h_BBBB]  + h[idx_h_TT]   )  +
-                                      (f[idx_f_BBB]   + f[idx_f_TTT]  )*(g[idx_g_BBB]   + g[idx_g_TTT]  )*(h[idx_h_BBB]   + h[idx_h_TTT]  )  +
-                                      (f[idx_f_BB]    + f[idx_f_TTTT] )*(g[idx_g_BB]    + g[idx_g_TTTT] )*(h[idx_h_BB]    + h[idx_h_TTTT] )  +
-                                      (f[idx_f_B]     + f[idx_f_TTTTT])*(g[idx_g_B]     + g[idx_g_TTTTT])*(h[idx_h_B]     + h[idx_h_TTTTT])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2; k++)
-            {
-                for (int j = 0; j < interior_dim_1 + 1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_y = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*(interior_dim_1 + 1);
-                        
-                        const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                            (j - 6 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                            (j - 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                            (j - 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                            (j - 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB     = (i + num_ghosts_0_f) +
-                            (j - 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B      = (i + num_ghosts_0_f) +
-                            (j - 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_T      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TT     = (i + num_ghosts_0_f) +
-                            (j + 1 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTT    = (i + num_ghosts_0_f) +
-                            (j + 2 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTT   = (i + num_ghosts_0_f) +
-                            (j + 3 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTT  = (i + num_ghosts_0_f) +
-                            (j + 4 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_TTTTTT = (i + num_ghosts_0_f) +
-                            (j + 5 + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBBB = (i + num_ghosts_0_g) +
-                            (j - 6 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBBB  = (i + num_ghosts_0_g) +
-                            (j - 5 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB   = (i + num_ghosts_0_g) +
-                            (j - 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB    = (i + num_ghosts_0_g) +
-                            (j - 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB     = (i + num_ghosts_0_g) +
-                            (j - 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B      = (i + num_ghosts_0_g) +
-                            (j - 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_T      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TT     = (i + num_ghosts_0_g) +
-                            (j + 1 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTT    = (i + num_ghosts_0_g) +
-                            (j + 2 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTT   = (i + num_ghosts_0_g) +
-                            (j + 3 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTTT  = (i + num_ghosts_0_g) +
-                            (j + 4 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_TTTTTT = (i + num_ghosts_0_g) +
-                            (j + 5 + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBBBBB = (i + num_ghosts_0_h) +
-                            (j - 6 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBBBB  = (i + num_ghosts_0_h) +
-                            (j - 5 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBBB   = (i + num_ghosts_0_h) +
-                            (j - 4 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBB    = (i + num_ghosts_0_h) +
-                            (j - 3 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB     = (i + num_ghosts_0_h) +
-                            (j - 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B      = (i + num_ghosts_0_h) +
-                            (j - 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_T      = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TT     = (i + num_ghosts_0_h) +
-                            (j + 1 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTT    = (i + num_ghosts_0_h) +
-                            (j + 2 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTTT   = (i + num_ghosts_0_h) +
-                            (j + 3 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTTTT  = (i + num_ghosts_0_h) +
-                            (j + 4 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_TTTTTT = (i + num_ghosts_0_h) +
-                            (j + 5 + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_y[idx_face_y] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]      + f[idx_f_T]     )*(g[idx_g_B]      + g[idx_g_T]     )*(h[idx_h_B]      + h[idx_h_T]     )) +
-                            d_coef_b*((f[idx_f_BB]     + f[idx_f_T]     )*(g[idx_g_BB]     + g[idx_g_T]     )*(h[idx_h_BB]     + h[idx_h_T]     )  +
-                                      (f[idx_f_B]      + f[idx_f_TT]    )*(g[idx_g_B]      + g[idx_g_TT]    )*(h[idx_h_B]      + h[idx_h_TT]    )) +
-                            d_coef_c*((f[idx_f_BBB]    + f[idx_f_T]     )*(g[idx_g_BBB]    + g[idx_g_T]     )*(h[idx_h_BBB]    + h[idx_h_T]     )  +
-                                      (f[idx_f_BB]     + f[idx_f_TT]    )*(g[idx_g_BB]     + g[idx_g_TT]    )*(h[idx_h_BB]     + h[idx_h_TT]    )  +
-                                      (f[idx_f_B]      + f[idx_f_TTT]   )*(g[idx_g_B]      + g[idx_g_TTT]   )*(h[idx_h_B]      + h[idx_h_TTT]   )) +
-                            d_coef_d*((f[idx_f_BBBB]   + f[idx_f_T]     )*(g[idx_g_BBBB]   + g[idx_g_T]     )*(h[idx_h_BBBB]   + h[idx_h_T]     )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TT]    )*(g[idx_g_BBB]    + g[idx_g_TT]    )*(h[idx_h_BBB]    + h[idx_h_TT]    )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTT]   )*(g[idx_g_BB]     + g[idx_g_TTT]   )*(h[idx_h_BB]     + h[idx_h_TTT]   )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTT]  )*(g[idx_g_B]      + g[idx_g_TTTT]  )*(h[idx_h_B]      + h[idx_h_TTTT]  )) +
-                            d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_T]     )*(g[idx_g_BBBBB]  + g[idx_g_T]     )*(h[idx_h_BBBBB]  + h[idx_h_T]     )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_TT]    )*(g[idx_g_BBBB]   + g[idx_g_TT]    )*(h[idx_h_BBBB]   + h[idx_h_TT]    )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TTT]   )*(g[idx_g_BBB]    + g[idx_g_TTT]   )*(h[idx_h_BBB]    + h[idx_h_TTT]   )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTTT]  )*(g[idx_g_BB]     + g[idx_g_TTTT]  )*(h[idx_h_BB]     + h[idx_h_TTTT]  )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTTT] )*(g[idx_g_B]      + g[idx_g_TTTTT] )*(h[idx_h_B]      + h[idx_h_TTTTT] )) +
-                            d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_T]     )*(g[idx_g_BBBBBB] + g[idx_g_T]     )*(h[idx_h_BBBBBB] + h[idx_h_T]     )  +
-                                      (f[idx_f_BBBBB]  + f[idx_f_TT]    )*(g[idx_g_BBBBB]  + g[idx_g_TT]    )*(h[idx_h_BBBBB]  + h[idx_h_TT]    )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_TTT]   )*(g[idx_g_BBBB]   + g[idx_g_TTT]   )*(h[idx_h_BBBB]   + h[idx_h_TTT]   )  +
-                                      (f[idx_f_BBB]    + f[idx_f_TTTT]  )*(g[idx_g_BBB]    + g[idx_g_TTTT]  )*(h[idx_h_BBB]    + h[idx_h_TTTT]  )  +
-                                      (f[idx_f_BB]     + f[idx_f_TTTTT] )*(g[idx_g_BB]     + g[idx_g_TTTTT] )*(h[idx_h_BB]     + h[idx_h_TTTTT] )  +
-                                      (f[idx_f_B]      + f[idx_f_TTTTTT])*(g[idx_g_B]      + g[idx_g_TTTTTT])*(h[idx_h_B]      + h[idx_h_TTTTTT])));
-                    }
-                }
-            }
-        }
-    }
+    
+    (this->*d_add_linear_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        component_idx_flux,
+        component_idx_f,
+        dt,
+        DIRECTION::Z_DIRECTION);
 }
 
 
 /*
- * Add linear term to convective flux in z-direction.
+ * Add quadratic term to convective flux in z-direction.
  */
 void
-ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxZ(
+ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxZ(
     HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
     const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
     const int component_idx_flux,
     const int component_idx_f,
+    const int component_idx_g,
     const double dt) const
 {
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
     if (d_dim == tbox::Dimension(1))
     {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxZ:"
-            " Cannot compute linear term in z-direction for one-dimensional problem!");
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxZ:"
+            " Cannot compute quadratic term in z-direction for one-dimensional problem!");
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFluxZ:"
-            " Cannot compute linear term in z-direction for two-dimensional problem!");
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxZ:"
+            " Cannot compute quadratic term in z-direction for two-dimensional problem!");
     }
 #endif
     
-    const hier::Box interior_box = data_convective_flux->getBox();
-    const hier::IntVector interior_dims = interior_box.numberCells();
-    
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-#endif
-    
-    // Get the dimensions of the ghost cell box.
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    /*
-     * Get the pointers to the data.
-     */
-    
-    double* F_face_z = data_convective_flux->getPointer(2, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    
-    if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell box.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_B = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_z[idx_face_z] += dt*(
-                            d_coef_a*(f[idx_f_B] + f[idx_f_F]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_z[idx_face_z] += dt*(
-                            d_coef_a*((f[idx_f_B]  + f[idx_f_F] )) +
-                            d_coef_b*((f[idx_f_BB] + f[idx_f_F] )  +
-                                      (f[idx_f_B]  + f[idx_f_FF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_z[idx_face_z] += dt*(
-                            d_coef_a*((f[idx_f_B]   + f[idx_f_F]  )) +
-                            d_coef_b*((f[idx_f_BB]  + f[idx_f_F]  )  +
-                                      (f[idx_f_B]   + f[idx_f_FF] )) +
-                            d_coef_c*((f[idx_f_BBB] + f[idx_f_F]  )  +
-                                      (f[idx_f_BB]  + f[idx_f_FF] )  +
-                                      (f[idx_f_B]   + f[idx_f_FFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_z[idx_face_z] += dt*(
-                            d_coef_a*((f[idx_f_B]    + f[idx_f_F]   )) +
-                            d_coef_b*((f[idx_f_BB]   + f[idx_f_F]   )  +
-                                      (f[idx_f_B]    + f[idx_f_FF]  )) +
-                            d_coef_c*((f[idx_f_BBB]  + f[idx_f_F]   )  +
-                                      (f[idx_f_BB]   + f[idx_f_FF]  )  +
-                                      (f[idx_f_B]    + f[idx_f_FFF] )) +
-                            d_coef_d*((f[idx_f_BBBB] + f[idx_f_F]   )  +
-                                      (f[idx_f_BBB]  + f[idx_f_FF]  )  +
-                                      (f[idx_f_BB]   + f[idx_f_FFF] )  +
-                                      (f[idx_f_B]    + f[idx_f_FFFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_z[idx_face_z] += dt*(
-                            d_coef_a*((f[idx_f_B]     + f[idx_f_F]    )) +
-                            d_coef_b*((f[idx_f_BB]    + f[idx_f_F]    )  +
-                                      (f[idx_f_B]     + f[idx_f_FF]   )) +
-                            d_coef_c*((f[idx_f_BBB]   + f[idx_f_F]    )  +
-                                      (f[idx_f_BB]    + f[idx_f_FF]   )  +
-                                      (f[idx_f_B]     + f[idx_f_FFF]  )) +
-                            d_coef_d*((f[idx_f_BBBB]  + f[idx_f_F]    )  +
-                                      (f[idx_f_BBB]   + f[idx_f_FF]   )  +
-                                      (f[idx_f_BB]    + f[idx_f_FFF]  )  +
-                                      (f[idx_f_B]     + f[idx_f_FFFF] )) +
-                            d_coef_e*((f[idx_f_BBBBB] + f[idx_f_F]    )  +
-                                      (f[idx_f_BBBB]  + f[idx_f_FF]   )  +
-                                      (f[idx_f_BBB]   + f[idx_f_FFF]  )  +
-                                      (f[idx_f_BB]    + f[idx_f_FFFF] )  +
-                                      (f[idx_f_B]     + f[idx_f_FFFFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 6 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        F_face_z[idx_face_z] += dt*(
-                            d_coef_a*((f[idx_f_B]      + f[idx_f_F]     )) +
-                            d_coef_b*((f[idx_f_BB]     + f[idx_f_F]     )  +
-                                      (f[idx_f_B]      + f[idx_f_FF]    )) +
-                            d_coef_c*((f[idx_f_BBB]    + f[idx_f_F]     )  +
-                                      (f[idx_f_BB]     + f[idx_f_FF]    )  +
-                                      (f[idx_f_B]      + f[idx_f_FFF]   )) +
-                            d_coef_d*((f[idx_f_BBBB]   + f[idx_f_F]     )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FF]    )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFF]   )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFF]  )) +
-                            d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_F]     )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_FF]    )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FFF]   )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFFF]  )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFFF] )) +
-                            d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_F]     )  +
-                                      (f[idx_f_BBBBB]  + f[idx_f_FF]    )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_FFF]   )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FFFF]  )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFFFF] )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFFFF])));
-                    }
-                }
-            }
-        }
-    }
+    (this->*d_add_quadratic_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        data_g,
+        component_idx_flux,
+        component_idx_f,
+        component_idx_g,
+        dt,
+        DIRECTION::Z_DIRECTION);
 }
 
 
 /*
- * Add quadratic term to convective flux in z-direction.
+ * Add cubic term to convective flux in z-direction.
  */
 void
-ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxZ(
+ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxZ(
     HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
     const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
     const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_h,
     const int component_idx_flux,
     const int component_idx_f,
     const int component_idx_g,
+    const int component_idx_h,
     const double dt) const
 {
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
     if (d_dim == tbox::Dimension(1))
     {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxZ:"
-            " Cannot compute quadratic term in z-direction for one-dimensional problem!");
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxZ:"
+            " Cannot compute cubic term in z-direction for one-dimensional problem!");
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxZ:"
-            " Cannot compute quadratic term in z-direction for two-dimensional problem!");
+        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxZ:"
+            " Cannot compute cubic term in z-direction for two-dimensional problem!");
     }
 #endif
     
+    (this->*d_add_cubic_term_to_convective_flux)(
+        data_convective_flux,
+        data_f,
+        data_g,
+        data_h,
+        component_idx_flux,
+        component_idx_f,
+        component_idx_g,
+        component_idx_h,
+        dt,
+        DIRECTION::Z_DIRECTION);
+}
+
+
+/*
+ * Add linear term to convective flux in a direction. The number of dimensions DIM and the number of cells
+ * HALF_WIDTH on each side of a face in the stencil are fixed at compile time.
+ */
+template<int DIM, int HALF_WIDTH>
+void
+ConvectiveFluxReconstructorKEP::addLinearTermToConvectiveFlux(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const double dt,
+    const int direction) const
+{
     const hier::Box interior_box = data_convective_flux->getBox();
     const hier::IntVector interior_dims = interior_box.numberCells();
     
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
+    TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
 #endif
     
-    // Get the dimensions of the ghost cell boxes.
+    /*
+     * Get the pointers to the data.
+     */
     
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
+    double* F_face = data_convective_flux->getPointer(direction, component_idx_flux);
+    double* f      = data_f->getPointer(component_idx_f);
     
-    const hier::Box ghost_box_g = data_g->getGhostBox();
-    const hier::IntVector ghostcell_dims_g = ghost_box_g.numberCells();
-    const hier::IntVector num_ghosts_g = data_g->getGhostCellWidth();
+    // Copy the coefficients to local constants.
+    const double coef[6] = { d_coef_a, d_coef_b, d_coef_c, d_coef_d, d_coef_e, d_coef_f };
     
     /*
-     * Get the pointers to the data.
+     * Get the bounds of the loops over the faces, the linear index offsets and the strides of the data
+     * padded to three dimensions.
      */
     
-    double* F_face_z = data_convective_flux->getPointer(2, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    double* g        = data_g->getPointer(component_idx_g);
+    hier::IntVector face_dims(interior_dims);
+    face_dims[direction] += 1;
     
-    const double half = double(1)/double(2);
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, hier::IntVector::getZero(d_dim), face_dims);
     
-    if (d_dim == tbox::Dimension(3))
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_face;
+    int stride_face[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_face,
+        stride_face,
+        data_convective_flux->getGhostCellWidth(),
+        data_convective_flux->getGhostBox().numberCells(),
+        direction);
+    
+    int offset_f;
+    int stride_f[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_f,
+        stride_f,
+        data_f->getGhostCellWidth(),
+        data_f->getGhostBox().numberCells(),
+        -1);
+    
+    const int stride_1_face = stride_face[1];
+    const int stride_2_face = stride_face[2];
+    
+    const int stride_1_f = stride_f[1];
+    const int stride_2_f = stride_f[2];
+    
+    const int stride_direction_f = stride_f[direction];
+    
+    for (int k = 0; k < hi_2; k++)
     {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int num_ghosts_2_g = num_ghosts_g[2];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        const int ghostcell_dim_1_g = ghostcell_dims_g[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_B = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_B = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_z[idx_face_z] += dt*half*(
-                            d_coef_a*(f[idx_f_B] + f[idx_f_F])*(g[idx_g_B] + g[idx_g_F]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
+        for (int j = 0; j < hi_1; j++)
         {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
 #ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
+            #pragma omp simd
 #endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_z[idx_face_z] += dt*half*(
-                            d_coef_a*((f[idx_f_B]  + f[idx_f_F] )*(g[idx_g_B]  + g[idx_g_F] )) +
-                            d_coef_b*((f[idx_f_BB] + f[idx_f_F] )*(g[idx_g_BB] + g[idx_g_F] )  +
-                                      (f[idx_f_B]  + f[idx_f_FF])*(g[idx_g_B]  + g[idx_g_FF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
+            for (int i = 0; i < hi_0; i++)
             {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_z[idx_face_z] += dt*half*(
-                            d_coef_a*((f[idx_f_B]   + f[idx_f_F]  )*(g[idx_g_B]   + g[idx_g_F]  )) +
-                            d_coef_b*((f[idx_f_BB]  + f[idx_f_F]  )*(g[idx_g_BB]  + g[idx_g_F]  )  +
-                                      (f[idx_f_B]   + f[idx_f_FF] )*(g[idx_g_B]   + g[idx_g_FF] )) +
-                            d_coef_c*((f[idx_f_BBB] + f[idx_f_F]  )*(g[idx_g_BBB] + g[idx_g_F]  )  +
-                                      (f[idx_f_BB]  + f[idx_f_FF] )*(g[idx_g_BB]  + g[idx_g_FF] )  +
-                                      (f[idx_f_B]   + f[idx_f_FFF])*(g[idx_g_B]   + g[idx_g_FFF])));
-                    }
-                }
+                // Compute the linear indices.
+                const int idx_face = offset_face + i + j*stride_1_face + k*stride_2_face;
+                
+                const int idx_f_R = offset_f + i + j*stride_1_f + k*stride_2_f;
+                const int idx_f_L = idx_f_R - stride_direction_f;
+                
+                F_face[idx_face] += dt*(
+                    computeLinearTerm<HALF_WIDTH>(f, coef, idx_f_L, idx_f_R, stride_direction_f));
             }
         }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
+    }
+}
+
+
+/*
+ * Add quadratic term to convective flux in a direction. The number of dimensions DIM and the number of cells
+ * HALF_WIDTH on each side of a face in the stencil are fixed at compile time.
+ */
+template<int DIM, int HALF_WIDTH>
+void
+ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFlux(
+    HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
+    const int component_idx_flux,
+    const int component_idx_f,
+    const int component_idx_g,
+    const double dt,
+    const int direction) const
+{
+    const hier::Box interior_box = data_convective_flux->getBox();
+    const hier::IntVector interior_dims = interior_box.numberCells();
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
+    TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
 #endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_z[idx_face_z] += dt*half*(
-                            d_coef_a*((f[idx_f_B]    + f[idx_f_F]   )*(g[idx_g_B]    + g[idx_g_F]   )) +
-                            d_coef_b*((f[idx_f_BB]   + f[idx_f_F]   )*(g[idx_g_BB]   + g[idx_g_F]   )  +
-                                      (f[idx_f_B]    + f[idx_f_FF]  )*(g[idx_g_B]    + g[idx_g_FF]  )) +
-                            d_coef_c*((f[idx_f_BBB]  + f[idx_f_F]   )*(g[idx_g_BBB]  + g[idx_g_F]   )  +
-                                      (f[idx_f_BB]   + f[idx_f_FF]  )*(g[idx_g_BB]   + g[idx_g_FF]  )  +
-                                      (f[idx_f_B]    + f[idx_f_FFF] )*(g[idx_g_B]    + g[idx_g_FFF] )) +
-                            d_coef_d*((f[idx_f_BBBB] + f[idx_f_F]   )*(g[idx_g_BBBB] + g[idx_g_F]   )  +
-                                      (f[idx_f_BBB]  + f[idx_f_FF]  )*(g[idx_g_BBB]  + g[idx_g_FF]  )  +
-                                      (f[idx_f_BB]   + f[idx_f_FFF] )*(g[idx_g_BB]   + g[idx_g_FFF] )  +
-                                      (f[idx_f_B]    + f[idx_f_FFFF])*(g[idx_g_B]    + g[idx_g_FFFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
+    
+    /*
+     * Get the pointers to the data.
+     */
+    
+    double* F_face = data_convective_flux->getPointer(direction, component_idx_flux);
+    double* f      = data_f->getPointer(component_idx_f);
+    double* g      = data_g->getPointer(component_idx_g);
+    
+    const double half = double(1)/double(2);
+    
+    // Copy the coefficients to local constants.
+    const double coef[6] = { d_coef_a, d_coef_b, d_coef_c, d_coef_d, d_coef_e, d_coef_f };
+    
+    /*
+     * Get the bounds of the loops over the faces, the linear index offsets and the strides of the data
+     * padded to three dimensions.
+     */
+    
+    hier::IntVector face_dims(interior_dims);
+    face_dims[direction] += 1;
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, hier::IntVector::getZero(d_dim), face_dims);
+    
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_face;
+    int stride_face[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_face,
+        stride_face,
+        data_convective_flux->getGhostCellWidth(),
+        data_convective_flux->getGhostBox().numberCells(),
+        direction);
+    
+    int offset_f;
+    int stride_f[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_f,
+        stride_f,
+        data_f->getGhostCellWidth(),
+        data_f->getGhostBox().numberCells(),
+        -1);
+    
+    int offset_g;
+    int stride_g[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_g,
+        stride_g,
+        data_g->getGhostCellWidth(),
+        data_g->getGhostBox().numberCells(),
+        -1);
+    
+    const int stride_1_face = stride_face[1];
+    const int stride_2_face = stride_face[2];
+    
+    const int stride_1_f = stride_f[1];
+    const int stride_2_f = stride_f[2];
+    
+    const int stride_1_g = stride_g[1];
+    const int stride_2_g = stride_g[2];
+    
+    const int stride_direction_f = stride_f[direction];
+    const int stride_direction_g = stride_g[direction];
+    
+    for (int k = 0; k < hi_2; k++)
+    {
+        for (int j = 0; j < hi_1; j++)
         {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
 #ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
+            #pragma omp simd
 #endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 5 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_z[idx_face_z] += dt*half*(
-                            d_coef_a*((f[idx_f_B]     + f[idx_f_F]    )*(g[idx_g_B]     + g[idx_g_F]    )) +
-                            d_coef_b*((f[idx_f_BB]    + f[idx_f_F]    )*(g[idx_g_BB]    + g[idx_g_F]    )  +
-                                      (f[idx_f_B]     + f[idx_f_FF]   )*(g[idx_g_B]     + g[idx_g_FF]   )) +
-                            d_coef_c*((f[idx_f_BBB]   + f[idx_f_F]    )*(g[idx_g_BBB]   + g[idx_g_F]    )  +
-                                      (f[idx_f_BB]    + f[idx_f_FF]   )*(g[idx_g_BB]    + g[idx_g_FF]   )  +
-                                      (f[idx_f_B]     + f[idx_f_FFF]  )*(g[idx_g_B]     + g[idx_g_FFF]  )) +
-                            d_coef_d*((f[idx_f_BBBB]  + f[idx_f_F]    )*(g[idx_g_BBBB]  + g[idx_g_F]    )  +
-                                      (f[idx_f_BBB]   + f[idx_f_FF]   )*(g[idx_g_BBB]   + g[idx_g_FF]   )  +
-                                      (f[idx_f_BB]    + f[idx_f_FFF]  )*(g[idx_g_BB]    + g[idx_g_FFF]  )  +
-                                      (f[idx_f_B]     + f[idx_f_FFFF] )*(g[idx_g_B]     + g[idx_g_FFFF] )) +
-                            d_coef_e*((f[idx_f_BBBBB] + f[idx_f_F]    )*(g[idx_g_BBBBB] + g[idx_g_F]    )  +
-                                      (f[idx_f_BBBB]  + f[idx_f_FF]   )*(g[idx_g_BBBB]  + g[idx_g_FF]   )  +
-                                      (f[idx_f_BBB]   + f[idx_f_FFF]  )*(g[idx_g_BBB]   + g[idx_g_FFF]  )  +
-                                      (f[idx_f_BB]    + f[idx_f_FFFF] )*(g[idx_g_BB]    + g[idx_g_FFFF] )  +
-                                      (f[idx_f_B]     + f[idx_f_FFFFF])*(g[idx_g_B]     + g[idx_g_FFFFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
+            for (int i = 0; i < hi_0; i++)
             {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 6 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 6 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBBB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 5 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFF   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFFF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFFFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 5 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        F_face_z[idx_face_z] += dt*half*(
-                            d_coef_a*((f[idx_f_B]      + f[idx_f_F]     )*(g[idx_g_B]      + g[idx_g_F]     )) +
-                            d_coef_b*((f[idx_f_BB]     + f[idx_f_F]     )*(g[idx_g_BB]     + g[idx_g_F]     )  +
-                                      (f[idx_f_B]      + f[idx_f_FF]    )*(g[idx_g_B]      + g[idx_g_FF]    )) +
-                            d_coef_c*((f[idx_f_BBB]    + f[idx_f_F]     )*(g[idx_g_BBB]    + g[idx_g_F]     )  +
-                                      (f[idx_f_BB]     + f[idx_f_FF]    )*(g[idx_g_BB]     + g[idx_g_FF]    )  +
-                                      (f[idx_f_B]      + f[idx_f_FFF]   )*(g[idx_g_B]      + g[idx_g_FFF]   )) +
-                            d_coef_d*((f[idx_f_BBBB]   + f[idx_f_F]     )*(g[idx_g_BBBB]   + g[idx_g_F]     )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FF]    )*(g[idx_g_BBB]    + g[idx_g_FF]    )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFF]   )*(g[idx_g_BB]     + g[idx_g_FFF]   )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFF]  )*(g[idx_g_B]      + g[idx_g_FFFF]  )) +
-                            d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_F]     )*(g[idx_g_BBBBB]  + g[idx_g_F]     )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_FF]    )*(g[idx_g_BBBB]   + g[idx_g_FF]    )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FFF]   )*(g[idx_g_BBB]    + g[idx_g_FFF]   )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFFF]  )*(g[idx_g_BB]     + g[idx_g_FFFF]  )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFFF] )*(g[idx_g_B]      + g[idx_g_FFFFF] )) +
-                            d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_F]     )*(g[idx_g_BBBBBB] + g[idx_g_F]     )  +
-                                      (f[idx_f_BBBBB]  + f[idx_f_FF]    )*(g[idx_g_BBBBB]  + g[idx_g_FF]    )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_FFF]   )*(g[idx_g_BBBB]   + g[idx_g_FFF]   )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FFFF]  )*(g[idx_g_BBB]    + g[idx_g_FFFF]  )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFFFF] )*(g[idx_g_BB]     + g[idx_g_FFFFF] )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFFFF])*(g[idx_g_B]      + g[idx_g_FFFFFF])));
-                    }
-                }
+                // Compute the linear indices.
+                const int idx_face = offset_face + i + j*stride_1_face + k*stride_2_face;
+                
+                const int idx_f_R = offset_f + i + j*stride_1_f + k*stride_2_f;
+                const int idx_f_L = idx_f_R - stride_direction_f;
+                
+                const int idx_g_R = offset_g + i + j*stride_1_g + k*stride_2_g;
+                const int idx_g_L = idx_g_R - stride_direction_g;
+                
+                F_face[idx_face] += dt*half*(
+                    computeQuadraticTerm<HALF_WIDTH>(f, g, coef,
+                        idx_f_L, idx_f_R,
+                        idx_g_L, idx_g_R,
+                        stride_direction_f, stride_direction_g));
             }
         }
     }
@@ -9853,10 +2084,12 @@ ConvectiveFluxReconstructorKEP::addQuadraticTermToConvectiveFluxZ(
 
 
 /*
- * Add cubic term to convective flux in z-direction.
+ * Add cubic term to convective flux in a direction. The number of dimensions DIM and the number of cells
+ * HALF_WIDTH on each side of a face in the stencil are fixed at compile time.
  */
+template<int DIM, int HALF_WIDTH>
 void
-ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxZ(
+ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFlux(
     HAMERS_SHARED_PTR<pdat::SideData<double> >& data_convective_flux,
     const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_f,
     const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_g,
@@ -9865,891 +2098,127 @@ ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxZ(
     const int component_idx_f,
     const int component_idx_g,
     const int component_idx_h,
-    const double dt) const
+    const double dt,
+    const int direction) const
 {
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-    if (d_dim == tbox::Dimension(1))
-    {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxZ:"
-            " Cannot compute cubic term in z-direction for one-dimensional problem!");
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        TBOX_ERROR("ConvectiveFluxReconstructorKEP::addCubicTermToConvectiveFluxZ:"
-            " Cannot compute cubic term in z-direction for two-dimensional problem!");
-    }
-#endif
-    
     const hier::Box interior_box = data_convective_flux->getBox();
     const hier::IntVector interior_dims = interior_box.numberCells();
     
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-        TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
-        TBOX_ASSERT(data_h->getBox().isSpatiallyEqual(interior_box));
+    TBOX_ASSERT(data_f->getBox().isSpatiallyEqual(interior_box));
+    TBOX_ASSERT(data_g->getBox().isSpatiallyEqual(interior_box));
+    TBOX_ASSERT(data_h->getBox().isSpatiallyEqual(interior_box));
 #endif
     
-    // Get the dimensions of the ghost cell boxes.
-    
-    const hier::Box ghost_box_f = data_f->getGhostBox();
-    const hier::IntVector ghostcell_dims_f = ghost_box_f.numberCells();
-    const hier::IntVector num_ghosts_f = data_f->getGhostCellWidth();
-    
-    const hier::Box ghost_box_g = data_g->getGhostBox();
-    const hier::IntVector ghostcell_dims_g = ghost_box_g.numberCells();
-    const hier::IntVector num_ghosts_g = data_g->getGhostCellWidth();
-    
-    const hier::Box ghost_box_h = data_h->getGhostBox();
-    const hier::IntVector ghostcell_dims_h = ghost_box_h.numberCells();
-    const hier::IntVector num_ghosts_h = data_h->getGhostCellWidth();
-    
     /*
      * Get the pointers to the data.
      */
     
-    double* F_face_z = data_convective_flux->getPointer(2, component_idx_flux);
-    double* f        = data_f->getPointer(component_idx_f);
-    double* g        = data_g->getPointer(component_idx_g);
-    double* h        = data_h->getPointer(component_idx_h);
+    double* F_face = data_convective_flux->getPointer(direction, component_idx_flux);
+    double* f      = data_f->getPointer(component_idx_f);
+    double* g      = data_g->getPointer(component_idx_g);
+    double* h      = data_h->getPointer(component_idx_h);
     
     const double quarter = double(1)/double(4);
     
-    if (d_dim == tbox::Dimension(3))
+    // Copy the coefficients to local constants.
+    const double coef[6] = { d_coef_a, d_coef_b, d_coef_c, d_coef_d, d_coef_e, d_coef_f };
+    
+    /*
+     * Get the bounds of the loops over the faces, the linear index offsets and the strides of the data
+     * padded to three dimensions.
+     */
+    
+    hier::IntVector face_dims(interior_dims);
+    face_dims[direction] += 1;
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, hier::IntVector::getZero(d_dim), face_dims);
+    
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_face;
+    int stride_face[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_face,
+        stride_face,
+        data_convective_flux->getGhostCellWidth(),
+        data_convective_flux->getGhostBox().numberCells(),
+        direction);
+    
+    int offset_f;
+    int stride_f[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_f,
+        stride_f,
+        data_f->getGhostCellWidth(),
+        data_f->getGhostBox().numberCells(),
+        -1);
+    
+    int offset_g;
+    int stride_g[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_g,
+        stride_g,
+        data_g->getGhostCellWidth(),
+        data_g->getGhostBox().numberCells(),
+        -1);
+    
+    int offset_h;
+    int stride_h[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_h,
+        stride_h,
+        data_h->getGhostCellWidth(),
+        data_h->getGhostBox().numberCells(),
+        -1);
+    
+    const int stride_1_face = stride_face[1];
+    const int stride_2_face = stride_face[2];
+    
+    const int stride_1_f = stride_f[1];
+    const int stride_2_f = stride_f[2];
+    
+    const int stride_1_g = stride_g[1];
+    const int stride_2_g = stride_g[2];
+    
+    const int stride_1_h = stride_h[1];
+    const int stride_2_h = stride_h[2];
+    
+    const int stride_direction_f = stride_f[direction];
+    const int stride_direction_g = stride_g[direction];
+    const int stride_direction_h = stride_h[direction];
+    
+    for (int k = 0; k < hi_2; k++)
     {
-        /*
-         * Get the dimensions.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        /*
-         * Get the numbers of ghost cells and the dimensions of the ghost cell boxes.
-         */
-        
-        const int num_ghosts_0_f = num_ghosts_f[0];
-        const int num_ghosts_1_f = num_ghosts_f[1];
-        const int num_ghosts_2_f = num_ghosts_f[2];
-        const int ghostcell_dim_0_f = ghostcell_dims_f[0];
-        const int ghostcell_dim_1_f = ghostcell_dims_f[1];
-        
-        const int num_ghosts_0_g = num_ghosts_g[0];
-        const int num_ghosts_1_g = num_ghosts_g[1];
-        const int num_ghosts_2_g = num_ghosts_g[2];
-        const int ghostcell_dim_0_g = ghostcell_dims_g[0];
-        const int ghostcell_dim_1_g = ghostcell_dims_g[1];
-        
-        const int num_ghosts_0_h = num_ghosts_h[0];
-        const int num_ghosts_1_h = num_ghosts_h[1];
-        const int num_ghosts_2_h = num_ghosts_h[2];
-        const int ghostcell_dim_0_h = ghostcell_dims_h[0];
-        const int ghostcell_dim_1_h = ghostcell_dims_h[1];
-        
-        if (d_stencil_width == 3)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_B = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_B = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_B = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_F = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_z[idx_face_z] += dt*quarter*(
-                            d_coef_a*(f[idx_f_B] + f[idx_f_F])*(g[idx_g_B] + g[idx_g_F])*(h[idx_h_B] + h[idx_h_F]));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 5)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BB = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_F  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FF = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_z[idx_face_z] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]  + f[idx_f_F] )*(g[idx_g_B]  + g[idx_g_F] )*(h[idx_h_B]  + h[idx_h_F] )) +
-                            d_coef_b*((f[idx_f_BB] + f[idx_f_F] )*(g[idx_g_BB] + g[idx_g_F] )*(h[idx_h_BB] + h[idx_h_F] )  +
-                                      (f[idx_f_B]  + f[idx_f_FF])*(g[idx_g_B]  + g[idx_g_FF])*(h[idx_h_B]  + h[idx_h_FF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 7)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBB = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 3 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_F   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FF  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFF = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_z[idx_face_z] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]   + f[idx_f_F]  )*(g[idx_g_B]   + g[idx_g_F]  )*(h[idx_h_B]   + h[idx_h_F]  )) +
-                            d_coef_b*((f[idx_f_BB]  + f[idx_f_F]  )*(g[idx_g_BB]  + g[idx_g_F]  )*(h[idx_h_BB]  + h[idx_h_F]  )  +
-                                      (f[idx_f_B]   + f[idx_f_FF] )*(g[idx_g_B]   + g[idx_g_FF] )*(h[idx_h_B]   + h[idx_h_FF] )) +
-                            d_coef_c*((f[idx_f_BBB] + f[idx_f_F]  )*(g[idx_g_BBB] + g[idx_g_F]  )*(h[idx_h_BBB] + h[idx_h_F]  )  +
-                                      (f[idx_f_BB]  + f[idx_f_FF] )*(g[idx_g_BB]  + g[idx_g_FF] )*(h[idx_h_BB]  + h[idx_h_FF] )  +
-                                      (f[idx_f_B]   + f[idx_f_FFF])*(g[idx_g_B]   + g[idx_g_FFF])*(h[idx_h_B]   + h[idx_h_FFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 9)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBBB = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 4 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBB  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 3 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_F    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FF   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFF  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFFF = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 3 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_z[idx_face_z] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]    + f[idx_f_F]   )*(g[idx_g_B]    + g[idx_g_F]   )*(h[idx_h_B]    + h[idx_h_F]   )) +
-                            d_coef_b*((f[idx_f_BB]   + f[idx_f_F]   )*(g[idx_g_BB]   + g[idx_g_F]   )*(h[idx_h_BB]   + h[idx_h_F]   )  +
-                                      (f[idx_f_B]    + f[idx_f_FF]  )*(g[idx_g_B]    + g[idx_g_FF]  )*(h[idx_h_B]    + h[idx_h_FF]  )) +
-                            d_coef_c*((f[idx_f_BBB]  + f[idx_f_F]   )*(g[idx_g_BBB]  + g[idx_g_F]   )*(h[idx_h_BBB]  + h[idx_h_F]   )  +
-                                      (f[idx_f_BB]   + f[idx_f_FF]  )*(g[idx_g_BB]   + g[idx_g_FF]  )*(h[idx_h_BB]   + h[idx_h_FF]  )  +
-                                      (f[idx_f_B]    + f[idx_f_FFF] )*(g[idx_g_B]    + g[idx_g_FFF] )*(h[idx_h_B]    + h[idx_h_FFF] )) +
-                            d_coef_d*((f[idx_f_BBBB] + f[idx_f_F]   )*(g[idx_g_BBBB] + g[idx_g_F]   )*(h[idx_h_BBBB] + h[idx_h_F]   )  +
-                                      (f[idx_f_BBB]  + f[idx_f_FF]  )*(g[idx_g_BBB]  + g[idx_g_FF]  )*(h[idx_h_BBB]  + h[idx_h_FF]  )  +
-                                      (f[idx_f_BB]   + f[idx_f_FFF] )*(g[idx_g_BB]   + g[idx_g_FFF] )*(h[idx_h_BB]   + h[idx_h_FFF] )  +
-                                      (f[idx_f_B]    + f[idx_f_FFFF])*(g[idx_g_B]    + g[idx_g_FFFF])*(h[idx_h_B]    + h[idx_h_FFFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 11)
+        for (int j = 0; j < hi_1; j++)
         {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
-            {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
 #ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
+            #pragma omp simd
 #endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 5 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBBBB = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 5 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBBB  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 4 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBB   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 3 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B     = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_F     = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FF    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFF   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFFF  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 3 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFFFF = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 4 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_z[idx_face_z] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]     + f[idx_f_F]    )*(g[idx_g_B]     + g[idx_g_F]    )*(h[idx_h_B]     + h[idx_h_F]    )) +
-                            d_coef_b*((f[idx_f_BB]    + f[idx_f_F]    )*(g[idx_g_BB]    + g[idx_g_F]    )*(h[idx_h_BB]    + h[idx_h_F]    )  +
-                                      (f[idx_f_B]     + f[idx_f_FF]   )*(g[idx_g_B]     + g[idx_g_FF]   )*(h[idx_h_B]     + h[idx_h_FF]   )) +
-                            d_coef_c*((f[idx_f_BBB]   + f[idx_f_F]    )*(g[idx_g_BBB]   + g[idx_g_F]    )*(h[idx_h_BBB]   + h[idx_h_F]    )  +
-                                      (f[idx_f_BB]    + f[idx_f_FF]   )*(g[idx_g_BB]    + g[idx_g_FF]   )*(h[idx_h_BB]    + h[idx_h_FF]   )  +
-                                      (f[idx_f_B]     + f[idx_f_FFF]  )*(g[idx_g_B]     + g[idx_g_FFF]  )*(h[idx_h_B]     + h[idx_h_FFF]  )) +
-                            d_coef_d*((f[idx_f_BBBB]  + f[idx_f_F]    )*(g[idx_g_BBBB]  + g[idx_g_F]    )*(h[idx_h_BBBB]  + h[idx_h_F]    )  +
-                                      (f[idx_f_BBB]   + f[idx_f_FF]   )*(g[idx_g_BBB]   + g[idx_g_FF]   )*(h[idx_h_BBB]   + h[idx_h_FF]   )  +
-                                      (f[idx_f_BB]    + f[idx_f_FFF]  )*(g[idx_g_BB]    + g[idx_g_FFF]  )*(h[idx_h_BB]    + h[idx_h_FFF]  )  +
-                                      (f[idx_f_B]     + f[idx_f_FFFF] )*(g[idx_g_B]     + g[idx_g_FFFF] )*(h[idx_h_B]     + h[idx_h_FFFF] )) +
-                            d_coef_e*((f[idx_f_BBBBB] + f[idx_f_F]    )*(g[idx_g_BBBBB] + g[idx_g_F]    )*(h[idx_h_BBBBB] + h[idx_h_F]    )  +
-                                      (f[idx_f_BBBB]  + f[idx_f_FF]   )*(g[idx_g_BBBB]  + g[idx_g_FF]   )*(h[idx_h_BBBB]  + h[idx_h_FF]   )  +
-                                      (f[idx_f_BBB]   + f[idx_f_FFF]  )*(g[idx_g_BBB]   + g[idx_g_FFF]  )*(h[idx_h_BBB]   + h[idx_h_FFF]  )  +
-                                      (f[idx_f_BB]    + f[idx_f_FFFF] )*(g[idx_g_BB]    + g[idx_g_FFFF] )*(h[idx_h_BB]    + h[idx_h_FFFF] )  +
-                                      (f[idx_f_B]     + f[idx_f_FFFFF])*(g[idx_g_B]     + g[idx_g_FFFFF])*(h[idx_h_B]     + h[idx_h_FFFFF])));
-                    }
-                }
-            }
-        }
-        else if (d_stencil_width == 13)
-        {
-            for (int k = 0; k < interior_dim_2 + 1; k++)
+            for (int i = 0; i < hi_0; i++)
             {
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        const int idx_face_z = i +
-                            j*interior_dim_0 + 
-                            k*interior_dim_0*interior_dim_1;
-                        
-                        const int idx_f_BBBBBB = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 6 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBBB  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBBB   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BBB    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_BB     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_B      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k - 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_F      = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FF     = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 1 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFF    = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 2 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFF   = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 3 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFF  = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 4 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_f_FFFFFF = (i + num_ghosts_0_f) +
-                            (j + num_ghosts_1_f)*ghostcell_dim_0_f +
-                            (k + 5 + num_ghosts_2_f)*ghostcell_dim_0_f*
-                                ghostcell_dim_1_f;
-                        
-                        const int idx_g_BBBBBB = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 6 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBBB  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 5 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBBB   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BBB    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_BB     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_B      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k - 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_F      = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FF     = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 1 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFF    = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 2 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFF   = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 3 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFFF  = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 4 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_g_FFFFFF = (i + num_ghosts_0_g) +
-                            (j + num_ghosts_1_g)*ghostcell_dim_0_g +
-                            (k + 5 + num_ghosts_2_g)*ghostcell_dim_0_g*
-                                ghostcell_dim_1_g;
-                        
-                        const int idx_h_BBBBBB = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 6 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBBBB  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 5 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBBB   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 4 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BBB    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 3 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_BB     = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_B      = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k - 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_F      = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FF     = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 1 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFF    = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 2 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFFF   = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 3 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFFFF  = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 4 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        const int idx_h_FFFFFF = (i + num_ghosts_0_h) +
-                            (j + num_ghosts_1_h)*ghostcell_dim_0_h +
-                            (k + 5 + num_ghosts_2_h)*ghostcell_dim_0_h*
-                                ghostcell_dim_1_h;
-                        
-                        F_face_z[idx_face_z] += dt*quarter*(
-                            d_coef_a*((f[idx_f_B]      + f[idx_f_F]     )*(g[idx_g_B]      + g[idx_g_F]     )*(h[idx_h_B]      + h[idx_h_F]     )) +
-                            d_coef_b*((f[idx_f_BB]     + f[idx_f_F]     )*(g[idx_g_BB]     + g[idx_g_F]     )*(h[idx_h_BB]     + h[idx_h_F]     )  +
-                                      (f[idx_f_B]      + f[idx_f_FF]    )*(g[idx_g_B]      + g[idx_g_FF]    )*(h[idx_h_B]      + h[idx_h_FF]    )) +
-                            d_coef_c*((f[idx_f_BBB]    + f[idx_f_F]     )*(g[idx_g_BBB]    + g[idx_g_F]     )*(h[idx_h_BBB]    + h[idx_h_F]     )  +
-                                      (f[idx_f_BB]     + f[idx_f_FF]    )*(g[idx_g_BB]     + g[idx_g_FF]    )*(h[idx_h_BB]     + h[idx_h_FF]    )  +
-                                      (f[idx_f_B]      + f[idx_f_FFF]   )*(g[idx_g_B]      + g[idx_g_FFF]   )*(h[idx_h_B]      + h[idx_h_FFF]   )) +
-                            d_coef_d*((f[idx_f_BBBB]   + f[idx_f_F]     )*(g[idx_g_BBBB]   + g[idx_g_F]     )*(h[idx_h_BBBB]   + h[idx_h_F]     )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FF]    )*(g[idx_g_BBB]    + g[idx_g_FF]    )*(h[idx_h_BBB]    + h[idx_h_FF]    )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFF]   )*(g[idx_g_BB]     + g[idx_g_FFF]   )*(h[idx_h_BB]     + h[idx_h_FFF]   )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFF]  )*(g[idx_g_B]      + g[idx_g_FFFF]  )*(h[idx_h_B]      + h[idx_h_FFFF]  )) +
-                            d_coef_e*((f[idx_f_BBBBB]  + f[idx_f_F]     )*(g[idx_g_BBBBB]  + g[idx_g_F]     )*(h[idx_h_BBBBB]  + h[idx_h_F]     )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_FF]    )*(g[idx_g_BBBB]   + g[idx_g_FF]    )*(h[idx_h_BBBB]   + h[idx_h_FF]    )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FFF]   )*(g[idx_g_BBB]    + g[idx_g_FFF]   )*(h[idx_h_BBB]    + h[idx_h_FFF]   )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFFF]  )*(g[idx_g_BB]     + g[idx_g_FFFF]  )*(h[idx_h_BB]     + h[idx_h_FFFF]  )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFFF] )*(g[idx_g_B]      + g[idx_g_FFFFF] )*(h[idx_h_B]      + h[idx_h_FFFFF] )) +
-                            d_coef_f*((f[idx_f_BBBBBB] + f[idx_f_F]     )*(g[idx_g_BBBBBB] + g[idx_g_F]     )*(h[idx_h_BBBBBB] + h[idx_h_F]     )  +
-                                      (f[idx_f_BBBBB]  + f[idx_f_FF]    )*(g[idx_g_BBBBB]  + g[idx_g_FF]    )*(h[idx_h_BBBBB]  + h[idx_h_FF]    )  +
-                                      (f[idx_f_BBBB]   + f[idx_f_FFF]   )*(g[idx_g_BBBB]   + g[idx_g_FFF]   )*(h[idx_h_BBBB]   + h[idx_h_FFF]   )  +
-                                      (f[idx_f_BBB]    + f[idx_f_FFFF]  )*(g[idx_g_BBB]    + g[idx_g_FFFF]  )*(h[idx_h_BBB]    + h[idx_h_FFFF]  )  +
-                                      (f[idx_f_BB]     + f[idx_f_FFFFF] )*(g[idx_g_BB]     + g[idx_g_FFFFF] )*(h[idx_h_BB]     + h[idx_h_FFFFF] )  +
-                                      (f[idx_f_B]      + f[idx_f_FFFFFF])*(g[idx_g_B]      + g[idx_g_FFFFFF])*(h[idx_h_B]      + h[idx_h_FFFFFF])));
-                    }
-                }
+                // Compute the linear indices.
+                const int idx_face = offset_face + i + j*stride_1_face + k*stride_2_face;
+                
+                const int idx_f_R = offset_f + i + j*stride_1_f + k*stride_2_f;
+                const int idx_f_L = idx_f_R - stride_direction_f;
+                
+                const int idx_g_R = offset_g + i + j*stride_1_g + k*stride_2_g;
+                const int idx_g_L = idx_g_R - stride_direction_g;
+                
+                const int idx_h_R = offset_h + i + j*stride_1_h + k*stride_2_h;
+                const int idx_h_L = idx_h_R - stride_direction_h;
+                
+                F_face[idx_face] += dt*quarter*(
+                    computeCubicTerm<HALF_WIDTH>(f, g, h, coef,
+                        idx_f_L, idx_f_R,
+                        idx_g_L, idx_g_R,
+                        idx_h_L, idx_h_R,
+                        stride_direction_f, stride_direction_g, stride_direction_h));
             }
         }
     }
@@ -10803,6 +2272,14 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
         Z.push_back(data_volume_fractions->getPointer(si));
     }
     
+    // Copy the coefficients to local constants.
+    const double coef_a = d_coef_a;
+    const double coef_b = d_coef_b;
+    const double coef_c = d_coef_c;
+    const double coef_d = d_coef_d;
+    const double coef_e = d_coef_e;
+    const double coef_f = d_coef_f;
+    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -10851,7 +2328,7 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                     const int idx_cell_volume_fractions_x_R = i + 1 + num_ghosts_0_volume_fractions;
                     
                     S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                        d_coef_a*(Z[si][idx_cell_volume_fractions_x_R] - Z[si][idx_cell_volume_fractions_x_L])
+                        coef_a*(Z[si][idx_cell_volume_fractions_x_R] - Z[si][idx_cell_volume_fractions_x_L])
                         )/dx[0]
                         );
                 }
@@ -10875,8 +2352,8 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                     const int idx_cell_volume_fractions_x_RR = i + 2 + num_ghosts_0_volume_fractions;
                     
                     S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                        d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]  - Z[si][idx_cell_volume_fractions_x_L]) +
-                        d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR] - Z[si][idx_cell_volume_fractions_x_LL])
+                        coef_a*(Z[si][idx_cell_volume_fractions_x_R]  - Z[si][idx_cell_volume_fractions_x_L]) +
+                        coef_b*(Z[si][idx_cell_volume_fractions_x_RR] - Z[si][idx_cell_volume_fractions_x_LL])
                         )/dx[0]
                         );
                 }
@@ -10902,9 +2379,9 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                     const int idx_cell_volume_fractions_x_RRR = i + 3 + num_ghosts_0_volume_fractions;
                     
                     S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                        d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]   - Z[si][idx_cell_volume_fractions_x_L]) +
-                        d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]  - Z[si][idx_cell_volume_fractions_x_LL]) +
-                        d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR] - Z[si][idx_cell_volume_fractions_x_LLL])
+                        coef_a*(Z[si][idx_cell_volume_fractions_x_R]   - Z[si][idx_cell_volume_fractions_x_L]) +
+                        coef_b*(Z[si][idx_cell_volume_fractions_x_RR]  - Z[si][idx_cell_volume_fractions_x_LL]) +
+                        coef_c*(Z[si][idx_cell_volume_fractions_x_RRR] - Z[si][idx_cell_volume_fractions_x_LLL])
                         )/dx[0]
                         );
                 }
@@ -10932,10 +2409,10 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                     const int idx_cell_volume_fractions_x_RRRR = i + 4 + num_ghosts_0_volume_fractions;
                     
                     S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                        d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]    - Z[si][idx_cell_volume_fractions_x_L]) +
-                        d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]   - Z[si][idx_cell_volume_fractions_x_LL]) +
-                        d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]  - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                        d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR] - Z[si][idx_cell_volume_fractions_x_LLLL])
+                        coef_a*(Z[si][idx_cell_volume_fractions_x_R]    - Z[si][idx_cell_volume_fractions_x_L]) +
+                        coef_b*(Z[si][idx_cell_volume_fractions_x_RR]   - Z[si][idx_cell_volume_fractions_x_LL]) +
+                        coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]  - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                        coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR] - Z[si][idx_cell_volume_fractions_x_LLLL])
                         )/dx[0]
                         );
                 }
@@ -10965,11 +2442,11 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                     const int idx_cell_volume_fractions_x_RRRRR = i + 5 + num_ghosts_0_volume_fractions;
                     
                     S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                        d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]     - Z[si][idx_cell_volume_fractions_x_L]) +
-                        d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]    - Z[si][idx_cell_volume_fractions_x_LL]) +
-                        d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]   - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                        d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]  - Z[si][idx_cell_volume_fractions_x_LLLL]) +
-                        d_coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLL])
+                        coef_a*(Z[si][idx_cell_volume_fractions_x_R]     - Z[si][idx_cell_volume_fractions_x_L]) +
+                        coef_b*(Z[si][idx_cell_volume_fractions_x_RR]    - Z[si][idx_cell_volume_fractions_x_LL]) +
+                        coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]   - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                        coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]  - Z[si][idx_cell_volume_fractions_x_LLLL]) +
+                        coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLL])
                         )/dx[0]
                         );
                 }
@@ -11001,12 +2478,12 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                     const int idx_cell_volume_fractions_x_RRRRRR = i + 6 + num_ghosts_0_volume_fractions;
                     
                     S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                        d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]      - Z[si][idx_cell_volume_fractions_x_L]) +
-                        d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]     - Z[si][idx_cell_volume_fractions_x_LL]) +
-                        d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]    - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                        d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]   - Z[si][idx_cell_volume_fractions_x_LLLL]) +
-                        d_coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR]  - Z[si][idx_cell_volume_fractions_x_LLLLL]) +
-                        d_coef_f*(Z[si][idx_cell_volume_fractions_x_RRRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLLL])
+                        coef_a*(Z[si][idx_cell_volume_fractions_x_R]      - Z[si][idx_cell_volume_fractions_x_L]) +
+                        coef_b*(Z[si][idx_cell_volume_fractions_x_RR]     - Z[si][idx_cell_volume_fractions_x_LL]) +
+                        coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]    - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                        coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]   - Z[si][idx_cell_volume_fractions_x_LLLL]) +
+                        coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR]  - Z[si][idx_cell_volume_fractions_x_LLLLL]) +
+                        coef_f*(Z[si][idx_cell_volume_fractions_x_RRRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLLL])
                         )/dx[0]
                         );
                 }
@@ -11081,10 +2558,10 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                             (j + 1 + num_ghosts_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
                         
                         S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_x_R] - Z[si][idx_cell_volume_fractions_x_L])
+                            coef_a*(Z[si][idx_cell_volume_fractions_x_R] - Z[si][idx_cell_volume_fractions_x_L])
                             )/dx[0] +
                             dt*v[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_y_T] - Z[si][idx_cell_volume_fractions_y_B])
+                            coef_a*(Z[si][idx_cell_volume_fractions_y_T] - Z[si][idx_cell_volume_fractions_y_B])
                             )/dx[1]
                             );
                     }
@@ -11132,12 +2609,12 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                             (j + 2 + num_ghosts_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
                         
                         S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]  - Z[si][idx_cell_volume_fractions_x_L]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR] - Z[si][idx_cell_volume_fractions_x_LL])
+                            coef_a*(Z[si][idx_cell_volume_fractions_x_R]  - Z[si][idx_cell_volume_fractions_x_L]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_x_RR] - Z[si][idx_cell_volume_fractions_x_LL])
                             )/dx[0] +
                             dt*v[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]  - Z[si][idx_cell_volume_fractions_y_B]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT] - Z[si][idx_cell_volume_fractions_y_BB])
+                            coef_a*(Z[si][idx_cell_volume_fractions_y_T]  - Z[si][idx_cell_volume_fractions_y_B]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_y_TT] - Z[si][idx_cell_volume_fractions_y_BB])
                             )/dx[1]
                             );
                     }
@@ -11197,14 +2674,14 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                             (j + 3 + num_ghosts_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
                         
                         S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]   - Z[si][idx_cell_volume_fractions_x_L]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]  - Z[si][idx_cell_volume_fractions_x_LL]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR] - Z[si][idx_cell_volume_fractions_x_LLL])
+                            coef_a*(Z[si][idx_cell_volume_fractions_x_R]   - Z[si][idx_cell_volume_fractions_x_L]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_x_RR]  - Z[si][idx_cell_volume_fractions_x_LL]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_x_RRR] - Z[si][idx_cell_volume_fractions_x_LLL])
                             )/dx[0] +
                             dt*v[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]   - Z[si][idx_cell_volume_fractions_y_B]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]  - Z[si][idx_cell_volume_fractions_y_BB]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT] - Z[si][idx_cell_volume_fractions_y_BBB])
+                            coef_a*(Z[si][idx_cell_volume_fractions_y_T]   - Z[si][idx_cell_volume_fractions_y_B]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_y_TT]  - Z[si][idx_cell_volume_fractions_y_BB]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_y_TTT] - Z[si][idx_cell_volume_fractions_y_BBB])
                             )/dx[1]
                             );
                     }
@@ -11276,16 +2753,16 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                             (j + 4 + num_ghosts_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
                         
                         S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]    - Z[si][idx_cell_volume_fractions_x_L]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]   - Z[si][idx_cell_volume_fractions_x_LL]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]  - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                            d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR] - Z[si][idx_cell_volume_fractions_x_LLLL])
+                            coef_a*(Z[si][idx_cell_volume_fractions_x_R]    - Z[si][idx_cell_volume_fractions_x_L]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_x_RR]   - Z[si][idx_cell_volume_fractions_x_LL]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]  - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                            coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR] - Z[si][idx_cell_volume_fractions_x_LLLL])
                             )/dx[0] +
                             dt*v[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]    - Z[si][idx_cell_volume_fractions_y_B]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]   - Z[si][idx_cell_volume_fractions_y_BB]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]  - Z[si][idx_cell_volume_fractions_y_BBB]) +
-                            d_coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT] - Z[si][idx_cell_volume_fractions_y_BBBB])
+                            coef_a*(Z[si][idx_cell_volume_fractions_y_T]    - Z[si][idx_cell_volume_fractions_y_B]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_y_TT]   - Z[si][idx_cell_volume_fractions_y_BB]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]  - Z[si][idx_cell_volume_fractions_y_BBB]) +
+                            coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT] - Z[si][idx_cell_volume_fractions_y_BBBB])
                             )/dx[1]
                             );
                     }
@@ -11369,18 +2846,18 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                             (j + 5 + num_ghosts_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
                         
                         S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]     - Z[si][idx_cell_volume_fractions_x_L]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]    - Z[si][idx_cell_volume_fractions_x_LL]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]   - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                            d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]  - Z[si][idx_cell_volume_fractions_x_LLLL]) +
-                            d_coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLL])
+                            coef_a*(Z[si][idx_cell_volume_fractions_x_R]     - Z[si][idx_cell_volume_fractions_x_L]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_x_RR]    - Z[si][idx_cell_volume_fractions_x_LL]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]   - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                            coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]  - Z[si][idx_cell_volume_fractions_x_LLLL]) +
+                            coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLL])
                             )/dx[0] +
                             dt*v[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]     - Z[si][idx_cell_volume_fractions_y_B]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]    - Z[si][idx_cell_volume_fractions_y_BB]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]   - Z[si][idx_cell_volume_fractions_y_BBB]) +
-                            d_coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]  - Z[si][idx_cell_volume_fractions_y_BBBB]) +
-                            d_coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBB])
+                            coef_a*(Z[si][idx_cell_volume_fractions_y_T]     - Z[si][idx_cell_volume_fractions_y_B]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_y_TT]    - Z[si][idx_cell_volume_fractions_y_BB]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]   - Z[si][idx_cell_volume_fractions_y_BBB]) +
+                            coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]  - Z[si][idx_cell_volume_fractions_y_BBBB]) +
+                            coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBB])
                             )/dx[1]
                             );
                     }
@@ -11476,20 +2953,20 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                             (j + 6 + num_ghosts_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
                         
                         S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]      - Z[si][idx_cell_volume_fractions_x_L]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]     - Z[si][idx_cell_volume_fractions_x_LL]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]    - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                            d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]   - Z[si][idx_cell_volume_fractions_x_LLLL]) +
-                            d_coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR]  - Z[si][idx_cell_volume_fractions_x_LLLLL]) +
-                            d_coef_f*(Z[si][idx_cell_volume_fractions_x_RRRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLLL])
+                            coef_a*(Z[si][idx_cell_volume_fractions_x_R]      - Z[si][idx_cell_volume_fractions_x_L]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_x_RR]     - Z[si][idx_cell_volume_fractions_x_LL]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]    - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                            coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]   - Z[si][idx_cell_volume_fractions_x_LLLL]) +
+                            coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR]  - Z[si][idx_cell_volume_fractions_x_LLLLL]) +
+                            coef_f*(Z[si][idx_cell_volume_fractions_x_RRRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLLL])
                             )/dx[0] +
                             dt*v[idx_cell_velocity]*(
-                            d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]      - Z[si][idx_cell_volume_fractions_y_B]) +
-                            d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]     - Z[si][idx_cell_volume_fractions_y_BB]) +
-                            d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]    - Z[si][idx_cell_volume_fractions_y_BBB]) +
-                            d_coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]   - Z[si][idx_cell_volume_fractions_y_BBBB]) +
-                            d_coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT]  - Z[si][idx_cell_volume_fractions_y_BBBBB]) +
-                            d_coef_f*(Z[si][idx_cell_volume_fractions_y_TTTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBBB])
+                            coef_a*(Z[si][idx_cell_volume_fractions_y_T]      - Z[si][idx_cell_volume_fractions_y_B]) +
+                            coef_b*(Z[si][idx_cell_volume_fractions_y_TT]     - Z[si][idx_cell_volume_fractions_y_BB]) +
+                            coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]    - Z[si][idx_cell_volume_fractions_y_BBB]) +
+                            coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]   - Z[si][idx_cell_volume_fractions_y_BBBB]) +
+                            coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT]  - Z[si][idx_cell_volume_fractions_y_BBBBB]) +
+                            coef_f*(Z[si][idx_cell_volume_fractions_y_TTTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBBB])
                             )/dx[1]
                             );
                     }
@@ -11595,13 +3072,13 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                                     ghostcell_dim_1_volume_fractions;
                             
                             S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_x_R] - Z[si][idx_cell_volume_fractions_x_L])
+                                coef_a*(Z[si][idx_cell_volume_fractions_x_R] - Z[si][idx_cell_volume_fractions_x_L])
                                 )/dx[0] +
                                 dt*v[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_y_T] - Z[si][idx_cell_volume_fractions_y_B])
+                                coef_a*(Z[si][idx_cell_volume_fractions_y_T] - Z[si][idx_cell_volume_fractions_y_B])
                                 )/dx[1] +
                                 dt*w[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_z_F] - Z[si][idx_cell_volume_fractions_z_B])
+                                coef_a*(Z[si][idx_cell_volume_fractions_z_F] - Z[si][idx_cell_volume_fractions_z_B])
                                 )/dx[2]
                                 );
                         }
@@ -11692,16 +3169,16 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                                     ghostcell_dim_1_volume_fractions;
                             
                             S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]  - Z[si][idx_cell_volume_fractions_x_L]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR] - Z[si][idx_cell_volume_fractions_x_LL])
+                                coef_a*(Z[si][idx_cell_volume_fractions_x_R]  - Z[si][idx_cell_volume_fractions_x_L]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_x_RR] - Z[si][idx_cell_volume_fractions_x_LL])
                                 )/dx[0] +
                                 dt*v[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]  - Z[si][idx_cell_volume_fractions_y_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT] - Z[si][idx_cell_volume_fractions_y_BB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_y_T]  - Z[si][idx_cell_volume_fractions_y_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_y_TT] - Z[si][idx_cell_volume_fractions_y_BB])
                                 )/dx[1] +
                                 dt*w[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_z_F]  - Z[si][idx_cell_volume_fractions_z_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_z_FF] - Z[si][idx_cell_volume_fractions_z_BB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_z_F]  - Z[si][idx_cell_volume_fractions_z_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_z_FF] - Z[si][idx_cell_volume_fractions_z_BB])
                                 )/dx[2]
                                 );
                         }
@@ -11822,19 +3299,19 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                                     ghostcell_dim_1_volume_fractions;
                             
                             S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]   - Z[si][idx_cell_volume_fractions_x_L]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]  - Z[si][idx_cell_volume_fractions_x_LL]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR] - Z[si][idx_cell_volume_fractions_x_LLL])
+                                coef_a*(Z[si][idx_cell_volume_fractions_x_R]   - Z[si][idx_cell_volume_fractions_x_L]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_x_RR]  - Z[si][idx_cell_volume_fractions_x_LL]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_x_RRR] - Z[si][idx_cell_volume_fractions_x_LLL])
                                 )/dx[0] +
                                 dt*v[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]   - Z[si][idx_cell_volume_fractions_y_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]  - Z[si][idx_cell_volume_fractions_y_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT] - Z[si][idx_cell_volume_fractions_y_BBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_y_T]   - Z[si][idx_cell_volume_fractions_y_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_y_TT]  - Z[si][idx_cell_volume_fractions_y_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_y_TTT] - Z[si][idx_cell_volume_fractions_y_BBB])
                                 )/dx[1] +
                                 dt*w[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_z_F]   - Z[si][idx_cell_volume_fractions_z_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_z_FF]  - Z[si][idx_cell_volume_fractions_z_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_z_FFF] - Z[si][idx_cell_volume_fractions_z_BBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_z_F]   - Z[si][idx_cell_volume_fractions_z_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_z_FF]  - Z[si][idx_cell_volume_fractions_z_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_z_FFF] - Z[si][idx_cell_volume_fractions_z_BBB])
                                 )/dx[2]
                                 );
                         }
@@ -11985,22 +3462,22 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                                     ghostcell_dim_1_volume_fractions;
                             
                             S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]    - Z[si][idx_cell_volume_fractions_x_L]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]   - Z[si][idx_cell_volume_fractions_x_LL]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]  - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR] - Z[si][idx_cell_volume_fractions_x_LLLL])
+                                coef_a*(Z[si][idx_cell_volume_fractions_x_R]    - Z[si][idx_cell_volume_fractions_x_L]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_x_RR]   - Z[si][idx_cell_volume_fractions_x_LL]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]  - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR] - Z[si][idx_cell_volume_fractions_x_LLLL])
                                 )/dx[0] +
                                 dt*v[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]    - Z[si][idx_cell_volume_fractions_y_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]   - Z[si][idx_cell_volume_fractions_y_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]  - Z[si][idx_cell_volume_fractions_y_BBB]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT] - Z[si][idx_cell_volume_fractions_y_BBBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_y_T]    - Z[si][idx_cell_volume_fractions_y_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_y_TT]   - Z[si][idx_cell_volume_fractions_y_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]  - Z[si][idx_cell_volume_fractions_y_BBB]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT] - Z[si][idx_cell_volume_fractions_y_BBBB])
                                 )/dx[1] +
                                 dt*w[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_z_F]    - Z[si][idx_cell_volume_fractions_z_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_z_FF]   - Z[si][idx_cell_volume_fractions_z_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_z_FFF]  - Z[si][idx_cell_volume_fractions_z_BBB]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_z_FFFF] - Z[si][idx_cell_volume_fractions_z_BBBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_z_F]    - Z[si][idx_cell_volume_fractions_z_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_z_FF]   - Z[si][idx_cell_volume_fractions_z_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_z_FFF]  - Z[si][idx_cell_volume_fractions_z_BBB]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_z_FFFF] - Z[si][idx_cell_volume_fractions_z_BBBB])
                                 )/dx[2]
                                 );
                         }
@@ -12181,25 +3658,25 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                                     ghostcell_dim_1_volume_fractions;
                             
                             S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]     - Z[si][idx_cell_volume_fractions_x_L]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]    - Z[si][idx_cell_volume_fractions_x_LL]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]   - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]  - Z[si][idx_cell_volume_fractions_x_LLLL]) +
-                                d_coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLL])
+                                coef_a*(Z[si][idx_cell_volume_fractions_x_R]     - Z[si][idx_cell_volume_fractions_x_L]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_x_RR]    - Z[si][idx_cell_volume_fractions_x_LL]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]   - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]  - Z[si][idx_cell_volume_fractions_x_LLLL]) +
+                                coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLL])
                                 )/dx[0] +
                                 dt*v[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]     - Z[si][idx_cell_volume_fractions_y_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]    - Z[si][idx_cell_volume_fractions_y_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]   - Z[si][idx_cell_volume_fractions_y_BBB]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]  - Z[si][idx_cell_volume_fractions_y_BBBB]) +
-                                d_coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_y_T]     - Z[si][idx_cell_volume_fractions_y_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_y_TT]    - Z[si][idx_cell_volume_fractions_y_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]   - Z[si][idx_cell_volume_fractions_y_BBB]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]  - Z[si][idx_cell_volume_fractions_y_BBBB]) +
+                                coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBB])
                                 )/dx[1] +
                                 dt*w[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_z_F]     - Z[si][idx_cell_volume_fractions_z_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_z_FF]    - Z[si][idx_cell_volume_fractions_z_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_z_FFF]   - Z[si][idx_cell_volume_fractions_z_BBB]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_z_FFFF]  - Z[si][idx_cell_volume_fractions_z_BBBB]) +
-                                d_coef_e*(Z[si][idx_cell_volume_fractions_z_FFFFF] - Z[si][idx_cell_volume_fractions_z_BBBBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_z_F]     - Z[si][idx_cell_volume_fractions_z_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_z_FF]    - Z[si][idx_cell_volume_fractions_z_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_z_FFF]   - Z[si][idx_cell_volume_fractions_z_BBB]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_z_FFFF]  - Z[si][idx_cell_volume_fractions_z_BBBB]) +
+                                coef_e*(Z[si][idx_cell_volume_fractions_z_FFFFF] - Z[si][idx_cell_volume_fractions_z_BBBBB])
                                 )/dx[2]
                                 );
                         }
@@ -12410,28 +3887,28 @@ ConvectiveFluxReconstructorKEP::addSourceTermsToVolumeFractionEquations(
                                     ghostcell_dim_1_volume_fractions;
                             
                             S[idx_cell_source] -= (dt*u[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_x_R]      - Z[si][idx_cell_volume_fractions_x_L]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_x_RR]     - Z[si][idx_cell_volume_fractions_x_LL]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]    - Z[si][idx_cell_volume_fractions_x_LLL]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]   - Z[si][idx_cell_volume_fractions_x_LLLL]) +
-                                d_coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR]  - Z[si][idx_cell_volume_fractions_x_LLLLL]) +
-                                d_coef_f*(Z[si][idx_cell_volume_fractions_x_RRRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLLL])
+                                coef_a*(Z[si][idx_cell_volume_fractions_x_R]      - Z[si][idx_cell_volume_fractions_x_L]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_x_RR]     - Z[si][idx_cell_volume_fractions_x_LL]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_x_RRR]    - Z[si][idx_cell_volume_fractions_x_LLL]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_x_RRRR]   - Z[si][idx_cell_volume_fractions_x_LLLL]) +
+                                coef_e*(Z[si][idx_cell_volume_fractions_x_RRRRR]  - Z[si][idx_cell_volume_fractions_x_LLLLL]) +
+                                coef_f*(Z[si][idx_cell_volume_fractions_x_RRRRRR] - Z[si][idx_cell_volume_fractions_x_LLLLLL])
                                 )/dx[0] +
                                 dt*v[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_y_T]      - Z[si][idx_cell_volume_fractions_y_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_y_TT]     - Z[si][idx_cell_volume_fractions_y_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]    - Z[si][idx_cell_volume_fractions_y_BBB]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]   - Z[si][idx_cell_volume_fractions_y_BBBB]) +
-                                d_coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT]  - Z[si][idx_cell_volume_fractions_y_BBBBB]) +
-                                d_coef_f*(Z[si][idx_cell_volume_fractions_y_TTTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_y_T]      - Z[si][idx_cell_volume_fractions_y_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_y_TT]     - Z[si][idx_cell_volume_fractions_y_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_y_TTT]    - Z[si][idx_cell_volume_fractions_y_BBB]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_y_TTTT]   - Z[si][idx_cell_volume_fractions_y_BBBB]) +
+                                coef_e*(Z[si][idx_cell_volume_fractions_y_TTTTT]  - Z[si][idx_cell_volume_fractions_y_BBBBB]) +
+                                coef_f*(Z[si][idx_cell_volume_fractions_y_TTTTTT] - Z[si][idx_cell_volume_fractions_y_BBBBBB])
                                 )/dx[1] +
                                 dt*w[idx_cell_velocity]*(
-                                d_coef_a*(Z[si][idx_cell_volume_fractions_z_F]      - Z[si][idx_cell_volume_fractions_z_B]) +
-                                d_coef_b*(Z[si][idx_cell_volume_fractions_z_FF]     - Z[si][idx_cell_volume_fractions_z_BB]) +
-                                d_coef_c*(Z[si][idx_cell_volume_fractions_z_FFF]    - Z[si][idx_cell_volume_fractions_z_BBB]) +
-                                d_coef_d*(Z[si][idx_cell_volume_fractions_z_FFFF]   - Z[si][idx_cell_volume_fractions_z_BBBB]) +
-                                d_coef_e*(Z[si][idx_cell_volume_fractions_z_FFFFF]  - Z[si][idx_cell_volume_fractions_z_BBBBB]) +
-                                d_coef_f*(Z[si][idx_cell_volume_fractions_z_FFFFFF] - Z[si][idx_cell_volume_fractions_z_BBBBBB])
+                                coef_a*(Z[si][idx_cell_volume_fractions_z_F]      - Z[si][idx_cell_volume_fractions_z_B]) +
+                                coef_b*(Z[si][idx_cell_volume_fractions_z_FF]     - Z[si][idx_cell_volume_fractions_z_BB]) +
+                                coef_c*(Z[si][idx_cell_volume_fractions_z_FFF]    - Z[si][idx_cell_volume_fractions_z_BBB]) +
+                                coef_d*(Z[si][idx_cell_volume_fractions_z_FFFF]   - Z[si][idx_cell_volume_fractions_z_BBBB]) +
+                                coef_e*(Z[si][idx_cell_volume_fractions_z_FFFFF]  - Z[si][idx_cell_volume_fractions_z_BBBBB]) +
+                                coef_f*(Z[si][idx_cell_volume_fractions_z_FFFFFF] - Z[si][idx_cell_volume_fractions_z_BBBBBB])
                                 )/dx[2]
                                 );
                         }
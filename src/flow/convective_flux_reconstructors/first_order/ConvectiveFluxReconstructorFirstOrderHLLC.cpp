@@ -124,8 +124,8 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
     
     if (d_has_advective_eqn_form)
     {
-        velocity_intercell.reset(new pdat::SideData<double>(
-            interior_box, d_dim.getValue(), hier::IntVector::getZero(d_dim)));
+        velocity_intercell = d_scratch_arena->getSideData(
+            interior_box, d_dim.getValue(), hier::IntVector::getZero(d_dim));
     }
     
     if (d_dim == tbox::Dimension(1))
@@ -196,10 +196,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            conservative_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            conservative_variables_minus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getZero(d_dim)));
             
-            conservative_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            conservative_variables_plus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getZero(d_dim)));
         }
         
@@ -375,10 +375,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            conservative_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            conservative_variables_minus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getZero(d_dim)));
             
-            conservative_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            conservative_variables_plus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getZero(d_dim)));
         }
         
@@ -663,10 +663,10 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            conservative_variables_minus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            conservative_variables_minus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getZero(d_dim)));
             
-            conservative_variables_plus.push_back(HAMERS_MAKE_SHARED<pdat::SideData<double> >(
+            conservative_variables_plus.push_back(d_scratch_arena->getSideData(
                 interior_box, 1, hier::IntVector::getZero(d_dim)));
         }
         
@@ -1017,4 +1017,11 @@ ConvectiveFluxReconstructorFirstOrderHLLC::computeConvectiveFluxAndSourceOnPatch
         d_flow_model->unregisterPatch();
         
     } // if (d_dim == tbox::Dimension(3))
+    
+    /*
+     * Mark the end of the patch operation in the arenas of the temporary patch data.
+     */
+    
+    d_scratch_arena->reset();
+    riemann_solver->getScratchArena()->reset();
 }
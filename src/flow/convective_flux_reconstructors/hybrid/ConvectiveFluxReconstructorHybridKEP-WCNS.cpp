@@ -0,0 +1,984 @@
+#include "flow/convective_flux_reconstructors/hybrid/ConvectiveFluxReconstructorHybridKEP-WCNS.hpp"
+
+#include "SAMRAI/tbox/PIO.h"
+
+#include <algorithm>
+
+#define EPSILON HAMERS_EPSILON
+
+/*
+ * Timers interspersed throughout the class.
+ */
+
+HAMERS_SHARED_PTR<tbox::Timer> ConvectiveFluxReconstructorHybridKEP_WCNS::t_compute_shock_band;
+HAMERS_SHARED_PTR<tbox::Timer> ConvectiveFluxReconstructorHybridKEP_WCNS::t_blend_flux;
+
+
+ConvectiveFluxReconstructorHybridKEP_WCNS::ConvectiveFluxReconstructorHybridKEP_WCNS(
+    const std::string& object_name,
+    const tbox::Dimension& dim,
+    const HAMERS_SHARED_PTR<geom::CartesianGridGeometry>& grid_geometry,
+    const int& num_eqn,
+    const FLOW_MODEL::TYPE& flow_model_type,
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model,
+    const HAMERS_SHARED_PTR<tbox::Database>& convective_flux_reconstructor_db):
+        ConvectiveFluxReconstructor(
+            object_name,
+            dim,
+            grid_geometry,
+            num_eqn,
+            flow_model_type,
+            flow_model,
+            convective_flux_reconstructor_db),
+        d_num_faces_central(0),
+        d_num_faces_shock_capturing(0),
+        d_num_midpoints(0),
+        d_num_midpoints_shock_capturing(0),
+        d_num_patches_central_only(0),
+        d_num_patches_hybrid(0),
+        d_num_patches_shock_capturing_only(0)
+{
+    /*
+     * Get the options of the shock sensor.
+     */
+    
+    d_shock_capturing_scheme_str = d_convective_flux_reconstructor_db->
+        getStringWithDefault("shock_capturing_scheme", "WCNS6_LD_HLLC_HLL");
+    d_shock_capturing_scheme_str = d_convective_flux_reconstructor_db->
+        getStringWithDefault("d_shock_capturing_scheme_str", d_shock_capturing_scheme_str);
+    
+    d_shock_sensor_threshold = d_convective_flux_reconstructor_db->
+        getDoubleWithDefault("shock_sensor_threshold", double(0.65));
+    d_shock_sensor_threshold = d_convective_flux_reconstructor_db->
+        getDoubleWithDefault("d_shock_sensor_threshold", d_shock_sensor_threshold);
+    
+    d_dilatation_threshold = d_convective_flux_reconstructor_db->
+        getDoubleWithDefault("dilatation_threshold", double(0.05));
+    d_dilatation_threshold = d_convective_flux_reconstructor_db->
+        getDoubleWithDefault("d_dilatation_threshold", d_dilatation_threshold);
+    
+    d_shock_band_width = d_convective_flux_reconstructor_db->
+        getIntegerWithDefault("shock_band_width", 2);
+    d_shock_band_width = d_convective_flux_reconstructor_db->
+        getIntegerWithDefault("d_shock_band_width", d_shock_band_width);
+    
+    d_print_patch_statistics = d_convective_flux_reconstructor_db->
+        getBoolWithDefault("print_patch_statistics", false);
+    d_print_patch_statistics = d_convective_flux_reconstructor_db->
+        getBoolWithDefault("d_print_patch_statistics", d_print_patch_statistics);
+    
+    if (d_shock_band_width < 0)
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "Negative shock_band_width = "
+            << d_shock_band_width
+            << " found in input."
+            << std::endl);
+    }
+    
+    /*
+     * Create the central and shock-capturing convective flux reconstructors. Both of them share the
+     * database of the hybrid scheme.
+     */
+    
+    d_central_reconstructor.reset(new ConvectiveFluxReconstructorKEP(
+        object_name + "::d_central_reconstructor",
+        dim,
+        grid_geometry,
+        num_eqn,
+        flow_model_type,
+        flow_model,
+        convective_flux_reconstructor_db));
+    
+    if (d_shock_capturing_scheme_str == "WCNS5_JS_HLLC_HLL")
+    {
+        d_shock_capturing_reconstructor.reset(new ConvectiveFluxReconstructorWCNS5_JS_HLLC_HLL(
+            object_name + "::d_shock_capturing_reconstructor",
+            dim,
+            grid_geometry,
+            num_eqn,
+            flow_model_type,
+            flow_model,
+            convective_flux_reconstructor_db));
+    }
+    else if (d_shock_capturing_scheme_str == "WCNS5_Z_HLLC_HLL")
+    {
+        d_shock_capturing_reconstructor.reset(new ConvectiveFluxReconstructorWCNS5_Z_HLLC_HLL(
+            object_name + "::d_shock_capturing_reconstructor",
+            dim,
+            grid_geometry,
+            num_eqn,
+            flow_model_type,
+            flow_model,
+            convective_flux_reconstructor_db));
+    }
+    else if (d_shock_capturing_scheme_str == "WCNS6_CU_M2_HLLC_HLL")
+    {
+        d_shock_capturing_reconstructor.reset(new ConvectiveFluxReconstructorWCNS6_CU_M2_HLLC_HLL(
+            object_name + "::d_shock_capturing_reconstructor",
+            dim,
+            grid_geometry,
+            num_eqn,
+            flow_model_type,
+            flow_model,
+            convective_flux_reconstructor_db));
+    }
+    else if (d_shock_capturing_scheme_str == "WCNS6_LD_HLLC_HLL")
+    {
+        d_shock_capturing_reconstructor.reset(new ConvectiveFluxReconstructorWCNS6_LD_HLLC_HLL(
+            object_name + "::d_shock_capturing_reconstructor",
+            dim,
+            grid_geometry,
+            num_eqn,
+            flow_model_type,
+            flow_model,
+            convective_flux_reconstructor_db));
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "Unknown shock_capturing_scheme string = '"
+            << d_shock_capturing_scheme_str
+            << "' found in input."
+            << std::endl);
+    }
+    
+    /*
+     * The shock sensor takes the derivatives of velocity on the cells within d_shock_band_width + 1
+     * cells from the interior of patch.
+     */
+    
+    d_num_conv_ghosts = hier::IntVector::max(
+        d_central_reconstructor->getConvectiveFluxNumberOfGhostCells(),
+        d_shock_capturing_reconstructor->getConvectiveFluxNumberOfGhostCells());
+    
+    d_num_conv_ghosts = hier::IntVector::max(
+        d_num_conv_ghosts,
+        hier::IntVector::getOne(d_dim)*(d_shock_band_width + 2));
+    
+    t_compute_shock_band = tbox::TimerManager::getManager()->
+        getTimer("ConvectiveFluxReconstructorHybridKEP_WCNS::t_compute_shock_band");
+    
+    t_blend_flux = tbox::TimerManager::getManager()->
+        getTimer("ConvectiveFluxReconstructorHybridKEP_WCNS::t_blend_flux");
+}
+
+
+ConvectiveFluxReconstructorHybridKEP_WCNS::~ConvectiveFluxReconstructorHybridKEP_WCNS()
+{
+    t_compute_shock_band.reset();
+    t_blend_flux.reset();
+}
+
+
+/*
+ * Print all characteristics of the convective flux reconstruction class.
+ */
+void
+ConvectiveFluxReconstructorHybridKEP_WCNS::printClassData(
+    std::ostream& os) const
+{
+    os << "\nPrint ConvectiveFluxReconstructorHybridKEP_WCNS object..."
+       << std::endl;
+    
+    os << std::endl;
+    
+    os << "ConvectiveFluxReconstructorHybridKEP_WCNS: this = "
+       << (ConvectiveFluxReconstructorHybridKEP_WCNS *)this
+       << std::endl;
+    os << "d_object_name = "
+       << d_object_name
+       << std::endl;
+    os << "d_shock_capturing_scheme_str = "
+       << d_shock_capturing_scheme_str
+       << std::endl;
+    os << "d_shock_sensor_threshold = "
+       << d_shock_sensor_threshold
+       << std::endl;
+    os << "d_dilatation_threshold = "
+       << d_dilatation_threshold
+       << std::endl;
+    os << "d_shock_band_width = "
+       << d_shock_band_width
+       << std::endl;
+    os << "d_print_patch_statistics = "
+       << d_print_patch_statistics
+       << std::endl;
+    
+    const unsigned long num_faces = d_num_faces_central + d_num_faces_shock_capturing;
+    
+    os << "d_num_faces_central = "
+       << d_num_faces_central
+       << " (fraction = "
+       << (num_faces > 0 ? double(d_num_faces_central)/double(num_faces) : double(0))
+       << ")"
+       << std::endl;
+    os << "d_num_faces_shock_capturing = "
+       << d_num_faces_shock_capturing
+       << " (fraction = "
+       << (num_faces > 0 ? double(d_num_faces_shock_capturing)/double(num_faces) : double(0))
+       << ")"
+       << std::endl;
+    os << "d_num_midpoints_shock_capturing = "
+       << d_num_midpoints_shock_capturing
+       << " (fraction = "
+       << (d_num_midpoints > 0 ? double(d_num_midpoints_shock_capturing)/double(d_num_midpoints) : double(0))
+       << ")"
+       << std::endl;
+    os << "d_num_patches_central_only = "
+       << d_num_patches_central_only
+       << std::endl;
+    os << "d_num_patches_hybrid = "
+       << d_num_patches_hybrid
+       << std::endl;
+    os << "d_num_patches_shock_capturing_only = "
+       << d_num_patches_shock_capturing_only
+       << std::endl;
+    
+    d_central_reconstructor->printClassData(os);
+    d_shock_capturing_reconstructor->printClassData(os);
+}
+
+
+/*
+ * Put the characteristics of the convective flux reconstruction class
+ * into the restart database.
+ */
+void
+ConvectiveFluxReconstructorHybridKEP_WCNS::putToRestart(
+   const HAMERS_SHARED_PTR<tbox::Database>& restart_db) const
+{
+    restart_db->putString("d_shock_capturing_scheme_str", d_shock_capturing_scheme_str);
+    restart_db->putDouble("d_shock_sensor_threshold", d_shock_sensor_threshold);
+    restart_db->putDouble("d_dilatation_threshold", d_dilatation_threshold);
+    restart_db->putInteger("d_shock_band_width", d_shock_band_width);
+    restart_db->putBool("d_print_patch_statistics", d_print_patch_statistics);
+    
+    d_central_reconstructor->putToRestart(restart_db);
+    d_shock_capturing_reconstructor->putToRestart(restart_db);
+}
+
+
+/*
+ * Compute the convective flux and source due to splitting of convective term on a patch.
+ */
+void
+ConvectiveFluxReconstructorHybridKEP_WCNS::computeConvectiveFluxAndSourceOnPatch(
+    hier::Patch& patch,
+    const HAMERS_SHARED_PTR<pdat::SideVariable<double> >& variable_convective_flux,
+    const HAMERS_SHARED_PTR<pdat::CellVariable<double> >& variable_source,
+    const HAMERS_SHARED_PTR<hier::VariableContext>& data_context,
+    const double time,
+    const double dt,
+    const int RK_step_number)
+{
+    const bool is_first_worker = isFirstWorker();
+    
+    // Get the box that covers the interior of patch.
+    const hier::Box interior_box = patch.getBox();
+    
+    // Get the side data of convective flux.
+    HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux(
+        HAMERS_SHARED_PTR_CAST<pdat::SideData<double>, hier::PatchData>(
+            patch.getPatchData(variable_convective_flux, data_context)));
+    
+    // Get the cell data of source.
+    HAMERS_SHARED_PTR<pdat::CellData<double> > source(
+        HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
+            patch.getPatchData(variable_source, data_context)));
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(convective_flux);
+    TBOX_ASSERT(convective_flux->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
+    
+    TBOX_ASSERT(source);
+    TBOX_ASSERT(source->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
+#endif
+    
+    /*
+     * Compute the shock band and mark the faces inside the shock band.
+     */
+    
+    if (is_first_worker)
+    {
+        t_compute_shock_band->start();
+    }
+    
+    HAMERS_SHARED_PTR<pdat::CellData<double> > shock_band;
+    
+    computeShockBand(shock_band, patch, data_context);
+    
+    HAMERS_SHARED_PTR<pdat::SideData<int> > shock_band_faces(
+        d_scratch_arena->getSideDataOfIntegers(interior_box, 1, hier::IntVector::getZero(d_dim)));
+    
+    int num_faces_shock_capturing = 0;
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        num_faces_shock_capturing = computeShockBandFaces<1>(shock_band_faces, shock_band);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        num_faces_shock_capturing = computeShockBandFaces<2>(shock_band_faces, shock_band);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        num_faces_shock_capturing = computeShockBandFaces<3>(shock_band_faces, shock_band);
+    }
+    
+    const hier::IntVector interior_dims = interior_box.numberCells();
+    
+    std::vector<int> num_faces_dir(d_dim.getValue(), 1);
+    int num_faces = 0;
+    int num_midpoints = 0;
+    for (int di = 0; di < d_dim.getValue(); di++)
+    {
+        // The mid-points of the WCNS scheme extend one face beyond the patch on both sides.
+        int num_midpoints_dir = 1;
+        for (int dj = 0; dj < d_dim.getValue(); dj++)
+        {
+            num_faces_dir[di] *= (dj == di ? interior_dims[dj] + 1 : interior_dims[dj]);
+            num_midpoints_dir *= (dj == di ? interior_dims[dj] + 3 : interior_dims[dj]);
+        }
+        num_faces += num_faces_dir[di];
+        num_midpoints += num_midpoints_dir;
+    }
+    
+    int num_midpoints_shock_capturing = 0;
+    
+    if (is_first_worker)
+    {
+        t_compute_shock_band->stop();
+    }
+    
+    /*
+     * Compute the flux and source with the central scheme only, the shock-capturing scheme only or
+     * both of the schemes.
+     */
+    
+    if (num_faces_shock_capturing == 0)
+    {
+        d_central_reconstructor->computeConvectiveFluxAndSourceOnPatch(
+            patch,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
+        
+        d_num_patches_central_only++;
+    }
+    else if (num_faces_shock_capturing == num_faces)
+    {
+        d_shock_capturing_reconstructor->computeConvectiveFluxAndSourceOnPatch(
+            patch,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
+        
+        num_midpoints_shock_capturing = num_midpoints;
+        
+        d_num_patches_shock_capturing_only++;
+    }
+    else
+    {
+        const int num_eqn_source = source->getDepth();
+        
+        /*
+         * Both schemes add their contributions to the source. Keep the source before the contributions
+         * are added and the flux and source of the shock-capturing scheme.
+         */
+        
+        HAMERS_SHARED_PTR<pdat::CellData<double> > source_initial(
+            d_scratch_arena->getCellData(interior_box, num_eqn_source, hier::IntVector::getZero(d_dim)));
+        
+        HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux_shock_capturing(
+            d_scratch_arena->getSideData(interior_box, d_num_eqn, hier::IntVector::getZero(d_dim)));
+        
+        HAMERS_SHARED_PTR<pdat::CellData<double> > source_shock_capturing(
+            d_scratch_arena->getCellData(interior_box, num_eqn_source, hier::IntVector::getZero(d_dim)));
+        
+        HAMERS_SHARED_PTR<pdat::CellData<double> > shock_band_interior(
+            d_scratch_arena->getCellData(interior_box, 1, hier::IntVector::getZero(d_dim)));
+        
+        /*
+         * Restrict the WENO interpolation and the Riemann solver of the shock-capturing scheme to the
+         * mid-points needed by the faces inside the shock band.
+         */
+        
+        HAMERS_SHARED_PTR<pdat::SideData<int> > shock_band_midpoints(
+            d_scratch_arena->getSideDataOfIntegers(interior_box, 1, hier::IntVector::getOne(d_dim)));
+        
+        if (d_dim == tbox::Dimension(1))
+        {
+            num_midpoints_shock_capturing =
+                computeShockBandMidpoints<1>(shock_band_midpoints, shock_band_faces);
+        }
+        else if (d_dim == tbox::Dimension(2))
+        {
+            num_midpoints_shock_capturing =
+                computeShockBandMidpoints<2>(shock_band_midpoints, shock_band_faces);
+        }
+        else if (d_dim == tbox::Dimension(3))
+        {
+            num_midpoints_shock_capturing =
+                computeShockBandMidpoints<3>(shock_band_midpoints, shock_band_faces);
+        }
+        
+        d_shock_capturing_reconstructor->setMidpointMask(shock_band_midpoints);
+        
+        source_initial->copy(*source);
+        
+        d_shock_capturing_reconstructor->computeConvectiveFluxAndSourceOnPatch(
+            patch,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
+        
+        convective_flux_shock_capturing->copy(*convective_flux);
+        source_shock_capturing->copy(*source);
+        
+        source->copy(*source_initial);
+        
+        d_central_reconstructor->computeConvectiveFluxAndSourceOnPatch(
+            patch,
+            variable_convective_flux,
+            variable_source,
+            data_context,
+            time,
+            dt,
+            RK_step_number);
+        
+        /*
+         * Take the flux of the shock-capturing scheme on the faces inside the shock band and the source
+         * of the shock-capturing scheme on the cells inside the shock band.
+         */
+        
+        if (is_first_worker)
+        {
+            t_blend_flux->start();
+        }
+        
+        for (int di = 0; di < d_dim.getValue(); di++)
+        {
+            const int* const flag = shock_band_faces->getPointer(di);
+            
+            for (int ei = 0; ei < d_num_eqn; ei++)
+            {
+                double* F = convective_flux->getPointer(di, ei);
+                const double* const F_shock_capturing = convective_flux_shock_capturing->getPointer(di, ei);
+                
+#ifdef HAMERS_ENABLE_SIMD
+                #pragma omp simd
+#endif
+                for (int idx_face = 0; idx_face < num_faces_dir[di]; idx_face++)
+                {
+                    F[idx_face] = (flag[idx_face] == 1 ? F_shock_capturing[idx_face] : F[idx_face]);
+                }
+            }
+        }
+        
+        shock_band_interior->copy(*shock_band);
+        
+        const int num_cells = interior_box.size();
+        
+        const double* const band = shock_band_interior->getPointer(0);
+        
+        for (int ei = 0; ei < num_eqn_source; ei++)
+        {
+            double* S = source->getPointer(ei);
+            const double* const S_shock_capturing = source_shock_capturing->getPointer(ei);
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int idx_cell = 0; idx_cell < num_cells; idx_cell++)
+            {
+                S[idx_cell] = (band[idx_cell] > double(0) ? S_shock_capturing[idx_cell] : S[idx_cell]);
+            }
+        }
+        
+        if (is_first_worker)
+        {
+            t_blend_flux->stop();
+        }
+        
+        d_num_patches_hybrid++;
+    }
+    
+    /*
+     * Update the statistics of the faces using each scheme.
+     */
+    
+    d_num_faces_central += static_cast<unsigned long>(num_faces - num_faces_shock_capturing);
+    d_num_faces_shock_capturing += static_cast<unsigned long>(num_faces_shock_capturing);
+    d_num_midpoints += static_cast<unsigned long>(num_midpoints);
+    d_num_midpoints_shock_capturing += static_cast<unsigned long>(num_midpoints_shock_capturing);
+    
+    if (d_print_patch_statistics)
+    {
+        // The patches of different workers are logged one at a time.
+#ifdef _OPENMP
+#pragma omp critical (ConvectiveFluxReconstructorHybridKEP_WCNS_statistics)
+#endif
+        {
+            tbox::plog << d_object_name
+                       << ": patch "
+                       << interior_box
+                       << ": fraction of faces using KEP = "
+                       << double(num_faces - num_faces_shock_capturing)/double(num_faces)
+                       << ", fraction of faces using "
+                       << d_shock_capturing_scheme_str
+                       << " = "
+                       << double(num_faces_shock_capturing)/double(num_faces)
+                       << ", fraction of mid-points using "
+                       << d_shock_capturing_scheme_str
+                       << " = "
+                       << double(num_midpoints_shock_capturing)/double(num_midpoints)
+                       << std::endl;
+        }
+    }
+    
+    d_scratch_arena->reset();
+}
+
+
+/*
+ * Compute the cell data of the shock band on a patch. The shock band is one at the cells within
+ * d_shock_band_width cells from a cell marked by the shock sensor and zero elsewhere.
+ */
+void
+ConvectiveFluxReconstructorHybridKEP_WCNS::computeShockBand(
+    HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band,
+    hier::Patch& patch,
+    const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
+{
+    // Get the box that covers the interior of patch.
+    const hier::Box interior_box = patch.getBox();
+    
+    // Get the grid spacing.
+    const HAMERS_SHARED_PTR<geom::CartesianPatchGeometry> patch_geom(
+        HAMERS_SHARED_PTR_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
+            patch.getPatchGeometry()));
+    
+    const double* const dx = patch_geom->getDx();
+    
+    double dx_min = dx[0];
+    for (int di = 1; di < d_dim.getValue(); di++)
+    {
+        dx_min = std::min(dx_min, dx[di]);
+    }
+    
+    /*
+     * The shock sensor is needed on the cells within d_shock_band_width cells from the cells next to
+     * the faces of the patch.
+     */
+    
+    const hier::IntVector num_ghosts_shock_sensor = hier::IntVector::getOne(d_dim)*(d_shock_band_width + 1);
+    
+    /*
+     * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
+     */
+    
+    d_flow_model->registerPatchWithDataContext(patch, data_context);
+    
+    std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+    
+    num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>(
+        "VELOCITY", num_ghosts_shock_sensor + hier::IntVector::getOne(d_dim)));
+    num_subghosts_of_data.insert(std::pair<std::string, hier::IntVector>(
+        "SOUND_SPEED", num_ghosts_shock_sensor));
+    
+    d_flow_model->registerDerivedVariables(num_subghosts_of_data);
+    
+    d_flow_model->allocateMemoryForDerivedCellData();
+    
+    d_flow_model->computeDerivedCellData();
+    
+    HAMERS_SHARED_PTR<pdat::CellData<double> > velocity = d_flow_model->getCellData("VELOCITY");
+    HAMERS_SHARED_PTR<pdat::CellData<double> > sound_speed = d_flow_model->getCellData("SOUND_SPEED");
+    
+    /*
+     * Allocate temporary patch data. All of them have the same ghost box so that they share the same
+     * linear indices.
+     */
+    
+    HAMERS_SHARED_PTR<pdat::CellData<double> > velocity_derivatives(
+        d_scratch_arena->getCellData(interior_box, d_dim.getValue()*d_dim.getValue(), num_ghosts_shock_sensor));
+    
+    HAMERS_SHARED_PTR<pdat::CellData<double> > sound_speed_shock_sensor(
+        d_scratch_arena->getCellData(interior_box, 1, num_ghosts_shock_sensor));
+    
+    HAMERS_SHARED_PTR<pdat::CellData<double> > shock_marker(
+        d_scratch_arena->getCellData(interior_box, 1, num_ghosts_shock_sensor));
+    
+    HAMERS_SHARED_PTR<pdat::CellData<double> > shock_marker_dilated(
+        d_scratch_arena->getCellData(interior_box, 1, num_ghosts_shock_sensor));
+    
+    sound_speed_shock_sensor->copy(*sound_speed);
+    
+    /*
+     * Compute the derivatives of velocity. The derivative of the vi-th component of velocity in the
+     * dj-th direction is stored at depth vi*d_dim + dj.
+     */
+    
+    std::vector<HAMERS_SHARED_PTR<DerivativeFirstOrder> > derivative_first_order;
+    derivative_first_order.reserve(d_dim.getValue());
+    
+    derivative_first_order.push_back(HAMERS_SHARED_PTR<DerivativeFirstOrder>(
+        new DerivativeFirstOrder("first order derivative in x-direction", d_dim, DIRECTION::X_DIRECTION, 1)));
+    
+    if (d_dim > tbox::Dimension(1))
+    {
+        derivative_first_order.push_back(HAMERS_SHARED_PTR<DerivativeFirstOrder>(
+            new DerivativeFirstOrder("first order derivative in y-direction", d_dim, DIRECTION::Y_DIRECTION, 1)));
+    }
+    
+    if (d_dim > tbox::Dimension(2))
+    {
+        derivative_first_order.push_back(HAMERS_SHARED_PTR<DerivativeFirstOrder>(
+            new DerivativeFirstOrder("first order derivative in z-direction", d_dim, DIRECTION::Z_DIRECTION, 1)));
+    }
+    
+    for (int vi = 0; vi < d_dim.getValue(); vi++)
+    {
+        for (int dj = 0; dj < d_dim.getValue(); dj++)
+        {
+            derivative_first_order[dj]->computeDerivative(
+                velocity_derivatives,
+                velocity,
+                dx[dj],
+                vi*d_dim.getValue() + dj,
+                vi);
+        }
+    }
+    
+    d_flow_model->unregisterPatch();
+    
+    /*
+     * Mark the cells where the Ducros-like sensor is above the threshold and the flow is strongly
+     * compressed relative to the sound speed over a grid cell.
+     */
+    
+    const int num_cells = shock_marker->getGhostBox().size();
+    
+    const double shock_sensor_threshold = d_shock_sensor_threshold;
+    const double dilatation_threshold = d_dilatation_threshold/dx_min;
+    
+    double* c    = sound_speed_shock_sensor->getPointer(0);
+    double* mark = shock_marker->getPointer(0);
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        double* dudx = velocity_derivatives->getPointer(0);
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx = 0; idx < num_cells; idx++)
+        {
+            const double theta = dudx[idx];
+            const double s = -theta/(fabs(theta) + EPSILON);
+            
+            mark[idx] = (s > shock_sensor_threshold && -theta > dilatation_threshold*c[idx]) ?
+                double(1) : double(0);
+        }
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        double* dudx = velocity_derivatives->getPointer(0);
+        double* dudy = velocity_derivatives->getPointer(1);
+        double* dvdx = velocity_derivatives->getPointer(2);
+        double* dvdy = velocity_derivatives->getPointer(3);
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx = 0; idx < num_cells; idx++)
+        {
+            const double theta = dudx[idx] + dvdy[idx];
+            const double Omega = fabs(dvdx[idx] - dudy[idx]);
+            const double s = -theta/(fabs(theta) + Omega + EPSILON);
+            
+            mark[idx] = (s > shock_sensor_threshold && -theta > dilatation_threshold*c[idx]) ?
+                double(1) : double(0);
+        }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        double* dudx = velocity_derivatives->getPointer(0);
+        double* dudy = velocity_derivatives->getPointer(1);
+        double* dudz = velocity_derivatives->getPointer(2);
+        double* dvdx = velocity_derivatives->getPointer(3);
+        double* dvdy = velocity_derivatives->getPointer(4);
+        double* dvdz = velocity_derivatives->getPointer(5);
+        double* dwdx = velocity_derivatives->getPointer(6);
+        double* dwdy = velocity_derivatives->getPointer(7);
+        double* dwdz = velocity_derivatives->getPointer(8);
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx = 0; idx < num_cells; idx++)
+        {
+            const double theta = dudx[idx] + dvdy[idx] + dwdz[idx];
+            
+            const double omega_x = dwdy[idx] - dvdz[idx];
+            const double omega_y = dudz[idx] - dwdx[idx];
+            const double omega_z = dvdx[idx] - dudy[idx];
+            
+            const double Omega = sqrt(omega_x*omega_x + omega_y*omega_y + omega_z*omega_z);
+            const double s = -theta/(fabs(theta) + Omega + EPSILON);
+            
+            mark[idx] = (s > shock_sensor_threshold && -theta > dilatation_threshold*c[idx]) ?
+                double(1) : double(0);
+        }
+    }
+    
+    /*
+     * Extend the marked cells to the shock band one direction at a time.
+     */
+    
+    if (d_shock_band_width > 0)
+    {
+        for (int di = 0; di < d_dim.getValue(); di++)
+        {
+            if (d_dim == tbox::Dimension(1))
+            {
+                dilateShockBand<1>(shock_marker_dilated, shock_marker, di);
+            }
+            else if (d_dim == tbox::Dimension(2))
+            {
+                dilateShockBand<2>(shock_marker_dilated, shock_marker, di);
+            }
+            else if (d_dim == tbox::Dimension(3))
+            {
+                dilateShockBand<3>(shock_marker_dilated, shock_marker, di);
+            }
+            shock_marker.swap(shock_marker_dilated);
+        }
+    }
+    
+    shock_band = shock_marker;
+}
+
+
+/*
+ * Extend the marked cells by d_shock_band_width cells in a direction. The loops are padded to three
+ * dimensions and the padding is resolved at compile time through the number of dimensions DIM.
+ */
+template<int DIM>
+void
+ConvectiveFluxReconstructorHybridKEP_WCNS::dilateShockBand(
+    HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band_dilated,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band,
+    const int direction) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(shock_band_dilated->getGhostBox().isSpatiallyEqual(shock_band->getGhostBox()));
+#endif
+    
+    const hier::IntVector ghostcell_dims = shock_band->getGhostBox().numberCells();
+    
+    // Pad the dimensions to three dimensions.
+    int dims[3] = {1, 1, 1};
+    for (int di = 0; di < DIM; di++)
+    {
+        dims[di] = ghostcell_dims[di];
+    }
+    
+    int stride = 1;
+    for (int di = 0; di < direction; di++)
+    {
+        stride *= dims[di];
+    }
+    
+    const int width = d_shock_band_width;
+    const int dim_dir = dims[direction];
+    
+    const double* const band = shock_band->getPointer(0);
+    double* band_dilated = shock_band_dilated->getPointer(0);
+    
+    for (int k = 0; k < dims[2]; k++)
+    {
+        for (int j = 0; j < dims[1]; j++)
+        {
+            for (int i = 0; i < dims[0]; i++)
+            {
+                // Compute the linear index.
+                const int idx = i + j*dims[0] + k*dims[0]*dims[1];
+                
+                const int idx_dir = (direction == 0 ? i : (direction == 1 ? j : k));
+                
+                const int m_lo = std::max(-width, -idx_dir);
+                const int m_hi = std::min(width, dim_dir - 1 - idx_dir);
+                
+                double value = double(0);
+                for (int m = m_lo; m <= m_hi; m++)
+                {
+                    value = std::max(value, band[idx + m*stride]);
+                }
+                
+                band_dilated[idx] = value;
+            }
+        }
+    }
+}
+
+
+/*
+ * Mark the faces that use the flux of the WCNS scheme and return the number of marked faces.
+ * A face is marked if any of its two neighboring cells is inside the shock band. DIM is the number of
+ * dimensions of the problem.
+ */
+template<int DIM>
+int
+ConvectiveFluxReconstructorHybridKEP_WCNS::computeShockBandFaces(
+    HAMERS_SHARED_PTR<pdat::SideData<int> >& shock_band_faces,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& shock_band) const
+{
+    const hier::IntVector interior_dims = shock_band->getBox().numberCells();
+    const hier::IntVector num_ghosts = shock_band->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims = shock_band->getGhostBox().numberCells();
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(num_ghosts >= hier::IntVector::getOne(d_dim));
+#endif
+    
+    const double* const band = shock_band->getPointer(0);
+    
+    int num_faces_marked = 0;
+    
+    for (int di = 0; di < DIM; di++)
+    {
+        // Pad the dimensions and number of ghost cells to three dimensions.
+        int face_dims[3] = {1, 1, 1};
+        int cell_dims[3] = {1, 1, 1};
+        int cell_ghosts[3] = {0, 0, 0};
+        for (int dj = 0; dj < DIM; dj++)
+        {
+            face_dims[dj] = (dj == di ? interior_dims[dj] + 1 : interior_dims[dj]);
+            cell_dims[dj] = ghostcell_dims[dj];
+            cell_ghosts[dj] = num_ghosts[dj];
+        }
+        
+        int stride = 1;
+        for (int dj = 0; dj < di; dj++)
+        {
+            stride *= cell_dims[dj];
+        }
+        
+        int* flag = shock_band_faces->getPointer(di);
+        
+        for (int k = 0; k < face_dims[2]; k++)
+        {
+            for (int j = 0; j < face_dims[1]; j++)
+            {
+                for (int i = 0; i < face_dims[0]; i++)
+                {
+                    // Compute the linear indices. The face is between the cells L and R.
+                    const int idx_face = i + j*face_dims[0] + k*face_dims[0]*face_dims[1];
+                    
+                    const int idx_cell_R = (i + cell_ghosts[0]) +
+                        (j + cell_ghosts[1])*cell_dims[0] +
+                        (k + cell_ghosts[2])*cell_dims[0]*cell_dims[1];
+                    
+                    const int idx_cell_L = idx_cell_R - stride;
+                    
+                    flag[idx_face] = (band[idx_cell_L] > double(0) || band[idx_cell_R] > double(0)) ? 1 : 0;
+                    
+                    num_faces_marked += flag[idx_face];
+                }
+            }
+        }
+    }
+    
+    return num_faces_marked;
+}
+
+
+/*
+ * Mark the mid-points in the stencils of the fluxes on the marked faces, which are the mid-points
+ * within one mid-point from a marked face in the direction normal to the face, and return the number
+ * of marked mid-points. DIM is the number of dimensions of the problem.
+ */
+template<int DIM>
+int
+ConvectiveFluxReconstructorHybridKEP_WCNS::computeShockBandMidpoints(
+    HAMERS_SHARED_PTR<pdat::SideData<int> >& shock_band_midpoints,
+    const HAMERS_SHARED_PTR<pdat::SideData<int> >& shock_band_faces) const
+{
+    const hier::IntVector interior_dims = shock_band_faces->getBox().numberCells();
+    const hier::IntVector num_ghosts = shock_band_midpoints->getGhostCellWidth();
+    const hier::IntVector ghostcell_dims = shock_band_midpoints->getGhostBox().numberCells();
+    
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(shock_band_faces->getGhostCellWidth() == hier::IntVector::getZero(d_dim));
+    TBOX_ASSERT(num_ghosts >= hier::IntVector::getOne(d_dim));
+#endif
+    
+    shock_band_midpoints->fillAll(0);
+    
+    int num_midpoints_marked = 0;
+    
+    for (int di = 0; di < DIM; di++)
+    {
+        // Pad the dimensions and number of ghost cells to three dimensions.
+        int face_dims[3] = {1, 1, 1};
+        int midpoint_dims[3] = {1, 1, 1};
+        int midpoint_ghosts[3] = {0, 0, 0};
+        for (int dj = 0; dj < DIM; dj++)
+        {
+            face_dims[dj] = (dj == di ? interior_dims[dj] + 1 : interior_dims[dj]);
+            midpoint_dims[dj] = (dj == di ? ghostcell_dims[dj] + 1 : ghostcell_dims[dj]);
+            midpoint_ghosts[dj] = num_ghosts[dj];
+        }
+        
+        int stride = 1;
+        for (int dj = 0; dj < di; dj++)
+        {
+            stride *= midpoint_dims[dj];
+        }
+        
+        const int* const flag = shock_band_faces->getPointer(di);
+        int* mask = shock_band_midpoints->getPointer(di);
+        
+        for (int k = 0; k < face_dims[2]; k++)
+        {
+            for (int j = 0; j < face_dims[1]; j++)
+            {
+                for (int i = 0; i < face_dims[0]; i++)
+                {
+                    // Compute the linear indices of the face and of the mid-point at the face.
+                    const int idx_face = i + j*face_dims[0] + k*face_dims[0]*face_dims[1];
+                    
+                    const int idx_midpoint = (i + midpoint_ghosts[0]) +
+                        (j + midpoint_ghosts[1])*midpoint_dims[0] +
+                        (k + midpoint_ghosts[2])*midpoint_dims[0]*midpoint_dims[1];
+                    
+                    if (flag[idx_face] == 1)
+                    {
+                        // Count the mid-points that are not marked yet by the previous face.
+                        num_midpoints_marked += (1 - mask[idx_midpoint - stride]) +
+                            (1 - mask[idx_midpoint]) + (1 - mask[idx_midpoint + stride]);
+                        
+                        mask[idx_midpoint - stride] = 1;
+                        mask[idx_midpoint] = 1;
+                        mask[idx_midpoint + stride] = 1;
+                    }
+                }
+            }
+        }
+    }
+    
+    return num_midpoints_marked;
+}
@@ -2,6 +2,7 @@
 
 #include "SAMRAI/geom/CartesianPatchGeometry.h"
 
+#include <algorithm>
 #include <map>
 
 DiffusiveFluxReconstructorMidpoint::DiffusiveFluxReconstructorMidpoint(
@@ -812,24 +813,6 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
     } // if (d_dim == tbox::Dimension(2))
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the dimensions and number of ghost cells.
-         */
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
-        const int num_diff_ghosts_1 = d_num_diff_ghosts[1];
-        const int num_diff_ghosts_2 = d_num_diff_ghosts[2];
-        const int diff_ghostcell_dim_0 = diff_ghostcell_dims[0];
-        const int diff_ghostcell_dim_1 = diff_ghostcell_dims[1];
-        
-        const int num_flux_reconstruct_ghosts_0 = d_num_flux_reconstruct_ghosts[0];
-        const int num_flux_reconstruct_ghosts_1 = d_num_flux_reconstruct_ghosts[1];
-        const int num_flux_reconstruct_ghosts_2 = d_num_flux_reconstruct_ghosts[2];
-        
         /*
          * Register the patch and derived cell variables in the flow model and compute the corresponding cell data.
          */
@@ -884,15 +867,7 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
         std::vector<std::vector<int> > diffusivities_component_idx_z;
         
         std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_x_midpoint_x;
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_y_midpoint_x;
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_z_midpoint_x;
-        
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_x_midpoint_y;
         std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_y_midpoint_y;
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_z_midpoint_y;
-        
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_x_midpoint_z;
-        std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_y_midpoint_z;
         std::vector<std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > > derivatives_z_midpoint_z;
         
         std::vector<std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > > derivatives_x_node;
@@ -1386,15 +1361,6 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             patch,
             allocate_scratch_data_containers);
         
-        interpolateDerivativesFromNodeToMidpointX(
-            derivatives_y_midpoint_x,
-            derivatives_y_midpoint_x_computed,
-            derivatives_y_node,
-            var_data_y,
-            var_component_idx_y,
-            patch,
-            allocate_scratch_data_containers);
-        
         /*
          * Compute the derivatives in z-direction for diffusive flux in x-direction.
          */
@@ -1407,17 +1373,10 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             patch,
             allocate_scratch_data_containers);
         
-        interpolateDerivativesFromNodeToMidpointX(
-            derivatives_z_midpoint_x,
-            derivatives_z_midpoint_x_computed,
-            derivatives_z_node,
-            var_data_z,
-            var_component_idx_z,
-            patch,
-            allocate_scratch_data_containers);
-        
         /*
-         * Compute diffusive flux in x-direction at midpoints.
+         * Compute diffusive flux in x-direction at midpoints. The products of the diffusivities and
+         * derivatives of all variables are accumulated together on each line of midpoints. The derivatives
+         * in the other directions are interpolated from the nodes to the midpoints on each line.
          */
         
         for (int ei = 0; ei < d_num_eqn; ei++)
@@ -1428,182 +1387,55 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_x[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(0, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivatives_x_midpoint_x[ei][vi]->getPointer(0, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -num_subghosts_0_diffusivity + num_flux_reconstruct_ghosts_0;
-                            i < (interior_dim_0 + 1) + num_subghosts_0_diffusivity - num_flux_reconstruct_ghosts_0;
-                            i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*(diff_ghostcell_dim_0 + 1) +
-                                (k + num_diff_ghosts_2)*(diff_ghostcell_dim_0 + 1)*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*(subghostcell_dim_0_diffusivity + 1) +
-                                (k + num_subghosts_2_diffusivity)*(subghostcell_dim_0_diffusivity + 1)*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_midpoint_x[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivatives_y_midpoint_x[ei].size()) ==
+            TBOX_ASSERT(static_cast<int>(derivatives_y_node[ei].size()) ==
                         static_cast<int>(diffusivities_data_y[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_y[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(0, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivatives_y_midpoint_x[ei][vi]->getPointer(0, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -num_subghosts_0_diffusivity + num_flux_reconstruct_ghosts_0;
-                            i < (interior_dim_0 + 1) + num_subghosts_0_diffusivity - num_flux_reconstruct_ghosts_0;
-                            i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*(diff_ghostcell_dim_0 + 1) +
-                                (k + num_diff_ghosts_2)*(diff_ghostcell_dim_0 + 1)*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*(subghostcell_dim_0_diffusivity + 1) +
-                                (k + num_subghosts_2_diffusivity)*(subghostcell_dim_0_diffusivity + 1)*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_midpoint_x[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivatives_z_midpoint_x[ei].size()) ==
+            TBOX_ASSERT(static_cast<int>(derivatives_z_node[ei].size()) ==
                         static_cast<int>(diffusivities_data_z[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_z[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_z[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_z[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_z[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_z[ei][vi]->getPointer(0, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudz = derivatives_z_midpoint_x[ei][vi]->getPointer(0, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -num_subghosts_0_diffusivity + num_flux_reconstruct_ghosts_0;
-                            i < (interior_dim_0 + 1) + num_subghosts_0_diffusivity - num_flux_reconstruct_ghosts_0;
-                            i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*(diff_ghostcell_dim_0 + 1) +
-                                (k + num_diff_ghosts_2)*(diff_ghostcell_dim_0 + 1)*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*(subghostcell_dim_0_diffusivity + 1) +
-                                (k + num_subghosts_2_diffusivity)*(subghostcell_dim_0_diffusivity + 1)*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_midpoint_x[ei][idx] += mu[idx_diffusivity]*dudz[idx];
-                        }
-                    }
-                }
-            }
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > diffusivities_data;
+            std::vector<int> diffusivities_component_idx;
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > derivatives_midpoint;
+            std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > derivatives_node;
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_x[ei].begin(), diffusivities_data_x[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_x[ei].begin(), diffusivities_component_idx_x[ei].end());
+            derivatives_midpoint.insert(derivatives_midpoint.end(),
+                derivatives_x_midpoint_x[ei].begin(), derivatives_x_midpoint_x[ei].end());
+            derivatives_node.resize(derivatives_node.size() + derivatives_x_midpoint_x[ei].size());
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_y[ei].begin(), diffusivities_data_y[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_y[ei].begin(), diffusivities_component_idx_y[ei].end());
+            derivatives_midpoint.resize(derivatives_midpoint.size() + derivatives_y_node[ei].size());
+            derivatives_node.insert(derivatives_node.end(),
+                derivatives_y_node[ei].begin(), derivatives_y_node[ei].end());
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_z[ei].begin(), diffusivities_data_z[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_z[ei].begin(), diffusivities_component_idx_z[ei].end());
+            derivatives_midpoint.resize(derivatives_midpoint.size() + derivatives_z_node[ei].size());
+            derivatives_node.insert(derivatives_node.end(),
+                derivatives_z_node[ei].begin(), derivatives_z_node[ei].end());
+            
+            accumulateDiffusiveFluxAtMidpoints3D(
+                F_midpoint_x[ei],
+                diffusivities_data,
+                diffusivities_component_idx,
+                derivatives_midpoint,
+                derivatives_node,
+                DIRECTION::X_DIRECTION,
+                interior_box);
         }
         
         /*
@@ -1633,8 +1465,6 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
         diffusivities_component_idx_z.clear();
         
         derivatives_x_midpoint_x.clear();
-        derivatives_y_midpoint_x.clear();
-        derivatives_z_midpoint_x.clear();
         
         derivatives_y_node.clear();
         derivatives_z_node.clear();
@@ -1706,15 +1536,6 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             patch,
             allocate_scratch_data_containers);
         
-        interpolateDerivativesFromNodeToMidpointY(
-            derivatives_x_midpoint_y,
-            derivatives_x_midpoint_y_computed,
-            derivatives_x_node,
-            var_data_x,
-            var_component_idx_x,
-            patch,
-            allocate_scratch_data_containers);
-        
         /*
          * Compute the derivatives in y-direction for diffusive flux in y-direction.
          */
@@ -1739,203 +1560,69 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             patch,
             allocate_scratch_data_containers);
         
-        interpolateDerivativesFromNodeToMidpointY(
-            derivatives_z_midpoint_y,
-            derivatives_z_midpoint_y_computed,
-            derivatives_z_node,
-            var_data_z,
-            var_component_idx_z,
-            patch,
-            allocate_scratch_data_containers);
-        
         /*
-         * Compute diffusive flux in y-direction at midpoints.
+         * Compute diffusive flux in y-direction at midpoints. The products of the diffusivities and
+         * derivatives of all variables are accumulated together on each line of midpoints. The derivatives
+         * in the other directions are interpolated from the nodes to the midpoints on each line.
          */
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            TBOX_ASSERT(static_cast<int>(derivatives_x_midpoint_y[ei].size()) ==
+            TBOX_ASSERT(static_cast<int>(derivatives_x_node[ei].size()) ==
                         static_cast<int>(diffusivities_data_x[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_x[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(1, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivatives_x_midpoint_y[ei][vi]->getPointer(1, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = -num_subghosts_1_diffusivity + num_flux_reconstruct_ghosts_1;
-                        j < (interior_dim_1 + 1) + num_subghosts_1_diffusivity - num_flux_reconstruct_ghosts_1;
-                        j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    (diff_ghostcell_dim_1 + 1);
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    (subghostcell_dim_1_diffusivity + 1);
-                            
-                            F_midpoint_y[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                        }
-                    }
-                }
-            }
-            
             TBOX_ASSERT(static_cast<int>(derivatives_y_midpoint_y[ei].size()) ==
                         static_cast<int>(diffusivities_data_y[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_y[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(1, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivatives_y_midpoint_y[ei][vi]->getPointer(1, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = -num_subghosts_1_diffusivity + num_flux_reconstruct_ghosts_1;
-                        j < (interior_dim_1 + 1) + num_subghosts_1_diffusivity - num_flux_reconstruct_ghosts_1;
-                        j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    (diff_ghostcell_dim_1 + 1);
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    (subghostcell_dim_1_diffusivity + 1);
-                            
-                            F_midpoint_y[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivatives_z_midpoint_y[ei].size()) ==
+            TBOX_ASSERT(static_cast<int>(derivatives_z_node[ei].size()) ==
                         static_cast<int>(diffusivities_data_z[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_z[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_z[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_z[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_z[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_z[ei][vi]->getPointer(1, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudz = derivatives_z_midpoint_y[ei][vi]->getPointer(1, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = -num_subghosts_1_diffusivity + num_flux_reconstruct_ghosts_1;
-                        j < (interior_dim_1 + 1) + num_subghosts_1_diffusivity - num_flux_reconstruct_ghosts_1;
-                        j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    (diff_ghostcell_dim_1 + 1);
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    (subghostcell_dim_1_diffusivity + 1);
-                            
-                            F_midpoint_y[ei][idx] += mu[idx_diffusivity]*dudz[idx];
-                        }
-                    }
-                }
-            }
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > diffusivities_data;
+            std::vector<int> diffusivities_component_idx;
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > derivatives_midpoint;
+            std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > derivatives_node;
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_x[ei].begin(), diffusivities_data_x[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_x[ei].begin(), diffusivities_component_idx_x[ei].end());
+            derivatives_midpoint.resize(derivatives_midpoint.size() + derivatives_x_node[ei].size());
+            derivatives_node.insert(derivatives_node.end(),
+                derivatives_x_node[ei].begin(), derivatives_x_node[ei].end());
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_y[ei].begin(), diffusivities_data_y[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_y[ei].begin(), diffusivities_component_idx_y[ei].end());
+            derivatives_midpoint.insert(derivatives_midpoint.end(),
+                derivatives_y_midpoint_y[ei].begin(), derivatives_y_midpoint_y[ei].end());
+            derivatives_node.resize(derivatives_node.size() + derivatives_y_midpoint_y[ei].size());
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_z[ei].begin(), diffusivities_data_z[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_z[ei].begin(), diffusivities_component_idx_z[ei].end());
+            derivatives_midpoint.resize(derivatives_midpoint.size() + derivatives_z_node[ei].size());
+            derivatives_node.insert(derivatives_node.end(),
+                derivatives_z_node[ei].begin(), derivatives_z_node[ei].end());
+            
+            accumulateDiffusiveFluxAtMidpoints3D(
+                F_midpoint_y[ei],
+                diffusivities_data,
+                diffusivities_component_idx,
+                derivatives_midpoint,
+                derivatives_node,
+                DIRECTION::Y_DIRECTION,
+                interior_box);
         }
         
         /*
@@ -1964,9 +1651,7 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
         diffusivities_component_idx_y.clear();
         diffusivities_component_idx_z.clear();
         
-        derivatives_x_midpoint_y.clear();
         derivatives_y_midpoint_y.clear();
-        derivatives_z_midpoint_y.clear();
         
         derivatives_x_node.clear();
         derivatives_z_node.clear();
@@ -2038,15 +1723,6 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             patch,
             allocate_scratch_data_containers);
         
-        interpolateDerivativesFromNodeToMidpointZ(
-            derivatives_x_midpoint_z,
-            derivatives_x_midpoint_z_computed,
-            derivatives_x_node,
-            var_data_x,
-            var_component_idx_x,
-            patch,
-            allocate_scratch_data_containers);
-        
         /*
          * Compute the derivatives in y-direction for diffusive flux in z-direction.
          */
@@ -2059,15 +1735,6 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             patch,
             allocate_scratch_data_containers);
         
-        interpolateDerivativesFromNodeToMidpointZ(
-            derivatives_y_midpoint_z,
-            derivatives_y_midpoint_z_computed,
-            derivatives_y_node,
-            var_data_y,
-            var_component_idx_y,
-            patch,
-            allocate_scratch_data_containers);
-        
         /*
          * Compute the derivatives in z-direction for diffusive flux in z-direction.
          */
@@ -2081,193 +1748,68 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
             allocate_scratch_data_containers);
         
         /*
-         * Compute diffusive flux in z-direction at midpoints.
+         * Compute diffusive flux in z-direction at midpoints. The products of the diffusivities and
+         * derivatives of all variables are accumulated together on each line of midpoints. The derivatives
+         * in the other directions are interpolated from the nodes to the midpoints on each line.
          */
         
         for (int ei = 0; ei < d_num_eqn; ei++)
         {
-            TBOX_ASSERT(static_cast<int>(derivatives_x_midpoint_z[ei].size()) ==
+            TBOX_ASSERT(static_cast<int>(derivatives_x_node[ei].size()) ==
                         static_cast<int>(diffusivities_data_x[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_x[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_x[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_x[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_x[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_x[ei][vi]->getPointer(2, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudx = derivatives_x_midpoint_z[ei][vi]->getPointer(2, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_x[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = -num_subghosts_2_diffusivity + num_flux_reconstruct_ghosts_2;
-                    k < (interior_dim_2 + 1) + num_subghosts_2_diffusivity - num_flux_reconstruct_ghosts_2;
-                    k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_midpoint_z[ei][idx] += mu[idx_diffusivity]*dudx[idx];
-                        }
-                    }
-                }
-            }
-            
-            TBOX_ASSERT(static_cast<int>(derivatives_y_midpoint_z[ei].size()) ==
+            TBOX_ASSERT(static_cast<int>(derivatives_y_node[ei].size()) ==
                         static_cast<int>(diffusivities_data_y[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_y[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_y[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_y[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_y[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_y[ei][vi]->getPointer(2, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudy = derivatives_y_midpoint_z[ei][vi]->getPointer(2, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_y[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = -num_subghosts_2_diffusivity + num_flux_reconstruct_ghosts_2;
-                    k < (interior_dim_2 + 1) + num_subghosts_2_diffusivity - num_flux_reconstruct_ghosts_2;
-                    k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_midpoint_z[ei][idx] += mu[idx_diffusivity]*dudy[idx];
-                        }
-                    }
-                }
-            }
-            
             TBOX_ASSERT(static_cast<int>(derivatives_z_midpoint_z[ei].size()) ==
                         static_cast<int>(diffusivities_data_z[ei].size()));
             
             TBOX_ASSERT(static_cast<int>(diffusivities_data_z[ei].size()) ==
                         static_cast<int>(diffusivities_component_idx_z[ei].size()));
             
-            for (int vi = 0; vi < static_cast<int>(var_data_z[ei].size()); vi++)
-            {
-                // Get the index of variable for derivative.
-                const int mu_idx = diffusivities_component_idx_z[ei][vi];
-                
-                // Get the pointer to diffusivity.
-                double* mu = diffusivities_data_z[ei][vi]->getPointer(2, mu_idx);
-                
-                // Get the pointer to derivative.
-                double* dudz = derivatives_z_midpoint_z[ei][vi]->getPointer(2, 0);
-                
-                /*
-                 * Get the sub-ghost cell width and ghost box dimensions of the diffusivity.
-                 */
-                
-                hier::IntVector num_subghosts_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostCellWidth();
-                
-                hier::IntVector subghostcell_dims_diffusivity =
-                    diffusivities_data_z[ei][vi]->getGhostBox().numberCells();
-                
-                const int num_subghosts_0_diffusivity = num_subghosts_diffusivity[0];
-                const int num_subghosts_1_diffusivity = num_subghosts_diffusivity[1];
-                const int num_subghosts_2_diffusivity = num_subghosts_diffusivity[2];
-                const int subghostcell_dim_0_diffusivity = subghostcell_dims_diffusivity[0];
-                const int subghostcell_dim_1_diffusivity = subghostcell_dims_diffusivity[1];
-                
-                for (int k = -num_subghosts_2_diffusivity + num_flux_reconstruct_ghosts_2;
-                    k < (interior_dim_2 + 1) + num_subghosts_2_diffusivity - num_flux_reconstruct_ghosts_2;
-                    k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_diff_ghosts_0) +
-                                (j + num_diff_ghosts_1)*diff_ghostcell_dim_0 +
-                                (k + num_diff_ghosts_2)*diff_ghostcell_dim_0*
-                                    diff_ghostcell_dim_1;
-                            
-                            const int idx_diffusivity = (i + num_subghosts_0_diffusivity) +
-                                (j + num_subghosts_1_diffusivity)*subghostcell_dim_0_diffusivity +
-                                (k + num_subghosts_2_diffusivity)*subghostcell_dim_0_diffusivity*
-                                    subghostcell_dim_1_diffusivity;
-                            
-                            F_midpoint_z[ei][idx] += mu[idx_diffusivity]*dudz[idx];
-                        }
-                    }
-                }
-            }
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > diffusivities_data;
+            std::vector<int> diffusivities_component_idx;
+            std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > derivatives_midpoint;
+            std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > > derivatives_node;
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_x[ei].begin(), diffusivities_data_x[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_x[ei].begin(), diffusivities_component_idx_x[ei].end());
+            derivatives_midpoint.resize(derivatives_midpoint.size() + derivatives_x_node[ei].size());
+            derivatives_node.insert(derivatives_node.end(),
+                derivatives_x_node[ei].begin(), derivatives_x_node[ei].end());
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_y[ei].begin(), diffusivities_data_y[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_y[ei].begin(), diffusivities_component_idx_y[ei].end());
+            derivatives_midpoint.resize(derivatives_midpoint.size() + derivatives_y_node[ei].size());
+            derivatives_node.insert(derivatives_node.end(),
+                derivatives_y_node[ei].begin(), derivatives_y_node[ei].end());
+            
+            diffusivities_data.insert(diffusivities_data.end(),
+                diffusivities_data_z[ei].begin(), diffusivities_data_z[ei].end());
+            diffusivities_component_idx.insert(diffusivities_component_idx.end(),
+                diffusivities_component_idx_z[ei].begin(), diffusivities_component_idx_z[ei].end());
+            derivatives_midpoint.insert(derivatives_midpoint.end(),
+                derivatives_z_midpoint_z[ei].begin(), derivatives_z_midpoint_z[ei].end());
+            derivatives_node.resize(derivatives_node.size() + derivatives_z_midpoint_z[ei].size());
+            
+            accumulateDiffusiveFluxAtMidpoints3D(
+                F_midpoint_z[ei],
+                diffusivities_data,
+                diffusivities_component_idx,
+                derivatives_midpoint,
+                derivatives_node,
+                DIRECTION::Z_DIRECTION,
+                interior_box);
         }
         
         /*
@@ -2296,8 +1838,6 @@ DiffusiveFluxReconstructorMidpoint::computeDiffusiveFluxOnPatch(
         diffusivities_component_idx_y.clear();
         diffusivities_component_idx_z.clear();
         
-        derivatives_x_midpoint_z.clear();
-        derivatives_y_midpoint_z.clear();
         derivatives_z_midpoint_z.clear();
         
         derivatives_x_node.clear();
@@ -4279,3 +3819,191 @@ DiffusiveFluxReconstructorMidpoint::reconstructFluxZ(
             dt);
     }
 }
+
+
+/*
+ * Accumulate the products of the diffusivities and the derivatives at the midpoints in a direction into the
+ * diffusive flux at the midpoints for three-dimensional problems. All the products are accumulated on one line
+ * of midpoints before moving to the next line so that the line of the flux stays in cache instead of the whole
+ * flux being streamed through memory once per product. The derivatives of a product are either given at the
+ * midpoints (derivatives_midpoint) or at the nodes (derivatives_node), the other one being null. The
+ * derivatives at the nodes are interpolated to the midpoints on the line while being accumulated so that they
+ * are never stored at the midpoints of the whole patch.
+ */
+void
+DiffusiveFluxReconstructorMidpoint::accumulateDiffusiveFluxAtMidpoints3D(
+    double* F_midpoint,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& diffusivities_data,
+    const std::vector<int>& diffusivities_component_idx,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& derivatives_midpoint,
+    const std::vector<HAMERS_SHARED_PTR<pdat::CellData<double> > >& derivatives_node,
+    const DIRECTION::TYPE& direction,
+    const hier::Box& interior_box) const
+{
+    const int num_products = static_cast<int>(diffusivities_data.size());
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(d_dim == tbox::Dimension(3));
+    TBOX_ASSERT(static_cast<int>(diffusivities_component_idx.size()) == num_products);
+    TBOX_ASSERT(static_cast<int>(derivatives_midpoint.size()) == num_products);
+    TBOX_ASSERT(static_cast<int>(derivatives_node.size()) == num_products);
+#endif
+    
+    if (num_products == 0)
+    {
+        return;
+    }
+    
+    const int dir = static_cast<int>(direction);
+    
+    // Get the dimensions of box that covers the interior of patch.
+    const hier::IntVector interior_dims = interior_box.numberCells();
+    
+    // Get the dimensions of box that covers interior of patch plus
+    // diffusive ghost cells.
+    hier::Box diff_ghost_box = interior_box;
+    diff_ghost_box.grow(d_num_diff_ghosts);
+    const hier::IntVector diff_ghostcell_dims = diff_ghost_box.numberCells();
+    
+    const int interior_dim_0 = interior_dims[0];
+    const int interior_dim_1 = interior_dims[1];
+    const int interior_dim_2 = interior_dims[2];
+    
+    const int num_diff_ghosts_0 = d_num_diff_ghosts[0];
+    const int num_diff_ghosts_1 = d_num_diff_ghosts[1];
+    const int num_diff_ghosts_2 = d_num_diff_ghosts[2];
+    
+    // The flux and the derivatives at the midpoints are side data in the direction.
+    const int stride_1_midpoint = diff_ghostcell_dims[0] + (dir == 0 ? 1 : 0);
+    const int stride_2_midpoint = stride_1_midpoint*(diff_ghostcell_dims[1] + (dir == 1 ? 1 : 0));
+    
+    // The derivatives at the nodes are cell data. The midpoint i on a line lies between the nodes i - 1 and i
+    // in the direction.
+    const int stride_1_node = diff_ghostcell_dims[0];
+    const int stride_2_node = stride_1_node*diff_ghostcell_dims[1];
+    
+    const int stride_dir_node = (dir == 0 ? 1 : (dir == 1 ? stride_1_node : stride_2_node));
+    
+    /*
+     * Get the pointers, strides and ranges of midpoints in the direction of the products. The ranges depend on
+     * the sub-ghost cell widths of the diffusivities.
+     */
+    
+    std::vector<const double*> mu(num_products);
+    std::vector<const double*> du(num_products);
+    std::vector<bool> is_du_at_node(num_products);
+    std::vector<int> offset_diffusivity(num_products);
+    std::vector<int> stride_1_diffusivity(num_products);
+    std::vector<int> stride_2_diffusivity(num_products);
+    std::vector<int> idx_lo(num_products);
+    std::vector<int> idx_hi(num_products);
+    
+    int idx_lo_min = 0;
+    int idx_hi_max = 0;
+    
+    for (int pi = 0; pi < num_products; pi++)
+    {
+        mu[pi] = diffusivities_data[pi]->getPointer(dir, diffusivities_component_idx[pi]);
+        is_du_at_node[pi] = (derivatives_midpoint[pi] == nullptr);
+        
+        if (is_du_at_node[pi])
+        {
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+            TBOX_ASSERT(derivatives_node[pi]);
+            TBOX_ASSERT(derivatives_node[pi]->getGhostCellWidth() == d_num_diff_ghosts);
+#endif
+            
+            du[pi] = derivatives_node[pi]->getPointer(0);
+        }
+        else
+        {
+            du[pi] = derivatives_midpoint[pi]->getPointer(dir, 0);
+        }
+        
+        const hier::IntVector& num_subghosts_diffusivity = diffusivities_data[pi]->getGhostCellWidth();
+        const hier::IntVector subghostcell_dims_diffusivity = diffusivities_data[pi]->getGhostBox().numberCells();
+        
+        stride_1_diffusivity[pi] = subghostcell_dims_diffusivity[0] + (dir == 0 ? 1 : 0);
+        stride_2_diffusivity[pi] = stride_1_diffusivity[pi]*
+            (subghostcell_dims_diffusivity[1] + (dir == 1 ? 1 : 0));
+        
+        offset_diffusivity[pi] = num_subghosts_diffusivity[0] +
+            num_subghosts_diffusivity[1]*stride_1_diffusivity[pi] +
+            num_subghosts_diffusivity[2]*stride_2_diffusivity[pi];
+        
+        idx_lo[pi] = -num_subghosts_diffusivity[dir] + d_num_flux_reconstruct_ghosts[dir];
+        idx_hi[pi] = (interior_dims[dir] + 1) + num_subghosts_diffusivity[dir] - d_num_flux_reconstruct_ghosts[dir];
+        
+        idx_lo_min = (pi == 0 ? idx_lo[pi] : std::min(idx_lo_min, idx_lo[pi]));
+        idx_hi_max = (pi == 0 ? idx_hi[pi] : std::max(idx_hi_max, idx_hi[pi]));
+    }
+    
+    const int k_lo = (dir == 2 ? idx_lo_min : 0);
+    const int k_hi = (dir == 2 ? idx_hi_max : interior_dim_2);
+    const int j_lo = (dir == 1 ? idx_lo_min : 0);
+    const int j_hi = (dir == 1 ? idx_hi_max : interior_dim_1);
+    
+    for (int k = k_lo; k < k_hi; k++)
+    {
+        for (int j = j_lo; j < j_hi; j++)
+        {
+            // Compute the linear index of the first midpoint of the line.
+            const int idx_line = num_diff_ghosts_0 +
+                (j + num_diff_ghosts_1)*stride_1_midpoint +
+                (k + num_diff_ghosts_2)*stride_2_midpoint;
+            
+            // Compute the linear index of the node at the first midpoint of the line.
+            const int idx_line_node = num_diff_ghosts_0 +
+                (j + num_diff_ghosts_1)*stride_1_node +
+                (k + num_diff_ghosts_2)*stride_2_node;
+            
+            double* F_line = F_midpoint + idx_line;
+            
+            for (int pi = 0; pi < num_products; pi++)
+            {
+                int i_lo = 0;
+                int i_hi = interior_dim_0;
+                
+                if (dir == 0)
+                {
+                    i_lo = idx_lo[pi];
+                    i_hi = idx_hi[pi];
+                }
+                else if (dir == 1 && (j < idx_lo[pi] || j >= idx_hi[pi]))
+                {
+                    continue;
+                }
+                else if (dir == 2 && (k < idx_lo[pi] || k >= idx_hi[pi]))
+                {
+                    continue;
+                }
+                
+                const double* const mu_line = mu[pi] + offset_diffusivity[pi] +
+                    j*stride_1_diffusivity[pi] + k*stride_2_diffusivity[pi];
+                
+                if (is_du_at_node[pi])
+                {
+                    accumulateDiffusiveFluxWithDerivativesFromNodeOnLine(
+                        F_line,
+                        mu_line,
+                        du[pi] + idx_line_node,
+                        stride_dir_node,
+                        i_lo,
+                        i_hi);
+                }
+                else
+                {
+                    const double* const du_line = du[pi] + idx_line;
+                    
+#ifdef HAMERS_ENABLE_SIMD
+                    #pragma omp simd
+#endif
+                    for (int i = i_lo; i < i_hi; i++)
+                    {
+                        F_line[i] += mu_line[i]*du_line[i];
+                    }
+                }
+            }
+        }
+    }
+}
@@ -1,9 +1,364 @@
 #include "flow/diffusive_flux_reconstructors/midpoint/DiffusiveFluxReconstructorMidpointFourthOrder.hpp"
+#include "util/Padded3DIndexing.hpp"
 
 #include "SAMRAI/geom/CartesianPatchGeometry.h"
 
 #include <map>
 
+/*
+ * Kernel to compute the derivatives in the direction di at midpoints. The number of dimensions DIM is fixed at
+ * compile time.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeFirstDerivativesAtMidpoint(
+    double* dudx,
+    const double* const u,
+    const hier::IntVector& num_ghosts_derivative_midpoint,
+    const hier::IntVector& num_ghosts_data_node,
+    const hier::IntVector& ghostcell_dims_derivative_midpoint,
+    const hier::IntVector& ghostcell_dims_data_node,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims,
+    const int& di,
+    const double& dx_inv)
+{
+    const double a_n =  double(9)/double(8);
+    const double b_n = -double(1)/double(24);
+    
+    /*
+     * Get the bounds of the loops, the linear index offsets and the strides of the data padded to three
+     * dimensions.
+     */
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    const int lo_0 = lo[0];
+    const int lo_1 = lo[1];
+    const int lo_2 = lo[2];
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_derivative;
+    int stride_derivative[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_derivative,
+        stride_derivative,
+        num_ghosts_derivative_midpoint,
+        ghostcell_dims_derivative_midpoint,
+        di);
+    
+    const int stride_1_derivative = stride_derivative[1];
+    const int stride_2_derivative = stride_derivative[2];
+    
+    int offset_data;
+    int stride_data[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_data,
+        stride_data,
+        num_ghosts_data_node,
+        ghostcell_dims_data_node,
+        -1);
+    
+    const int stride_1_data = stride_data[1];
+    const int stride_2_data = stride_data[2];
+    
+    const int stride_di_data = stride_data[di];
+    
+    for (int k = lo_2; k < hi_2; k++)
+    {
+        for (int j = lo_1; j < hi_1; j++)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo_0; i < hi_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx = offset_derivative + i + j*stride_1_derivative + k*stride_2_derivative;
+                
+                const int idx_data_R = offset_data + i + j*stride_1_data + k*stride_2_data;
+                const int idx_data_LL = idx_data_R - 2*stride_di_data;
+                const int idx_data_L = idx_data_R - stride_di_data;
+                const int idx_data_RR = idx_data_R + stride_di_data;
+                
+                dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
+                             b_n*(u[idx_data_RR] - u[idx_data_LL])
+                            )*dx_inv;
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to compute the derivatives in the direction di at nodes. The number of dimensions DIM is fixed at
+ * compile time.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeFirstDerivativesAtNode(
+    double* dudx,
+    const double* const u,
+    const hier::IntVector& num_ghosts_derivative_node,
+    const hier::IntVector& num_ghosts_data_node,
+    const hier::IntVector& ghostcell_dims_derivative_node,
+    const hier::IntVector& ghostcell_dims_data_node,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims,
+    const int& di,
+    const double& dx_inv)
+{
+    const double a_n =  double(2)/double(3);
+    const double b_n = -double(1)/double(12);
+    
+    /*
+     * Get the bounds of the loops, the linear index offsets and the strides of the data padded to three
+     * dimensions.
+     */
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    const int lo_0 = lo[0];
+    const int lo_1 = lo[1];
+    const int lo_2 = lo[2];
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_derivative;
+    int stride_derivative[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_derivative,
+        stride_derivative,
+        num_ghosts_derivative_node,
+        ghostcell_dims_derivative_node,
+        -1);
+    
+    const int stride_1_derivative = stride_derivative[1];
+    const int stride_2_derivative = stride_derivative[2];
+    
+    int offset_data;
+    int stride_data[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_data,
+        stride_data,
+        num_ghosts_data_node,
+        ghostcell_dims_data_node,
+        -1);
+    
+    const int stride_1_data = stride_data[1];
+    const int stride_2_data = stride_data[2];
+    
+    const int stride_di_data = stride_data[di];
+    
+    for (int k = lo_2; k < hi_2; k++)
+    {
+        for (int j = lo_1; j < hi_1; j++)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo_0; i < hi_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx = offset_derivative + i + j*stride_1_derivative + k*stride_2_derivative;
+                
+                const int idx_data = offset_data + i + j*stride_1_data + k*stride_2_data;
+                const int idx_data_LL = idx_data - 2*stride_di_data;
+                const int idx_data_L = idx_data - stride_di_data;
+                const int idx_data_R = idx_data + stride_di_data;
+                const int idx_data_RR = idx_data + 2*stride_di_data;
+                
+                dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
+                             b_n*(u[idx_data_RR] - u[idx_data_LL])
+                            )*dx_inv;
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to interpolate the data from nodes to midpoints in the direction di. The number of dimensions DIM
+ * is fixed at compile time.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void interpolateDataFromNodeToMidpoint(
+    double* u_midpoint,
+    const double* const u_node,
+    const hier::IntVector& num_ghosts_data_midpoint,
+    const hier::IntVector& num_ghosts_data_node,
+    const hier::IntVector& ghostcell_dims_data_midpoint,
+    const hier::IntVector& ghostcell_dims_data_node,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims,
+    const int& di)
+{
+    const double a_n =  double(9)/double(16);
+    const double b_n = -double(1)/double(16);
+    
+    /*
+     * Get the bounds of the loops, the linear index offsets and the strides of the data padded to three
+     * dimensions.
+     */
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    const int lo_0 = lo[0];
+    const int lo_1 = lo[1];
+    const int lo_2 = lo[2];
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_midpoint;
+    int stride_midpoint[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_midpoint,
+        stride_midpoint,
+        num_ghosts_data_midpoint,
+        ghostcell_dims_data_midpoint,
+        di);
+    
+    const int stride_1_midpoint = stride_midpoint[1];
+    const int stride_2_midpoint = stride_midpoint[2];
+    
+    int offset_node;
+    int stride_node[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_node,
+        stride_node,
+        num_ghosts_data_node,
+        ghostcell_dims_data_node,
+        -1);
+    
+    const int stride_1_node = stride_node[1];
+    const int stride_2_node = stride_node[2];
+    
+    const int stride_di_node = stride_node[di];
+    
+    for (int k = lo_2; k < hi_2; k++)
+    {
+        for (int j = lo_1; j < hi_1; j++)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo_0; i < hi_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx = offset_midpoint + i + j*stride_1_midpoint + k*stride_2_midpoint;
+                
+                const int idx_node_R = offset_node + i + j*stride_1_node + k*stride_2_node;
+                const int idx_node_LL = idx_node_R - 2*stride_di_node;
+                const int idx_node_L = idx_node_R - stride_di_node;
+                const int idx_node_RR = idx_node_R + stride_di_node;
+                
+                u_midpoint[idx] = (a_n*(u_node[idx_node_R]  + u_node[idx_node_L]) +
+                                   b_n*(u_node[idx_node_RR] + u_node[idx_node_LL])
+                                  );
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to reconstruct the flux on the faces in the direction di using flux at midpoints. The number of
+ * dimensions DIM is fixed at compile time.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void reconstructFlux(
+    double* F_face,
+    const double* const F_midpoint,
+    const hier::IntVector& num_ghosts_flux_midpoint,
+    const hier::IntVector& ghostcell_dims_flux_midpoint,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims,
+    const hier::IntVector& interior_dims,
+    const int& di,
+    const double& dt)
+{
+    const double a_m =  double(9)/double(8);
+    const double b_m = -double(1)/double(24);
+    
+    const double a_r = a_m + b_m;
+    const double b_r = b_m;
+    
+    /*
+     * Get the bounds of the loops, the linear index offsets and the strides of the data padded to three
+     * dimensions.
+     */
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    const int lo_0 = lo[0];
+    const int lo_1 = lo[1];
+    const int lo_2 = lo[2];
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_face;
+    int stride_face[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_face,
+        stride_face,
+        hier::IntVector::getZero(interior_dims.getDim()),
+        interior_dims,
+        di);
+    
+    const int stride_1_face = stride_face[1];
+    const int stride_2_face = stride_face[2];
+    
+    int offset_flux_midpoint;
+    int stride_flux_midpoint[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_flux_midpoint,
+        stride_flux_midpoint,
+        num_ghosts_flux_midpoint,
+        ghostcell_dims_flux_midpoint,
+        di);
+    
+    const int stride_1_flux_midpoint = stride_flux_midpoint[1];
+    const int stride_2_flux_midpoint = stride_flux_midpoint[2];
+    
+    const int stride_di_flux_midpoint = stride_flux_midpoint[di];
+    
+    for (int k = lo_2; k < hi_2; k++)
+    {
+        for (int j = lo_1; j < hi_1; j++)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo_0; i < hi_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx_face = offset_face + i + j*stride_1_face + k*stride_2_face;
+                
+                const int idx_midpoint = offset_flux_midpoint + i + j*stride_1_flux_midpoint + k*stride_2_flux_midpoint;
+                const int idx_midpoint_L = idx_midpoint - stride_di_flux_midpoint;
+                const int idx_midpoint_R = idx_midpoint + stride_di_flux_midpoint;
+                
+                F_face[idx_face] += dt*(
+                    a_r*(F_midpoint[idx_midpoint]) +
+                    b_r*(F_midpoint[idx_midpoint_L] + F_midpoint[idx_midpoint_R])
+                    );
+            }
+        }
+    }
+}
+
+
 DiffusiveFluxReconstructorMidpointFourthOrder::DiffusiveFluxReconstructorMidpointFourthOrder(
     const std::string& object_name,
     const tbox::Dimension& dim,
@@ -77,154 +432,47 @@ DiffusiveFluxReconstructorMidpointFourthOrder::computeFirstDerivativesInXAtMidpo
     const hier::IntVector& domain_dims,
     const double& dx_0_inv) const
 {
-    const double a_n =  double(9)/double(8);
-    const double b_n = -double(1)/double(24);
-    
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int num_ghosts_0_derivative_midpoint = num_ghosts_derivative_midpoint[0];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear indices.
-            const int idx = i + num_ghosts_0_derivative_midpoint;
-            
-            const int idx_data_LL = i - 2 + num_ghosts_0_data;
-            const int idx_data_L  = i - 1 + num_ghosts_0_data;
-            const int idx_data_R  = i + 0 + num_ghosts_0_data;
-            const int idx_data_RR = i + 1 + num_ghosts_0_data;
-            
-            dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
-                         b_n*(u[idx_data_RR] - u[idx_data_LL])
-                        )*dx_0_inv;
-        }
+        computeFirstDerivativesAtMidpoint<1>(
+            dudx,
+            u,
+            num_ghosts_derivative_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0,
+            dx_0_inv);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int num_ghosts_0_derivative_midpoint = num_ghosts_derivative_midpoint[0];
-        const int num_ghosts_1_derivative_midpoint = num_ghosts_derivative_midpoint[1];
-        const int ghostcell_dim_0_derivative_midpoint = ghostcell_dims_derivative_midpoint[0];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_derivative_midpoint) +
-                    (j + num_ghosts_1_derivative_midpoint)*(ghostcell_dim_0_derivative_midpoint + 1);
-                
-                const int idx_data_LL = (i - 2 + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_L = (i - 1 + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_R = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_RR = (i + 1 + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
-                             b_n*(u[idx_data_RR] - u[idx_data_LL])
-                            )*dx_0_inv;
-            }
-        }
+        computeFirstDerivativesAtMidpoint<2>(
+            dudx,
+            u,
+            num_ghosts_derivative_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0,
+            dx_0_inv);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int num_ghosts_0_derivative_midpoint = num_ghosts_derivative_midpoint[0];
-        const int num_ghosts_1_derivative_midpoint = num_ghosts_derivative_midpoint[1];
-        const int num_ghosts_2_derivative_midpoint = num_ghosts_derivative_midpoint[2];
-        const int ghostcell_dim_0_derivative_midpoint = ghostcell_dims_derivative_midpoint[0];
-        const int ghostcell_dim_1_derivative_midpoint = ghostcell_dims_derivative_midpoint[1];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int num_ghosts_2_data = num_ghosts_data_node[2];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        const int ghostcell_dim_1_data = ghostcell_dims_data_node[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = (i + num_ghosts_0_derivative_midpoint) +
-                        (j + num_ghosts_1_derivative_midpoint)*(ghostcell_dim_0_derivative_midpoint + 1) +
-                        (k + num_ghosts_2_derivative_midpoint)*(ghostcell_dim_0_derivative_midpoint + 1)*
-                            ghostcell_dim_1_derivative_midpoint;
-                    
-                    const int idx_data_LL = (i - 2 + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_L = (i - 1 + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_R = (i + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_RR = (i + 1 + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
-                                 b_n*(u[idx_data_RR] - u[idx_data_LL])
-                                )*dx_0_inv;
-                }
-            }
-        }
+        computeFirstDerivativesAtMidpoint<3>(
+            dudx,
+            u,
+            num_ghosts_derivative_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0,
+            dx_0_inv);
     }
 }
 
@@ -244,123 +492,33 @@ DiffusiveFluxReconstructorMidpointFourthOrder::computeFirstDerivativesInYAtMidpo
     const hier::IntVector& domain_dims,
     const double& dx_1_inv) const
 {
-    const double a_n =  double(9)/double(8);
-    const double b_n = -double(1)/double(24);
-    
     if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int num_ghosts_0_derivative_midpoint = num_ghosts_derivative_midpoint[0];
-        const int num_ghosts_1_derivative_midpoint = num_ghosts_derivative_midpoint[1];
-        const int ghostcell_dim_0_derivative_midpoint = ghostcell_dims_derivative_midpoint[0];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_derivative_midpoint) +
-                    (j + num_ghosts_1_derivative_midpoint)*ghostcell_dim_0_derivative_midpoint;
-                
-                const int idx_data_BB = (i + num_ghosts_0_data) +
-                    (j - 2 + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_B = (i + num_ghosts_0_data) +
-                    (j - 1 + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_T = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_TT = (i + num_ghosts_0_data) +
-                    (j + 1 + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                dudy[idx] = (a_n*(u[idx_data_T]  - u[idx_data_B]) +
-                             b_n*(u[idx_data_TT] - u[idx_data_BB])
-                            )*dx_1_inv;
-            }
-        }
+        computeFirstDerivativesAtMidpoint<2>(
+            dudy,
+            u,
+            num_ghosts_derivative_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            1,
+            dx_1_inv);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int num_ghosts_0_derivative_midpoint = num_ghosts_derivative_midpoint[0];
-        const int num_ghosts_1_derivative_midpoint = num_ghosts_derivative_midpoint[1];
-        const int num_ghosts_2_derivative_midpoint = num_ghosts_derivative_midpoint[2];
-        const int ghostcell_dim_0_derivative_midpoint = ghostcell_dims_derivative_midpoint[0];
-        const int ghostcell_dim_1_derivative_midpoint = ghostcell_dims_derivative_midpoint[1];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int num_ghosts_2_data = num_ghosts_data_node[2];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        const int ghostcell_dim_1_data = ghostcell_dims_data_node[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = (i + num_ghosts_0_derivative_midpoint) +
-                        (j + num_ghosts_1_derivative_midpoint)*ghostcell_dim_0_derivative_midpoint +
-                        (k + num_ghosts_2_derivative_midpoint)*ghostcell_dim_0_derivative_midpoint*
-                            (ghostcell_dim_1_derivative_midpoint + 1);
-                    
-                    const int idx_data_BB = (i + num_ghosts_0_data) +
-                        (j - 2 + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_B = (i + num_ghosts_0_data) +
-                        (j - 1 + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_T = (i + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_TT = (i + num_ghosts_0_data) +
-                        (j + 1 + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    dudy[idx] = (a_n*(u[idx_data_T]  - u[idx_data_B]) +
-                                 b_n*(u[idx_data_TT] - u[idx_data_BB])
-                                )*dx_1_inv;
-                }
-            }
-        }
+        computeFirstDerivativesAtMidpoint<3>(
+            dudy,
+            u,
+            num_ghosts_derivative_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            1,
+            dx_1_inv);
     }
 }
 
@@ -380,73 +538,17 @@ DiffusiveFluxReconstructorMidpointFourthOrder::computeFirstDerivativesInZAtMidpo
     const hier::IntVector& domain_dims,
     const double& dx_2_inv) const
 {
-    const double a_n =  double(9)/double(8);
-    const double b_n = -double(1)/double(24);
-    
-    /*
-     * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-     */
-    
-    const int domain_lo_0 = domain_lo[0];
-    const int domain_lo_1 = domain_lo[1];
-    const int domain_lo_2 = domain_lo[2];
-    const int domain_dim_0 = domain_dims[0];
-    const int domain_dim_1 = domain_dims[1];
-    const int domain_dim_2 = domain_dims[2];
-    
-    const int num_ghosts_0_derivative_midpoint = num_ghosts_derivative_midpoint[0];
-    const int num_ghosts_1_derivative_midpoint = num_ghosts_derivative_midpoint[1];
-    const int num_ghosts_2_derivative_midpoint = num_ghosts_derivative_midpoint[2];
-    const int ghostcell_dim_0_derivative_midpoint = ghostcell_dims_derivative_midpoint[0];
-    const int ghostcell_dim_1_derivative_midpoint = ghostcell_dims_derivative_midpoint[1];
-    
-    const int num_ghosts_0_data = num_ghosts_data_node[0];
-    const int num_ghosts_1_data = num_ghosts_data_node[1];
-    const int num_ghosts_2_data = num_ghosts_data_node[2];
-    const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-    const int ghostcell_dim_1_data = ghostcell_dims_data_node[1];
-    
-    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-    {
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_derivative_midpoint) +
-                    (j + num_ghosts_1_derivative_midpoint)*ghostcell_dim_0_derivative_midpoint +
-                    (k + num_ghosts_2_derivative_midpoint)*ghostcell_dim_0_derivative_midpoint*
-                        ghostcell_dim_1_derivative_midpoint;
-                
-                const int idx_data_BB = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k - 2 + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                const int idx_data_B = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k - 1 + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                const int idx_data_F = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                const int idx_data_FF = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k + 1 + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                dudz[idx] = (a_n*(u[idx_data_F]  - u[idx_data_B]) +
-                             b_n*(u[idx_data_FF] - u[idx_data_BB])
-                            )*dx_2_inv;
-            }
-        }
-    }
+    computeFirstDerivativesAtMidpoint<3>(
+        dudz,
+        u,
+        num_ghosts_derivative_midpoint,
+        num_ghosts_data_node,
+        ghostcell_dims_derivative_midpoint,
+        ghostcell_dims_data_node,
+        domain_lo,
+        domain_dims,
+        2,
+        dx_2_inv);
 }
 
 
@@ -465,155 +567,47 @@ DiffusiveFluxReconstructorMidpointFourthOrder::computeFirstDerivativesInXAtNode(
     const hier::IntVector& domain_dims,
     const double& dx_0_inv) const
 {
-    const double a_n =  double(2)/double(3);
-    const double b_n = -double(1)/double(12);
-    
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int num_ghosts_0_derivative_node = num_ghosts_derivative_node[0];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        
-        
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear indices.
-            const int idx = i + num_ghosts_0_derivative_node;
-            
-            const int idx_data_LL = i - 2 + num_ghosts_0_data;
-            const int idx_data_L  = i - 1 + num_ghosts_0_data;
-            const int idx_data_R  = i + 1 + num_ghosts_0_data;
-            const int idx_data_RR = i + 2 + num_ghosts_0_data;
-            
-            dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
-                         b_n*(u[idx_data_RR] - u[idx_data_LL])
-                        )*dx_0_inv;
-        }
+        computeFirstDerivativesAtNode<1>(
+            dudx,
+            u,
+            num_ghosts_derivative_node,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_node,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0,
+            dx_0_inv);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int num_ghosts_0_derivative_node = num_ghosts_derivative_node[0];
-        const int num_ghosts_1_derivative_node = num_ghosts_derivative_node[1];
-        const int ghostcell_dim_0_derivative_node = ghostcell_dims_derivative_node[0];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_derivative_node) +
-                    (j + num_ghosts_1_derivative_node)*ghostcell_dim_0_derivative_node;
-                
-                const int idx_data_LL = (i - 2 + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_L = (i - 1 + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_R = (i + 1 + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_RR = (i + 2 + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
-                             b_n*(u[idx_data_RR] - u[idx_data_LL])
-                            )*dx_0_inv;
-            }
-        }
+        computeFirstDerivativesAtNode<2>(
+            dudx,
+            u,
+            num_ghosts_derivative_node,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_node,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0,
+            dx_0_inv);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int num_ghosts_0_derivative_node = num_ghosts_derivative_node[0];
-        const int num_ghosts_1_derivative_node = num_ghosts_derivative_node[1];
-        const int num_ghosts_2_derivative_node = num_ghosts_derivative_node[2];
-        const int ghostcell_dim_0_derivative_node = ghostcell_dims_derivative_node[0];
-        const int ghostcell_dim_1_derivative_node = ghostcell_dims_derivative_node[1];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int num_ghosts_2_data = num_ghosts_data_node[2];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        const int ghostcell_dim_1_data = ghostcell_dims_data_node[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = (i + num_ghosts_0_derivative_node) +
-                        (j + num_ghosts_1_derivative_node)*ghostcell_dim_0_derivative_node +
-                        (k + num_ghosts_2_derivative_node)*ghostcell_dim_0_derivative_node*
-                            ghostcell_dim_1_derivative_node;
-                    
-                    const int idx_data_LL = (i - 2 + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_L = (i - 1 + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_R = (i + 1 + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_RR = (i + 2 + num_ghosts_0_data) +
-                        (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    dudx[idx] = (a_n*(u[idx_data_R]  - u[idx_data_L]) +
-                                 b_n*(u[idx_data_RR] - u[idx_data_LL])
-                                )*dx_0_inv;
-                }
-            }
-        }
+        computeFirstDerivativesAtNode<3>(
+            dudx,
+            u,
+            num_ghosts_derivative_node,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_node,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0,
+            dx_0_inv);
     }
 }
 
@@ -633,123 +627,33 @@ DiffusiveFluxReconstructorMidpointFourthOrder::computeFirstDerivativesInYAtNode(
     const hier::IntVector& domain_dims,
     const double& dx_1_inv) const
 {
-    const double a_n =  double(2)/double(3);
-    const double b_n = -double(1)/double(12);
-    
     if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int num_ghosts_0_derivative_node = num_ghosts_derivative_node[0];
-        const int num_ghosts_1_derivative_node = num_ghosts_derivative_node[1];
-        const int ghostcell_dim_0_derivative_node = ghostcell_dims_derivative_node[0];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_derivative_node) +
-                    (j + num_ghosts_1_derivative_node)*ghostcell_dim_0_derivative_node;
-                
-                const int idx_data_BB = (i + num_ghosts_0_data) +
-                    (j - 2 + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_B = (i + num_ghosts_0_data) +
-                    (j - 1 + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_T = (i + num_ghosts_0_data) +
-                    (j + 1 + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                const int idx_data_TT = (i + num_ghosts_0_data) +
-                    (j + 2 + num_ghosts_1_data)*ghostcell_dim_0_data;
-                
-                dudy[idx] = (a_n*(u[idx_data_T]  - u[idx_data_B]) +
-                             b_n*(u[idx_data_TT] - u[idx_data_BB])
-                            )*dx_1_inv;
-            }
-        }
+        computeFirstDerivativesAtNode<2>(
+            dudy,
+            u,
+            num_ghosts_derivative_node,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_node,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            1,
+            dx_1_inv);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int num_ghosts_0_derivative_node = num_ghosts_derivative_node[0];
-        const int num_ghosts_1_derivative_node = num_ghosts_derivative_node[1];
-        const int num_ghosts_2_derivative_node = num_ghosts_derivative_node[2];
-        const int ghostcell_dim_0_derivative_node = ghostcell_dims_derivative_node[0];
-        const int ghostcell_dim_1_derivative_node = ghostcell_dims_derivative_node[1];
-        
-        const int num_ghosts_0_data = num_ghosts_data_node[0];
-        const int num_ghosts_1_data = num_ghosts_data_node[1];
-        const int num_ghosts_2_data = num_ghosts_data_node[2];
-        const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-        const int ghostcell_dim_1_data = ghostcell_dims_data_node[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = (i + num_ghosts_0_derivative_node) +
-                        (j + num_ghosts_1_derivative_node)*ghostcell_dim_0_derivative_node +
-                        (k + num_ghosts_2_derivative_node)*ghostcell_dim_0_derivative_node*
-                            ghostcell_dim_1_derivative_node;
-                    
-                    const int idx_data_BB = (i + num_ghosts_0_data) +
-                        (j - 2 + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_B = (i + num_ghosts_0_data) +
-                        (j - 1 + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_T = (i + num_ghosts_0_data) +
-                        (j + 1 + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    const int idx_data_TT = (i + num_ghosts_0_data) +
-                        (j + 2 + num_ghosts_1_data)*ghostcell_dim_0_data +
-                        (k + num_ghosts_2_data)*ghostcell_dim_0_data*
-                            ghostcell_dim_1_data;
-                    
-                    dudy[idx] = (a_n*(u[idx_data_T]  - u[idx_data_B]) +
-                                 b_n*(u[idx_data_TT] - u[idx_data_BB])
-                                )*dx_1_inv;
-                }
-            }
-        }
+        computeFirstDerivativesAtNode<3>(
+            dudy,
+            u,
+            num_ghosts_derivative_node,
+            num_ghosts_data_node,
+            ghostcell_dims_derivative_node,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            1,
+            dx_1_inv);
     }
 }
 
@@ -769,73 +673,17 @@ DiffusiveFluxReconstructorMidpointFourthOrder::computeFirstDerivativesInZAtNode(
     const hier::IntVector& domain_dims,
     const double& dx_2_inv) const
 {
-    const double a_n =  double(2)/double(3);
-    const double b_n = -double(1)/double(12);
-    
-    /*
-     * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-     */
-    
-    const int domain_lo_0 = domain_lo[0];
-    const int domain_lo_1 = domain_lo[1];
-    const int domain_lo_2 = domain_lo[2];
-    const int domain_dim_0 = domain_dims[0];
-    const int domain_dim_1 = domain_dims[1];
-    const int domain_dim_2 = domain_dims[2];
-    
-    const int num_ghosts_0_derivative_node = num_ghosts_derivative_node[0];
-    const int num_ghosts_1_derivative_node = num_ghosts_derivative_node[1];
-    const int num_ghosts_2_derivative_node = num_ghosts_derivative_node[2];
-    const int ghostcell_dim_0_derivative_node = ghostcell_dims_derivative_node[0];
-    const int ghostcell_dim_1_derivative_node = ghostcell_dims_derivative_node[1];
-    
-    const int num_ghosts_0_data = num_ghosts_data_node[0];
-    const int num_ghosts_1_data = num_ghosts_data_node[1];
-    const int num_ghosts_2_data = num_ghosts_data_node[2];
-    const int ghostcell_dim_0_data = ghostcell_dims_data_node[0];
-    const int ghostcell_dim_1_data = ghostcell_dims_data_node[1];
-    
-    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-    {
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_derivative_node) +
-                    (j + num_ghosts_1_derivative_node)*ghostcell_dim_0_derivative_node +
-                    (k + num_ghosts_2_derivative_node)*ghostcell_dim_0_derivative_node*
-                        ghostcell_dim_1_derivative_node;
-                
-                const int idx_data_BB = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k - 2 + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                const int idx_data_B = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k - 1 + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                const int idx_data_F = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k + 1 + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                const int idx_data_FF = (i + num_ghosts_0_data) +
-                    (j + num_ghosts_1_data)*ghostcell_dim_0_data +
-                    (k + 2 + num_ghosts_2_data)*ghostcell_dim_0_data*
-                        ghostcell_dim_1_data;
-                
-                dudz[idx] = (a_n*(u[idx_data_F]  - u[idx_data_B]) +
-                             b_n*(u[idx_data_FF] - u[idx_data_BB])
-                            )*dx_2_inv;
-            }
-        }
-    }
+    computeFirstDerivativesAtNode<3>(
+        dudz,
+        u,
+        num_ghosts_derivative_node,
+        num_ghosts_data_node,
+        ghostcell_dims_derivative_node,
+        ghostcell_dims_data_node,
+        domain_lo,
+        domain_dims,
+        2,
+        dx_2_inv);
 }
 
 
@@ -853,154 +701,44 @@ DiffusiveFluxReconstructorMidpointFourthOrder::interpolateDataFromNodeToMidpoint
     const hier::IntVector& domain_lo,
     const hier::IntVector& domain_dims) const
 {
-    const double a_n =  double(9)/double(16);
-    const double b_n = -double(1)/double(16);
-    
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int num_ghosts_0_data_midpoint = num_ghosts_data_midpoint[0];
-        
-        const int num_ghosts_0_data_node = num_ghosts_data_node[0];
-        
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear indices.
-            const int idx = i + num_ghosts_0_data_midpoint;
-            
-            const int idx_node_LL = i - 2 + num_ghosts_0_data_node;
-            const int idx_node_L  = i - 1 + num_ghosts_0_data_node;
-            const int idx_node_R  = i + 0 + num_ghosts_0_data_node;
-            const int idx_node_RR = i + 1 + num_ghosts_0_data_node;
-            
-            u_midpoint_x[idx] = (a_n*(u_node[idx_node_R]  + u_node[idx_node_L]) +
-                                 b_n*(u_node[idx_node_RR] + u_node[idx_node_LL])
-                                );
-        }
+        interpolateDataFromNodeToMidpoint<1>(
+            u_midpoint_x,
+            u_node,
+            num_ghosts_data_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_data_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int num_ghosts_0_data_midpoint = num_ghosts_data_midpoint[0];
-        const int num_ghosts_1_data_midpoint = num_ghosts_data_midpoint[1];
-        const int ghostcell_dim_0_data_midpoint = ghostcell_dims_data_midpoint[0];
-        
-        const int num_ghosts_0_data_node = num_ghosts_data_node[0];
-        const int num_ghosts_1_data_node = num_ghosts_data_node[1];
-        const int ghostcell_dim_0_data_node = ghostcell_dims_data_node[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_data_midpoint) +
-                    (j + num_ghosts_1_data_midpoint)*(ghostcell_dim_0_data_midpoint + 1);
-                
-                const int idx_node_LL = (i - 2 + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                const int idx_node_L = (i - 1 + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                const int idx_node_R = (i + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                const int idx_node_RR = (i + 1 + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                u_midpoint_x[idx] = (a_n*(u_node[idx_node_R]  + u_node[idx_node_L]) +
-                                     b_n*(u_node[idx_node_RR] + u_node[idx_node_LL])
-                                    );
-            }
-        }
+        interpolateDataFromNodeToMidpoint<2>(
+            u_midpoint_x,
+            u_node,
+            num_ghosts_data_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_data_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int num_ghosts_0_data_midpoint = num_ghosts_data_midpoint[0];
-        const int num_ghosts_1_data_midpoint = num_ghosts_data_midpoint[1];
-        const int num_ghosts_2_data_midpoint = num_ghosts_data_midpoint[2];
-        const int ghostcell_dim_0_data_midpoint = ghostcell_dims_data_midpoint[0];
-        const int ghostcell_dim_1_data_midpoint = ghostcell_dims_data_midpoint[1];
-        
-        const int num_ghosts_0_data_node = num_ghosts_data_node[0];
-        const int num_ghosts_1_data_node = num_ghosts_data_node[1];
-        const int num_ghosts_2_data_node = num_ghosts_data_node[2];
-        const int ghostcell_dim_0_data_node = ghostcell_dims_data_node[0];
-        const int ghostcell_dim_1_data_node = ghostcell_dims_data_node[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = (i + num_ghosts_0_data_midpoint) +
-                        (j + num_ghosts_1_data_midpoint)*(ghostcell_dim_0_data_midpoint + 1) +
-                        (k + num_ghosts_2_data_midpoint)*(ghostcell_dim_0_data_midpoint + 1)*
-                            ghostcell_dim_1_data_midpoint;
-                    
-                    const int idx_node_LL = (i - 2 + num_ghosts_0_data_node) +
-                        (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    const int idx_node_L = (i - 1 + num_ghosts_0_data_node) +
-                        (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    const int idx_node_R = (i + num_ghosts_0_data_node) +
-                        (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    const int idx_node_RR = (i + 1 + num_ghosts_0_data_node) +
-                        (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    u_midpoint_x[idx] = (a_n*(u_node[idx_node_R]  + u_node[idx_node_L]) +
-                                         b_n*(u_node[idx_node_RR] + u_node[idx_node_LL])
-                                        );
-                }
-            }
-        }
+        interpolateDataFromNodeToMidpoint<3>(
+            u_midpoint_x,
+            u_node,
+            num_ghosts_data_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_data_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            0);
     }
 }
 
@@ -1019,123 +757,31 @@ DiffusiveFluxReconstructorMidpointFourthOrder::interpolateDataFromNodeToMidpoint
     const hier::IntVector& domain_lo,
     const hier::IntVector& domain_dims) const
 {
-    const double a_n =  double(9)/double(16);
-    const double b_n = -double(1)/double(16);
-    
     if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int num_ghosts_0_data_midpoint = num_ghosts_data_midpoint[0];
-        const int num_ghosts_1_data_midpoint = num_ghosts_data_midpoint[1];
-        const int ghostcell_dim_0_data_midpoint = ghostcell_dims_data_midpoint[0];
-        
-        const int num_ghosts_0_data_node = num_ghosts_data_node[0];
-        const int num_ghosts_1_data_node = num_ghosts_data_node[1];
-        const int ghostcell_dim_0_data_node = ghostcell_dims_data_node[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_data_midpoint) +
-                    (j + num_ghosts_1_data_midpoint)*ghostcell_dim_0_data_midpoint;
-                
-                const int idx_node_BB = (i + num_ghosts_0_data_node) +
-                    (j - 2 + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                const int idx_node_B = (i + num_ghosts_0_data_node) +
-                    (j - 1 + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                const int idx_node_T = (i + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                const int idx_node_TT = (i + num_ghosts_0_data_node) +
-                    (j + 1 + num_ghosts_1_data_node)*ghostcell_dim_0_data_node;
-                
-                u_midpoint_y[idx] = (a_n*(u_node[idx_node_T]  + u_node[idx_node_B]) +
-                                     b_n*(u_node[idx_node_TT] + u_node[idx_node_BB])
-                                    );
-            }
-        }
+        interpolateDataFromNodeToMidpoint<2>(
+            u_midpoint_y,
+            u_node,
+            num_ghosts_data_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_data_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            1);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int num_ghosts_0_data_midpoint = num_ghosts_data_midpoint[0];
-        const int num_ghosts_1_data_midpoint = num_ghosts_data_midpoint[1];
-        const int num_ghosts_2_data_midpoint = num_ghosts_data_midpoint[2];
-        const int ghostcell_dim_0_data_midpoint = ghostcell_dims_data_midpoint[0];
-        const int ghostcell_dim_1_data_midpoint = ghostcell_dims_data_midpoint[1];
-        
-        const int num_ghosts_0_data_node = num_ghosts_data_node[0];
-        const int num_ghosts_1_data_node = num_ghosts_data_node[1];
-        const int num_ghosts_2_data_node = num_ghosts_data_node[2];
-        const int ghostcell_dim_0_data_node = ghostcell_dims_data_node[0];
-        const int ghostcell_dim_1_data_node = ghostcell_dims_data_node[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = (i + num_ghosts_0_data_midpoint) +
-                        (j + num_ghosts_1_data_midpoint)*ghostcell_dim_0_data_midpoint +
-                        (k + num_ghosts_2_data_midpoint)*ghostcell_dim_0_data_midpoint*
-                            (ghostcell_dim_1_data_midpoint + 1);
-                    
-                    const int idx_node_BB = (i + num_ghosts_0_data_node) +
-                        (j - 2 + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    const int idx_node_B = (i + num_ghosts_0_data_node) +
-                        (j - 1 + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    const int idx_node_T = (i + num_ghosts_0_data_node) +
-                        (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    const int idx_node_TT = (i + num_ghosts_0_data_node) +
-                        (j + 1 + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                        (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                            ghostcell_dim_1_data_node;
-                    
-                    u_midpoint_y[idx] = (a_n*(u_node[idx_node_T]  + u_node[idx_node_B]) +
-                                         b_n*(u_node[idx_node_TT] + u_node[idx_node_BB])
-                                        );
-                }
-            }
-        }
+        interpolateDataFromNodeToMidpoint<3>(
+            u_midpoint_y,
+            u_node,
+            num_ghosts_data_midpoint,
+            num_ghosts_data_node,
+            ghostcell_dims_data_midpoint,
+            ghostcell_dims_data_node,
+            domain_lo,
+            domain_dims,
+            1);
     }
 }
 
@@ -1153,73 +799,45 @@ DiffusiveFluxReconstructorMidpointFourthOrder::interpolateDataFromNodeToMidpoint
     const hier::IntVector& ghostcell_dims_data_node,
     const hier::IntVector& domain_lo,
     const hier::IntVector& domain_dims) const
+{
+    interpolateDataFromNodeToMidpoint<3>(
+        u_midpoint_z,
+        u_node,
+        num_ghosts_data_midpoint,
+        num_ghosts_data_node,
+        ghostcell_dims_data_midpoint,
+        ghostcell_dims_data_node,
+        domain_lo,
+        domain_dims,
+        2);
+}
+
+
+/*
+ * Kernel to accumulate the products of the diffusivities and the derivatives interpolated from nodes to
+ * midpoints on a line of midpoints into the diffusive flux. The midpoint i lies between the nodes i - 1 and i
+ * in the direction of the interpolation that has the stride stride_node along the line.
+ */
+void
+DiffusiveFluxReconstructorMidpointFourthOrder::accumulateDiffusiveFluxWithDerivativesFromNodeOnLine(
+    double* F_line,
+    const double* const mu_line,
+    const double* const du_node_line,
+    const int& stride_node,
+    const int& i_lo,
+    const int& i_hi) const
 {
     const double a_n =  double(9)/double(16);
     const double b_n = -double(1)/double(16);
     
-    /*
-     * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-     */
-    
-    const int domain_lo_0 = domain_lo[0];
-    const int domain_lo_1 = domain_lo[1];
-    const int domain_lo_2 = domain_lo[2];
-    const int domain_dim_0 = domain_dims[0];
-    const int domain_dim_1 = domain_dims[1];
-    const int domain_dim_2 = domain_dims[2];
-    
-    const int num_ghosts_0_data_midpoint = num_ghosts_data_midpoint[0];
-    const int num_ghosts_1_data_midpoint = num_ghosts_data_midpoint[1];
-    const int num_ghosts_2_data_midpoint = num_ghosts_data_midpoint[2];
-    const int ghostcell_dim_0_data_midpoint = ghostcell_dims_data_midpoint[0];
-    const int ghostcell_dim_1_data_midpoint = ghostcell_dims_data_midpoint[1];
-    
-    const int num_ghosts_0_data_node = num_ghosts_data_node[0];
-    const int num_ghosts_1_data_node = num_ghosts_data_node[1];
-    const int num_ghosts_2_data_node = num_ghosts_data_node[2];
-    const int ghostcell_dim_0_data_node = ghostcell_dims_data_node[0];
-    const int ghostcell_dim_1_data_node = ghostcell_dims_data_node[1];
-    
-    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-    {
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
 #ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
+    #pragma omp simd
 #endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx = (i + num_ghosts_0_data_midpoint) +
-                    (j + num_ghosts_1_data_midpoint)*ghostcell_dim_0_data_midpoint +
-                    (k + num_ghosts_2_data_midpoint)*ghostcell_dim_0_data_midpoint*
-                        ghostcell_dim_1_data_midpoint;
-                
-                const int idx_node_BB = (i + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                    (k - 2 + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                        ghostcell_dim_1_data_node;
-                
-                const int idx_node_B = (i + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                    (k - 1 + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                        ghostcell_dim_1_data_node;
-                
-                const int idx_node_F = (i + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                    (k + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                        ghostcell_dim_1_data_node;
-                
-                const int idx_node_FF = (i + num_ghosts_0_data_node) +
-                    (j + num_ghosts_1_data_node)*ghostcell_dim_0_data_node +
-                    (k + 1 + num_ghosts_2_data_node)*ghostcell_dim_0_data_node*
-                        ghostcell_dim_1_data_node;
-                
-                u_midpoint_z[idx] = (a_n*(u_node[idx_node_F]  + u_node[idx_node_B]) +
-                                     b_n*(u_node[idx_node_FF] + u_node[idx_node_BB])
+    for (int i = i_lo; i < i_hi; i++)
+    {
+            F_line[i] += mu_line[i]*(a_n*(du_node_line[i]               + du_node_line[i - stride_node]) +
+                                     b_n*(du_node_line[i + stride_node] + du_node_line[i - 2*stride_node])
                                     );
-            }
-        }
     }
 }
 
@@ -1238,143 +856,44 @@ DiffusiveFluxReconstructorMidpointFourthOrder::reconstructFluxX(
     const hier::IntVector& interior_dims,
     const double& dt) const
 {
-    const double a_m =  double(9)/double(8);
-    const double b_m = -double(1)/double(24);
-    
-    const double a_r = a_m + b_m;
-    const double b_r = b_m;
-    
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int num_ghosts_0_flux_midpoint = num_ghosts_flux_midpoint[0];
-        
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear indices.
-            const int idx_face_x = i;
-            
-            const int idx_midpoint_L = i - 1 + num_ghosts_0_flux_midpoint;
-            const int idx_midpoint   = i + 0 + num_ghosts_0_flux_midpoint;
-            const int idx_midpoint_R = i + 1 + num_ghosts_0_flux_midpoint;
-            
-            F_face_x[idx_face_x] += dt*(
-                a_r*(F_midpoint_x[idx_midpoint]) +
-                b_r*(F_midpoint_x[idx_midpoint_L] + F_midpoint_x[idx_midpoint_R])
-                );
-        }
+        reconstructFlux<1>(
+            F_face_x,
+            F_midpoint_x,
+            num_ghosts_flux_midpoint,
+            ghostcell_dims_flux_midpoint,
+            domain_lo,
+            domain_dims,
+            interior_dims,
+            0,
+            dt);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        const int num_ghosts_0_flux_midpoint = num_ghosts_flux_midpoint[0];
-        const int num_ghosts_1_flux_midpoint = num_ghosts_flux_midpoint[1];
-        const int ghostcell_dim_0_flux_midpoint = ghostcell_dims_flux_midpoint[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_face_x = i +
-                    j*(interior_dim_0 + 1);
-                
-                const int idx_midpoint_L = (i - 1 + num_ghosts_0_flux_midpoint) +
-                    (j + num_ghosts_1_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1);
-                
-                const int idx_midpoint = (i + num_ghosts_0_flux_midpoint) +
-                    (j + num_ghosts_1_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1);
-                
-                const int idx_midpoint_R = (i + 1 + num_ghosts_0_flux_midpoint) +
-                    (j + num_ghosts_1_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1);
-                
-                F_face_x[idx_face_x] += dt*(
-                    a_r*(F_midpoint_x[idx_midpoint]) +
-                    b_r*(F_midpoint_x[idx_midpoint_L] + F_midpoint_x[idx_midpoint_R])
-                    );
-            }
-        }
+        reconstructFlux<2>(
+            F_face_x,
+            F_midpoint_x,
+            num_ghosts_flux_midpoint,
+            ghostcell_dims_flux_midpoint,
+            domain_lo,
+            domain_dims,
+            interior_dims,
+            0,
+            dt);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        const int num_ghosts_0_flux_midpoint = num_ghosts_flux_midpoint[0];
-        const int num_ghosts_1_flux_midpoint = num_ghosts_flux_midpoint[1];
-        const int num_ghosts_2_flux_midpoint = num_ghosts_flux_midpoint[2];
-        const int ghostcell_dim_0_flux_midpoint = ghostcell_dims_flux_midpoint[0];
-        const int ghostcell_dim_1_flux_midpoint = ghostcell_dims_flux_midpoint[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_face_x = i +
-                        j*(interior_dim_0 + 1) +
-                        k*(interior_dim_0 + 1)*interior_dim_1;
-                    
-                    const int idx_midpoint_L = (i - 1 + num_ghosts_0_flux_midpoint) +
-                        (j + num_ghosts_1_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1) +
-                        (k + num_ghosts_2_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1)*
-                            ghostcell_dim_1_flux_midpoint;
-                    
-                    const int idx_midpoint = (i + num_ghosts_0_flux_midpoint) +
-                        (j + num_ghosts_1_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1) +
-                        (k + num_ghosts_2_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1)*
-                            ghostcell_dim_1_flux_midpoint;
-                    
-                    const int idx_midpoint_R = (i + 1 + num_ghosts_0_flux_midpoint) +
-                        (j + num_ghosts_1_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1) +
-                        (k + num_ghosts_2_flux_midpoint)*(ghostcell_dim_0_flux_midpoint + 1)*
-                            ghostcell_dim_1_flux_midpoint;
-                    
-                    F_face_x[idx_face_x] += dt*(
-                        a_r*(F_midpoint_x[idx_midpoint]) +
-                        b_r*(F_midpoint_x[idx_midpoint_L] + F_midpoint_x[idx_midpoint_R])
-                        );
-                }
-            }
-        }
+        reconstructFlux<3>(
+            F_face_x,
+            F_midpoint_x,
+            num_ghosts_flux_midpoint,
+            ghostcell_dims_flux_midpoint,
+            domain_lo,
+            domain_dims,
+            interior_dims,
+            0,
+            dt);
     }
 }
 
@@ -1393,114 +912,31 @@ DiffusiveFluxReconstructorMidpointFourthOrder::reconstructFluxY(
     const hier::IntVector& interior_dims,
     const double& dt) const
 {
-    const double a_m =  double(9)/double(8);
-    const double b_m = -double(1)/double(24);
-    
-    const double a_r = a_m + b_m;
-    const double b_r = b_m;
-    
     if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int interior_dim_0 = interior_dims[0];
-        
-        const int num_ghosts_0_flux_midpoint = num_ghosts_flux_midpoint[0];
-        const int num_ghosts_1_flux_midpoint = num_ghosts_flux_midpoint[1];
-        const int ghostcell_dim_0_flux_midpoint = ghostcell_dims_flux_midpoint[0];
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_face_y = i +
-                    j*interior_dim_0;
-                
-                const int idx_midpoint_B = (i + num_ghosts_0_flux_midpoint) +
-                    (j - 1 + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint;
-                
-                const int idx_midpoint = (i + num_ghosts_0_flux_midpoint) +
-                    (j + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint;
-                
-                const int idx_midpoint_T = (i + num_ghosts_0_flux_midpoint) +
-                    (j + 1 + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint;
-                
-                F_face_y[idx_face_y] += dt*(
-                    a_r*(F_midpoint_y[idx_midpoint]) +
-                    b_r*(F_midpoint_y[idx_midpoint_B] + F_midpoint_y[idx_midpoint_T])
-                    );
-            }
-        }
+        reconstructFlux<2>(
+            F_face_y,
+            F_midpoint_y,
+            num_ghosts_flux_midpoint,
+            ghostcell_dims_flux_midpoint,
+            domain_lo,
+            domain_dims,
+            interior_dims,
+            1,
+            dt);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        const int num_ghosts_0_flux_midpoint = num_ghosts_flux_midpoint[0];
-        const int num_ghosts_1_flux_midpoint = num_ghosts_flux_midpoint[1];
-        const int num_ghosts_2_flux_midpoint = num_ghosts_flux_midpoint[2];
-        const int ghostcell_dim_0_flux_midpoint = ghostcell_dims_flux_midpoint[0];
-        const int ghostcell_dim_1_flux_midpoint = ghostcell_dims_flux_midpoint[1];
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_face_y = i +
-                        j*interior_dim_0 +
-                        k*interior_dim_0*(interior_dim_1 + 1);
-                    
-                    const int idx_midpoint_B = (i + num_ghosts_0_flux_midpoint) +
-                        (j - 1 + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint +
-                        (k + num_ghosts_2_flux_midpoint)*ghostcell_dim_0_flux_midpoint*
-                            (ghostcell_dim_1_flux_midpoint + 1);
-                    
-                    const int idx_midpoint = (i + num_ghosts_0_flux_midpoint) +
-                        (j + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint +
-                        (k + num_ghosts_2_flux_midpoint)*ghostcell_dim_0_flux_midpoint*
-                            (ghostcell_dim_1_flux_midpoint + 1);
-                    
-                    const int idx_midpoint_T = (i + num_ghosts_0_flux_midpoint) +
-                        (j + 1 + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint +
-                        (k + num_ghosts_2_flux_midpoint)*ghostcell_dim_0_flux_midpoint*
-                            (ghostcell_dim_1_flux_midpoint + 1);
-                    
-                    F_face_y[idx_face_y] += dt*(
-                        a_r*(F_midpoint_y[idx_midpoint]) +
-                        b_r*(F_midpoint_y[idx_midpoint_B] + F_midpoint_y[idx_midpoint_T])
-                        );
-                }
-            }
-        }
+        reconstructFlux<3>(
+            F_face_y,
+            F_midpoint_y,
+            num_ghosts_flux_midpoint,
+            ghostcell_dims_flux_midpoint,
+            domain_lo,
+            domain_dims,
+            interior_dims,
+            1,
+            dt);
     }
 }
 
@@ -1519,66 +955,14 @@ DiffusiveFluxReconstructorMidpointFourthOrder::reconstructFluxZ(
     const hier::IntVector& interior_dims,
     const double& dt) const
 {
-    const double a_m =  double(9)/double(8);
-    const double b_m = -double(1)/double(24);
-    
-    const double a_r = a_m + b_m;
-    const double b_r = b_m;
-    
-    /*
-     * Get the local lower index, numbers of cells in each dimension and number of ghost cells.
-     */
-    
-    const int domain_lo_0 = domain_lo[0];
-    const int domain_lo_1 = domain_lo[1];
-    const int domain_lo_2 = domain_lo[2];
-    const int domain_dim_0 = domain_dims[0];
-    const int domain_dim_1 = domain_dims[1];
-    const int domain_dim_2 = domain_dims[2];
-    
-    const int interior_dim_0 = interior_dims[0];
-    const int interior_dim_1 = interior_dims[1];
-    
-    const int num_ghosts_0_flux_midpoint = num_ghosts_flux_midpoint[0];
-    const int num_ghosts_1_flux_midpoint = num_ghosts_flux_midpoint[1];
-    const int num_ghosts_2_flux_midpoint = num_ghosts_flux_midpoint[2];
-    const int ghostcell_dim_0_flux_midpoint = ghostcell_dims_flux_midpoint[0];
-    const int ghostcell_dim_1_flux_midpoint = ghostcell_dims_flux_midpoint[1];
-    
-    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-    {
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_face_z = i +
-                    j*interior_dim_0 +
-                    k*interior_dim_0*interior_dim_1;
-                
-                const int idx_midpoint_B = (i + num_ghosts_0_flux_midpoint) +
-                    (j + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint +
-                    (k - 1 + num_ghosts_2_flux_midpoint)*ghostcell_dim_0_flux_midpoint*
-                        ghostcell_dim_1_flux_midpoint;
-                
-                const int idx_midpoint = (i + num_ghosts_0_flux_midpoint) +
-                    (j + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint +
-                    (k + num_ghosts_2_flux_midpoint)*ghostcell_dim_0_flux_midpoint*
-                        ghostcell_dim_1_flux_midpoint;
-                
-                const int idx_midpoint_F = (i + num_ghosts_0_flux_midpoint) +
-                    (j + num_ghosts_1_flux_midpoint)*ghostcell_dim_0_flux_midpoint +
-                    (k + 1 + num_ghosts_2_flux_midpoint)*ghostcell_dim_0_flux_midpoint*
-                        ghostcell_dim_1_flux_midpoint;
-                
-                F_face_z[idx_face_z] += dt*(
-                    a_r*(F_midpoint_z[idx_midpoint]) +
-                    b_r*(F_midpoint_z[idx_midpoint_B] + F_midpoint_z[idx_midpoint_F])
-                    );
-            }
-        }
-    }
+    reconstructFlux<3>(
+        F_face_z,
+        F_midpoint_z,
+        num_ghosts_flux_midpoint,
+        ghostcell_dims_flux_midpoint,
+        domain_lo,
+        domain_dims,
+        interior_dims,
+        2,
+        dt);
 }
@@ -1,4 +1,568 @@
 #include "flow/flow_models/FlowModel.hpp"
+#include "util/Padded3DIndexing.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/*
+ * Target size in bytes of the working set of a tile of the single-pass derived cell data computation.
+ */
+static const int s_num_bytes_tile_derived_cell_data = 256*1024;
+
+/*
+ * Kernel to compute the quotient of two variables on a domain. The number of dimensions DIM is fixed at
+ * compile time and the loops are padded to three dimensions.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeQuotient(
+    double* const quotient,
+    const double* const numerator,
+    const double* const denominator,
+    const hier::IntVector& num_ghosts_quotient,
+    const hier::IntVector& num_ghosts_numerator,
+    const hier::IntVector& num_ghosts_denominator,
+    const hier::IntVector& ghostcell_dims_quotient,
+    const hier::IntVector& ghostcell_dims_numerator,
+    const hier::IntVector& ghostcell_dims_denominator,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_quotient, offset_numerator, offset_denominator;
+    int stride_quotient[3], stride_numerator[3], stride_denominator[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_quotient, stride_quotient, num_ghosts_quotient,
+        ghostcell_dims_quotient, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_numerator, stride_numerator, num_ghosts_numerator,
+        ghostcell_dims_numerator, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_denominator, stride_denominator, num_ghosts_denominator,
+        ghostcell_dims_denominator, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_quotient_j = offset_quotient + j*stride_quotient[1] + k*stride_quotient[2];
+            const int idx_numerator_j = offset_numerator + j*stride_numerator[1] + k*stride_numerator[2];
+            const int idx_denominator_j = offset_denominator + j*stride_denominator[1] + k*stride_denominator[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                quotient[idx_quotient_j + i] = numerator[idx_numerator_j + i]/denominator[idx_denominator_j + i];
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to compute the velocity from momentum and density on a domain. All the components are computed in a
+ * single pass over the cells.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeVelocity(
+    const std::vector<double*>& velocity,
+    const std::vector<const double*>& momentum,
+    const double* const rho,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& num_ghosts_momentum,
+    const hier::IntVector& num_ghosts_density,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& ghostcell_dims_momentum,
+    const hier::IntVector& ghostcell_dims_density,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    double* u[DIM];
+    const double* rho_u[DIM];
+    for (int di = 0; di < DIM; di++)
+    {
+        u[di] = velocity[di];
+        rho_u[di] = momentum[di];
+    }
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_velocity, offset_momentum, offset_density;
+    int stride_velocity[3], stride_momentum[3], stride_density[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_velocity, stride_velocity, num_ghosts_velocity,
+        ghostcell_dims_velocity, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_momentum, stride_momentum, num_ghosts_momentum,
+        ghostcell_dims_momentum, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_density, stride_density, num_ghosts_density,
+        ghostcell_dims_density, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_velocity_j = offset_velocity + j*stride_velocity[1] + k*stride_velocity[2];
+            const int idx_momentum_j = offset_momentum + j*stride_momentum[1] + k*stride_momentum[2];
+            const int idx_density_j = offset_density + j*stride_density[1] + k*stride_density[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                // Compute the linear indices.
+                const int idx_velocity = idx_velocity_j + i;
+                const int idx_momentum = idx_momentum_j + i;
+                const int idx_density = idx_density_j + i;
+                
+                for (int di = 0; di < DIM; di++)
+                {
+                    u[di][idx_velocity] = rho_u[di][idx_momentum]/rho[idx_density];
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to compute the product of two variables on a domain.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeProduct(
+    double* const product,
+    const double* const factor_a,
+    const double* const factor_b,
+    const hier::IntVector& num_ghosts_product,
+    const hier::IntVector& num_ghosts_factor_a,
+    const hier::IntVector& num_ghosts_factor_b,
+    const hier::IntVector& ghostcell_dims_product,
+    const hier::IntVector& ghostcell_dims_factor_a,
+    const hier::IntVector& ghostcell_dims_factor_b,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_product, offset_factor_a, offset_factor_b;
+    int stride_product[3], stride_factor_a[3], stride_factor_b[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_product, stride_product, num_ghosts_product,
+        ghostcell_dims_product, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_factor_a, stride_factor_a, num_ghosts_factor_a,
+        ghostcell_dims_factor_a, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_factor_b, stride_factor_b, num_ghosts_factor_b,
+        ghostcell_dims_factor_b, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_product_j = offset_product + j*stride_product[1] + k*stride_product[2];
+            const int idx_factor_a_j = offset_factor_a + j*stride_factor_a[1] + k*stride_factor_a[2];
+            const int idx_factor_b_j = offset_factor_b + j*stride_factor_b[1] + k*stride_factor_b[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                product[idx_product_j + i] = factor_a[idx_factor_a_j + i]*factor_b[idx_factor_b_j + i];
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to copy a variable on a domain.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeCopy(
+    double* const copy,
+    const double* const data,
+    const hier::IntVector& num_ghosts_copy,
+    const hier::IntVector& num_ghosts_data,
+    const hier::IntVector& ghostcell_dims_copy,
+    const hier::IntVector& ghostcell_dims_data,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_copy, offset_data;
+    int stride_copy[3], stride_data[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_copy, stride_copy, num_ghosts_copy, ghostcell_dims_copy, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_data, stride_data, num_ghosts_data, ghostcell_dims_data, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_copy_j = offset_copy + j*stride_copy[1] + k*stride_copy[2];
+            const int idx_data_j = offset_data + j*stride_data[1] + k*stride_data[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                copy[idx_copy_j + i] = data[idx_data_j + i];
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to compute the internal energy from total energy, density and velocity on a domain. The kinetic
+ * energy of the one-dimensional kernel is computed without the sum over the components as in the original
+ * loops such that the results are the same bit for bit.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeInternalEnergy(
+    double* const epsilon,
+    const double* const E,
+    const double* const rho,
+    const std::vector<const double*>& velocity,
+    const hier::IntVector& num_ghosts_internal_energy,
+    const hier::IntVector& num_ghosts_total_energy,
+    const hier::IntVector& num_ghosts_density,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& ghostcell_dims_internal_energy,
+    const hier::IntVector& ghostcell_dims_total_energy,
+    const hier::IntVector& ghostcell_dims_density,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    const double* const u = velocity[0];
+    const double* const v = (DIM > 1 ? velocity[1] : nullptr);
+    const double* const w = (DIM > 2 ? velocity[2] : nullptr);
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_internal_energy, offset_total_energy, offset_density, offset_velocity;
+    int stride_internal_energy[3], stride_total_energy[3], stride_density[3], stride_velocity[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_internal_energy, stride_internal_energy,
+        num_ghosts_internal_energy, ghostcell_dims_internal_energy, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_total_energy, stride_total_energy,
+        num_ghosts_total_energy, ghostcell_dims_total_energy, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_density, stride_density,
+        num_ghosts_density, ghostcell_dims_density, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_velocity, stride_velocity,
+        num_ghosts_velocity, ghostcell_dims_velocity, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_internal_energy_j = offset_internal_energy + j*stride_internal_energy[1] +
+                k*stride_internal_energy[2];
+            const int idx_total_energy_j = offset_total_energy + j*stride_total_energy[1] +
+                k*stride_total_energy[2];
+            const int idx_density_j = offset_density + j*stride_density[1] + k*stride_density[2];
+            const int idx_velocity_j = offset_velocity + j*stride_velocity[1] + k*stride_velocity[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                // Compute the linear indices.
+                const int idx_internal_energy = idx_internal_energy_j + i;
+                const int idx_total_energy = idx_total_energy_j + i;
+                const int idx_density = idx_density_j + i;
+                const int idx_velocity = idx_velocity_j + i;
+                
+                if (DIM == 1)
+                {
+                    epsilon[idx_internal_energy] = E[idx_total_energy]/rho[idx_density] -
+                        double(1)/double(2)*u[idx_velocity]*u[idx_velocity];
+                }
+                else if (DIM == 2)
+                {
+                    epsilon[idx_internal_energy] = E[idx_total_energy]/rho[idx_density] -
+                        double(1)/double(2)*(u[idx_velocity]*u[idx_velocity] + v[idx_velocity]*v[idx_velocity]);
+                }
+                else
+                {
+                    epsilon[idx_internal_energy] = E[idx_total_energy]/rho[idx_density] -
+                        double(1)/double(2)*(u[idx_velocity]*u[idx_velocity] + v[idx_velocity]*v[idx_velocity] +
+                            w[idx_velocity]*w[idx_velocity]);
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to compute the convective flux of momentum and total energy in the direction DI on a domain.
+ */
+template<int DIM, int DI>
+static inline __attribute__((always_inline)) void computeConvectiveFluxOfMomentumAndTotalEnergy(
+    const std::vector<double*>& convective_flux,
+    const int ei_momentum,
+    const std::vector<const double*>& momentum,
+    const double* const E,
+    const double* const u,
+    const double* const p,
+    const hier::IntVector& num_ghosts_convective_flux,
+    const hier::IntVector& num_ghosts_conservative_variables,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& num_ghosts_pressure,
+    const hier::IntVector& ghostcell_dims_convective_flux,
+    const hier::IntVector& ghostcell_dims_conservative_variables,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& ghostcell_dims_pressure,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    double* F[DIM + 1];
+    const double* rho_u[DIM];
+    for (int ei = 0; ei < DIM; ei++)
+    {
+        F[ei] = convective_flux[ei_momentum + ei];
+        rho_u[ei] = momentum[ei];
+    }
+    F[DIM] = convective_flux[ei_momentum + DIM];
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_convective_flux, offset_conservative_variables, offset_velocity, offset_pressure;
+    int stride_convective_flux[3], stride_conservative_variables[3], stride_velocity[3], stride_pressure[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_convective_flux, stride_convective_flux,
+        num_ghosts_convective_flux, ghostcell_dims_convective_flux, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_conservative_variables, stride_conservative_variables,
+        num_ghosts_conservative_variables, ghostcell_dims_conservative_variables, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_velocity, stride_velocity,
+        num_ghosts_velocity, ghostcell_dims_velocity, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_pressure, stride_pressure,
+        num_ghosts_pressure, ghostcell_dims_pressure, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_convective_flux_j = offset_convective_flux + j*stride_convective_flux[1] +
+                k*stride_convective_flux[2];
+            const int idx_j = offset_conservative_variables + j*stride_conservative_variables[1] +
+                k*stride_conservative_variables[2];
+            const int idx_velocity_j = offset_velocity + j*stride_velocity[1] + k*stride_velocity[2];
+            const int idx_pressure_j = offset_pressure + j*stride_pressure[1] + k*stride_pressure[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                // Compute the linear indices.
+                const int idx_convective_flux = idx_convective_flux_j + i;
+                const int idx = idx_j + i;
+                const int idx_velocity = idx_velocity_j + i;
+                const int idx_pressure = idx_pressure_j + i;
+                
+                for (int ei = 0; ei < DIM; ei++)
+                {
+                    if (ei == DI)
+                    {
+                        F[ei][idx_convective_flux] = u[idx_velocity]*rho_u[ei][idx] + p[idx_pressure];
+                    }
+                    else
+                    {
+                        F[ei][idx_convective_flux] = u[idx_velocity]*rho_u[ei][idx];
+                    }
+                }
+                F[DIM][idx_convective_flux] = u[idx_velocity]*(E[idx] + p[idx_pressure]);
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to compute the maximum wave speed from a velocity component and sound speed on a domain.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeMaxWaveSpeed(
+    double* const lambda_max,
+    const double* const u,
+    const double* const c,
+    const hier::IntVector& num_ghosts_max_wave_speed,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& num_ghosts_sound_speed,
+    const hier::IntVector& ghostcell_dims_max_wave_speed,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& ghostcell_dims_sound_speed,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_max_wave_speed, offset_velocity, offset_sound_speed;
+    int stride_max_wave_speed[3], stride_velocity[3], stride_sound_speed[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_max_wave_speed, stride_max_wave_speed,
+        num_ghosts_max_wave_speed, ghostcell_dims_max_wave_speed, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_velocity, stride_velocity,
+        num_ghosts_velocity, ghostcell_dims_velocity, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_sound_speed, stride_sound_speed,
+        num_ghosts_sound_speed, ghostcell_dims_sound_speed, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_max_wave_speed_j = offset_max_wave_speed + j*stride_max_wave_speed[1] +
+                k*stride_max_wave_speed[2];
+            const int idx_velocity_j = offset_velocity + j*stride_velocity[1] + k*stride_velocity[2];
+            const int idx_sound_speed_j = offset_sound_speed + j*stride_sound_speed[1] + k*stride_sound_speed[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                lambda_max[idx_max_wave_speed_j + i] = fabs(u[idx_velocity_j + i]) + c[idx_sound_speed_j + i];
+            }
+        }
+    }
+}
+
+
+/*
+ * Kernel to compute the sound speed of a multi-species mixture from the Gruneisen parameter and the partial
+ * derivatives of pressure with respect to the partial densities on a domain. The number of dimensions DIM is
+ * fixed at compile time and so is the number of species if NUM_SPECIES is nonzero. The contributions of the
+ * species are summed in a single pass over the cells.
+ */
+template<int DIM, int NUM_SPECIES>
+static inline __attribute__((always_inline)) void computeSoundSpeedFromPressureDerivatives(
+    double* const c,
+    const double* const rho,
+    const std::vector<const double*>& Y,
+    const double* const p,
+    const double* const Gamma,
+    const std::vector<const double*>& Psi,
+    const int num_species_runtime,
+    const hier::IntVector& num_ghosts_sound_speed,
+    const hier::IntVector& num_ghosts_density,
+    const hier::IntVector& num_ghosts_mass_fractions,
+    const hier::IntVector& num_ghosts_pressure,
+    const hier::IntVector& ghostcell_dims_sound_speed,
+    const hier::IntVector& ghostcell_dims_density,
+    const hier::IntVector& ghostcell_dims_mass_fractions,
+    const hier::IntVector& ghostcell_dims_pressure,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    // The number of species is known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_sound_speed, offset_density, offset_mass_fractions, offset_pressure;
+    int stride_sound_speed[3], stride_density[3], stride_mass_fractions[3], stride_pressure[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_sound_speed, stride_sound_speed, num_ghosts_sound_speed,
+        ghostcell_dims_sound_speed, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_density, stride_density, num_ghosts_density,
+        ghostcell_dims_density, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_mass_fractions, stride_mass_fractions, num_ghosts_mass_fractions,
+        ghostcell_dims_mass_fractions, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_pressure, stride_pressure, num_ghosts_pressure,
+        ghostcell_dims_pressure, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_sound_speed_j = offset_sound_speed + j*stride_sound_speed[1] + k*stride_sound_speed[2];
+            const int idx_density_j = offset_density + j*stride_density[1] + k*stride_density[2];
+            const int idx_mass_fractions_j = offset_mass_fractions + j*stride_mass_fractions[1] +
+                k*stride_mass_fractions[2];
+            const int idx_pressure_j = offset_pressure + j*stride_pressure[1] + k*stride_pressure[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                const int idx_sound_speed = idx_sound_speed_j + i;
+                const int idx_mass_fractions = idx_mass_fractions_j + i;
+                
+                double c_sq = Gamma[idx_sound_speed]*p[idx_pressure_j + i]/rho[idx_density_j + i];
+                for (int si = 0; si < num_species; si++)
+                {
+                    c_sq += Y[si][idx_mass_fractions]*Psi[si][idx_sound_speed];
+                }
+                
+                c[idx_sound_speed] = sqrt(c_sq);
+            }
+        }
+    }
+}
+
+
+/*
+ * Dispatch the sound speed kernel to the instantiations with two or three species, or with the number of
+ * species at run time otherwise.
+ */
+template<int DIM>
+static inline void computeSoundSpeedFromPressureDerivativesForNumberOfSpecies(
+    double* const c,
+    const double* const rho,
+    const std::vector<const double*>& Y,
+    const double* const p,
+    const double* const Gamma,
+    const std::vector<const double*>& Psi,
+    const int num_species,
+    const hier::IntVector& num_ghosts_sound_speed,
+    const hier::IntVector& num_ghosts_density,
+    const hier::IntVector& num_ghosts_mass_fractions,
+    const hier::IntVector& num_ghosts_pressure,
+    const hier::IntVector& ghostcell_dims_sound_speed,
+    const hier::IntVector& ghostcell_dims_density,
+    const hier::IntVector& ghostcell_dims_mass_fractions,
+    const hier::IntVector& ghostcell_dims_pressure,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    if (num_species == 2)
+    {
+        computeSoundSpeedFromPressureDerivatives<DIM, 2>(c, rho, Y, p, Gamma, Psi, num_species,
+            num_ghosts_sound_speed, num_ghosts_density, num_ghosts_mass_fractions, num_ghosts_pressure,
+            ghostcell_dims_sound_speed, ghostcell_dims_density, ghostcell_dims_mass_fractions,
+            ghostcell_dims_pressure, domain_lo, domain_dims);
+    }
+    else if (num_species == 3)
+    {
+        computeSoundSpeedFromPressureDerivatives<DIM, 3>(c, rho, Y, p, Gamma, Psi, num_species,
+            num_ghosts_sound_speed, num_ghosts_density, num_ghosts_mass_fractions, num_ghosts_pressure,
+            ghostcell_dims_sound_speed, ghostcell_dims_density, ghostcell_dims_mass_fractions,
+            ghostcell_dims_pressure, domain_lo, domain_dims);
+    }
+    else
+    {
+        computeSoundSpeedFromPressureDerivatives<DIM, 0>(c, rho, Y, p, Gamma, Psi, num_species,
+            num_ghosts_sound_speed, num_ghosts_density, num_ghosts_mass_fractions, num_ghosts_pressure,
+            ghostcell_dims_sound_speed, ghostcell_dims_density, ghostcell_dims_mass_fractions,
+            ghostcell_dims_pressure, domain_lo, domain_dims);
+    }
+}
+
 
 FlowModel::FlowModel(
     const std::string& object_name,
@@ -22,8 +586,19 @@ FlowModel::FlowModel(
         d_interior_dims(hier::IntVector::getZero(d_dim)),
         d_ghostcell_dims(hier::IntVector::getZero(d_dim)),
         d_subdomain_box(hier::Box::getEmptyBox(d_dim)),
-        d_derived_cell_data_computed(false)
+        d_derived_cell_data_computed(false),
+        d_cache_derived_cell_data(false),
+        d_cached_patch(nullptr),
+        d_use_single_pass_derived_cell_data(true)
 {
+    if (d_flow_model_db->keyExists("use_single_pass_derived_cell_data"))
+    {
+        d_use_single_pass_derived_cell_data = d_flow_model_db->getBool("use_single_pass_derived_cell_data");
+    }
+    else if (d_flow_model_db->keyExists("d_use_single_pass_derived_cell_data"))
+    {
+        d_use_single_pass_derived_cell_data = d_flow_model_db->getBool("d_use_single_pass_derived_cell_data");
+    }
 }
 
 
@@ -127,6 +702,32 @@ FlowModel::setSubdomainBox(const hier::Box& subdomain_box)
 }
 
 
+/*
+ * Start caching the cell data of derived variables.
+ */
+void
+FlowModel::startCachingDerivedCellData()
+{
+    d_cache_derived_cell_data = true;
+}
+
+
+/*
+ * Stop caching the cell data of derived variables. The cached cell data is cleared.
+ */
+void
+FlowModel::stopCachingDerivedCellData()
+{
+    d_cache_derived_cell_data = false;
+    
+    // The cell data of a registered patch is cleared when the patch is unregistered.
+    if (d_cached_patch && !d_patch)
+    {
+        clearDerivedCellData();
+    }
+}
+
+
 /*
  * Setup the Riemann solver object.
  */
@@ -194,5 +795,726 @@ void
 FlowModel::putToRestartBase(
     const HAMERS_SHARED_PTR<tbox::Database>& restart_db) const
 {
-    NULL_USE(restart_db);
+    restart_db->putBool("d_use_single_pass_derived_cell_data", d_use_single_pass_derived_cell_data);
+}
+
+
+/*
+ * Split a box into tiles such that the cell data of the given number of variables on a tile fits
+ * in cache. The box is split along the slowest varying directions first and each tile covers whole
+ * lines of cells in the x-direction.
+ */
+void
+FlowModel::getTilesOfDerivedCellData(
+    std::vector<hier::Box>& tiles,
+    const hier::Box& box,
+    const int num_variables) const
+{
+    tiles.clear();
+    
+    if (box.empty())
+    {
+        return;
+    }
+    
+    const hier::IntVector box_dims = box.numberCells();
+    
+    const int num_cells_tile = std::max(1,
+        s_num_bytes_tile_derived_cell_data/(std::max(1, num_variables)*static_cast<int>(sizeof(double))));
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        tiles.push_back(box);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        const int num_rows_tile = std::max(1, num_cells_tile/box_dims[0]);
+        
+        for (int j = box.lower(1); j <= box.upper(1); j += num_rows_tile)
+        {
+            hier::Box tile = box;
+            tile.setLower(1, j);
+            tile.setUpper(1, std::min(j + num_rows_tile - 1, box.upper(1)));
+            tiles.push_back(tile);
+        }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        const int num_cells_plane = box_dims[0]*box_dims[1];
+        
+        if (num_cells_plane <= num_cells_tile)
+        {
+            // Each tile covers one or more whole planes.
+            const int num_planes_tile = std::max(1, num_cells_tile/num_cells_plane);
+            
+            for (int k = box.lower(2); k <= box.upper(2); k += num_planes_tile)
+            {
+                hier::Box tile = box;
+                tile.setLower(2, k);
+                tile.setUpper(2, std::min(k + num_planes_tile - 1, box.upper(2)));
+                tiles.push_back(tile);
+            }
+        }
+        else
+        {
+            // Each tile covers a block of rows in a plane.
+            const int num_rows_tile = std::max(1, num_cells_tile/box_dims[0]);
+            
+            for (int k = box.lower(2); k <= box.upper(2); k++)
+            {
+                for (int j = box.lower(1); j <= box.upper(1); j += num_rows_tile)
+                {
+                    hier::Box tile = box;
+                    tile.setLower(2, k);
+                    tile.setUpper(2, k);
+                    tile.setLower(1, j);
+                    tile.setUpper(1, std::min(j + num_rows_tile - 1, box.upper(1)));
+                    tiles.push_back(tile);
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Compute the cell data of the quotient of two variables on a domain.
+ */
+void
+FlowModel::computeCellDataOfQuotient(
+    double* const quotient,
+    const double* const numerator,
+    const double* const denominator,
+    const hier::IntVector& num_ghosts_quotient,
+    const hier::IntVector& num_ghosts_numerator,
+    const hier::IntVector& num_ghosts_denominator,
+    const hier::IntVector& ghostcell_dims_quotient,
+    const hier::IntVector& ghostcell_dims_numerator,
+    const hier::IntVector& ghostcell_dims_denominator,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeQuotient<1>(
+            quotient,
+            numerator,
+            denominator,
+            num_ghosts_quotient,
+            num_ghosts_numerator,
+            num_ghosts_denominator,
+            ghostcell_dims_quotient,
+            ghostcell_dims_numerator,
+            ghostcell_dims_denominator,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeQuotient<2>(
+            quotient,
+            numerator,
+            denominator,
+            num_ghosts_quotient,
+            num_ghosts_numerator,
+            num_ghosts_denominator,
+            ghostcell_dims_quotient,
+            ghostcell_dims_numerator,
+            ghostcell_dims_denominator,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeQuotient<3>(
+            quotient,
+            numerator,
+            denominator,
+            num_ghosts_quotient,
+            num_ghosts_numerator,
+            num_ghosts_denominator,
+            ghostcell_dims_quotient,
+            ghostcell_dims_numerator,
+            ghostcell_dims_denominator,
+            domain_lo,
+            domain_dims);
+    }
+}
+
+
+/*
+ * Compute the cell data of velocity from momentum and density on a domain.
+ */
+void
+FlowModel::computeCellDataOfVelocityFromMomentum(
+    const std::vector<double*>& velocity,
+    const std::vector<const double*>& momentum,
+    const double* const rho,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& num_ghosts_momentum,
+    const hier::IntVector& num_ghosts_density,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& ghostcell_dims_momentum,
+    const hier::IntVector& ghostcell_dims_density,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeVelocity<1>(
+            velocity,
+            momentum,
+            rho,
+            num_ghosts_velocity,
+            num_ghosts_momentum,
+            num_ghosts_density,
+            ghostcell_dims_velocity,
+            ghostcell_dims_momentum,
+            ghostcell_dims_density,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeVelocity<2>(
+            velocity,
+            momentum,
+            rho,
+            num_ghosts_velocity,
+            num_ghosts_momentum,
+            num_ghosts_density,
+            ghostcell_dims_velocity,
+            ghostcell_dims_momentum,
+            ghostcell_dims_density,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeVelocity<3>(
+            velocity,
+            momentum,
+            rho,
+            num_ghosts_velocity,
+            num_ghosts_momentum,
+            num_ghosts_density,
+            ghostcell_dims_velocity,
+            ghostcell_dims_momentum,
+            ghostcell_dims_density,
+            domain_lo,
+            domain_dims);
+    }
+}
+
+
+/*
+ * Compute the cell data of the product of two variables on a domain.
+ */
+void
+FlowModel::computeCellDataOfProduct(
+    double* const product,
+    const double* const factor_a,
+    const double* const factor_b,
+    const hier::IntVector& num_ghosts_product,
+    const hier::IntVector& num_ghosts_factor_a,
+    const hier::IntVector& num_ghosts_factor_b,
+    const hier::IntVector& ghostcell_dims_product,
+    const hier::IntVector& ghostcell_dims_factor_a,
+    const hier::IntVector& ghostcell_dims_factor_b,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeProduct<1>(
+            product,
+            factor_a,
+            factor_b,
+            num_ghosts_product,
+            num_ghosts_factor_a,
+            num_ghosts_factor_b,
+            ghostcell_dims_product,
+            ghostcell_dims_factor_a,
+            ghostcell_dims_factor_b,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeProduct<2>(
+            product,
+            factor_a,
+            factor_b,
+            num_ghosts_product,
+            num_ghosts_factor_a,
+            num_ghosts_factor_b,
+            ghostcell_dims_product,
+            ghostcell_dims_factor_a,
+            ghostcell_dims_factor_b,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeProduct<3>(
+            product,
+            factor_a,
+            factor_b,
+            num_ghosts_product,
+            num_ghosts_factor_a,
+            num_ghosts_factor_b,
+            ghostcell_dims_product,
+            ghostcell_dims_factor_a,
+            ghostcell_dims_factor_b,
+            domain_lo,
+            domain_dims);
+    }
+}
+
+
+/*
+ * Compute the cell data of a copy of a variable on a domain.
+ */
+void
+FlowModel::computeCellDataOfCopy(
+    double* const copy,
+    const double* const data,
+    const hier::IntVector& num_ghosts_copy,
+    const hier::IntVector& num_ghosts_data,
+    const hier::IntVector& ghostcell_dims_copy,
+    const hier::IntVector& ghostcell_dims_data,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeCopy<1>(
+            copy,
+            data,
+            num_ghosts_copy,
+            num_ghosts_data,
+            ghostcell_dims_copy,
+            ghostcell_dims_data,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeCopy<2>(
+            copy,
+            data,
+            num_ghosts_copy,
+            num_ghosts_data,
+            ghostcell_dims_copy,
+            ghostcell_dims_data,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeCopy<3>(
+            copy,
+            data,
+            num_ghosts_copy,
+            num_ghosts_data,
+            ghostcell_dims_copy,
+            ghostcell_dims_data,
+            domain_lo,
+            domain_dims);
+    }
+}
+
+
+/*
+ * Compute the cell data of internal energy from total energy, density and velocity on a domain.
+ */
+void
+FlowModel::computeCellDataOfInternalEnergyFromTotalEnergy(
+    double* const epsilon,
+    const double* const E,
+    const double* const rho,
+    const std::vector<const double*>& velocity,
+    const hier::IntVector& num_ghosts_internal_energy,
+    const hier::IntVector& num_ghosts_total_energy,
+    const hier::IntVector& num_ghosts_density,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& ghostcell_dims_internal_energy,
+    const hier::IntVector& ghostcell_dims_total_energy,
+    const hier::IntVector& ghostcell_dims_density,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeInternalEnergy<1>(
+            epsilon,
+            E,
+            rho,
+            velocity,
+            num_ghosts_internal_energy,
+            num_ghosts_total_energy,
+            num_ghosts_density,
+            num_ghosts_velocity,
+            ghostcell_dims_internal_energy,
+            ghostcell_dims_total_energy,
+            ghostcell_dims_density,
+            ghostcell_dims_velocity,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeInternalEnergy<2>(
+            epsilon,
+            E,
+            rho,
+            velocity,
+            num_ghosts_internal_energy,
+            num_ghosts_total_energy,
+            num_ghosts_density,
+            num_ghosts_velocity,
+            ghostcell_dims_internal_energy,
+            ghostcell_dims_total_energy,
+            ghostcell_dims_density,
+            ghostcell_dims_velocity,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeInternalEnergy<3>(
+            epsilon,
+            E,
+            rho,
+            velocity,
+            num_ghosts_internal_energy,
+            num_ghosts_total_energy,
+            num_ghosts_density,
+            num_ghosts_velocity,
+            ghostcell_dims_internal_energy,
+            ghostcell_dims_total_energy,
+            ghostcell_dims_density,
+            ghostcell_dims_velocity,
+            domain_lo,
+            domain_dims);
+    }
+}
+
+
+/*
+ * Compute the cell data of the components of the convective flux of momentum and total energy in a direction
+ * on a domain.
+ */
+void
+FlowModel::computeCellDataOfConvectiveFluxOfMomentumAndTotalEnergy(
+    const std::vector<double*>& convective_flux,
+    const int ei_momentum,
+    const std::vector<const double*>& momentum,
+    const double* const E,
+    const double* const velocity_component,
+    const double* const p,
+    const hier::IntVector& num_ghosts_convective_flux,
+    const hier::IntVector& num_ghosts_conservative_variables,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& num_ghosts_pressure,
+    const hier::IntVector& ghostcell_dims_convective_flux,
+    const hier::IntVector& ghostcell_dims_conservative_variables,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& ghostcell_dims_pressure,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims,
+    const DIRECTION::TYPE& direction) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(static_cast<int>(direction) < d_dim.getValue());
+    TBOX_ASSERT(static_cast<int>(convective_flux.size()) >= ei_momentum + d_dim.getValue() + 1);
+#endif
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeConvectiveFluxOfMomentumAndTotalEnergy<1, 0>(
+            convective_flux,
+            ei_momentum,
+            momentum,
+            E,
+            velocity_component,
+            p,
+            num_ghosts_convective_flux,
+            num_ghosts_conservative_variables,
+            num_ghosts_velocity,
+            num_ghosts_pressure,
+            ghostcell_dims_convective_flux,
+            ghostcell_dims_conservative_variables,
+            ghostcell_dims_velocity,
+            ghostcell_dims_pressure,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        if (direction == DIRECTION::X_DIRECTION)
+        {
+            computeConvectiveFluxOfMomentumAndTotalEnergy<2, 0>(
+                convective_flux,
+                ei_momentum,
+                momentum,
+                E,
+                velocity_component,
+                p,
+                num_ghosts_convective_flux,
+                num_ghosts_conservative_variables,
+                num_ghosts_velocity,
+                num_ghosts_pressure,
+                ghostcell_dims_convective_flux,
+                ghostcell_dims_conservative_variables,
+                ghostcell_dims_velocity,
+                ghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+        }
+        else if (direction == DIRECTION::Y_DIRECTION)
+        {
+            computeConvectiveFluxOfMomentumAndTotalEnergy<2, 1>(
+                convective_flux,
+                ei_momentum,
+                momentum,
+                E,
+                velocity_component,
+                p,
+                num_ghosts_convective_flux,
+                num_ghosts_conservative_variables,
+                num_ghosts_velocity,
+                num_ghosts_pressure,
+                ghostcell_dims_convective_flux,
+                ghostcell_dims_conservative_variables,
+                ghostcell_dims_velocity,
+                ghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+        }
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        if (direction == DIRECTION::X_DIRECTION)
+        {
+            computeConvectiveFluxOfMomentumAndTotalEnergy<3, 0>(
+                convective_flux,
+                ei_momentum,
+                momentum,
+                E,
+                velocity_component,
+                p,
+                num_ghosts_convective_flux,
+                num_ghosts_conservative_variables,
+                num_ghosts_velocity,
+                num_ghosts_pressure,
+                ghostcell_dims_convective_flux,
+                ghostcell_dims_conservative_variables,
+                ghostcell_dims_velocity,
+                ghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+        }
+        else if (direction == DIRECTION::Y_DIRECTION)
+        {
+            computeConvectiveFluxOfMomentumAndTotalEnergy<3, 1>(
+                convective_flux,
+                ei_momentum,
+                momentum,
+                E,
+                velocity_component,
+                p,
+                num_ghosts_convective_flux,
+                num_ghosts_conservative_variables,
+                num_ghosts_velocity,
+                num_ghosts_pressure,
+                ghostcell_dims_convective_flux,
+                ghostcell_dims_conservative_variables,
+                ghostcell_dims_velocity,
+                ghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+        }
+        else if (direction == DIRECTION::Z_DIRECTION)
+        {
+            computeConvectiveFluxOfMomentumAndTotalEnergy<3, 2>(
+                convective_flux,
+                ei_momentum,
+                momentum,
+                E,
+                velocity_component,
+                p,
+                num_ghosts_convective_flux,
+                num_ghosts_conservative_variables,
+                num_ghosts_velocity,
+                num_ghosts_pressure,
+                ghostcell_dims_convective_flux,
+                ghostcell_dims_conservative_variables,
+                ghostcell_dims_velocity,
+                ghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+        }
+    }
+}
+
+
+/*
+ * Compute the cell data of maximum wave speed from the velocity component in a direction and sound speed
+ * on a domain.
+ */
+void
+FlowModel::computeCellDataOfMaxWaveSpeedFromVelocityComponent(
+    double* const lambda_max,
+    const double* const velocity_component,
+    const double* const c,
+    const hier::IntVector& num_ghosts_max_wave_speed,
+    const hier::IntVector& num_ghosts_velocity,
+    const hier::IntVector& num_ghosts_sound_speed,
+    const hier::IntVector& ghostcell_dims_max_wave_speed,
+    const hier::IntVector& ghostcell_dims_velocity,
+    const hier::IntVector& ghostcell_dims_sound_speed,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeMaxWaveSpeed<1>(
+            lambda_max,
+            velocity_component,
+            c,
+            num_ghosts_max_wave_speed,
+            num_ghosts_velocity,
+            num_ghosts_sound_speed,
+            ghostcell_dims_max_wave_speed,
+            ghostcell_dims_velocity,
+            ghostcell_dims_sound_speed,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeMaxWaveSpeed<2>(
+            lambda_max,
+            velocity_component,
+            c,
+            num_ghosts_max_wave_speed,
+            num_ghosts_velocity,
+            num_ghosts_sound_speed,
+            ghostcell_dims_max_wave_speed,
+            ghostcell_dims_velocity,
+            ghostcell_dims_sound_speed,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeMaxWaveSpeed<3>(
+            lambda_max,
+            velocity_component,
+            c,
+            num_ghosts_max_wave_speed,
+            num_ghosts_velocity,
+            num_ghosts_sound_speed,
+            ghostcell_dims_max_wave_speed,
+            ghostcell_dims_velocity,
+            ghostcell_dims_sound_speed,
+            domain_lo,
+            domain_dims);
+    }
+}
+
+
+/*
+ * Compute the cell data of sound speed of a multi-species mixture from the Gruneisen parameter and the partial
+ * derivatives of pressure with respect to the partial densities on a domain.
+ */
+void
+FlowModel::computeCellDataOfSoundSpeedFromPressureDerivatives(
+    double* const c,
+    const double* const rho,
+    const std::vector<const double*>& Y,
+    const double* const p,
+    const double* const Gamma,
+    const std::vector<const double*>& Psi,
+    const hier::IntVector& num_ghosts_sound_speed,
+    const hier::IntVector& num_ghosts_density,
+    const hier::IntVector& num_ghosts_mass_fractions,
+    const hier::IntVector& num_ghosts_pressure,
+    const hier::IntVector& ghostcell_dims_sound_speed,
+    const hier::IntVector& ghostcell_dims_density,
+    const hier::IntVector& ghostcell_dims_mass_fractions,
+    const hier::IntVector& ghostcell_dims_pressure,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(static_cast<int>(Y.size()) == d_num_species);
+    TBOX_ASSERT(static_cast<int>(Psi.size()) == d_num_species);
+#endif
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeSoundSpeedFromPressureDerivativesForNumberOfSpecies<1>(
+            c,
+            rho,
+            Y,
+            p,
+            Gamma,
+            Psi,
+            d_num_species,
+            num_ghosts_sound_speed,
+            num_ghosts_density,
+            num_ghosts_mass_fractions,
+            num_ghosts_pressure,
+            ghostcell_dims_sound_speed,
+            ghostcell_dims_density,
+            ghostcell_dims_mass_fractions,
+            ghostcell_dims_pressure,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeSoundSpeedFromPressureDerivativesForNumberOfSpecies<2>(
+            c,
+            rho,
+            Y,
+            p,
+            Gamma,
+            Psi,
+            d_num_species,
+            num_ghosts_sound_speed,
+            num_ghosts_density,
+            num_ghosts_mass_fractions,
+            num_ghosts_pressure,
+            ghostcell_dims_sound_speed,
+            ghostcell_dims_density,
+            ghostcell_dims_mass_fractions,
+            ghostcell_dims_pressure,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeSoundSpeedFromPressureDerivativesForNumberOfSpecies<3>(
+            c,
+            rho,
+            Y,
+            p,
+            Gamma,
+            Psi,
+            d_num_species,
+            num_ghosts_sound_speed,
+            num_ghosts_density,
+            num_ghosts_mass_fractions,
+            num_ghosts_pressure,
+            ghostcell_dims_sound_speed,
+            ghostcell_dims_density,
+            ghostcell_dims_mass_fractions,
+            ghostcell_dims_pressure,
+            domain_lo,
+            domain_dims);
+    }
 }
@@ -0,0 +1,154 @@
+#include "flow/flow_models/FlowModelBasicUtilities.hpp"
+#include "util/Padded3DIndexing.hpp"
+
+/*
+ * Kernel to compute the simple averages of cell data at the faces in the direction di. The number of
+ * dimensions DIM is fixed at compile time.
+ */
+template<int DIM>
+static inline __attribute__((always_inline)) void computeSimpleAverageAtFaces(
+    double* const data_average,
+    const double* const data,
+    const hier::IntVector& num_ghosts_average,
+    const hier::IntVector& num_ghosts_data,
+    const hier::IntVector& ghostcell_dims_average,
+    const hier::IntVector& ghostcell_dims_data,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims,
+    const int& di)
+{
+    /*
+     * Get the bounds of the loops, the linear index offsets and the strides of the data padded to three
+     * dimensions.
+     */
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    const int lo_0 = lo[0];
+    const int lo_1 = lo[1];
+    const int lo_2 = lo[2];
+    const int hi_0 = hi[0];
+    const int hi_1 = hi[1];
+    const int hi_2 = hi[2];
+    
+    int offset_average;
+    int stride_average[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_average,
+        stride_average,
+        num_ghosts_average,
+        ghostcell_dims_average,
+        di);
+    
+    const int stride_1_average = stride_average[1];
+    const int stride_2_average = stride_average[2];
+    
+    int offset_data;
+    int stride_data[3];
+    computeOffsetAndStridesPadded3D<DIM>(
+        offset_data,
+        stride_data,
+        num_ghosts_data,
+        ghostcell_dims_data,
+        -1);
+    
+    const int stride_1_data = stride_data[1];
+    const int stride_2_data = stride_data[2];
+    
+    const int stride_di_data = stride_data[di];
+    
+    for (int k = lo_2; k < hi_2; k++)
+    {
+        for (int j = lo_1; j < hi_1; j++)
+        {
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo_0; i < hi_0; i++)
+            {
+                // Compute the linear indices.
+                const int idx_face = offset_average + i + j*stride_1_average + k*stride_2_average;
+                
+                const int idx_R = offset_data + i + j*stride_1_data + k*stride_2_data;
+                const int idx_L = idx_R - stride_di_data;
+                
+                data_average[idx_face] = double(1)/double(2)*(data[idx_L] + data[idx_R]);
+            }
+        }
+    }
+}
+
+
+/*
+ * Compute the simple averages of cell data of a variable at the faces in a direction, including the ghost
+ * faces of the side data in that direction.
+ */
+void
+FlowModelBasicUtilities::computeSideDataOfSimpleAverageOfCellData(
+    double* const data_average,
+    const double* const data,
+    const hier::IntVector& num_ghosts_average,
+    const hier::IntVector& num_ghosts_data,
+    const hier::IntVector& ghostcell_dims_average,
+    const hier::IntVector& ghostcell_dims_data,
+    const hier::IntVector& interior_dims,
+    const int direction) const
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(direction >= 0 && direction < d_dim.getValue());
+    TBOX_ASSERT(num_ghosts_average <= num_ghosts_data);
+#endif
+    
+    /*
+     * The faces in the direction span the ghost faces of the averages in that direction and the interior
+     * in the other directions.
+     */
+    
+    hier::IntVector domain_lo = hier::IntVector::getZero(d_dim);
+    hier::IntVector domain_dims = interior_dims;
+    
+    domain_lo[direction] = -num_ghosts_average[direction];
+    domain_dims[direction] = interior_dims[direction] + 1 + 2*num_ghosts_average[direction];
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeSimpleAverageAtFaces<1>(
+            data_average,
+            data,
+            num_ghosts_average,
+            num_ghosts_data,
+            ghostcell_dims_average,
+            ghostcell_dims_data,
+            domain_lo,
+            domain_dims,
+            direction);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeSimpleAverageAtFaces<2>(
+            data_average,
+            data,
+            num_ghosts_average,
+            num_ghosts_data,
+            ghostcell_dims_average,
+            ghostcell_dims_data,
+            domain_lo,
+            domain_dims,
+            direction);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeSimpleAverageAtFaces<3>(
+            data_average,
+            data,
+            num_ghosts_average,
+            num_ghosts_data,
+            ghostcell_dims_average,
+            ghostcell_dims_data,
+            domain_lo,
+            domain_dims,
+            direction);
+    }
+}
@@ -22,11 +22,8 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -104,11 +101,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 
                 const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -134,25 +133,10 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -253,11 +237,15 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -291,25 +279,12 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -413,11 +388,17 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -458,25 +439,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -536,11 +505,8 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -618,11 +584,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 
                 const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -648,25 +616,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -767,11 +720,15 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -805,25 +762,12 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -927,11 +871,17 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -972,25 +922,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -1054,11 +992,8 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -1148,11 +1083,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -1183,25 +1120,10 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -1323,11 +1245,15 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -1371,25 +1297,12 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -1515,11 +1428,17 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -1574,25 +1493,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -1670,11 +1577,8 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -1764,11 +1668,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -1799,25 +1705,10 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -1944,11 +1835,15 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -1992,25 +1887,12 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -2140,11 +2022,17 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -2199,25 +2087,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -2392,11 +2268,8 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -2503,11 +2376,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -2573,25 +2448,10 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -2769,11 +2629,15 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -2867,25 +2731,12 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -3078,11 +2929,17 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -3200,25 +3057,13 @@ FlowModelMPIHelperAverage::getAveragedQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -3366,11 +3211,8 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -3470,11 +3312,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -3563,25 +3407,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and add the data.
@@ -3712,11 +3541,15 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -3844,25 +3677,12 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and add the data.
@@ -4002,11 +3822,17 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -4172,25 +3998,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -4246,11 +4060,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
      * location in the problem space. Coarsest and finest levels are both set to zero.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            0));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, 0);
     
     /*
      * Get the indices of the physical domain.
@@ -4327,11 +4138,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            
             const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
             
             const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -4355,25 +4168,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                 for (int i = 0; i < interior_dim_0; i++)
                 {
                     /*
-                     * Compute the index of the data point and count how many times the data is repeated.
+                     * Get how many times the data is repeated from the mask of the patch.
                      */
                     
-                    const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                    
-                    int n_overlapped = 1;
-                    
-                    for (hier::BoxContainer::BoxContainerConstIterator iob(
-                            patch_overlapped_visible_boxes.begin());
-                         iob != patch_overlapped_visible_boxes.end();
-                         iob++)
-                    {
-                        const hier::Box& patch_overlapped_visible_box = *iob;
-                        
-                        if (patch_overlapped_visible_box.contains(idx_pt))
-                        {
-                            n_overlapped++;
-                        }
-                    }
+                    const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                     
                     /*
                      * Compute the linear indices and the data to add.
@@ -4399,12 +4197,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -4488,11 +4284,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            
             const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
             const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
             
@@ -4526,25 +4326,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[
+                            (idx_lo_0 + i - patch_lo_0) +
+                            (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -4573,12 +4360,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -4663,11 +4448,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_lo_2 = patch_box.lower(2);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            const int patch_dim_1 = patch_box.numberCells(1);
+            
             const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
             const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
             
@@ -4708,25 +4499,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -4758,12 +4537,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -4788,11 +4565,8 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
      * location in the problem space. Coarsest and finest levels are both set to zero.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            0));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, 0);
     
     /*
      * Get the indices of the physical domain.
@@ -4869,11 +4643,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            
             const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
             
             const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -4897,25 +4673,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                 for (int i = 0; i < interior_dim_0; i++)
                 {
                     /*
-                     * Compute the index of the data point and count how many times the data is repeated.
+                     * Get how many times the data is repeated from the mask of the patch.
                      */
                     
-                    const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                    
-                    int n_overlapped = 1;
-                    
-                    for (hier::BoxContainer::BoxContainerConstIterator iob(
-                            patch_overlapped_visible_boxes.begin());
-                         iob != patch_overlapped_visible_boxes.end();
-                         iob++)
-                    {
-                        const hier::Box& patch_overlapped_visible_box = *iob;
-                        
-                        if (patch_overlapped_visible_box.contains(idx_pt))
-                        {
-                            n_overlapped++;
-                        }
-                    }
+                    const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                     
                     /*
                      * Compute the linear indices and the data to add.
@@ -4941,12 +4702,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(u_inv_avg_local);
     }
@@ -5030,11 +4789,15 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            
             const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
             const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
             
@@ -5068,25 +4831,12 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[
+                            (idx_lo_0 + i - patch_lo_0) +
+                            (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -5115,12 +4865,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(u_inv_avg_local);
     }
@@ -5205,11 +4953,17 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_lo_2 = patch_box.lower(2);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            const int patch_dim_1 = patch_box.numberCells(1);
+            
             const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
             const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
             
@@ -5250,25 +5004,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -5300,12 +5042,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(u_inv_avg_local);
     }
@@ -5361,11 +5101,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
      * location in the problem space. Coarsest and finest levels are both set to zero.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            0));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, 0);
     
     /*
      * Get the indices of the physical domain.
@@ -5454,11 +5191,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            
             std::vector<int> num_ghosts_0_u_qi;
             num_ghosts_0_u_qi.reserve(num_quantities);
             
@@ -5487,25 +5226,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                 for (int i = 0; i < interior_dim_0; i++)
                 {
                     /*
-                     * Compute the index of the data point and count how many times the data is repeated.
+                     * Get how many times the data is repeated from the mask of the patch.
                      */
                     
-                    const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                    
-                    int n_overlapped = 1;
-                    
-                    for (hier::BoxContainer::BoxContainerConstIterator iob(
-                            patch_overlapped_visible_boxes.begin());
-                         iob != patch_overlapped_visible_boxes.end();
-                         iob++)
-                    {
-                        const hier::Box& patch_overlapped_visible_box = *iob;
-                        
-                        if (patch_overlapped_visible_box.contains(idx_pt))
-                        {
-                            n_overlapped++;
-                        }
-                    }
+                    const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                     
                     /*
                      * Compute the linear indices and the data to add.
@@ -5544,12 +5268,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -5645,11 +5367,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            
             std::vector<int> num_ghosts_0_u_qi;
             std::vector<int> num_ghosts_1_u_qi;
             std::vector<int> ghostcell_dim_0_u_qi;
@@ -5693,25 +5419,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[
+                            (idx_lo_0 + i - patch_lo_0) +
+                            (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -5752,12 +5465,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -5854,11 +5565,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_lo_2 = patch_box.lower(2);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            const int patch_dim_1 = patch_box.numberCells(1);
+            
             std::vector<int> num_ghosts_0_u_qi;
             std::vector<int> num_ghosts_1_u_qi;
             std::vector<int> num_ghosts_2_u_qi;
@@ -5913,25 +5630,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -5975,12 +5680,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -6106,11 +5809,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
      * location in the problem space. Coarsest and finest levels are both set to zero.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            0));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, 0);
     
     /*
      * Get the indices of the physical domain.
@@ -6222,11 +5922,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            
             std::vector<int> num_ghosts_0_u_qi;
             num_ghosts_0_u_qi.reserve(num_quantities);
             
@@ -6290,25 +5992,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                 for (int i = 0; i < interior_dim_0; i++)
                 {
                     /*
-                     * Compute the index of the data point and count how many times the data is repeated.
+                     * Get how many times the data is repeated from the mask of the patch.
                      */
                     
-                    const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                    
-                    int n_overlapped = 1;
-                    
-                    for (hier::BoxContainer::BoxContainerConstIterator iob(
-                            patch_overlapped_visible_boxes.begin());
-                         iob != patch_overlapped_visible_boxes.end();
-                         iob++)
-                    {
-                        const hier::Box& patch_overlapped_visible_box = *iob;
-                        
-                        if (patch_overlapped_visible_box.contains(idx_pt))
-                        {
-                            n_overlapped++;
-                        }
-                    }
+                    const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                     
                     /*
                      * Compute the linear indices and the data to add.
@@ -6370,12 +6057,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -6495,11 +6180,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            
             std::vector<int> num_ghosts_0_u_qi;
             std::vector<int> num_ghosts_1_u_qi;
             std::vector<int> ghostcell_dim_0_u_qi;
@@ -6593,25 +6282,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[
+                            (idx_lo_0 + i - patch_lo_0) +
+                            (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -6680,12 +6356,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -6813,11 +6487,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_lo_2 = patch_box.lower(2);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            const int patch_dim_1 = patch_box.numberCells(1);
+            
             std::vector<int> num_ghosts_0_u_qi;
             std::vector<int> num_ghosts_1_u_qi;
             std::vector<int> num_ghosts_2_u_qi;
@@ -6935,25 +6615,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -7031,12 +6699,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirectionOnCoars
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -7098,11 +6764,8 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
      * location in the problem space. Coarsest and finest levels are both set to zero.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            0));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, 0);
     
     /*
      * Get the indices of the physical domain.
@@ -7207,11 +6870,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            
             std::vector<int> num_ghosts_0_u_qi;
             num_ghosts_0_u_qi.reserve(num_quantities);
             
@@ -7298,25 +6963,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                 for (int i = 0; i < interior_dim_0; i++)
                 {
                     /*
-                     * Compute the index of the data point and count how many times the data is repeated.
+                     * Get how many times the data is repeated from the mask of the patch.
                      */
                     
-                    const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                    
-                    int n_overlapped = 1;
-                    
-                    for (hier::BoxContainer::BoxContainerConstIterator iob(
-                            patch_overlapped_visible_boxes.begin());
-                         iob != patch_overlapped_visible_boxes.end();
-                         iob++)
-                    {
-                        const hier::Box& patch_overlapped_visible_box = *iob;
-                        
-                        if (patch_overlapped_visible_box.contains(idx_pt))
-                        {
-                            n_overlapped++;
-                        }
-                    }
+                    const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                     
                     /*
                      * Compute the linear indices and the data to add.
@@ -7343,12 +6993,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(der_avg_local);
     }
@@ -7461,11 +7109,15 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            
             std::vector<int> num_ghosts_0_u_qi;
             std::vector<int> num_ghosts_1_u_qi;
             std::vector<int> ghostcell_dim_0_u_qi;
@@ -7593,25 +7245,12 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[
+                            (idx_lo_0 + i - patch_lo_0) +
+                            (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -7640,12 +7279,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(der_avg_local);
     }
@@ -7766,11 +7403,17 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                     patch_box,
                     0);
             
-            const hier::BoxContainer& patch_overlapped_visible_boxes =
-                flattened_hierarchy->getOverlappedVisibleBoxes(
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
                     patch_box,
                     0);
             
+            const int patch_lo_0 = patch_box.lower(0);
+            const int patch_lo_1 = patch_box.lower(1);
+            const int patch_lo_2 = patch_box.lower(2);
+            const int patch_dim_0 = patch_box.numberCells(0);
+            const int patch_dim_1 = patch_box.numberCells(1);
+            
             std::vector<int> num_ghosts_0_u_qi;
             std::vector<int> num_ghosts_1_u_qi;
             std::vector<int> num_ghosts_2_u_qi;
@@ -7936,25 +7579,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -7986,12 +7617,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            coarsest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            coarsest_level_dim_0);
         
         std::free(der_avg_local);
     }
@@ -8018,11 +7647,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -8117,11 +7743,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 
                 const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -8145,25 +7773,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -8194,12 +7807,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -8301,11 +7912,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -8339,25 +7954,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -8390,12 +7992,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -8498,11 +8098,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -8543,25 +8149,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -8597,12 +8191,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -8629,11 +8221,8 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -8728,11 +8317,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 
                 const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -8756,25 +8347,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -8805,12 +8381,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_inv_avg_local);
     }
@@ -8912,11 +8486,15 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -8950,25 +8528,12 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -9001,12 +8566,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_inv_avg_local);
     }
@@ -9109,11 +8672,17 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -9154,25 +8723,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -9208,12 +8765,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_inv_avg_local);
     }
@@ -9269,11 +8824,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -9380,11 +8932,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -9413,25 +8967,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -9474,12 +9013,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -9593,11 +9130,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -9641,25 +9182,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -9704,12 +9232,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -9824,11 +9350,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -9883,25 +9415,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -9949,12 +9469,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -10080,11 +9598,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -10214,11 +9729,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -10282,25 +9799,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -10370,12 +9872,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -10513,11 +10013,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -10611,25 +10115,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -10706,12 +10197,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -10857,11 +10346,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -10979,25 +10474,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -11083,12 +10566,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -11151,11 +10632,8 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -11278,11 +10756,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -11369,25 +10849,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -11422,12 +10887,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(der_avg_local);
     }
@@ -11558,11 +11021,15 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -11690,25 +11157,12 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -11745,12 +11199,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(der_avg_local);
     }
@@ -11889,11 +11341,17 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -12059,25 +11517,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -12117,12 +11563,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(der_avg_local);
     }
@@ -12132,56 +11576,596 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousXDire
 
 
 /*
- * Compute averaged value with only y-direction as inhomogeneous direction.
+ * Compute averaged values (on products of variables) of several products with only x-direction as
+ * inhomogeneous direction.
  */
-std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
-    const std::string quantity_name,
-    const int component_idx,
+std::vector<std::vector<double> >
+FlowModelMPIHelperAverage::getAveragedQuantitiesWithInhomogeneousXDirection(
+    const std::vector<std::vector<std::string> >& quantity_names,
+    const std::vector<std::vector<int> >& component_indices,
     const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
 {
-    std::vector<double> averaged_quantity;
-    
-    const int num_levels = d_patch_hierarchy->getNumberOfLevels();
-    
-    /*
-     * Get the flattened hierarchy where only the finest existing grid is visible at any given
-     * location in the problem space.
-     */
-    
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
-    
-    /*
-     * Get the indices of the physical domain.
-     */
+    int num_products = static_cast<int>(quantity_names.size());
     
-    const double* x_lo = d_grid_geometry->getXLower();
-    const double* x_hi = d_grid_geometry->getXUpper();
+    TBOX_ASSERT(static_cast<int>(component_indices.size()) == num_products);
     
-    if (d_dim == tbox::Dimension(1))
+    std::vector<std::vector<bool> > use_reciprocal(num_products);
+    for (int pi = 0; pi < num_products; pi++)
     {
-        TBOX_ERROR(d_object_name
-            << ": FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection():\n"
-            << "Cannot compute averaged value with only y-direction as inhomogeneous direction for"
-            << " one-dimensional problem."
-            << std::endl);
+        use_reciprocal[pi].resize(quantity_names[pi].size(), false);
     }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        const int finest_level_dim_1 = d_finest_level_dims[1];
-        
-        /*
-         * Get the size of the physical domain.
-         */
-        
-        const double L_x = x_hi[0] - x_lo[0];
-        
-        double* u_avg_local = (double*)std::malloc(finest_level_dim_1*sizeof(double));
-        
-        averaged_quantity.resize(finest_level_dim_1);
+    
+    return getAveragedQuantitiesWithInhomogeneousXDirection(
+        quantity_names,
+        component_indices,
+        use_reciprocal,
+        data_context);
+}
+
+
+/*
+ * Compute averaged values (on products of variables) of several products with only x-direction as
+ * inhomogeneous direction.
+ */
+std::vector<std::vector<double> >
+FlowModelMPIHelperAverage::getAveragedQuantitiesWithInhomogeneousXDirection(
+    const std::vector<std::vector<std::string> >& quantity_names,
+    const std::vector<std::vector<int> >& component_indices,
+    const std::vector<std::vector<bool> >& use_reciprocal,
+    const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
+{
+    startAveragedQuantitiesWithInhomogeneousXDirection(
+        quantity_names,
+        component_indices,
+        use_reciprocal,
+        data_context);
+    
+    return finishAveragedQuantitiesWithInhomogeneousXDirection();
+}
+
+
+/*
+ * Start computing averaged values (on products of variables) of several products with only x-direction
+ * as inhomogeneous direction. Each patch is only visited once to compute all the products and the
+ * averages of all the products are packed into a single reduction, which is left in progress.
+ */
+void
+FlowModelMPIHelperAverage::startAveragedQuantitiesWithInhomogeneousXDirection(
+    const std::vector<std::vector<std::string> >& quantity_names,
+    const std::vector<std::vector<int> >& component_indices,
+    const std::vector<std::vector<bool> >& use_reciprocal,
+    const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
+{
+    if (d_is_profile_reduction_in_progress)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelMPIHelperAverage::startAveragedQuantitiesWithInhomogeneousXDirection():\n"
+            << "The averaged quantities started before are not finished yet!\n"
+            << std::endl);
+    }
+    
+    int num_products = static_cast<int>(quantity_names.size());
+    
+    TBOX_ASSERT(static_cast<int>(component_indices.size()) == num_products);
+    TBOX_ASSERT(static_cast<int>(use_reciprocal.size()) == num_products);
+    
+    /*
+     * Get the offsets of the factors of every product in the flattened arrays of factors.
+     */
+    
+    std::vector<int> factor_offsets(num_products + 1, 0);
+    
+    for (int pi = 0; pi < num_products; pi++)
+    {
+        const int num_quantities = static_cast<int>(quantity_names[pi].size());
+        
+        TBOX_ASSERT(static_cast<int>(component_indices[pi].size()) == num_quantities);
+        TBOX_ASSERT(static_cast<int>(use_reciprocal[pi].size()) == num_quantities);
+        
+        factor_offsets[pi + 1] = factor_offsets[pi] + num_quantities;
+    }
+    
+    const int num_factors = factor_offsets[num_products];
+    
+    std::vector<bool> use_reciprocal_factors;
+    use_reciprocal_factors.reserve(num_factors);
+    
+    for (int pi = 0; pi < num_products; pi++)
+    {
+        use_reciprocal_factors.insert(
+            use_reciprocal_factors.end(),
+            use_reciprocal[pi].begin(),
+            use_reciprocal[pi].end());
+    }
+    
+    const int num_levels = d_patch_hierarchy->getNumberOfLevels();
+    
+    /*
+     * Get the flattened hierarchy where only the finest existing grid is visible at any given
+     * location in the problem space.
+     */
+    
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
+    
+    /*
+     * Get the indices of the physical domain.
+     */
+    
+    const double* x_lo = d_grid_geometry->getXLower();
+    const double* x_hi = d_grid_geometry->getXUpper();
+    
+    const int finest_level_dim_0 = d_finest_level_dims[0];
+    
+    /*
+     * The averages of the products are packed one after another into the same buffers, which are
+     * kept until the reduction is finished.
+     */
+    
+    d_num_profiles = num_products;
+    d_profiles_local.assign(num_products*finest_level_dim_0, double(0));
+    d_profiles_global.assign(num_products*finest_level_dim_0, double(0));
+    
+    double* avg_local = d_profiles_local.data();
+    
+    std::vector<double*> u_qi(num_factors);
+    std::vector<int> num_ghosts_0_u_qi(num_factors);
+    std::vector<int> num_ghosts_1_u_qi(num_factors);
+    std::vector<int> num_ghosts_2_u_qi(num_factors);
+    std::vector<int> ghostcell_dim_0_u_qi(num_factors);
+    std::vector<int> ghostcell_dim_1_u_qi(num_factors);
+    
+    for (int li = 0; li < num_levels; li++)
+    {
+        /*
+         * Get the current patch level.
+         */
+        
+        HAMERS_SHARED_PTR<hier::PatchLevel> patch_level(
+            d_patch_hierarchy->getPatchLevel(li));
+        
+        /*
+         * Get the refinement ratio from current level to the finest level.
+         */
+        
+        hier::IntVector ratio_to_coarsest_level =
+            d_patch_hierarchy->getRatioToCoarserLevel(li);
+        
+        for (int lii = li - 1; lii > 0 ; lii--)
+        {
+            ratio_to_coarsest_level *= d_patch_hierarchy->getRatioToCoarserLevel(lii);
+        }
+        
+        hier::IntVector ratio_to_finest_level = d_ratio_finest_level_to_coarsest_level/ratio_to_coarsest_level;
+        
+        const int ratio_to_finest_level_0 = ratio_to_finest_level[0];
+        
+        for (hier::PatchLevel::iterator ip(patch_level->begin());
+             ip != patch_level->end();
+             ip++)
+        {
+            const HAMERS_SHARED_PTR<hier::Patch> patch = *ip;
+            
+            /*
+             * Get the patch lower indices and grid spacings.
+             */
+            
+            const hier::Box& patch_box = patch->getBox();
+            
+            const hier::Index& patch_index_lo = patch_box.lower();
+            
+            const HAMERS_SHARED_PTR<geom::CartesianPatchGeometry> patch_geom(
+                HAMERS_SHARED_PTR_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
+                    patch->getPatchGeometry()));
+            
+            const double* const dx = patch_geom->getDx();
+            
+            /*
+             * Register the patch and the data of all the products in the flow model at once and compute
+             * the corresponding averages.
+             */
+            
+            setupFlowModelAndRegisterPatchWithDataContext(*patch, data_context);
+            
+            std::unordered_map<std::string, hier::IntVector> num_subghosts_of_data;
+            
+            for (int pi = 0; pi < num_products; pi++)
+            {
+                for (int qi = 0; qi < static_cast<int>(quantity_names[pi].size()); qi++)
+                {
+                    num_subghosts_of_data.insert(
+                        std::pair<std::string, hier::IntVector>(quantity_names[pi][qi], hier::IntVector::getZero(d_dim)));
+                }
+            }
+            
+            registerDerivedVariables(num_subghosts_of_data);
+            
+            allocateMemoryForDerivedCellData();
+            
+            computeDerivedCellData();
+            
+            /*
+             * Get the pointers to data inside the flow model and the ghost cell layouts of all the factors.
+             */
+            
+            for (int pi = 0; pi < num_products; pi++)
+            {
+                for (int qi = 0; qi < static_cast<int>(quantity_names[pi].size()); qi++)
+                {
+                    const int fi = factor_offsets[pi] + qi;
+                    
+                    HAMERS_SHARED_PTR<pdat::CellData<double> > data_quantity =
+                        getCellData(quantity_names[pi][qi]);
+                    
+                    const hier::IntVector num_ghosts_u_qi = data_quantity->getGhostCellWidth();
+                    const hier::IntVector ghostcell_dims_u_qi = data_quantity->getGhostBox().numberCells();
+                    
+                    u_qi[fi] = data_quantity->getPointer(component_indices[pi][qi]);
+                    
+                    num_ghosts_0_u_qi[fi] = num_ghosts_u_qi[0];
+                    if (d_dim > tbox::Dimension(1))
+                    {
+                        num_ghosts_1_u_qi[fi] = num_ghosts_u_qi[1];
+                        ghostcell_dim_0_u_qi[fi] = ghostcell_dims_u_qi[0];
+                    }
+                    if (d_dim > tbox::Dimension(2))
+                    {
+                        num_ghosts_2_u_qi[fi] = num_ghosts_u_qi[2];
+                        ghostcell_dim_1_u_qi[fi] = ghostcell_dims_u_qi[1];
+                    }
+                }
+            }
+            
+            const hier::BoxContainer& patch_visible_boxes =
+                flattened_hierarchy->getVisibleBoxes(
+                    patch_box,
+                    li);
+            
+            const std::vector<int>& patch_overlapped_visible_cell_counts =
+                flattened_hierarchy->getOverlappedVisibleCellCounts(
+                    patch_box,
+                    li);
+            
+            if (d_dim == tbox::Dimension(1))
+            {
+                const int patch_lo_0 = patch_box.lower(0);
+                
+                for (hier::BoxContainer::BoxContainerConstIterator ib(patch_visible_boxes.begin());
+                     ib != patch_visible_boxes.end();
+                     ib++)
+                {
+                    const hier::Box& patch_visible_box = *ib;
+                    
+                    const hier::IntVector interior_dims = patch_visible_box.numberCells();
+                    
+                    const int interior_dim_0 = interior_dims[0];
+                    
+                    const hier::Index& index_lo = patch_visible_box.lower();
+                    const hier::Index relative_index_lo = index_lo - patch_index_lo;
+                    
+                    const int idx_lo_0 = index_lo[0];
+                    const int relative_idx_lo_0 = relative_index_lo[0];
+                    
+                    for (int i = 0; i < interior_dim_0; i++)
+                    {
+                        /*
+                         * Get how many times the data is repeated from the mask of the patch.
+                         */
+                        
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
+                        
+                        /*
+                         * Compute the products at the cell and add them to the averages.
+                         */
+                        
+                        for (int pi = 0; pi < num_products; pi++)
+                        {
+                            double avg = double(1);
+                            
+                            for (int fi = factor_offsets[pi]; fi < factor_offsets[pi + 1]; fi++)
+                            {
+                                const int idx_qi = relative_idx_lo_0 + i + num_ghosts_0_u_qi[fi];
+                                
+                                if (use_reciprocal_factors[fi])
+                                {
+                                    avg /= u_qi[fi][idx_qi];
+                                }
+                                else
+                                {
+                                    avg *= u_qi[fi][idx_qi];
+                                }
+                            }
+                            
+                            const double avg_to_add = avg/((double) n_overlapped);
+                            
+                            double* avg_local_pi = avg_local + pi*finest_level_dim_0;
+                            
+                            for (int ii = 0; ii < ratio_to_finest_level_0; ii++)
+                            {
+                                const int idx_fine = (idx_lo_0 + i)*ratio_to_finest_level_0 + ii;
+                                
+                                avg_local_pi[idx_fine] += avg_to_add;
+                            }
+                        }
+                    }
+                }
+            }
+            else if (d_dim == tbox::Dimension(2))
+            {
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
+                const double L_y = x_hi[1] - x_lo[1];
+                
+                const double weight = dx[1]/L_y;
+                
+                for (hier::BoxContainer::BoxContainerConstIterator ib(patch_visible_boxes.begin());
+                     ib != patch_visible_boxes.end();
+                     ib++)
+                {
+                    const hier::Box& patch_visible_box = *ib;
+                    
+                    const hier::IntVector interior_dims = patch_visible_box.numberCells();
+                    
+                    const int interior_dim_0 = interior_dims[0];
+                    const int interior_dim_1 = interior_dims[1];
+                    
+                    const hier::Index& index_lo = patch_visible_box.lower();
+                    const hier::Index relative_index_lo = index_lo - patch_index_lo;
+                    
+                    const int idx_lo_0 = index_lo[0];
+                    const int idx_lo_1 = index_lo[1];
+                    const int relative_idx_lo_0 = relative_index_lo[0];
+                    const int relative_idx_lo_1 = relative_index_lo[1];
+                    
+                    for (int j = 0; j < interior_dim_1; j++)
+                    {
+                        for (int i = 0; i < interior_dim_0; i++)
+                        {
+                            /*
+                             * Get how many times the data is repeated from the mask of the patch.
+                             */
+                            
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
+                            
+                            /*
+                             * Compute the products at the cell and add them to the averages.
+                             */
+                            
+                            for (int pi = 0; pi < num_products; pi++)
+                            {
+                                double avg = double(1);
+                                
+                                for (int fi = factor_offsets[pi]; fi < factor_offsets[pi + 1]; fi++)
+                                {
+                                    const int idx_qi = (relative_idx_lo_0 + i + num_ghosts_0_u_qi[fi]) +
+                                        (relative_idx_lo_1 + j + num_ghosts_1_u_qi[fi])*ghostcell_dim_0_u_qi[fi];
+                                    
+                                    if (use_reciprocal_factors[fi])
+                                    {
+                                        avg /= u_qi[fi][idx_qi];
+                                    }
+                                    else
+                                    {
+                                        avg *= u_qi[fi][idx_qi];
+                                    }
+                                }
+                                
+                                const double avg_to_add = avg*weight/((double) n_overlapped);
+                                
+                                double* avg_local_pi = avg_local + pi*finest_level_dim_0;
+                                
+                                for (int ii = 0; ii < ratio_to_finest_level_0; ii++)
+                                {
+                                    const int idx_fine = (idx_lo_0 + i)*ratio_to_finest_level_0 + ii;
+                                    
+                                    avg_local_pi[idx_fine] += avg_to_add;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            else if (d_dim == tbox::Dimension(3))
+            {
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
+                const double L_y = x_hi[1] - x_lo[1];
+                const double L_z = x_hi[2] - x_lo[2];
+                
+                const double weight = dx[1]*dx[2]/(L_y*L_z);
+                
+                for (hier::BoxContainer::BoxContainerConstIterator ib(patch_visible_boxes.begin());
+                     ib != patch_visible_boxes.end();
+                     ib++)
+                {
+                    const hier::Box& patch_visible_box = *ib;
+                    
+                    const hier::IntVector interior_dims = patch_visible_box.numberCells();
+                    
+                    const int interior_dim_0 = interior_dims[0];
+                    const int interior_dim_1 = interior_dims[1];
+                    const int interior_dim_2 = interior_dims[2];
+                    
+                    const hier::Index& index_lo = patch_visible_box.lower();
+                    const hier::Index relative_index_lo = index_lo - patch_index_lo;
+                    
+                    const int idx_lo_0 = index_lo[0];
+                    const int idx_lo_1 = index_lo[1];
+                    const int idx_lo_2 = index_lo[2];
+                    const int relative_idx_lo_0 = relative_index_lo[0];
+                    const int relative_idx_lo_1 = relative_index_lo[1];
+                    const int relative_idx_lo_2 = relative_index_lo[2];
+                    
+                    for (int k = 0; k < interior_dim_2; k++)
+                    {
+                        for (int j = 0; j < interior_dim_1; j++)
+                        {
+                            for (int i = 0; i < interior_dim_0; i++)
+                            {
+                                /*
+                                 * Get how many times the data is repeated from the mask of the patch.
+                                 */
+                                
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
+                                
+                                /*
+                                 * Compute the products at the cell and add them to the averages.
+                                 */
+                                
+                                for (int pi = 0; pi < num_products; pi++)
+                                {
+                                    double avg = double(1);
+                                    
+                                    for (int fi = factor_offsets[pi]; fi < factor_offsets[pi + 1]; fi++)
+                                    {
+                                        const int idx_qi = (relative_idx_lo_0 + i + num_ghosts_0_u_qi[fi]) +
+                                            (relative_idx_lo_1 + j + num_ghosts_1_u_qi[fi])*ghostcell_dim_0_u_qi[fi] +
+                                            (relative_idx_lo_2 + k + num_ghosts_2_u_qi[fi])*ghostcell_dim_0_u_qi[fi]*
+                                                ghostcell_dim_1_u_qi[fi];
+                                        
+                                        if (use_reciprocal_factors[fi])
+                                        {
+                                            avg /= u_qi[fi][idx_qi];
+                                        }
+                                        else
+                                        {
+                                            avg *= u_qi[fi][idx_qi];
+                                        }
+                                    }
+                                    
+                                    const double avg_to_add = avg*weight/((double) n_overlapped);
+                                    
+                                    double* avg_local_pi = avg_local + pi*finest_level_dim_0;
+                                    
+                                    for (int ii = 0; ii < ratio_to_finest_level_0; ii++)
+                                    {
+                                        const int idx_fine = (idx_lo_0 + i)*ratio_to_finest_level_0 + ii;
+                                        
+                                        avg_local_pi[idx_fine] += avg_to_add;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            
+            /*
+             * Unregister the patch and data of all registered derived cell variables in the flow model.
+             */
+            
+            unregisterPatch();
+        }
+    }
+    
+    /*
+     * Start the single reduction to get the global averages of all the products.
+     */
+    
+    if (num_products > 0)
+    {
+        d_is_profile_reduction_in_progress = startProfileReduction(
+            d_profiles_local.data(),
+            d_profiles_global.data(),
+            num_products*finest_level_dim_0,
+            d_profile_reduction_request);
+    }
+}
+
+
+/*
+ * Finish computing the averaged values started by startAveragedQuantitiesWithInhomogeneousXDirection().
+ */
+std::vector<std::vector<double> >
+FlowModelMPIHelperAverage::finishAveragedQuantitiesWithInhomogeneousXDirection()
+{
+    if (d_is_profile_reduction_in_progress)
+    {
+        finishProfileReduction(d_profile_reduction_request);
+        d_is_profile_reduction_in_progress = false;
+    }
+    
+    std::vector<std::vector<double> > averaged_quantities(d_num_profiles);
+    
+    if (d_num_profiles > 0)
+    {
+        const int num_points = static_cast<int>(d_profiles_global.size())/d_num_profiles;
+        
+        for (int pi = 0; pi < d_num_profiles; pi++)
+        {
+            averaged_quantities[pi].assign(
+                d_profiles_global.begin() + pi*num_points,
+                d_profiles_global.begin() + (pi + 1)*num_points);
+        }
+    }
+    
+    d_num_profiles = 0;
+    d_profiles_local.clear();
+    d_profiles_global.clear();
+    
+    return averaged_quantities;
+}
+
+
+/*
+ * Compute averaged value with only y-direction as inhomogeneous direction.
+ */
+std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
+    const std::string quantity_name,
+    const int component_idx,
+    const HAMERS_SHARED_PTR<hier::VariableContext>& data_context)
+{
+    std::vector<double> averaged_quantity;
+    
+    const int num_levels = d_patch_hierarchy->getNumberOfLevels();
+    
+    /*
+     * Get the flattened hierarchy where only the finest existing grid is visible at any given
+     * location in the problem space.
+     */
+    
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
+    
+    /*
+     * Get the indices of the physical domain.
+     */
+    
+    const double* x_lo = d_grid_geometry->getXLower();
+    const double* x_hi = d_grid_geometry->getXUpper();
+    
+    if (d_dim == tbox::Dimension(1))
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection():\n"
+            << "Cannot compute averaged value with only y-direction as inhomogeneous direction for"
+            << " one-dimensional problem."
+            << std::endl);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        const int finest_level_dim_1 = d_finest_level_dims[1];
+        
+        /*
+         * Get the size of the physical domain.
+         */
+        
+        const double L_x = x_hi[0] - x_lo[0];
+        
+        double* u_avg_local = (double*)std::malloc(finest_level_dim_1*sizeof(double));
+        
+        averaged_quantity.resize(finest_level_dim_1);
         double* u_avg_global = averaged_quantity.data();
         
         for (int j = 0; j < finest_level_dim_1; j++)
@@ -12267,11 +12251,15 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -12305,25 +12293,12 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -12356,12 +12331,10 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(u_avg_local);
     }
@@ -12464,11 +12437,17 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -12509,25 +12488,13 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -12563,12 +12530,10 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(u_avg_local);
     }
@@ -12595,11 +12560,8 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousYDire
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -12714,11 +12676,15 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousYDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -12752,25 +12718,12 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousYDire
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -12803,12 +12756,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousYDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(u_inv_avg_local);
     }
@@ -12911,11 +12862,17 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousYDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -12956,25 +12913,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousYDire
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -13010,12 +12955,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousYDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(u_inv_avg_local);
     }
@@ -13071,11 +13014,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -13202,11 +13142,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -13250,25 +13194,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -13313,12 +13244,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(avg_local);
     }
@@ -13433,11 +13362,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -13492,25 +13427,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -13558,12 +13481,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(avg_local);
     }
@@ -13679,11 +13600,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -13826,11 +13744,15 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -13924,25 +13846,12 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -14019,12 +13928,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(avg_local);
     }
@@ -14170,11 +14077,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -14292,25 +14205,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -14396,12 +14297,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(avg_local);
     }
@@ -14464,11 +14363,8 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousYDire
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -14604,11 +14500,15 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousYDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -14736,25 +14636,12 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousYDire
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -14791,12 +14678,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousYDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(der_avg_local);
     }
@@ -14935,11 +14820,17 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousYDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -15105,25 +14996,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousYDire
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -15163,12 +15042,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousYDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(der_avg_local);
     }
@@ -15194,11 +15071,8 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -15322,11 +15196,17 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -15367,25 +15247,13 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -15421,12 +15289,10 @@ std::vector<double> FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogene
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_2,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_2);
         
         std::free(u_avg_local);
     }
@@ -15453,11 +15319,8 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousZDire
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -15581,11 +15444,17 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousZDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -15626,25 +15495,13 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousZDire
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -15680,12 +15537,10 @@ FlowModelMPIHelperAverage::getAveragedReciprocalOfQuantityWithInhomogeneousZDire
          * Reduction to get the global average of reciprocal.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_inv_avg_local,
             u_inv_avg_global,
-            finest_level_dim_2,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_2);
         
         std::free(u_inv_avg_local);
     }
@@ -15741,11 +15596,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -15881,11 +15733,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -15940,25 +15798,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -16006,12 +15852,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_2,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_2);
         
         std::free(avg_local);
     }
@@ -16117,11 +15961,8 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -16272,11 +16113,17 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -16394,25 +16241,13 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -16498,12 +16333,10 @@ FlowModelMPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_2,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_2);
         
         std::free(avg_local);
     }
@@ -16566,11 +16399,8 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousZDire
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -16714,11 +16544,17 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousZDire
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -16884,25 +16720,13 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousZDire
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -16942,12 +16766,10 @@ FlowModelMPIHelperAverage::getAveragedDerivativeOfQuantityWithInhomogeneousZDire
          * Reduction to get the global average of derivative.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             der_avg_local,
             der_avg_global,
-            finest_level_dim_2,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_2);
         
         std::free(der_avg_local);
     }
@@ -21,11 +21,8 @@ double FlowModelMPIHelperCentroid::getCentroidInXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -100,11 +97,13 @@ double FlowModelMPIHelperCentroid::getCentroidInXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 
                 const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -131,25 +130,10 @@ double FlowModelMPIHelperCentroid::getCentroidInXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -271,11 +255,15 @@ double FlowModelMPIHelperCentroid::getCentroidInXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -310,25 +298,12 @@ double FlowModelMPIHelperCentroid::getCentroidInXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -452,11 +427,17 @@ double FlowModelMPIHelperCentroid::getCentroidInXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -498,25 +479,13 @@ double FlowModelMPIHelperCentroid::getCentroidInXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -592,11 +561,8 @@ double FlowModelMPIHelperCentroid::getCentroidInYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -678,11 +644,15 @@ double FlowModelMPIHelperCentroid::getCentroidInYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -717,25 +687,12 @@ double FlowModelMPIHelperCentroid::getCentroidInYDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -859,11 +816,17 @@ double FlowModelMPIHelperCentroid::getCentroidInYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -905,25 +868,13 @@ double FlowModelMPIHelperCentroid::getCentroidInYDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -999,11 +950,8 @@ double FlowModelMPIHelperCentroid::getCentroidInZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -1092,11 +1040,17 @@ double FlowModelMPIHelperCentroid::getCentroidInZDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -1138,25 +1092,13 @@ double FlowModelMPIHelperCentroid::getCentroidInZDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
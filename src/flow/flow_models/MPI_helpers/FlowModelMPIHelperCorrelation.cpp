@@ -26,11 +26,8 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -160,11 +157,15 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -208,25 +209,12 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -387,11 +375,17 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -446,25 +440,13 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -546,11 +528,8 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -680,11 +659,15 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -728,25 +711,12 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -922,11 +892,17 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -981,25 +957,13 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousXDirection
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -1094,11 +1058,8 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -1229,11 +1190,15 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -1277,25 +1242,12 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -1456,11 +1408,17 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -1515,25 +1473,13 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -1615,11 +1561,8 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -1750,11 +1693,15 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -1798,25 +1745,12 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -1992,11 +1926,17 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -2051,25 +1991,13 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousYDirection
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -2164,11 +2092,8 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousZDirection
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -2308,11 +2233,17 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousZDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -2367,25 +2298,13 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousZDirection
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -2467,11 +2386,8 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousZDirection
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -2611,11 +2527,17 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousZDirection
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -2670,25 +2592,13 @@ FlowModelMPIHelperCorrelation::getQuantityCorrelationWithInhomogeneousZDirection
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -24,11 +24,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -402,11 +399,8 @@ FlowModelMPIHelperMaxMin::getMaxReciprocalOfQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -809,11 +803,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -884,11 +875,13 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -917,25 +910,10 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and update the max.
@@ -1049,11 +1027,15 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -1095,25 +1077,12 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and update the max.
@@ -1229,11 +1198,17 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -1286,25 +1261,13 @@ FlowModelMPIHelperMaxMin::getMaxQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the max.
@@ -1378,11 +1341,8 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -1756,11 +1716,8 @@ FlowModelMPIHelperMaxMin::getMinReciprocalOfQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -2163,11 +2120,8 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -2238,11 +2192,13 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -2271,25 +2227,10 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and update the min.
@@ -2403,11 +2344,15 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -2449,25 +2394,12 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and update the min.
@@ -2583,11 +2515,17 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -2640,25 +2578,13 @@ FlowModelMPIHelperMaxMin::getMinQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the min.
@@ -2731,11 +2657,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -3222,11 +3145,8 @@ FlowModelMPIHelperMaxMin::getMaxReciprocalOfQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -3742,11 +3662,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -3846,11 +3763,13 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -3879,25 +3798,10 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and update the max.
@@ -4047,11 +3951,15 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -4093,25 +4001,12 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and update the max.
@@ -4263,11 +4158,17 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -4320,25 +4221,13 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the max.
@@ -4418,11 +4307,8 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -4909,11 +4795,8 @@ FlowModelMPIHelperMaxMin::getMinReciprocalOfQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -5429,11 +5312,8 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -5533,11 +5413,13 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -5566,25 +5448,10 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and update the min.
@@ -5734,11 +5601,15 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -5780,25 +5651,12 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and update the min.
@@ -5950,11 +5808,17 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -6007,25 +5871,13 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the min.
@@ -6105,11 +5957,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -6460,11 +6309,8 @@ FlowModelMPIHelperMaxMin::getMaxReciprocalOfQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -6844,11 +6690,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -6956,11 +6799,15 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -7002,25 +6849,12 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousYDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and update the max.
@@ -7172,11 +7006,17 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -7229,25 +7069,13 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousYDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the max.
@@ -7327,11 +7155,8 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -7682,11 +7507,8 @@ FlowModelMPIHelperMaxMin::getMinReciprocalOfQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -8066,11 +7888,8 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -8178,11 +7997,15 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -8224,25 +8047,12 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousYDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and update the min.
@@ -8394,11 +8204,17 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -8451,25 +8267,13 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousYDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the min.
@@ -8549,11 +8353,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -8758,11 +8559,8 @@ FlowModelMPIHelperMaxMin::getMaxReciprocalOfQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -8996,11 +8794,8 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -9116,11 +8911,17 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousZDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -9173,25 +8974,13 @@ FlowModelMPIHelperMaxMin::getMaxQuantityWithInhomogeneousZDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the max.
@@ -9271,11 +9060,8 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -9480,11 +9266,8 @@ FlowModelMPIHelperMaxMin::getMinReciprocalOfQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -9718,11 +9501,8 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -9838,11 +9618,17 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousZDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -9895,25 +9681,13 @@ FlowModelMPIHelperMaxMin::getMinQuantityWithInhomogeneousZDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and update the min.
@@ -9995,11 +9769,8 @@ FlowModelMPIHelperMaxMin::getMaxLocationWithinQuantityBoundsInXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the lower indices of the physical domain.
@@ -10443,11 +10214,8 @@ FlowModelMPIHelperMaxMin::getMinLocationWithinQuantityBoundsInXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the upper indices of the physical domain.
@@ -10891,11 +10659,8 @@ FlowModelMPIHelperMaxMin::getMaxLocationWithinQuantityBoundsInYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the lower indices of the physical domain.
@@ -11218,11 +10983,8 @@ FlowModelMPIHelperMaxMin::getMinLocationWithinQuantityBoundsInYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the upper indices of the physical domain.
@@ -11545,11 +11307,8 @@ FlowModelMPIHelperMaxMin::getMaxLocationWithinQuantityBoundsInZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the lower indices of the physical domain.
@@ -11742,11 +11501,8 @@ FlowModelMPIHelperMaxMin::getMinLocationWithinQuantityBoundsInZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the upper indices of the physical domain.
@@ -11967,11 +11723,8 @@ FlowModelMPIHelperMaxMin::getMaxAbsoluteGradientWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -12590,11 +12343,8 @@ FlowModelMPIHelperMaxMin::getMaxMagnitudeGradientWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     if (d_dim == tbox::Dimension(1))
     {
@@ -7,6 +7,7 @@
  * Compute the local convective flux in the x-direction from conservative variables with
  * 1D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
     double** F_x,
@@ -26,20 +27,24 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 1 : num_eqn_runtime);
+    
     u_x_L = Q_x_L[num_species][idx]/rho_x_L[idx];
     u_x_R = Q_x_R[num_species][idx]/rho_x_R[idx];
     
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[num_species][idx]*(s_x_L - u_x_L) - Q_x_R[num_species][idx]*(s_x_R - u_x_R))/
@@ -48,69 +53,53 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_L[num_species + 1][idx] +
-            (s_x_star - u_x_L)*(rho_x_L[idx]*s_x_star + p_x_L[idx]/(s_x_L - u_x_L)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 2 + si] = Chi_x_star_LR*Q_x_L[num_species + 2 + si][idx];
-        }
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_L*Q_x_L[si][idx];
-        }
-        F_x_LR[num_species] = u_x_L*Q_x_L[num_species][idx] + p_x_L[idx];
-        F_x_LR[num_species + 1] = u_x_L*(Q_x_L[num_species + 1][idx] + p_x_L[idx]);
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_LR[num_species + 2 + si] = u_x_L*(Q_x_L[num_species + 2 + si][idx]);
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_R[num_species + 1][idx] +
-            (s_x_star - u_x_R)*(rho_x_R[idx]*s_x_star + p_x_R[idx]/(s_x_R - u_x_R)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 2 + si] = Chi_x_star_LR*Q_x_R[num_species + 2 + si][idx];
-        }
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_R*Q_x_R[si][idx];
-        }
-        F_x_LR[num_species] = u_x_R*Q_x_R[num_species][idx] + p_x_R[idx];
-        F_x_LR[num_species + 1] = u_x_R*(Q_x_R[num_species + 1][idx] + p_x_R[idx]);
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_LR[num_species + 2 + si] = u_x_R*(Q_x_R[num_species + 2 + si][idx]);
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        Q_x_star_LR[si] = Chi_x_star_LR*Q_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
+        (s_x_star - u_x_LR)*(rho_x_LR*s_x_star + p_x_LR/(s_x_LR - u_x_LR)));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_x_star_LR[num_species + 2 + si] = Chi_x_star_LR*Q_x_LR[num_species + 2 + si];
+    }
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = u_x_LR*Q_x_LR[si];
+    }
+    F_x_LR[num_species] = u_x_LR*Q_x_LR[num_species] + p_x_LR;
+    F_x_LR[num_species + 1] = u_x_LR*(Q_x_LR[num_species + 1] + p_x_LR);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_LR[num_species + 2 + si] = u_x_LR*(Q_x_LR[num_species + 2 + si]);
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -119,6 +108,7 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
  * Compute the local convective flux in the x-direction from conservative variables with
  * 2D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
     double** F_x,
@@ -138,9 +128,13 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 2 : num_eqn_runtime);
+    
     u_x_L = Q_x_L[num_species][idx]/rho_x_L[idx];
     u_x_R = Q_x_R[num_species][idx]/rho_x_R[idx];
     
@@ -150,11 +144,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[num_species][idx]*(s_x_L - u_x_L) - Q_x_R[num_species][idx]*(s_x_R - u_x_R))/
@@ -203,75 +197,77 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
             s_x_R*s_x_L*(Q_x_R[num_species + 3 + si][idx] - Q_x_L[num_species + 3 + si][idx]))/(s_x_R - s_x_L);
     }
     
-    if (s_x_L > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_L[si];
-        }
-        F_x_HLL[num_species] = F_x_L[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 1 + si] = F_x_L[num_species + 3 + si];
-        }
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[si], F_x_HLL[si]);
+    }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 1],
+        F_x_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 3 + si],
+            F_x_HLL[num_species + 1 + si]);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[si], F_x_HLL[si]);
+    }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 1],
+        F_x_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 3 + si],
+            F_x_HLL[num_species + 1 + si]);
     }
     
-    if (s_x_R < double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_R[si];
-        }
-        F_x_HLL[num_species] = F_x_R[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 1 + si] = F_x_R[num_species + 3 + si];
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
     
-    if (s_x_star > double(0))
+    double F_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_L[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_L[num_species + 2][idx] +
-            (s_x_star - u_x_L)*(rho_x_L[idx]*s_x_star + p_x_L[idx]/(s_x_L - u_x_L)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 3 + si] = Chi_x_star_LR*Q_x_L[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_R[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_R[num_species + 2][idx] +
-            (s_x_star - u_x_R)*(rho_x_R[idx]*s_x_star + p_x_R[idx]/(s_x_R - u_x_R)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 3 + si] = Chi_x_star_LR*Q_x_R[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        Q_x_star_LR[si] = Chi_x_star_LR*Q_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_LR[num_species + 2] +
+        (s_x_star - u_x_LR)*(rho_x_LR*s_x_star + p_x_LR/(s_x_LR - u_x_LR)));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_x_star_LR[num_species + 3 + si] = Chi_x_star_LR*Q_x_LR[num_species + 3 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
     
     /*
@@ -282,17 +278,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
     const double v_x_diff = v_x_R - v_x_L;
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -316,6 +306,7 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
  * Compute the local convective flux in the x-direction from conservative variables with
  * 3D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
     double** F_x,
@@ -335,9 +326,13 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 3 : num_eqn_runtime);
+    
     u_x_L = Q_x_L[num_species][idx]/rho_x_L[idx];
     u_x_R = Q_x_R[num_species][idx]/rho_x_R[idx];
     
@@ -350,11 +345,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[num_species][idx]*(s_x_L - u_x_L) - Q_x_R[num_species][idx]*(s_x_R - u_x_R))/
@@ -407,79 +402,82 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
             s_x_R*s_x_L*(Q_x_R[num_species + 4 + si][idx] - Q_x_L[num_species + 4 + si][idx]))/(s_x_R - s_x_L);
     }
     
-    if (s_x_L > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_L[si];
-        }
-        F_x_HLL[num_species] = F_x_L[num_species + 1];
-        F_x_HLL[num_species + 1] = F_x_L[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 2 + si] = F_x_L[num_species + 4 + si];
-        }
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[si], F_x_HLL[si]);
+    }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 1],
+        F_x_HLL[num_species]);
+    F_x_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 2],
+        F_x_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 4 + si],
+            F_x_HLL[num_species + 2 + si]);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[si], F_x_HLL[si]);
+    }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 1],
+        F_x_HLL[num_species]);
+    F_x_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 2],
+        F_x_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 4 + si],
+            F_x_HLL[num_species + 2 + si]);
     }
     
-    if (s_x_R < double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_R[si];
-        }
-        F_x_HLL[num_species] = F_x_R[num_species + 1];
-        F_x_HLL[num_species + 1] = F_x_R[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 2 + si] = F_x_R[num_species + 4 + si];
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
     
-    if (s_x_star > double(0))
+    double F_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_L[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_L[num_species + 2][idx];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_L[num_species + 3][idx] +
-            (s_x_star - u_x_L)*(rho_x_L[idx]*s_x_star + p_x_L[idx]/(s_x_L - u_x_L)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 4 + si] = Chi_x_star_LR*Q_x_L[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_R[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_R[num_species + 2][idx];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_R[num_species + 3][idx] +
-            (s_x_star - u_x_R)*(rho_x_R[idx]*s_x_star + p_x_R[idx]/(s_x_R - u_x_R)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 4 + si] = Chi_x_star_LR*Q_x_R[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        Q_x_star_LR[si] = Chi_x_star_LR*Q_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_LR[num_species + 2];
+    Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_LR[num_species + 3] +
+        (s_x_star - u_x_LR)*(rho_x_LR*s_x_star + p_x_LR/(s_x_LR - u_x_LR)));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_x_star_LR[num_species + 4 + si] = Chi_x_star_LR*Q_x_LR[num_species + 4 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
     
     /*
@@ -491,17 +489,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_x_diff = w_x_R - w_x_L;
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff + w_x_diff*w_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -526,6 +518,7 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
  * Compute the local convective flux in the y-direction from conservative variables with
  * 2D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
     double** F_y,
@@ -545,9 +538,13 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 2 : num_eqn_runtime);
+    
     v_y_B = Q_y_B[num_species + 1][idx]/rho_y_B[idx];
     v_y_T = Q_y_T[num_species + 1][idx]/rho_y_T[idx];
     
@@ -557,11 +554,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[num_species + 1][idx]*(s_y_B - v_y_B) - Q_y_T[num_species + 1][idx]*(s_y_T - v_y_T))/
@@ -610,75 +607,77 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
             s_y_T*s_y_B*(Q_y_T[num_species + 3 + si][idx] - Q_y_B[num_species + 3 + si][idx]))/(s_y_T - s_y_B);
     }
     
-    if (s_y_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_B[si];
-        }
-        F_y_HLL[num_species] = F_y_B[num_species];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 1 + si] = F_y_B[num_species + 3 + si];
-        }
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[si], F_y_HLL[si]);
+    }
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species],
+        F_y_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_y_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species + 3 + si],
+            F_y_HLL[num_species + 1 + si]);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[si], F_y_HLL[si]);
+    }
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species],
+        F_y_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_y_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species + 3 + si],
+            F_y_HLL[num_species + 1 + si]);
     }
     
-    if (s_y_T < double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_T[si];
-        }
-        F_y_HLL[num_species] = F_y_T[num_species];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 1 + si] = F_y_T[num_species + 3 + si];
-        }
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
     }
     
-    if (s_y_star > double(0))
+    double F_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_B[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_B[num_species + 2][idx] +
-            (s_y_star - v_y_B)*(rho_y_B[idx]*s_y_star + p_y_B[idx]/(s_y_B - v_y_B)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 3 + si] = Chi_y_star_BT*Q_y_B[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_T[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_T[num_species + 2][idx] +
-            (s_y_star - v_y_T)*(rho_y_T[idx]*s_y_star + p_y_T[idx]/(s_y_T - v_y_T)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 3 + si] = Chi_y_star_BT*Q_y_T[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        Q_y_star_BT[si] = Chi_y_star_BT*Q_y_BT[si];
+    }
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_BT[num_species + 2] +
+        (s_y_star - v_y_BT)*(rho_y_BT*s_y_star + p_y_BT/(s_y_BT - v_y_BT)));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_y_star_BT[num_species + 3 + si] = Chi_y_star_BT*Q_y_BT[num_species + 3 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -689,17 +688,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
     const double v_y_diff = v_y_T - v_y_B;
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -723,6 +716,7 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
  * Compute the local convective flux in the y-direction from conservative variables with
  * 3D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
     double** F_y,
@@ -742,9 +736,13 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 3 : num_eqn_runtime);
+    
     v_y_B = Q_y_B[num_species + 1][idx]/rho_y_B[idx];
     v_y_T = Q_y_T[num_species + 1][idx]/rho_y_T[idx];
     
@@ -757,11 +755,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[num_species + 1][idx]*(s_y_B - v_y_B) - Q_y_T[num_species + 1][idx]*(s_y_T - v_y_T))/
@@ -814,79 +812,82 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
             s_y_T*s_y_B*(Q_y_T[num_species + 4 + si][idx] - Q_y_B[num_species + 4 + si][idx]))/(s_y_T - s_y_B);
     }
     
-    if (s_y_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_B[si];
-        }
-        F_y_HLL[num_species] = F_y_B[num_species];
-        F_y_HLL[num_species + 1] = F_y_B[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 2 + si] = F_y_B[num_species + 4 + si];
-        }
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[si], F_y_HLL[si]);
     }
-    
-    if (s_y_T < double(0))
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species],
+        F_y_HLL[num_species]);
+    F_y_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species + 2],
+        F_y_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_T[si];
-        }
-        F_y_HLL[num_species] = F_y_T[num_species];
-        F_y_HLL[num_species + 1] = F_y_T[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 2 + si] = F_y_T[num_species + 4 + si];
-        }
+        F_y_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species + 4 + si],
+            F_y_HLL[num_species + 2 + si]);
     }
     
-    if (s_y_star > double(0))
-    {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_B[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_B[num_species + 2][idx];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_B[num_species + 3][idx] +
-            (s_y_star - v_y_B)*(rho_y_B[idx]*s_y_star + p_y_B[idx]/(s_y_B - v_y_B)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 4 + si] = Chi_y_star_BT*Q_y_B[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[si], F_y_HLL[si]);
     }
-    else
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species],
+        F_y_HLL[num_species]);
+    F_y_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species + 2],
+        F_y_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
     {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_T[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_T[num_species + 2][idx];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_T[num_species + 3][idx] +
-            (s_y_star - v_y_T)*(rho_y_T[idx]*s_y_star + p_y_T[idx]/(s_y_T - v_y_T)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 4 + si] = Chi_y_star_BT*Q_y_T[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        F_y_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species + 4 + si],
+            F_y_HLL[num_species + 2 + si]);
+    }
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
+    }
+    
+    double F_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
+    }
+    
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_y_star_BT[si] = Chi_y_star_BT*Q_y_BT[si];
+    }
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_BT[num_species + 2];
+    Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_BT[num_species + 3] +
+        (s_y_star - v_y_BT)*(rho_y_BT*s_y_star + p_y_BT/(s_y_BT - v_y_BT)));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_y_star_BT[num_species + 4 + si] = Chi_y_star_BT*Q_y_BT[num_species + 4 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -898,17 +899,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_y_diff = w_y_T - w_y_B;
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff + w_y_diff*w_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -933,6 +928,7 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
  * Compute the local convective flux in the z-direction from conservative variables with
  * 3D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
     double** F_z,
@@ -952,9 +948,13 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
     double& Chi_z_star_BF,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 3 : num_eqn_runtime);
+    
     w_z_B = Q_z_B[num_species + 2][idx]/rho_z_B[idx];
     w_z_F = Q_z_F[num_species + 2][idx]/rho_z_F[idx];
     
@@ -967,11 +967,11 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_z_average = double(1)/double(2)*(w_z_B + w_z_F);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (p_z_F[idx] - p_z_B[idx] +
         Q_z_B[num_species + 2][idx]*(s_z_B - w_z_B) - Q_z_F[num_species + 2][idx]*(s_z_F - w_z_F))/
@@ -1024,79 +1024,82 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
             s_z_F*s_z_B*(Q_z_F[num_species + 4 + si][idx] - Q_z_B[num_species + 4 + si][idx]))/(s_z_F - s_z_B);
     }
     
-    if (s_z_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_z_B > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_HLL[si] = F_z_B[si];
-        }
-        F_z_HLL[num_species] = F_z_B[num_species];
-        F_z_HLL[num_species + 1] = F_z_B[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_z_HLL[num_species + 2 + si] = F_z_B[num_species + 4 + si];
-        }
+        F_z_HLL[si] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[si], F_z_HLL[si]);
     }
+    F_z_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[num_species],
+        F_z_HLL[num_species]);
+    F_z_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[num_species + 1],
+        F_z_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_z_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[num_species + 4 + si],
+            F_z_HLL[num_species + 2 + si]);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_F = SIMD_BLEND::getMask(s_z_F < double(0));
     
-    if (s_z_F < double(0))
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_HLL[si] = F_z_F[si];
-        }
-        F_z_HLL[num_species] = F_z_F[num_species];
-        F_z_HLL[num_species + 1] = F_z_F[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_z_HLL[num_species + 2 + si] = F_z_F[num_species + 4 + si];
-        }
+        F_z_HLL[si] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[si], F_z_HLL[si]);
+    }
+    F_z_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[num_species],
+        F_z_HLL[num_species]);
+    F_z_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[num_species + 1],
+        F_z_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_z_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[num_species + 4 + si],
+            F_z_HLL[num_species + 2 + si]);
     }
     
-    if (s_z_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double w_z_BF = SIMD_BLEND::blend(mask_upwind_B, w_z_B, w_z_F);
+    const double rho_z_BF = SIMD_BLEND::blend(mask_upwind_B, rho_z_B[idx], rho_z_F[idx]);
+    const double p_z_BF = SIMD_BLEND::blend(mask_upwind_B, p_z_B[idx], p_z_F[idx]);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double Q_z_BF[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_z_star_BF = (s_z_B - w_z_B)/(s_z_B - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*Q_z_B[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_B[num_species][idx];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_B[num_species + 1][idx];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_B[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_B[num_species + 3][idx] +
-            (s_z_star - w_z_B)*(rho_z_B[idx]*s_z_star + p_z_B[idx]/(s_z_B - w_z_B)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_z_star_BF[num_species + 4 + si] = Chi_z_star_BF*Q_z_B[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z_HLLC[ei] = F_z_B[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_B[ei][idx]);
-        }
+        Q_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_z_B[ei][idx], Q_z_F[ei][idx]);
     }
-    else
+    
+    double F_z_BF[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_z_star_BF = (s_z_F - w_z_F)/(s_z_F - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*Q_z_F[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_F[num_species][idx];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_F[num_species + 1][idx];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_F[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_F[num_species + 3][idx] +
-            (s_z_star - w_z_F)*(rho_z_F[idx]*s_z_star + p_z_F[idx]/(s_z_F - w_z_F)));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_z_star_BF[num_species + 4 + si] = Chi_z_star_BF*Q_z_F[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z_HLLC[ei] = F_z_F[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_F[ei][idx]);
-        }
+        F_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, F_z_B[ei], F_z_F[ei]);
+    }
+    
+    Chi_z_star_BF = (s_z_BF - w_z_BF)/(s_z_BF - s_z_star);
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_z_star_BF[si] = Chi_z_star_BF*Q_z_BF[si];
+    }
+    Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_BF[num_species];
+    Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_BF[num_species + 1];
+    Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_BF*s_z_star;
+    Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_BF[num_species + 3] +
+        (s_z_star - w_z_BF)*(rho_z_BF*s_z_star + p_z_BF/(s_z_BF - w_z_BF)));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_z_star_BF[num_species + 4 + si] = Chi_z_star_BF*Q_z_BF[num_species + 4 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_z_HLLC[ei] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
     
     /*
@@ -1108,17 +1111,11 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_z_diff = w_z_F - w_z_B;
     const double vel_mag = sqrt(u_z_diff*u_z_diff + v_z_diff*v_z_diff + w_z_diff*w_z_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(w_z_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(w_z_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1143,6 +1140,7 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
  * Compute the local convective flux in the x-direction from primitive variables with
  * 1D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
     double** F_x,
@@ -1160,17 +1158,21 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 1 : num_eqn_runtime);
+    
     const double u_x_average = double(1)/double(2)*(V_x_L[num_species][idx] + V_x_R[num_species][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[num_species + 1][idx] - V_x_L[num_species + 1][idx] +
         rho_x_L[idx]*V_x_L[num_species][idx]*(s_x_L - V_x_L[num_species][idx]) -
@@ -1182,95 +1184,66 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[num_species][idx])/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_L[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_L[idx]*V_x_L[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_L[idx]*(epsilon_x_L[idx] +
-            double(1)/double(2)*V_x_L[num_species][idx]*V_x_L[num_species][idx]);
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_LR[num_species + 2 + si] = V_x_L[num_species + 2 + si][idx];
-        }
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
-            (s_x_star - V_x_L[num_species][idx])*(rho_x_L[idx]*s_x_star + V_x_L[num_species + 1][idx]/
-            (s_x_L - V_x_L[num_species][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 2 + si] = Chi_x_star_LR*V_x_L[num_species + 2 + si][idx];
-        }
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_L[num_species][idx]*V_x_L[si][idx];
-        }
-        F_x_LR[num_species] = V_x_L[num_species][idx]*Q_x_LR[num_species] + V_x_L[num_species + 1][idx];
-        F_x_LR[num_species + 1] = V_x_L[num_species][idx]*(Q_x_LR[num_species + 1] + V_x_L[num_species + 1][idx]);
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_LR[num_species + 2 + si] = V_x_L[num_species][idx]*V_x_L[num_species + 2 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[num_species])/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[num_species][idx])/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_R[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_R[idx]*V_x_R[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_R[idx]*(epsilon_x_R[idx] +
-            double(1)/double(2)*V_x_R[num_species][idx]*V_x_R[num_species][idx]);
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_LR[num_species + 2 + si] = V_x_R[num_species + 2 + si][idx];
-        }
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
-            (s_x_star - V_x_R[num_species][idx])*(rho_x_R[idx]*s_x_star + V_x_R[num_species + 1][idx]/
-            (s_x_R - V_x_R[num_species][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 2 + si] = Chi_x_star_LR*V_x_R[num_species + 2 + si][idx];
-        }
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_R[num_species][idx]*V_x_R[si][idx];
-        }
-        F_x_LR[num_species] = V_x_R[num_species][idx]*Q_x_LR[num_species] + V_x_R[num_species + 1][idx];
-        F_x_LR[num_species + 1] = V_x_R[num_species][idx]*(Q_x_LR[num_species + 1] + V_x_R[num_species + 1][idx]);
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_LR[num_species + 2 + si] = V_x_R[num_species][idx]*V_x_R[num_species + 2 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        Q_x_LR[si] = V_x_LR[si];
+    }
+    Q_x_LR[num_species] = rho_x_LR*V_x_LR[num_species];
+    Q_x_LR[num_species + 1] = rho_x_LR*(epsilon_x_LR +
+        double(1)/double(2)*V_x_LR[num_species]*V_x_LR[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_x_LR[num_species + 2 + si] = V_x_LR[num_species + 2 + si];
+    }
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_x_star_LR[si] = Chi_x_star_LR*V_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
+        (s_x_star - V_x_LR[num_species])*(rho_x_LR*s_x_star + V_x_LR[num_species + 1]/
+        (s_x_LR - V_x_LR[num_species])));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_x_star_LR[num_species + 2 + si] = Chi_x_star_LR*V_x_LR[num_species + 2 + si];
+    }
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = V_x_LR[num_species]*V_x_LR[si];
+    }
+    F_x_LR[num_species] = V_x_LR[num_species]*Q_x_LR[num_species] + V_x_LR[num_species + 1];
+    F_x_LR[num_species + 1] = V_x_LR[num_species]*(Q_x_LR[num_species + 1] + V_x_LR[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_LR[num_species + 2 + si] = V_x_LR[num_species]*V_x_LR[num_species + 2 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -1279,6 +1252,7 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
  * Compute the local convective flux in the x-direction from primitive variables with
  * 2D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
     double** F_x,
@@ -1296,17 +1270,21 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 2 : num_eqn_runtime);
+    
     const double u_x_average = double(1)/double(2)*(V_x_L[num_species][idx] + V_x_R[num_species][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[num_species + 2][idx] - V_x_L[num_species + 2][idx] +
         rho_x_L[idx]*V_x_L[num_species][idx]*(s_x_L - V_x_L[num_species][idx]) -
@@ -1387,77 +1365,82 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
             s_x_R*s_x_L*(Q_x_R[num_species + 3 + si] - Q_x_L[num_species + 3 + si]))/(s_x_R - s_x_L);
     }
     
-    if (s_x_L > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_L[si];
-        }
-        F_x_HLL[num_species] = F_x_L[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 1 + si] = F_x_L[num_species + 3 + si];
-        }
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[si], F_x_HLL[si]);
+    }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 1],
+        F_x_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 3 + si],
+            F_x_HLL[num_species + 1 + si]);
     }
     
-    if (s_x_R < double(0))
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_R[si];
-        }
-        F_x_HLL[num_species] = F_x_R[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 1 + si] = F_x_R[num_species + 3 + si];
-        }
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[si], F_x_HLL[si]);
     }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 1],
+        F_x_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 3 + si],
+            F_x_HLL[num_species + 1 + si]);
+    }
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
     
-    if (s_x_star > double(0))
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[num_species][idx])/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_L[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_L[num_species + 2] +
-            (s_x_star - V_x_L[num_species][idx])*(rho_x_L[idx]*s_x_star + V_x_L[num_species + 2][idx]/
-            (s_x_L - V_x_L[num_species][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 3 + si] = Chi_x_star_LR*V_x_L[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[num_species][idx])/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_R[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_R[num_species + 2] +
-            (s_x_star - V_x_R[num_species][idx])*(rho_x_R[idx]*s_x_star + V_x_R[num_species + 2][idx]/
-            (s_x_R - V_x_R[num_species][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 3 + si] = Chi_x_star_LR*V_x_R[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei], Q_x_R[ei]);
+    }
+    
+    double F_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
+    }
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[num_species])/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_x_star_LR[si] = Chi_x_star_LR*V_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_LR[num_species + 2] +
+        (s_x_star - V_x_LR[num_species])*(rho_x_LR*s_x_star + V_x_LR[num_species + 2]/
+        (s_x_LR - V_x_LR[num_species])));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_x_star_LR[num_species + 3 + si] = Chi_x_star_LR*V_x_LR[num_species + 3 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
     
     /*
@@ -1468,17 +1451,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
     const double v_x_diff = V_x_R[num_species + 1][idx] - V_x_L[num_species + 1][idx];
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1502,6 +1479,7 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
  * Compute the local convective flux in the x-direction from primitive variables with
  * 3D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
     double** F_x,
@@ -1519,17 +1497,21 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 3 : num_eqn_runtime);
+    
     const double u_x_average = double(1)/double(2)*(V_x_L[num_species][idx] + V_x_R[num_species][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[num_species + 3][idx] - V_x_L[num_species + 3][idx] +
         rho_x_L[idx]*V_x_L[num_species][idx]*(s_x_L - V_x_L[num_species][idx]) -
@@ -1618,81 +1600,87 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
             s_x_R*s_x_L*(Q_x_R[num_species + 4 + si] - Q_x_L[num_species + 4 + si]))/(s_x_R - s_x_L);
     }
     
-    if (s_x_L > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_L[si];
-        }
-        F_x_HLL[num_species] = F_x_L[num_species + 1];
-        F_x_HLL[num_species + 1] = F_x_L[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 2 + si] = F_x_L[num_species + 4 + si];
-        }
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[si], F_x_HLL[si]);
     }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 1],
+        F_x_HLL[num_species]);
+    F_x_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 2],
+        F_x_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[num_species + 4 + si],
+            F_x_HLL[num_species + 2 + si]);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
     
-    if (s_x_R < double(0))
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_HLL[si] = F_x_R[si];
-        }
-        F_x_HLL[num_species] = F_x_R[num_species + 1];
-        F_x_HLL[num_species + 1] = F_x_R[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_x_HLL[num_species + 2 + si] = F_x_R[num_species + 4 + si];
-        }
+        F_x_HLL[si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[si], F_x_HLL[si]);
+    }
+    F_x_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 1],
+        F_x_HLL[num_species]);
+    F_x_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 2],
+        F_x_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_x_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[num_species + 4 + si],
+            F_x_HLL[num_species + 2 + si]);
     }
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[num_species][idx])/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_L[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_L[num_species + 2];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_L[num_species + 3] +
-            (s_x_star - V_x_L[num_species][idx])*(rho_x_L[idx]*s_x_star + V_x_L[num_species + 3][idx]/
-            (s_x_L - V_x_L[num_species][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 4 + si] = Chi_x_star_LR*V_x_L[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[num_species][idx])/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_R[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_R[num_species + 2];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_R[num_species + 3] +
-            (s_x_star - V_x_R[num_species][idx])*(rho_x_R[idx]*s_x_star + V_x_R[num_species + 3][idx]/
-            (s_x_R - V_x_R[num_species][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_x_star_LR[num_species + 4 + si] = Chi_x_star_LR*V_x_R[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei], Q_x_R[ei]);
+    }
+    
+    double F_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
+    }
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[num_species])/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_x_star_LR[si] = Chi_x_star_LR*V_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_LR[num_species + 2];
+    Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_LR[num_species + 3] +
+        (s_x_star - V_x_LR[num_species])*(rho_x_LR*s_x_star + V_x_LR[num_species + 3]/
+        (s_x_LR - V_x_LR[num_species])));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_x_star_LR[num_species + 4 + si] = Chi_x_star_LR*V_x_LR[num_species + 4 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
     
     /*
@@ -1704,17 +1692,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double w_x_diff = V_x_R[num_species + 2][idx] - V_x_L[num_species + 2][idx];
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff + w_x_diff*w_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1739,6 +1721,7 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
  * Compute the local convective flux in the y-direction from primitive variables with
  * 2D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
     double** F_y,
@@ -1756,17 +1739,21 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 2 : num_eqn_runtime);
+    
     const double v_y_average = double(1)/double(2)*(V_y_B[num_species + 1][idx] + V_y_T[num_species + 1][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[num_species + 2][idx] - V_y_B[num_species + 2][idx] +
         rho_y_B[idx]*V_y_B[num_species + 1][idx]*(s_y_B - V_y_B[num_species + 1][idx]) -
@@ -1834,90 +1821,95 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
         F_y_T[num_species + 3 + si] = V_y_T[num_species + 1][idx]*V_y_T[num_species + 3 + si][idx];
     }
     
-    for (int si = 0; si < num_species; si++)
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_HLL[si] = (s_y_T*F_y_B[si] - s_y_B*F_y_T[si] + s_y_T*s_y_B*(Q_y_T[si] - Q_y_B[si]))/
+            (s_y_T - s_y_B);
+    }
+    F_y_HLL[num_species] = (s_y_T*F_y_B[num_species] - s_y_B*F_y_T[num_species] + s_y_T*s_y_B*
+        (Q_y_T[num_species] - Q_y_B[num_species]))/(s_y_T - s_y_B);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_y_HLL[num_species + 1 + si] = (s_y_T*F_y_B[num_species + 3 + si] - s_y_B*F_y_T[num_species + 3 + si] +
+            s_y_T*s_y_B*(Q_y_T[num_species + 3 + si] - Q_y_B[num_species + 3 + si]))/(s_y_T - s_y_B);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[si], F_y_HLL[si]);
+    }
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species],
+        F_y_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_y_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species + 3 + si],
+            F_y_HLL[num_species + 1 + si]);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[si], F_y_HLL[si]);
+    }
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species],
+        F_y_HLL[num_species]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_y_HLL[num_species + 1 + si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species + 3 + si],
+            F_y_HLL[num_species + 1 + si]);
+    }
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        F_y_HLL[si] = (s_y_T*F_y_B[si] - s_y_B*F_y_T[si] + s_y_T*s_y_B*(Q_y_T[si] - Q_y_B[si]))/
-            (s_y_T - s_y_B);
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
-    F_y_HLL[num_species] = (s_y_T*F_y_B[num_species] - s_y_B*F_y_T[num_species] + s_y_T*s_y_B*
-        (Q_y_T[num_species] - Q_y_B[num_species]))/(s_y_T - s_y_B);
-    for (int si = 0; si < num_species - 1; si++)
+    
+    double Q_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        F_y_HLL[num_species + 1 + si] = (s_y_T*F_y_B[num_species + 3 + si] - s_y_B*F_y_T[num_species + 3 + si] +
-            s_y_T*s_y_B*(Q_y_T[num_species + 3 + si] - Q_y_B[num_species + 3 + si]))/(s_y_T - s_y_B);
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei], Q_y_T[ei]);
     }
     
-    if (s_y_B > double(0))
+    double F_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_B[si];
-        }
-        F_y_HLL[num_species] = F_y_B[num_species];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 1 + si] = F_y_B[num_species + 3 + si];
-        }
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
     }
     
-    if (s_y_T < double(0))
+    Chi_y_star_BT = (s_y_BT - V_y_BT[num_species + 1])/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_T[si];
-        }
-        F_y_HLL[num_species] = F_y_T[num_species];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 1 + si] = F_y_T[num_species + 3 + si];
-        }
+        Q_y_star_BT[si] = Chi_y_star_BT*V_y_BT[si];
     }
-    
-    if (s_y_star > double(0))
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_BT[num_species + 2] +
+        (s_y_star - V_y_BT[num_species + 1])*(rho_y_BT*s_y_star + V_y_BT[num_species + 2]/
+        (s_y_BT - V_y_BT[num_species + 1])));
+    for (int si = 0; si < num_species - 1; si++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[num_species + 1][idx])/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_B[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_B[num_species + 2] +
-            (s_y_star - V_y_B[num_species + 1][idx])*(rho_y_B[idx]*s_y_star + V_y_B[num_species + 2][idx]/
-            (s_y_B - V_y_B[num_species + 1][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 3 + si] = Chi_y_star_BT*V_y_B[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei]);
-        }
+        Q_y_star_BT[num_species + 3 + si] = Chi_y_star_BT*V_y_BT[num_species + 3 + si];
     }
-    else
+    
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[num_species + 1][idx])/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_T[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_T[num_species + 2] +
-            (s_y_star - V_y_T[num_species + 1][idx])*(rho_y_T[idx]*s_y_star + V_y_T[num_species + 2][idx]/
-            (s_y_T - V_y_T[num_species + 1][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 3 + si] = Chi_y_star_BT*V_y_T[num_species + 3 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei]);
-        }
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -1928,17 +1920,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
     const double v_y_diff = V_y_T[num_species + 1][idx] - V_y_B[num_species + 1][idx];
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1962,6 +1948,7 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
  * Compute the local convective flux in the y-direction from primitive variables with
  * 3D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
     double** F_y,
@@ -1979,17 +1966,21 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 3 : num_eqn_runtime);
+    
     const double v_y_average = double(1)/double(2)*(V_y_B[num_species + 1][idx] + V_y_T[num_species + 1][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[num_species + 3][idx] - V_y_B[num_species + 3][idx] +
         rho_y_B[idx]*V_y_B[num_species + 1][idx]*(s_y_B - V_y_B[num_species + 1][idx]) -
@@ -2078,81 +2069,87 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
             s_y_T*s_y_B*(Q_y_T[num_species + 4 + si] - Q_y_B[num_species + 4 + si]))/(s_y_T - s_y_B);
     }
     
-    if (s_y_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_B[si];
-        }
-        F_y_HLL[num_species] = F_y_B[num_species];
-        F_y_HLL[num_species + 1] = F_y_B[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 2 + si] = F_y_B[num_species + 4 + si];
-        }
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[si], F_y_HLL[si]);
+    }
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species],
+        F_y_HLL[num_species]);
+    F_y_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species + 2],
+        F_y_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_y_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[num_species + 4 + si],
+            F_y_HLL[num_species + 2 + si]);
     }
     
-    if (s_y_T < double(0))
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_HLL[si] = F_y_T[si];
-        }
-        F_y_HLL[num_species] = F_y_T[num_species];
-        F_y_HLL[num_species + 1] = F_y_T[num_species + 2];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_y_HLL[num_species + 2 + si] = F_y_T[num_species + 4 + si];
-        }
+        F_y_HLL[si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[si], F_y_HLL[si]);
+    }
+    F_y_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species],
+        F_y_HLL[num_species]);
+    F_y_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species + 2],
+        F_y_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_y_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[num_species + 4 + si],
+            F_y_HLL[num_species + 2 + si]);
     }
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[num_species + 1][idx])/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_B[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_B[num_species + 2];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_B[num_species + 3] +
-            (s_y_star - V_y_B[num_species + 1][idx])*(rho_y_B[idx]*s_y_star + V_y_B[num_species + 3][idx]/
-            (s_y_B - V_y_B[num_species + 1][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 4 + si] = Chi_y_star_BT*V_y_B[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei]);
-        }
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
-    else
+    
+    double Q_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[num_species + 1][idx])/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_T[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_T[num_species + 2];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_T[num_species + 3] +
-            (s_y_star - V_y_T[num_species + 1][idx])*(rho_y_T[idx]*s_y_star + V_y_T[num_species + 3][idx]/
-            (s_y_T - V_y_T[num_species + 1][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_y_star_BT[num_species + 4 + si] = Chi_y_star_BT*V_y_T[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei]);
-        }
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei], Q_y_T[ei]);
+    }
+    
+    double F_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
+    }
+    
+    Chi_y_star_BT = (s_y_BT - V_y_BT[num_species + 1])/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_y_star_BT[si] = Chi_y_star_BT*V_y_BT[si];
+    }
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_BT[num_species + 2];
+    Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_BT[num_species + 3] +
+        (s_y_star - V_y_BT[num_species + 1])*(rho_y_BT*s_y_star + V_y_BT[num_species + 3]/
+        (s_y_BT - V_y_BT[num_species + 1])));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_y_star_BT[num_species + 4 + si] = Chi_y_star_BT*V_y_BT[num_species + 4 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -2164,17 +2161,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double w_y_diff = V_y_T[num_species + 2][idx] - V_y_B[num_species + 2][idx];
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff + w_y_diff*w_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -2199,6 +2190,7 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
  * Compute the local convective flux in the z-direction from primitive variables with
  * 3D HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
     double** F_z,
@@ -2216,17 +2208,21 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
     double& Chi_z_star_BF,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? 2*NUM_SPECIES + 3 : num_eqn_runtime);
+    
     const double w_z_average = double(1)/double(2)*(V_z_B[num_species + 2][idx] + V_z_F[num_species + 2][idx]);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, V_z_B[num_species + 2][idx] - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, V_z_F[num_species + 2][idx] + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, V_z_B[num_species + 2][idx] - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, V_z_F[num_species + 2][idx] + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (V_z_F[num_species + 3][idx] - V_z_B[num_species + 3][idx] +
         rho_z_B[idx]*V_z_B[num_species + 2][idx]*(s_z_B - V_z_B[num_species + 2][idx]) -
@@ -2315,81 +2311,87 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
             s_z_F*s_z_B*(Q_z_F[num_species + 4 + si] - Q_z_B[num_species + 4 + si]))/(s_z_F - s_z_B);
     }
     
-    if (s_z_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_z_B > double(0));
+    
+    for (int si = 0; si < num_species; si++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_HLL[si] = F_z_B[si];
-        }
-        F_z_HLL[num_species] = F_z_B[num_species];
-        F_z_HLL[num_species + 1] = F_z_B[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_z_HLL[num_species + 2 + si] = F_z_B[num_species + 4 + si];
-        }
+        F_z_HLL[si] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[si], F_z_HLL[si]);
+    }
+    F_z_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[num_species],
+        F_z_HLL[num_species]);
+    F_z_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[num_species + 1],
+        F_z_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_z_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[num_species + 4 + si],
+            F_z_HLL[num_species + 2 + si]);
+    }
+    
+    const SIMD_BLEND::MASK mask_supersonic_F = SIMD_BLEND::getMask(s_z_F < double(0));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_z_HLL[si] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[si], F_z_HLL[si]);
+    }
+    F_z_HLL[num_species] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[num_species],
+        F_z_HLL[num_species]);
+    F_z_HLL[num_species + 1] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[num_species + 1],
+        F_z_HLL[num_species + 1]);
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        F_z_HLL[num_species + 2 + si] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[num_species + 4 + si],
+            F_z_HLL[num_species + 2 + si]);
     }
     
-    if (s_z_F < double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double rho_z_BF = SIMD_BLEND::blend(mask_upwind_B, rho_z_B[idx], rho_z_F[idx]);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double V_z_BF[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_HLL[si] = F_z_F[si];
-        }
-        F_z_HLL[num_species] = F_z_F[num_species];
-        F_z_HLL[num_species + 1] = F_z_F[num_species + 1];
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            F_z_HLL[num_species + 2 + si] = F_z_F[num_species + 4 + si];
-        }
+        V_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, V_z_B[ei][idx], V_z_F[ei][idx]);
     }
     
-    if (s_z_star > double(0))
+    double Q_z_BF[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_z_star_BF = (s_z_B - V_z_B[num_species + 2][idx])/(s_z_B - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*V_z_B[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_B[num_species];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_B[num_species + 1];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_B[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_B[num_species + 3] +
-            (s_z_star - V_z_B[num_species + 2][idx])*(rho_z_B[idx]*s_z_star + V_z_B[num_species + 3][idx]/
-            (s_z_B - V_z_B[num_species + 2][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_z_star_BF[num_species + 4 + si] = Chi_z_star_BF*V_z_B[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z_HLLC[ei] = F_z_B[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_B[ei]);
-        }
+        Q_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_z_B[ei], Q_z_F[ei]);
     }
-    else
+    
+    double F_z_BF[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_z_star_BF = (s_z_F - V_z_F[num_species + 2][idx])/(s_z_F - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*V_z_F[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_F[num_species];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_F[num_species + 1];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_F[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_F[num_species + 3] +
-            (s_z_star - V_z_F[num_species + 2][idx])*(rho_z_F[idx]*s_z_star + V_z_F[num_species + 3][idx]/
-            (s_z_F - V_z_F[num_species + 2][idx])));
-        for (int si = 0; si < num_species - 1; si++)
-        {
-            Q_z_star_BF[num_species + 4 + si] = Chi_z_star_BF*V_z_F[num_species + 4 + si][idx];
-        }
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z_HLLC[ei] = F_z_F[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_F[ei]);
-        }
+        F_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, F_z_B[ei], F_z_F[ei]);
+    }
+    
+    Chi_z_star_BF = (s_z_BF - V_z_BF[num_species + 2])/(s_z_BF - s_z_star);
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_z_star_BF[si] = Chi_z_star_BF*V_z_BF[si];
+    }
+    Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_BF[num_species];
+    Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_BF[num_species + 1];
+    Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_BF*s_z_star;
+    Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_BF[num_species + 3] +
+        (s_z_star - V_z_BF[num_species + 2])*(rho_z_BF*s_z_star + V_z_BF[num_species + 3]/
+        (s_z_BF - V_z_BF[num_species + 2])));
+    for (int si = 0; si < num_species - 1; si++)
+    {
+        Q_z_star_BF[num_species + 4 + si] = Chi_z_star_BF*V_z_BF[num_species + 4 + si];
+    }
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_z_HLLC[ei] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
     
     /*
@@ -2401,17 +2403,11 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double w_z_diff = V_z_F[num_species + 2][idx] - V_z_B[num_species + 2][idx];
     const double vel_mag = sqrt(u_z_diff*u_z_diff + v_z_diff*v_z_diff + w_z_diff*w_z_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(w_z_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(w_z_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -2436,6 +2432,7 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
  * Compute the convective flux and velocity in the x-direction from conservative variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -2529,67 +2526,67 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_L(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_R(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_x_L(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_x_R(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_L(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_R(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     /*
@@ -2641,15 +2638,6 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
     double* c_x_L = sound_speed_x_L->getPointer(0, 0);
     double* c_x_R = sound_speed_x_R->getPointer(0, 0);
     
-    double u_x_L = double(0);
-    double u_x_R = double(0);
-    
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -2913,7 +2901,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D<NUM_SPECIES>(
                     F_x.data(),
                     Q_x_L.data(),
                     Q_x_R.data(),
@@ -2934,14 +2926,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                     d_num_species,
                     num_eqn);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                    u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -2955,7 +2942,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D<NUM_SPECIES>(
                     F_x.data(),
                     Q_x_L.data(),
                     Q_x_R.data(),
@@ -3305,7 +3296,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_x.data(),
                         Q_x_L.data(),
                         Q_x_R.data(),
@@ -3326,14 +3321,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                         d_num_species,
                         num_eqn);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                        u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -3353,7 +3343,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_x.data(),
                         Q_x_L.data(),
                         Q_x_R.data(),
@@ -3777,7 +3771,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_x.data(),
                             Q_x_L.data(),
                             Q_x_R.data(),
@@ -3798,14 +3796,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                             d_num_species,
                             num_eqn);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                            u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -3832,7 +3825,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_x.data(),
                             Q_x_L.data(),
                             Q_x_R.data(),
@@ -3864,6 +3861,7 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
  * Compute the convective flux and velocity in the y-direction from conservative variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -3957,67 +3955,67 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_T(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_y_B(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_y_T(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_T(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     /*
@@ -4069,15 +4067,6 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
     double* c_y_B = sound_speed_y_B->getPointer(1, 0);
     double* c_y_T = sound_speed_y_T->getPointer(1, 0);
     
-    double v_y_B = double(0);
-    double v_y_T = double(0);
-    
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -4413,7 +4402,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_y.data(),
                         Q_y_B.data(),
                         Q_y_T.data(),
@@ -4434,14 +4427,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                         d_num_species,
                         num_eqn);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                        v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -4461,7 +4449,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_y.data(),
                         Q_y_B.data(),
                         Q_y_T.data(),
@@ -4885,7 +4877,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_y.data(),
                             Q_y_B.data(),
                             Q_y_T.data(),
@@ -4906,14 +4902,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                             d_num_species,
                             num_eqn);
 
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                            v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -4940,7 +4931,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_y.data(),
                             Q_y_B.data(),
                             Q_y_T.data(),
@@ -4972,6 +4967,7 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
  * Compute the convective flux and velocity in the z-direction from conservative variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -5065,67 +5061,67 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_F(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_z_B(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_z_F(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_F(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     /*
@@ -5177,15 +5173,6 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
     double* c_z_B = sound_speed_z_B->getPointer(2, 0);
     double* c_z_F = sound_speed_z_F->getPointer(2, 0);
     
-    double w_z_B = double(0);
-    double w_z_F = double(0);
-    
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -5602,7 +5589,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_z.data(),
                             Q_z_B.data(),
                             Q_z_F.data(),
@@ -5623,14 +5614,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
                             d_num_species,
                             num_eqn);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = w_z_B + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = w_z_F + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            w_z_B + s_z_minus*(Chi_z_star_BF - double(1)),
+                            w_z_F + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -5657,7 +5643,11 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_z.data(),
                             Q_z_B.data(),
                             Q_z_F.data(),
@@ -5689,6 +5679,7 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
  * Compute the convective flux and velocity in the x-direction from primitive variables with
  * HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -5782,59 +5773,59 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_L(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_R(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_x_L(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_x_R(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_L(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_R(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     /*
@@ -5883,12 +5874,6 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
     double* epsilon_x_L = internal_energy_x_L->getPointer(0, 0);
     double* epsilon_x_R = internal_energy_x_R->getPointer(0, 0);
     
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -6122,7 +6107,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D<NUM_SPECIES>(
                     F_x.data(),
                     V_x_L.data(),
                     V_x_R.data(),
@@ -6141,14 +6129,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                     d_num_species,
                     num_eqn);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                    V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -6162,7 +6145,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D<NUM_SPECIES>(
                     F_x.data(),
                     V_x_L.data(),
                     V_x_R.data(),
@@ -6470,7 +6456,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_x.data(),
                         V_x_L.data(),
                         V_x_R.data(),
@@ -6489,14 +6478,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                         d_num_species,
                         num_eqn);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                        V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -6516,7 +6500,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_x.data(),
                         V_x_L.data(),
                         V_x_R.data(),
@@ -6886,7 +6873,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_x.data(),
                             V_x_L.data(),
                             V_x_R.data(),
@@ -6905,14 +6895,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                             d_num_species,
                             num_eqn);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                            V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -6939,7 +6924,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_x.data(),
                             V_x_L.data(),
                             V_x_R.data(),
@@ -6969,6 +6957,7 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirecti
  * Compute the convective flux and velocity in the y-direction from primitive variables with
  * HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -7062,59 +7051,59 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_T(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_y_B(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_y_T(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_T(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     /*
@@ -7163,12 +7152,6 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
     double* epsilon_y_B = internal_energy_y_B->getPointer(1, 0);
     double* epsilon_y_T = internal_energy_y_T->getPointer(1, 0);
     
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -7464,7 +7447,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_y.data(),
                         V_y_B.data(),
                         V_y_T.data(),
@@ -7483,14 +7469,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                         d_num_species,
                         num_eqn);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                        V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -7510,7 +7491,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D<NUM_SPECIES>(
                         F_y.data(),
                         V_y_B.data(),
                         V_y_T.data(),
@@ -7880,7 +7864,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_y.data(),
                             V_y_B.data(),
                             V_y_T.data(),
@@ -7899,14 +7886,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                             d_num_species,
                             num_eqn);
                         
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                            V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -7933,7 +7915,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_y.data(),
                             V_y_B.data(),
                             V_y_T.data(),
@@ -7963,6 +7948,7 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirecti
  * Compute the convective flux and velocity in the z-direction from primitive variables with
  * HLLC-HLL Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -8056,59 +8042,59 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_F(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_z_B(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions_z_F(
-        new pdat::SideData<double>(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species - 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_F(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     /*
@@ -8157,12 +8143,6 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
     double* epsilon_z_B = internal_energy_z_B->getPointer(2, 0);
     double* epsilon_z_F = internal_energy_z_F->getPointer(2, 0);
     
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -8527,7 +8507,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_z.data(),
                             V_z_B.data(),
                             V_z_F.data(),
@@ -8546,14 +8529,9 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
                             d_num_species,
                             num_eqn);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = V_z_B[d_num_species + 2][idx] + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = V_z_F[d_num_species + 2][idx] + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            V_z_B[d_num_species + 2][idx] + s_z_minus*(Chi_z_star_BF - double(1)),
+                            V_z_F[d_num_species + 2][idx] + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -8580,7 +8558,10 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D<NUM_SPECIES>(
                             F_z.data(),
                             V_z_B.data(),
                             V_z_F.data(),
@@ -8604,3 +8585,58 @@ FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirecti
         }
     }
 }
+
+
+/*
+ * Set the functions computing the convective flux and velocity with HLLC-HLL Riemann solver. The functions
+ * with the number of species fixed at compile time are used for two and three species.
+ */
+void
+FlowModelRiemannSolverFiveEqnAllaire::setConvectiveFluxFunctionsHLLC_HLL()
+{
+    if (d_num_species == 2)
+    {
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[0] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL<2>;
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[1] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL<2>;
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[2] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL<2>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[0] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL<2>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[1] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL<2>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[2] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL<2>;
+    }
+    else if (d_num_species == 3)
+    {
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[0] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL<3>;
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[1] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL<3>;
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[2] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL<3>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[0] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL<3>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[1] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL<3>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[2] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL<3>;
+    }
+    else
+    {
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[0] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL<0>;
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[1] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL<0>;
+        d_compute_convective_flux_from_conservative_variables_HLLC_HLL[2] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL<0>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[0] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL<0>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[1] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL<0>;
+        d_compute_convective_flux_from_primitive_variables_HLLC_HLL[2] =
+            &FlowModelRiemannSolverFiveEqnAllaire::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL<0>;
+    }
+}
@@ -4767,599 +4767,69 @@ FlowModelBasicUtilitiesFourEqnConservative::computeSideDataOfProjectionVariables
     double* rho = data_density->getPointer(0);
     double* c = data_sound_speed->getPointer(0);
     
-    /*
-     * Declare pointers to different data.
-     */
-    
-    std::vector<double*> rho_Y_average;
-    rho_Y_average.resize(d_num_species);
-    double* rho_average = nullptr;
-    double* c_average = nullptr;
-    
-    if (d_dim == tbox::Dimension(1))
+    switch (d_proj_var_primitive_averaging_type)
     {
-        const int interior_dim_0 = interior_dims[0];
-        
-        const int num_ghosts_0 = num_ghosts[0];
-        const int num_ghosts_0_projection_var = num_ghosts_projection_var[0];
-        const int num_subghosts_0_density = num_subghosts_density[0];
-        const int num_subghosts_0_sound_speed = num_subghosts_sound_speed[0];
-        
-        switch (d_proj_var_primitive_averaging_type)
+        case AVERAGING::SIMPLE:
         {
-            case AVERAGING::SIMPLE:
+            /*
+             * Compute the projection variables in each direction.
+             */
+            
+            for (int di = 0; di < d_dim.getValue(); di++)
             {
-                /*
-                 * Compute the projection variables in the x-direction.
-                 */
-                
                 for (int si = 0; si < d_num_species; si++)
                 {
-                    rho_Y_average[si] = projection_variables[si]->getPointer(0);
+                    computeSideDataOfSimpleAverageOfCellData(
+                        projection_variables[si]->getPointer(di),
+                        rho_Y[si],
+                        num_ghosts_projection_var,
+                        num_ghosts,
+                        ghostcell_dims_projection_var,
+                        ghostcell_dims,
+                        interior_dims,
+                        di);
                 }
-                rho_average = projection_variables[d_num_species]->getPointer(0);
-                c_average = projection_variables[d_num_species + 1]->getPointer(0);
                 
-                for (int si = 0; si < d_num_species; si++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -num_ghosts_0_projection_var;
-                         i < interior_dim_0 + 1 + num_ghosts_0_projection_var;
-                         i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_face_x = i + num_ghosts_0_projection_var;
-                        const int idx_L = i - 1 + num_ghosts_0;
-                        const int idx_R = i + num_ghosts_0;
-                        
-                        rho_Y_average[si][idx_face_x] = double(1)/double(2)*(rho_Y[si][idx_L] + rho_Y[si][idx_R]);
-                    }
-                }
+                computeSideDataOfSimpleAverageOfCellData(
+                    projection_variables[d_num_species]->getPointer(di),
+                    rho,
+                    num_ghosts_projection_var,
+                    num_subghosts_density,
+                    ghostcell_dims_projection_var,
+                    subghostcell_dims_density,
+                    interior_dims,
+                    di);
                 
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = -num_ghosts_0_projection_var;
-                     i < interior_dim_0 + 1 + num_ghosts_0_projection_var;
-                     i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_face_x = i + num_ghosts_0_projection_var;
-                    const int idx_density_L = i - 1 + num_subghosts_0_density;
-                    const int idx_density_R = i + num_subghosts_0_density;
-                    const int idx_sound_speed_L = i - 1 + num_subghosts_0_sound_speed;
-                    const int idx_sound_speed_R = i + num_subghosts_0_sound_speed;
-                    
-                    rho_average[idx_face_x] = double(1)/double(2)*(rho[idx_density_L] + rho[idx_density_R]);
-                    c_average[idx_face_x] = double(1)/double(2)*(c[idx_sound_speed_L] + c[idx_sound_speed_R]);
-                }
-                
-                break;
-            }
-            case AVERAGING::ROE:
-            {
-                TBOX_ERROR(d_object_name
-                    << ": FlowModelBasicUtilitiesFourEqnConservative::"
-                    << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
-                    << "Roe averaging is not yet implemented."
-                    << std::endl);
-                
-                break;
-            }
-            default:
-            {
-                TBOX_ERROR(d_object_name
-                    << ": FlowModelBasicUtilitiesFourEqnConservative::"
-                    << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
-                    << "Unknown d_proj_var_primitive_averaging_type given."
-                    << std::endl);
+                computeSideDataOfSimpleAverageOfCellData(
+                    projection_variables[d_num_species + 1]->getPointer(di),
+                    c,
+                    num_ghosts_projection_var,
+                    num_subghosts_sound_speed,
+                    ghostcell_dims_projection_var,
+                    subghostcell_dims_sound_speed,
+                    interior_dims,
+                    di);
             }
+            
+            break;
         }
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        
-        const int num_ghosts_0 = num_ghosts[0];
-        const int num_ghosts_1 = num_ghosts[1];
-        const int ghostcell_dim_0 = ghostcell_dims[0];
-        
-        const int num_ghosts_0_projection_var = num_ghosts_projection_var[0];
-        const int num_ghosts_1_projection_var = num_ghosts_projection_var[1];
-        const int ghostcell_dim_0_projection_var = ghostcell_dims_projection_var[0];
-        
-        const int num_subghosts_0_density = num_subghosts_density[0];
-        const int num_subghosts_1_density= num_subghosts_density[1];
-        const int subghostcell_dim_0_density = subghostcell_dims_density[0];
-        
-        const int num_subghosts_0_sound_speed = num_subghosts_sound_speed[0];
-        const int num_subghosts_1_sound_speed = num_subghosts_sound_speed[1];
-        const int subghostcell_dim_0_sound_speed = subghostcell_dims_sound_speed[0];
-        
-        switch (d_proj_var_primitive_averaging_type)
+        case AVERAGING::ROE:
         {
-            case AVERAGING::SIMPLE:
-            {
-                /*
-                 * Compute the projection variables in the x-direction.
-                 */
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    rho_Y_average[si] = projection_variables[si]->getPointer(0);
-                }
-                rho_average = projection_variables[d_num_species]->getPointer(0);
-                c_average = projection_variables[d_num_species + 1]->getPointer(0);
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -num_ghosts_0_projection_var;
-                             i < interior_dim_0 + 1 + num_ghosts_0_projection_var;
-                             i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_face_x = (i + num_ghosts_0_projection_var) +
-                                (j + num_ghosts_1_projection_var)*(ghostcell_dim_0_projection_var + 1);
-                            
-                            const int idx_L = (i - 1 + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0;
-                            
-                            const int idx_R = (i + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0;
-                            
-                            rho_Y_average[si][idx_face_x] = double(1)/double(2)*(rho_Y[si][idx_L] + rho_Y[si][idx_R]);
-                        }
-                    }
-                }
-                
-                for (int j = 0; j < interior_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = -num_ghosts_0_projection_var;
-                         i < interior_dim_0 + 1 + num_ghosts_0_projection_var;
-                         i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_face_x = (i + num_ghosts_0_projection_var) +
-                            (j + num_ghosts_1_projection_var)*(ghostcell_dim_0_projection_var + 1);
-                        
-                        const int idx_density_L = (i - 1 + num_subghosts_0_density) +
-                            (j + num_subghosts_1_density)*subghostcell_dim_0_density;
-                        
-                        const int idx_density_R = (i + num_subghosts_0_density) +
-                            (j + num_subghosts_1_density)*subghostcell_dim_0_density;
-                        
-                        const int idx_sound_speed_L = (i - 1 + num_subghosts_0_sound_speed) +
-                            (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                        
-                        const int idx_sound_speed_R = (i + num_subghosts_0_sound_speed) +
-                            (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                        
-                        rho_average[idx_face_x] = double(1)/double(2)*(rho[idx_density_L] + rho[idx_density_R]);
-                        c_average[idx_face_x] = double(1)/double(2)*(c[idx_sound_speed_L] + c[idx_sound_speed_R]);
-                    }
-                }
-                
-                /*
-                 * Compute the projection variables in the y-direction.
-                 */
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    rho_Y_average[si] = projection_variables[si]->getPointer(1);
-                }
-                rho_average = projection_variables[d_num_species]->getPointer(1);
-                c_average = projection_variables[d_num_species + 1]->getPointer(1);
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int j = -num_ghosts_1_projection_var;
-                         j < interior_dim_1 + 1 + num_ghosts_1_projection_var;
-                         j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_face_y = (i + num_ghosts_0_projection_var) +
-                                (j + num_ghosts_1_projection_var)*ghostcell_dim_0_projection_var;
-                            
-                            const int idx_B = (i + num_ghosts_0) +
-                                (j - 1 + num_ghosts_1)*ghostcell_dim_0;
-                            
-                            const int idx_T = (i + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0;
-                            
-                            rho_Y_average[si][idx_face_y] = double(1)/double(2)*(rho_Y[si][idx_B] + rho_Y[si][idx_T]);
-                        }
-                    }
-                }
-                
-                for (int j = -num_ghosts_1_projection_var;
-                     j < interior_dim_1 + 1 + num_ghosts_1_projection_var;
-                     j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = 0; i < interior_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_face_y = (i + num_ghosts_0_projection_var) +
-                            (j + num_ghosts_1_projection_var)*ghostcell_dim_0_projection_var;
-                        
-                        const int idx_density_B = (i + num_subghosts_0_density) +
-                            (j - 1 + num_subghosts_1_density)*subghostcell_dim_0_density;
-                        
-                        const int idx_density_T = (i + num_subghosts_0_density) +
-                            (j + num_subghosts_1_density)*subghostcell_dim_0_density;
-                        
-                        const int idx_sound_speed_B = (i + num_subghosts_0_sound_speed) +
-                            (j - 1 + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                        
-                        const int idx_sound_speed_T = (i + num_subghosts_0_sound_speed) +
-                            (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                        
-                        rho_average[idx_face_y] = double(1)/double(2)*(rho[idx_density_B] + rho[idx_density_T]);
-                        c_average[idx_face_y] = double(1)/double(2)*(c[idx_sound_speed_B] + c[idx_sound_speed_T]);
-                    }
-                }
-                
-                break;
-            }
-            case AVERAGING::ROE:
-            {
-                TBOX_ERROR(d_object_name
-                    << ": FlowModelBasicUtilitiesFourEqnConservative::"
-                    << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
-                    << "Roe averaging is not yet implemented."
-                    << std::endl);
-                
-                break;
-            }
-            default:
-            {
-                TBOX_ERROR(d_object_name
-                    << ": FlowModelBasicUtilitiesFourEqnConservative::"
-                    << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
-                    << "Unknown d_proj_var_primitive_averaging_type given."
-                    << std::endl);
-            }
+            TBOX_ERROR(d_object_name
+                << ": FlowModelBasicUtilitiesFourEqnConservative::"
+                << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
+                << "Roe averaging is not yet implemented."
+                << std::endl);
+            
+            break;
         }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        const int interior_dim_0 = interior_dims[0];
-        const int interior_dim_1 = interior_dims[1];
-        const int interior_dim_2 = interior_dims[2];
-        
-        const int num_ghosts_0 = num_ghosts[0];
-        const int num_ghosts_1 = num_ghosts[1];
-        const int num_ghosts_2 = num_ghosts[2];
-        const int ghostcell_dim_0 = ghostcell_dims[0];
-        const int ghostcell_dim_1 = ghostcell_dims[1];
-        
-        const int num_ghosts_0_projection_var = num_ghosts_projection_var[0];
-        const int num_ghosts_1_projection_var = num_ghosts_projection_var[1];
-        const int num_ghosts_2_projection_var = num_ghosts_projection_var[2];
-        const int ghostcell_dim_0_projection_var = ghostcell_dims_projection_var[0];
-        const int ghostcell_dim_1_projection_var = ghostcell_dims_projection_var[1];
-        
-        const int num_subghosts_0_density = num_subghosts_density[0];
-        const int num_subghosts_1_density = num_subghosts_density[1];
-        const int num_subghosts_2_density = num_subghosts_density[2];
-        const int subghostcell_dim_0_density = subghostcell_dims_density[0];
-        const int subghostcell_dim_1_density = subghostcell_dims_density[1];
-        
-        const int num_subghosts_0_sound_speed = num_subghosts_sound_speed[0];
-        const int num_subghosts_1_sound_speed = num_subghosts_sound_speed[1];
-        const int num_subghosts_2_sound_speed = num_subghosts_sound_speed[2];
-        const int subghostcell_dim_0_sound_speed = subghostcell_dims_sound_speed[0];
-        const int subghostcell_dim_1_sound_speed = subghostcell_dims_sound_speed[1];
-        
-        switch (d_proj_var_primitive_averaging_type)
-        {
-            case AVERAGING::SIMPLE:
-            {
-                /*
-                 * Compute the projection variables in the x-direction.
-                 */
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    rho_Y_average[si] = projection_variables[si]->getPointer(0);
-                }
-                rho_average = projection_variables[d_num_species]->getPointer(0);
-                c_average = projection_variables[d_num_species + 1]->getPointer(0);
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int k = 0; k < interior_dim_2; k++)
-                    {
-                        for (int j = 0; j < interior_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = -num_ghosts_0_projection_var;
-                                 i < interior_dim_0 + 1 + num_ghosts_0_projection_var;
-                                 i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_face_x = (i + num_ghosts_0_projection_var) +
-                                    (j + num_ghosts_1_projection_var)*(ghostcell_dim_0_projection_var + 1) +
-                                    (k + num_ghosts_2_projection_var)*(ghostcell_dim_0_projection_var + 1)*
-                                        ghostcell_dim_1_projection_var;
-                                
-                                const int idx_L = (i - 1 + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*
-                                        ghostcell_dim_1;
-                                
-                                const int idx_R = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*
-                                        ghostcell_dim_1;
-                                
-                                rho_Y_average[si][idx_face_x] = double(1)/double(2)*(rho_Y[si][idx_L] + rho_Y[si][idx_R]);
-                            }
-                        }
-                    }
-                }
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = -num_ghosts_0_projection_var;
-                             i < interior_dim_0 + 1 + num_ghosts_0_projection_var;
-                             i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_face_x = (i + num_ghosts_0_projection_var) +
-                                (j + num_ghosts_1_projection_var)*(ghostcell_dim_0_projection_var + 1) +
-                                (k + num_ghosts_2_projection_var)*(ghostcell_dim_0_projection_var + 1)*
-                                    ghostcell_dim_1_projection_var;
-                            
-                            const int idx_density_L = (i - 1 + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_density_R = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_sound_speed_L = (i - 1 + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            const int idx_sound_speed_R = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            rho_average[idx_face_x] = double(1)/double(2)*(rho[idx_density_L] + rho[idx_density_R]);
-                            c_average[idx_face_x] = double(1)/double(2)*(c[idx_sound_speed_L] + c[idx_sound_speed_R]);
-                        }
-                    }
-                }
-                
-                /*
-                 * Compute the projection variables in the y-direction.
-                 */
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    rho_Y_average[si] = projection_variables[si]->getPointer(1);
-                }
-                rho_average = projection_variables[d_num_species]->getPointer(1);
-                c_average = projection_variables[d_num_species + 1]->getPointer(1);
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int k = 0; k < interior_dim_2; k++)
-                    {
-                        for (int j = -num_ghosts_1_projection_var;
-                             j < interior_dim_1 + 1 + num_ghosts_1_projection_var;
-                             j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = 0; i < interior_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_face_y = (i + num_ghosts_0_projection_var) +
-                                    (j + num_ghosts_1_projection_var)*ghostcell_dim_0_projection_var +
-                                    (k + num_ghosts_2_projection_var)*ghostcell_dim_0_projection_var*
-                                        (ghostcell_dim_1_projection_var + 1);
-                                
-                                const int idx_B = (i + num_ghosts_0) +
-                                    (j - 1 + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*
-                                        ghostcell_dim_1;
-                                
-                                const int idx_T = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*
-                                        ghostcell_dim_1;
-                                
-                                rho_Y_average[si][idx_face_y] = double(1)/double(2)*(rho_Y[si][idx_B] + rho_Y[si][idx_T]);
-                            }
-                        }
-                    }
-                }
-                
-                for (int k = 0; k < interior_dim_2; k++)
-                {
-                    for (int j = -num_ghosts_1_projection_var;
-                         j < interior_dim_1 + 1 + num_ghosts_1_projection_var;
-                         j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_face_y = (i + num_ghosts_0_projection_var) +
-                                (j + num_ghosts_1_projection_var)*ghostcell_dim_0_projection_var +
-                                (k + num_ghosts_2_projection_var)*ghostcell_dim_0_projection_var*
-                                    (ghostcell_dim_1_projection_var + 1);
-                            
-                            const int idx_density_B = (i + num_subghosts_0_density) +
-                                (j - 1 + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_density_T = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_sound_speed_B = (i + num_subghosts_0_sound_speed) +
-                                (j - 1 + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            const int idx_sound_speed_T = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            rho_average[idx_face_y] = double(1)/double(2)*(rho[idx_density_B] + rho[idx_density_T]);
-                            c_average[idx_face_y] = double(1)/double(2)*(c[idx_sound_speed_B] + c[idx_sound_speed_T]);
-                        }
-                    }
-                }
-                
-                /*
-                 * Compute the projection variables in the z-direction.
-                 */
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    rho_Y_average[si] = projection_variables[si]->getPointer(2);
-                }
-                rho_average = projection_variables[d_num_species]->getPointer(2);
-                c_average = projection_variables[d_num_species + 1]->getPointer(2);
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int k = -num_ghosts_2_projection_var;
-                         k < interior_dim_2 + 1 + num_ghosts_2_projection_var;
-                         k++)
-                    {
-                        for (int j = 0; j < interior_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = 0; i < interior_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_face_z = (i + num_ghosts_0_projection_var) +
-                                    (j + num_ghosts_1_projection_var)*ghostcell_dim_0_projection_var +
-                                    (k + num_ghosts_2_projection_var)*ghostcell_dim_0_projection_var*
-                                        ghostcell_dim_1_projection_var;
-                                
-                                const int idx_B = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k - 1 + num_ghosts_2)*ghostcell_dim_0*
-                                        ghostcell_dim_1;
-                                
-                                const int idx_F = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*
-                                        ghostcell_dim_1;
-                                
-                                rho_Y_average[si][idx_face_z] = double(1)/double(2)*(rho_Y[si][idx_B] + rho_Y[si][idx_F]);
-                            }
-                        }
-                    }
-                }
-                
-                for (int k = -num_ghosts_2_projection_var;
-                     k < interior_dim_2 + 1 + num_ghosts_2_projection_var;
-                     k++)
-                {
-                    for (int j = 0; j < interior_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = 0; i < interior_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_face_z = (i + num_ghosts_0_projection_var) +
-                                (j + num_ghosts_1_projection_var)*ghostcell_dim_0_projection_var +
-                                (k + num_ghosts_2_projection_var)*ghostcell_dim_0_projection_var*
-                                    ghostcell_dim_1_projection_var;
-                            
-                            const int idx_density_B = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k - 1 + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_density_F = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_sound_speed_B = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k - 1 + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            const int idx_sound_speed_F = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            rho_average[idx_face_z] = double(1)/double(2)*(rho[idx_density_B] + rho[idx_density_F]);
-                            c_average[idx_face_z] = double(1)/double(2)*(c[idx_sound_speed_B] + c[idx_sound_speed_F]);
-                        }
-                    }
-                }
-                
-                break;
-            }
-            case AVERAGING::ROE:
-            {
-                TBOX_ERROR(d_object_name
-                    << ": FlowModelBasicUtilitiesFourEqnConservative::"
-                    << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
-                    << "Roe averaging is not yet implemented."
-                    << std::endl);
-                
-                break;
-            }
-            default:
-            {
-                TBOX_ERROR(d_object_name
-                    << ": FlowModelBasicUtilitiesFourEqnConservative::"
-                    << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
-                    << "Unknown d_proj_var_primitive_averaging_type given."
-                    << std::endl);
-            }
+        default:
+        {
+            TBOX_ERROR(d_object_name
+                << ": FlowModelBasicUtilitiesFourEqnConservative::"
+                << "computeSideDataOfProjectionVariablesForPrimitiveVariables()\n"
+                << "Unknown d_proj_var_primitive_averaging_type given."
+                << std::endl);
         }
     }
 }
@@ -6824,3 +6294,204 @@ FlowModelBasicUtilitiesFourEqnConservative::computeSideDataOfPrimitiveVariablesF
         }
     }
 }
+
+
+/*
+ * Compute the characteristic variables from primitive variables on a line of faces in a
+ * direction.
+ */
+void
+FlowModelBasicUtilitiesFourEqnConservative::computeCharacteristicVariablesFromPrimitiveVariablesOnFaceLine(
+    const std::vector<double*>& characteristic_variables,
+    const std::vector<const double*>& primitive_variables,
+    const std::vector<const double*>& projection_variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
+{
+    const std::vector<double*>&       W = characteristic_variables;
+    const std::vector<const double*>& V = primitive_variables;
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    if (static_cast<int>(W.size()) != d_num_eqn)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelBasicUtilitiesFourEqnConservative::"
+            << "computeCharacteristicVariablesFromPrimitiveVariablesOnFaceLine()\n"
+            << "Number of elements in characteristic variables is not correct."
+            << std::endl);
+    }
+    
+    if (static_cast<int>(V.size()) != d_num_eqn)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelBasicUtilitiesFourEqnConservative::"
+            << "computeCharacteristicVariablesFromPrimitiveVariablesOnFaceLine()\n"
+            << "Number of elements in primitive variables is not correct."
+            << std::endl);
+    }
+    
+    if (static_cast<int>(projection_variables.size()) != d_num_species + 2)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelBasicUtilitiesFourEqnConservative::"
+            << "computeCharacteristicVariablesFromPrimitiveVariablesOnFaceLine()\n"
+            << "Number of elements in projection variables is not correct."
+            << std::endl);
+    }
+#endif
+    
+    const int di = static_cast<int>(direction);
+    
+    const double* const rho_average = projection_variables[d_num_species];
+    const double* const c_average = projection_variables[d_num_species + 1];
+    
+    const double* const u_n = V[d_num_species + di];
+    const double* const p = V[d_num_species + d_dim.getValue()];
+    
+    for (int si = 0; si < d_num_species; si++)
+    {
+        const double* const rho_Y_average = projection_variables[si];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_face = 0; idx_face < num_faces; idx_face++)
+        {
+            W[1 + si][idx_face] = V[si][idx_face] - rho_Y_average[idx_face]/
+                (rho_average[idx_face]*c_average[idx_face]*c_average[idx_face])*p[idx_face];
+        }
+    }
+    
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int idx_face = 0; idx_face < num_faces; idx_face++)
+    {
+        W[0][idx_face] = u_n[idx_face] -
+            double(1)/(rho_average[idx_face]*c_average[idx_face])*p[idx_face];
+        
+        W[d_num_eqn - 1][idx_face] = u_n[idx_face] +
+            double(1)/(rho_average[idx_face]*c_average[idx_face])*p[idx_face];
+    }
+    
+    // The tangential velocity components are ordered with increasing direction index.
+    int count_tangential = 0;
+    for (int dj = 0; dj < d_dim.getValue(); dj++)
+    {
+        if (dj == di)
+        {
+            continue;
+        }
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_face = 0; idx_face < num_faces; idx_face++)
+        {
+            W[d_num_species + 1 + count_tangential][idx_face] = V[d_num_species + dj][idx_face];
+        }
+        
+        count_tangential++;
+    }
+}
+
+
+/*
+ * Compute the primitive variables from characteristic variables on a line of faces in a
+ * direction.
+ */
+void
+FlowModelBasicUtilitiesFourEqnConservative::computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine(
+    const std::vector<double*>& primitive_variables,
+    const std::vector<const double*>& characteristic_variables,
+    const std::vector<const double*>& projection_variables,
+    const DIRECTION::TYPE& direction,
+    const int num_faces)
+{
+    const std::vector<double*>&       V = primitive_variables;
+    const std::vector<const double*>& W = characteristic_variables;
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    if (static_cast<int>(W.size()) != d_num_eqn)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelBasicUtilitiesFourEqnConservative::"
+            << "computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine()\n"
+            << "Number of elements in characteristic variables is not correct."
+            << std::endl);
+    }
+    
+    if (static_cast<int>(V.size()) != d_num_eqn)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelBasicUtilitiesFourEqnConservative::"
+            << "computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine()\n"
+            << "Number of elements in primitive variables is not correct."
+            << std::endl);
+    }
+    
+    if (static_cast<int>(projection_variables.size()) != d_num_species + 2)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelBasicUtilitiesFourEqnConservative::"
+            << "computePrimitiveVariablesFromCharacteristicVariablesOnFaceLine()\n"
+            << "Number of elements in projection variables is not correct."
+            << std::endl);
+    }
+#endif
+    
+    const int di = static_cast<int>(direction);
+    
+    const double* const rho_average = projection_variables[d_num_species];
+    const double* const c_average = projection_variables[d_num_species + 1];
+    
+    double* const u_n = V[d_num_species + di];
+    double* const p = V[d_num_species + d_dim.getValue()];
+    
+    for (int si = 0; si < d_num_species; si++)
+    {
+        const double* const rho_Y_average = projection_variables[si];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_face = 0; idx_face < num_faces; idx_face++)
+        {
+            V[si][idx_face] = -double(1)/double(2)*rho_Y_average[idx_face]/c_average[idx_face]*W[0][idx_face] +
+                W[si + 1][idx_face] + double(1)/double(2)*rho_Y_average[idx_face]/c_average[idx_face]*
+                    W[d_num_eqn - 1][idx_face];
+        }
+    }
+    
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int idx_face = 0; idx_face < num_faces; idx_face++)
+    {
+        u_n[idx_face] = double(1)/double(2)*W[0][idx_face] +
+            double(1)/double(2)*W[d_num_eqn - 1][idx_face];
+        
+        p[idx_face] = -double(1)/double(2)*rho_average[idx_face]*c_average[idx_face]*W[0][idx_face] +
+            double(1)/double(2)*rho_average[idx_face]*c_average[idx_face]*W[d_num_eqn - 1][idx_face];
+    }
+    
+    // The tangential velocity components are ordered with increasing direction index.
+    int count_tangential = 0;
+    for (int dj = 0; dj < d_dim.getValue(); dj++)
+    {
+        if (dj == di)
+        {
+            continue;
+        }
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_face = 0; idx_face < num_faces; idx_face++)
+        {
+            V[d_num_species + dj][idx_face] = W[d_num_species + 1 + count_tangential][idx_face];
+        }
+        
+        count_tangential++;
+    }
+}
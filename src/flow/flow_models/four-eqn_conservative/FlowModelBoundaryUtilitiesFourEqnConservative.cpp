@@ -622,6 +622,34 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                 
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         const int idx_cell_rho_Y = i + num_subghosts_conservative_var[0][0];
@@ -670,22 +698,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                          * Compute the mass fractions of the pivot.
                          */
                         
-                        std::vector<double> Y_pivot;
-                        Y_pivot.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                        }
-                        
-                        /*
-                         * Get the pointers to the mass fractions of the pivot.
-                         */
-                        
-                        std::vector<const double*> Y_pivot_ptr;
-                        Y_pivot_ptr.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Y_pivot_ptr.push_back(&Y_pivot[si]);
+                            Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                         }
                         
                         /*
@@ -700,32 +715,63 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                             2.0*rho_pivot*d_bdry_node_adiabatic_no_slip_vel[node_loc];
                         
                         /*
-                         * Set the values for total internal energy.
+                         * Store the density and specific internal energy of the pivot.
                          */
                         
-                        double epsilon_pivot = (Q[d_num_species + 1][idx_cell_pivot_E] -
+                        epsilon_pivot_fill[count_fill] = (Q[d_num_species + 1][idx_cell_pivot_E] -
                             0.5*Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom]/
                                 rho_pivot)/rho_pivot;
                         
-                        double p_pivot = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_pivot,
-                                &epsilon_pivot,
-                                Y_pivot_ptr);
+                        rho_pivot_fill[count_fill] = rho_pivot;
+                        idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                        idx_cell_E_fill[count_fill] = idx_cell_E;
                         
-                        double T_pivot = d_equation_of_state_mixing_rules->
-                            getTemperature(
-                                &rho_pivot,
-                                &p_pivot,
-                                Y_pivot_ptr);
+                        count_fill++;
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
                         
-                        double T = T_pivot;
+                        /*
+                         * Set the values for total internal energy.
+                         */
                         
-                        double epsilon = d_equation_of_state_mixing_rules->
-                            getInternalEnergyFromTemperature(
-                                &rho_pivot,
-                                &T,
-                                Y_pivot_ptr);
+                        double epsilon = epsilon_fill[idx_fill];
                         
                         double E = rho_pivot*epsilon +
                             0.5*Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom]/rho_pivot;
@@ -739,6 +785,38 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         const int idx_cell_rho_Y = i + num_subghosts_conservative_var[0][0];
@@ -786,68 +864,98 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill1dNodeBoundaryData(
                          * Compute the mass fractions of the pivot.
                          */
                         
-                        std::vector<double> Y_pivot;
-                        Y_pivot.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                        }
-                        
-                        /*
-                         * Get the pointers to the mass fractions of the pivot.
-                         */
-                        
-                        std::vector<const double*> Y_pivot_ptr;
-                        Y_pivot_ptr.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Y_pivot_ptr.push_back(&Y_pivot[si]);
+                            Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                         }
                         
                         /*
-                         * Set the values for partial densities, momentum and total internal energy.
+                         * Store the density and specific internal energy of the pivot.
                          */
                         
-                        double epsilon_pivot = (Q[d_num_species + 1][idx_cell_pivot_E] -
+                        epsilon_pivot_fill[count_fill] = (Q[d_num_species + 1][idx_cell_pivot_E] -
                             0.5*Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom]/
                                 rho_pivot)/rho_pivot;
                         
-                        double p_pivot = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_pivot,
-                                &epsilon_pivot,
-                                Y_pivot_ptr);
+                        rho_pivot_fill[count_fill] = rho_pivot;
+                        idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                        idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                        idx_cell_E_fill[count_fill] = idx_cell_E;
+                        idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                         
-                        double p = p_pivot;
-                        
-                        double T_pivot = d_equation_of_state_mixing_rules->
-                            getTemperature(
-                                &rho_pivot,
-                                &p_pivot,
-                                Y_pivot_ptr);
+                        count_fill++;
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_node_isothermal_no_slip_T[node_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
                         
-                        double T = -T_pivot + 2.0*d_bdry_node_isothermal_no_slip_T[node_loc];
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
                         
-                        double rho = d_equation_of_state_mixing_rules->
-                            getMixtureDensity(
-                                &p,
-                                &T,
-                                Y_pivot_ptr);
+                        double rho = rho_fill[idx_fill];
                         
                         double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
                             2.0*d_bdry_node_isothermal_no_slip_vel[node_loc];
                         
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
                         }
                         Q[d_num_species][idx_cell_mom] = rho*u;
                         
-                        double epsilon = d_equation_of_state_mixing_rules->
-                            getInternalEnergyFromTemperature(
-                                &rho,
-                                &T,
-                                Y_pivot_ptr);
+                        double epsilon = epsilon_fill[idx_fill];
                         
                         double E = rho*epsilon + 0.5*Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom]/rho;
                         
@@ -1043,6 +1151,34 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                 
                 if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1146,22 +1282,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                              * Compute the mass fractions of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
                             /*
@@ -1178,48 +1301,111 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc*2 + 1];
                             
                             /*
-                             * Set the values for total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
+                            rho_pivot_fill[count_fill] = rho_pivot;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
                             
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho_pivot,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho_pivot*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1323,79 +1509,109 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                              * Compute the mass fractions of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
                             /*
-                             * Set the values for partial densities, momentum and total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double p = p_pivot;
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
+                            rho_pivot_fill[count_fill] = rho_pivot;
+                            idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
+                            idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                             
-                            double T = -T_pivot + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc];
-                            
-                            double rho = d_equation_of_state_mixing_rules->
-                                getMixtureDensity(
-                                    &p,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2];
-                            double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2 + 1];
-                            
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                            }
-                            Q[d_num_species][idx_cell_mom] = rho*u;
-                            Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_fill++;
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2 + 1];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
                         }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
                     }
                     
                     // Remove edge locations that have boundary conditions identified.
@@ -1489,11 +1705,51 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             << ": FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData()\n"
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
-                     
+                    
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = j - fill_box_lo_idx[1];
+                        
+                        const int idx_state_x_R   = idx_line;
+                        const int idx_state_x_RR  = idx_line + num_lines;
+                        const int idx_state_x_RRR = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
                         
                         const int idx_cell_rho_Y_x_R = (interior_box_lo_idx[0] + num_subghosts_conservative_var[0][0]) +
                             (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0];
@@ -1522,19 +1778,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         const int idx_cell_E_x_RRR = (interior_box_lo_idx[0] + 2 + num_subghosts_conservative_var[2][0]) +
                             (j + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0];
                         
-                        std::vector<double> rho_Y_x_R;
-                        std::vector<double> rho_Y_x_RR;
-                        std::vector<double> rho_Y_x_RRR;
-                        rho_Y_x_R.reserve(d_num_species);
-                        rho_Y_x_RR.reserve(d_num_species);
-                        rho_Y_x_RRR.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            rho_Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]);
-                            rho_Y_x_RR.push_back(Q[si][idx_cell_rho_Y_x_RR]);
-                            rho_Y_x_RRR.push_back(Q[si][idx_cell_rho_Y_x_RRR]);
-                        }
-                        
                         /*
                          * Compute the mixture density.
                          */
@@ -1549,40 +1792,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             rho_x_RRR += Q[si][idx_cell_rho_Y_x_RRR];
                         }
                         
-                        /*
-                         * Compute the mass fractions.
-                         */
-                        
-                        std::vector<double> Y_x_R;
-                        std::vector<double> Y_x_RR;
-                        std::vector<double> Y_x_RRR;
-                        Y_x_R.reserve(d_num_species);
-                        Y_x_RR.reserve(d_num_species);
-                        Y_x_RRR.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                            Y_x_RR.push_back(Q[si][idx_cell_rho_Y_x_RR]/rho_x_RR);
-                            Y_x_RRR.push_back(Q[si][idx_cell_rho_Y_x_RRR]/rho_x_RRR);
-                        }
-                        
-                        /*
-                         * Get the pointers to the mass fractions.
-                         */
-                        
-                        std::vector<const double*> Y_x_R_ptr;
-                        std::vector<const double*> Y_x_RR_ptr;
-                        std::vector<const double*> Y_x_RRR_ptr;
-                        Y_x_R_ptr.reserve(d_num_species);
-                        Y_x_RR_ptr.reserve(d_num_species);
-                        Y_x_RRR_ptr.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_x_R_ptr.push_back(&Y_x_R[si]);
-                            Y_x_RR_ptr.push_back(&Y_x_RR[si]);
-                            Y_x_RRR_ptr.push_back(&Y_x_RRR[si]);
-                        }
-                       
                         const double u_x_R   = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
                         const double u_x_RR  = Q[d_num_species][idx_cell_mom_x_RR]/rho_x_RR;
                         const double u_x_RRR = Q[d_num_species][idx_cell_mom_x_RRR]/rho_x_RRR;
@@ -1591,51 +1800,35 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         const double v_x_RR  = Q[d_num_species + 1][idx_cell_mom_x_RR]/rho_x_RR;
                         const double v_x_RRR = Q[d_num_species + 1][idx_cell_mom_x_RRR]/rho_x_RRR;
                         
-                        const double half = double(1)/double(2);
                         const double epsilon_x_R   = Q[d_num_species + 2][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                         const double epsilon_x_RR  = Q[d_num_species + 2][idx_cell_E_x_RR]/rho_x_RR - half*(u_x_RR*u_x_RR + v_x_RR*v_x_RR);
                         const double epsilon_x_RRR = Q[d_num_species + 2][idx_cell_E_x_RRR]/rho_x_RRR - half*(u_x_RRR*u_x_RRR + v_x_RRR*v_x_RRR);
                         
-                        double p_x_R = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_x_R,
-                                &epsilon_x_R,
-                                Y_x_R_ptr);
+                        rho_states[idx_state_x_R]   = rho_x_R;
+                        rho_states[idx_state_x_RR]  = rho_x_RR;
+                        rho_states[idx_state_x_RRR] = rho_x_RRR;
                         
-                        double p_x_RR = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_x_RR,
-                                &epsilon_x_RR,
-                                Y_x_RR_ptr);
+                        u_states[idx_state_x_R]   = u_x_R;
+                        u_states[idx_state_x_RR]  = u_x_RR;
+                        u_states[idx_state_x_RRR] = u_x_RRR;
                         
-                        double p_x_RRR = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_x_RRR,
-                                &epsilon_x_RRR,
-                                Y_x_RRR_ptr);
+                        v_states[idx_state_x_R]   = v_x_R;
+                        v_states[idx_state_x_RR]  = v_x_RR;
+                        v_states[idx_state_x_RRR] = v_x_RRR;
                         
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
+                        epsilon_states[idx_state_x_R]   = epsilon_x_R;
+                        epsilon_states[idx_state_x_RR]  = epsilon_x_RR;
+                        epsilon_states[idx_state_x_RRR] = epsilon_x_RRR;
                         
-                        std::vector<double> drho_Y_dx;
-                        drho_Y_dx.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            drho_Y_dx.push_back(-(Q[si][idx_cell_rho_Y_x_RRR] - double(4)*Q[si][idx_cell_rho_Y_x_RR] +
-                                double(3)*Q[si][idx_cell_rho_Y_x_R])/(double(2)*dx[0]));
+                            rho_Y_states[idx_state_x_R*d_num_species + si]   = Q[si][idx_cell_rho_Y_x_R];
+                            rho_Y_states[idx_state_x_RR*d_num_species + si]  = Q[si][idx_cell_rho_Y_x_RR];
+                            rho_Y_states[idx_state_x_RRR*d_num_species + si] = Q[si][idx_cell_rho_Y_x_RRR];
+                            Y_states[si*num_states + idx_state_x_R]   = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                            Y_states[si*num_states + idx_state_x_RR]  = Q[si][idx_cell_rho_Y_x_RR]/rho_x_RR;
+                            Y_states[si*num_states + idx_state_x_RRR] = Q[si][idx_cell_rho_Y_x_RRR]/rho_x_RRR;
                         }
-                        const double du_dx = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
-                        const double dv_dx = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
-                        const double dp_dx = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
-                        
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
-                        
-                        double du_dy = double(0);
-                        double dv_dy = double(0);
-                        double dp_dy = double(0);
                         
                         if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                             (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -1666,42 +1859,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
+                            const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
+                            const double epsilon_y_T = Q[d_num_species + 2][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
+                            
+                            rho_states[idx_state_y_T]     = rho_y_T;
+                            u_states[idx_state_y_T]       = u_y_T;
+                            v_states[idx_state_y_T]       = v_y_T;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
                             
-                            std::vector<double> Y_y_T;
-                            Y_y_T.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
+                                Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_T_ptr;
-                            Y_y_T_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_B]     = rho_x_R;
+                            epsilon_states[idx_state_y_B] = epsilon_x_R;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_T_ptr.push_back(&Y_y_T[si]);
+                                Y_states[si*num_states + idx_state_y_B] = Y_states[si*num_states + idx_state_x_R];
                             }
-                            
-                            const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
-                            const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
-                            const double epsilon_y_T = Q[d_num_species + 2][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
-                            
-                            double p_y_T = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    Y_y_T_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dy = (u_y_T - u_x_R)/(dx[1]);
-                            dv_dy = (v_y_T - v_x_R)/(dx[1]);
-                            dp_dy = (p_y_T - p_x_R)/(dx[1]);
                         }
                         else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                  (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -1732,42 +1911,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_y_B += Q[si][idx_cell_rho_Y_y_B];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
+                            const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
+                            const double epsilon_y_B = Q[d_num_species + 2][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
+                            
+                            rho_states[idx_state_y_B]     = rho_y_B;
+                            u_states[idx_state_y_B]       = u_y_B;
+                            v_states[idx_state_y_B]       = v_y_B;
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
                             
-                            std::vector<double> Y_y_B;
-                            Y_y_B.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
+                                Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_B_ptr;
-                            Y_y_B_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_T]     = rho_x_R;
+                            epsilon_states[idx_state_y_T] = epsilon_x_R;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_B_ptr.push_back(&Y_y_B[si]);
+                                Y_states[si*num_states + idx_state_y_T] = Y_states[si*num_states + idx_state_x_R];
                             }
-                            
-                            const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
-                            const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
-                            const double epsilon_y_B = Q[d_num_species + 2][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
-                            
-                            double p_y_B = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    Y_y_B_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dy = (u_x_R - u_y_B)/(dx[1]);
-                            dv_dy = (v_x_R - v_y_B)/(dx[1]);
-                            dp_dy = (p_x_R - p_y_B)/(dx[1]);
                         }
                         else
                         {
@@ -1801,34 +1966,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_y_B;
-                            std::vector<double> Y_y_T;
-                            Y_y_B.reserve(d_num_species);
-                            Y_y_T.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_B_ptr;
-                            std::vector<const double*> Y_y_T_ptr;
-                            Y_y_B_ptr.reserve(d_num_species);
-                            Y_y_T_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                Y_y_T_ptr.push_back(&Y_y_T[si]);
-                            }
-                            
                             const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                             const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
                             
@@ -1838,46 +1975,190 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             const double epsilon_y_B = Q[d_num_species + 2][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                             const double epsilon_y_T = Q[d_num_species + 2][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                             
-                            double p_y_B = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    Y_y_B_ptr);
+                            rho_states[idx_state_y_B] = rho_y_B;
+                            rho_states[idx_state_y_T] = rho_y_T;
                             
-                            double p_y_T = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    Y_y_T_ptr);
+                            u_states[idx_state_y_B] = u_y_B;
+                            u_states[idx_state_y_T] = u_y_T;
                             
-                            // Central derivatives.
-                            du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
-                            dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
-                            dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                            v_states[idx_state_y_B] = v_y_B;
+                            v_states[idx_state_y_T] = v_y_T;
+                            
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
+                            
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                            }
                         }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        const int idx_line = j - fill_box_lo_idx[1];
+                        
+                        const int idx_state_x_R   = idx_line;
+                        const int idx_state_x_RR  = idx_line + num_lines;
+                        const int idx_state_x_RRR = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
+                        
+                        const double& rho_x_R = rho_states[idx_state_x_R];
+                        
+                        const double& u_x_R   = u_states[idx_state_x_R];
+                        const double& u_x_RR  = u_states[idx_state_x_RR];
+                        const double& u_x_RRR = u_states[idx_state_x_RRR];
+                        
+                        const double& v_x_R   = v_states[idx_state_x_R];
+                        const double& v_x_RR  = v_states[idx_state_x_RR];
+                        const double& v_x_RRR = v_states[idx_state_x_RRR];
+                        
+                        const double& p_x_R   = p_states[idx_state_x_R];
+                        const double& p_x_RR  = p_states[idx_state_x_RR];
+                        const double& p_x_RRR = p_states[idx_state_x_RRR];
+                        
+                        const double* const rho_Y_x_R   = &rho_Y_states[idx_state_x_R*d_num_species];
+                        const double* const rho_Y_x_RR  = &rho_Y_states[idx_state_x_RR*d_num_species];
+                        const double* const rho_Y_x_RRR = &rho_Y_states[idx_state_x_RRR*d_num_species];
+                        
+                        double Y_x_R[d_num_species];
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Y_x_R[si] = Y_states[si*num_states + idx_state_x_R];
+                        }
+                        
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
+                        
+                        double drho_Y_dx[d_num_species];
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            drho_Y_dx[si] = -(rho_Y_x_RRR[si] - double(4)*rho_Y_x_RR[si] +
+                                double(3)*rho_Y_x_R[si])/(double(2)*dx[0]);
+                        }
+                        const double du_dx = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
+                        const double dv_dx = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
+                        const double dp_dx = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
+                        
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
+                        
+                        double du_dy = double(0);
+                        double dv_dy = double(0);
+                        double dp_dy = double(0);
+                        
+                        if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            (j + num_subghosts_conservative_var[2][1] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                        //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_T = p_states[idx_state_y_T];
+                            
+                            // One-sided derivatives.
+                            du_dy = (u_y_T - u_x_R)/(dx[1]);
+                            dv_dy = (v_y_T - v_x_R)/(dx[1]);
+                            dp_dy = (p_y_T - p_x_R)/(dx[1]);
+                        }
+                        else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                 (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                 (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                        //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                        //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                        //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            
+                            // One-sided derivatives.
+                            du_dy = (u_x_R - u_y_B)/(dx[1]);
+                            dv_dy = (v_x_R - v_y_B)/(dx[1]);
+                            dp_dy = (p_x_R - p_y_B)/(dx[1]);
+                        }
+                        else
+                        {
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            const double& p_y_T = p_states[idx_state_y_T];
+                            
+                            // Central derivatives.
+                            du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                            dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
+                            dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                        }
+                        
+                        // Compute sound speed.
                         
-                        // Compute sound speed.
-                        
-                        const double Gamma_x_R = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                            &rho_x_R,
-                            &p_x_R,
-                            Y_x_R_ptr);
-                        
-                        const std::vector<double> Psi_x_R = d_equation_of_state_mixing_rules->
-                            getPressureDerivativeWithPartialDensities(
-                                    &rho_x_R,
-                                    &p_x_R,
-                                    Y_x_R_ptr);
-                        
-                        double c_x_R = Gamma_x_R*p_x_R/rho_x_R;
+                        double c_x_R = Gamma_bdry[idx_line]*p_x_R/rho_x_R;
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            c_x_R += Y_x_R[si]*Psi_x_R[si];
+                            c_x_R += Y_x_R[si]*Psi_bdry[si*num_lines + idx_line];
                         }
                         c_x_R = sqrt(c_x_R);
                         
                         const double lambda_last = u_x_R + c_x_R;
-
+                        
                         // Compute vector Lambda^(-1) * L.
                         
                         double Lambda_inv_L[d_num_species + 3];
@@ -2110,26 +2391,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_ghost += V_ghost[i*(d_num_species + 3) + si];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_ghost;
-                            Y_ghost.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_ghost.push_back(V_ghost[i*(d_num_species + 3) + si]/rho_ghost);
-                            }
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                             
                             /*
-                             * Get the pointers to the mass fractions.
+                             * Compute the mass fractions.
                              */
                             
-                            std::vector<const double*> Y_ghost_ptr;
-                            Y_ghost_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[i*(d_num_species + 3) + si]/rho_ghost;
                             }
                             
                             for(int si=0; si < d_num_species; si++)
@@ -2140,20 +2410,45 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             Q[d_num_species][idx_cell_mom]     = rho_ghost*V_ghost[i*(d_num_species + 3) + d_num_species];
                             Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[i*(d_num_species + 3) + d_num_species + 1];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergy(
-                                    &rho_ghost,
-                                    &V_ghost[i*(d_num_species + 3) + d_num_species + 2],
-                                    Y_ghost_ptr);
+                            rho_ghosts[idx_ghost] = rho_ghost;
+                            p_ghosts[idx_ghost]   = V_ghost[i*(d_num_species + 3) + d_num_species + 2];
                             
-                            const double E = rho_ghost*epsilon +
-                                half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
-                                    rho_ghost;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
                 }
                 else if (edge_loc == BDRY_LOC::XHI)
                 {
@@ -2166,10 +2461,50 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = j - fill_box_lo_idx[1];
+                        
+                        const int idx_state_x_L   = idx_line;
+                        const int idx_state_x_LL  = idx_line + num_lines;
+                        const int idx_state_x_LLL = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
                         
                         const int idx_cell_rho_Y_x_L = (interior_box_hi_idx[0] + num_subghosts_conservative_var[0][0]) +
                             (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0];
@@ -2197,19 +2532,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         
                         const int idx_cell_E_x_LLL = (interior_box_hi_idx[0] - 2 + num_subghosts_conservative_var[2][0]) +
                             (j + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0];
-
-                        std::vector<double> rho_Y_x_L;
-                        std::vector<double> rho_Y_x_LL;
-                        std::vector<double> rho_Y_x_LLL;
-                        rho_Y_x_L.reserve(d_num_species);
-                        rho_Y_x_LL.reserve(d_num_species);
-                        rho_Y_x_LLL.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            rho_Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]);
-                            rho_Y_x_LL.push_back(Q[si][idx_cell_rho_Y_x_LL]);
-                            rho_Y_x_LLL.push_back(Q[si][idx_cell_rho_Y_x_LLL]);
-                        }
                         
                         /*
                          * Compute the mixture density.
@@ -2225,40 +2547,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             rho_x_LLL += Q[si][idx_cell_rho_Y_x_LLL];
                         }
                         
-                        /*
-                         * Compute the mass fractions.
-                         */
-
-                        std::vector<double> Y_x_L;
-                        std::vector<double> Y_x_LL;
-                        std::vector<double> Y_x_LLL;
-                        Y_x_L.reserve(d_num_species);
-                        Y_x_LL.reserve(d_num_species);
-                        Y_x_LLL.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                            Y_x_LL.push_back(Q[si][idx_cell_rho_Y_x_LL]/rho_x_LL);
-                            Y_x_LLL.push_back(Q[si][idx_cell_rho_Y_x_LLL]/rho_x_LLL);
-                        }
-                        
-                        /*
-                         * Get the pointers to the mass fractions.
-                         */
-
-                        std::vector<const double*> Y_x_L_ptr;
-                        std::vector<const double*> Y_x_LL_ptr;
-                        std::vector<const double*> Y_x_LLL_ptr;
-                        Y_x_L_ptr.reserve(d_num_species);
-                        Y_x_LL_ptr.reserve(d_num_species);
-                        Y_x_LLL_ptr.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_x_L_ptr.push_back(&Y_x_L[si]);
-                            Y_x_LL_ptr.push_back(&Y_x_LL[si]);
-                            Y_x_LLL_ptr.push_back(&Y_x_LLL[si]);
-                        }
-                       
                         const double u_x_L   = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                         const double u_x_LL  = Q[d_num_species][idx_cell_mom_x_LL]/rho_x_LL;
                         const double u_x_LLL = Q[d_num_species][idx_cell_mom_x_LLL]/rho_x_LLL;
@@ -2267,51 +2555,35 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         const double v_x_LL  = Q[d_num_species + 1][idx_cell_mom_x_LL]/rho_x_LL;
                         const double v_x_LLL = Q[d_num_species + 1][idx_cell_mom_x_LLL]/rho_x_LLL;
                         
-                        const double half = double(1)/double(2);
                         const double epsilon_x_L   = Q[d_num_species + 2][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                         const double epsilon_x_LL  = Q[d_num_species + 2][idx_cell_E_x_LL]/rho_x_LL - half*(u_x_LL*u_x_LL + v_x_LL*v_x_LL);
                         const double epsilon_x_LLL = Q[d_num_species + 2][idx_cell_E_x_LLL]/rho_x_LLL - half*(u_x_LLL*u_x_LLL + v_x_LLL*v_x_LLL);
                         
-                        double p_x_L = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_x_L,
-                                &epsilon_x_L,
-                                Y_x_L_ptr);
+                        rho_states[idx_state_x_L]   = rho_x_L;
+                        rho_states[idx_state_x_LL]  = rho_x_LL;
+                        rho_states[idx_state_x_LLL] = rho_x_LLL;
                         
-                        double p_x_LL = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_x_LL,
-                                &epsilon_x_LL,
-                                Y_x_LL_ptr);
+                        u_states[idx_state_x_L]   = u_x_L;
+                        u_states[idx_state_x_LL]  = u_x_LL;
+                        u_states[idx_state_x_LLL] = u_x_LLL;
                         
-                        double p_x_LLL = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_x_LLL,
-                                &epsilon_x_LLL,
-                                Y_x_LLL_ptr);
+                        v_states[idx_state_x_L]   = v_x_L;
+                        v_states[idx_state_x_LL]  = v_x_LL;
+                        v_states[idx_state_x_LLL] = v_x_LLL;
                         
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
+                        epsilon_states[idx_state_x_L]   = epsilon_x_L;
+                        epsilon_states[idx_state_x_LL]  = epsilon_x_LL;
+                        epsilon_states[idx_state_x_LLL] = epsilon_x_LLL;
                         
-                        std::vector<double> drho_Y_dx;
-                        drho_Y_dx.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            drho_Y_dx.push_back((Q[si][idx_cell_rho_Y_x_LLL] - double(4)*Q[si][idx_cell_rho_Y_x_LL] +
-                                double(3)*Q[si][idx_cell_rho_Y_x_L])/(double(2)*dx[0]));
+                            rho_Y_states[idx_state_x_L*d_num_species + si]   = Q[si][idx_cell_rho_Y_x_L];
+                            rho_Y_states[idx_state_x_LL*d_num_species + si]  = Q[si][idx_cell_rho_Y_x_LL];
+                            rho_Y_states[idx_state_x_LLL*d_num_species + si] = Q[si][idx_cell_rho_Y_x_LLL];
+                            Y_states[si*num_states + idx_state_x_L]   = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                            Y_states[si*num_states + idx_state_x_LL]  = Q[si][idx_cell_rho_Y_x_LL]/rho_x_LL;
+                            Y_states[si*num_states + idx_state_x_LLL] = Q[si][idx_cell_rho_Y_x_LLL]/rho_x_LLL;
                         }
-                        const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
-                        const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
-                        const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
-                        
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
-                        
-                        double du_dy = double(0);
-                        double dv_dy = double(0);
-                        double dp_dy = double(0);
                         
                         if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                             (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -2342,41 +2614,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
+                            const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
+                            const double epsilon_y_T = Q[d_num_species + 2][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
+                            
+                            rho_states[idx_state_y_T]     = rho_y_T;
+                            u_states[idx_state_y_T]       = u_y_T;
+                            v_states[idx_state_y_T]       = v_y_T;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
                             
-                            std::vector<double> Y_y_T;
-                            Y_y_T.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
+                                Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_T_ptr;
-                            Y_y_T_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_B]     = rho_x_L;
+                            epsilon_states[idx_state_y_B] = epsilon_x_L;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_T_ptr.push_back(&Y_y_T[si]);
+                                Y_states[si*num_states + idx_state_y_B] = Y_states[si*num_states + idx_state_x_L];
                             }
-                            const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
-                            const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
-                            const double epsilon_y_T = Q[d_num_species + 2][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
-                            
-                            double p_y_T = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    Y_y_T_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dy = (u_y_T - u_x_L)/(dx[1]);
-                            dv_dy = (v_y_T - v_x_L)/(dx[1]);
-                            dp_dy = (p_y_T - p_x_L)/(dx[1]);
                         }
                         else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                  (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -2407,42 +2666,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_y_B += Q[si][idx_cell_rho_Y_y_B];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
+                            const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
+                            const double epsilon_y_B = Q[d_num_species + 2][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
+                            
+                            rho_states[idx_state_y_B]     = rho_y_B;
+                            u_states[idx_state_y_B]       = u_y_B;
+                            v_states[idx_state_y_B]       = v_y_B;
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
                             
-                            std::vector<double> Y_y_B;
-                            Y_y_B.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
+                                Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_B_ptr;
-                            Y_y_B_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_T]     = rho_x_L;
+                            epsilon_states[idx_state_y_T] = epsilon_x_L;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_y_B_ptr.push_back(&Y_y_B[si]);
+                                Y_states[si*num_states + idx_state_y_T] = Y_states[si*num_states + idx_state_x_L];
                             }
-                            
-                            const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
-                            const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
-                            const double epsilon_y_B = Q[d_num_species + 2][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
-                            
-                            double p_y_B = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    Y_y_B_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dy = (u_x_L - u_y_B)/(dx[1]);
-                            dv_dy = (v_x_L - v_y_B)/(dx[1]);
-                            dp_dy = (p_x_L - p_y_B)/(dx[1]);
                         }
                         else
                         {
@@ -2476,34 +2721,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_y_B;
-                            std::vector<double> Y_y_T;
-                            Y_y_B.reserve(d_num_species);
-                            Y_y_T.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_B_ptr;
-                            std::vector<const double*> Y_y_T_ptr;
-                            Y_y_B_ptr.reserve(d_num_species);
-                            Y_y_T_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                Y_y_T_ptr.push_back(&Y_y_T[si]);
-                            }
-                            
                             const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                             const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
                             
@@ -2513,82 +2730,226 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             const double epsilon_y_B = Q[d_num_species + 2][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                             const double epsilon_y_T = Q[d_num_species + 2][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                             
-                            double p_y_B = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    Y_y_B_ptr);
+                            rho_states[idx_state_y_B] = rho_y_B;
+                            rho_states[idx_state_y_T] = rho_y_T;
                             
-                            double p_y_T = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    Y_y_T_ptr);
+                            u_states[idx_state_y_B] = u_y_B;
+                            u_states[idx_state_y_T] = u_y_T;
                             
-                            // Central derivatives.
-                            du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
-                            dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
-                            dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
-                        }
-                        
-                        // Compute sound speed.
-                        
-                        const double Gamma_x_L = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                            &rho_x_L,
-                            &p_x_L,
-                            Y_x_L_ptr);
-                        
-                        const std::vector<double> Psi_x_L = d_equation_of_state_mixing_rules->
-                            getPressureDerivativeWithPartialDensities(
-                                    &rho_x_L,
-                                    &p_x_L,
-                                    Y_x_L_ptr);
-                        
-                        double c_x_L = Gamma_x_L*p_x_L/rho_x_L;
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            c_x_L += Y_x_L[si]*Psi_x_L[si];
+                            v_states[idx_state_y_B] = v_y_B;
+                            v_states[idx_state_y_T] = v_y_T;
+                            
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
+                            
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                            }
                         }
-                        c_x_L = sqrt(c_x_L);
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        const int idx_line = j - fill_box_lo_idx[1];
                         
-                        const double lambda_1 = u_x_L - c_x_L;
+                        const int idx_state_x_L   = idx_line;
+                        const int idx_state_x_LL  = idx_line + num_lines;
+                        const int idx_state_x_LLL = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
                         
-                        // Compute vector Lambda^(-1) * L.
+                        const double& rho_x_L = rho_states[idx_state_x_L];
                         
-                        double Lambda_inv_L[d_num_species + 3];
+                        const double& u_x_L   = u_states[idx_state_x_L];
+                        const double& u_x_LL  = u_states[idx_state_x_LL];
+                        const double& u_x_LLL = u_states[idx_state_x_LLL];
                         
-                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
-                        const double& sigma       = d_bdry_edge_nonreflecting_outflow_sigma[edge_loc];
-                        const double& beta        = d_bdry_edge_nonreflecting_outflow_beta[edge_loc];
-                        const double& length_char = d_bdry_edge_nonreflecting_outflow_length_char[edge_loc];
+                        const double& v_x_L   = v_states[idx_state_x_L];
+                        const double& v_x_LL  = v_states[idx_state_x_LL];
+                        const double& v_x_LLL = v_states[idx_state_x_LLL];
                         
-                        const double T_1 = v_x_L*(dp_dy - rho_x_L*c_x_L*du_dy) + rho_x_L*c_x_L*c_x_L*dv_dy;
+                        const double& p_x_L   = p_states[idx_state_x_L];
+                        const double& p_x_LL  = p_states[idx_state_x_LL];
+                        const double& p_x_LLL = p_states[idx_state_x_LLL];
                         
-                        const double M_sq = (u_x_L*u_x_L + v_x_L*v_x_L)/(c_x_L*c_x_L);
-                        const double K = sigma*c_x_L*(double(1) - M_sq)/length_char;
+                        const double* const rho_Y_x_L   = &rho_Y_states[idx_state_x_L*d_num_species];
+                        const double* const rho_Y_x_LL  = &rho_Y_states[idx_state_x_LL*d_num_species];
+                        const double* const rho_Y_x_LLL = &rho_Y_states[idx_state_x_LLL*d_num_species];
                         
-                        Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_x_L - p_t) - (double(1) - beta)*T_1);
+                        double Y_x_L[d_num_species];
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Lambda_inv_L[si + 1] = c_x_L*c_x_L*drho_Y_dx[si] - Y_x_L[si]*dp_dx;
+                            Y_x_L[si] = Y_states[si*num_states + idx_state_x_L];
                         }
-                        Lambda_inv_L[d_num_species + 1] = dv_dx;
-                        Lambda_inv_L[d_num_species + 2] = dp_dx + rho_x_L*c_x_L*du_dx;
-                        
-                        // Compute dV_dx.
-                        
-                        const double c_sq_inv  = double(1)/(c_x_L*c_x_L);
-                        const double rho_c_inv = double(1)/(rho_x_L*c_x_L);
                         
-                        double dV_dx[d_num_species + 3];
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
                         
+                        double drho_Y_dx[d_num_species];
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            dV_dx[si] = half*c_sq_inv*Y_x_L[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]) +
-                                c_sq_inv*Lambda_inv_L[si + 1];
+                            drho_Y_dx[si] = (rho_Y_x_LLL[si] - double(4)*rho_Y_x_LL[si] +
+                                double(3)*rho_Y_x_L[si])/(double(2)*dx[0]);
                         }
-                        dV_dx[d_num_species]     = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]);
-                        dV_dx[d_num_species + 1] = Lambda_inv_L[d_num_species + 1];
+                        const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
+                        const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
+                        const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
+                        
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
+                        
+                        double du_dy = double(0);
+                        double dv_dy = double(0);
+                        double dp_dy = double(0);
+                        
+                        if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            (j + num_subghosts_conservative_var[2][1] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                        //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_T = p_states[idx_state_y_T];
+                            
+                            // One-sided derivatives.
+                            du_dy = (u_y_T - u_x_L)/(dx[1]);
+                            dv_dy = (v_y_T - v_x_L)/(dx[1]);
+                            dp_dy = (p_y_T - p_x_L)/(dx[1]);
+                        }
+                        else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                 (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                 (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                        //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                        //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                        //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            
+                            // One-sided derivatives.
+                            du_dy = (u_x_L - u_y_B)/(dx[1]);
+                            dv_dy = (v_x_L - v_y_B)/(dx[1]);
+                            dp_dy = (p_x_L - p_y_B)/(dx[1]);
+                        }
+                        else
+                        {
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            const double& p_y_T = p_states[idx_state_y_T];
+                            
+                            // Central derivatives.
+                            du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                            dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
+                            dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                        }
+                        
+                        // Compute sound speed.
+                        
+                        double c_x_L = Gamma_bdry[idx_line]*p_x_L/rho_x_L;
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            c_x_L += Y_x_L[si]*Psi_bdry[si*num_lines + idx_line];
+                        }
+                        c_x_L = sqrt(c_x_L);
+                        
+                        const double lambda_1 = u_x_L - c_x_L;
+                        
+                        // Compute vector Lambda^(-1) * L.
+                        
+                        double Lambda_inv_L[d_num_species + 3];
+                        
+                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
+                        const double& sigma       = d_bdry_edge_nonreflecting_outflow_sigma[edge_loc];
+                        const double& beta        = d_bdry_edge_nonreflecting_outflow_beta[edge_loc];
+                        const double& length_char = d_bdry_edge_nonreflecting_outflow_length_char[edge_loc];
+                        
+                        const double T_1 = v_x_L*(dp_dy - rho_x_L*c_x_L*du_dy) + rho_x_L*c_x_L*c_x_L*dv_dy;
+                        
+                        const double M_sq = (u_x_L*u_x_L + v_x_L*v_x_L)/(c_x_L*c_x_L);
+                        const double K = sigma*c_x_L*(double(1) - M_sq)/length_char;
+                        
+                        Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_x_L - p_t) - (double(1) - beta)*T_1);
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Lambda_inv_L[si + 1] = c_x_L*c_x_L*drho_Y_dx[si] - Y_x_L[si]*dp_dx;
+                        }
+                        Lambda_inv_L[d_num_species + 1] = dv_dx;
+                        Lambda_inv_L[d_num_species + 2] = dp_dx + rho_x_L*c_x_L*du_dx;
+                        
+                        // Compute dV_dx.
+                        
+                        const double c_sq_inv  = double(1)/(c_x_L*c_x_L);
+                        const double rho_c_inv = double(1)/(rho_x_L*c_x_L);
+                        
+                        double dV_dx[d_num_species + 3];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            dV_dx[si] = half*c_sq_inv*Y_x_L[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]) +
+                                c_sq_inv*Lambda_inv_L[si + 1];
+                        }
+                        dV_dx[d_num_species]     = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]);
+                        dV_dx[d_num_species + 1] = Lambda_inv_L[d_num_species + 1];
                         dV_dx[d_num_species + 2] = half*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]);
                         
                         double V_ghost[(d_num_species + 3)*num_ghosts_to_fill];
@@ -2633,7 +2994,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 V_ghost[i*(d_num_species + 3) + d_num_species + 1] = -double(2)*v_x_LL - double(3)*v_x_L +
                                     double(6)*V_ghost[(i - 1)*(d_num_species + 3) + d_num_species + 1] -
                                     double(6)*dx[0]*dV_dx[d_num_species + 1];
-                    
+                                
                                 V_ghost[i*(d_num_species + 3) + d_num_species + 2] = -double(2)*p_x_LL - double(3)*p_x_L +
                                     double(6)*V_ghost[(i - 1)*(d_num_species + 3) + d_num_species + 2] -
                                     double(6)*dx[0]*dV_dx[d_num_species + 2];
@@ -2785,26 +3146,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_ghost += V_ghost[i*(d_num_species + 3) + si];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_ghost;
-                            Y_ghost.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_ghost.push_back(V_ghost[i*(d_num_species + 3) + si]/rho_ghost);
-                            }
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                             
                             /*
-                             * Get the pointers to the mass fractions.
+                             * Compute the mass fractions.
                              */
                             
-                            std::vector<const double*> Y_ghost_ptr;
-                            Y_ghost_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[i*(d_num_species + 3) + si]/rho_ghost;
                             }
                             
                             for(int si=0; si < d_num_species; si++)
@@ -2815,20 +3165,45 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             Q[d_num_species][idx_cell_mom]     = rho_ghost*V_ghost[i*(d_num_species + 3) + d_num_species];
                             Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[i*(d_num_species + 3) + d_num_species + 1];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergy(
-                                    &rho_ghost,
-                                    &V_ghost[i*(d_num_species + 3) + d_num_species + 2],
-                                    Y_ghost_ptr);
+                            rho_ghosts[idx_ghost] = rho_ghost;
+                            p_ghosts[idx_ghost]   = V_ghost[i*(d_num_species + 3) + d_num_species + 2];
                             
-                            const double E = rho_ghost*epsilon +
-                                half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
-                                    rho_ghost;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
                 }
                 else if (edge_loc == BDRY_LOC::YLO)
                 {
@@ -2841,10 +3216,50 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = i - fill_box_lo_idx[0];
+                        
+                        const int idx_state_y_T   = idx_line;
+                        const int idx_state_y_TT  = idx_line + num_lines;
+                        const int idx_state_y_TTT = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
                         
                         const int idx_cell_rho_Y_y_T = (i + num_subghosts_conservative_var[0][0]) +
                             (interior_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0];
@@ -2873,19 +3288,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         const int idx_cell_E_y_TTT = (i + num_subghosts_conservative_var[2][0]) +
                             (interior_box_lo_idx[1] + 2 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0];
                         
-                        std::vector<double> rho_Y_y_T;
-                        std::vector<double> rho_Y_y_TT;
-                        std::vector<double> rho_Y_y_TTT;
-                        rho_Y_y_T.reserve(d_num_species);
-                        rho_Y_y_TT.reserve(d_num_species);
-                        rho_Y_y_TTT.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            rho_Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]);
-                            rho_Y_y_TT.push_back(Q[si][idx_cell_rho_Y_y_TT]);
-                            rho_Y_y_TTT.push_back(Q[si][idx_cell_rho_Y_y_TTT]);
-                        }
-                        
                         /*
                          * Compute the mixture density.
                          */
@@ -2900,40 +3302,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             rho_y_TTT += Q[si][idx_cell_rho_Y_y_TTT];
                         }
                         
-                        /*
-                         * Compute the mass fractions.
-                         */
-                        
-                        std::vector<double> Y_y_T;
-                        std::vector<double> Y_y_TT;
-                        std::vector<double> Y_y_TTT;
-                        Y_y_T.reserve(d_num_species);
-                        Y_y_TT.reserve(d_num_species);
-                        Y_y_TTT.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                            Y_y_TT.push_back(Q[si][idx_cell_rho_Y_y_TT]/rho_y_TT);
-                            Y_y_TTT.push_back(Q[si][idx_cell_rho_Y_y_TTT]/rho_y_TTT);
-                        }
-                        
-                        /*
-                         * Get the pointers to the mass fractions.
-                         */
-                        
-                        std::vector<const double*> Y_y_T_ptr;
-                        std::vector<const double*> Y_y_TT_ptr;
-                        std::vector<const double*> Y_y_TTT_ptr;
-                        Y_y_T_ptr.reserve(d_num_species);
-                        Y_y_TT_ptr.reserve(d_num_species);
-                        Y_y_TTT_ptr.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_y_T_ptr.push_back(&Y_y_T[si]);
-                            Y_y_TT_ptr.push_back(&Y_y_TT[si]);
-                            Y_y_TTT_ptr.push_back(&Y_y_TTT[si]);
-                        }
-                        
                         const double u_y_T   = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
                         const double u_y_TT  = Q[d_num_species][idx_cell_mom_y_TT]/rho_y_TT;
                         const double u_y_TTT = Q[d_num_species][idx_cell_mom_y_TTT]/rho_y_TTT;
@@ -2942,51 +3310,35 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         const double v_y_TT  = Q[d_num_species + 1][idx_cell_mom_y_TT]/rho_y_TT;
                         const double v_y_TTT = Q[d_num_species + 1][idx_cell_mom_y_TTT]/rho_y_TTT;
                         
-                        const double half = double(1)/double(2);
                         const double epsilon_y_T   = Q[d_num_species + 2][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                         const double epsilon_y_TT  = Q[d_num_species + 2][idx_cell_E_y_TT]/rho_y_TT - half*(u_y_TT*u_y_TT + v_y_TT*v_y_TT);
                         const double epsilon_y_TTT = Q[d_num_species + 2][idx_cell_E_y_TTT]/rho_y_TTT- half*(u_y_TTT*u_y_TTT + v_y_TTT*v_y_TTT);
                         
-                        double p_y_T = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_y_T,
-                                &epsilon_y_T,
-                                Y_y_T_ptr);
+                        rho_states[idx_state_y_T]   = rho_y_T;
+                        rho_states[idx_state_y_TT]  = rho_y_TT;
+                        rho_states[idx_state_y_TTT] = rho_y_TTT;
                         
-                        double p_y_TT = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_y_TT,
-                                &epsilon_y_TT,
-                                Y_y_TT_ptr);
+                        u_states[idx_state_y_T]   = u_y_T;
+                        u_states[idx_state_y_TT]  = u_y_TT;
+                        u_states[idx_state_y_TTT] = u_y_TTT;
                         
-                        double p_y_TTT = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_y_TTT,
-                                &epsilon_y_TTT,
-                                Y_y_TTT_ptr);
+                        v_states[idx_state_y_T]   = v_y_T;
+                        v_states[idx_state_y_TT]  = v_y_TT;
+                        v_states[idx_state_y_TTT] = v_y_TTT;
                         
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
+                        epsilon_states[idx_state_y_T]   = epsilon_y_T;
+                        epsilon_states[idx_state_y_TT]  = epsilon_y_TT;
+                        epsilon_states[idx_state_y_TTT] = epsilon_y_TTT;
                         
-                        std::vector<double> drho_Y_dy;
-                        drho_Y_dy.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            drho_Y_dy.push_back(-(Q[si][idx_cell_rho_Y_y_TTT] - double(4)*Q[si][idx_cell_rho_Y_y_TT] +
-                                double(3)*Q[si][idx_cell_rho_Y_y_T])/(double(2)*dx[1]));
+                            rho_Y_states[idx_state_y_T*d_num_species + si]   = Q[si][idx_cell_rho_Y_y_T];
+                            rho_Y_states[idx_state_y_TT*d_num_species + si]  = Q[si][idx_cell_rho_Y_y_TT];
+                            rho_Y_states[idx_state_y_TTT*d_num_species + si] = Q[si][idx_cell_rho_Y_y_TTT];
+                            Y_states[si*num_states + idx_state_y_T]   = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                            Y_states[si*num_states + idx_state_y_TT]  = Q[si][idx_cell_rho_Y_y_TT]/rho_y_TT;
+                            Y_states[si*num_states + idx_state_y_TTT] = Q[si][idx_cell_rho_Y_y_TTT]/rho_y_TTT;
                         }
-                        const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
-                        const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
-                        const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
-                        
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
-                        
-                        double du_dx = double(0);
-                        double dv_dx = double(0);
-                        double dp_dx = double(0);
                         
                         if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                             (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -3017,42 +3369,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
+                            const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
+                            const double epsilon_x_R = Q[d_num_species + 2][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
+                            
+                            rho_states[idx_state_x_R]     = rho_x_R;
+                            u_states[idx_state_x_R]       = u_x_R;
+                            v_states[idx_state_x_R]       = v_x_R;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
                             
-                            std::vector<double> Y_x_R;
-                            Y_x_R.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
+                                Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_R_ptr;
-                            Y_x_R_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_L]     = rho_y_T;
+                            epsilon_states[idx_state_x_L] = epsilon_y_T;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_R_ptr.push_back(&Y_x_R[si]);
+                                Y_states[si*num_states + idx_state_x_L] = Y_states[si*num_states + idx_state_y_T];
                             }
-                            
-                            const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-                            const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-                            const double epsilon_x_R = Q[d_num_species + 2][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
-                            
-                            double p_x_R = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    Y_x_R_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dx = (u_x_R - u_y_T)/(dx[0]);
-                            dv_dx = (v_x_R - v_y_T)/(dx[0]);
-                            dp_dx = (p_x_R - p_y_T)/(dx[0]);
                         }
                         else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                  (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -3083,42 +3421,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_x_L += Q[si][idx_cell_rho_Y_x_L];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
+                            const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
+                            const double epsilon_x_L = Q[d_num_species + 2][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
+                            
+                            rho_states[idx_state_x_L]     = rho_x_L;
+                            u_states[idx_state_x_L]       = u_x_L;
+                            v_states[idx_state_x_L]       = v_x_L;
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
                             
-                            std::vector<double> Y_x_L;
-                            Y_x_L.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
+                                Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_L_ptr;
-                            Y_x_L_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_R]     = rho_y_T;
+                            epsilon_states[idx_state_x_R] = epsilon_y_T;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_L_ptr.push_back(&Y_x_L[si]);
+                                Y_states[si*num_states + idx_state_x_R] = Y_states[si*num_states + idx_state_y_T];
                             }
-                            
-                            const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
-                            const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
-                            const double epsilon_x_L = Q[d_num_species + 2][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
-
-                            double p_x_L = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    Y_x_L_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dx = (u_y_T - u_x_L)/(dx[0]);
-                            dv_dx = (v_y_T - v_x_L)/(dx[0]);
-                            dp_dx = (p_y_T - p_x_L)/(dx[0]);
                         }
                         else
                         {
@@ -3152,34 +3476,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_x_L;
-                            std::vector<double> Y_x_R;
-                            Y_x_L.reserve(d_num_species);
-                            Y_x_R.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                                Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_L_ptr;
-                            std::vector<const double*> Y_x_R_ptr;
-                            Y_x_L_ptr.reserve(d_num_species);
-                            Y_x_R_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_L_ptr.push_back(&Y_x_L[si]);
-                                Y_x_R_ptr.push_back(&Y_x_R[si]);
-                            }
-                            
                             const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                             const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
                             
@@ -3189,51 +3485,195 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             const double epsilon_x_L = Q[d_num_species + 2][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                             const double epsilon_x_R = Q[d_num_species + 2][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                             
-                            double p_x_L = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    Y_x_L_ptr);
+                            rho_states[idx_state_x_L] = rho_x_L;
+                            rho_states[idx_state_x_R] = rho_x_R;
                             
-                            double p_x_R = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    Y_x_R_ptr);
+                            u_states[idx_state_x_L] = u_x_L;
+                            u_states[idx_state_x_R] = u_x_R;
                             
-                            // Central derivatives.
-                            du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                            dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                            dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            v_states[idx_state_x_L] = v_x_L;
+                            v_states[idx_state_x_R] = v_x_R;
+                            
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
+                            
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                                Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                            }
                         }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                    {
+                        const int idx_line = i - fill_box_lo_idx[0];
                         
-                        // Compute sound speed.
+                        const int idx_state_y_T   = idx_line;
+                        const int idx_state_y_TT  = idx_line + num_lines;
+                        const int idx_state_y_TTT = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
                         
-                        const double Gamma_y_T = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                            &rho_y_T,
-                            &p_y_T,
-                            Y_y_T_ptr);
+                        const double& rho_y_T = rho_states[idx_state_y_T];
                         
-                        const std::vector<double> Psi_y_T = d_equation_of_state_mixing_rules->
-                            getPressureDerivativeWithPartialDensities(
-                                    &rho_y_T,
-                                    &p_y_T,
-                                    Y_y_T_ptr);
+                        const double& u_y_T   = u_states[idx_state_y_T];
+                        const double& u_y_TT  = u_states[idx_state_y_TT];
+                        const double& u_y_TTT = u_states[idx_state_y_TTT];
                         
-                        double c_y_T = Gamma_y_T*p_y_T/rho_y_T;
+                        const double& v_y_T   = v_states[idx_state_y_T];
+                        const double& v_y_TT  = v_states[idx_state_y_TT];
+                        const double& v_y_TTT = v_states[idx_state_y_TTT];
+                        
+                        const double& p_y_T   = p_states[idx_state_y_T];
+                        const double& p_y_TT  = p_states[idx_state_y_TT];
+                        const double& p_y_TTT = p_states[idx_state_y_TTT];
+                        
+                        const double* const rho_Y_y_T   = &rho_Y_states[idx_state_y_T*d_num_species];
+                        const double* const rho_Y_y_TT  = &rho_Y_states[idx_state_y_TT*d_num_species];
+                        const double* const rho_Y_y_TTT = &rho_Y_states[idx_state_y_TTT*d_num_species];
+                        
+                        double Y_y_T[d_num_species];
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            c_y_T += Y_y_T[si]*Psi_y_T[si];
+                            Y_y_T[si] = Y_states[si*num_states + idx_state_y_T];
                         }
-                        c_y_T = sqrt(c_y_T);
                         
-                        const double lambda_last = v_y_T + c_y_T;
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
                         
-                        // Compute vector Lambda^(-1) * L.
+                        double drho_Y_dy[d_num_species];
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            drho_Y_dy[si] = -(rho_Y_y_TTT[si] - double(4)*rho_Y_y_TT[si] +
+                                double(3)*rho_Y_y_T[si])/(double(2)*dx[1]);
+                        }
+                        const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
+                        const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
+                        const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
                         
-                        double Lambda_inv_L[d_num_species + 3];
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
                         
-                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
+                        double du_dx = double(0);
+                        double dv_dx = double(0);
+                        double dp_dx = double(0);
+                        
+                        if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            (i + num_subghosts_conservative_var[2][0] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                        //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_R = p_states[idx_state_x_R];
+                            
+                            // One-sided derivatives.
+                            du_dx = (u_x_R - u_y_T)/(dx[0]);
+                            dv_dx = (v_x_R - v_y_T)/(dx[0]);
+                            dp_dx = (p_x_R - p_y_T)/(dx[0]);
+                        }
+                        else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                 (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                 (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                        //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                        //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                        //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& p_x_L = p_states[idx_state_x_L];
+                            
+                            // One-sided derivatives.
+                            du_dx = (u_y_T - u_x_L)/(dx[0]);
+                            dv_dx = (v_y_T - v_x_L)/(dx[0]);
+                            dp_dx = (p_y_T - p_x_L)/(dx[0]);
+                        }
+                        else
+                        {
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_L = p_states[idx_state_x_L];
+                            const double& p_x_R = p_states[idx_state_x_R];
+                            
+                            // Central derivatives.
+                            du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                            dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                            dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                        }
+                        
+                        // Compute sound speed.
+                        
+                        double c_y_T = Gamma_bdry[idx_line]*p_y_T/rho_y_T;
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            c_y_T += Y_y_T[si]*Psi_bdry[si*num_lines + idx_line];
+                        }
+                        c_y_T = sqrt(c_y_T);
+                        
+                        const double lambda_last = v_y_T + c_y_T;
+                        
+                        // Compute vector Lambda^(-1) * L.
+                        
+                        double Lambda_inv_L[d_num_species + 3];
+                        
+                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
                         const double& sigma       = d_bdry_edge_nonreflecting_outflow_sigma[edge_loc];
                         const double& beta        = d_bdry_edge_nonreflecting_outflow_beta[edge_loc];
                         const double& length_char = d_bdry_edge_nonreflecting_outflow_length_char[edge_loc];
@@ -3458,26 +3898,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_ghost += V_ghost[j*(d_num_species + 3) + si];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_ghost;
-                            Y_ghost.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_ghost.push_back(V_ghost[j*(d_num_species + 3) + si]/rho_ghost);
-                            }
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                             
                             /*
-                             * Get the pointers to the mass fractions.
+                             * Compute the mass fractions.
                              */
                             
-                            std::vector<const double*> Y_ghost_ptr;
-                            Y_ghost_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[j*(d_num_species + 3) + si]/rho_ghost;
                             }
                             
                             for(int si=0; si < d_num_species; si++)
@@ -3488,20 +3917,45 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             Q[d_num_species][idx_cell_mom]     = rho_ghost*V_ghost[j*(d_num_species + 3) + d_num_species];
                             Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[j*(d_num_species + 3) + d_num_species + 1];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergy(
-                                    &rho_ghost,
-                                    &V_ghost[j*(d_num_species + 3) + d_num_species + 2],
-                                    Y_ghost_ptr);
-                            
-                            const double E = rho_ghost*epsilon +
-                                half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
-                                    rho_ghost;
+                            rho_ghosts[idx_ghost] = rho_ghost;
+                            p_ghosts[idx_ghost]   = V_ghost[j*(d_num_species + 3) + d_num_species + 2];
                             
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
                 }
                 else if (edge_loc == BDRY_LOC::YHI)
                 {
@@ -3514,10 +3968,50 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = i - fill_box_lo_idx[0];
+                        
+                        const int idx_state_y_B   = idx_line;
+                        const int idx_state_y_BB  = idx_line + num_lines;
+                        const int idx_state_y_BBB = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
                         
                         const int idx_cell_rho_Y_y_B = (i + num_subghosts_conservative_var[0][0]) +
                             (interior_box_hi_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0];
@@ -3546,19 +4040,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         const int idx_cell_E_y_BBB = (i + num_subghosts_conservative_var[2][0]) + 
                             (interior_box_hi_idx[1] - 2 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0];
                         
-                        std::vector<double> rho_Y_y_B;
-                        std::vector<double> rho_Y_y_BB;
-                        std::vector<double> rho_Y_y_BBB;
-                        rho_Y_y_B.reserve(d_num_species);
-                        rho_Y_y_BB.reserve(d_num_species);
-                        rho_Y_y_BBB.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            rho_Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]);
-                            rho_Y_y_BB.push_back(Q[si][idx_cell_rho_Y_y_BB]);
-                            rho_Y_y_BBB.push_back(Q[si][idx_cell_rho_Y_y_BBB]);
-                        }
-                        
                         /*
                          * Compute the mixture density.
                          */
@@ -3573,40 +4054,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             rho_y_BBB += Q[si][idx_cell_rho_Y_y_BBB];
                         }
                         
-                        /*
-                         * Compute the mass fractions.
-                         */
-                        
-                        std::vector<double> Y_y_B;
-                        std::vector<double> Y_y_BB;
-                        std::vector<double> Y_y_BBB;
-                        Y_y_B.reserve(d_num_species);
-                        Y_y_BB.reserve(d_num_species);
-                        Y_y_BBB.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                            Y_y_BB.push_back(Q[si][idx_cell_rho_Y_y_BB]/rho_y_BB);
-                            Y_y_BBB.push_back(Q[si][idx_cell_rho_Y_y_BBB]/rho_y_BBB);
-                        }
-                        
-                        /*
-                         * Get the pointers to the mass fractions.
-                         */
-                        
-                        std::vector<const double*> Y_y_B_ptr;
-                        std::vector<const double*> Y_y_BB_ptr;
-                        std::vector<const double*> Y_y_BBB_ptr;
-                        Y_y_B_ptr.reserve(d_num_species);
-                        Y_y_BB_ptr.reserve(d_num_species);
-                        Y_y_BBB_ptr.reserve(d_num_species);
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            Y_y_B_ptr.push_back(&Y_y_B[si]);
-                            Y_y_BB_ptr.push_back(&Y_y_BB[si]);
-                            Y_y_BBB_ptr.push_back(&Y_y_BBB[si]);
-                        }
-                       
                         const double u_y_B   = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                         const double u_y_BB  = Q[d_num_species][idx_cell_mom_y_BB]/rho_y_BB;
                         const double u_y_BBB = Q[d_num_species][idx_cell_mom_y_BBB]/rho_y_BBB;
@@ -3614,52 +4061,36 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                         const double v_y_B   = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
                         const double v_y_BB  = Q[d_num_species + 1][idx_cell_mom_y_BB]/rho_y_BB;
                         const double v_y_BBB = Q[d_num_species + 1][idx_cell_mom_y_BBB]/rho_y_BBB;
-                       
-                        const double half = double(1)/double(2);
+                        
                         const double epsilon_y_B   = Q[d_num_species + 2][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                         const double epsilon_y_BB  = Q[d_num_species + 2][idx_cell_E_y_BB]/rho_y_BB - half*(u_y_BB*u_y_BB + v_y_BB*v_y_BB);
                         const double epsilon_y_BBB = Q[d_num_species + 2][idx_cell_E_y_BBB]/rho_y_BBB - half*(u_y_BBB*u_y_BBB + v_y_BBB*v_y_BBB);
                         
-                        double p_y_B = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_y_B,
-                                &epsilon_y_B,
-                                Y_y_B_ptr);
+                        rho_states[idx_state_y_B]   = rho_y_B;
+                        rho_states[idx_state_y_BB]  = rho_y_BB;
+                        rho_states[idx_state_y_BBB] = rho_y_BBB;
                         
-                        double p_y_BB = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_y_BB,
-                                &epsilon_y_BB,
-                                Y_y_BB_ptr);
+                        u_states[idx_state_y_B]   = u_y_B;
+                        u_states[idx_state_y_BB]  = u_y_BB;
+                        u_states[idx_state_y_BBB] = u_y_BBB;
                         
-                        double p_y_BBB = d_equation_of_state_mixing_rules->
-                            getPressure(
-                                &rho_y_BBB,
-                                &epsilon_y_BBB,
-                                Y_y_BBB_ptr);
+                        v_states[idx_state_y_B]   = v_y_B;
+                        v_states[idx_state_y_BB]  = v_y_BB;
+                        v_states[idx_state_y_BBB] = v_y_BBB;
                         
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
+                        epsilon_states[idx_state_y_B]   = epsilon_y_B;
+                        epsilon_states[idx_state_y_BB]  = epsilon_y_BB;
+                        epsilon_states[idx_state_y_BBB] = epsilon_y_BBB;
                         
-                        std::vector<double> drho_Y_dy;
-                        drho_Y_dy.reserve(d_num_species);
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            drho_Y_dy.push_back((Q[si][idx_cell_rho_Y_y_BBB] - double(4)*Q[si][idx_cell_rho_Y_y_BB] +
-                                double(3)*Q[si][idx_cell_rho_Y_y_B])/(double(2)*dx[1]));
+                            rho_Y_states[idx_state_y_B*d_num_species + si]   = Q[si][idx_cell_rho_Y_y_B];
+                            rho_Y_states[idx_state_y_BB*d_num_species + si]  = Q[si][idx_cell_rho_Y_y_BB];
+                            rho_Y_states[idx_state_y_BBB*d_num_species + si] = Q[si][idx_cell_rho_Y_y_BBB];
+                            Y_states[si*num_states + idx_state_y_B]   = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                            Y_states[si*num_states + idx_state_y_BB]  = Q[si][idx_cell_rho_Y_y_BB]/rho_y_BB;
+                            Y_states[si*num_states + idx_state_y_BBB] = Q[si][idx_cell_rho_Y_y_BBB]/rho_y_BBB;
                         }
-                        const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
-                        const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
-                        const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
-                        
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
-                        
-                        double du_dx = double(0);
-                        double dv_dx = double(0);
-                        double dp_dx = double(0);
                         
                         if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                             (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -3690,42 +4121,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
+                            const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
+                            const double epsilon_x_R = Q[d_num_species + 2][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
+                            
+                            rho_states[idx_state_x_R]     = rho_x_R;
+                            u_states[idx_state_x_R]       = u_x_R;
+                            v_states[idx_state_x_R]       = v_x_R;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
                             
-                            std::vector<double> Y_x_R;
-                            Y_x_R.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
+                                Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_R_ptr;
-                            Y_x_R_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_L]     = rho_y_B;
+                            epsilon_states[idx_state_x_L] = epsilon_y_B;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_R_ptr.push_back(&Y_x_R[si]);
+                                Y_states[si*num_states + idx_state_x_L] = Y_states[si*num_states + idx_state_y_B];
                             }
-                            
-                            const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-                            const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-                            const double epsilon_x_R = Q[d_num_species + 2][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
-                            
-                            double p_x_R = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    Y_x_R_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dx = (u_x_R - u_y_B)/(dx[0]);
-                            dv_dx = (v_x_R - v_y_B)/(dx[0]);
-                            dp_dx = (p_x_R - p_y_B)/(dx[0]);
                         }
                         else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                  (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -3756,42 +4173,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_x_L += Q[si][idx_cell_rho_Y_x_L];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
+                            const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
+                            const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
+                            const double epsilon_x_L = Q[d_num_species + 2][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
+                            
+                            rho_states[idx_state_x_L]     = rho_x_L;
+                            u_states[idx_state_x_L]       = u_x_L;
+                            v_states[idx_state_x_L]       = v_x_L;
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
                             
-                            std::vector<double> Y_x_L;
-                            Y_x_L.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
+                                Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
                             }
                             
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_L_ptr;
-                            Y_x_L_ptr.reserve(d_num_species);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_R]     = rho_y_B;
+                            epsilon_states[idx_state_x_R] = epsilon_y_B;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_x_L_ptr.push_back(&Y_x_L[si]);
+                                Y_states[si*num_states + idx_state_x_R] = Y_states[si*num_states + idx_state_y_B];
                             }
-                            
-                            const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
-                            const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
-                            const double epsilon_x_L = Q[d_num_species + 2][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
-                            
-                            double p_x_L = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    Y_x_L_ptr);
-                            
-                            // One-sided derivatives.
-                            du_dx = (u_y_B - u_x_L)/(dx[0]);
-                            dv_dx = (v_y_B - v_x_L)/(dx[0]);
-                            dp_dx = (p_y_B - p_x_L)/(dx[0]);
                         }
                         else
                         {
@@ -3825,34 +4228,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_x_L;
-                            std::vector<double> Y_x_R;
-                            Y_x_L.reserve(d_num_species);
-                            Y_x_R.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                                Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_L_ptr;
-                            std::vector<const double*> Y_x_R_ptr;
-                            Y_x_L_ptr.reserve(d_num_species);
-                            Y_x_R_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_L_ptr.push_back(&Y_x_L[si]);
-                                Y_x_R_ptr.push_back(&Y_x_R[si]);
-                            }
-                            
                             const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                             const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
                             
@@ -3862,91 +4237,235 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             const double epsilon_x_L = Q[d_num_species + 2][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                             const double epsilon_x_R = Q[d_num_species + 2][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                             
-                            double p_x_L = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    Y_x_L_ptr);
+                            rho_states[idx_state_x_L] = rho_x_L;
+                            rho_states[idx_state_x_R] = rho_x_R;
                             
-                            double p_x_R = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    Y_x_R_ptr);
+                            u_states[idx_state_x_L] = u_x_L;
+                            u_states[idx_state_x_R] = u_x_R;
                             
-                            // Central derivatives.
-                            du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                            dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                            dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
-                        }
-                        
-                        // Compute sound speed.
-                        
-                        const double Gamma_y_B = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                            &rho_y_B,
-                            &p_y_B,
-                            Y_y_B_ptr);
-                        
-                        const std::vector<double> Psi_y_B = d_equation_of_state_mixing_rules->
-                            getPressureDerivativeWithPartialDensities(
-                                    &rho_y_B,
-                                    &p_y_B,
-                                    Y_y_B_ptr);
-                        
-                        double c_y_B = Gamma_y_B*p_y_B/rho_y_B;
-                        for (int si = 0; si < d_num_species; si++)
-                        {
-                            c_y_B += Y_y_B[si]*Psi_y_B[si];
+                            v_states[idx_state_x_L] = v_x_L;
+                            v_states[idx_state_x_R] = v_x_R;
+                            
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
+                            
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                                Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                            }
                         }
-                        c_y_B = sqrt(c_y_B);
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                    {
+                        const int idx_line = i - fill_box_lo_idx[0];
                         
-                        const double lambda_1 = v_y_B - c_y_B;
+                        const int idx_state_y_B   = idx_line;
+                        const int idx_state_y_BB  = idx_line + num_lines;
+                        const int idx_state_y_BBB = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
                         
-                        // Compute vector Lambda^(-1) * L.
+                        const double& rho_y_B = rho_states[idx_state_y_B];
                         
-                        double Lambda_inv_L[d_num_species + 3];
+                        const double& u_y_B   = u_states[idx_state_y_B];
+                        const double& u_y_BB  = u_states[idx_state_y_BB];
+                        const double& u_y_BBB = u_states[idx_state_y_BBB];
                         
-                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
-                        const double& sigma       = d_bdry_edge_nonreflecting_outflow_sigma[edge_loc];
-                        const double& beta        = d_bdry_edge_nonreflecting_outflow_beta[edge_loc];
-                        const double& length_char = d_bdry_edge_nonreflecting_outflow_length_char[edge_loc];
+                        const double& v_y_B   = v_states[idx_state_y_B];
+                        const double& v_y_BB  = v_states[idx_state_y_BB];
+                        const double& v_y_BBB = v_states[idx_state_y_BBB];
                         
-                        const double T_1 = u_y_B*(dp_dx - rho_y_B*c_y_B*dv_dx) + rho_y_B*c_y_B*c_y_B*du_dx;
+                        const double& p_y_B   = p_states[idx_state_y_B];
+                        const double& p_y_BB  = p_states[idx_state_y_BB];
+                        const double& p_y_BBB = p_states[idx_state_y_BBB];
                         
-                        const double M_sq = (v_y_B*v_y_B + u_y_B*u_y_B)/(c_y_B*c_y_B);
-                        const double K = sigma*c_y_B*(double(1) - M_sq)/length_char;
+                        const double* const rho_Y_y_B   = &rho_Y_states[idx_state_y_B*d_num_species];
+                        const double* const rho_Y_y_BB  = &rho_Y_states[idx_state_y_BB*d_num_species];
+                        const double* const rho_Y_y_BBB = &rho_Y_states[idx_state_y_BBB*d_num_species];
                         
-                        Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_y_B - p_t) - (double(1) - beta)*T_1);
-                        Lambda_inv_L[1] = du_dy;
+                        double Y_y_B[d_num_species];
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            Lambda_inv_L[si + 2] = c_y_B*c_y_B*drho_Y_dy[si] - Y_y_B[si]*dp_dy;
+                            Y_y_B[si] = Y_states[si*num_states + idx_state_y_B];
                         }
-                        Lambda_inv_L[d_num_species + 2] = dp_dy + rho_y_B*c_y_B*dv_dy;
-                        
-                       // Compute dV_dy.
-                        
-                        const double c_sq_inv  = double(1)/(c_y_B*c_y_B);
-                        const double rho_c_inv = double(1)/(rho_y_B*c_y_B);
                         
-                        double dV_dy[d_num_species + 3];
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
                         
+                        double drho_Y_dy[d_num_species];
                         for (int si = 0; si < d_num_species; si++)
                         {
-                            dV_dy[si] = half*c_sq_inv*Y_y_B[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]) +
-                                c_sq_inv*Lambda_inv_L[si+2];
+                            drho_Y_dy[si] = (rho_Y_y_BBB[si] - double(4)*rho_Y_y_BB[si] +
+                                double(3)*rho_Y_y_B[si])/(double(2)*dx[1]);
                         }
-                        dV_dy[d_num_species] = Lambda_inv_L[1];
-                        dV_dy[d_num_species + 1] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]);
-                        dV_dy[d_num_species + 2] = half*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]); 
+                        const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
+                        const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
+                        const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
                         
-                        double V_ghost[(d_num_species + 3)*num_ghosts_to_fill];
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
                         
-                        for (int j = 0; j < num_ghosts_to_fill; j++)
+                        double du_dx = double(0);
+                        double dv_dx = double(0);
+                        double dp_dx = double(0);
+                        
+                        if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            (i + num_subghosts_conservative_var[2][0] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                        //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[2][0] == 0)))
                         {
-                            const int idx_cell_rho_Y = (i + num_subghosts_conservative_var[0][0]) +
-                                (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*
-                                    subghostcell_dims_conservative_var[0][0];
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_R = p_states[idx_state_x_R];
+                            
+                            // One-sided derivatives.
+                            du_dx = (u_x_R - u_y_B)/(dx[0]);
+                            dv_dx = (v_x_R - v_y_B)/(dx[0]);
+                            dp_dx = (p_x_R - p_y_B)/(dx[0]);
+                        }
+                        else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                 (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                 (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                        //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                        //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                        //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& p_x_L = p_states[idx_state_x_L];
+                            
+                            // One-sided derivatives.
+                            du_dx = (u_y_B - u_x_L)/(dx[0]);
+                            dv_dx = (v_y_B - v_x_L)/(dx[0]);
+                            dp_dx = (p_y_B - p_x_L)/(dx[0]);
+                        }
+                        else
+                        {
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_L = p_states[idx_state_x_L];
+                            const double& p_x_R = p_states[idx_state_x_R];
+                            
+                            // Central derivatives.
+                            du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                            dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                            dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                        }
+                        
+                        // Compute sound speed.
+                        
+                        double c_y_B = Gamma_bdry[idx_line]*p_y_B/rho_y_B;
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            c_y_B += Y_y_B[si]*Psi_bdry[si*num_lines + idx_line];
+                        }
+                        c_y_B = sqrt(c_y_B);
+                        
+                        const double lambda_1 = v_y_B - c_y_B;
+                        
+                        // Compute vector Lambda^(-1) * L.
+                        
+                        double Lambda_inv_L[d_num_species + 3];
+                        
+                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
+                        const double& sigma       = d_bdry_edge_nonreflecting_outflow_sigma[edge_loc];
+                        const double& beta        = d_bdry_edge_nonreflecting_outflow_beta[edge_loc];
+                        const double& length_char = d_bdry_edge_nonreflecting_outflow_length_char[edge_loc];
+                        
+                        const double T_1 = u_y_B*(dp_dx - rho_y_B*c_y_B*dv_dx) + rho_y_B*c_y_B*c_y_B*du_dx;
+                        
+                        const double M_sq = (v_y_B*v_y_B + u_y_B*u_y_B)/(c_y_B*c_y_B);
+                        const double K = sigma*c_y_B*(double(1) - M_sq)/length_char;
+                        
+                        Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_y_B - p_t) - (double(1) - beta)*T_1);
+                        Lambda_inv_L[1] = du_dy;
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Lambda_inv_L[si + 2] = c_y_B*c_y_B*drho_Y_dy[si] - Y_y_B[si]*dp_dy;
+                        }
+                        Lambda_inv_L[d_num_species + 2] = dp_dy + rho_y_B*c_y_B*dv_dy;
+                       
+                       // Compute dV_dy.
+                        
+                        const double c_sq_inv  = double(1)/(c_y_B*c_y_B);
+                        const double rho_c_inv = double(1)/(rho_y_B*c_y_B);
+                        
+                        double dV_dy[d_num_species + 3];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            dV_dy[si] = half*c_sq_inv*Y_y_B[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]) +
+                                c_sq_inv*Lambda_inv_L[si+2];
+                        }
+                        dV_dy[d_num_species] = Lambda_inv_L[1];
+                        dV_dy[d_num_species + 1] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]);
+                        dV_dy[d_num_species + 2] = half*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 2]); 
+                        
+                        double V_ghost[(d_num_species + 3)*num_ghosts_to_fill];
+                        
+                        for (int j = 0; j < num_ghosts_to_fill; j++)
+                        {
+                            const int idx_cell_rho_Y = (i + num_subghosts_conservative_var[0][0]) +
+                                (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*
+                                    subghostcell_dims_conservative_var[0][0];
                             
                             const int idx_cell_mom = (i + num_subghosts_conservative_var[1][0]) +
                                 (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[1][1])*
@@ -4131,26 +4650,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                                 rho_ghost += V_ghost[j*(d_num_species + 3) + si];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_ghost;
-                            Y_ghost.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_ghost.push_back(V_ghost[j*(d_num_species + 3) + si]/rho_ghost);
-                            }
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                             
                             /*
-                             * Get the pointers to the mass fractions.
+                             * Compute the mass fractions.
                              */
                             
-                            std::vector<const double*> Y_ghost_ptr;
-                            Y_ghost_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[j*(d_num_species + 3) + si]/rho_ghost;
                             }
                             
                             for(int si=0; si < d_num_species; si++)
@@ -4161,20 +4669,45 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dEdgeBoundaryData(
                             Q[d_num_species][idx_cell_mom]     = rho_ghost*V_ghost[j*(d_num_species + 3) + d_num_species];
                             Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[j*(d_num_species + 3) + d_num_species + 1];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergy(
-                                    &rho_ghost,
-                                    &V_ghost[j*(d_num_species + 3) + d_num_species + 2],
-                                    Y_ghost_ptr);
+                            rho_ghosts[idx_ghost] = rho_ghost;
+                            p_ghosts[idx_ghost]   = V_ghost[j*(d_num_species + 3) + d_num_species + 2];
                             
-                            const double E = rho_ghost*epsilon +
-                                half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
-                                    rho_ghost;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
                 }
                 
                 // Remove edge locations that have boundary conditions identified.                    
@@ -4393,6 +4926,34 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                 
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4462,22 +5023,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                              * Compute the mass fractions of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
                             /*
@@ -4494,48 +5042,107 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                                 2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_0*2 + 1];
                             
                             /*
-                             * Set the values for total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho_pivot,
-                                    &T,
-                                    Y_pivot_ptr);
+                            rho_pivot_fill[count_fill] = rho_pivot;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
                             
-                            double E = rho_pivot*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4605,22 +5212,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                              * Compute the mass fractions of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
                             /*
@@ -4637,48 +5231,111 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                                 2.0*rho_pivot*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_1*2 + 1];
                             
                             /*
-                             * Set the values for total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho_pivot,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho_pivot*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
+                            rho_pivot_fill[count_fill] = rho_pivot;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
                             
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho_pivot;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4748,79 +5405,109 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                              * Compute the mass fractions of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
+                                Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
                             /*
-                             * Get the pointers to the mass fractions of the pivot.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
-                            }
-                            
-                            /*
-                             * Set the values for partial densities, momentum and total internal energy.
-                             */
-                            
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double p = p_pivot;
+                            rho_pivot_fill[count_fill] = rho_pivot;
+                            idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
+                            idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                             
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = -T_pivot + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_0];
-                            
-                            double rho = d_equation_of_state_mixing_rules->
-                                getMixtureDensity(
-                                    &p,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2];
-                            double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2 + 1];
-                            
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                            }
-                            Q[d_num_species][idx_cell_mom] = rho*u;
-                            Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_fill++;
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2 + 1];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
                         }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
                     }
                     
                     // Remove node locations that have boundary conditions identified.
@@ -4829,6 +5516,38 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4898,82 +5617,112 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill2dNodeBoundaryData(
                              * Compute the mass fractions of the pivot.
                              */
                             
-                            std::vector<double> Y_pivot;
-                            Y_pivot.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions of the pivot.
-                             */
-                            
-                            std::vector<const double*> Y_pivot_ptr;
-                            Y_pivot_ptr.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                             }
                             
                             /*
-                             * Set the values for partial densities, momentum and total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[d_num_species + 2][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[d_num_species + 2][idx_cell_pivot_E] -
                                 0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                      Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom])/
                                 rho_pivot)/rho_pivot;
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_pivot,
-                                    &epsilon_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double p = p_pivot;
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->
-                                getTemperature(
-                                    &rho_pivot,
-                                    &p_pivot,
-                                    Y_pivot_ptr);
-                            
-                            double T = -T_pivot + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_1];
-                            
-                            double rho = d_equation_of_state_mixing_rules->
-                                getMixtureDensity(
-                                    &p,
-                                    &T,
-                                    Y_pivot_ptr);
+                            rho_pivot_fill[count_fill] = rho_pivot;
+                            idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
+                            idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                             
-                            double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2];
-                            double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2 + 1];
-                            
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                            }
-                            Q[d_num_species][idx_cell_mom] = rho*u;
-                            Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    Y_pivot_ptr);
-                            
-                            double E = rho*epsilon +
-                                0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                    Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
-                            
-                            Q[d_num_species + 2][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
-                    // Remove node locations that have boundary conditions identified.
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_edge_isothermal_no_slip_T[edge_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2 + 1];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 2][idx_cell_E] = E;
+                    }
+                    
+                    // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
@@ -5161,6 +5910,34 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                 
                 if (bdry_face_conds[face_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -5363,22 +6140,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
@@ -5397,52 +6161,115 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove face locations that have boundary conditions identified.
                     bdry_face_locs.erase(std::remove(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc),
                         bdry_face_locs.end());
                 }
                 else if (bdry_face_conds[face_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -5645,87 +6472,117 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
-                                 * Set the values for partial densities, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove face locations that have boundary conditions identified.
                     bdry_face_locs.erase(std::remove(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc),
                         bdry_face_locs.end());
@@ -5818,12 +6675,56 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 6)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                            
+                            const int idx_state_x_R   = idx_line;
+                            const int idx_state_x_RR  = idx_line + num_lines;
+                            const int idx_state_x_RRR = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_Y_x_R = (interior_box_lo_idx[0] + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -5870,19 +6771,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 (k + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
                                     subghostcell_dims_conservative_var[2][1];
                             
-                            std::vector<double> rho_Y_x_R;
-                            std::vector<double> rho_Y_x_RR;
-                            std::vector<double> rho_Y_x_RRR;
-                            rho_Y_x_R.reserve(d_num_species);
-                            rho_Y_x_RR.reserve(d_num_species);
-                            rho_Y_x_RRR.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                rho_Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]);
-                                rho_Y_x_RR.push_back(Q[si][idx_cell_rho_Y_x_RR]);
-                                rho_Y_x_RRR.push_back(Q[si][idx_cell_rho_Y_x_RRR]);
-                            }
-                            
                             /*
                              * Compute the mixture density.
                              */
@@ -5897,40 +6785,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 rho_x_RRR += Q[si][idx_cell_rho_Y_x_RRR];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_x_R;
-                            std::vector<double> Y_x_RR;
-                            std::vector<double> Y_x_RRR;
-                            Y_x_R.reserve(d_num_species);
-                            Y_x_RR.reserve(d_num_species);
-                            Y_x_RRR.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                                Y_x_RR.push_back(Q[si][idx_cell_rho_Y_x_RR]/rho_x_RR);
-                                Y_x_RRR.push_back(Q[si][idx_cell_rho_Y_x_RRR]/rho_x_RRR);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_R_ptr;
-                            std::vector<const double*> Y_x_RR_ptr;
-                            std::vector<const double*> Y_x_RRR_ptr;
-                            Y_x_R_ptr.reserve(d_num_species);
-                            Y_x_RR_ptr.reserve(d_num_species);
-                            Y_x_RRR_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_R_ptr.push_back(&Y_x_R[si]);
-                                Y_x_RR_ptr.push_back(&Y_x_RR[si]);
-                                Y_x_RRR_ptr.push_back(&Y_x_RRR[si]);
-                            }
-                            
                             const double u_x_R   = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
                             const double u_x_RR  = Q[d_num_species][idx_cell_mom_x_RR]/rho_x_RR;
                             const double u_x_RRR = Q[d_num_species][idx_cell_mom_x_RRR]/rho_x_RRR;
@@ -5943,53 +6797,39 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             const double w_x_RR  = Q[d_num_species + 2][idx_cell_mom_x_RR]/rho_x_RR;
                             const double w_x_RRR = Q[d_num_species + 2][idx_cell_mom_x_RRR]/rho_x_RRR;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_x_R   = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                             const double epsilon_x_RR  = Q[d_num_species + 3][idx_cell_E_x_RR]/rho_x_RR - half*(u_x_RR*u_x_RR + v_x_RR*v_x_RR + w_x_RR*w_x_RR);
                             const double epsilon_x_RRR = Q[d_num_species + 3][idx_cell_E_x_RRR]/rho_x_RRR - half*(u_x_RRR*u_x_RRR + v_x_RRR*v_x_RRR + w_x_RRR*w_x_RRR);
                             
-                            double p_x_R = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    Y_x_R_ptr);
+                            rho_states[idx_state_x_R]   = rho_x_R;
+                            rho_states[idx_state_x_RR]  = rho_x_RR;
+                            rho_states[idx_state_x_RRR] = rho_x_RRR;
                             
-                            double p_x_RR = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_RR,
-                                    &epsilon_x_RR,
-                                    Y_x_RR_ptr);
+                            u_states[idx_state_x_R]   = u_x_R;
+                            u_states[idx_state_x_RR]  = u_x_RR;
+                            u_states[idx_state_x_RRR] = u_x_RRR;
                             
-                            double p_x_RRR = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_RRR,
-                                    &epsilon_x_RRR,
-                                    Y_x_RRR_ptr);
+                            v_states[idx_state_x_R]   = v_x_R;
+                            v_states[idx_state_x_RR]  = v_x_RR;
+                            v_states[idx_state_x_RRR] = v_x_RRR;
                             
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
+                            w_states[idx_state_x_R]   = w_x_R;
+                            w_states[idx_state_x_RR]  = w_x_RR;
+                            w_states[idx_state_x_RRR] = w_x_RRR;
+                            
+                            epsilon_states[idx_state_x_R]   = epsilon_x_R;
+                            epsilon_states[idx_state_x_RR]  = epsilon_x_RR;
+                            epsilon_states[idx_state_x_RRR] = epsilon_x_RRR;
                             
-                            std::vector<double> drho_Y_dx;
-                            drho_Y_dx.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                drho_Y_dx.push_back(-(Q[si][idx_cell_rho_Y_x_RRR] - double(4)*Q[si][idx_cell_rho_Y_x_RR] +
-                                    double(3)*Q[si][idx_cell_rho_Y_x_R])/(double(2)*dx[0]));
+                                rho_Y_states[idx_state_x_R*d_num_species + si]   = Q[si][idx_cell_rho_Y_x_R];
+                                rho_Y_states[idx_state_x_RR*d_num_species + si]  = Q[si][idx_cell_rho_Y_x_RR];
+                                rho_Y_states[idx_state_x_RRR*d_num_species + si] = Q[si][idx_cell_rho_Y_x_RRR];
+                                Y_states[si*num_states + idx_state_x_R]   = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                                Y_states[si*num_states + idx_state_x_RR]  = Q[si][idx_cell_rho_Y_x_RR]/rho_x_RR;
+                                Y_states[si*num_states + idx_state_x_RRR] = Q[si][idx_cell_rho_Y_x_RRR]/rho_x_RRR;
                             }
-                            const double du_dx = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
-                            const double dv_dx = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
-                            const double dw_dx = -(w_x_RRR - double(4)*w_x_RR + double(3)*w_x_R)/(double(2)*dx[0]);
-                            const double dp_dx = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
-                            
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
-                            
-                            double du_dy = double(0);
-                            double dv_dy = double(0);
-                            // double dw_dy = double(0);
-                            double dp_dy = double(0);
                             
                             if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                                 (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -6026,44 +6866,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
+                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
+                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
+                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
+                                
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                                 
-                                std::vector<double> Y_y_T;
-                                Y_y_T.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                            
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_T_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_x_R;
+                                epsilon_states[idx_state_y_B] = epsilon_x_R;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
+                                    Y_states[si*num_states + idx_state_y_B] = Y_states[si*num_states + idx_state_x_R];
                                 }
-                                
-                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
-                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
-                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
-                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
-                                
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dy = (u_y_T - u_x_R)/(dx[1]);
-                                dv_dy = (v_y_T - v_x_R)/(dx[1]);
-                                // dw_dy = (w_y_T - w_x_R)/(dx[1]);
-                                dp_dy = (p_y_T - p_x_R)/(dx[1]);
                             }
                             else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                      (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -6099,44 +6925,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_B += Q[si][idx_cell_rho_Y_y_B];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
+                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
+                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
+                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
+                                
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
                                 
-                                std::vector<double> Y_y_B;
-                                Y_y_B.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_x_R;
+                                epsilon_states[idx_state_y_T] = epsilon_x_R;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
+                                    Y_states[si*num_states + idx_state_y_T] = Y_states[si*num_states + idx_state_x_R];
                                 }
-                                
-                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
-                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
-                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
-                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
-                                
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dy = (u_x_R - u_y_B)/(dx[1]);
-                                dv_dy = (v_x_R - v_y_B)/(dx[1]);
-                                // dw_dy = (w_x_R - w_y_B)/(dx[1]);
-                                dp_dy = (p_x_R - p_y_B)/(dx[1]);
                             }
                             else
                             {
@@ -6182,34 +6994,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_y_B;
-                                std::vector<double> Y_y_T;
-                                Y_y_B.reserve(d_num_species);
-                                Y_y_T.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
-                                Y_y_T_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
-                                }
-                                
                                 const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                                 const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
                                 
@@ -6222,34 +7006,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
-                            
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
                                 
-                                // Central derivatives.
-                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
-                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
-                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
-                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
+                                
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                                }
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            double du_dz = double(0);
-                            // double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if ((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0))
@@ -6285,44 +7063,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
+                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
+                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
+                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
+                                
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                                 
-                                std::vector<double> Y_z_F;
-                                Y_z_F.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_F_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_x_R;
+                                epsilon_states[idx_state_z_B] = epsilon_x_R;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
+                                    Y_states[si*num_states + idx_state_z_B] = Y_states[si*num_states + idx_state_x_R];
                                 }
-                                
-                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
-                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
-                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
-                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
-                                
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dz = (u_z_F - u_x_R)/(dx[2]);
-                                // dv_dz = (v_z_F - v_x_R)/(dx[2]);
-                                dw_dz = (w_z_F - w_x_R)/(dx[2]);
-                                dp_dz = (p_z_F - p_x_R)/(dx[2]);
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -6358,44 +7122,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_B += Q[si][idx_cell_rho_Y_z_B];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
+                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
+                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
+                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
+                                
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                std::vector<double> Y_z_B;
-                                Y_z_B.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_x_R;
+                                epsilon_states[idx_state_z_F] = epsilon_x_R;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
+                                    Y_states[si*num_states + idx_state_z_F] = Y_states[si*num_states + idx_state_x_R];
                                 }
-                                
-                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
-                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
-                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
-                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
-                                
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dz = (u_x_R - u_z_B)/(dx[2]);
-                                // dv_dz = (v_x_R - v_z_B)/(dx[2]);
-                                dw_dz = (w_x_R - w_z_B)/(dx[2]);
-                                dp_dz = (p_x_R - p_z_B)/(dx[2]);
                             }
                             else
                             {
@@ -6441,34 +7191,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_z_B;
-                                std::vector<double> Y_z_F;
-                                Y_z_B.reserve(d_num_species);
-                                Y_z_F.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
-                                Y_z_F_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
-                                }
-                                
                                 const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
                                 const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
                                 
@@ -6481,17 +7203,262 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
+                                
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
+                                
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
+                                }
+                            }
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                        {
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                            
+                            const int idx_state_x_R   = idx_line;
+                            const int idx_state_x_RR  = idx_line + num_lines;
+                            const int idx_state_x_RRR = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
+                            
+                            const double& rho_x_R = rho_states[idx_state_x_R];
+                            
+                            const double& u_x_R   = u_states[idx_state_x_R];
+                            const double& u_x_RR  = u_states[idx_state_x_RR];
+                            const double& u_x_RRR = u_states[idx_state_x_RRR];
+                            
+                            const double& v_x_R   = v_states[idx_state_x_R];
+                            const double& v_x_RR  = v_states[idx_state_x_RR];
+                            const double& v_x_RRR = v_states[idx_state_x_RRR];
+                            
+                            const double& w_x_R   = w_states[idx_state_x_R];
+                            const double& w_x_RR  = w_states[idx_state_x_RR];
+                            const double& w_x_RRR = w_states[idx_state_x_RRR];
+                            
+                            const double& p_x_R   = p_states[idx_state_x_R];
+                            const double& p_x_RR  = p_states[idx_state_x_RR];
+                            const double& p_x_RRR = p_states[idx_state_x_RRR];
+                            
+                            const double* const rho_Y_x_R   = &rho_Y_states[idx_state_x_R*d_num_species];
+                            const double* const rho_Y_x_RR  = &rho_Y_states[idx_state_x_RR*d_num_species];
+                            const double* const rho_Y_x_RRR = &rho_Y_states[idx_state_x_RRR*d_num_species];
+                            
+                            double Y_x_R[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_x_R[si] = Y_states[si*num_states + idx_state_x_R];
+                            }
+                            
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
+                            
+                            double drho_Y_dx[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                drho_Y_dx[si] = -(rho_Y_x_RRR[si] - double(4)*rho_Y_x_RR[si] +
+                                    double(3)*rho_Y_x_R[si])/(double(2)*dx[0]);
+                            }
+                            const double du_dx = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
+                            const double dv_dx = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
+                            const double dw_dx = -(w_x_RRR - double(4)*w_x_RR + double(3)*w_x_R)/(double(2)*dx[0]);
+                            const double dp_dx = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
+                            
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
+                            
+                            double du_dy = double(0);
+                            double dv_dy = double(0);
+                            // double dw_dy = double(0);
+                            double dp_dy = double(0);
+                            
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // One-sided derivatives.
+                                du_dy = (u_y_T - u_x_R)/(dx[1]);
+                                dv_dy = (v_y_T - v_x_R)/(dx[1]);
+                                // dw_dy = (w_y_T - w_x_R)/(dx[1]);
+                                dp_dy = (p_y_T - p_x_R)/(dx[1]);
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                
+                                // One-sided derivatives.
+                                du_dy = (u_x_R - u_y_B)/(dx[1]);
+                                dv_dy = (v_x_R - v_y_B)/(dx[1]);
+                                // dw_dy = (w_x_R - w_y_B)/(dx[1]);
+                                dp_dy = (p_x_R - p_y_B)/(dx[1]);
+                            }
+                            else
+                            {
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // Central derivatives.
+                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
+                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
+                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            double du_dz = double(0);
+                            // double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                du_dz = (u_z_F - u_x_R)/(dx[2]);
+                                // dv_dz = (v_z_F - v_x_R)/(dx[2]);
+                                dw_dz = (w_z_F - w_x_R)/(dx[2]);
+                                dp_dz = (p_z_F - p_x_R)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
                                 
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
+                                // One-sided derivatives.
+                                du_dz = (u_x_R - u_z_B)/(dx[2]);
+                                // dv_dz = (v_x_R - v_z_B)/(dx[2]);
+                                dw_dz = (w_x_R - w_z_B)/(dx[2]);
+                                dp_dz = (p_x_R - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
                                 
                                 // Central derivatives.
                                 du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
@@ -6502,21 +7469,10 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             
                             // Compute sound speed.
                             
-                            const double Gamma_x_R = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                                &rho_x_R,
-                                &p_x_R,
-                                Y_x_R_ptr);
-                            
-                            const std::vector<double> Psi_x_R = d_equation_of_state_mixing_rules->
-                                getPressureDerivativeWithPartialDensities(
-                                        &rho_x_R,
-                                        &p_x_R,
-                                        Y_x_R_ptr);
-                            
-                            double c_x_R = Gamma_x_R*p_x_R/rho_x_R;
+                            double c_x_R = Gamma_bdry[idx_line]*p_x_R/rho_x_R;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                c_x_R += Y_x_R[si]*Psi_x_R[si];
+                                c_x_R += Y_x_R[si]*Psi_bdry[si*num_lines + idx_line];
                             }
                             c_x_R = sqrt(c_x_R);
                             
@@ -6581,7 +7537,7 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     (j + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0]+
                                     (k + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
                                         subghostcell_dims_conservative_var[2][1];
-
+                                
                                 if (i == num_ghosts_to_fill - 1)
                                 {
                                     for (int si = 0; si < d_num_species; si++)
@@ -6794,26 +7750,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_ghost += V_ghost[i*(d_num_species + 4) + si];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_ghost;
-                                Y_ghost.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_ghost.push_back(V_ghost[i*(d_num_species + 4) + si]/rho_ghost);
-                                }
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                                 
                                 /*
-                                 * Get the pointers to the mass fractions.
+                                 * Compute the mass fractions.
                                  */
                                 
-                                std::vector<const double*> Y_ghost_ptr;
-                                Y_ghost_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                    Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[i*(d_num_species + 4) + si]/rho_ghost;
                                 }
                                 
                                 for(int si=0; si < d_num_species; si++)
@@ -6825,22 +7770,47 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[i*(d_num_species + 4) + d_num_species + 1];
                                 Q[d_num_species + 2][idx_cell_mom] = rho_ghost*V_ghost[i*(d_num_species + 4) + d_num_species + 2];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergy(
-                                        &rho_ghost,
-                                        &V_ghost[i*(d_num_species + 4) + d_num_species + 3],
-                                        Y_ghost_ptr);
+                                rho_ghosts[idx_ghost] = rho_ghost;
+                                p_ghosts[idx_ghost]   = V_ghost[i*(d_num_species + 4) + d_num_species + 3];
                                 
-                                const double E = rho_ghost*epsilon +
-                                    half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                        Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                        Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                        rho_ghost;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::XHI)
                 {
@@ -6853,12 +7823,56 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 6)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                            
+                            const int idx_state_x_L   = idx_line;
+                            const int idx_state_x_LL  = idx_line + num_lines;
+                            const int idx_state_x_LLL = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_Y_x_L = (interior_box_hi_idx[0] + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -6905,19 +7919,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 (k + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
                                     subghostcell_dims_conservative_var[2][1];
                             
-                            std::vector<double> rho_Y_x_L;
-                            std::vector<double> rho_Y_x_LL;
-                            std::vector<double> rho_Y_x_LLL;
-                            rho_Y_x_L.reserve(d_num_species);
-                            rho_Y_x_LL.reserve(d_num_species);
-                            rho_Y_x_LLL.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                rho_Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]);
-                                rho_Y_x_LL.push_back(Q[si][idx_cell_rho_Y_x_LL]);
-                                rho_Y_x_LLL.push_back(Q[si][idx_cell_rho_Y_x_LLL]);
-                            }
-                            
                             /*
                              * Compute the mixture density.
                              */
@@ -6932,40 +7933,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 rho_x_LLL += Q[si][idx_cell_rho_Y_x_LLL];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_x_L;
-                            std::vector<double> Y_x_LL;
-                            std::vector<double> Y_x_LLL;
-                            Y_x_L.reserve(d_num_species);
-                            Y_x_LL.reserve(d_num_species);
-                            Y_x_LLL.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                                Y_x_LL.push_back(Q[si][idx_cell_rho_Y_x_LL]/rho_x_LL);
-                                Y_x_LLL.push_back(Q[si][idx_cell_rho_Y_x_LLL]/rho_x_LLL);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_x_L_ptr;
-                            std::vector<const double*> Y_x_LL_ptr;
-                            std::vector<const double*> Y_x_LLL_ptr;
-                            Y_x_L_ptr.reserve(d_num_species);
-                            Y_x_LL_ptr.reserve(d_num_species);
-                            Y_x_LLL_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_x_L_ptr.push_back(&Y_x_L[si]);
-                                Y_x_LL_ptr.push_back(&Y_x_LL[si]);
-                                Y_x_LLL_ptr.push_back(&Y_x_LLL[si]);
-                            }
-                            
                             const double u_x_L   = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                             const double u_x_LL  = Q[d_num_species][idx_cell_mom_x_LL]/rho_x_LL;
                             const double u_x_LLL = Q[d_num_species][idx_cell_mom_x_LLL]/rho_x_LLL;
@@ -6978,53 +7945,39 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             const double w_x_LL  = Q[d_num_species + 2][idx_cell_mom_x_LL]/rho_x_LL;
                             const double w_x_LLL = Q[d_num_species + 2][idx_cell_mom_x_LLL]/rho_x_LLL;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_x_L   = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                             const double epsilon_x_LL  = Q[d_num_species + 3][idx_cell_E_x_LL]/rho_x_LL - half*(u_x_LL*u_x_LL + v_x_LL*v_x_LL + w_x_LL*w_x_LL);
                             const double epsilon_x_LLL = Q[d_num_species + 3][idx_cell_E_x_LLL]/rho_x_LLL - half*(u_x_LLL*u_x_LLL + v_x_LLL*v_x_LLL + w_x_LLL*w_x_LLL);
-
-                            double p_x_L = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    Y_x_L_ptr);
-                            
-                            double p_x_LL = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_LL,
-                                    &epsilon_x_LL,
-                                    Y_x_LL_ptr);
-                            
-                            double p_x_LLL = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_x_LLL,
-                                    &epsilon_x_LLL,
-                                    Y_x_LLL_ptr);
                             
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
+                            rho_states[idx_state_x_L]   = rho_x_L;
+                            rho_states[idx_state_x_LL]  = rho_x_LL;
+                            rho_states[idx_state_x_LLL] = rho_x_LLL;
+                            
+                            u_states[idx_state_x_L]   = u_x_L;
+                            u_states[idx_state_x_LL]  = u_x_LL;
+                            u_states[idx_state_x_LLL] = u_x_LLL;
+                            
+                            v_states[idx_state_x_L]   = v_x_L;
+                            v_states[idx_state_x_LL]  = v_x_LL;
+                            v_states[idx_state_x_LLL] = v_x_LLL;
+                            
+                            w_states[idx_state_x_L]   = w_x_L;
+                            w_states[idx_state_x_LL]  = w_x_LL;
+                            w_states[idx_state_x_LLL] = w_x_LLL;
+                            
+                            epsilon_states[idx_state_x_L]   = epsilon_x_L;
+                            epsilon_states[idx_state_x_LL]  = epsilon_x_LL;
+                            epsilon_states[idx_state_x_LLL] = epsilon_x_LLL;
                             
-                            std::vector<double> drho_Y_dx;
-                            drho_Y_dx.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                drho_Y_dx.push_back((Q[si][idx_cell_rho_Y_x_LLL] - double(4)*Q[si][idx_cell_rho_Y_x_LL] +
-                                    double(3)*Q[si][idx_cell_rho_Y_x_L])/(double(2)*dx[0]));
+                                rho_Y_states[idx_state_x_L*d_num_species + si]   = Q[si][idx_cell_rho_Y_x_L];
+                                rho_Y_states[idx_state_x_LL*d_num_species + si]  = Q[si][idx_cell_rho_Y_x_LL];
+                                rho_Y_states[idx_state_x_LLL*d_num_species + si] = Q[si][idx_cell_rho_Y_x_LLL];
+                                Y_states[si*num_states + idx_state_x_L]   = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                                Y_states[si*num_states + idx_state_x_LL]  = Q[si][idx_cell_rho_Y_x_LL]/rho_x_LL;
+                                Y_states[si*num_states + idx_state_x_LLL] = Q[si][idx_cell_rho_Y_x_LLL]/rho_x_LLL;
                             }
-                            const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
-                            const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
-                            const double dw_dx   = (w_x_LLL - double(4)*w_x_LL + double(3)*w_x_L)/(double(2)*dx[0]);
-                            const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
-                            
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
-                            
-                            double du_dy = double(0);
-                            double dv_dy = double(0);
-                            // double dw_dy = double(0);
-                            double dp_dy = double(0);
                             
                             if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                                 (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -7061,44 +8014,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
+                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
+                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
+                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
+                                
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                                 
-                                std::vector<double> Y_y_T;
-                                Y_y_T.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                            
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_T_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_x_L;
+                                epsilon_states[idx_state_y_B] = epsilon_x_L;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
+                                    Y_states[si*num_states + idx_state_y_B] = Y_states[si*num_states + idx_state_x_L];
                                 }
-                                
-                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
-                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
-                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
-                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
-                                
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dy = (u_y_T - u_x_L)/(dx[1]);
-                                dv_dy = (v_y_T - v_x_L)/(dx[1]);
-                                // dw_dy = (w_y_T - w_x_L)/(dx[1]);
-                                dp_dy = (p_y_T - p_x_L)/(dx[1]);
                             }
                             else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                      (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -7135,44 +8074,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_B += Q[si][idx_cell_rho_Y_y_B];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
+                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
+                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
+                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
+                                
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
                                 
-                                std::vector<double> Y_y_B;
-                                Y_y_B.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_x_L;
+                                epsilon_states[idx_state_y_T] = epsilon_x_L;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
+                                    Y_states[si*num_states + idx_state_y_T] = Y_states[si*num_states + idx_state_x_L];
                                 }
-                                
-                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
-                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
-                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
-                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
-                                
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dy = (u_x_L - u_y_B)/(dx[1]);
-                                dv_dy = (v_x_L - v_y_B)/(dx[1]);
-                                // dw_dy = (w_x_L - w_y_B)/(dx[1]);
-                                dp_dy = (p_x_L - p_y_B)/(dx[1]);
                             }
                             else
                             {
@@ -7218,34 +8143,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_y_B;
-                                std::vector<double> Y_y_T;
-                                Y_y_B.reserve(d_num_species);
-                                Y_y_T.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
-                                Y_y_T_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
-                                }
-                                
                                 const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                                 const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
                                 
@@ -7258,34 +8155,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
-                            
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
                                 
-                                // Central derivatives.
-                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
-                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
-                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
-                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
+                                
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                                }
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            double du_dz = double(0);
-                            // double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if ((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0))
@@ -7321,44 +8212,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
+                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
+                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
+                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
+                                
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                                 
-                                std::vector<double> Y_z_F;
-                                Y_z_F.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_F_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_x_L;
+                                epsilon_states[idx_state_z_B] = epsilon_x_L;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
+                                    Y_states[si*num_states + idx_state_z_B] = Y_states[si*num_states + idx_state_x_L];
                                 }
-                                
-                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
-                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
-                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
-                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
-                                
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dz = (u_z_F - u_x_L)/(dx[2]);
-                                // dv_dz = (v_z_F - v_x_L)/(dx[2]);
-                                dw_dz = (w_z_F - w_x_L)/(dx[2]);
-                                dp_dz = (p_z_F - p_x_L)/(dx[2]);
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -7395,44 +8272,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_B += Q[si][idx_cell_rho_Y_z_B];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
+                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
+                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
+                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
+                                
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                std::vector<double> Y_z_B;
-                                Y_z_B.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_x_L;
+                                epsilon_states[idx_state_z_F] = epsilon_x_L;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
+                                    Y_states[si*num_states + idx_state_z_F] = Y_states[si*num_states + idx_state_x_L];
                                 }
-                                
-                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
-                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
-                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
-                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
-                                
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dz = (u_x_L - u_z_B)/(dx[2]);
-                                // dv_dz = (v_x_L - v_z_B)/(dx[2]);
-                                dw_dz = (w_x_L - w_z_B)/(dx[2]);
-                                dp_dz = (p_x_L - p_z_B)/(dx[2]);
                             }
                             else
                             {
@@ -7478,34 +8341,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_z_B;
-                                std::vector<double> Y_z_F;
-                                Y_z_B.reserve(d_num_species);
-                                Y_z_F.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
-                                Y_z_F_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
-                                }
-                                
                                 const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
                                 const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
                                 
@@ -7518,112 +8353,344 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
                                 
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
                                 
-                                // Central derivatives.
-                                du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
-                                // dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
-                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
-                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
+                                }
                             }
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                        {
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
                             
-                            // Compute sound speed.
-                            
-                            const double Gamma_x_L = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                                &rho_x_L,
-                                &p_x_L,
-                                Y_x_L_ptr);
-                            
-                            const std::vector<double> Psi_x_L = d_equation_of_state_mixing_rules->
-                                getPressureDerivativeWithPartialDensities(
-                                        &rho_x_L,
-                                        &p_x_L,
-                                        Y_x_L_ptr);
-                            
-                            double c_x_L = Gamma_x_L*p_x_L/rho_x_L;
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                c_x_L += Y_x_L[si]*Psi_x_L[si];
-                            }
-                            c_x_L = sqrt(c_x_L);
+                            const int idx_state_x_L   = idx_line;
+                            const int idx_state_x_LL  = idx_line + num_lines;
+                            const int idx_state_x_LLL = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
-                            const double lambda_1 = u_x_L - c_x_L;
+                            const double& rho_x_L = rho_states[idx_state_x_L];
                             
-                            // Compute vector Lambda^(-1) * L.
+                            const double& u_x_L   = u_states[idx_state_x_L];
+                            const double& u_x_LL  = u_states[idx_state_x_LL];
+                            const double& u_x_LLL = u_states[idx_state_x_LLL];
                             
-                            double Lambda_inv_L[d_num_species + 4];
+                            const double& v_x_L   = v_states[idx_state_x_L];
+                            const double& v_x_LL  = v_states[idx_state_x_LL];
+                            const double& v_x_LLL = v_states[idx_state_x_LLL];
                             
-                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
-                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
-                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
-                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            const double& w_x_L   = w_states[idx_state_x_L];
+                            const double& w_x_LL  = w_states[idx_state_x_LL];
+                            const double& w_x_LLL = w_states[idx_state_x_LLL];
                             
-                            const double T_1 = v_x_L*(dp_dy - rho_x_L*c_x_L*du_dy) + rho_x_L*c_x_L*c_x_L*dv_dy +
-                                w_x_L*(dp_dz - rho_x_L*c_x_L*du_dz) + rho_x_L*c_x_L*c_x_L*dw_dz;
+                            const double& p_x_L   = p_states[idx_state_x_L];
+                            const double& p_x_LL  = p_states[idx_state_x_LL];
+                            const double& p_x_LLL = p_states[idx_state_x_LLL];
                             
-                            const double M_sq = (u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L)/(c_x_L*c_x_L);
-                            const double K = sigma*c_x_L*(double(1) - M_sq)/length_char;
+                            const double* const rho_Y_x_L   = &rho_Y_states[idx_state_x_L*d_num_species];
+                            const double* const rho_Y_x_LL  = &rho_Y_states[idx_state_x_LL*d_num_species];
+                            const double* const rho_Y_x_LLL = &rho_Y_states[idx_state_x_LLL*d_num_species];
                             
-                            Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_x_L - p_t) - (double(1) - beta)*T_1);
+                            double Y_x_L[d_num_species];
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Lambda_inv_L[si + 1] = c_x_L*c_x_L*drho_Y_dx[si] - Y_x_L[si]*dp_dx;
+                                Y_x_L[si] = Y_states[si*num_states + idx_state_x_L];
                             }
-                            Lambda_inv_L[d_num_species + 1] = dv_dx;
-                            Lambda_inv_L[d_num_species + 2] = dw_dx;
-                            Lambda_inv_L[d_num_species + 3] = dp_dx + rho_x_L*c_x_L*du_dx;
-                            
-                            // Compute dV_dx.
-                            
-                            const double c_sq_inv  = double(1)/(c_x_L*c_x_L);
-                            const double rho_c_inv = double(1)/(rho_x_L*c_x_L);
                             
-                            double dV_dx[d_num_species + 4];
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
                             
+                            double drho_Y_dx[d_num_species];
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                dV_dx[si] = half*c_sq_inv*Y_x_L[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]) + 
-                                    c_sq_inv*Lambda_inv_L[si + 1];
+                                drho_Y_dx[si] = (rho_Y_x_LLL[si] - double(4)*rho_Y_x_LL[si] +
+                                    double(3)*rho_Y_x_L[si])/(double(2)*dx[0]);
                             }
-                            dV_dx[d_num_species] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
-                            dV_dx[d_num_species + 1] = Lambda_inv_L[d_num_species + 1];
-                            dV_dx[d_num_species + 2] = Lambda_inv_L[d_num_species + 2];
-                            dV_dx[d_num_species + 3] = half*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
+                            const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
+                            const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
+                            const double dw_dx   = (w_x_LLL - double(4)*w_x_LL + double(3)*w_x_L)/(double(2)*dx[0]);
+                            const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
                             
-                            double V_ghost[(d_num_species + 4)*num_ghosts_to_fill];
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
                             
-                            for (int i = 0; i < num_ghosts_to_fill; i++)
+                            double du_dy = double(0);
+                            double dv_dy = double(0);
+                            // double dw_dy = double(0);
+                            double dp_dy = double(0);
+                            
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
                             {
-                                const int idx_cell_rho_Y = (i + fill_box_lo_idx[0] + num_subghosts_conservative_var[0][0]) +
-                                    (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0]+
-                                    (k + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_mom = (i + fill_box_lo_idx[0] + num_subghosts_conservative_var[1][0]) +
-                                    (j + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0]+
-                                    (k + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
+                                // Patch is touching periodic boundary.
                                 
-                                const int idx_cell_E = (i + fill_box_lo_idx[0] + num_subghosts_conservative_var[2][0]) +
-                                    (j + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0]+
-                                    (k + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
                                 
-                                if (i == 0)
-                                {
-                                    for (int si = 0; si < d_num_species; si++)
-                                    {
-                                        V_ghost[i*(d_num_species + 4) + si] = rho_Y_x_LL[si] + double(2)*dx[0]*dV_dx[si];
+                                // One-sided derivatives.
+                                du_dy = (u_y_T - u_x_L)/(dx[1]);
+                                dv_dy = (v_y_T - v_x_L)/(dx[1]);
+                                // dw_dy = (w_y_T - w_x_L)/(dx[1]);
+                                dp_dy = (p_y_T - p_x_L)/(dx[1]);
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                
+                                // One-sided derivatives.
+                                du_dy = (u_x_L - u_y_B)/(dx[1]);
+                                dv_dy = (v_x_L - v_y_B)/(dx[1]);
+                                // dw_dy = (w_x_L - w_y_B)/(dx[1]);
+                                dp_dy = (p_x_L - p_y_B)/(dx[1]);
+                            }
+                            else
+                            {
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // Central derivatives.
+                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
+                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
+                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            double du_dz = double(0);
+                            // double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                du_dz = (u_z_F - u_x_L)/(dx[2]);
+                                // dv_dz = (v_z_F - v_x_L)/(dx[2]);
+                                dw_dz = (w_z_F - w_x_L)/(dx[2]);
+                                dp_dz = (p_z_F - p_x_L)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                
+                                // One-sided derivatives.
+                                du_dz = (u_x_L - u_z_B)/(dx[2]);
+                                // dv_dz = (v_x_L - v_z_B)/(dx[2]);
+                                dw_dz = (w_x_L - w_z_B)/(dx[2]);
+                                dp_dz = (p_x_L - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // Central derivatives.
+                                du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
+                                // dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
+                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
+                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                            }
+                            
+                            // Compute sound speed.
+                            
+                            double c_x_L = Gamma_bdry[idx_line]*p_x_L/rho_x_L;
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                c_x_L += Y_x_L[si]*Psi_bdry[si*num_lines + idx_line];
+                            }
+                            c_x_L = sqrt(c_x_L);
+                            
+                            const double lambda_1 = u_x_L - c_x_L;
+                            
+                            // Compute vector Lambda^(-1) * L.
+                            
+                            double Lambda_inv_L[d_num_species + 4];
+                            
+                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
+                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
+                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
+                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            
+                            const double T_1 = v_x_L*(dp_dy - rho_x_L*c_x_L*du_dy) + rho_x_L*c_x_L*c_x_L*dv_dy +
+                                w_x_L*(dp_dz - rho_x_L*c_x_L*du_dz) + rho_x_L*c_x_L*c_x_L*dw_dz;
+                            
+                            const double M_sq = (u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L)/(c_x_L*c_x_L);
+                            const double K = sigma*c_x_L*(double(1) - M_sq)/length_char;
+                            
+                            Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_x_L - p_t) - (double(1) - beta)*T_1);
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Lambda_inv_L[si + 1] = c_x_L*c_x_L*drho_Y_dx[si] - Y_x_L[si]*dp_dx;
+                            }
+                            Lambda_inv_L[d_num_species + 1] = dv_dx;
+                            Lambda_inv_L[d_num_species + 2] = dw_dx;
+                            Lambda_inv_L[d_num_species + 3] = dp_dx + rho_x_L*c_x_L*du_dx;
+                            
+                            // Compute dV_dx.
+                            
+                            const double c_sq_inv  = double(1)/(c_x_L*c_x_L);
+                            const double rho_c_inv = double(1)/(rho_x_L*c_x_L);
+                            
+                            double dV_dx[d_num_species + 4];
+                            
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                dV_dx[si] = half*c_sq_inv*Y_x_L[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]) + 
+                                    c_sq_inv*Lambda_inv_L[si + 1];
+                            }
+                            dV_dx[d_num_species] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
+                            dV_dx[d_num_species + 1] = Lambda_inv_L[d_num_species + 1];
+                            dV_dx[d_num_species + 2] = Lambda_inv_L[d_num_species + 2];
+                            dV_dx[d_num_species + 3] = half*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
+                            
+                            double V_ghost[(d_num_species + 4)*num_ghosts_to_fill];
+                            
+                            for (int i = 0; i < num_ghosts_to_fill; i++)
+                            {
+                                const int idx_cell_rho_Y = (i + fill_box_lo_idx[0] + num_subghosts_conservative_var[0][0]) +
+                                    (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0]+
+                                    (k + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_mom = (i + fill_box_lo_idx[0] + num_subghosts_conservative_var[1][0]) +
+                                    (j + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0]+
+                                    (k + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_E = (i + fill_box_lo_idx[0] + num_subghosts_conservative_var[2][0]) +
+                                    (j + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0]+
+                                    (k + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
+                                if (i == 0)
+                                {
+                                    for (int si = 0; si < d_num_species; si++)
+                                    {
+                                        V_ghost[i*(d_num_species + 4) + si] = rho_Y_x_LL[si] + double(2)*dx[0]*dV_dx[si];
                                     }
                                     
                                     V_ghost[i*(d_num_species + 4) + d_num_species]     = u_x_LL + double(2)*dx[0]*dV_dx[d_num_species];
@@ -7831,26 +8898,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_ghost += V_ghost[i*(d_num_species + 4) + si];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_ghost;
-                                Y_ghost.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_ghost.push_back(V_ghost[i*(d_num_species + 4) + si]/rho_ghost);
-                                }
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                                 
                                 /*
-                                 * Get the pointers to the mass fractions.
+                                 * Compute the mass fractions.
                                  */
                                 
-                                std::vector<const double*> Y_ghost_ptr;
-                                Y_ghost_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                    Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[i*(d_num_species + 4) + si]/rho_ghost;
                                 }
                                 
                                 for(int si=0; si < d_num_species; si++)
@@ -7862,22 +8918,47 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[i*(d_num_species + 4) + d_num_species + 1];
                                 Q[d_num_species + 2][idx_cell_mom] = rho_ghost*V_ghost[i*(d_num_species + 4) + d_num_species + 2];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergy(
-                                        &rho_ghost,
-                                        &V_ghost[i*(d_num_species + 4) + d_num_species + 3],
-                                        Y_ghost_ptr);
+                                rho_ghosts[idx_ghost] = rho_ghost;
+                                p_ghosts[idx_ghost]   = V_ghost[i*(d_num_species + 4) + d_num_species + 3];
                                 
-                                const double E = rho_ghost*epsilon +
-                                    half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                        Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                        Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                        rho_ghost;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::YLO)
                 {
@@ -7890,12 +8971,56 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 6)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_y_T   = idx_line;
+                            const int idx_state_y_TT  = idx_line + num_lines;
+                            const int idx_state_y_TTT = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_Y_y_T = (i + num_subghosts_conservative_var[0][0]) +
                                 (interior_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -7942,19 +9067,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 (k + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
                                     subghostcell_dims_conservative_var[2][1];
                             
-                            std::vector<double> rho_Y_y_T;
-                            std::vector<double> rho_Y_y_TT;
-                            std::vector<double> rho_Y_y_TTT;
-                            rho_Y_y_T.reserve(d_num_species);
-                            rho_Y_y_TT.reserve(d_num_species);
-                            rho_Y_y_TTT.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                rho_Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]);
-                                rho_Y_y_TT.push_back(Q[si][idx_cell_rho_Y_y_TT]);
-                                rho_Y_y_TTT.push_back(Q[si][idx_cell_rho_Y_y_TTT]);
-                            }
-                            
                             /*
                              * Compute the mixture density.
                              */
@@ -7969,40 +9081,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 rho_y_TTT += Q[si][idx_cell_rho_Y_y_TTT];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_y_T;
-                            std::vector<double> Y_y_TT;
-                            std::vector<double> Y_y_TTT;
-                            Y_y_T.reserve(d_num_species);
-                            Y_y_TT.reserve(d_num_species);
-                            Y_y_TTT.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                                Y_y_TT.push_back(Q[si][idx_cell_rho_Y_y_TT]/rho_y_TT);
-                                Y_y_TTT.push_back(Q[si][idx_cell_rho_Y_y_TTT]/rho_y_TTT);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_T_ptr;
-                            std::vector<const double*> Y_y_TT_ptr;
-                            std::vector<const double*> Y_y_TTT_ptr;
-                            Y_y_T_ptr.reserve(d_num_species);
-                            Y_y_TT_ptr.reserve(d_num_species);
-                            Y_y_TTT_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_T_ptr.push_back(&Y_y_T[si]);
-                                Y_y_TT_ptr.push_back(&Y_y_TT[si]);
-                                Y_y_TTT_ptr.push_back(&Y_y_TTT[si]);
-                            }
-                            
                             const double u_y_T   = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
                             const double u_y_TT  = Q[d_num_species][idx_cell_mom_y_TT]/rho_y_TT;
                             const double u_y_TTT = Q[d_num_species][idx_cell_mom_y_TTT]/rho_y_TTT;
@@ -8015,53 +9093,39 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             const double w_y_TT  = Q[d_num_species + 2][idx_cell_mom_y_TT]/rho_y_TT;
                             const double w_y_TTT = Q[d_num_species + 2][idx_cell_mom_y_TTT]/rho_y_TTT;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_y_T   = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                             const double epsilon_y_TT  = Q[d_num_species + 3][idx_cell_E_y_TT]/rho_y_TT - half*(u_y_TT*u_y_TT + v_y_TT*v_y_TT + w_y_TT*w_y_TT);
                             const double epsilon_y_TTT = Q[d_num_species + 3][idx_cell_E_y_TTT]/rho_y_TTT - half*(u_y_TTT*u_y_TTT + v_y_TTT*v_y_TTT + w_y_TTT*w_y_TTT);
-
-                            double p_y_T = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    Y_y_T_ptr);
-                            
-                            double p_y_TT = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_TT,
-                                    &epsilon_y_TT,
-                                    Y_y_TT_ptr);
-                            
-                            double p_y_TTT = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_TTT,
-                                    &epsilon_y_TTT,
-                                    Y_y_TTT_ptr);
                             
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
+                            rho_states[idx_state_y_T]   = rho_y_T;
+                            rho_states[idx_state_y_TT]  = rho_y_TT;
+                            rho_states[idx_state_y_TTT] = rho_y_TTT;
+                            
+                            u_states[idx_state_y_T]   = u_y_T;
+                            u_states[idx_state_y_TT]  = u_y_TT;
+                            u_states[idx_state_y_TTT] = u_y_TTT;
+                            
+                            v_states[idx_state_y_T]   = v_y_T;
+                            v_states[idx_state_y_TT]  = v_y_TT;
+                            v_states[idx_state_y_TTT] = v_y_TTT;
+                            
+                            w_states[idx_state_y_T]   = w_y_T;
+                            w_states[idx_state_y_TT]  = w_y_TT;
+                            w_states[idx_state_y_TTT] = w_y_TTT;
+                            
+                            epsilon_states[idx_state_y_T]   = epsilon_y_T;
+                            epsilon_states[idx_state_y_TT]  = epsilon_y_TT;
+                            epsilon_states[idx_state_y_TTT] = epsilon_y_TTT;
                             
-                            std::vector<double> drho_Y_dy;
-                            drho_Y_dy.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                drho_Y_dy.push_back(-(Q[si][idx_cell_rho_Y_y_TTT] - double(4)*Q[si][idx_cell_rho_Y_y_TT] +
-                                    double(3)*Q[si][idx_cell_rho_Y_y_T])/(double(2)*dx[1]));
+                                rho_Y_states[idx_state_y_T*d_num_species + si]   = Q[si][idx_cell_rho_Y_y_T];
+                                rho_Y_states[idx_state_y_TT*d_num_species + si]  = Q[si][idx_cell_rho_Y_y_TT];
+                                rho_Y_states[idx_state_y_TTT*d_num_species + si] = Q[si][idx_cell_rho_Y_y_TTT];
+                                Y_states[si*num_states + idx_state_y_T]   = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                                Y_states[si*num_states + idx_state_y_TT]  = Q[si][idx_cell_rho_Y_y_TT]/rho_y_TT;
+                                Y_states[si*num_states + idx_state_y_TTT] = Q[si][idx_cell_rho_Y_y_TTT]/rho_y_TTT;
                             }
-                            const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
-                            const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
-                            const double dw_dy   = -(w_y_TTT - double(4)*w_y_TT + double(3)*w_y_T)/(double(2)*dx[1]);
-                            const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
-                            
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
-                            
-                            double du_dx = double(0);
-                            double dv_dx = double(0);
-                            // double dw_dx = double(0);
-                            double dp_dx = double(0);
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -8098,44 +9162,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
+                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
+                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
+                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
+                                
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                std::vector<double> Y_x_R;
-                                Y_x_R.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                            
-                                std::vector<const double*> Y_x_R_ptr;
-                                Y_x_R_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_y_T;
+                                epsilon_states[idx_state_x_L] = epsilon_y_T;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
+                                    Y_states[si*num_states + idx_state_x_L] = Y_states[si*num_states + idx_state_y_T];
                                 }
-                                
-                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
-                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
-                                
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_y_T)/(dx[0]);
-                                dv_dx = (v_x_R - v_y_T)/(dx[0]);
-                                // dw_dx = (w_x_R - w_y_T)/(dx[0]);
-                                dp_dx = (p_x_R - p_y_T)/(dx[0]);
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -8172,44 +9222,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_L += Q[si][idx_cell_rho_Y_x_L];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
+                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
+                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
+                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
+                                
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                std::vector<double> Y_x_L;
-                                Y_x_L.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_x_L_ptr;
-                                Y_x_L_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_y_T;
+                                epsilon_states[idx_state_x_R] = epsilon_y_T;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
+                                    Y_states[si*num_states + idx_state_x_R] = Y_states[si*num_states + idx_state_y_T];
                                 }
-                                
-                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
-                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
-                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
-                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
-                                
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_y_T - u_x_L)/(dx[0]);
-                                dv_dx = (v_y_T - v_x_L)/(dx[0]);
-                                // dw_dx = (w_y_T - w_x_L)/(dx[0]);
-                                dp_dx = (p_y_T - p_x_L)/(dx[0]);
                             }
                             else
                             {
@@ -8255,35 +9291,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_x_L;
-                                std::vector<double> Y_x_R;
-                                Y_x_L.reserve(d_num_species);
-                                Y_x_R.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_x_L_ptr;
-                                std::vector<const double*> Y_x_R_ptr;
-                                
-                                Y_x_L_ptr.reserve(d_num_species);
-                                Y_x_R_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
-                                }
-                                
                                 const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                                 const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
                                 
@@ -8296,34 +9303,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
                                 
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
                                 
-                                // Central derivatives.
-                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
-                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                                }
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            // double du_dz = double(0);
-                            double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if ((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0))
@@ -8359,44 +9360,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
+                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
+                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
+                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
+                                
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                                 
-                                std::vector<double> Y_z_F;
-                                Y_z_F.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_F_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_y_T;
+                                epsilon_states[idx_state_z_B] = epsilon_y_T;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
+                                    Y_states[si*num_states + idx_state_z_B] = Y_states[si*num_states + idx_state_y_T];
                                 }
-                                
-                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
-                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
-                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
-                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
-                                
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
-                                
-                                // One-sided derivatives.
-                                // du_dz = (u_z_F - u_y_T)/(dx[2]);
-                                dv_dz = (v_z_F - v_y_T)/(dx[2]);
-                                dw_dz = (w_z_F - w_y_T)/(dx[2]);
-                                dp_dz = (p_z_F - p_y_T)/(dx[2]);
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -8433,44 +9420,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_B += Q[si][idx_cell_rho_Y_z_B];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
+                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
+                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
+                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
+                                
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                std::vector<double> Y_z_B;
-                                Y_z_B.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_y_T;
+                                epsilon_states[idx_state_z_F] = epsilon_y_T;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
+                                    Y_states[si*num_states + idx_state_z_F] = Y_states[si*num_states + idx_state_y_T];
                                 }
-                                
-                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
-                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
-                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
-                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
-                                
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
-                                
-                                // One-sided derivatives.
-                                // du_dz = (u_y_T - u_z_B)/(dx[2]);
-                                dv_dz = (v_y_T - v_z_B)/(dx[2]);
-                                dw_dz = (w_y_T - w_z_B)/(dx[2]);
-                                dp_dz = (p_y_T - p_z_B)/(dx[2]);
                             }
                             else
                             {
@@ -8516,34 +9489,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_z_B;
-                                std::vector<double> Y_z_F;
-                                Y_z_B.reserve(d_num_species);
-                                Y_z_F.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
-                                Y_z_F_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
-                                }
-                                
                                 const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
                                 const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
                                 
@@ -8556,101 +9501,335 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
                                 
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
                                 
-                                // Central derivatives.
-                                // du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
-                                dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
-                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
-                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
+                                }
                             }
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
                             
-                            // Compute sound speed.
-                            
-                            const double Gamma_y_T = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                                &rho_y_T,
-                                &p_y_T,
-                                Y_y_T_ptr);
+                            const int idx_state_y_T   = idx_line;
+                            const int idx_state_y_TT  = idx_line + num_lines;
+                            const int idx_state_y_TTT = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
-                            const std::vector<double> Psi_y_T = d_equation_of_state_mixing_rules->
-                                getPressureDerivativeWithPartialDensities(
-                                        &rho_y_T,
-                                        &p_y_T,
-                                        Y_y_T_ptr);
+                            const double& rho_y_T = rho_states[idx_state_y_T];
                             
-                            double c_y_T = Gamma_y_T*p_y_T/rho_y_T;
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                c_y_T += Y_y_T[si]*Psi_y_T[si];
-                            }
-                            c_y_T = sqrt(c_y_T);
+                            const double& u_y_T   = u_states[idx_state_y_T];
+                            const double& u_y_TT  = u_states[idx_state_y_TT];
+                            const double& u_y_TTT = u_states[idx_state_y_TTT];
                             
-                            const double lambda_last = v_y_T + c_y_T;
+                            const double& v_y_T   = v_states[idx_state_y_T];
+                            const double& v_y_TT  = v_states[idx_state_y_TT];
+                            const double& v_y_TTT = v_states[idx_state_y_TTT];
                             
-                            // Compute vector Lambda^(-1) * L.
+                            const double& w_y_T   = w_states[idx_state_y_T];
+                            const double& w_y_TT  = w_states[idx_state_y_TT];
+                            const double& w_y_TTT = w_states[idx_state_y_TTT];
                             
-                            double Lambda_inv_L[d_num_species + 4];
+                            const double& p_y_T   = p_states[idx_state_y_T];
+                            const double& p_y_TT  = p_states[idx_state_y_TT];
+                            const double& p_y_TTT = p_states[idx_state_y_TTT];
                             
-                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
-                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
-                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
-                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            const double* const rho_Y_y_T   = &rho_Y_states[idx_state_y_T*d_num_species];
+                            const double* const rho_Y_y_TT  = &rho_Y_states[idx_state_y_TT*d_num_species];
+                            const double* const rho_Y_y_TTT = &rho_Y_states[idx_state_y_TTT*d_num_species];
                             
-                            const double T_last = u_y_T*(dp_dx + rho_y_T*c_y_T*dv_dx) + rho_y_T*c_y_T*c_y_T*du_dx + 
-                                w_y_T*(dp_dz + rho_y_T*c_y_T*dv_dz) + rho_y_T*c_y_T*c_y_T*dw_dz;
+                            double Y_y_T[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_y_T[si] = Y_states[si*num_states + idx_state_y_T];
+                            }
                             
-                            const double M_sq = (u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T)/(c_y_T*c_y_T);
-                            const double K = sigma*c_y_T*(double(1) - M_sq)/length_char;
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
                             
-                            Lambda_inv_L[0] = dp_dy - rho_y_T*c_y_T*dv_dy;
-                            Lambda_inv_L[1] = du_dy;
+                            double drho_Y_dy[d_num_species];
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                Lambda_inv_L[si + 2] = c_y_T*c_y_T*drho_Y_dy[si] - Y_y_T[si]*dp_dy;
+                                drho_Y_dy[si] = -(rho_Y_y_TTT[si] - double(4)*rho_Y_y_TT[si] +
+                                    double(3)*rho_Y_y_T[si])/(double(2)*dx[1]);
                             }
-                            Lambda_inv_L[d_num_species + 2] = dw_dy;
-                            Lambda_inv_L[d_num_species + 3] = (double(1)/lambda_last)*(K*(p_y_T - p_t) - (double(1) - beta)*T_last);
+                            const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
+                            const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
+                            const double dw_dy   = -(w_y_TTT - double(4)*w_y_TT + double(3)*w_y_T)/(double(2)*dx[1]);
+                            const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
                             
-                            // Compute dV_dy.
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
                             
-                            const double c_sq_inv  = double(1)/(c_y_T*c_y_T);
-                            const double rho_c_inv = double(1)/(rho_y_T*c_y_T);
+                            double du_dx = double(0);
+                            double dv_dx = double(0);
+                            // double dw_dx = double(0);
+                            double dp_dx = double(0);
                             
-                            double dV_dy[d_num_species + 4];
-
-                            for (int si = 0; si < d_num_species; si++)
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
                             {
-                                dV_dy[si] = half*c_sq_inv*Y_y_T[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]) +
-                                    c_sq_inv*Lambda_inv_L[si + 2];
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_y_T)/(dx[0]);
+                                dv_dx = (v_x_R - v_y_T)/(dx[0]);
+                                // dw_dx = (w_x_R - w_y_T)/(dx[0]);
+                                dp_dx = (p_x_R - p_y_T)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_y_T - u_x_L)/(dx[0]);
+                                dv_dx = (v_y_T - v_x_L)/(dx[0]);
+                                // dw_dx = (w_y_T - w_x_L)/(dx[0]);
+                                dp_dx = (p_y_T - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // Central derivatives.
+                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
+                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
                             }
-                            dV_dy[d_num_species]     = Lambda_inv_L[1];
-                            dV_dy[d_num_species + 1] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
-                            dV_dy[d_num_species + 2] = Lambda_inv_L[d_num_species + 2];
-                            dV_dy[d_num_species + 3] = half*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
                             
-                            double V_ghost[(d_num_species + 4)*num_ghosts_to_fill];
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
                             
-                            for (int j = num_ghosts_to_fill - 1; j >= 0; j--)
+                            // double du_dz = double(0);
+                            double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
                             {
-                                const int idx_cell_rho_Y = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (k + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
+                                // Patch is touching periodic boundary.
                                 
-                                const int idx_cell_mom = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (k + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                // du_dz = (u_z_F - u_y_T)/(dx[2]);
+                                dv_dz = (v_z_F - v_y_T)/(dx[2]);
+                                dw_dz = (w_z_F - w_y_T)/(dx[2]);
+                                dp_dz = (p_z_F - p_y_T)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                
+                                // One-sided derivatives.
+                                // du_dz = (u_y_T - u_z_B)/(dx[2]);
+                                dv_dz = (v_y_T - v_z_B)/(dx[2]);
+                                dw_dz = (w_y_T - w_z_B)/(dx[2]);
+                                dp_dz = (p_y_T - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // Central derivatives.
+                                // du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
+                                dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
+                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
+                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                            }
+                            
+                            // Compute sound speed.
+                            
+                            double c_y_T = Gamma_bdry[idx_line]*p_y_T/rho_y_T;
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                c_y_T += Y_y_T[si]*Psi_bdry[si*num_lines + idx_line];
+                            }
+                            c_y_T = sqrt(c_y_T);
+                            
+                            const double lambda_last = v_y_T + c_y_T;
+                            
+                            // Compute vector Lambda^(-1) * L.
+                            
+                            double Lambda_inv_L[d_num_species + 4];
+                            
+                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
+                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
+                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
+                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            
+                            const double T_last = u_y_T*(dp_dx + rho_y_T*c_y_T*dv_dx) + rho_y_T*c_y_T*c_y_T*du_dx + 
+                                w_y_T*(dp_dz + rho_y_T*c_y_T*dv_dz) + rho_y_T*c_y_T*c_y_T*dw_dz;
+                            
+                            const double M_sq = (u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T)/(c_y_T*c_y_T);
+                            const double K = sigma*c_y_T*(double(1) - M_sq)/length_char;
+                            
+                            Lambda_inv_L[0] = dp_dy - rho_y_T*c_y_T*dv_dy;
+                            Lambda_inv_L[1] = du_dy;
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Lambda_inv_L[si + 2] = c_y_T*c_y_T*drho_Y_dy[si] - Y_y_T[si]*dp_dy;
+                            }
+                            Lambda_inv_L[d_num_species + 2] = dw_dy;
+                            Lambda_inv_L[d_num_species + 3] = (double(1)/lambda_last)*(K*(p_y_T - p_t) - (double(1) - beta)*T_last);
+                            
+                            // Compute dV_dy.
+                            
+                            const double c_sq_inv  = double(1)/(c_y_T*c_y_T);
+                            const double rho_c_inv = double(1)/(rho_y_T*c_y_T);
+                            
+                            double dV_dy[d_num_species + 4];
+                            
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                dV_dy[si] = half*c_sq_inv*Y_y_T[si]*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]) +
+                                    c_sq_inv*Lambda_inv_L[si + 2];
+                            }
+                            dV_dy[d_num_species]     = Lambda_inv_L[1];
+                            dV_dy[d_num_species + 1] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
+                            dV_dy[d_num_species + 2] = Lambda_inv_L[d_num_species + 2];
+                            dV_dy[d_num_species + 3] = half*(Lambda_inv_L[0] + Lambda_inv_L[d_num_species + 3]);
+                            
+                            double V_ghost[(d_num_species + 4)*num_ghosts_to_fill];
+                            
+                            for (int j = num_ghosts_to_fill - 1; j >= 0; j--)
+                            {
+                                const int idx_cell_rho_Y = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (k + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_mom = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (k + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
                                 
                                 const int idx_cell_E = (i + num_subghosts_conservative_var[2][0]) +
                                     (j + fill_box_lo_idx[1] + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
@@ -8869,26 +10048,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_ghost += V_ghost[j*(d_num_species + 4) + si];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_ghost;
-                                Y_ghost.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_ghost.push_back(V_ghost[j*(d_num_species + 4) + si]/rho_ghost);
-                                }
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                                 
                                 /*
-                                 * Get the pointers to the mass fractions.
+                                 * Compute the mass fractions.
                                  */
                                 
-                                std::vector<const double*> Y_ghost_ptr;
-                                Y_ghost_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                    Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[j*(d_num_species + 4) + si]/rho_ghost;
                                 }
                                 
                                 for(int si=0; si < d_num_species; si++)
@@ -8900,22 +10068,47 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[j*(d_num_species + 4) + d_num_species + 1];
                                 Q[d_num_species + 2][idx_cell_mom] = rho_ghost*V_ghost[j*(d_num_species + 4) + d_num_species + 2];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergy(
-                                        &rho_ghost,
-                                        &V_ghost[j*(d_num_species + 4) + d_num_species + 3],
-                                        Y_ghost_ptr);
-                                
-                                const double E = rho_ghost*epsilon +
-                                    half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                        Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                        Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                        rho_ghost;
+                                rho_ghosts[idx_ghost] = rho_ghost;
+                                p_ghosts[idx_ghost]   = V_ghost[j*(d_num_species + 4) + d_num_species + 3];
                                 
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::YHI)
                 {
@@ -8928,12 +10121,56 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 6)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_y_B   = idx_line;
+                            const int idx_state_y_BB  = idx_line + num_lines;
+                            const int idx_state_y_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_Y_y_B = (i + num_subghosts_conservative_var[0][0]) +
                                 (interior_box_hi_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -8980,19 +10217,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 (k + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
                                     subghostcell_dims_conservative_var[2][1];
                             
-                            std::vector<double> rho_Y_y_B;
-                            std::vector<double> rho_Y_y_BB;
-                            std::vector<double> rho_Y_y_BBB;
-                            rho_Y_y_B.reserve(d_num_species);
-                            rho_Y_y_BB.reserve(d_num_species);
-                            rho_Y_y_BBB.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                rho_Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]);
-                                rho_Y_y_BB.push_back(Q[si][idx_cell_rho_Y_y_BB]);
-                                rho_Y_y_BBB.push_back(Q[si][idx_cell_rho_Y_y_BBB]);
-                            }
-                            
                             /*
                              * Compute the mixture density.
                              */
@@ -9007,40 +10231,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 rho_y_BBB += Q[si][idx_cell_rho_Y_y_BBB];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_y_B;
-                            std::vector<double> Y_y_BB;
-                            std::vector<double> Y_y_BBB;
-                            Y_y_B.reserve(d_num_species);
-                            Y_y_BB.reserve(d_num_species);
-                            Y_y_BBB.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                Y_y_BB.push_back(Q[si][idx_cell_rho_Y_y_BB]/rho_y_BB);
-                                Y_y_BBB.push_back(Q[si][idx_cell_rho_Y_y_BBB]/rho_y_BBB);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_y_B_ptr;
-                            std::vector<const double*> Y_y_BB_ptr;
-                            std::vector<const double*> Y_y_BBB_ptr;
-                            Y_y_B_ptr.reserve(d_num_species);
-                            Y_y_BB_ptr.reserve(d_num_species);
-                            Y_y_BBB_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                Y_y_BB_ptr.push_back(&Y_y_BB[si]);
-                                Y_y_BBB_ptr.push_back(&Y_y_BBB[si]);
-                            }
-                            
                             const double u_y_B   = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                             const double u_y_BB  = Q[d_num_species][idx_cell_mom_y_BB]/rho_y_BB;
                             const double u_y_BBB = Q[d_num_species][idx_cell_mom_y_BBB]/rho_y_BBB;
@@ -9053,53 +10243,39 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             const double w_y_BB  = Q[d_num_species + 2][idx_cell_mom_y_BB]/rho_y_BB;
                             const double w_y_BBB = Q[d_num_species + 2][idx_cell_mom_y_BBB]/rho_y_BBB;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_y_B   = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                             const double epsilon_y_BB  = Q[d_num_species + 3][idx_cell_E_y_BB]/rho_y_BB - half*(u_y_BB*u_y_BB + v_y_BB*v_y_BB + w_y_BB*w_y_BB);
                             const double epsilon_y_BBB = Q[d_num_species + 3][idx_cell_E_y_BBB]/rho_y_BBB - half*(u_y_BBB*u_y_BBB + v_y_BBB*v_y_BBB + w_y_BBB*w_y_BBB);
-
-                            double p_y_B = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    Y_y_B_ptr);
-                            
-                            double p_y_BB = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_BB,
-                                    &epsilon_y_BB,
-                                    Y_y_BB_ptr);
-                            
-                            double p_y_BBB = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_y_BBB,
-                                    &epsilon_y_BBB,
-                                    Y_y_BBB_ptr);
                             
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
+                            rho_states[idx_state_y_B]   = rho_y_B;
+                            rho_states[idx_state_y_BB]  = rho_y_BB;
+                            rho_states[idx_state_y_BBB] = rho_y_BBB;
+                            
+                            u_states[idx_state_y_B]   = u_y_B;
+                            u_states[idx_state_y_BB]  = u_y_BB;
+                            u_states[idx_state_y_BBB] = u_y_BBB;
+                            
+                            v_states[idx_state_y_B]   = v_y_B;
+                            v_states[idx_state_y_BB]  = v_y_BB;
+                            v_states[idx_state_y_BBB] = v_y_BBB;
+                            
+                            w_states[idx_state_y_B]   = w_y_B;
+                            w_states[idx_state_y_BB]  = w_y_BB;
+                            w_states[idx_state_y_BBB] = w_y_BBB;
+                            
+                            epsilon_states[idx_state_y_B]   = epsilon_y_B;
+                            epsilon_states[idx_state_y_BB]  = epsilon_y_BB;
+                            epsilon_states[idx_state_y_BBB] = epsilon_y_BBB;
                             
-                            std::vector<double> drho_Y_dy;
-                            drho_Y_dy.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                drho_Y_dy.push_back((Q[si][idx_cell_rho_Y_y_BBB] - double(4)*Q[si][idx_cell_rho_Y_y_BB] +
-                                    double(3)*Q[si][idx_cell_rho_Y_y_B])/(double(2)*dx[1]));
+                                rho_Y_states[idx_state_y_B*d_num_species + si]   = Q[si][idx_cell_rho_Y_y_B];
+                                rho_Y_states[idx_state_y_BB*d_num_species + si]  = Q[si][idx_cell_rho_Y_y_BB];
+                                rho_Y_states[idx_state_y_BBB*d_num_species + si] = Q[si][idx_cell_rho_Y_y_BBB];
+                                Y_states[si*num_states + idx_state_y_B]   = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                Y_states[si*num_states + idx_state_y_BB]  = Q[si][idx_cell_rho_Y_y_BB]/rho_y_BB;
+                                Y_states[si*num_states + idx_state_y_BBB] = Q[si][idx_cell_rho_Y_y_BBB]/rho_y_BBB;
                             }
-                            const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
-                            const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
-                            const double dw_dy   = (w_y_BBB - double(4)*w_y_BB + double(3)*w_y_B)/(double(2)*dx[1]);
-                            const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
-                            
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
-                            
-                            double du_dx = double(0);
-                            double dv_dx = double(0);
-                            // double dw_dx = double(0);
-                            double dp_dx = double(0);
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -9136,44 +10312,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
+                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
+                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
+                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
+                                
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                std::vector<double> Y_x_R;
-                                Y_x_R.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_x_R_ptr;
-                                Y_x_R_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_y_B;
+                                epsilon_states[idx_state_x_L] = epsilon_y_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
+                                    Y_states[si*num_states + idx_state_x_L] = Y_states[si*num_states + idx_state_y_B];
                                 }
-                                
-                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
-                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
-                                
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_y_B)/(dx[0]);
-                                dv_dx = (v_x_R - v_y_B)/(dx[0]);
-                                // dw_dx = (w_x_R - w_y_B)/(dx[0]);
-                                dp_dx = (p_x_R - p_y_B)/(dx[0]);
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -9210,44 +10372,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_L += Q[si][idx_cell_rho_Y_x_L];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
+                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
+                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
+                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
+                                
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                std::vector<double> Y_x_L;
-                                Y_x_L.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                            
-                                std::vector<const double*> Y_x_L_ptr;
-                                Y_x_L_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_y_B;
+                                epsilon_states[idx_state_x_R] = epsilon_y_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
+                                    Y_states[si*num_states + idx_state_x_R] = Y_states[si*num_states + idx_state_y_B];
                                 }
-                                
-                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
-                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
-                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
-                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
-                                
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_y_B - u_x_L)/(dx[0]);
-                                dv_dx = (v_y_B - v_x_L)/(dx[0]);
-                                // dw_dx = (w_y_B - w_x_L)/(dx[0]);
-                                dp_dx = (p_y_B - p_x_L)/(dx[0]);
                             }
                             else
                             {
@@ -9293,75 +10441,40 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_x_L;
-                                std::vector<double> Y_x_R;
-                                Y_x_L.reserve(d_num_species);
-                                Y_x_R.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_x_L_ptr;
-                                std::vector<const double*> Y_x_R_ptr;
-                                                                    
-                                Y_x_L_ptr.reserve(d_num_species);
-                                Y_x_R_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
-                                }
-                                
                                 const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                                 const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-
+                                
                                 const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
                                 const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-
+                                
                                 const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
                                 const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
                                 
                                 const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
-                            
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
-
-                                // Central derivatives.
-                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
-                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
+                                
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
+                                
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                                }
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            // double du_dz = double(0);
-                            double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if (((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0)))
@@ -9397,44 +10510,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_z_F;
-                                Y_z_F.reserve(d_num_species);
+                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
+                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
+                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
+                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
+                                
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
+                                
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_F_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_y_B;
+                                epsilon_states[idx_state_z_B] = epsilon_y_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
+                                    Y_states[si*num_states + idx_state_z_B] = Y_states[si*num_states + idx_state_y_B];
                                 }
-                                
-                                const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
-                                const double v_z_F = Q[d_num_species + 1][idx_cell_mom_z_F]/rho_z_F;
-                                const double w_z_F = Q[d_num_species + 2][idx_cell_mom_z_F]/rho_z_F;
-                                const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
-                                
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
-                                
-                                // One-sided derivatives.
-                                // du_dz = (u_z_F - u_y_B)/(dx[2]);
-                                dv_dz = (v_z_F - v_y_B)/(dx[2]);
-                                dw_dz = (w_z_F - w_y_B)/(dx[2]);
-                                dp_dz = (p_z_F - p_y_B)/(dx[2]);
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -9471,44 +10570,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_B += Q[si][idx_cell_rho_Y_z_B];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
+                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
+                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
+                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
+                                
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                std::vector<double> Y_z_B;
-                                Y_z_B.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_y_B;
+                                epsilon_states[idx_state_z_F] = epsilon_y_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
+                                    Y_states[si*num_states + idx_state_z_F] = Y_states[si*num_states + idx_state_y_B];
                                 }
-                                
-                                const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
-                                const double v_z_B = Q[d_num_species + 1][idx_cell_mom_z_B]/rho_z_B;
-                                const double w_z_B = Q[d_num_species + 2][idx_cell_mom_z_B]/rho_z_B;
-                                const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
-                                
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
-                                
-                                // One-sided derivatives.
-                                // du_dz = (u_y_B - u_z_B)/(dx[2]);
-                                dv_dz = (v_y_B - v_z_B)/(dx[2]);
-                                dw_dz = (w_y_B - w_z_B)/(dx[2]);
-                                dp_dz = (p_y_B - p_z_B)/(dx[2]);
                             }
                             else
                             {
@@ -9554,34 +10639,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_z_F += Q[si][idx_cell_rho_Y_z_F];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_z_B;
-                                std::vector<double> Y_z_F;
-                                Y_z_B.reserve(d_num_species);
-                                Y_z_F.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
-                                    Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_z_B_ptr;
-                                std::vector<const double*> Y_z_F_ptr;
-                                Y_z_B_ptr.reserve(d_num_species);
-                                Y_z_F_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_z_B_ptr.push_back(&Y_z_B[si]);
-                                    Y_z_F_ptr.push_back(&Y_z_F[si]);
-                                }
-                                
                                 const double u_z_B = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
                                 const double u_z_F = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
                                 
@@ -9594,17 +10651,262 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                double p_z_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        Y_z_B_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
+                                
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
+                                
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_z_B] = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
+                                    Y_states[si*num_states + idx_state_z_F] = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
+                                }
+                            }
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_y_B   = idx_line;
+                            const int idx_state_y_BB  = idx_line + num_lines;
+                            const int idx_state_y_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
+                            
+                            const double& rho_y_B = rho_states[idx_state_y_B];
+                            
+                            const double& u_y_B   = u_states[idx_state_y_B];
+                            const double& u_y_BB  = u_states[idx_state_y_BB];
+                            const double& u_y_BBB = u_states[idx_state_y_BBB];
+                            
+                            const double& v_y_B   = v_states[idx_state_y_B];
+                            const double& v_y_BB  = v_states[idx_state_y_BB];
+                            const double& v_y_BBB = v_states[idx_state_y_BBB];
+                            
+                            const double& w_y_B   = w_states[idx_state_y_B];
+                            const double& w_y_BB  = w_states[idx_state_y_BB];
+                            const double& w_y_BBB = w_states[idx_state_y_BBB];
+                            
+                            const double& p_y_B   = p_states[idx_state_y_B];
+                            const double& p_y_BB  = p_states[idx_state_y_BB];
+                            const double& p_y_BBB = p_states[idx_state_y_BBB];
+                            
+                            const double* const rho_Y_y_B   = &rho_Y_states[idx_state_y_B*d_num_species];
+                            const double* const rho_Y_y_BB  = &rho_Y_states[idx_state_y_BB*d_num_species];
+                            const double* const rho_Y_y_BBB = &rho_Y_states[idx_state_y_BBB*d_num_species];
+                            
+                            double Y_y_B[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_y_B[si] = Y_states[si*num_states + idx_state_y_B];
+                            }
+                            
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
+                            
+                            double drho_Y_dy[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                drho_Y_dy[si] = (rho_Y_y_BBB[si] - double(4)*rho_Y_y_BB[si] +
+                                    double(3)*rho_Y_y_B[si])/(double(2)*dx[1]);
+                            }
+                            const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
+                            const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
+                            const double dw_dy   = (w_y_BBB - double(4)*w_y_BB + double(3)*w_y_B)/(double(2)*dx[1]);
+                            const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
+                            
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
+                            
+                            double du_dx = double(0);
+                            double dv_dx = double(0);
+                            // double dw_dx = double(0);
+                            double dp_dx = double(0);
+                            
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_y_B)/(dx[0]);
+                                dv_dx = (v_x_R - v_y_B)/(dx[0]);
+                                // dw_dx = (w_x_R - w_y_B)/(dx[0]);
+                                dp_dx = (p_x_R - p_y_B)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_y_B - u_x_L)/(dx[0]);
+                                dv_dx = (v_y_B - v_x_L)/(dx[0]);
+                                // dw_dx = (w_y_B - w_x_L)/(dx[0]);
+                                dp_dx = (p_y_B - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // Central derivatives.
+                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
+                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            // double du_dz = double(0);
+                            double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if (((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0)))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                // du_dz = (u_z_F - u_y_B)/(dx[2]);
+                                dv_dz = (v_z_F - v_y_B)/(dx[2]);
+                                dw_dz = (w_z_F - w_y_B)/(dx[2]);
+                                dp_dz = (p_z_F - p_y_B)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
                                 
-                                double p_z_F = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        Y_z_F_ptr);
+                                // One-sided derivatives.
+                                // du_dz = (u_y_B - u_z_B)/(dx[2]);
+                                dv_dz = (v_y_B - v_z_B)/(dx[2]);
+                                dw_dz = (w_y_B - w_z_B)/(dx[2]);
+                                dp_dz = (p_y_B - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
                                 
                                 // Central derivatives.
                                 // du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
@@ -9615,26 +10917,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             
                             // Compute sound speed.
                             
-                            const double Gamma_y_B = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                                &rho_y_B,
-                                &p_y_B,
-                                Y_y_B_ptr);
-                            
-                            const std::vector<double> Psi_y_B = d_equation_of_state_mixing_rules->
-                                getPressureDerivativeWithPartialDensities(
-                                        &rho_y_B,
-                                        &p_y_B,
-                                        Y_y_B_ptr);
-                            
-                            double c_y_B = Gamma_y_B*p_y_B/rho_y_B;
+                            double c_y_B = Gamma_bdry[idx_line]*p_y_B/rho_y_B;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                c_y_B += Y_y_B[si]*Psi_y_B[si];
+                                c_y_B += Y_y_B[si]*Psi_bdry[si*num_lines + idx_line];
                             }
                             c_y_B = sqrt(c_y_B);
                             
                             const double lambda_1 = v_y_B - c_y_B;
-
+                            
                             // Compute vector Lambda^(-1) * L.
                             
                             double Lambda_inv_L[d_num_species + 4];
@@ -9907,26 +11198,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_ghost += V_ghost[j*(d_num_species + 4) + si];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_ghost;
-                                Y_ghost.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_ghost.push_back(V_ghost[j*(d_num_species + 4) + si]/rho_ghost);
-                                }
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                                 
                                 /*
-                                 * Get the pointers to the mass fractions.
+                                 * Compute the mass fractions.
                                  */
                                 
-                                std::vector<const double*> Y_ghost_ptr;
-                                Y_ghost_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                    Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[j*(d_num_species + 4) + si]/rho_ghost;
                                 }
                                 
                                 for(int si=0; si < d_num_species; si++)
@@ -9938,22 +11218,47 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[j*(d_num_species + 4) + d_num_species + 1];
                                 Q[d_num_species + 2][idx_cell_mom] = rho_ghost*V_ghost[j*(d_num_species + 4) + d_num_species + 2];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergy(
-                                        &rho_ghost,
-                                        &V_ghost[j*(d_num_species + 4) + d_num_species + 3],
-                                        Y_ghost_ptr);
+                                rho_ghosts[idx_ghost] = rho_ghost;
+                                p_ghosts[idx_ghost]   = V_ghost[j*(d_num_species + 4) + d_num_species + 3];
                                 
-                                const double E = rho_ghost*epsilon +
-                                    half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                        Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                        Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                        rho_ghost;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::ZLO)
                 {
@@ -9966,12 +11271,56 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 6)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_z_F   = idx_line;
+                            const int idx_state_z_FF  = idx_line + num_lines;
+                            const int idx_state_z_FFF = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_Y_z_F = (i + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -10018,19 +11367,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 (interior_box_lo_idx[2] + 2 + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
                                     subghostcell_dims_conservative_var[2][1];
                             
-                            std::vector<double> rho_Y_z_F;
-                            std::vector<double> rho_Y_z_FF;
-                            std::vector<double> rho_Y_z_FFF;
-                            rho_Y_z_F.reserve(d_num_species);
-                            rho_Y_z_FF.reserve(d_num_species);
-                            rho_Y_z_FFF.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                rho_Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]);
-                                rho_Y_z_FF.push_back(Q[si][idx_cell_rho_Y_z_FF]);
-                                rho_Y_z_FFF.push_back(Q[si][idx_cell_rho_Y_z_FFF]);
-                            }
-                            
                             /*
                              * Compute the mixture density.
                              */
@@ -10045,40 +11381,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 rho_z_FFF += Q[si][idx_cell_rho_Y_z_FFF];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_z_F;
-                            std::vector<double> Y_z_FF;
-                            std::vector<double> Y_z_FFF;
-                            Y_z_F.reserve(d_num_species);
-                            Y_z_FF.reserve(d_num_species);
-                            Y_z_FFF.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_z_F.push_back(Q[si][idx_cell_rho_Y_z_F]/rho_z_F);
-                                Y_z_FF.push_back(Q[si][idx_cell_rho_Y_z_FF]/rho_z_FF);
-                                Y_z_FFF.push_back(Q[si][idx_cell_rho_Y_z_FFF]/rho_z_FFF);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_z_F_ptr;
-                            std::vector<const double*> Y_z_FF_ptr;
-                            std::vector<const double*> Y_z_FFF_ptr;
-                            Y_z_F_ptr.reserve(d_num_species);
-                            Y_z_FF_ptr.reserve(d_num_species);
-                            Y_z_FFF_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_z_F_ptr.push_back(&Y_z_F[si]);
-                                Y_z_FF_ptr.push_back(&Y_z_FF[si]);
-                                Y_z_FFF_ptr.push_back(&Y_z_FFF[si]);
-                            }
-                            
                             const double u_z_F   = Q[d_num_species][idx_cell_mom_z_F]/rho_z_F;
                             const double u_z_FF  = Q[d_num_species][idx_cell_mom_z_FF]/rho_z_FF;
                             const double u_z_FFF = Q[d_num_species][idx_cell_mom_z_FFF]/rho_z_FFF;
@@ -10091,53 +11393,39 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             const double w_z_FF  = Q[d_num_species + 2][idx_cell_mom_z_FF]/rho_z_FF;
                             const double w_z_FFF = Q[d_num_species + 2][idx_cell_mom_z_FFF]/rho_z_FFF;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_z_F   = Q[d_num_species + 3][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                             const double epsilon_z_FF  = Q[d_num_species + 3][idx_cell_E_z_FF]/rho_z_FF - half*(u_z_FF*u_z_FF + v_z_FF*v_z_FF + w_z_FF*w_z_FF);
                             const double epsilon_z_FFF = Q[d_num_species + 3][idx_cell_E_z_FFF]/rho_z_FFF - half*(u_z_FFF*u_z_FFF + v_z_FFF*v_z_FFF + w_z_FFF*w_z_FFF);
                             
-                            double p_z_F = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_z_F,
-                                    &epsilon_z_F,
-                                    Y_z_F_ptr);
+                            rho_states[idx_state_z_F]   = rho_z_F;
+                            rho_states[idx_state_z_FF]  = rho_z_FF;
+                            rho_states[idx_state_z_FFF] = rho_z_FFF;
                             
-                            double p_z_FF = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_z_FF,
-                                    &epsilon_z_FF,
-                                    Y_z_FF_ptr);
+                            u_states[idx_state_z_F]   = u_z_F;
+                            u_states[idx_state_z_FF]  = u_z_FF;
+                            u_states[idx_state_z_FFF] = u_z_FFF;
                             
-                            double p_z_FFF = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_z_FFF,
-                                    &epsilon_z_FFF,
-                                    Y_z_FFF_ptr);
+                            v_states[idx_state_z_F]   = v_z_F;
+                            v_states[idx_state_z_FF]  = v_z_FF;
+                            v_states[idx_state_z_FFF] = v_z_FFF;
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
+                            w_states[idx_state_z_F]   = w_z_F;
+                            w_states[idx_state_z_FF]  = w_z_FF;
+                            w_states[idx_state_z_FFF] = w_z_FFF;
+                            
+                            epsilon_states[idx_state_z_F]   = epsilon_z_F;
+                            epsilon_states[idx_state_z_FF]  = epsilon_z_FF;
+                            epsilon_states[idx_state_z_FFF] = epsilon_z_FFF;
                             
-                            std::vector<double> drho_Y_dz;
-                            drho_Y_dz.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                drho_Y_dz.push_back(-(Q[si][idx_cell_rho_Y_z_FFF] - double(4)*Q[si][idx_cell_rho_Y_z_FF] +
-                                    double(3)*Q[si][idx_cell_rho_Y_z_F])/(double(2)*dx[2]));
+                                rho_Y_states[idx_state_z_F*d_num_species + si]   = Q[si][idx_cell_rho_Y_z_F];
+                                rho_Y_states[idx_state_z_FF*d_num_species + si]  = Q[si][idx_cell_rho_Y_z_FF];
+                                rho_Y_states[idx_state_z_FFF*d_num_species + si] = Q[si][idx_cell_rho_Y_z_FFF];
+                                Y_states[si*num_states + idx_state_z_F]   = Q[si][idx_cell_rho_Y_z_F]/rho_z_F;
+                                Y_states[si*num_states + idx_state_z_FF]  = Q[si][idx_cell_rho_Y_z_FF]/rho_z_FF;
+                                Y_states[si*num_states + idx_state_z_FFF] = Q[si][idx_cell_rho_Y_z_FFF]/rho_z_FFF;
                             }
-                            const double du_dz   = -(u_z_FFF - double(4)*u_z_FF + double(3)*u_z_F)/(double(2)*dx[2]);
-                            const double dv_dz   = -(v_z_FFF - double(4)*v_z_FF + double(3)*v_z_F)/(double(2)*dx[2]);
-                            const double dw_dz   = -(w_z_FFF - double(4)*w_z_FF + double(3)*w_z_F)/(double(2)*dx[2]);
-                            const double dp_dz   = -(p_z_FFF - double(4)*p_z_FF + double(3)*p_z_F)/(double(2)*dx[2]);
-                            
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
-                            
-                            double du_dx = double(0);
-                            // double dv_dx = double(0);
-                            double dw_dx = double(0);
-                            double dp_dx = double(0);
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -10174,44 +11462,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
+                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
+                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
+                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
+                                
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                std::vector<double> Y_x_R;
-                                Y_x_R.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                            
-                                std::vector<const double*> Y_x_R_ptr;
-                                Y_x_R_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_z_F;
+                                epsilon_states[idx_state_x_L] = epsilon_z_F;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
+                                    Y_states[si*num_states + idx_state_x_L] = Y_states[si*num_states + idx_state_z_F];
                                 }
-                                
-                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
-                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
-                                
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_z_F)/(dx[0]);
-                                // dv_dx = (v_x_R - v_z_F)/(dx[0]);
-                                dw_dx = (w_x_R - w_z_F)/(dx[0]);
-                                dp_dx = (p_x_R - p_z_F)/(dx[0]);
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -10248,44 +11522,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_L += Q[si][idx_cell_rho_Y_x_L];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
+                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
+                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
+                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
+                                
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                std::vector<double> Y_x_L;
-                                Y_x_L.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                            
-                                std::vector<const double*> Y_x_L_ptr;
-                                Y_x_L_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_z_F;
+                                epsilon_states[idx_state_x_R] = epsilon_z_F;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
+                                    Y_states[si*num_states + idx_state_x_R] = Y_states[si*num_states + idx_state_z_F];
                                 }
-                                
-                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
-                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
-                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
-                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
-                                
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_z_F - u_x_L)/(dx[0]);
-                                // dv_dx = (v_z_F - v_x_L)/(dx[0]);
-                                dw_dx = (w_z_F - w_x_L)/(dx[0]);
-                                dp_dx = (p_z_F - p_x_L)/(dx[0]);
                             }
                             else
                             {
@@ -10331,35 +11591,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_x_L;
-                                std::vector<double> Y_x_R;
-                                Y_x_L.reserve(d_num_species);
-                                Y_x_R.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_x_L_ptr;
-                                std::vector<const double*> Y_x_R_ptr;
-                                                                    
-                                Y_x_L_ptr.reserve(d_num_species);
-                                Y_x_R_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
-                                }
-                                
                                 const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                                 const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
                                 
@@ -10372,34 +11603,28 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
-                            
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
                                 
-                                // Central derivatives.
-                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                                // dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                                dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
-                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
+                                
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                                }
                             }
                             
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
-                            
-                            // double du_dy = double(0);
-                            double dv_dy = double(0);
-                            double dw_dy = double(0);
-                            double dp_dy = double(0);
-                            
                             if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                                 (j + num_subghosts_conservative_var[1][1] == 0) ||
                                 (j + num_subghosts_conservative_var[2][1] == 0))
@@ -10435,38 +11660,365 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
+                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
+                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
+                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
+                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
+                                
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                                }
+                                
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_z_F;
+                                epsilon_states[idx_state_y_B] = epsilon_z_F;
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_B] = Y_states[si*num_states + idx_state_z_F];
+                                }
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const int idx_cell_rho_Y_y_B = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
                                 /*
-                                 * Compute the mass fractions.
+                                 * Compute the mixture density.
                                  */
                                 
-                                std::vector<double> Y_y_T;
-                                Y_y_T.reserve(d_num_species);
+                                double rho_y_B = double(0);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
+                                    rho_y_B += Q[si][idx_cell_rho_Y_y_B];
                                 }
                                 
+                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
+                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
+                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
+                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
+                                
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                }
+                                
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_z_F;
+                                epsilon_states[idx_state_y_T] = epsilon_z_F;
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_T] = Y_states[si*num_states + idx_state_z_F];
+                                }
+                            }
+                            else
+                            {
+                                const int idx_cell_rho_Y_y_B = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (interior_box_lo_idx[2] +  num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_rho_Y_y_T = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_mom_y_T = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
+                                const int idx_cell_E_y_T = (i + num_subghosts_conservative_var[2][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
+                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
                                 /*
-                                 * Get the pointers to the mass fractions.
+                                 * Compute the mixture density.
                                  */
                                 
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_T_ptr.reserve(d_num_species);
+                                double rho_y_B = double(0);
+                                double rho_y_T = double(0);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
+                                    rho_y_B += Q[si][idx_cell_rho_Y_y_B];
+                                    rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
+                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                                 const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
+                                
+                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
                                 const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
+                                
+                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
                                 const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
+                                
+                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
+                                
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
+                                
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                                }
+                            }
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_z_F   = idx_line;
+                            const int idx_state_z_FF  = idx_line + num_lines;
+                            const int idx_state_z_FFF = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
+                            
+                            const double& rho_z_F = rho_states[idx_state_z_F];
+                            
+                            const double& u_z_F   = u_states[idx_state_z_F];
+                            const double& u_z_FF  = u_states[idx_state_z_FF];
+                            const double& u_z_FFF = u_states[idx_state_z_FFF];
+                            
+                            const double& v_z_F   = v_states[idx_state_z_F];
+                            const double& v_z_FF  = v_states[idx_state_z_FF];
+                            const double& v_z_FFF = v_states[idx_state_z_FFF];
+                            
+                            const double& w_z_F   = w_states[idx_state_z_F];
+                            const double& w_z_FF  = w_states[idx_state_z_FF];
+                            const double& w_z_FFF = w_states[idx_state_z_FFF];
+                            
+                            const double& p_z_F   = p_states[idx_state_z_F];
+                            const double& p_z_FF  = p_states[idx_state_z_FF];
+                            const double& p_z_FFF = p_states[idx_state_z_FFF];
+                            
+                            const double* const rho_Y_z_F   = &rho_Y_states[idx_state_z_F*d_num_species];
+                            const double* const rho_Y_z_FF  = &rho_Y_states[idx_state_z_FF*d_num_species];
+                            const double* const rho_Y_z_FFF = &rho_Y_states[idx_state_z_FFF*d_num_species];
+                            
+                            double Y_z_F[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_z_F[si] = Y_states[si*num_states + idx_state_z_F];
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            double drho_Y_dz[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                drho_Y_dz[si] = -(rho_Y_z_FFF[si] - double(4)*rho_Y_z_FF[si] +
+                                    double(3)*rho_Y_z_F[si])/(double(2)*dx[2]);
+                            }
+                            const double du_dz   = -(u_z_FFF - double(4)*u_z_FF + double(3)*u_z_F)/(double(2)*dx[2]);
+                            const double dv_dz   = -(v_z_FFF - double(4)*v_z_FF + double(3)*v_z_F)/(double(2)*dx[2]);
+                            const double dw_dz   = -(w_z_FFF - double(4)*w_z_FF + double(3)*w_z_F)/(double(2)*dx[2]);
+                            const double dp_dz   = -(p_z_FFF - double(4)*p_z_FF + double(3)*p_z_F)/(double(2)*dx[2]);
+                            
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
+                            
+                            double du_dx = double(0);
+                            // double dv_dx = double(0);
+                            double dw_dx = double(0);
+                            double dp_dx = double(0);
+                            
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_z_F)/(dx[0]);
+                                // dv_dx = (v_x_R - v_z_F)/(dx[0]);
+                                dw_dx = (w_x_R - w_z_F)/(dx[0]);
+                                dp_dx = (p_x_R - p_z_F)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_z_F - u_x_L)/(dx[0]);
+                                // dv_dx = (v_z_F - v_x_L)/(dx[0]);
+                                dw_dx = (w_z_F - w_x_L)/(dx[0]);
+                                dp_dx = (p_z_F - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // Central derivatives.
+                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                                // dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                                dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
+                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
+                            
+                            // double du_dy = double(0);
+                            double dv_dy = double(0);
+                            double dw_dy = double(0);
+                            double dp_dy = double(0);
+                            
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
                                 
                                 // One-sided derivatives.
                                 //du_dy = (u_y_T - u_z_F)/(dx[1]);
@@ -10484,63 +12036,10 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             {
                                 // Patch is touching periodic boundary.
                                 
-                                const int idx_cell_rho_Y_y_B = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
-                                
-                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
-                                
-                                /*
-                                 * Compute the mixture density.
-                                 */
-                                
-                                double rho_y_B = double(0);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    rho_y_B += Q[si][idx_cell_rho_Y_y_B];
-                                }
-                                
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_y_B;
-                                Y_y_B.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                }
-                                
-                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
-                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
-                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
-                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
-                                
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
                                 
                                 // One-sided derivatives.
                                 //du_dy = (u_z_F - u_y_B)/(dx[1]);
@@ -10550,99 +12049,14 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             }
                             else
                             {
-                                const int idx_cell_rho_Y_y_B = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (interior_box_lo_idx[2] +  num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_rho_Y_y_T = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
-                                
-                                const int idx_cell_mom_y_T = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
-                                
-                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
-                                
-                                const int idx_cell_E_y_T = (i + num_subghosts_conservative_var[2][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
-                                    (interior_box_lo_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
-                                
-                                /*
-                                 * Compute the mixture density.
-                                 */
-                                
-                                double rho_y_B = double(0);
-                                double rho_y_T = double(0);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    rho_y_B += Q[si][idx_cell_rho_Y_y_B];
-                                    rho_y_T += Q[si][idx_cell_rho_Y_y_T];
-                                }
-                                
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_y_B;
-                                std::vector<double> Y_y_T;
-                                Y_y_B.reserve(d_num_species);
-                                Y_y_T.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
-                                Y_y_T_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
-                                }
-                                
-                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
-                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
-                                
-                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
-                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
-                                
-                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
-                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
-                                
-                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
-                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
-                                
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
-                                
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
                                 
                                 // Central derivatives.
                                 // du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
@@ -10653,21 +12067,10 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             
                             // Compute sound speed.
                             
-                            const double Gamma_z_F = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                                &rho_z_F,
-                                &p_z_F,
-                                Y_z_F_ptr);
-
-                            const std::vector<double> Psi_z_F = d_equation_of_state_mixing_rules->
-                                getPressureDerivativeWithPartialDensities(
-                                        &rho_z_F,
-                                        &p_z_F,
-                                        Y_z_F_ptr);
-                            
-                            double c_z_F = Gamma_z_F*p_z_F/rho_z_F;
+                            double c_z_F = Gamma_bdry[idx_line]*p_z_F/rho_z_F;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                c_z_F += Y_z_F[si]*Psi_z_F[si];
+                                c_z_F += Y_z_F[si]*Psi_bdry[si*num_lines + idx_line];
                             }
                             c_z_F = sqrt(c_z_F);
                             
@@ -10945,26 +12348,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_ghost += V_ghost[k*(d_num_species + 4) + si];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_ghost;
-                                Y_ghost.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_ghost.push_back(V_ghost[k*(d_num_species + 4) + si]/rho_ghost);
-                                }
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + k;
                                 
                                 /*
-                                 * Get the pointers to the mass fractions.
+                                 * Compute the mass fractions.
                                  */
                                 
-                                std::vector<const double*> Y_ghost_ptr;
-                                Y_ghost_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                    Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[k*(d_num_species + 4) + si]/rho_ghost;
                                 }
                                 
                                 for(int si=0; si < d_num_species; si++)
@@ -10976,22 +12368,47 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[k*(d_num_species + 4) + d_num_species + 1];
                                 Q[d_num_species + 2][idx_cell_mom] = rho_ghost*V_ghost[k*(d_num_species + 4) + d_num_species + 2];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergy(
-                                        &rho_ghost,
-                                        &V_ghost[k*(d_num_species + 4) + d_num_species + 3],
-                                        Y_ghost_ptr);
-                                
-                                const double E = rho_ghost*epsilon +
-                                    half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                        Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                        Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                        rho_ghost;
+                                rho_ghosts[idx_ghost] = rho_ghost;
+                                p_ghosts[idx_ghost]   = V_ghost[k*(d_num_species + 4) + d_num_species + 3];
                                 
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::ZHI)
                 {
@@ -11004,12 +12421,56 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize((d_num_species + 6)*num_states + (4*d_num_species + 1)*num_lines +
+                        (d_num_species + 3)*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const Y_states       = p_states + num_states;
+                    double* const rho_Y_states   = Y_states + d_num_species*num_states;
+                    double* const Gamma_bdry     = rho_Y_states + 3*d_num_species*num_lines;
+                    double* const Psi_bdry       = Gamma_bdry + num_lines;
+                    double* const rho_ghosts     = Psi_bdry + d_num_species*num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    double* const Y_ghosts       = epsilon_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_z_B   = idx_line;
+                            const int idx_state_z_BB  = idx_line + num_lines;
+                            const int idx_state_z_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_Y_z_B = (i + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -11056,19 +12517,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 (interior_box_hi_idx[2] - 2 + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
                                     subghostcell_dims_conservative_var[2][1];
                             
-                            std::vector<double> rho_Y_z_B;
-                            std::vector<double> rho_Y_z_BB;
-                            std::vector<double> rho_Y_z_BBB;
-                            rho_Y_z_B.reserve(d_num_species);
-                            rho_Y_z_BB.reserve(d_num_species);
-                            rho_Y_z_BBB.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                rho_Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]);
-                                rho_Y_z_BB.push_back(Q[si][idx_cell_rho_Y_z_BB]);
-                                rho_Y_z_BBB.push_back(Q[si][idx_cell_rho_Y_z_BBB]);
-                            }
-                            
                             /*
                              * Compute the mixture density.
                              */
@@ -11083,40 +12531,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 rho_z_BBB += Q[si][idx_cell_rho_Y_z_BBB];
                             }
                             
-                            /*
-                             * Compute the mass fractions.
-                             */
-                            
-                            std::vector<double> Y_z_B;
-                            std::vector<double> Y_z_BB;
-                            std::vector<double> Y_z_BBB;
-                            Y_z_B.reserve(d_num_species);
-                            Y_z_BB.reserve(d_num_species);
-                            Y_z_BBB.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_z_B.push_back(Q[si][idx_cell_rho_Y_z_B]/rho_z_B);
-                                Y_z_BB.push_back(Q[si][idx_cell_rho_Y_z_BB]/rho_z_BB);
-                                Y_z_BBB.push_back(Q[si][idx_cell_rho_Y_z_BBB]/rho_z_BBB);
-                            }
-                            
-                            /*
-                             * Get the pointers to the mass fractions.
-                             */
-                            
-                            std::vector<const double*> Y_z_B_ptr;
-                            std::vector<const double*> Y_z_BB_ptr;
-                            std::vector<const double*> Y_z_BBB_ptr;
-                            Y_z_B_ptr.reserve(d_num_species);
-                            Y_z_BB_ptr.reserve(d_num_species);
-                            Y_z_BBB_ptr.reserve(d_num_species);
-                            for (int si = 0; si < d_num_species; si++)
-                            {
-                                Y_z_B_ptr.push_back(&Y_z_B[si]);
-                                Y_z_BB_ptr.push_back(&Y_z_BB[si]);
-                                Y_z_BBB_ptr.push_back(&Y_z_BBB[si]);
-                            }
-                            
                             const double u_z_B   = Q[d_num_species][idx_cell_mom_z_B]/rho_z_B;
                             const double u_z_BB  = Q[d_num_species][idx_cell_mom_z_BB]/rho_z_BB;
                             const double u_z_BBB = Q[d_num_species][idx_cell_mom_z_BBB]/rho_z_BBB;
@@ -11129,53 +12543,39 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             const double w_z_BB  = Q[d_num_species + 2][idx_cell_mom_z_BB]/rho_z_BB;
                             const double w_z_BBB = Q[d_num_species + 2][idx_cell_mom_z_BBB]/rho_z_BBB;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_z_B   = Q[d_num_species + 3][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                             const double epsilon_z_BB  = Q[d_num_species + 3][idx_cell_E_z_BB]/rho_z_BB - half*(u_z_BB*u_z_BB + v_z_BB*v_z_BB + w_z_BB*w_z_BB);
                             const double epsilon_z_BBB = Q[d_num_species + 3][idx_cell_E_z_BBB]/rho_z_BBB - half*(u_z_BBB*u_z_BBB + v_z_BBB*v_z_BBB + w_z_BBB*w_z_BBB);
                             
-                            double p_z_B = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_z_B,
-                                    &epsilon_z_B,
-                                    Y_z_B_ptr);
+                            rho_states[idx_state_z_B]   = rho_z_B;
+                            rho_states[idx_state_z_BB]  = rho_z_BB;
+                            rho_states[idx_state_z_BBB] = rho_z_BBB;
                             
-                            double p_z_BB = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_z_BB,
-                                    &epsilon_z_BB,
-                                    Y_z_BB_ptr);
+                            u_states[idx_state_z_B]   = u_z_B;
+                            u_states[idx_state_z_BB]  = u_z_BB;
+                            u_states[idx_state_z_BBB] = u_z_BBB;
                             
-                            double p_z_BBB = d_equation_of_state_mixing_rules->
-                                getPressure(
-                                    &rho_z_BBB,
-                                    &epsilon_z_BBB,
-                                    Y_z_BBB_ptr);
+                            v_states[idx_state_z_B]   = v_z_B;
+                            v_states[idx_state_z_BB]  = v_z_BB;
+                            v_states[idx_state_z_BBB] = v_z_BBB;
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
+                            w_states[idx_state_z_B]   = w_z_B;
+                            w_states[idx_state_z_BB]  = w_z_BB;
+                            w_states[idx_state_z_BBB] = w_z_BBB;
+                            
+                            epsilon_states[idx_state_z_B]   = epsilon_z_B;
+                            epsilon_states[idx_state_z_BB]  = epsilon_z_BB;
+                            epsilon_states[idx_state_z_BBB] = epsilon_z_BBB;
                             
-                            std::vector<double> drho_Y_dz;
-                            drho_Y_dz.reserve(d_num_species);
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                drho_Y_dz.push_back((Q[si][idx_cell_rho_Y_z_BBB] - double(4)*Q[si][idx_cell_rho_Y_z_BB] +
-                                    double(3)*Q[si][idx_cell_rho_Y_z_B])/(double(2)*dx[2]));
+                                rho_Y_states[idx_state_z_B*d_num_species + si]   = Q[si][idx_cell_rho_Y_z_B];
+                                rho_Y_states[idx_state_z_BB*d_num_species + si]  = Q[si][idx_cell_rho_Y_z_BB];
+                                rho_Y_states[idx_state_z_BBB*d_num_species + si] = Q[si][idx_cell_rho_Y_z_BBB];
+                                Y_states[si*num_states + idx_state_z_B]   = Q[si][idx_cell_rho_Y_z_B]/rho_z_B;
+                                Y_states[si*num_states + idx_state_z_BB]  = Q[si][idx_cell_rho_Y_z_BB]/rho_z_BB;
+                                Y_states[si*num_states + idx_state_z_BBB] = Q[si][idx_cell_rho_Y_z_BBB]/rho_z_BBB;
                             }
-                            const double du_dz   = (u_z_BBB - double(4)*u_z_BB + double(3)*u_z_B)/(double(2)*dx[2]);
-                            const double dv_dz   = (v_z_BBB - double(4)*v_z_BB + double(3)*v_z_B)/(double(2)*dx[2]);
-                            const double dw_dz   = (w_z_BBB - double(4)*w_z_BB + double(3)*w_z_B)/(double(2)*dx[2]);
-                            const double dp_dz   = (p_z_BBB - double(4)*p_z_BB + double(3)*p_z_B)/(double(2)*dx[2]);
-                            
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
-                            
-                            double du_dx = double(0);
-                            // double dv_dx = double(0);
-                            double dw_dx = double(0);
-                            double dp_dx = double(0);
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -11212,44 +12612,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
+                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
+                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
+                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
+                                
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                std::vector<double> Y_x_R;
-                                Y_x_R.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_x_R_ptr;
-                                Y_x_R_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_z_B;
+                                epsilon_states[idx_state_x_L] = epsilon_z_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
+                                    Y_states[si*num_states + idx_state_x_L] = Y_states[si*num_states + idx_state_z_B];
                                 }
-                                
-                                const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-                                const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-                                const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
-                                const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
-                                
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_z_B)/(dx[0]);
-                                // dv_dx = (v_x_R - v_z_B)/(dx[0]);
-                                dw_dx = (w_x_R - w_z_B)/(dx[0]);
-                                dp_dx = (p_x_R - p_z_B)/(dx[0]);
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -11286,44 +12672,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_L += Q[si][idx_cell_rho_Y_x_L];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
+                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
+                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
+                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
+                                
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                std::vector<double> Y_x_L;
-                                Y_x_L.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                            
-                                std::vector<const double*> Y_x_L_ptr;
-                                Y_x_L_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_z_B;
+                                epsilon_states[idx_state_x_R] = epsilon_z_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
+                                    Y_states[si*num_states + idx_state_x_R] = Y_states[si*num_states + idx_state_z_B];
                                 }
-                                
-                                const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
-                                const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
-                                const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
-                                const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
-                                
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
-                                
-                                // One-sided derivatives.
-                                du_dx = (u_z_B - u_x_L)/(dx[0]);
-                                // dv_dx = (v_z_B - v_x_L)/(dx[0]);
-                                dw_dx = (w_z_B - w_x_L)/(dx[0]);
-                                dp_dx = (p_z_B - p_x_L)/(dx[0]);
                             }
                             else
                             {
@@ -11369,75 +12741,40 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_x_R += Q[si][idx_cell_rho_Y_x_R];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_x_L;
-                                std::vector<double> Y_x_R;
-                                Y_x_L.reserve(d_num_species);
-                                Y_x_R.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L.push_back(Q[si][idx_cell_rho_Y_x_L]/rho_x_L);
-                                    Y_x_R.push_back(Q[si][idx_cell_rho_Y_x_R]/rho_x_R);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_x_L_ptr;
-                                std::vector<const double*> Y_x_R_ptr;
-                                                                    
-                                Y_x_L_ptr.reserve(d_num_species);
-                                Y_x_R_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_x_L_ptr.push_back(&Y_x_L[si]);
-                                    Y_x_R_ptr.push_back(&Y_x_R[si]);
-                                }
-                                
                                 const double u_x_L = Q[d_num_species][idx_cell_mom_x_L]/rho_x_L;
                                 const double u_x_R = Q[d_num_species][idx_cell_mom_x_R]/rho_x_R;
-
+                                
                                 const double v_x_L = Q[d_num_species + 1][idx_cell_mom_x_L]/rho_x_L;
                                 const double v_x_R = Q[d_num_species + 1][idx_cell_mom_x_R]/rho_x_R;
-
+                                
                                 const double w_x_L = Q[d_num_species + 2][idx_cell_mom_x_L]/rho_x_L;
                                 const double w_x_R = Q[d_num_species + 2][idx_cell_mom_x_R]/rho_x_R;
                                 
                                 const double epsilon_x_L = Q[d_num_species + 3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 const double epsilon_x_R = Q[d_num_species + 3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                double p_x_L = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        Y_x_L_ptr);
-                            
-                                double p_x_R = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        Y_x_R_ptr);
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
                                 
-                                // Central derivatives.
-                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                                // dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                                dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
-                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
+                                
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_x_L] = Q[si][idx_cell_rho_Y_x_L]/rho_x_L;
+                                    Y_states[si*num_states + idx_state_x_R] = Q[si][idx_cell_rho_Y_x_R]/rho_x_R;
+                                }
                             }
                             
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
-                            
-                            // double du_dy = double(0);
-                            double dv_dy = double(0);
-                            double dw_dy = double(0);
-                            double dp_dy = double(0);
-                            
                             if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                                 (j + num_subghosts_conservative_var[1][1] == 0) ||
                                 (j + num_subghosts_conservative_var[2][1] == 0))
@@ -11473,44 +12810,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
+                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
+                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
+                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
+                                
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                                 
-                                std::vector<double> Y_y_T;
-                                Y_y_T.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_T_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_z_B;
+                                epsilon_states[idx_state_y_B] = epsilon_z_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
+                                    Y_states[si*num_states + idx_state_y_B] = Y_states[si*num_states + idx_state_z_B];
                                 }
-                                
-                                const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
-                                const double v_y_T = Q[d_num_species + 1][idx_cell_mom_y_T]/rho_y_T;
-                                const double w_y_T = Q[d_num_species + 2][idx_cell_mom_y_T]/rho_y_T;
-                                const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
-                                
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
-                                
-                                // One-sided derivatives.
-                                // du_dy = (u_y_T - u_z_B)/(dx[1]);
-                                dv_dy = (v_y_T - v_z_B)/(dx[1]);
-                                dw_dy = (w_y_T - w_z_B)/(dx[1]);
-                                dp_dy = (p_y_T - p_z_B)/(dx[1]);
                             }
                             else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                      (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -11547,44 +12870,30 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_B += Q[si][idx_cell_rho_Y_y_B];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
+                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
+                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
+                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
+                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
+                                
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
                                 
-                                std::vector<double> Y_y_B;
-                                Y_y_B.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
                                 }
                                 
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_z_B;
+                                epsilon_states[idx_state_y_T] = epsilon_z_B;
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
+                                    Y_states[si*num_states + idx_state_y_T] = Y_states[si*num_states + idx_state_z_B];
                                 }
-                                
-                                const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
-                                const double v_y_B = Q[d_num_species + 1][idx_cell_mom_y_B]/rho_y_B;
-                                const double w_y_B = Q[d_num_species + 2][idx_cell_mom_y_B]/rho_y_B;
-                                const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
-                                
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
-                                
-                                // One-sided derivatives.
-                                // du_dy = (u_z_B - u_y_B)/(dx[1]);
-                                dv_dy = (v_z_B - v_y_B)/(dx[1]);
-                                dw_dy = (w_z_B - w_y_B)/(dx[1]);
-                                dp_dy = (p_z_B - p_y_B)/(dx[1]);
                             }
                             else
                             {
@@ -11630,34 +12939,6 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_y_T += Q[si][idx_cell_rho_Y_y_T];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_y_B;
-                                std::vector<double> Y_y_T;
-                                Y_y_B.reserve(d_num_species);
-                                Y_y_T.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B.push_back(Q[si][idx_cell_rho_Y_y_B]/rho_y_B);
-                                    Y_y_T.push_back(Q[si][idx_cell_rho_Y_y_T]/rho_y_T);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions.
-                                 */
-                                
-                                std::vector<const double*> Y_y_B_ptr;
-                                std::vector<const double*> Y_y_T_ptr;
-                                Y_y_B_ptr.reserve(d_num_species);
-                                Y_y_T_ptr.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_y_B_ptr.push_back(&Y_y_B[si]);
-                                    Y_y_T_ptr.push_back(&Y_y_T[si]);
-                                }
-                                
                                 const double u_y_B = Q[d_num_species][idx_cell_mom_y_B]/rho_y_B;
                                 const double u_y_T = Q[d_num_species][idx_cell_mom_y_T]/rho_y_T;
                                 
@@ -11670,17 +12951,262 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 const double epsilon_y_B = Q[d_num_species + 3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 const double epsilon_y_T = Q[d_num_species + 3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                double p_y_B = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        Y_y_B_ptr);
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
+                                
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
+                                
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
+                                
+                                for (int si = 0; si < d_num_species; si++)
+                                {
+                                    Y_states[si*num_states + idx_state_y_B] = Q[si][idx_cell_rho_Y_y_B]/rho_y_B;
+                                    Y_states[si*num_states + idx_state_y_T] = Q[si][idx_cell_rho_Y_y_T]/rho_y_T;
+                                }
+                            }
+                        }
+                    }
+                    
+                    /*
+                     * Compute the pressures of all the states and the Gruneisen parameters and the partial derivatives
+                     * of pressure w.r.t. partial densities at the boundary in batch.
+                     */
+                    
+                    const double* Y_states_ptr[d_num_species];
+                    double* Psi_bdry_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_states_ptr[si] = &Y_states[si*num_states];
+                        Psi_bdry_ptr[si] = &Psi_bdry[si*num_lines];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeGruneisenParameter(
+                            Gamma_bdry,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressureDerivativeWithPartialDensities(
+                            Psi_bdry_ptr,
+                            rho_states,
+                            p_states,
+                            Y_states_ptr,
+                            d_num_species,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_z_B   = idx_line;
+                            const int idx_state_z_BB  = idx_line + num_lines;
+                            const int idx_state_z_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
+                            
+                            const double& rho_z_B = rho_states[idx_state_z_B];
+                            
+                            const double& u_z_B   = u_states[idx_state_z_B];
+                            const double& u_z_BB  = u_states[idx_state_z_BB];
+                            const double& u_z_BBB = u_states[idx_state_z_BBB];
+                            
+                            const double& v_z_B   = v_states[idx_state_z_B];
+                            const double& v_z_BB  = v_states[idx_state_z_BB];
+                            const double& v_z_BBB = v_states[idx_state_z_BBB];
+                            
+                            const double& w_z_B   = w_states[idx_state_z_B];
+                            const double& w_z_BB  = w_states[idx_state_z_BB];
+                            const double& w_z_BBB = w_states[idx_state_z_BBB];
+                            
+                            const double& p_z_B   = p_states[idx_state_z_B];
+                            const double& p_z_BB  = p_states[idx_state_z_BB];
+                            const double& p_z_BBB = p_states[idx_state_z_BBB];
+                            
+                            const double* const rho_Y_z_B   = &rho_Y_states[idx_state_z_B*d_num_species];
+                            const double* const rho_Y_z_BB  = &rho_Y_states[idx_state_z_BB*d_num_species];
+                            const double* const rho_Y_z_BBB = &rho_Y_states[idx_state_z_BBB*d_num_species];
+                            
+                            double Y_z_B[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                Y_z_B[si] = Y_states[si*num_states + idx_state_z_B];
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            double drho_Y_dz[d_num_species];
+                            for (int si = 0; si < d_num_species; si++)
+                            {
+                                drho_Y_dz[si] = (rho_Y_z_BBB[si] - double(4)*rho_Y_z_BB[si] +
+                                    double(3)*rho_Y_z_B[si])/(double(2)*dx[2]);
+                            }
+                            const double du_dz   = (u_z_BBB - double(4)*u_z_BB + double(3)*u_z_B)/(double(2)*dx[2]);
+                            const double dv_dz   = (v_z_BBB - double(4)*v_z_BB + double(3)*v_z_B)/(double(2)*dx[2]);
+                            const double dw_dz   = (w_z_BBB - double(4)*w_z_BB + double(3)*w_z_B)/(double(2)*dx[2]);
+                            const double dp_dz   = (p_z_BBB - double(4)*p_z_BB + double(3)*p_z_B)/(double(2)*dx[2]);
+                            
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
+                            
+                            double du_dx = double(0);
+                            // double dv_dx = double(0);
+                            double dw_dx = double(0);
+                            double dp_dx = double(0);
+                            
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_z_B)/(dx[0]);
+                                // dv_dx = (v_x_R - v_z_B)/(dx[0]);
+                                dw_dx = (w_x_R - w_z_B)/(dx[0]);
+                                dp_dx = (p_x_R - p_z_B)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_z_B - u_x_L)/(dx[0]);
+                                // dv_dx = (v_z_B - v_x_L)/(dx[0]);
+                                dw_dx = (w_z_B - w_x_L)/(dx[0]);
+                                dp_dx = (p_z_B - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // Central derivatives.
+                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                                // dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                                dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
+                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
+                            
+                            // double du_dy = double(0);
+                            double dv_dy = double(0);
+                            double dw_dy = double(0);
+                            double dp_dy = double(0);
                             
-                                double p_y_T = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        Y_y_T_ptr);
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // One-sided derivatives.
+                                // du_dy = (u_y_T - u_z_B)/(dx[1]);
+                                dv_dy = (v_y_T - v_z_B)/(dx[1]);
+                                dw_dy = (w_y_T - w_z_B)/(dx[1]);
+                                dp_dy = (p_y_T - p_z_B)/(dx[1]);
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                
+                                // One-sided derivatives.
+                                // du_dy = (u_z_B - u_y_B)/(dx[1]);
+                                dv_dy = (v_z_B - v_y_B)/(dx[1]);
+                                dw_dy = (w_z_B - w_y_B)/(dx[1]);
+                                dp_dy = (p_z_B - p_y_B)/(dx[1]);
+                            }
+                            else
+                            {
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
                                 
                                 // Central derivatives.
                                 // du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
@@ -11691,21 +13217,10 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                             
                             // Compute sound speed.
                             
-                            const double Gamma_z_B = d_equation_of_state_mixing_rules->getGruneisenParameter(
-                                &rho_z_B,
-                                &p_z_B,
-                                Y_z_B_ptr);
-                            
-                            const std::vector<double> Psi_z_B = d_equation_of_state_mixing_rules->
-                                getPressureDerivativeWithPartialDensities(
-                                        &rho_z_B,
-                                        &p_z_B,
-                                        Y_z_B_ptr);
-                            
-                            double c_z_B = Gamma_z_B*p_z_B/rho_z_B;
+                            double c_z_B = Gamma_bdry[idx_line]*p_z_B/rho_z_B;
                             for (int si = 0; si < d_num_species; si++)
                             {
-                                c_z_B += Y_z_B[si]*Psi_z_B[si];
+                                c_z_B += Y_z_B[si]*Psi_bdry[si*num_lines + idx_line];
                             }
                             c_z_B = sqrt(c_z_B);
                             
@@ -11983,26 +13498,15 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                     rho_ghost += V_ghost[k*(d_num_species + 4) + si];
                                 }
                                 
-                                /*
-                                 * Compute the mass fractions.
-                                 */
-                                
-                                std::vector<double> Y_ghost;
-                                Y_ghost.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_ghost.push_back(V_ghost[k*(d_num_species + 4) + si]/rho_ghost);
-                                }
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + k;
                                 
                                 /*
-                                 * Get the pointers to the mass fractions.
+                                 * Compute the mass fractions.
                                  */
                                 
-                                std::vector<const double*> Y_ghost_ptr;
-                                Y_ghost_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_ghost_ptr.push_back(&Y_ghost[si]);
+                                    Y_ghosts[si*num_ghost_cells + idx_ghost] = V_ghost[k*(d_num_species + 4) + si]/rho_ghost;
                                 }
                                 
                                 for(int si=0; si < d_num_species; si++)
@@ -12014,22 +13518,47 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dFaceBoundaryData(
                                 Q[d_num_species + 1][idx_cell_mom] = rho_ghost*V_ghost[k*(d_num_species + 4) + d_num_species + 1];
                                 Q[d_num_species + 2][idx_cell_mom] = rho_ghost*V_ghost[k*(d_num_species + 4) + d_num_species + 2];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergy(
-                                        &rho_ghost,
-                                        &V_ghost[k*(d_num_species + 4) + d_num_species + 3],
-                                        Y_ghost_ptr);
-                                
-                                const double E = rho_ghost*epsilon +
-                                    half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                        Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                        Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                        rho_ghost;
+                                rho_ghosts[idx_ghost] = rho_ghost;
+                                p_ghosts[idx_ghost]   = V_ghost[k*(d_num_species + 4) + d_num_species + 3];
                                 
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    /*
+                     * Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                     */
+                    
+                    const double* Y_ghosts_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_ghosts_ptr[si] = &Y_ghosts[si*num_ghost_cells];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            Y_ghosts_ptr,
+                            d_num_species,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
                 }
                 
                 // Remove face locations that have boundary conditions identified.
@@ -12307,6 +13836,34 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                 
                 if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -12405,22 +13962,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
@@ -12439,52 +13983,111 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                     2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -12583,22 +14186,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
@@ -12617,52 +14207,111 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                     2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ZADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -12761,22 +14410,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
@@ -12795,52 +14431,115 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                     2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] + 
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -12939,93 +14638,155 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
-                                 * Set the values for partial densities, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -13124,93 +14885,155 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
-                                 * Set the values for partial densities, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ZISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -13309,87 +15132,117 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dEdgeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
-                                 * Set the values for partial densities, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
@@ -13645,6 +15498,34 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                 
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -13743,22 +15624,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
@@ -13777,52 +15645,111 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                     2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -13921,22 +15848,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
@@ -13955,52 +15869,111 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                     2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ZADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(2*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 5)*num_fill_cells);
+                    
+                    int* const idx_cell_mom_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -14099,22 +16072,9 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
@@ -14133,52 +16093,115 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                     2.0*rho_pivot*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = T_pivot;
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho_pivot,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho_pivot*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
-                                    rho_pivot;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho_pivot*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/
+                            rho_pivot;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -14277,93 +16300,155 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
-                                 * Set the values for partial densities, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -14462,93 +16547,155 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
-                                 * Set the values for partial densities, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ZISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize((d_num_species + 7)*num_fill_cells);
+                    
+                    int* const idx_cell_rho_Y_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_Y_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_E_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    double* const Y_pivot_fill = epsilon_fill + num_fill_cells;
+                    
+                    const double* Y_pivot_fill_ptr[d_num_species];
+                    for (int si = 0; si < d_num_species; si++)
+                    {
+                        Y_pivot_fill_ptr[si] = &Y_pivot_fill[si*num_fill_cells];
+                    }
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -14647,87 +16794,117 @@ FlowModelBoundaryUtilitiesFourEqnConservative::fill3dNodeBoundaryData(
                                  * Compute the mass fractions of the pivot.
                                  */
                                 
-                                std::vector<double> Y_pivot;
-                                Y_pivot.reserve(d_num_species);
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Y_pivot.push_back(Q[si][idx_cell_pivot_rho_Y]/rho_pivot);
-                                }
-                                
-                                /*
-                                 * Get the pointers to the mass fractions of the pivot.
-                                 */
-                                
-                                std::vector<const double*> Y_pivot_ptr;
-                                Y_pivot_ptr.reserve(d_num_species);
                                 for (int si = 0; si < d_num_species; si++)
                                 {
-                                    Y_pivot_ptr.push_back(&Y_pivot[si]);
+                                    Y_pivot_fill[si*num_fill_cells + count_fill] = Q[si][idx_cell_pivot_rho_Y]/rho_pivot;
                                 }
                                 
                                 /*
-                                 * Set the values for partial densities, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[d_num_species + 3][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[d_num_species + 3][idx_cell_pivot_E] -
                                     0.5*(Q[d_num_species][idx_cell_pivot_mom]*Q[d_num_species][idx_cell_pivot_mom] +
                                          Q[d_num_species + 1][idx_cell_pivot_mom]*Q[d_num_species + 1][idx_cell_pivot_mom] +
                                          Q[d_num_species + 2][idx_cell_pivot_mom]*Q[d_num_species + 2][idx_cell_pivot_mom])/
                                     rho_pivot)/rho_pivot;
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->
-                                    getPressure(
-                                        &rho_pivot,
-                                        &epsilon_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->
-                                    getTemperature(
-                                        &rho_pivot,
-                                        &p_pivot,
-                                        Y_pivot_ptr);
-                                
-                                double T = -T_pivot + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
-                                
-                                double rho = d_equation_of_state_mixing_rules->
-                                    getMixtureDensity(
-                                        &p,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
-                                double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
-                                double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
-                                    2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                                rho_pivot_fill[count_fill] = rho_pivot;
+                                idx_cell_rho_Y_fill[count_fill] = idx_cell_rho_Y;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                for (int si = 0; si < d_num_species; si++)
-                                {
-                                    Q[si][idx_cell_rho_Y] = rho*Y_pivot[si];
-                                }
-                                Q[d_num_species][idx_cell_mom] = rho*u;
-                                Q[d_num_species + 1][idx_cell_mom] = rho*v;
-                                Q[d_num_species + 2][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        Y_pivot_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
-                                         Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
-                                         Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
-                                
-                                Q[d_num_species + 3][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + 2.0*d_bdry_face_isothermal_no_slip_T[face_loc_2];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeMixtureDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            Y_pivot_fill_ptr,
+                            d_num_species,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho_Y = idx_cell_rho_Y_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        const double rho_pivot = rho_pivot_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for partial densities, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[d_num_species][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
+                        double v = -Q[d_num_species + 1][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
+                        double w = -Q[d_num_species + 2][idx_cell_pivot_mom]/rho_pivot +
+                            2.0*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        for (int si = 0; si < d_num_species; si++)
+                        {
+                            Q[si][idx_cell_rho_Y] = rho*Y_pivot_fill[si*num_fill_cells + idx_fill];
+                        }
+                        Q[d_num_species][idx_cell_mom] = rho*u;
+                        Q[d_num_species + 1][idx_cell_mom] = rho*v;
+                        Q[d_num_species + 2][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[d_num_species][idx_cell_mom]*Q[d_num_species][idx_cell_mom] +
+                                 Q[d_num_species + 1][idx_cell_mom]*Q[d_num_species + 1][idx_cell_mom] +
+                                 Q[d_num_species + 2][idx_cell_mom]*Q[d_num_species + 2][idx_cell_mom])/rho;
+                        
+                        Q[d_num_species + 3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
@@ -484,6 +484,76 @@ FlowModelFourEqnConservative::FlowModelFourEqnConservative(
 }
 
 
+/*
+ * Create a worker flow model for concurrent patch operations.
+ */
+HAMERS_SHARED_PTR<FlowModel>
+FlowModelFourEqnConservative::createWorkerFlowModel() const
+{
+    // Check whether a patch is registered.
+    if (d_patch)
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelFourEqnConservative::createWorkerFlowModel()\n"
+            << "Worker flow model cannot be created when a patch is registered."
+            << std::endl);
+    }
+    
+    /*
+     * Copy the flow model. The database, equation of state and mixing rules are shared with the
+     * worker and the static conservative variables are not re-created.
+     */
+    HAMERS_SHARED_PTR<FlowModelFourEqnConservative> worker_flow_model(new FlowModelFourEqnConservative(*this));
+    
+    /*
+     * Initialize Riemann solver object of the worker.
+     */
+    worker_flow_model->d_flow_model_riemann_solver.reset(new FlowModelRiemannSolverFourEqnConservative(
+        "d_flow_model_riemann_solver",
+        d_dim,
+        d_grid_geometry,
+        d_num_species));
+    
+    /*
+     * Initialize basic utilities object of the worker.
+     */
+    worker_flow_model->d_flow_model_basic_utilities.reset(new FlowModelBasicUtilitiesFourEqnConservative(
+        "d_flow_model_basic_utilities",
+        d_dim,
+        d_grid_geometry,
+        d_num_species,
+        d_equation_of_state_mixing_rules));
+    
+    /*
+     * Initialize diffusive flux utilities object of the worker.
+     */
+    worker_flow_model->d_flow_model_diffusive_flux_utilities.reset(new FlowModelDiffusiveFluxUtilitiesFourEqnConservative(
+        "d_flow_model_diffusive_flux_utilities",
+        d_dim,
+        d_grid_geometry,
+        d_num_species,
+        d_flow_model_db,
+        d_equation_of_mass_diffusivity_mixing_rules,
+        d_equation_of_shear_viscosity_mixing_rules,
+        d_equation_of_bulk_viscosity_mixing_rules,
+        d_equation_of_thermal_conductivity_mixing_rules));
+    
+    /*
+     * Initialize source utilities object of the worker.
+     */
+    worker_flow_model->d_flow_model_source_utilities.reset(new FlowModelSourceUtilitiesFourEqnConservative(
+        "d_flow_model_source_utilities",
+        d_project_name,
+        d_dim,
+        d_grid_geometry,
+        d_num_species,
+        d_flow_model_db,
+        d_equation_of_state_mixing_rules));
+    
+    return worker_flow_model;
+}
+
+
 /*
  * Print all characteristics of the flow model class.
  */
@@ -758,6 +828,13 @@ FlowModelFourEqnConservative::registerPatchWithDataContext(
             << std::endl);
     }
     
+    // Clear the cached cell data of derived variables if it is not for the patch and data context.
+    if (d_cached_patch &&
+        ((d_cached_patch != &patch) || (d_cached_data_context != data_context)))
+    {
+        clearDerivedCellData();
+    }
+    
     d_patch = &patch;
     
     setDataContext(data_context);
@@ -999,6 +1076,37 @@ FlowModelFourEqnConservative::unregisterPatch()
             << std::endl);
     }
     
+    /*
+     * Keep the cell data of derived variables if it is cached. Otherwise, clear it.
+     */
+    
+    if (isCachingDerivedCellData() && d_subdomain_box.empty())
+    {
+        d_cached_patch = d_patch;
+        d_cached_data_context = getDataContext();
+        
+        // Allow more derived variables to be registered with the cached cell data.
+        d_derived_cell_data_computed = false;
+    }
+    else
+    {
+        clearDerivedCellData();
+    }
+    
+    d_flow_model_diffusive_flux_utilities->clearCellAndSideData();
+    d_flow_model_source_utilities->clearCellData();
+    
+    d_patch = nullptr;
+    clearDataContext();
+}
+
+
+/*
+ * Clear the cell data of all derived variables and their numbers of sub-ghost cells.
+ */
+void
+FlowModelFourEqnConservative::clearDerivedCellData()
+{
     d_num_ghosts                       = -hier::IntVector::getOne(d_dim);
     d_num_subghosts_density            = -hier::IntVector::getOne(d_dim);
     d_num_subghosts_mass_fractions     = -hier::IntVector::getOne(d_dim);
@@ -1078,6 +1186,8 @@ FlowModelFourEqnConservative::unregisterPatch()
     d_data_max_wave_speed_y.reset();
     d_data_max_wave_speed_z.reset();
     d_data_max_diffusivity.reset();
+    d_data_sound_speed_gruneisen_parameter.reset();
+    d_data_sound_speed_partial_pressure_partial_partial_densities.reset();
     d_data_species_densities.assign(d_num_species, nullptr);
     d_data_species_enthalpies.assign(d_num_species, nullptr);
     
@@ -1100,13 +1210,10 @@ FlowModelFourEqnConservative::unregisterPatch()
     d_cell_data_computed_species_densities  = false;
     d_cell_data_computed_species_enthalpies = false;
     
-    d_flow_model_diffusive_flux_utilities->clearCellAndSideData();
-    d_flow_model_source_utilities->clearCellData();
-    
     d_derived_cell_data_computed = false;
     
-    d_patch = nullptr;
-    clearDataContext();
+    d_cached_patch = nullptr;
+    d_cached_data_context.reset();
 }
 
 
@@ -1118,6 +1225,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
 {
     if (d_num_subghosts_density > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_density &&
+            d_data_density->getGhostCellWidth() != d_num_subghosts_density)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_density.reset();
+            d_cell_data_computed_density = false;
+        }
+        
         if (!d_cell_data_computed_density)
         {
             if (!d_data_density)
@@ -1127,7 +1242,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_density));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1138,6 +1253,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_mass_fractions > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_mass_fractions &&
+            d_data_mass_fractions->getGhostCellWidth() != d_num_subghosts_mass_fractions)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_mass_fractions.reset();
+            d_cell_data_computed_mass_fractions = false;
+        }
+        
         if (!d_cell_data_computed_mass_fractions)
         {
             if (!d_data_mass_fractions)
@@ -1147,7 +1270,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, d_num_species, d_num_subghosts_mass_fractions));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1158,6 +1281,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_mole_fractions > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_mole_fractions &&
+            d_data_mole_fractions->getGhostCellWidth() != d_num_subghosts_mole_fractions)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_mole_fractions.reset();
+            d_cell_data_computed_mole_fractions = false;
+        }
+        
         if (!d_cell_data_computed_mole_fractions)
         {
             if (!d_data_mole_fractions)
@@ -1167,7 +1298,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, d_num_species, d_num_subghosts_mole_fractions));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1178,6 +1309,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_volume_fractions > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_volume_fractions &&
+            d_data_volume_fractions->getGhostCellWidth() != d_num_subghosts_volume_fractions)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_volume_fractions.reset();
+            d_cell_data_computed_volume_fractions = false;
+        }
+        
         if (!d_cell_data_computed_volume_fractions)
         {
             if (!d_data_volume_fractions)
@@ -1187,7 +1326,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, d_num_species, d_num_subghosts_volume_fractions));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1198,6 +1337,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_velocity > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_velocity &&
+            d_data_velocity->getGhostCellWidth() != d_num_subghosts_velocity)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_velocity.reset();
+            d_cell_data_computed_velocity = false;
+        }
+        
         if (!d_cell_data_computed_velocity)
         {
             if (!d_data_velocity)
@@ -1207,7 +1354,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, d_dim.getValue(), d_num_subghosts_velocity));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1218,6 +1365,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_internal_energy > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_internal_energy &&
+            d_data_internal_energy->getGhostCellWidth() != d_num_subghosts_internal_energy)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_internal_energy.reset();
+            d_cell_data_computed_internal_energy = false;
+        }
+        
         if (!d_cell_data_computed_internal_energy)
         {
             if (!d_data_internal_energy)
@@ -1227,7 +1382,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_internal_energy));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1238,6 +1393,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_pressure > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_pressure &&
+            d_data_pressure->getGhostCellWidth() != d_num_subghosts_pressure)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_pressure.reset();
+            d_cell_data_computed_pressure = false;
+        }
+        
         if (!d_cell_data_computed_pressure)
         {
             if (!d_data_pressure)
@@ -1247,7 +1410,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_pressure));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1258,6 +1421,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_sound_speed > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_sound_speed &&
+            d_data_sound_speed->getGhostCellWidth() != d_num_subghosts_sound_speed)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_sound_speed.reset();
+            d_cell_data_computed_sound_speed = false;
+        }
+        
         if (!d_cell_data_computed_sound_speed)
         {
             if (!d_data_sound_speed)
@@ -1267,7 +1438,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_sound_speed));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1278,6 +1449,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_temperature > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_temperature &&
+            d_data_temperature->getGhostCellWidth() != d_num_subghosts_temperature)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_temperature.reset();
+            d_cell_data_computed_temperature = false;
+        }
+        
         if (!d_cell_data_computed_temperature)
         {
             if (!d_data_temperature)
@@ -1287,7 +1466,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_temperature));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1298,6 +1477,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_convective_flux_x > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_convective_flux_x &&
+            d_data_convective_flux_x->getGhostCellWidth() != d_num_subghosts_convective_flux_x)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_convective_flux_x.reset();
+            d_cell_data_computed_convective_flux_x = false;
+        }
+        
         if (!d_cell_data_computed_convective_flux_x)
         {
             if (!d_data_convective_flux_x)
@@ -1307,7 +1494,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, d_num_eqn, d_num_subghosts_convective_flux_x));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1318,6 +1505,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_convective_flux_y > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_convective_flux_y &&
+            d_data_convective_flux_y->getGhostCellWidth() != d_num_subghosts_convective_flux_y)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_convective_flux_y.reset();
+            d_cell_data_computed_convective_flux_y = false;
+        }
+        
         if (!d_cell_data_computed_convective_flux_y)
         {
             if (!d_data_convective_flux_y)
@@ -1327,7 +1522,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, d_num_eqn, d_num_subghosts_convective_flux_y));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1338,6 +1533,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_convective_flux_z > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_convective_flux_z &&
+            d_data_convective_flux_z->getGhostCellWidth() != d_num_subghosts_convective_flux_z)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_convective_flux_z.reset();
+            d_cell_data_computed_convective_flux_z = false;
+        }
+        
         if (!d_cell_data_computed_convective_flux_z)
         {
             if (!d_data_convective_flux_z)
@@ -1347,7 +1550,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, d_num_eqn, d_num_subghosts_convective_flux_z));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1358,6 +1561,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_max_wave_speed_x > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_max_wave_speed_x &&
+            d_data_max_wave_speed_x->getGhostCellWidth() != d_num_subghosts_max_wave_speed_x)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_max_wave_speed_x.reset();
+            d_cell_data_computed_max_wave_speed_x = false;
+        }
+        
         if (!d_cell_data_computed_max_wave_speed_x)
         {
             if (!d_data_max_wave_speed_x)
@@ -1367,7 +1578,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_max_wave_speed_x));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1378,6 +1589,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_max_wave_speed_y > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_max_wave_speed_y &&
+            d_data_max_wave_speed_y->getGhostCellWidth() != d_num_subghosts_max_wave_speed_y)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_max_wave_speed_y.reset();
+            d_cell_data_computed_max_wave_speed_y = false;
+        }
+        
         if (!d_cell_data_computed_max_wave_speed_y)
         {
             if (!d_data_max_wave_speed_y)
@@ -1387,7 +1606,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_max_wave_speed_y));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1398,6 +1617,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_max_wave_speed_z > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_max_wave_speed_z &&
+            d_data_max_wave_speed_z->getGhostCellWidth() != d_num_subghosts_max_wave_speed_z)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_max_wave_speed_z.reset();
+            d_cell_data_computed_max_wave_speed_z = false;
+        }
+        
         if (!d_cell_data_computed_max_wave_speed_z)
         {
             if (!d_data_max_wave_speed_z)
@@ -1407,7 +1634,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_max_wave_speed_z));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1418,6 +1645,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_max_diffusivity > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_max_diffusivity &&
+            d_data_max_diffusivity->getGhostCellWidth() != d_num_subghosts_max_diffusivity)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_max_diffusivity.reset();
+            d_cell_data_computed_max_diffusivity = false;
+        }
+        
         if (!d_cell_data_computed_max_diffusivity)
         {
             if (!d_data_max_diffusivity)
@@ -1427,7 +1662,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_max_diffusivity));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1438,6 +1673,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_species_densities > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_species_densities &&
+            d_data_species_densities[0]->getGhostCellWidth() != d_num_subghosts_species_densities)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_species_densities.assign(d_num_species, nullptr);
+            d_cell_data_computed_species_densities = false;
+        }
+        
         if (!d_cell_data_computed_species_densities)
         {
             // Create the cell data of species densities.
@@ -1450,7 +1693,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                 }
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1461,6 +1704,14 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
     
     if (d_num_subghosts_species_enthalpies > -hier::IntVector::getOne(d_dim))
     {
+        if (d_cell_data_computed_species_enthalpies &&
+            d_data_species_enthalpies[0]->getGhostCellWidth() != d_num_subghosts_species_enthalpies)
+        {
+            // The cached cell data has fewer sub-ghost cells than required and is computed again.
+            d_data_species_enthalpies.assign(d_num_species, nullptr);
+            d_cell_data_computed_species_enthalpies = false;
+        }
+        
         if (!d_cell_data_computed_species_enthalpies)
         {
             // Create the cell data of species enthalpies.
@@ -1470,7 +1721,7 @@ FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()
                     new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_species_enthalpies));
             }
         }
-        else
+        else if (!isCachingDerivedCellData())
         {
             TBOX_ERROR(d_object_name
                 << ": FlowModelFourEqnConservative::allocateMemoryForDerivedCellData()\n"
@@ -1504,6 +1755,15 @@ FlowModelFourEqnConservative::computeDerivedCellData()
         setDerivedCellVariableGhostBoxes();
     }
     
+    /*
+     * Compute the cell data of the common derived variables in a single pass over the cells if
+     * the whole patch is computed. The remaining derived variables are computed one by one below.
+     */
+    if (d_use_single_pass_derived_cell_data && d_subdomain_box.empty())
+    {
+        computeDerivedCellDataInSinglePass();
+    }
+    
     // Compute the total density cell data.
     if (d_num_subghosts_density > -hier::IntVector::getOne(d_dim))
     {
@@ -3871,244 +4131,443 @@ FlowModelFourEqnConservative::getCellDataOfTotalEnergy()
 
 
 /*
- * Compute the cell data of density in the registered patch.
+ * Compute the cell data of the registered derived variables that are not yet computed tile by tile
+ * in a single pass over the cells of the registered patch. Each tile is small enough that the
+ * conservative variables and the derived cell data on the tile stay in cache while all the derived
+ * variables are computed, instead of streaming the whole patch once per derived variable.
  */
 void
-FlowModelFourEqnConservative::computeCellDataOfDensity(
-    const hier::Box& domain)
+FlowModelFourEqnConservative::computeDerivedCellDataInSinglePass()
 {
-    if (d_num_subghosts_density > -hier::IntVector::getOne(d_dim))
+    const hier::IntVector num_subghosts_unregistered = -hier::IntVector::getOne(d_dim);
+    
+    /*
+     * Determine the derived variables computed in the single pass.
+     */
+    
+    const bool compute_density = (d_num_subghosts_density > num_subghosts_unregistered) &&
+        !d_cell_data_computed_density;
+    
+    const bool compute_mass_fractions = (d_num_subghosts_mass_fractions > num_subghosts_unregistered) &&
+        !d_cell_data_computed_mass_fractions;
+    
+    const bool compute_velocity = (d_num_subghosts_velocity > num_subghosts_unregistered) &&
+        !d_cell_data_computed_velocity;
+    
+    const bool compute_internal_energy = (d_num_subghosts_internal_energy > num_subghosts_unregistered) &&
+        !d_cell_data_computed_internal_energy;
+    
+    const bool compute_pressure = (d_num_subghosts_pressure > num_subghosts_unregistered) &&
+        !d_cell_data_computed_pressure;
+    
+    const bool compute_sound_speed = (d_num_subghosts_sound_speed > num_subghosts_unregistered) &&
+        !d_cell_data_computed_sound_speed;
+    
+    const bool compute_temperature = (d_num_subghosts_temperature > num_subghosts_unregistered) &&
+        !d_cell_data_computed_temperature;
+    
+    const bool compute_convective_flux_x = (d_num_subghosts_convective_flux_x > num_subghosts_unregistered) &&
+        !d_cell_data_computed_convective_flux_x;
+    
+    const bool compute_convective_flux_y = (d_num_subghosts_convective_flux_y > num_subghosts_unregistered) &&
+        !d_cell_data_computed_convective_flux_y;
+    
+    const bool compute_convective_flux_z = (d_num_subghosts_convective_flux_z > num_subghosts_unregistered) &&
+        !d_cell_data_computed_convective_flux_z;
+    
+    const bool compute_max_wave_speed_x = (d_num_subghosts_max_wave_speed_x > num_subghosts_unregistered) &&
+        !d_cell_data_computed_max_wave_speed_x;
+    
+    const bool compute_max_wave_speed_y = (d_num_subghosts_max_wave_speed_y > num_subghosts_unregistered) &&
+        !d_cell_data_computed_max_wave_speed_y;
+    
+    const bool compute_max_wave_speed_z = (d_num_subghosts_max_wave_speed_z > num_subghosts_unregistered) &&
+        !d_cell_data_computed_max_wave_speed_z;
+    
+    /*
+     * Get the box covering all the derived cell data computed in the single pass and the number of
+     * variables on each cell.
+     */
+    
+    hier::Box pass_box = hier::Box::getEmptyBox(d_dim);
+    int num_derived_variables = 0;
+    int num_variables = d_num_eqn;
+    
+    if (compute_density)
     {
-        if (!d_cell_data_computed_density)
-        {
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-            TBOX_ASSERT(d_data_density);
-#endif
-            // Get the cell data of the variable partial densities.
-            HAMERS_SHARED_PTR<pdat::CellData<double> > data_partial_densities =
-                getCellDataOfPartialDensities();
-            
-            // Compute the density field.
-            d_equation_of_state_mixing_rules->computeMixtureDensity(
-                d_data_density,
-                data_partial_densities,
-                domain);
-            
-            d_cell_data_computed_density = true;
-        }
+        pass_box += d_subghost_box_density;
+        num_derived_variables++;
+        num_variables++;
     }
-    else
+    
+    if (compute_mass_fractions)
     {
-        TBOX_ERROR(d_object_name
-            << ": FlowModelFourEqnConservative::computeCellDataOfDensity()\n"
-            << "Cell data of 'DENSITY' is not yet registered."
-            << std::endl);
+        pass_box += d_subghost_box_mass_fractions;
+        num_derived_variables++;
+        num_variables += d_num_species;
     }
-}
-
-
-/*
- * Compute the cell data of mass fractions with density in the registered patch.
- */
-void
-FlowModelFourEqnConservative::computeCellDataOfMassFractionsWithDensity(
-    const hier::Box& domain)
-{
-    if (d_num_subghosts_mass_fractions > -hier::IntVector::getOne(d_dim))
+    
+    if (compute_velocity)
     {
-        if (!d_cell_data_computed_mass_fractions)
-        {
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-            TBOX_ASSERT(d_data_mass_fractions);
-#endif
-            
-            /*
-             * Get the local lower index and number of cells in each direction of the domain.
-             */
-            
-            hier::IntVector domain_lo(d_dim);
-            hier::IntVector domain_dims(d_dim);
-            
-            if (domain.empty())
-            {
-                domain_lo = -d_num_subghosts_mass_fractions;
-                domain_dims = d_subghostcell_dims_mass_fractions;
-            }
-            else
-            {
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-                TBOX_ASSERT(d_subghost_box_mass_fractions.contains(domain));
-#endif
-                
-                domain_lo = domain.lower() - d_interior_box.lower();
-                domain_dims = domain.numberCells();
-            }
-            
-            // Get the cell data of the variable partial densities.
-            HAMERS_SHARED_PTR<pdat::CellData<double> > data_partial_densities =
-                getCellDataOfPartialDensities();
-            
-            if (!d_cell_data_computed_density)
-            {
-                computeCellDataOfDensity(domain);
-            }
-            
-            // Get the pointers to the cell data of mass fractions, denisty and partial densities.
-            std::vector<double*> Y;
-            Y.reserve(d_num_species);
-            for (int si = 0; si < d_num_species; si++)
+        pass_box += d_subghost_box_velocity;
+        num_derived_variables++;
+        num_variables += d_dim.getValue();
+    }
+    
+    if (compute_internal_energy)
+    {
+        pass_box += d_subghost_box_internal_energy;
+        num_derived_variables++;
+        num_variables++;
+    }
+    
+    if (compute_pressure)
+    {
+        pass_box += d_subghost_box_pressure;
+        num_derived_variables++;
+        num_variables++;
+    }
+    
+    if (compute_sound_speed)
+    {
+        pass_box += d_subghost_box_sound_speed;
+        num_derived_variables++;
+        num_variables++;
+    }
+    
+    if (compute_temperature)
+    {
+        pass_box += d_subghost_box_temperature;
+        num_derived_variables++;
+        num_variables++;
+    }
+    
+    if (compute_convective_flux_x)
+    {
+        pass_box += d_subghost_box_convective_flux_x;
+        num_derived_variables++;
+        num_variables += d_num_eqn;
+    }
+    
+    if (compute_convective_flux_y)
+    {
+        pass_box += d_subghost_box_convective_flux_y;
+        num_derived_variables++;
+        num_variables += d_num_eqn;
+    }
+    
+    if (compute_convective_flux_z)
+    {
+        pass_box += d_subghost_box_convective_flux_z;
+        num_derived_variables++;
+        num_variables += d_num_eqn;
+    }
+    
+    if (compute_max_wave_speed_x)
+    {
+        pass_box += d_subghost_box_max_wave_speed_x;
+        num_derived_variables++;
+        num_variables++;
+    }
+    
+    if (compute_max_wave_speed_y)
+    {
+        pass_box += d_subghost_box_max_wave_speed_y;
+        num_derived_variables++;
+        num_variables++;
+    }
+    
+    if (compute_max_wave_speed_z)
+    {
+        pass_box += d_subghost_box_max_wave_speed_z;
+        num_derived_variables++;
+        num_variables++;
+    }
+    
+    // Nothing is gained from the single pass if there is at most one derived variable to compute.
+    if (num_derived_variables < 2)
+    {
+        return;
+    }
+    
+    std::vector<hier::Box> tiles;
+    getTilesOfDerivedCellData(tiles, pass_box, num_variables);
+    
+    for (int ti = 0; ti < static_cast<int>(tiles.size()); ti++)
+    {
+        const hier::Box& tile = tiles[ti];
+        
+        /*
+         * Compute the derived variables on the part of the tile inside their ghost boxes in the order
+         * of their dependencies. The ghost box of a derived variable is contained in the ghost boxes of
+         * the derived variables it depends on.
+         */
+        
+        if (compute_density)
+        {
+            const hier::Box domain = tile*d_subghost_box_density;
+            if (!domain.empty())
             {
-                Y.push_back(d_data_mass_fractions->getPointer(si));
+                computeCellDataOfDensity(domain);
             }
-            double* rho = d_data_density->getPointer(0);
-            std::vector<double*> rho_Y;
-            rho_Y.reserve(d_num_species);
-            for (int si = 0; si < d_num_species; si++)
+        }
+        
+        if (compute_mass_fractions)
+        {
+            const hier::Box domain = tile*d_subghost_box_mass_fractions;
+            if (!domain.empty())
             {
-                rho_Y.push_back(data_partial_densities->getPointer(si));
+                computeCellDataOfMassFractionsWithDensity(domain);
             }
-            
-            if (d_dim == tbox::Dimension(1))
+        }
+        
+        if (compute_velocity)
+        {
+            const hier::Box domain = tile*d_subghost_box_velocity;
+            if (!domain.empty())
             {
-                /*
-                 * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_dim_0 = domain_dims[0];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_0_mass_fractions = d_num_subghosts_mass_fractions[0];
-                
-                // Compute the mass fraction field.
-                for (int si = 0; si < d_num_species; si++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = i + num_ghosts_0;
-                        const int idx_density = i + num_subghosts_0_density;
-                        const int idx_mass_fractions = i + num_subghosts_0_mass_fractions;
-                        
-                        Y[si][idx_mass_fractions] = rho_Y[si][idx]/rho[idx_density];
-                    }
-                }
+                computeCellDataOfVelocityWithDensity(domain);
             }
-            else if (d_dim == tbox::Dimension(2))
+        }
+        
+        if (compute_internal_energy)
+        {
+            const hier::Box domain = tile*d_subghost_box_internal_energy;
+            if (!domain.empty())
             {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_ghosts_1 = d_num_ghosts[1];
-                const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                
-                const int num_subghosts_0_mass_fractions = d_num_subghosts_mass_fractions[0];
-                const int num_subghosts_1_mass_fractions = d_num_subghosts_mass_fractions[1];
-                const int subghostcell_dim_0_mass_fractions = d_subghostcell_dims_mass_fractions[0];
-                
-                // Compute the mass fraction field.
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
+                computeCellDataOfInternalEnergyWithDensityAndVelocity(domain);
+            }
+        }
+        
+        if (compute_pressure)
+        {
+            const hier::Box domain = tile*d_subghost_box_pressure;
+            if (!domain.empty())
+            {
+                computeCellDataOfPressureWithDensityMassFractionsAndInternalEnergy(domain);
+            }
+        }
+        
+        if (compute_sound_speed)
+        {
+            const hier::Box domain = tile*d_subghost_box_sound_speed;
+            if (!domain.empty())
+            {
+                computeCellDataOfSoundSpeedWithDensityMassFractionsAndPressure(domain);
+            }
+        }
+        
+        if (compute_temperature)
+        {
+            const hier::Box domain = tile*d_subghost_box_temperature;
+            if (!domain.empty())
+            {
+                computeCellDataOfTemperatureWithDensityMassFractionsAndPressure(domain);
+            }
+        }
+        
+        if (compute_convective_flux_x)
+        {
+            const hier::Box domain = tile*d_subghost_box_convective_flux_x;
+            if (!domain.empty())
+            {
+                computeCellDataOfConvectiveFluxWithVelocityAndPressure(DIRECTION::X_DIRECTION, domain);
+            }
+        }
+        
+        if (compute_convective_flux_y)
+        {
+            const hier::Box domain = tile*d_subghost_box_convective_flux_y;
+            if (!domain.empty())
+            {
+                computeCellDataOfConvectiveFluxWithVelocityAndPressure(DIRECTION::Y_DIRECTION, domain);
+            }
+        }
+        
+        if (compute_convective_flux_z)
+        {
+            const hier::Box domain = tile*d_subghost_box_convective_flux_z;
+            if (!domain.empty())
+            {
+                computeCellDataOfConvectiveFluxWithVelocityAndPressure(DIRECTION::Z_DIRECTION, domain);
+            }
+        }
+        
+        if (compute_max_wave_speed_x)
+        {
+            const hier::Box domain = tile*d_subghost_box_max_wave_speed_x;
+            if (!domain.empty())
+            {
+                computeCellDataOfMaxWaveSpeedWithVelocityAndSoundSpeed(DIRECTION::X_DIRECTION, domain);
+            }
+        }
+        
+        if (compute_max_wave_speed_y)
+        {
+            const hier::Box domain = tile*d_subghost_box_max_wave_speed_y;
+            if (!domain.empty())
+            {
+                computeCellDataOfMaxWaveSpeedWithVelocityAndSoundSpeed(DIRECTION::Y_DIRECTION, domain);
+            }
+        }
+        
+        if (compute_max_wave_speed_z)
+        {
+            const hier::Box domain = tile*d_subghost_box_max_wave_speed_z;
+            if (!domain.empty())
+            {
+                computeCellDataOfMaxWaveSpeedWithVelocityAndSoundSpeed(DIRECTION::Z_DIRECTION, domain);
+            }
+        }
+        
+        /*
+         * The cell data is only computed on the tile. Mark it as not computed so that it is computed
+         * on the next tile.
+         */
+        
+        d_cell_data_computed_density           &= !compute_density;
+        d_cell_data_computed_mass_fractions    &= !compute_mass_fractions;
+        d_cell_data_computed_velocity          &= !compute_velocity;
+        d_cell_data_computed_internal_energy   &= !compute_internal_energy;
+        d_cell_data_computed_pressure          &= !compute_pressure;
+        d_cell_data_computed_sound_speed       &= !compute_sound_speed;
+        d_cell_data_computed_temperature       &= !compute_temperature;
+        d_cell_data_computed_convective_flux_x &= !compute_convective_flux_x;
+        d_cell_data_computed_convective_flux_y &= !compute_convective_flux_y;
+        d_cell_data_computed_convective_flux_z &= !compute_convective_flux_z;
+        d_cell_data_computed_max_wave_speed_x  &= !compute_max_wave_speed_x;
+        d_cell_data_computed_max_wave_speed_y  &= !compute_max_wave_speed_y;
+        d_cell_data_computed_max_wave_speed_z  &= !compute_max_wave_speed_z;
+    }
+    
+    d_cell_data_computed_density           |= compute_density;
+    d_cell_data_computed_mass_fractions    |= compute_mass_fractions;
+    d_cell_data_computed_velocity          |= compute_velocity;
+    d_cell_data_computed_internal_energy   |= compute_internal_energy;
+    d_cell_data_computed_pressure          |= compute_pressure;
+    d_cell_data_computed_sound_speed       |= compute_sound_speed;
+    d_cell_data_computed_temperature       |= compute_temperature;
+    d_cell_data_computed_convective_flux_x |= compute_convective_flux_x;
+    d_cell_data_computed_convective_flux_y |= compute_convective_flux_y;
+    d_cell_data_computed_convective_flux_z |= compute_convective_flux_z;
+    d_cell_data_computed_max_wave_speed_x  |= compute_max_wave_speed_x;
+    d_cell_data_computed_max_wave_speed_y  |= compute_max_wave_speed_y;
+    d_cell_data_computed_max_wave_speed_z  |= compute_max_wave_speed_z;
+}
+
+/*
+ * Compute the cell data of density in the registered patch.
+ */
+void
+FlowModelFourEqnConservative::computeCellDataOfDensity(
+    const hier::Box& domain)
+{
+    if (d_num_subghosts_density > -hier::IntVector::getOne(d_dim))
+    {
+        if (!d_cell_data_computed_density)
+        {
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+            TBOX_ASSERT(d_data_density);
 #endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0;
-                            
-                            const int idx_density = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density;
-                            
-                            const int idx_mass_fractions = (i + num_subghosts_0_mass_fractions) +
-                                (j + num_subghosts_1_mass_fractions)*subghostcell_dim_0_mass_fractions;
-                            
-                            Y[si][idx_mass_fractions] = rho_Y[si][idx]/rho[idx_density];
-                        }
-                    }
-                }
+            // Get the cell data of the variable partial densities.
+            HAMERS_SHARED_PTR<pdat::CellData<double> > data_partial_densities =
+                getCellDataOfPartialDensities();
+            
+            // Compute the density field.
+            d_equation_of_state_mixing_rules->computeMixtureDensity(
+                d_data_density,
+                data_partial_densities,
+                domain);
+            
+            d_cell_data_computed_density = true;
+        }
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name
+            << ": FlowModelFourEqnConservative::computeCellDataOfDensity()\n"
+            << "Cell data of 'DENSITY' is not yet registered."
+            << std::endl);
+    }
+}
+
+
+/*
+ * Compute the cell data of mass fractions with density in the registered patch.
+ */
+void
+FlowModelFourEqnConservative::computeCellDataOfMassFractionsWithDensity(
+    const hier::Box& domain)
+{
+    if (d_num_subghosts_mass_fractions > -hier::IntVector::getOne(d_dim))
+    {
+        if (!d_cell_data_computed_mass_fractions)
+        {
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+            TBOX_ASSERT(d_data_mass_fractions);
+#endif
+            
+            /*
+             * Get the local lower index and number of cells in each direction of the domain.
+             */
+            
+            hier::IntVector domain_lo(d_dim);
+            hier::IntVector domain_dims(d_dim);
+            
+            if (domain.empty())
+            {
+                domain_lo = -d_num_subghosts_mass_fractions;
+                domain_dims = d_subghostcell_dims_mass_fractions;
             }
-            else if (d_dim == tbox::Dimension(3))
+            else
             {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_lo_2 = domain_lo[2];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                const int domain_dim_2 = domain_dims[2];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_ghosts_1 = d_num_ghosts[1];
-                const int num_ghosts_2 = d_num_ghosts[2];
-                const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                const int ghostcell_dim_1 = d_ghostcell_dims[1];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int num_subghosts_2_density = d_num_subghosts_density[2];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                const int subghostcell_dim_1_density = d_subghostcell_dims_density[1];
-                
-                const int num_subghosts_0_mass_fractions = d_num_subghosts_mass_fractions[0];
-                const int num_subghosts_1_mass_fractions = d_num_subghosts_mass_fractions[1];
-                const int num_subghosts_2_mass_fractions = d_num_subghosts_mass_fractions[2];
-                const int subghostcell_dim_0_mass_fractions = d_subghostcell_dims_mass_fractions[0];
-                const int subghostcell_dim_1_mass_fractions = d_subghostcell_dims_mass_fractions[1];
-                
-                // Compute the mass fraction field.
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+                TBOX_ASSERT(d_subghost_box_mass_fractions.contains(domain));
 #endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                                
-                                const int idx_density = (i + num_subghosts_0_density) +
-                                    (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                    (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                        subghostcell_dim_1_density;
-                                
-                                const int idx_mass_fractions = (i + num_subghosts_0_mass_fractions) +
-                                    (j + num_subghosts_1_mass_fractions)*subghostcell_dim_0_mass_fractions +
-                                    (k + num_subghosts_2_mass_fractions)*subghostcell_dim_0_mass_fractions*
-                                        subghostcell_dim_1_mass_fractions;
-                                
-                                Y[si][idx_mass_fractions] = rho_Y[si][idx]/rho[idx_density];
-                            }
-                        }
-                    }
-                }
+                
+                domain_lo = domain.lower() - d_interior_box.lower();
+                domain_dims = domain.numberCells();
+            }
+            
+            // Get the cell data of the variable partial densities.
+            HAMERS_SHARED_PTR<pdat::CellData<double> > data_partial_densities =
+                getCellDataOfPartialDensities();
+            
+            if (!d_cell_data_computed_density)
+            {
+                computeCellDataOfDensity(domain);
+            }
+            
+            // Get the pointers to the cell data of mass fractions, denisty and partial densities.
+            std::vector<double*> Y;
+            Y.reserve(d_num_species);
+            for (int si = 0; si < d_num_species; si++)
+            {
+                Y.push_back(d_data_mass_fractions->getPointer(si));
+            }
+            double* rho = d_data_density->getPointer(0);
+            std::vector<double*> rho_Y;
+            rho_Y.reserve(d_num_species);
+            for (int si = 0; si < d_num_species; si++)
+            {
+                rho_Y.push_back(data_partial_densities->getPointer(si));
+            }
+            
+            // Compute the mass fraction field.
+            for (int si = 0; si < d_num_species; si++)
+            {
+                computeCellDataOfQuotient(
+                    Y[si],
+                    rho_Y[si],
+                    rho,
+                    d_num_subghosts_mass_fractions,
+                    d_num_ghosts,
+                    d_num_subghosts_density,
+                    d_subghostcell_dims_mass_fractions,
+                    d_ghostcell_dims,
+                    d_subghostcell_dims_density,
+                    domain_lo,
+                    domain_dims);
             }
             
             d_cell_data_computed_mass_fractions = true;
@@ -4611,167 +5070,31 @@ FlowModelFourEqnConservative::computeCellDataOfVelocityWithDensity(
             // Get the pointer to the cell data of density.
             double* rho = d_data_density->getPointer(0);
             
-            if (d_dim == tbox::Dimension(1))
-            {
-                /*
-                 * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_dim_0 = domain_dims[0];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                
-                // Get the pointer to the cell data of velocity.
-                double* u = d_data_velocity->getPointer(0);
-                
-                // Get the pointer to the cell data of momentum.
-                double* rho_u = data_momentum->getPointer(0);
-                
-                // Compute the velocity field.
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = i + num_ghosts_0;
-                    const int idx_density = i + num_subghosts_0_density;
-                    const int idx_velocity = i + num_subghosts_0_velocity;
-                    
-                    u[idx_velocity] = rho_u[idx]/rho[idx_density];
-                }
-            }
-            else if (d_dim == tbox::Dimension(2))
-            {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_ghosts_1 = d_num_ghosts[1];
-                const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                
-                const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                
-                // Get the pointers to the cell data of velocity.
-                double* u = d_data_velocity->getPointer(0);
-                double* v = d_data_velocity->getPointer(1);
-                
-                // Get the pointers to the cell data of momentum.
-                double* rho_u = data_momentum->getPointer(0);
-                double* rho_v = data_momentum->getPointer(1);
-                
-                // Compute the velocity field.
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = (i + num_ghosts_0) +
-                            (j + num_ghosts_1)*ghostcell_dim_0;
-                        
-                        const int idx_density = (i + num_subghosts_0_density) +
-                            (j + num_subghosts_1_density)*subghostcell_dim_0_density;
-                        
-                        const int idx_velocity = (i + num_subghosts_0_velocity) +
-                            (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                        
-                        u[idx_velocity] = rho_u[idx]/rho[idx_density];
-                        v[idx_velocity] = rho_v[idx]/rho[idx_density];
-                    }
-                }
-            }
-            else if (d_dim == tbox::Dimension(3))
+            // Get the pointers to the cell data of velocity and momentum.
+            std::vector<double*> u;
+            std::vector<const double*> rho_u;
+            u.reserve(d_dim.getValue());
+            rho_u.reserve(d_dim.getValue());
+            for (int di = 0; di < d_dim.getValue(); di++)
             {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_lo_2 = domain_lo[2];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                const int domain_dim_2 = domain_dims[2];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_ghosts_1 = d_num_ghosts[1];
-                const int num_ghosts_2 = d_num_ghosts[2];
-                const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                const int ghostcell_dim_1 = d_ghostcell_dims[1];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int num_subghosts_2_density = d_num_subghosts_density[2];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                const int subghostcell_dim_1_density = d_subghostcell_dims_density[1];
-                
-                const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                
-                // Get the pointers to the cell data of velocity.
-                double* u = d_data_velocity->getPointer(0);
-                double* v = d_data_velocity->getPointer(1);
-                double* w = d_data_velocity->getPointer(2);
-                
-                // Get the pointers to the cell data of momentum.
-                double* rho_u = data_momentum->getPointer(0);
-                double* rho_v = data_momentum->getPointer(1);
-                double* rho_w = data_momentum->getPointer(2);
-                
-                // Compute the velocity field.
-                for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                {
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0 +
-                                (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                            
-                            const int idx_density = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                    subghostcell_dim_1_velocity;
-                            
-                            u[idx_velocity] = rho_u[idx]/rho[idx_density];
-                            v[idx_velocity] = rho_v[idx]/rho[idx_density];
-                            w[idx_velocity] = rho_w[idx]/rho[idx_density];
-                        }
-                    }
-                }
+                u.push_back(d_data_velocity->getPointer(di));
+                rho_u.push_back(data_momentum->getPointer(di));
             }
             
+            // Compute the velocity field.
+            computeCellDataOfVelocityFromMomentum(
+                u,
+                rho_u,
+                rho,
+                d_num_subghosts_velocity,
+                d_num_ghosts,
+                d_num_subghosts_density,
+                d_subghostcell_dims_velocity,
+                d_ghostcell_dims,
+                d_subghostcell_dims_density,
+                domain_lo,
+                domain_dims);
+            
             d_cell_data_computed_velocity = true;
         }
     }
@@ -4841,177 +5164,32 @@ FlowModelFourEqnConservative::computeCellDataOfInternalEnergyWithDensityAndVeloc
             double* epsilon = d_data_internal_energy->getPointer(0);
             double* E = data_total_energy->getPointer(0);
             double* rho = d_data_density->getPointer(0);
-            
-            if (d_dim == tbox::Dimension(1))
-            {
-                /*
-                 * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_dim_0 = domain_dims[0];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                const int num_subghosts_0_internal_energy = d_num_subghosts_internal_energy[0];
-                
-                // Get the pointer to cell data of velocity.
-                double* u = d_data_velocity->getPointer(0);
-                
-                // Compute the internal energy field.
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx = i + num_ghosts_0;
-                    const int idx_density = i + num_subghosts_0_density;
-                    const int idx_velocity = i + num_subghosts_0_velocity;
-                    const int idx_internal_energy = i + num_subghosts_0_internal_energy;
-                    
-                    epsilon[idx_internal_energy] = E[idx]/rho[idx_density] -
-                        double(1)/double(2)*u[idx_velocity]*u[idx_velocity];
-                }
-            }
-            else if (d_dim == tbox::Dimension(2))
-            {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_ghosts_1 = d_num_ghosts[1];
-                const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                
-                const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                
-                const int num_subghosts_0_internal_energy = d_num_subghosts_internal_energy[0];
-                const int num_subghosts_1_internal_energy = d_num_subghosts_internal_energy[1];
-                const int subghostcell_dim_0_internal_energy = d_subghostcell_dims_internal_energy[0];
-                
-                // Get the pointers to the cell data of velocity.
-                double* u = d_data_velocity->getPointer(0);
-                double* v = d_data_velocity->getPointer(1);
-                
-                // Compute the internal energy field.
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = (i + num_ghosts_0) +
-                            (j + num_ghosts_1)*ghostcell_dim_0;
-                        
-                        const int idx_density = (i + num_subghosts_0_density) +
-                            (j + num_subghosts_1_density)*subghostcell_dim_0_density;
-                        
-                        const int idx_velocity = (i + num_subghosts_0_velocity) +
-                            (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                        
-                        const int idx_internal_energy = (i + num_subghosts_0_internal_energy) +
-                            (j + num_subghosts_1_internal_energy)*subghostcell_dim_0_internal_energy;
-                        
-                        epsilon[idx_internal_energy] = E[idx]/rho[idx_density] -
-                            double(1)/double(2)*(u[idx_velocity]*u[idx_velocity] + v[idx_velocity]*v[idx_velocity]);
-                    }
-                }
-            }
-            else if (d_dim == tbox::Dimension(3))
-            {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_lo_2 = domain_lo[2];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                const int domain_dim_2 = domain_dims[2];
-                
-                const int num_ghosts_0 = d_num_ghosts[0];
-                const int num_ghosts_1 = d_num_ghosts[1];
-                const int num_ghosts_2 = d_num_ghosts[2];
-                const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                const int ghostcell_dim_1 = d_ghostcell_dims[1];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int num_subghosts_2_density = d_num_subghosts_density[2];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                const int subghostcell_dim_1_density = d_subghostcell_dims_density[1];
-                
-                const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                
-                const int num_subghosts_0_internal_energy = d_num_subghosts_internal_energy[0];
-                const int num_subghosts_1_internal_energy = d_num_subghosts_internal_energy[1];
-                const int num_subghosts_2_internal_energy = d_num_subghosts_internal_energy[2];
-                const int subghostcell_dim_0_internal_energy = d_subghostcell_dims_internal_energy[0];
-                const int subghostcell_dim_1_internal_energy = d_subghostcell_dims_internal_energy[1];
-                
-                // Get the pointers to the cell data of velocity.
-                double* u = d_data_velocity->getPointer(0);
-                double* v = d_data_velocity->getPointer(1);
-                double* w = d_data_velocity->getPointer(2);
-                
-                // Compute the internal energy field.
-                for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                {
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = (i + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0 +
-                                (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                            
-                            const int idx_density = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                    subghostcell_dim_1_velocity;
-                            
-                            const int idx_internal_energy = (i + num_subghosts_0_internal_energy) +
-                                (j + num_subghosts_1_internal_energy)*subghostcell_dim_0_internal_energy +
-                                (k + num_subghosts_2_internal_energy)*subghostcell_dim_0_internal_energy*
-                                    subghostcell_dim_1_internal_energy;
-                            
-                            epsilon[idx_internal_energy] = E[idx]/rho[idx_density] -
-                                double(1)/double(2)*(u[idx_velocity]*u[idx_velocity] + v[idx_velocity]*v[idx_velocity] +
-                                    w[idx_velocity]*w[idx_velocity]);
-                        }
-                    }
-                }
+            
+            // Get the pointers to the cell data of velocity.
+            std::vector<const double*> u;
+            u.reserve(d_dim.getValue());
+            for (int di = 0; di < d_dim.getValue(); di++)
+            {
+                u.push_back(d_data_velocity->getPointer(di));
             }
             
+            // Compute the internal energy field.
+            computeCellDataOfInternalEnergyFromTotalEnergy(
+                epsilon,
+                E,
+                rho,
+                u,
+                d_num_subghosts_internal_energy,
+                d_num_ghosts,
+                d_num_subghosts_density,
+                d_num_subghosts_velocity,
+                d_subghostcell_dims_internal_energy,
+                d_ghostcell_dims,
+                d_subghostcell_dims_density,
+                d_subghostcell_dims_velocity,
+                domain_lo,
+                domain_dims);
+            
             d_cell_data_computed_internal_energy = true;
         }
     }
@@ -5100,330 +5278,105 @@ FlowModelFourEqnConservative::computeCellDataOfSoundSpeedWithDensityMassFraction
              */
             
             hier::IntVector domain_lo(d_dim);
-            hier::IntVector domain_dims(d_dim);
-            
-            if (domain.empty())
-            {
-                domain_lo = -d_num_subghosts_sound_speed;
-                domain_dims = d_subghostcell_dims_sound_speed;
-            }
-            else
-            {
-#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
-                TBOX_ASSERT(d_subghost_box_sound_speed.contains(domain));
-#endif
-                
-                domain_lo = domain.lower() - d_interior_box.lower();
-                domain_dims = domain.numberCells();
-            }
-            
-            if (!d_cell_data_computed_density)
-            {
-                computeCellDataOfDensity(domain);
-            }
-            
-            if (!d_cell_data_computed_mass_fractions)
-            {
-                computeCellDataOfMassFractionsWithDensity(domain);
-            }
-            
-            if (!d_cell_data_computed_pressure)
-            {
-                computeCellDataOfPressureWithDensityMassFractionsAndInternalEnergy(domain);
-            }
-            
-            // Compute the partial derivatives.
-            HAMERS_SHARED_PTR<pdat::CellData<double> > data_gruneisen_parameter(
-                new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_sound_speed));
-            
-            HAMERS_SHARED_PTR<pdat::CellData<double> > data_partial_pressure_partial_partial_densities(
-                new pdat::CellData<double>(d_interior_box, d_num_species, d_num_subghosts_sound_speed));
-            
-            d_equation_of_state_mixing_rules->computeGruneisenParameter(
-                data_gruneisen_parameter,
-                d_data_density,
-                d_data_pressure,
-                d_data_mass_fractions,
-                domain);
-            
-            d_equation_of_state_mixing_rules->computePressureDerivativeWithPartialDensities(
-                data_partial_pressure_partial_partial_densities,
-                d_data_density,
-                d_data_pressure,
-                d_data_mass_fractions,
-                domain);
-            
-            // Get the pointers to the cell data of sound speed, density, mass fractions, pressure,
-            // Gruneisen parameter and partial pressure partial partial densities.
-            double* c     = d_data_sound_speed->getPointer(0);
-            double* rho   = d_data_density->getPointer(0);
-            double* p     = d_data_pressure->getPointer(0);
-            double* Gamma = data_gruneisen_parameter->getPointer(0);
-            std::vector<double*> Y;
-            std::vector<double*> Psi;
-            Y.reserve(d_num_species);
-            Psi.reserve(d_num_species);
-            for (int si = 0; si < d_num_species; si++)
-            {
-                Y.push_back(d_data_mass_fractions->getPointer(si));
-                Psi.push_back(data_partial_pressure_partial_partial_densities->getPointer(si));
-            }
-            
-            // Compute the sound speed field.
-            
-            if (d_dim == tbox::Dimension(1))
-            {
-                /*
-                 * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_dim_0 = domain_dims[0];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_0_mass_fractions = d_num_subghosts_mass_fractions[0];
-                const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_density = i + num_subghosts_0_density;
-                    const int idx_pressure = i + num_subghosts_0_pressure;
-                    const int idx_sound_speed = i + num_subghosts_0_sound_speed;
-                    
-                    c[idx_sound_speed] = Gamma[idx_sound_speed]*p[idx_pressure]/rho[idx_density];
-                }
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_mass_fractions = i + num_subghosts_0_mass_fractions;
-                        const int idx_sound_speed = i + num_subghosts_0_sound_speed;
-                        
-                        c[idx_sound_speed] += Y[si][idx_mass_fractions]*Psi[si][idx_sound_speed];
-                    }
-                }
-                
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear index.
-                    const int idx_sound_speed = i + num_subghosts_0_sound_speed;
-                    
-                    c[idx_sound_speed] = sqrt(c[idx_sound_speed]);
-                }
-            }
-            else if (d_dim == tbox::Dimension(2))
-            {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                
-                const int num_subghosts_0_mass_fractions = d_num_subghosts_mass_fractions[0];
-                const int num_subghosts_1_mass_fractions = d_num_subghosts_mass_fractions[1];
-                const int subghostcell_dim_0_mass_fractions = d_subghostcell_dims_mass_fractions[0];
-                
-                const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                const int num_subghosts_1_pressure = d_num_subghosts_pressure[1];
-                const int subghostcell_dim_0_pressure = d_subghostcell_dims_pressure[0];
-                
-                const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                const int num_subghosts_1_sound_speed = d_num_subghosts_sound_speed[1];
-                const int subghostcell_dim_0_sound_speed = d_subghostcell_dims_sound_speed[0];
-                
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_density = (i + num_subghosts_0_density) +
-                            (j + num_subghosts_1_density)*subghostcell_dim_0_density;
-                        
-                        const int idx_pressure = (i + num_subghosts_0_pressure) +
-                            (j + num_subghosts_1_pressure)*subghostcell_dim_0_pressure;
-                        
-                        const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                            (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                        
-                        c[idx_sound_speed] = Gamma[idx_sound_speed]*p[idx_pressure]/rho[idx_density];
-                    }
-                }
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_mass_fractions = (i + num_subghosts_0_mass_fractions) +
-                                (j + num_subghosts_1_mass_fractions)*subghostcell_dim_0_mass_fractions;
-                            
-                            const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                            
-                            c[idx_sound_speed] += Y[si][idx_mass_fractions]*Psi[si][idx_sound_speed];
-                        }
-                    }
-                }
-                
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear index.
-                        const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                            (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                        
-                        c[idx_sound_speed] = sqrt(c[idx_sound_speed]);
-                    }
-                }
-            }
-            else if (d_dim == tbox::Dimension(3))
-            {
-                /*
-                 * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                 */
-                
-                const int domain_lo_0 = domain_lo[0];
-                const int domain_lo_1 = domain_lo[1];
-                const int domain_lo_2 = domain_lo[2];
-                const int domain_dim_0 = domain_dims[0];
-                const int domain_dim_1 = domain_dims[1];
-                const int domain_dim_2 = domain_dims[2];
-                
-                const int num_subghosts_0_density = d_num_subghosts_density[0];
-                const int num_subghosts_1_density = d_num_subghosts_density[1];
-                const int num_subghosts_2_density = d_num_subghosts_density[2];
-                const int subghostcell_dim_0_density = d_subghostcell_dims_density[0];
-                const int subghostcell_dim_1_density = d_subghostcell_dims_density[1];
-                
-                const int num_subghosts_0_mass_fractions = d_num_subghosts_mass_fractions[0];
-                const int num_subghosts_1_mass_fractions = d_num_subghosts_mass_fractions[1];
-                const int num_subghosts_2_mass_fractions = d_num_subghosts_mass_fractions[2];
-                const int subghostcell_dim_0_mass_fractions = d_subghostcell_dims_mass_fractions[0];
-                const int subghostcell_dim_1_mass_fractions = d_subghostcell_dims_mass_fractions[1];
-                
-                const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                const int num_subghosts_1_pressure = d_num_subghosts_pressure[1];
-                const int num_subghosts_2_pressure = d_num_subghosts_pressure[2];
-                const int subghostcell_dim_0_pressure = d_subghostcell_dims_pressure[0];
-                const int subghostcell_dim_1_pressure = d_subghostcell_dims_pressure[1];
-                
-                const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                const int num_subghosts_1_sound_speed = d_num_subghosts_sound_speed[1];
-                const int num_subghosts_2_sound_speed = d_num_subghosts_sound_speed[2];
-                const int subghostcell_dim_0_sound_speed = d_subghostcell_dims_sound_speed[0];
-                const int subghostcell_dim_1_sound_speed = d_subghostcell_dims_sound_speed[1];
-                
-                for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                {
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_density = (i + num_subghosts_0_density) +
-                                (j + num_subghosts_1_density)*subghostcell_dim_0_density +
-                                (k + num_subghosts_2_density)*subghostcell_dim_0_density*
-                                    subghostcell_dim_1_density;
-                            
-                            const int idx_pressure = (i + num_subghosts_0_pressure) +
-                                (j + num_subghosts_1_pressure)*subghostcell_dim_0_pressure +
-                                (k + num_subghosts_2_pressure)*subghostcell_dim_0_pressure*
-                                    subghostcell_dim_1_pressure;
-                            
-                            const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            c[idx_sound_speed] = Gamma[idx_sound_speed]*p[idx_pressure]/rho[idx_density];
-                        }
-                    }
-                }
-                
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_mass_fractions = (i + num_subghosts_0_mass_fractions) +
-                                    (j + num_subghosts_1_mass_fractions)*subghostcell_dim_0_mass_fractions +
-                                    (k + num_subghosts_2_mass_fractions)*subghostcell_dim_0_mass_fractions*
-                                        subghostcell_dim_1_mass_fractions;
-                                
-                                const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                                
-                                c[idx_sound_speed] += Y[si][idx_mass_fractions]*Psi[si][idx_sound_speed];
-                            }
-                        }
-                    }
-                }
-                
-                for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                {
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
+            hier::IntVector domain_dims(d_dim);
+            
+            if (domain.empty())
+            {
+                domain_lo = -d_num_subghosts_sound_speed;
+                domain_dims = d_subghostcell_dims_sound_speed;
+            }
+            else
+            {
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+                TBOX_ASSERT(d_subghost_box_sound_speed.contains(domain));
 #endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear index.
-                            const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                    subghostcell_dim_1_sound_speed;
-                            
-                            c[idx_sound_speed] = sqrt(c[idx_sound_speed]);
-                        }
-                    }
-                }
+                
+                domain_lo = domain.lower() - d_interior_box.lower();
+                domain_dims = domain.numberCells();
+            }
+            
+            if (!d_cell_data_computed_density)
+            {
+                computeCellDataOfDensity(domain);
+            }
+            
+            if (!d_cell_data_computed_mass_fractions)
+            {
+                computeCellDataOfMassFractionsWithDensity(domain);
+            }
+            
+            if (!d_cell_data_computed_pressure)
+            {
+                computeCellDataOfPressureWithDensityMassFractionsAndInternalEnergy(domain);
+            }
+            
+            // Compute the partial derivatives.
+            if (!d_data_sound_speed_gruneisen_parameter ||
+                d_data_sound_speed_gruneisen_parameter->getGhostCellWidth() != d_num_subghosts_sound_speed ||
+                !d_data_sound_speed_gruneisen_parameter->getBox().isSpatiallyEqual(d_interior_box))
+            {
+                d_data_sound_speed_gruneisen_parameter.reset(
+                    new pdat::CellData<double>(d_interior_box, 1, d_num_subghosts_sound_speed));
+                
+                d_data_sound_speed_partial_pressure_partial_partial_densities.reset(
+                    new pdat::CellData<double>(d_interior_box, d_num_species, d_num_subghosts_sound_speed));
+            }
+            
+            HAMERS_SHARED_PTR<pdat::CellData<double> > data_gruneisen_parameter =
+                d_data_sound_speed_gruneisen_parameter;
+            
+            HAMERS_SHARED_PTR<pdat::CellData<double> > data_partial_pressure_partial_partial_densities =
+                d_data_sound_speed_partial_pressure_partial_partial_densities;
+            
+            d_equation_of_state_mixing_rules->computeGruneisenParameter(
+                data_gruneisen_parameter,
+                d_data_density,
+                d_data_pressure,
+                d_data_mass_fractions,
+                domain);
+            
+            d_equation_of_state_mixing_rules->computePressureDerivativeWithPartialDensities(
+                data_partial_pressure_partial_partial_densities,
+                d_data_density,
+                d_data_pressure,
+                d_data_mass_fractions,
+                domain);
+            
+            // Get the pointers to the cell data of sound speed, density, mass fractions, pressure,
+            // Gruneisen parameter and partial pressure partial partial densities.
+            double* c     = d_data_sound_speed->getPointer(0);
+            double* rho   = d_data_density->getPointer(0);
+            double* p     = d_data_pressure->getPointer(0);
+            double* Gamma = data_gruneisen_parameter->getPointer(0);
+            std::vector<const double*> Y;
+            std::vector<const double*> Psi;
+            Y.reserve(d_num_species);
+            Psi.reserve(d_num_species);
+            for (int si = 0; si < d_num_species; si++)
+            {
+                Y.push_back(d_data_mass_fractions->getPointer(si));
+                Psi.push_back(data_partial_pressure_partial_partial_densities->getPointer(si));
             }
             
+            // Compute the sound speed field.
+            computeCellDataOfSoundSpeedFromPressureDerivatives(
+                c,
+                rho,
+                Y,
+                p,
+                Gamma,
+                Psi,
+                d_num_subghosts_sound_speed,
+                d_num_subghosts_density,
+                d_num_subghosts_mass_fractions,
+                d_num_subghosts_pressure,
+                d_subghostcell_dims_sound_speed,
+                d_subghostcell_dims_density,
+                d_subghostcell_dims_mass_fractions,
+                d_subghostcell_dims_pressure,
+                domain_lo,
+                domain_dims);
+            
             d_cell_data_computed_sound_speed = true;
         }
     }
@@ -5569,258 +5522,51 @@ FlowModelFourEqnConservative::computeCellDataOfConvectiveFluxWithVelocityAndPres
                 double* E = data_total_energy->getPointer(0);
                 double* p = d_data_pressure->getPointer(0);
                 
-                if (d_dim == tbox::Dimension(1))
-                {
-                    /*
-                     * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_dim_0 = domain_dims[0];
-                    
-                    const int num_ghosts_0 = d_num_ghosts[0];
-                    const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_0_convective_flux_x = d_num_subghosts_convective_flux_x[0];
-                    
-                    // Get the pointer to the cell data of momentum.
-                    double* rho_u = data_momentum->getPointer(0);
-                    
-                    // Get the pointer to the cell data of velocity.
-                    double* u = d_data_velocity->getPointer(0);
-                    
-                    // Compute the convective flux in the x-direction.
-                    for (int si = 0; si < d_num_species; si++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx = i + num_ghosts_0;
-                            const int idx_velocity = i + num_subghosts_0_velocity;
-                            const int idx_convective_flux_x = i + num_subghosts_0_convective_flux_x;
-                            
-                            F_x[si][idx_convective_flux_x] = u[idx_velocity]*rho_Y[si][idx];
-                        }
-                    }
-                    
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx = i + num_ghosts_0;
-                        const int idx_pressure = i + num_subghosts_0_pressure;
-                        const int idx_velocity = i + num_subghosts_0_velocity;
-                        const int idx_convective_flux_x = i + num_subghosts_0_convective_flux_x;
-                        
-                        F_x[d_num_species][idx_convective_flux_x] = u[idx_velocity]*rho_u[idx] + p[idx_pressure];
-                        F_x[d_num_species + 1][idx_convective_flux_x] = u[idx_velocity]*(E[idx] + p[idx_pressure]);
-                    }
-                }
-                else if (d_dim == tbox::Dimension(2))
+                // Get the pointers to the cell data of momentum and velocity in the x-direction.
+                std::vector<const double*> rho_u;
+                rho_u.reserve(d_dim.getValue());
+                for (int di = 0; di < d_dim.getValue(); di++)
                 {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    
-                    const int num_ghosts_0 = d_num_ghosts[0];
-                    const int num_ghosts_1 = d_num_ghosts[1];
-                    const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                    
-                    const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                    const int num_subghosts_1_pressure = d_num_subghosts_pressure[1];
-                    const int subghostcell_dim_0_pressure = d_subghostcell_dims_pressure[0];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    
-                    const int num_subghosts_0_convective_flux_x = d_num_subghosts_convective_flux_x[0];
-                    const int num_subghosts_1_convective_flux_x = d_num_subghosts_convective_flux_x[1];
-                    const int subghostcell_dim_0_convective_flux_x = d_subghostcell_dims_convective_flux_x[0];
-                    
-                    // Get the pointers to the cell data of momentum.
-                    double* rho_u = data_momentum->getPointer(0);
-                    double* rho_v = data_momentum->getPointer(1);
-                    
-                    // Get the pointer to the cell data of velocity.
-                    double* u = d_data_velocity->getPointer(0);
-                    
-                    // Compute the convective flux in the x-direction.
-                    for (int si = 0; si < d_num_species; si++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                const int idx = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                                
-                                const int idx_convective_flux_x = (i + num_subghosts_0_convective_flux_x) +
-                                    (j + num_subghosts_1_convective_flux_x)*subghostcell_dim_0_convective_flux_x;
-                                
-                                F_x[si][idx_convective_flux_x] = u[idx_velocity]*rho_Y[si][idx];
-                            }
-                        }
-                    }
-                    
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            const int idx = (i + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0;
-                            
-                            const int idx_pressure = (i + num_subghosts_0_pressure) +
-                                (j + num_subghosts_1_pressure)*subghostcell_dim_0_pressure;
-                            
-                            const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                            
-                            const int idx_convective_flux_x = (i + num_subghosts_0_convective_flux_x) +
-                                (j + num_subghosts_1_convective_flux_x)*subghostcell_dim_0_convective_flux_x;
-                            
-                            F_x[d_num_species][idx_convective_flux_x] = u[idx_velocity]*rho_u[idx] + p[idx_pressure];
-                            F_x[d_num_species + 1][idx_convective_flux_x] = u[idx_velocity]*rho_v[idx];
-                            F_x[d_num_species + 2][idx_convective_flux_x] = u[idx_velocity]*(E[idx] + p[idx_pressure]);
-                        }
-                    }
+                    rho_u.push_back(data_momentum->getPointer(di));
                 }
-                else if (d_dim == tbox::Dimension(3))
+                double* u = d_data_velocity->getPointer(0);
+                
+                // Compute the convective flux in the x-direction.
+                for (int si = 0; si < d_num_species; si++)
                 {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_lo_2 = domain_lo[2];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    const int domain_dim_2 = domain_dims[2];
-                    
-                    const int num_ghosts_0 = d_num_ghosts[0];
-                    const int num_ghosts_1 = d_num_ghosts[1];
-                    const int num_ghosts_2 = d_num_ghosts[2];
-                    const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                    const int ghostcell_dim_1 = d_ghostcell_dims[1];
-                    
-                    const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                    const int num_subghosts_1_pressure = d_num_subghosts_pressure[1];
-                    const int num_subghosts_2_pressure = d_num_subghosts_pressure[2];
-                    const int subghostcell_dim_0_pressure = d_subghostcell_dims_pressure[0];
-                    const int subghostcell_dim_1_pressure = d_subghostcell_dims_pressure[1];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                    
-                    const int num_subghosts_0_convective_flux_x = d_num_subghosts_convective_flux_x[0];
-                    const int num_subghosts_1_convective_flux_x = d_num_subghosts_convective_flux_x[1];
-                    const int num_subghosts_2_convective_flux_x = d_num_subghosts_convective_flux_x[2];
-                    const int subghostcell_dim_0_convective_flux_x = d_subghostcell_dims_convective_flux_x[0];
-                    const int subghostcell_dim_1_convective_flux_x = d_subghostcell_dims_convective_flux_x[1];
-                    
-                    // Get the pointers to the cell data of momentum.
-                    // Get the pointers to the cell data of momentum.
-                    double* rho_u = data_momentum->getPointer(0);
-                    double* rho_v = data_momentum->getPointer(1);
-                    double* rho_w = data_momentum->getPointer(2);
-                    
-                    // Get the pointer to the cell data of velocity.
-                    double* u = d_data_velocity->getPointer(0);
-                    
-                    // Compute the convective flux in the x-direction.
-                    for (int si = 0; si < d_num_species; si++)
-                    {
-                        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                        {
-                            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                            {
-#ifdef HAMERS_ENABLE_SIMD
-                                #pragma omp simd
-#endif
-                                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                                {
-                                    // Compute the linear indices.
-                                    const int idx = (i + num_ghosts_0) +
-                                        (j + num_ghosts_1)*ghostcell_dim_0 +
-                                        (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                                    
-                                    const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                        (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                        (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                            subghostcell_dim_1_velocity;
-                                    
-                                    const int idx_convective_flux_x = (i + num_subghosts_0_convective_flux_x) +
-                                        (j + num_subghosts_1_convective_flux_x)*subghostcell_dim_0_convective_flux_x +
-                                        (k + num_subghosts_2_convective_flux_x)*subghostcell_dim_0_convective_flux_x*
-                                            subghostcell_dim_1_convective_flux_x;
-                                    
-                                    F_x[si][idx_convective_flux_x] = u[idx_velocity]*rho_Y[si][idx];
-                                }
-                            }
-                        }
-                    }
-                    
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                                
-                                const int idx_pressure = (i + num_subghosts_0_pressure) +
-                                    (j + num_subghosts_1_pressure)*subghostcell_dim_0_pressure +
-                                    (k + num_subghosts_2_pressure)*subghostcell_dim_0_pressure*
-                                        subghostcell_dim_1_pressure;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                    (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                        subghostcell_dim_1_velocity;
-                                
-                                const int idx_convective_flux_x = (i + num_subghosts_0_convective_flux_x) +
-                                    (j + num_subghosts_1_convective_flux_x)*subghostcell_dim_0_convective_flux_x +
-                                    (k + num_subghosts_2_convective_flux_x)*subghostcell_dim_0_convective_flux_x*
-                                        subghostcell_dim_1_convective_flux_x;
-                                
-                                F_x[d_num_species][idx_convective_flux_x] = u[idx_velocity]*rho_u[idx] + p[idx_pressure];
-                                F_x[d_num_species + 1][idx_convective_flux_x] = u[idx_velocity]*rho_v[idx];
-                                F_x[d_num_species + 2][idx_convective_flux_x] = u[idx_velocity]*rho_w[idx];
-                                F_x[d_num_species + 3][idx_convective_flux_x] = u[idx_velocity]*(E[idx] + p[idx_pressure]);
-                            }
-                        }
-                    }
+                    computeCellDataOfProduct(
+                        F_x[si],
+                        u,
+                        rho_Y[si],
+                        d_num_subghosts_convective_flux_x,
+                        d_num_subghosts_velocity,
+                        d_num_ghosts,
+                        d_subghostcell_dims_convective_flux_x,
+                        d_subghostcell_dims_velocity,
+                        d_ghostcell_dims,
+                        domain_lo,
+                        domain_dims);
                 }
                 
+                computeCellDataOfConvectiveFluxOfMomentumAndTotalEnergy(
+                    F_x,
+                    d_num_species,
+                    rho_u,
+                    E,
+                    u,
+                    p,
+                    d_num_subghosts_convective_flux_x,
+                    d_num_ghosts,
+                    d_num_subghosts_velocity,
+                    d_num_subghosts_pressure,
+                    d_subghostcell_dims_convective_flux_x,
+                    d_ghostcell_dims,
+                    d_subghostcell_dims_velocity,
+                    d_subghostcell_dims_pressure,
+                    domain_lo,
+                    domain_dims,
+                    DIRECTION::X_DIRECTION);
+                
                 d_cell_data_computed_convective_flux_x = true;
             }
         }
@@ -5892,224 +5638,71 @@ FlowModelFourEqnConservative::computeCellDataOfConvectiveFluxWithVelocityAndPres
                     computeCellDataOfVelocityWithDensity(domain);
                 }
                 
-                // Get the pointers to the cell data of partial densities, total energy, volume fraction
-                // and pressure.
-                std::vector<double*> rho_Y;
-                rho_Y.reserve(d_num_species);
-                for (int si = 0; si < d_num_species; si++)
-                {
-                    rho_Y.push_back(data_partial_densities->getPointer(si));
-                }
-                double* E = data_total_energy->getPointer(0);
-                double* p = d_data_pressure->getPointer(0);
-                
-                if (d_dim == tbox::Dimension(1))
-                {
-                    TBOX_ERROR(d_object_name
-                        << ": FlowModelFourEqnConservative::"
-                        << "computeCellDataOfConvectiveFluxWithVelocityAndPressure()\n"
-                        << "'CONVECTIVE_FLUX_Y' cannot be obtained for problem with dimension less than two."
-                        << std::endl);
-                }
-                else if (d_dim == tbox::Dimension(2))
-                {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    
-                    const int num_ghosts_0 = d_num_ghosts[0];
-                    const int num_ghosts_1 = d_num_ghosts[1];
-                    const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                    
-                    const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                    const int num_subghosts_1_pressure = d_num_subghosts_pressure[1];
-                    const int subghostcell_dim_0_pressure = d_subghostcell_dims_pressure[0];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    
-                    const int num_subghosts_0_convective_flux_y = d_num_subghosts_convective_flux_y[0];
-                    const int num_subghosts_1_convective_flux_y = d_num_subghosts_convective_flux_y[1];
-                    const int subghostcell_dim_0_convective_flux_y = d_subghostcell_dims_convective_flux_y[0];
-                    
-                    // Get the pointers to the cell data of momentum.
-                    double* rho_u = data_momentum->getPointer(0);
-                    double* rho_v = data_momentum->getPointer(1);
-                    
-                    // Get the pointer to the cell data of velocity.
-                    double* v = d_data_velocity->getPointer(1);
-                    
-                    // Compute the convective flux in the y-direction.
-                    for (int si = 0; si < d_num_species; si++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                const int idx = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                                
-                                const int idx_convective_flux_y = (i + num_subghosts_0_convective_flux_y) +
-                                    (j + num_subghosts_1_convective_flux_y)*subghostcell_dim_0_convective_flux_y;
-                                
-                                F_y[si][idx_convective_flux_y] = v[idx_velocity]*rho_Y[si][idx];
-                            }
-                        }
-                    }
-                    
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            const int idx = (i + num_ghosts_0) +
-                                (j + num_ghosts_1)*ghostcell_dim_0;
-                            
-                            const int idx_pressure = (i + num_subghosts_0_pressure) +
-                                (j + num_subghosts_1_pressure)*subghostcell_dim_0_pressure;
-                            
-                            const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                            
-                            const int idx_convective_flux_y = (i + num_subghosts_0_convective_flux_y) +
-                                (j + num_subghosts_1_convective_flux_y)*subghostcell_dim_0_convective_flux_y;
-                            
-                            F_y[d_num_species][idx_convective_flux_y] = v[idx_velocity]*rho_u[idx];
-                            F_y[d_num_species + 1][idx_convective_flux_y] = v[idx_velocity]*rho_v[idx] + p[idx_pressure];
-                            F_y[d_num_species + 2][idx_convective_flux_y] = v[idx_velocity]*(E[idx] + p[idx_pressure]);
-                        }
-                    }
+                // Get the pointers to the cell data of partial densities, total energy, volume fraction
+                // and pressure.
+                std::vector<double*> rho_Y;
+                rho_Y.reserve(d_num_species);
+                for (int si = 0; si < d_num_species; si++)
+                {
+                    rho_Y.push_back(data_partial_densities->getPointer(si));
                 }
-                else if (d_dim == tbox::Dimension(3))
+                double* E = data_total_energy->getPointer(0);
+                double* p = d_data_pressure->getPointer(0);
+                
+                if (d_dim == tbox::Dimension(1))
                 {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_lo_2 = domain_lo[2];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    const int domain_dim_2 = domain_dims[2];
-                    
-                    const int num_ghosts_0 = d_num_ghosts[0];
-                    const int num_ghosts_1 = d_num_ghosts[1];
-                    const int num_ghosts_2 = d_num_ghosts[2];
-                    const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                    const int ghostcell_dim_1 = d_ghostcell_dims[1];
-                    
-                    const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                    const int num_subghosts_1_pressure = d_num_subghosts_pressure[1];
-                    const int num_subghosts_2_pressure = d_num_subghosts_pressure[2];
-                    const int subghostcell_dim_0_pressure = d_subghostcell_dims_pressure[0];
-                    const int subghostcell_dim_1_pressure = d_subghostcell_dims_pressure[1];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                    
-                    const int num_subghosts_0_convective_flux_y = d_num_subghosts_convective_flux_y[0];
-                    const int num_subghosts_1_convective_flux_y = d_num_subghosts_convective_flux_y[1];
-                    const int num_subghosts_2_convective_flux_y = d_num_subghosts_convective_flux_y[2];
-                    const int subghostcell_dim_0_convective_flux_y = d_subghostcell_dims_convective_flux_y[0];
-                    const int subghostcell_dim_1_convective_flux_y = d_subghostcell_dims_convective_flux_y[1];
-                    
-                    // Get the pointers to the cell data of momentum.
-                    double* rho_u = data_momentum->getPointer(0);
-                    double* rho_v = data_momentum->getPointer(1);
-                    double* rho_w = data_momentum->getPointer(2);
-                    
-                    // Get the pointer to the cell data of velocity.
-                    double* v = d_data_velocity->getPointer(1);
-                    
-                    // Compute the convective flux in the y-direction.
-                    for (int si = 0; si < d_num_species; si++)
-                    {
-                        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                        {
-                            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                            {
-#ifdef HAMERS_ENABLE_SIMD
-                                #pragma omp simd
-#endif
-                                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                                {
-                                    // Compute the linear indices.
-                                    const int idx = (i + num_ghosts_0) +
-                                        (j + num_ghosts_1)*ghostcell_dim_0 +
-                                        (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                                    
-                                    const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                        (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                        (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                            subghostcell_dim_1_velocity;
-                                    
-                                    const int idx_convective_flux_y = (i + num_subghosts_0_convective_flux_y) +
-                                        (j + num_subghosts_1_convective_flux_y)*subghostcell_dim_0_convective_flux_y +
-                                        (k + num_subghosts_2_convective_flux_y)*subghostcell_dim_0_convective_flux_y*
-                                            subghostcell_dim_1_convective_flux_y;
-                                    
-                                    F_y[si][idx_convective_flux_y] = v[idx_velocity]*rho_Y[si][idx];
-                                }
-                            }
-                        }
-                    }
-                    
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                                
-                                const int idx_pressure = (i + num_subghosts_0_pressure) +
-                                    (j + num_subghosts_1_pressure)*subghostcell_dim_0_pressure +
-                                    (k + num_subghosts_2_pressure)*subghostcell_dim_0_pressure*
-                                        subghostcell_dim_1_pressure;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                    (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                        subghostcell_dim_1_velocity;
-                                
-                                const int idx_convective_flux_y = (i + num_subghosts_0_convective_flux_y) +
-                                    (j + num_subghosts_1_convective_flux_y)*subghostcell_dim_0_convective_flux_y +
-                                    (k + num_subghosts_2_convective_flux_y)*subghostcell_dim_0_convective_flux_y*
-                                        subghostcell_dim_1_convective_flux_y;
-                                
-                                F_y[d_num_species][idx_convective_flux_y] = v[idx_velocity]*rho_u[idx];
-                                F_y[d_num_species + 1][idx_convective_flux_y] = v[idx_velocity]*rho_v[idx] + p[idx_pressure];
-                                F_y[d_num_species + 2][idx_convective_flux_y] = v[idx_velocity]*rho_w[idx];
-                                F_y[d_num_species + 3][idx_convective_flux_y] = v[idx_velocity]*(E[idx] + p[idx_pressure]);
-                            }
-                        }
-                    }
+                    TBOX_ERROR(d_object_name
+                        << ": FlowModelFourEqnConservative::"
+                        << "computeCellDataOfConvectiveFluxWithVelocityAndPressure()\n"
+                        << "'CONVECTIVE_FLUX_Y' cannot be obtained for problem with dimension less than two."
+                        << std::endl);
+                }
+                
+                // Get the pointers to the cell data of momentum and velocity in the y-direction.
+                std::vector<const double*> rho_u;
+                rho_u.reserve(d_dim.getValue());
+                for (int di = 0; di < d_dim.getValue(); di++)
+                {
+                    rho_u.push_back(data_momentum->getPointer(di));
+                }
+                double* v = d_data_velocity->getPointer(1);
+                
+                // Compute the convective flux in the y-direction.
+                for (int si = 0; si < d_num_species; si++)
+                {
+                    computeCellDataOfProduct(
+                        F_y[si],
+                        v,
+                        rho_Y[si],
+                        d_num_subghosts_convective_flux_y,
+                        d_num_subghosts_velocity,
+                        d_num_ghosts,
+                        d_subghostcell_dims_convective_flux_y,
+                        d_subghostcell_dims_velocity,
+                        d_ghostcell_dims,
+                        domain_lo,
+                        domain_dims);
                 }
                 
+                computeCellDataOfConvectiveFluxOfMomentumAndTotalEnergy(
+                    F_y,
+                    d_num_species,
+                    rho_u,
+                    E,
+                    v,
+                    p,
+                    d_num_subghosts_convective_flux_y,
+                    d_num_ghosts,
+                    d_num_subghosts_velocity,
+                    d_num_subghosts_pressure,
+                    d_subghostcell_dims_convective_flux_y,
+                    d_ghostcell_dims,
+                    d_subghostcell_dims_velocity,
+                    d_subghostcell_dims_pressure,
+                    domain_lo,
+                    domain_dims,
+                    DIRECTION::Y_DIRECTION);
+                
                 d_cell_data_computed_convective_flux_y = true;
             }
         }
@@ -6200,122 +5793,52 @@ FlowModelFourEqnConservative::computeCellDataOfConvectiveFluxWithVelocityAndPres
                         << "'CONVECTIVE_FLUX_Z' cannot be obtained for problem with dimension less than three."
                         << std::endl);
                 }
-                else if (d_dim == tbox::Dimension(3))
+                
+                // Get the pointers to the cell data of momentum and velocity in the z-direction.
+                std::vector<const double*> rho_u;
+                rho_u.reserve(d_dim.getValue());
+                for (int di = 0; di < d_dim.getValue(); di++)
                 {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_lo_2 = domain_lo[2];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    const int domain_dim_2 = domain_dims[2];
-                    
-                    const int num_ghosts_0 = d_num_ghosts[0];
-                    const int num_ghosts_1 = d_num_ghosts[1];
-                    const int num_ghosts_2 = d_num_ghosts[2];
-                    const int ghostcell_dim_0 = d_ghostcell_dims[0];
-                    const int ghostcell_dim_1 = d_ghostcell_dims[1];
-                    
-                    const int num_subghosts_0_pressure = d_num_subghosts_pressure[0];
-                    const int num_subghosts_1_pressure = d_num_subghosts_pressure[1];
-                    const int num_subghosts_2_pressure = d_num_subghosts_pressure[2];
-                    const int subghostcell_dim_0_pressure = d_subghostcell_dims_pressure[0];
-                    const int subghostcell_dim_1_pressure = d_subghostcell_dims_pressure[1];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                    
-                    const int num_subghosts_0_convective_flux_z = d_num_subghosts_convective_flux_z[0];
-                    const int num_subghosts_1_convective_flux_z = d_num_subghosts_convective_flux_z[1];
-                    const int num_subghosts_2_convective_flux_z = d_num_subghosts_convective_flux_z[2];
-                    const int subghostcell_dim_0_convective_flux_z = d_subghostcell_dims_convective_flux_z[0];
-                    const int subghostcell_dim_1_convective_flux_z = d_subghostcell_dims_convective_flux_z[1];
-                    
-                    // Get the pointers to the cell data of momentum.
-                    double* rho_u = data_momentum->getPointer(0);
-                    double* rho_v = data_momentum->getPointer(1);
-                    double* rho_w = data_momentum->getPointer(2);
-                    
-                    // Get the pointer to the cell data of velocity.
-                    double* w = d_data_velocity->getPointer(2);
-                    
-                    // Compute the convective flux in the z-direction.
-                    for (int si = 0; si < d_num_species; si++)
-                    {
-                        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                        {
-                            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                            {
-#ifdef HAMERS_ENABLE_SIMD
-                                #pragma omp simd
-#endif
-                                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                                {
-                                    // Compute the linear indices.
-                                    const int idx = (i + num_ghosts_0) +
-                                        (j + num_ghosts_1)*ghostcell_dim_0 +
-                                        (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                                    
-                                    const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                        (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                        (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                            subghostcell_dim_1_velocity;
-                                    
-                                    const int idx_convective_flux_z = (i + num_subghosts_0_convective_flux_z) +
-                                        (j + num_subghosts_1_convective_flux_z)*subghostcell_dim_0_convective_flux_z +
-                                        (k + num_subghosts_2_convective_flux_z)*subghostcell_dim_0_convective_flux_z*
-                                            subghostcell_dim_1_convective_flux_z;
-                                    
-                                    F_z[si][idx_convective_flux_z] = w[idx_velocity]*rho_Y[si][idx];
-                                }
-                            }
-                        }
-                    }
-                    
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx = (i + num_ghosts_0) +
-                                    (j + num_ghosts_1)*ghostcell_dim_0 +
-                                    (k + num_ghosts_2)*ghostcell_dim_0*ghostcell_dim_1;
-                                
-                                const int idx_pressure = (i + num_subghosts_0_pressure) +
-                                    (j + num_subghosts_1_pressure)*subghostcell_dim_0_pressure +
-                                    (k + num_subghosts_2_pressure)*subghostcell_dim_0_pressure*
-                                        subghostcell_dim_1_pressure;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                    (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                        subghostcell_dim_1_velocity;
-                                
-                                const int idx_convective_flux_z = (i + num_subghosts_0_convective_flux_z) +
-                                    (j + num_subghosts_1_convective_flux_z)*subghostcell_dim_0_convective_flux_z +
-                                    (k + num_subghosts_2_convective_flux_z)*subghostcell_dim_0_convective_flux_z*
-                                        subghostcell_dim_1_convective_flux_z;
-                                
-                                F_z[d_num_species][idx_convective_flux_z] = w[idx_velocity]*rho_u[idx];
-                                F_z[d_num_species + 1][idx_convective_flux_z] = w[idx_velocity]*rho_v[idx];
-                                F_z[d_num_species + 2][idx_convective_flux_z] = w[idx_velocity]*rho_w[idx] + p[idx_pressure];
-                                F_z[d_num_species + 3][idx_convective_flux_z] = w[idx_velocity]*(E[idx] + p[idx_pressure]);
-                            }
-                        }
-                    }
+                    rho_u.push_back(data_momentum->getPointer(di));
+                }
+                double* w = d_data_velocity->getPointer(2);
+                
+                // Compute the convective flux in the z-direction.
+                for (int si = 0; si < d_num_species; si++)
+                {
+                    computeCellDataOfProduct(
+                        F_z[si],
+                        w,
+                        rho_Y[si],
+                        d_num_subghosts_convective_flux_z,
+                        d_num_subghosts_velocity,
+                        d_num_ghosts,
+                        d_subghostcell_dims_convective_flux_z,
+                        d_subghostcell_dims_velocity,
+                        d_ghostcell_dims,
+                        domain_lo,
+                        domain_dims);
                 }
                 
+                computeCellDataOfConvectiveFluxOfMomentumAndTotalEnergy(
+                    F_z,
+                    d_num_species,
+                    rho_u,
+                    E,
+                    w,
+                    p,
+                    d_num_subghosts_convective_flux_z,
+                    d_num_ghosts,
+                    d_num_subghosts_velocity,
+                    d_num_subghosts_pressure,
+                    d_subghostcell_dims_convective_flux_z,
+                    d_ghostcell_dims,
+                    d_subghostcell_dims_velocity,
+                    d_subghostcell_dims_pressure,
+                    domain_lo,
+                    domain_dims,
+                    DIRECTION::Z_DIRECTION);
+                
                 d_cell_data_computed_convective_flux_z = true;
             }
         }
@@ -6387,140 +5910,19 @@ FlowModelFourEqnConservative::computeCellDataOfMaxWaveSpeedWithVelocityAndSoundS
                 double* u            = d_data_velocity->getPointer(0);
                 double* c            = d_data_sound_speed->getPointer(0);
                 
-                if (d_dim == tbox::Dimension(1))
-                {
-                    /*
-                     * Get the local lower index, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_dim_0 = domain_dims[0];
-                    
-                    const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_0_max_wave_speed_x = d_num_subghosts_max_wave_speed_x[0];
-                    
-                    // Compute the maximum wave speed in the x-direction.
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_sound_speed = i + num_subghosts_0_sound_speed;
-                        const int idx_velocity = i + num_subghosts_0_velocity;
-                        const int idx_max_wave_speed_x = i + num_subghosts_0_max_wave_speed_x;
-                        
-                        lambda_max_x[idx_max_wave_speed_x] = fabs(u[idx_velocity]) + c[idx_sound_speed];
-                    }
-                }
-                else if (d_dim == tbox::Dimension(2))
-                {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    
-                    const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                    const int num_subghosts_1_sound_speed = d_num_subghosts_sound_speed[1];
-                    const int subghostcell_dim_0_sound_speed = d_subghostcell_dims_sound_speed[0];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    
-                    const int num_subghosts_0_max_wave_speed_x = d_num_subghosts_max_wave_speed_x[0];
-                    const int num_subghosts_1_max_wave_speed_x = d_num_subghosts_max_wave_speed_x[1];
-                    const int subghostcell_dim_0_max_wave_speed_x = d_subghostcell_dims_max_wave_speed_x[0];
-                    
-                    // Compute the maximum wave speed in the x-direction.
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                            
-                            const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                            
-                            const int idx_max_wave_speed_x = (i + num_subghosts_0_max_wave_speed_x) +
-                                (j + num_subghosts_1_max_wave_speed_x)*subghostcell_dim_0_max_wave_speed_x;
-                            
-                            lambda_max_x[idx_max_wave_speed_x] = fabs(u[idx_velocity]) + c[idx_sound_speed];
-                        }
-                    }
-                }
-                else if (d_dim == tbox::Dimension(3))
-                {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_lo_2 = domain_lo[2];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    const int domain_dim_2 = domain_dims[2];
-                    
-                    const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                    const int num_subghosts_1_sound_speed = d_num_subghosts_sound_speed[1];
-                    const int num_subghosts_2_sound_speed = d_num_subghosts_sound_speed[2];
-                    const int subghostcell_dim_0_sound_speed = d_subghostcell_dims_sound_speed[0];
-                    const int subghostcell_dim_1_sound_speed = d_subghostcell_dims_sound_speed[1];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                    
-                    const int num_subghosts_0_max_wave_speed_x = d_num_subghosts_max_wave_speed_x[0];
-                    const int num_subghosts_1_max_wave_speed_x = d_num_subghosts_max_wave_speed_x[1];
-                    const int num_subghosts_2_max_wave_speed_x = d_num_subghosts_max_wave_speed_x[2];
-                    const int subghostcell_dim_0_max_wave_speed_x = d_subghostcell_dims_max_wave_speed_x[0];
-                    const int subghostcell_dim_1_max_wave_speed_x = d_subghostcell_dims_max_wave_speed_x[1];
-                    
-                    // Compute the maximum wave speed in the x-direction.
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                    (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                    (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                        subghostcell_dim_1_sound_speed;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                    (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                        subghostcell_dim_1_velocity;
-                                
-                                const int idx_max_wave_speed_x = (i + num_subghosts_0_max_wave_speed_x) +
-                                    (j + num_subghosts_1_max_wave_speed_x)*subghostcell_dim_0_max_wave_speed_x +
-                                    (k + num_subghosts_2_max_wave_speed_x)*subghostcell_dim_0_max_wave_speed_x*
-                                        subghostcell_dim_1_max_wave_speed_x;
-                                
-                                lambda_max_x[idx_max_wave_speed_x] = fabs(u[idx_velocity]) + c[idx_sound_speed];
-                            }
-                        }
-                    }
-                }
+                // Compute the maximum wave speed in the x-direction.
+                computeCellDataOfMaxWaveSpeedFromVelocityComponent(
+                    lambda_max_x,
+                    u,
+                    c,
+                    d_num_subghosts_max_wave_speed_x,
+                    d_num_subghosts_velocity,
+                    d_num_subghosts_sound_speed,
+                    d_subghostcell_dims_max_wave_speed_x,
+                    d_subghostcell_dims_velocity,
+                    d_subghostcell_dims_sound_speed,
+                    domain_lo,
+                    domain_dims);
                 
                 d_cell_data_computed_max_wave_speed_x = true;
             }
@@ -6589,113 +5991,20 @@ FlowModelFourEqnConservative::computeCellDataOfMaxWaveSpeedWithVelocityAndSoundS
                         << "'MAX_WAVE_SPEED_Y' cannot be obtained for problem with dimension less than two."
                         << std::endl);
                 }
-                else if (d_dim == tbox::Dimension(2))
-                {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    
-                    const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                    const int num_subghosts_1_sound_speed = d_num_subghosts_sound_speed[1];
-                    const int subghostcell_dim_0_sound_speed = d_subghostcell_dims_sound_speed[0];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    
-                    const int num_subghosts_0_max_wave_speed_y = d_num_subghosts_max_wave_speed_y[0];
-                    const int num_subghosts_1_max_wave_speed_y = d_num_subghosts_max_wave_speed_y[1];
-                    const int subghostcell_dim_0_max_wave_speed_y = d_subghostcell_dims_max_wave_speed_y[0];
-                    
-                    // Compute the maximum wave speed in the y-direction.
-                    for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                    {
-#ifdef HAMERS_ENABLE_SIMD
-                        #pragma omp simd
-#endif
-                        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                        {
-                            // Compute the linear indices.
-                            const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed;
-                            
-                            const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity;
-                            
-                            const int idx_max_wave_speed_y = (i + num_subghosts_0_max_wave_speed_y) +
-                                (j + num_subghosts_1_max_wave_speed_y)*subghostcell_dim_0_max_wave_speed_y;
-                            
-                            lambda_max_y[idx_max_wave_speed_y] = fabs(v[idx_velocity]) + c[idx_sound_speed];
-                        }
-                    }
-                }
-                else if (d_dim == tbox::Dimension(3))
-                {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_lo_2 = domain_lo[2];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    const int domain_dim_2 = domain_dims[2];
-                    
-                    const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                    const int num_subghosts_1_sound_speed = d_num_subghosts_sound_speed[1];
-                    const int num_subghosts_2_sound_speed = d_num_subghosts_sound_speed[2];
-                    const int subghostcell_dim_0_sound_speed = d_subghostcell_dims_sound_speed[0];
-                    const int subghostcell_dim_1_sound_speed = d_subghostcell_dims_sound_speed[1];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                    
-                    const int num_subghosts_0_max_wave_speed_y = d_num_subghosts_max_wave_speed_y[0];
-                    const int num_subghosts_1_max_wave_speed_y = d_num_subghosts_max_wave_speed_y[1];
-                    const int num_subghosts_2_max_wave_speed_y = d_num_subghosts_max_wave_speed_y[2];
-                    const int subghostcell_dim_0_max_wave_speed_y = d_subghostcell_dims_max_wave_speed_y[0];
-                    const int subghostcell_dim_1_max_wave_speed_y = d_subghostcell_dims_max_wave_speed_y[1];
-                    
-                    // Compute the maximum wave speed in the y-direction.
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                    (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                    (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                        subghostcell_dim_1_sound_speed;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                    (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                        subghostcell_dim_1_velocity;
-                                
-                                const int idx_max_wave_speed_y = (i + num_subghosts_0_max_wave_speed_y) +
-                                    (j + num_subghosts_1_max_wave_speed_y)*subghostcell_dim_0_max_wave_speed_y +
-                                    (k + num_subghosts_2_max_wave_speed_y)*subghostcell_dim_0_max_wave_speed_y*
-                                        subghostcell_dim_1_max_wave_speed_y;
-                                
-                                lambda_max_y[idx_max_wave_speed_y] = fabs(v[idx_velocity]) + c[idx_sound_speed];
-                            }
-                        }
-                    }
-                }
+                
+                // Compute the maximum wave speed in the y-direction.
+                computeCellDataOfMaxWaveSpeedFromVelocityComponent(
+                    lambda_max_y,
+                    v,
+                    c,
+                    d_num_subghosts_max_wave_speed_y,
+                    d_num_subghosts_velocity,
+                    d_num_subghosts_sound_speed,
+                    d_subghostcell_dims_max_wave_speed_y,
+                    d_subghostcell_dims_velocity,
+                    d_subghostcell_dims_sound_speed,
+                    domain_lo,
+                    domain_dims);
                 
                 d_cell_data_computed_max_wave_speed_y = true;
             }
@@ -6764,68 +6073,20 @@ FlowModelFourEqnConservative::computeCellDataOfMaxWaveSpeedWithVelocityAndSoundS
                         << "'MAX_WAVE_SPEED_Z' cannot be obtained for problem with dimension less than three."
                         << std::endl);
                 }
-                else if (d_dim == tbox::Dimension(3))
-                {
-                    /*
-                     * Get the local lower indices, numbers of cells in each dimension and numbers of ghost cells.
-                     */
-                    
-                    const int domain_lo_0 = domain_lo[0];
-                    const int domain_lo_1 = domain_lo[1];
-                    const int domain_lo_2 = domain_lo[2];
-                    const int domain_dim_0 = domain_dims[0];
-                    const int domain_dim_1 = domain_dims[1];
-                    const int domain_dim_2 = domain_dims[2];
-                    
-                    const int num_subghosts_0_sound_speed = d_num_subghosts_sound_speed[0];
-                    const int num_subghosts_1_sound_speed = d_num_subghosts_sound_speed[1];
-                    const int num_subghosts_2_sound_speed = d_num_subghosts_sound_speed[2];
-                    const int subghostcell_dim_0_sound_speed = d_subghostcell_dims_sound_speed[0];
-                    const int subghostcell_dim_1_sound_speed = d_subghostcell_dims_sound_speed[1];
-                    
-                    const int num_subghosts_0_velocity = d_num_subghosts_velocity[0];
-                    const int num_subghosts_1_velocity = d_num_subghosts_velocity[1];
-                    const int num_subghosts_2_velocity = d_num_subghosts_velocity[2];
-                    const int subghostcell_dim_0_velocity = d_subghostcell_dims_velocity[0];
-                    const int subghostcell_dim_1_velocity = d_subghostcell_dims_velocity[1];
-                    
-                    const int num_subghosts_0_max_wave_speed_z = d_num_subghosts_max_wave_speed_z[0];
-                    const int num_subghosts_1_max_wave_speed_z = d_num_subghosts_max_wave_speed_z[1];
-                    const int num_subghosts_2_max_wave_speed_z = d_num_subghosts_max_wave_speed_z[2];
-                    const int subghostcell_dim_0_max_wave_speed_z = d_subghostcell_dims_max_wave_speed_z[0];
-                    const int subghostcell_dim_1_max_wave_speed_z = d_subghostcell_dims_max_wave_speed_z[1];
-                    
-                    // Compute the maximum wave speed in the z-direction.
-                    for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-                    {
-                        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                        {
-#ifdef HAMERS_ENABLE_SIMD
-                            #pragma omp simd
-#endif
-                            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                            {
-                                // Compute the linear indices.
-                                const int idx_sound_speed = (i + num_subghosts_0_sound_speed) +
-                                    (j + num_subghosts_1_sound_speed)*subghostcell_dim_0_sound_speed +
-                                    (k + num_subghosts_2_sound_speed)*subghostcell_dim_0_sound_speed*
-                                        subghostcell_dim_1_sound_speed;
-                                
-                                const int idx_velocity = (i + num_subghosts_0_velocity) +
-                                    (j + num_subghosts_1_velocity)*subghostcell_dim_0_velocity +
-                                    (k + num_subghosts_2_velocity)*subghostcell_dim_0_velocity*
-                                        subghostcell_dim_1_velocity;
-                                
-                                const int idx_max_wave_speed_z = (i + num_subghosts_0_max_wave_speed_z) +
-                                    (j + num_subghosts_1_max_wave_speed_z)*subghostcell_dim_0_max_wave_speed_z +
-                                    (k + num_subghosts_2_max_wave_speed_z)*subghostcell_dim_0_max_wave_speed_z*
-                                        subghostcell_dim_1_max_wave_speed_z;
-                                
-                                lambda_max_z[idx_max_wave_speed_z] = fabs(w[idx_velocity]) + c[idx_sound_speed];
-                            }
-                        }
-                    }
-                }
+                
+                // Compute the maximum wave speed in the z-direction.
+                computeCellDataOfMaxWaveSpeedFromVelocityComponent(
+                    lambda_max_z,
+                    w,
+                    c,
+                    d_num_subghosts_max_wave_speed_z,
+                    d_num_subghosts_velocity,
+                    d_num_subghosts_sound_speed,
+                    d_subghostcell_dims_max_wave_speed_z,
+                    d_subghostcell_dims_velocity,
+                    d_subghostcell_dims_sound_speed,
+                    domain_lo,
+                    domain_dims);
                 
                 d_cell_data_computed_max_wave_speed_z = true;
             }
@@ -77,7 +77,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromConservative
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC[0])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -89,7 +89,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromConservative
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC[1])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -101,7 +101,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromConservative
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC[2])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -129,7 +129,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromConservative
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC_HLL[0])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -141,7 +141,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromConservative
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC_HLL[1])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -153,7 +153,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromConservative
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC_HLL[2])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -264,7 +264,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromPrimitiveVar
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC[0])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -276,7 +276,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromPrimitiveVar
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC[1])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -288,7 +288,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromPrimitiveVar
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC[2])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -316,7 +316,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromPrimitiveVar
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC_HLL[0])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -328,7 +328,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromPrimitiveVar
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC_HLL[1])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -340,7 +340,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxFromPrimitiveVar
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC_HLL[2])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -455,7 +455,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromC
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC[0])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -467,7 +467,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromC
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC[1])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -479,7 +479,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromC
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC[2])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -507,7 +507,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromC
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC_HLL[0])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -519,7 +519,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromC
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC_HLL[1])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -531,7 +531,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromC
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_conservative_variables_HLLC_HLL[2])(
                         convective_flux,
                         velocity,
                         conservative_variables_minus,
@@ -646,7 +646,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromP
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC[0])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -658,7 +658,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromP
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC[1])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -670,7 +670,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromP
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC[2])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -698,7 +698,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromP
             {
                 case DIRECTION::X_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC_HLL[0])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -710,7 +710,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromP
                 }
                 case DIRECTION::Y_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC_HLL[1])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -722,7 +722,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityFromP
                 }
                 case DIRECTION::Z_DIRECTION:
                 {
-                    computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC_HLL(
+                    (this->*d_compute_convective_flux_from_primitive_variables_HLLC_HLL[2])(
                         convective_flux,
                         velocity,
                         primitive_variables_minus,
@@ -4,6 +4,7 @@
  * Compute the local convective flux in the x-direction from conservative variables with
  * 1D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
     double** F_x,
@@ -23,20 +24,24 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 2 : num_eqn_runtime);
+    
     u_x_L = Q_x_L[num_species][idx]/rho_x_L[idx];
     u_x_R = Q_x_R[num_species][idx]/rho_x_R[idx];
     
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[num_species][idx]*(s_x_L - u_x_L) - Q_x_R[num_species][idx]*(s_x_R - u_x_R))/
@@ -45,53 +50,45 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_L[num_species + 1][idx] +
-            (s_x_star - u_x_L)*(rho_x_L[idx]*s_x_star + p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_L*Q_x_L[si][idx];
-        }
-        F_x_LR[num_species] = u_x_L*Q_x_L[num_species][idx] + p_x_L[idx];
-        F_x_LR[num_species + 1] = u_x_L*(Q_x_L[num_species + 1][idx] + p_x_L[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_R[num_species + 1][idx] +
-            (s_x_star - u_x_R)*(rho_x_R[idx]*s_x_star + p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_R*Q_x_R[si][idx];
-        }
-        F_x_LR[num_species] = u_x_R*Q_x_R[num_species][idx] + p_x_R[idx];
-        F_x_LR[num_species + 1] = u_x_R*(Q_x_R[num_species + 1][idx] + p_x_R[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        Q_x_star_LR[si] = Chi_x_star_LR*Q_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
+        (s_x_star - u_x_LR)*(rho_x_LR*s_x_star + p_x_LR/(s_x_LR - u_x_LR)));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = u_x_LR*Q_x_LR[si];
+    }
+    F_x_LR[num_species] = u_x_LR*Q_x_LR[num_species] + p_x_LR;
+    F_x_LR[num_species + 1] = u_x_LR*(Q_x_LR[num_species + 1] + p_x_LR);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -100,6 +97,7 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
  * Compute the local convective flux in the x-direction from conservative variables with
  * 2D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
     double** F_x,
@@ -119,20 +117,24 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 3 : num_eqn_runtime);
+    
     u_x_L = Q_x_L[num_species][idx]/rho_x_L[idx];
     u_x_R = Q_x_R[num_species][idx]/rho_x_R[idx];
     
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[num_species][idx]*(s_x_L - u_x_L) - Q_x_R[num_species][idx]*(s_x_R - u_x_R))/
@@ -141,57 +143,47 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_L[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_L[num_species + 2][idx] +
-            (s_x_star - u_x_L)*(rho_x_L[idx]*s_x_star + p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_L*Q_x_L[si][idx];
-        }
-        F_x_LR[num_species] = u_x_L*Q_x_L[num_species][idx] + p_x_L[idx];
-        F_x_LR[num_species + 1] = u_x_L*Q_x_L[num_species + 1][idx];
-        F_x_LR[num_species + 2] = u_x_L*(Q_x_L[num_species + 2][idx] + p_x_L[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_R[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_R[num_species + 2][idx] +
-            (s_x_star - u_x_R)*(rho_x_R[idx]*s_x_star + p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_R*Q_x_R[si][idx];
-        }
-        F_x_LR[num_species] = u_x_R*Q_x_R[num_species][idx] + p_x_R[idx];
-        F_x_LR[num_species + 1] = u_x_R*Q_x_R[num_species + 1][idx];
-        F_x_LR[num_species + 2] = u_x_R*(Q_x_R[num_species + 2][idx] + p_x_R[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        Q_x_star_LR[si] = Chi_x_star_LR*Q_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_LR[num_species + 2] +
+        (s_x_star - u_x_LR)*(rho_x_LR*s_x_star + p_x_LR/(s_x_LR - u_x_LR)));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = u_x_LR*Q_x_LR[si];
+    }
+    F_x_LR[num_species] = u_x_LR*Q_x_LR[num_species] + p_x_LR;
+    F_x_LR[num_species + 1] = u_x_LR*Q_x_LR[num_species + 1];
+    F_x_LR[num_species + 2] = u_x_LR*(Q_x_LR[num_species + 2] + p_x_LR);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -200,6 +192,7 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
  * Compute the local convective flux in the x-direction from conservative variables with
  * 3D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
     double** F_x,
@@ -219,20 +212,24 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 4 : num_eqn_runtime);
+    
     u_x_L = Q_x_L[num_species][idx]/rho_x_L[idx];
     u_x_R = Q_x_R[num_species][idx]/rho_x_R[idx];
     
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[num_species][idx]*(s_x_L - u_x_L) - Q_x_R[num_species][idx]*(s_x_R - u_x_R))/
@@ -241,61 +238,49 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_L[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_L[num_species + 2][idx];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_L[num_species + 3][idx] +
-            (s_x_star - u_x_L)*(rho_x_L[idx]*s_x_star + p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_L*Q_x_L[si][idx];
-        }
-        F_x_LR[num_species] = u_x_L*Q_x_L[num_species][idx] + p_x_L[idx];
-        F_x_LR[num_species + 1] = u_x_L*Q_x_L[num_species + 1][idx];
-        F_x_LR[num_species + 2] = u_x_L*Q_x_L[num_species + 2][idx];
-        F_x_LR[num_species + 3] = u_x_L*(Q_x_L[num_species + 3][idx] + p_x_L[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*Q_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_R[num_species + 1][idx];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_R[num_species + 2][idx];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_R[num_species + 3][idx] +
-            (s_x_star - u_x_R)*(rho_x_R[idx]*s_x_star + p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = u_x_R*Q_x_R[si][idx];
-        }
-        F_x_LR[num_species] = u_x_R*Q_x_R[num_species][idx] + p_x_R[idx];
-        F_x_LR[num_species + 1] = u_x_R*Q_x_R[num_species + 1][idx];
-        F_x_LR[num_species + 2] = u_x_R*Q_x_R[num_species + 2][idx];
-        F_x_LR[num_species + 3] = u_x_R*(Q_x_R[num_species + 3][idx] + p_x_R[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        Q_x_star_LR[si] = Chi_x_star_LR*Q_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_LR[num_species + 2];
+    Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_LR[num_species + 3] +
+        (s_x_star - u_x_LR)*(rho_x_LR*s_x_star + p_x_LR/(s_x_LR - u_x_LR)));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = u_x_LR*Q_x_LR[si];
+    }
+    F_x_LR[num_species] = u_x_LR*Q_x_LR[num_species] + p_x_LR;
+    F_x_LR[num_species + 1] = u_x_LR*Q_x_LR[num_species + 1];
+    F_x_LR[num_species + 2] = u_x_LR*Q_x_LR[num_species + 2];
+    F_x_LR[num_species + 3] = u_x_LR*(Q_x_LR[num_species + 3] + p_x_LR);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -304,6 +289,7 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
  * Compute the local convective flux in the y-direction from conservative variables with
  * 2D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
     double** F_y,
@@ -323,20 +309,24 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 3 : num_eqn_runtime);
+    
     v_y_B = Q_y_B[num_species + 1][idx]/rho_y_B[idx];
     v_y_T = Q_y_T[num_species + 1][idx]/rho_y_T[idx];
     
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[num_species + 1][idx]*(s_y_B - v_y_B) - Q_y_T[num_species + 1][idx]*(s_y_T - v_y_T))/
@@ -345,57 +335,47 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
     double Q_y_star_BT[num_eqn];
     double F_y_BT[num_eqn];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_B[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_B[num_species + 2][idx] +
-            (s_y_star - v_y_B)*(rho_y_B[idx]*s_y_star + p_y_B[idx]/(s_y_B - v_y_B)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = v_y_B*Q_y_B[si][idx];
-        }
-        F_y_BT[num_species] = v_y_B*Q_y_B[num_species][idx];
-        F_y_BT[num_species + 1] = v_y_B*Q_y_B[num_species + 1][idx] + p_y_B[idx];
-        F_y_BT[num_species + 2] = v_y_B*(Q_y_B[num_species + 2][idx] + p_y_B[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_T[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_T[num_species + 2][idx] +
-            (s_y_star - v_y_T)*(rho_y_T[idx]*s_y_star + p_y_T[idx]/(s_y_T - v_y_T)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = v_y_T*Q_y_T[si][idx];
-        }
-        F_y_BT[num_species] = v_y_T*Q_y_T[num_species][idx];
-        F_y_BT[num_species + 1] = v_y_T*Q_y_T[num_species + 1][idx] + p_y_T[idx];
-        F_y_BT[num_species + 2] = v_y_T*(Q_y_T[num_species + 2][idx] + p_y_T[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        Q_y_star_BT[si] = Chi_y_star_BT*Q_y_BT[si];
+    }
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_BT[num_species + 2] +
+        (s_y_star - v_y_BT)*(rho_y_BT*s_y_star + p_y_BT/(s_y_BT - v_y_BT)));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_BT[si] = v_y_BT*Q_y_BT[si];
+    }
+    F_y_BT[num_species] = v_y_BT*Q_y_BT[num_species];
+    F_y_BT[num_species + 1] = v_y_BT*Q_y_BT[num_species + 1] + p_y_BT;
+    F_y_BT[num_species + 2] = v_y_BT*(Q_y_BT[num_species + 2] + p_y_BT);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -404,6 +384,7 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
  * Compute the local convective flux in the y-direction from conservative variables with
  * 3D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
     double** F_y,
@@ -423,20 +404,24 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 4 : num_eqn_runtime);
+    
     v_y_B = Q_y_B[num_species + 1][idx]/rho_y_B[idx];
     v_y_T = Q_y_T[num_species + 1][idx]/rho_y_T[idx];
     
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[num_species + 1][idx]*(s_y_B - v_y_B) - Q_y_T[num_species + 1][idx]*(s_y_T - v_y_T))/
@@ -445,61 +430,49 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
     double Q_y_star_BT[num_eqn];
     double F_y_BT[num_eqn];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_B[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_B[num_species + 2][idx];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_B[num_species + 3][idx] +
-            (s_y_star - v_y_B)*(rho_y_B[idx]*s_y_star + p_y_B[idx]/(s_y_B - v_y_B)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = v_y_B*Q_y_B[si][idx];
-        }
-        F_y_BT[num_species] = v_y_B*Q_y_B[num_species][idx];
-        F_y_BT[num_species + 1] = v_y_B*Q_y_B[num_species + 1][idx] + p_y_B[idx];
-        F_y_BT[num_species + 2] = v_y_B*Q_y_B[num_species + 2][idx];
-        F_y_BT[num_species + 3] = v_y_B*(Q_y_B[num_species + 3][idx] + p_y_B[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*Q_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_T[num_species][idx];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_T[num_species + 2][idx];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_T[num_species + 3][idx] +
-            (s_y_star - v_y_T)*(rho_y_T[idx]*s_y_star + p_y_T[idx]/(s_y_T - v_y_T)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = v_y_T*Q_y_T[si][idx];
-        }
-        F_y_BT[num_species] = v_y_T*Q_y_T[num_species][idx];
-        F_y_BT[num_species + 1] = v_y_T*Q_y_T[num_species + 1][idx] + p_y_T[idx];
-        F_y_BT[num_species + 2] = v_y_T*Q_y_T[num_species + 2][idx];
-        F_y_BT[num_species + 3] = v_y_T*(Q_y_T[num_species + 3][idx] + p_y_T[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        Q_y_star_BT[si] = Chi_y_star_BT*Q_y_BT[si];
+    }
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_BT[num_species + 2];
+    Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_BT[num_species + 3] +
+        (s_y_star - v_y_BT)*(rho_y_BT*s_y_star + p_y_BT/(s_y_BT - v_y_BT)));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_BT[si] = v_y_BT*Q_y_BT[si];
+    }
+    F_y_BT[num_species] = v_y_BT*Q_y_BT[num_species];
+    F_y_BT[num_species + 1] = v_y_BT*Q_y_BT[num_species + 1] + p_y_BT;
+    F_y_BT[num_species + 2] = v_y_BT*Q_y_BT[num_species + 2];
+    F_y_BT[num_species + 3] = v_y_BT*(Q_y_BT[num_species + 3] + p_y_BT);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -508,6 +481,7 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
  * Compute the local convective flux in the z-direction from conservative variables with
  * 3D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
     double** F_z,
@@ -527,20 +501,24 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
     double& Chi_z_star_BF,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 4 : num_eqn_runtime);
+    
     w_z_B = Q_z_B[num_species + 2][idx]/rho_z_B[idx];
     w_z_F = Q_z_F[num_species + 2][idx]/rho_z_F[idx];
     
     const double w_z_average = double(1)/double(2)*(w_z_B + w_z_F);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (p_z_F[idx] - p_z_B[idx] +
         Q_z_B[num_species + 2][idx]*(s_z_B - w_z_B) - Q_z_F[num_species + 2][idx]*(s_z_F - w_z_F))/
@@ -549,61 +527,49 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
     double Q_z_star_BF[num_eqn];
     double F_z_BF[num_eqn];
     
-    if (s_z_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double w_z_BF = SIMD_BLEND::blend(mask_upwind_B, w_z_B, w_z_F);
+    const double rho_z_BF = SIMD_BLEND::blend(mask_upwind_B, rho_z_B[idx], rho_z_F[idx]);
+    const double p_z_BF = SIMD_BLEND::blend(mask_upwind_B, p_z_B[idx], p_z_F[idx]);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double Q_z_BF[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_z_star_BF = (s_z_B - w_z_B)/(s_z_B - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*Q_z_B[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_B[num_species][idx];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_B[num_species + 1][idx];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_B[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_B[num_species + 3][idx] +
-            (s_z_star - w_z_B)*(rho_z_B[idx]*s_z_star + p_z_B[idx]/(s_z_B - w_z_B)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_BF[si] = w_z_B*Q_z_B[si][idx];
-        }
-        F_z_BF[num_species] = w_z_B*Q_z_B[num_species][idx];
-        F_z_BF[num_species + 1] = w_z_B*Q_z_B[num_species + 1][idx];
-        F_z_BF[num_species + 2] = w_z_B*Q_z_B[num_species + 2][idx] + p_z_B[idx];
-        F_z_BF[num_species + 3] = w_z_B*(Q_z_B[num_species + 3][idx] + p_z_B[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_B[ei][idx]);
-        }
+        Q_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_z_B[ei][idx], Q_z_F[ei][idx]);
     }
-    else
+    
+    Chi_z_star_BF = (s_z_BF - w_z_BF)/(s_z_BF - s_z_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_z_star_BF = (s_z_F - w_z_F)/(s_z_F - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*Q_z_F[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_F[num_species][idx];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_F[num_species + 1][idx];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_F[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_F[num_species + 3][idx] +
-            (s_z_star - w_z_F)*(rho_z_F[idx]*s_z_star + p_z_F[idx]/(s_z_F - w_z_F)));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_BF[si] = w_z_F*Q_z_F[si][idx];
-        }
-        F_z_BF[num_species] = w_z_F*Q_z_F[num_species][idx];
-        F_z_BF[num_species + 1] = w_z_F*Q_z_F[num_species + 1][idx];
-        F_z_BF[num_species + 2] = w_z_F*Q_z_F[num_species + 2][idx] + p_z_F[idx];
-        F_z_BF[num_species + 3] = w_z_F*(Q_z_F[num_species + 3][idx] + p_z_F[idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_F[ei][idx]);
-        }
+        Q_z_star_BF[si] = Chi_z_star_BF*Q_z_BF[si];
+    }
+    Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_BF[num_species];
+    Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_BF[num_species + 1];
+    Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_BF*s_z_star;
+    Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_BF[num_species + 3] +
+        (s_z_star - w_z_BF)*(rho_z_BF*s_z_star + p_z_BF/(s_z_BF - w_z_BF)));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_z_BF[si] = w_z_BF*Q_z_BF[si];
+    }
+    F_z_BF[num_species] = w_z_BF*Q_z_BF[num_species];
+    F_z_BF[num_species + 1] = w_z_BF*Q_z_BF[num_species + 1];
+    F_z_BF[num_species + 2] = w_z_BF*Q_z_BF[num_species + 2] + p_z_BF;
+    F_z_BF[num_species + 3] = w_z_BF*(Q_z_BF[num_species + 3] + p_z_BF);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
 }
 
@@ -612,6 +578,7 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
  * Compute the local convective flux in the x-direction from primitive variables with
  * 1D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
     double** F_x,
@@ -629,17 +596,21 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 2 : num_eqn_runtime);
+    
     const double u_x_average = double(1)/double(2)*(V_x_L[num_species][idx] + V_x_R[num_species][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[num_species + 1][idx] - V_x_L[num_species + 1][idx] +
         rho_x_L[idx]*V_x_L[num_species][idx]*(s_x_L - V_x_L[num_species][idx]) -
@@ -651,71 +622,54 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[num_species][idx])/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_L[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_L[idx]*V_x_L[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_L[idx]*(epsilon_x_L[idx] +
-            double(1)/double(2)*V_x_L[num_species][idx]*V_x_L[num_species][idx]);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
-            (s_x_star - V_x_L[num_species][idx])*(rho_x_L[idx]*s_x_star + V_x_L[num_species + 1][idx]/
-            (s_x_L - V_x_L[num_species][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_L[num_species][idx]*V_x_L[si][idx];
-        }
-        F_x_LR[num_species] = V_x_L[num_species][idx]*Q_x_LR[num_species] + V_x_L[num_species + 1][idx];
-        F_x_LR[num_species + 1] = V_x_L[num_species][idx]*(Q_x_LR[num_species + 1] + V_x_L[num_species + 1][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[num_species])/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[num_species][idx])/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_R[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_R[idx]*V_x_R[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_R[idx]*(epsilon_x_R[idx] +
-            double(1)/double(2)*V_x_R[num_species][idx]*V_x_R[num_species][idx]);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
-            (s_x_star - V_x_R[num_species][idx])*(rho_x_R[idx]*s_x_star + V_x_R[num_species + 1][idx]/
-            (s_x_R - V_x_R[num_species][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_R[num_species][idx]*V_x_R[si][idx];
-        }
-        F_x_LR[num_species] = V_x_R[num_species][idx]*Q_x_LR[num_species] + V_x_R[num_species + 1][idx];
-        F_x_LR[num_species + 1] = V_x_R[num_species][idx]*(Q_x_LR[num_species + 1] + V_x_R[num_species + 1][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        Q_x_LR[si] = V_x_LR[si];
+    }
+    Q_x_LR[num_species] = rho_x_LR*V_x_LR[num_species];
+    Q_x_LR[num_species + 1] = rho_x_LR*(epsilon_x_LR +
+        double(1)/double(2)*V_x_LR[num_species]*V_x_LR[num_species]);
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_x_star_LR[si] = Chi_x_star_LR*V_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*(Q_x_LR[num_species + 1] +
+        (s_x_star - V_x_LR[num_species])*(rho_x_LR*s_x_star + V_x_LR[num_species + 1]/
+        (s_x_LR - V_x_LR[num_species])));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = V_x_LR[num_species]*V_x_LR[si];
+    }
+    F_x_LR[num_species] = V_x_LR[num_species]*Q_x_LR[num_species] + V_x_LR[num_species + 1];
+    F_x_LR[num_species + 1] = V_x_LR[num_species]*(Q_x_LR[num_species + 1] + V_x_LR[num_species + 1]);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -724,6 +678,7 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
  * Compute the local convective flux in the x-direction from primitive variables with
  * 2D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
     double** F_x,
@@ -741,17 +696,21 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 3 : num_eqn_runtime);
+    
     const double u_x_average = double(1)/double(2)*(V_x_L[num_species][idx] + V_x_R[num_species][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[num_species + 2][idx] - V_x_L[num_species + 2][idx] +
         rho_x_L[idx]*V_x_L[num_species][idx]*(s_x_L - V_x_L[num_species][idx]) -
@@ -763,79 +722,58 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[num_species][idx])/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_L[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_L[idx]*V_x_L[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_L[idx]*V_x_L[num_species + 1][idx];
-        Q_x_LR[num_species + 2] = rho_x_L[idx]*(epsilon_x_L[idx] +
-            double(1)/double(2)*(V_x_L[num_species][idx]*V_x_L[num_species][idx] +
-            V_x_L[num_species + 1][idx]*V_x_L[num_species + 1][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_LR[num_species + 2] +
-            (s_x_star - V_x_L[num_species][idx])*(rho_x_L[idx]*s_x_star + V_x_L[num_species + 2][idx]/
-            (s_x_L - V_x_L[num_species][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_L[num_species][idx]*V_x_L[si][idx];
-        }
-        F_x_LR[num_species] = V_x_L[num_species][idx]*Q_x_LR[num_species] + V_x_L[num_species + 2][idx];
-        F_x_LR[num_species + 1] = V_x_L[num_species][idx]*Q_x_LR[num_species + 1];
-        F_x_LR[num_species + 2] = V_x_L[num_species][idx]*(Q_x_LR[num_species + 2] + V_x_L[num_species + 2][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[num_species])/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[num_species][idx])/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_R[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_R[idx]*V_x_R[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_R[idx]*V_x_R[num_species + 1][idx];
-        Q_x_LR[num_species + 2] = rho_x_R[idx]*(epsilon_x_R[idx] +
-            double(1)/double(2)*(V_x_R[num_species][idx]*V_x_R[num_species][idx] +
-            V_x_R[num_species + 1][idx]*V_x_R[num_species + 1][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_LR[num_species + 2] +
-            (s_x_star - V_x_R[num_species][idx])*(rho_x_R[idx]*s_x_star + V_x_R[num_species + 2][idx]/
-            (s_x_R - V_x_R[num_species][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_R[num_species][idx]*V_x_R[si][idx];
-        }
-        F_x_LR[num_species] = V_x_R[num_species][idx]*Q_x_LR[num_species] + V_x_R[num_species + 2][idx];
-        F_x_LR[num_species + 1] = V_x_R[num_species][idx]*Q_x_LR[num_species + 1];
-        F_x_LR[num_species + 2] = V_x_R[num_species][idx]*(Q_x_LR[num_species + 2] + V_x_R[num_species + 2][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        Q_x_LR[si] = V_x_LR[si];
+    }
+    Q_x_LR[num_species] = rho_x_LR*V_x_LR[num_species];
+    Q_x_LR[num_species + 1] = rho_x_LR*V_x_LR[num_species + 1];
+    Q_x_LR[num_species + 2] = rho_x_LR*(epsilon_x_LR +
+        double(1)/double(2)*(V_x_LR[num_species]*V_x_LR[num_species] +
+        V_x_LR[num_species + 1]*V_x_LR[num_species + 1]));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_x_star_LR[si] = Chi_x_star_LR*V_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*(Q_x_LR[num_species + 2] +
+        (s_x_star - V_x_LR[num_species])*(rho_x_LR*s_x_star + V_x_LR[num_species + 2]/
+        (s_x_LR - V_x_LR[num_species])));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = V_x_LR[num_species]*V_x_LR[si];
+    }
+    F_x_LR[num_species] = V_x_LR[num_species]*Q_x_LR[num_species] + V_x_LR[num_species + 2];
+    F_x_LR[num_species + 1] = V_x_LR[num_species]*Q_x_LR[num_species + 1];
+    F_x_LR[num_species + 2] = V_x_LR[num_species]*(Q_x_LR[num_species + 2] + V_x_LR[num_species + 2]);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -844,6 +782,7 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
  * Compute the local convective flux in the x-direction from primitive variables with
  * 3D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
     double** F_x,
@@ -861,17 +800,21 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
     double& Chi_x_star_LR,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 4 : num_eqn_runtime);
+    
     const double u_x_average = double(1)/double(2)*(V_x_L[num_species][idx] + V_x_R[num_species][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[num_species][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[num_species][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[num_species + 3][idx] - V_x_L[num_species + 3][idx] +
         rho_x_L[idx]*V_x_L[num_species][idx]*(s_x_L - V_x_L[num_species][idx]) -
@@ -883,87 +826,62 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
     double Q_x_star_LR[num_eqn];
     double F_x_LR[num_eqn];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double rho_x_LR = SIMD_BLEND::blend(mask_upwind_L, rho_x_L[idx], rho_x_R[idx]);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[num_species][idx])/(s_x_L - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_L[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_L[idx]*V_x_L[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_L[idx]*V_x_L[num_species + 1][idx];
-        Q_x_LR[num_species + 2] = rho_x_L[idx]*V_x_L[num_species + 2][idx];
-        Q_x_LR[num_species + 3] = rho_x_L[idx]*(epsilon_x_L[idx] +
-            double(1)/double(2)*(V_x_L[num_species][idx]*V_x_L[num_species][idx] +
-            V_x_L[num_species + 1][idx]*V_x_L[num_species + 1][idx] +
-            V_x_L[num_species + 2][idx]*V_x_L[num_species + 2][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_L[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_L[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_LR[num_species + 2];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_LR[num_species + 3] +
-            (s_x_star - V_x_L[num_species][idx])*(rho_x_L[idx]*s_x_star + V_x_L[num_species + 3][idx]/
-            (s_x_L - V_x_L[num_species][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_L[num_species][idx]*V_x_L[si][idx];
-        }
-        F_x_LR[num_species] = V_x_L[num_species][idx]*Q_x_LR[num_species] + V_x_L[num_species + 3][idx];
-        F_x_LR[num_species + 1] = V_x_L[num_species][idx]*Q_x_LR[num_species + 1];
-        F_x_LR[num_species + 2] = V_x_L[num_species][idx]*Q_x_LR[num_species + 2];
-        F_x_LR[num_species + 3] = V_x_L[num_species][idx]*(Q_x_LR[num_species + 3] + V_x_L[num_species + 3][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[num_species])/(s_x_LR - s_x_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[num_species][idx])/(s_x_R - s_x_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_LR[si] = V_x_R[si][idx];
-        }
-        Q_x_LR[num_species] = rho_x_R[idx]*V_x_R[num_species][idx];
-        Q_x_LR[num_species + 1] = rho_x_R[idx]*V_x_R[num_species + 1][idx];
-        Q_x_LR[num_species + 2] = rho_x_R[idx]*V_x_R[num_species + 2][idx];
-        Q_x_LR[num_species + 3] = rho_x_R[idx]*(epsilon_x_R[idx] +
-            double(1)/double(2)*(V_x_R[num_species][idx]*V_x_R[num_species][idx] +
-            V_x_R[num_species + 1][idx]*V_x_R[num_species + 1][idx] +
-            V_x_R[num_species + 2][idx]*V_x_R[num_species + 2][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_x_star_LR[si] = Chi_x_star_LR*V_x_R[si][idx];
-        }
-        Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_R[idx]*s_x_star;
-        Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
-        Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_LR[num_species + 2];
-        Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_LR[num_species + 3] +
-            (s_x_star - V_x_R[num_species][idx])*(rho_x_R[idx]*s_x_star + V_x_R[num_species + 3][idx]/
-            (s_x_R - V_x_R[num_species][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_x_LR[si] = V_x_R[num_species][idx]*V_x_R[si][idx];
-        }
-        F_x_LR[num_species] = V_x_R[num_species][idx]*Q_x_LR[num_species] + V_x_R[num_species + 3][idx];
-        F_x_LR[num_species + 1] = V_x_R[num_species][idx]*Q_x_LR[num_species + 1];
-        F_x_LR[num_species + 2] = V_x_R[num_species][idx]*Q_x_LR[num_species + 2];
-        F_x_LR[num_species + 3] = V_x_R[num_species][idx]*(Q_x_LR[num_species + 3] + V_x_R[num_species + 3][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        Q_x_LR[si] = V_x_LR[si];
+    }
+    Q_x_LR[num_species] = rho_x_LR*V_x_LR[num_species];
+    Q_x_LR[num_species + 1] = rho_x_LR*V_x_LR[num_species + 1];
+    Q_x_LR[num_species + 2] = rho_x_LR*V_x_LR[num_species + 2];
+    Q_x_LR[num_species + 3] = rho_x_LR*(epsilon_x_LR +
+        double(1)/double(2)*(V_x_LR[num_species]*V_x_LR[num_species] +
+        V_x_LR[num_species + 1]*V_x_LR[num_species + 1] +
+        V_x_LR[num_species + 2]*V_x_LR[num_species + 2]));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_x_star_LR[si] = Chi_x_star_LR*V_x_LR[si];
+    }
+    Q_x_star_LR[num_species] = Chi_x_star_LR*rho_x_LR*s_x_star;
+    Q_x_star_LR[num_species + 1] = Chi_x_star_LR*Q_x_LR[num_species + 1];
+    Q_x_star_LR[num_species + 2] = Chi_x_star_LR*Q_x_LR[num_species + 2];
+    Q_x_star_LR[num_species + 3] = Chi_x_star_LR*(Q_x_LR[num_species + 3] +
+        (s_x_star - V_x_LR[num_species])*(rho_x_LR*s_x_star + V_x_LR[num_species + 3]/
+        (s_x_LR - V_x_LR[num_species])));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_x_LR[si] = V_x_LR[num_species]*V_x_LR[si];
+    }
+    F_x_LR[num_species] = V_x_LR[num_species]*Q_x_LR[num_species] + V_x_LR[num_species + 3];
+    F_x_LR[num_species + 1] = V_x_LR[num_species]*Q_x_LR[num_species + 1];
+    F_x_LR[num_species + 2] = V_x_LR[num_species]*Q_x_LR[num_species + 2];
+    F_x_LR[num_species + 3] = V_x_LR[num_species]*(Q_x_LR[num_species + 3] + V_x_LR[num_species + 3]);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -972,6 +890,7 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
  * Compute the local convective flux in the y-direction from primitive variables with
  * 2D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
     double** F_y,
@@ -989,17 +908,21 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 3 : num_eqn_runtime);
+    
     const double v_y_average = double(1)/double(2)*(V_y_B[num_species + 1][idx] + V_y_T[num_species + 1][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[num_species + 2][idx] - V_y_B[num_species + 2][idx] +
         rho_y_B[idx]*V_y_B[num_species + 1][idx]*(s_y_B - V_y_B[num_species + 1][idx]) -
@@ -1011,79 +934,58 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
     double Q_y_star_BT[num_eqn];
     double F_y_BT[num_eqn];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double epsilon_y_BT = SIMD_BLEND::blend(mask_upwind_B, epsilon_y_B[idx],
+        epsilon_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[num_species + 1][idx])/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_BT[si] = V_y_B[si][idx];
-        }
-        Q_y_BT[num_species] = rho_y_B[idx]*V_y_B[num_species][idx];
-        Q_y_BT[num_species + 1] = rho_y_B[idx]*V_y_B[num_species + 1][idx];
-        Q_y_BT[num_species + 2] = rho_y_B[idx]*(epsilon_y_B[idx] +
-            double(1)/double(2)*(V_y_B[num_species][idx]*V_y_B[num_species][idx] +
-            V_y_B[num_species + 1][idx]*V_y_B[num_species + 1][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_BT[num_species + 2] +
-            (s_y_star - V_y_B[num_species + 1][idx])*(rho_y_B[idx]*s_y_star + V_y_B[num_species + 2][idx]/
-            (s_y_B - V_y_B[num_species + 1][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = V_y_B[num_species + 1][idx]*V_y_B[si][idx];
-        }
-        F_y_BT[num_species] = V_y_B[num_species + 1][idx]*Q_y_BT[num_species];
-        F_y_BT[num_species + 1] = V_y_B[num_species + 1][idx]*Q_y_BT[num_species + 1] + V_y_B[num_species + 2][idx];
-        F_y_BT[num_species + 2] = V_y_B[num_species + 1][idx]*(Q_y_BT[num_species + 2] + V_y_B[num_species + 2][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - V_y_BT[num_species + 1])/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[num_species + 1][idx])/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_BT[si] = V_y_T[si][idx];
-        }
-        Q_y_BT[num_species] = rho_y_T[idx]*V_y_T[num_species][idx];
-        Q_y_BT[num_species + 1] = rho_y_T[idx]*V_y_T[num_species + 1][idx];
-        Q_y_BT[num_species + 2] = rho_y_T[idx]*(epsilon_y_T[idx] +
-            double(1)/double(2)*(V_y_T[num_species][idx]*V_y_T[num_species][idx] +
-            V_y_T[num_species + 1][idx]*V_y_T[num_species + 1][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_BT[num_species + 2] +
-            (s_y_star - V_y_T[num_species + 1][idx])*(rho_y_T[idx]*s_y_star + V_y_T[num_species + 2][idx]/
-            (s_y_T - V_y_T[num_species + 1][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = V_y_T[num_species + 1][idx]*V_y_T[si][idx];
-        }
-        F_y_BT[num_species] = V_y_T[num_species + 1][idx]*Q_y_BT[num_species];
-        F_y_BT[num_species + 1] = V_y_T[num_species + 1][idx]*Q_y_BT[num_species + 1] + V_y_T[num_species + 2][idx];
-        F_y_BT[num_species + 2] = V_y_T[num_species + 1][idx]*(Q_y_BT[num_species + 2] + V_y_T[num_species + 2][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        Q_y_BT[si] = V_y_BT[si];
+    }
+    Q_y_BT[num_species] = rho_y_BT*V_y_BT[num_species];
+    Q_y_BT[num_species + 1] = rho_y_BT*V_y_BT[num_species + 1];
+    Q_y_BT[num_species + 2] = rho_y_BT*(epsilon_y_BT +
+        double(1)/double(2)*(V_y_BT[num_species]*V_y_BT[num_species] +
+        V_y_BT[num_species + 1]*V_y_BT[num_species + 1]));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_y_star_BT[si] = Chi_y_star_BT*V_y_BT[si];
+    }
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*(Q_y_BT[num_species + 2] +
+        (s_y_star - V_y_BT[num_species + 1])*(rho_y_BT*s_y_star + V_y_BT[num_species + 2]/
+        (s_y_BT - V_y_BT[num_species + 1])));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_BT[si] = V_y_BT[num_species + 1]*V_y_BT[si];
+    }
+    F_y_BT[num_species] = V_y_BT[num_species + 1]*Q_y_BT[num_species];
+    F_y_BT[num_species + 1] = V_y_BT[num_species + 1]*Q_y_BT[num_species + 1] + V_y_BT[num_species + 2];
+    F_y_BT[num_species + 2] = V_y_BT[num_species + 1]*(Q_y_BT[num_species + 2] + V_y_BT[num_species + 2]);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -1092,6 +994,7 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
  * Compute the local convective flux in the y-direction from primitive variables with
  * 3D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
     double** F_y,
@@ -1109,17 +1012,21 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
     double& Chi_y_star_BT,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 4 : num_eqn_runtime);
+    
     const double v_y_average = double(1)/double(2)*(V_y_B[num_species + 1][idx] + V_y_T[num_species + 1][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[num_species + 1][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[num_species + 1][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[num_species + 3][idx] - V_y_B[num_species + 3][idx] +
         rho_y_B[idx]*V_y_B[num_species + 1][idx]*(s_y_B - V_y_B[num_species + 1][idx]) -
@@ -1131,87 +1038,62 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
     double Q_y_star_BT[num_eqn];
     double F_y_BT[num_eqn];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double rho_y_BT = SIMD_BLEND::blend(mask_upwind_B, rho_y_B[idx], rho_y_T[idx]);
+    const double epsilon_y_BT = SIMD_BLEND::blend(mask_upwind_B, epsilon_y_B[idx],
+        epsilon_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[num_species + 1][idx])/(s_y_B - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_BT[si] = V_y_B[si][idx];
-        }
-        Q_y_BT[num_species] = rho_y_B[idx]*V_y_B[num_species][idx];
-        Q_y_BT[num_species + 1] = rho_y_B[idx]*V_y_B[num_species + 1][idx];
-        Q_y_BT[num_species + 2] = rho_y_B[idx]*V_y_B[num_species + 2][idx];
-        Q_y_BT[num_species + 3] = rho_y_B[idx]*(epsilon_y_B[idx] +
-            double(1)/double(2)*(V_y_B[num_species][idx]*V_y_B[num_species][idx] +
-            V_y_B[num_species + 1][idx]*V_y_B[num_species + 1][idx] +
-            V_y_B[num_species + 2][idx]*V_y_B[num_species + 2][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_B[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_B[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_BT[num_species + 2];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_BT[num_species + 3] +
-            (s_y_star - V_y_B[num_species + 1][idx])*(rho_y_B[idx]*s_y_star + V_y_B[num_species + 3][idx]/
-            (s_y_B - V_y_B[num_species + 1][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = V_y_B[num_species + 1][idx]*V_y_B[si][idx];
-        }
-        F_y_BT[num_species] = V_y_B[num_species + 1][idx]*Q_y_BT[num_species];
-        F_y_BT[num_species + 1] = V_y_B[num_species + 1][idx]*Q_y_BT[num_species + 1] + V_y_B[num_species + 3][idx];
-        F_y_BT[num_species + 2] = V_y_B[num_species + 1][idx]*Q_y_BT[num_species + 2];
-        F_y_BT[num_species + 3] = V_y_B[num_species + 1][idx]*(Q_y_BT[num_species + 3] + V_y_B[num_species + 3][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - V_y_BT[num_species + 1])/(s_y_BT - s_y_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[num_species + 1][idx])/(s_y_T - s_y_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_BT[si] = V_y_T[si][idx];
-        }
-        Q_y_BT[num_species] = rho_y_T[idx]*V_y_T[num_species][idx];
-        Q_y_BT[num_species + 1] = rho_y_T[idx]*V_y_T[num_species + 1][idx];
-        Q_y_BT[num_species + 2] = rho_y_T[idx]*V_y_T[num_species + 2][idx];
-        Q_y_BT[num_species + 3] = rho_y_T[idx]*(epsilon_y_T[idx] +
-            double(1)/double(2)*(V_y_T[num_species][idx]*V_y_T[num_species][idx] +
-            V_y_T[num_species + 1][idx]*V_y_T[num_species + 1][idx] +
-            V_y_T[num_species + 2][idx]*V_y_T[num_species + 2][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_y_star_BT[si] = Chi_y_star_BT*V_y_T[si][idx];
-        }
-        Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
-        Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_T[idx]*s_y_star;
-        Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_BT[num_species + 2];
-        Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_BT[num_species + 3] +
-            (s_y_star - V_y_T[num_species + 1][idx])*(rho_y_T[idx]*s_y_star + V_y_T[num_species + 3][idx]/
-            (s_y_T - V_y_T[num_species + 1][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_y_BT[si] = V_y_T[num_species + 1][idx]*V_y_T[si][idx];
-        }
-        F_y_BT[num_species] = V_y_T[num_species + 1][idx]*Q_y_BT[num_species];
-        F_y_BT[num_species + 1] = V_y_T[num_species + 1][idx]*Q_y_BT[num_species + 1] + V_y_T[num_species + 3][idx];
-        F_y_BT[num_species + 2] = V_y_T[num_species + 1][idx]*Q_y_BT[num_species + 2];
-        F_y_BT[num_species + 3] = V_y_T[num_species + 1][idx]*(Q_y_BT[num_species + 3] + V_y_T[num_species + 3][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        Q_y_BT[si] = V_y_BT[si];
+    }
+    Q_y_BT[num_species] = rho_y_BT*V_y_BT[num_species];
+    Q_y_BT[num_species + 1] = rho_y_BT*V_y_BT[num_species + 1];
+    Q_y_BT[num_species + 2] = rho_y_BT*V_y_BT[num_species + 2];
+    Q_y_BT[num_species + 3] = rho_y_BT*(epsilon_y_BT +
+        double(1)/double(2)*(V_y_BT[num_species]*V_y_BT[num_species] +
+        V_y_BT[num_species + 1]*V_y_BT[num_species + 1] +
+        V_y_BT[num_species + 2]*V_y_BT[num_species + 2]));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_y_star_BT[si] = Chi_y_star_BT*V_y_BT[si];
+    }
+    Q_y_star_BT[num_species] = Chi_y_star_BT*Q_y_BT[num_species];
+    Q_y_star_BT[num_species + 1] = Chi_y_star_BT*rho_y_BT*s_y_star;
+    Q_y_star_BT[num_species + 2] = Chi_y_star_BT*Q_y_BT[num_species + 2];
+    Q_y_star_BT[num_species + 3] = Chi_y_star_BT*(Q_y_BT[num_species + 3] +
+        (s_y_star - V_y_BT[num_species + 1])*(rho_y_BT*s_y_star + V_y_BT[num_species + 3]/
+        (s_y_BT - V_y_BT[num_species + 1])));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_y_BT[si] = V_y_BT[num_species + 1]*V_y_BT[si];
+    }
+    F_y_BT[num_species] = V_y_BT[num_species + 1]*Q_y_BT[num_species];
+    F_y_BT[num_species + 1] = V_y_BT[num_species + 1]*Q_y_BT[num_species + 1] + V_y_BT[num_species + 3];
+    F_y_BT[num_species + 2] = V_y_BT[num_species + 1]*Q_y_BT[num_species + 2];
+    F_y_BT[num_species + 3] = V_y_BT[num_species + 1]*(Q_y_BT[num_species + 3] + V_y_BT[num_species + 3]);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -1220,6 +1102,7 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
  * Compute the local convective flux in the z-direction from primitive variables with
  * 3D HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 static inline __attribute__((always_inline)) void
 computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
     double** F_z,
@@ -1237,17 +1120,21 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
     double& Chi_z_star_BF,
     const int& idx_flux,
     const int& idx,
-    const int& num_species,
-    const int& num_eqn)
+    const int& num_species_runtime,
+    const int& num_eqn_runtime)
 {
+    // The numbers of species and equations are known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_eqn = (NUM_SPECIES > 0 ? NUM_SPECIES + 4 : num_eqn_runtime);
+    
     const double w_z_average = double(1)/double(2)*(V_z_B[num_species + 2][idx] + V_z_F[num_species + 2][idx]);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, V_z_B[num_species + 2][idx] - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, V_z_F[num_species + 2][idx] + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, V_z_B[num_species + 2][idx] - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, V_z_F[num_species + 2][idx] + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (V_z_F[num_species + 3][idx] - V_z_B[num_species + 3][idx] +
         rho_z_B[idx]*V_z_B[num_species + 2][idx]*(s_z_B - V_z_B[num_species + 2][idx]) -
@@ -1259,87 +1146,62 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
     double Q_z_star_BF[num_eqn];
     double F_z_BF[num_eqn];
     
-    if (s_z_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double rho_z_BF = SIMD_BLEND::blend(mask_upwind_B, rho_z_B[idx], rho_z_F[idx]);
+    const double epsilon_z_BF = SIMD_BLEND::blend(mask_upwind_B, epsilon_z_B[idx],
+        epsilon_z_F[idx]);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double V_z_BF[num_eqn];
+    for (int ei = 0; ei < num_eqn; ei++)
     {
-        Chi_z_star_BF = (s_z_B - V_z_B[num_species + 2][idx])/(s_z_B - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_BF[si] = V_z_B[si][idx];
-        }
-        Q_z_BF[num_species] = rho_z_B[idx]*V_z_B[num_species][idx];
-        Q_z_BF[num_species + 1] = rho_z_B[idx]*V_z_B[num_species + 1][idx];
-        Q_z_BF[num_species + 2] = rho_z_B[idx]*V_z_B[num_species + 2][idx];
-        Q_z_BF[num_species + 3] = rho_z_B[idx]*(epsilon_z_B[idx] +
-            double(1)/double(2)*(V_z_B[num_species][idx]*V_z_B[num_species][idx] +
-            V_z_B[num_species + 1][idx]*V_z_B[num_species + 1][idx] +
-            V_z_B[num_species + 2][idx]*V_z_B[num_species + 2][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*V_z_B[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_BF[num_species];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_BF[num_species + 1];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_B[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_BF[num_species + 3] +
-            (s_z_star - V_z_B[num_species + 2][idx])*(rho_z_B[idx]*s_z_star + V_z_B[num_species + 3][idx]/
-            (s_z_B - V_z_B[num_species + 2][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_BF[si] = V_z_B[num_species + 2][idx]*V_z_B[si][idx];
-        }
-        F_z_BF[num_species] = V_z_B[num_species + 2][idx]*Q_z_BF[num_species];
-        F_z_BF[num_species + 1] = V_z_B[num_species + 2][idx]*Q_z_BF[num_species + 1];
-        F_z_BF[num_species + 2] = V_z_B[num_species + 2][idx]*Q_z_BF[num_species + 2] + V_z_B[num_species + 3][idx];
-        F_z_BF[num_species + 3] = V_z_B[num_species + 2][idx]*(Q_z_BF[num_species + 3] + V_z_B[num_species + 3][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
-        }
+        V_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, V_z_B[ei][idx], V_z_F[ei][idx]);
     }
-    else
+    
+    Chi_z_star_BF = (s_z_BF - V_z_BF[num_species + 2])/(s_z_BF - s_z_star);
+    
+    for (int si = 0; si < num_species; si++)
     {
-        Chi_z_star_BF = (s_z_F - V_z_F[num_species + 2][idx])/(s_z_F - s_z_star);
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_BF[si] = V_z_F[si][idx];
-        }
-        Q_z_BF[num_species] = rho_z_F[idx]*V_z_F[num_species][idx];
-        Q_z_BF[num_species + 1] = rho_z_F[idx]*V_z_F[num_species + 1][idx];
-        Q_z_BF[num_species + 2] = rho_z_F[idx]*V_z_F[num_species + 2][idx];
-        Q_z_BF[num_species + 3] = rho_z_F[idx]*(epsilon_z_F[idx] +
-            double(1)/double(2)*(V_z_F[num_species][idx]*V_z_F[num_species][idx] +
-            V_z_F[num_species + 1][idx]*V_z_F[num_species + 1][idx] +
-            V_z_F[num_species + 2][idx]*V_z_F[num_species + 2][idx]));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            Q_z_star_BF[si] = Chi_z_star_BF*V_z_F[si][idx];
-        }
-        Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_BF[num_species];
-        Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_BF[num_species + 1];
-        Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_F[idx]*s_z_star;
-        Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_BF[num_species + 3] +
-            (s_z_star - V_z_F[num_species + 2][idx])*(rho_z_F[idx]*s_z_star + V_z_F[num_species + 3][idx]/
-            (s_z_F - V_z_F[num_species + 2][idx])));
-        
-        for (int si = 0; si < num_species; si++)
-        {
-            F_z_BF[si] = V_z_F[num_species + 2][idx]*V_z_F[si][idx];
-        }
-        F_z_BF[num_species] = V_z_F[num_species + 2][idx]*Q_z_BF[num_species];
-        F_z_BF[num_species + 1] = V_z_F[num_species + 2][idx]*Q_z_BF[num_species + 1];
-        F_z_BF[num_species + 2] = V_z_F[num_species + 2][idx]*Q_z_BF[num_species + 2] + V_z_F[num_species + 3][idx];
-        F_z_BF[num_species + 3] = V_z_F[num_species + 2][idx]*(Q_z_BF[num_species + 3] + V_z_F[num_species + 3][idx]);
-        
-        for (int ei = 0; ei < num_eqn; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
-        }
+        Q_z_BF[si] = V_z_BF[si];
+    }
+    Q_z_BF[num_species] = rho_z_BF*V_z_BF[num_species];
+    Q_z_BF[num_species + 1] = rho_z_BF*V_z_BF[num_species + 1];
+    Q_z_BF[num_species + 2] = rho_z_BF*V_z_BF[num_species + 2];
+    Q_z_BF[num_species + 3] = rho_z_BF*(epsilon_z_BF +
+        double(1)/double(2)*(V_z_BF[num_species]*V_z_BF[num_species] +
+        V_z_BF[num_species + 1]*V_z_BF[num_species + 1] +
+        V_z_BF[num_species + 2]*V_z_BF[num_species + 2]));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        Q_z_star_BF[si] = Chi_z_star_BF*V_z_BF[si];
+    }
+    Q_z_star_BF[num_species] = Chi_z_star_BF*Q_z_BF[num_species];
+    Q_z_star_BF[num_species + 1] = Chi_z_star_BF*Q_z_BF[num_species + 1];
+    Q_z_star_BF[num_species + 2] = Chi_z_star_BF*rho_z_BF*s_z_star;
+    Q_z_star_BF[num_species + 3] = Chi_z_star_BF*(Q_z_BF[num_species + 3] +
+        (s_z_star - V_z_BF[num_species + 2])*(rho_z_BF*s_z_star + V_z_BF[num_species + 3]/
+        (s_z_BF - V_z_BF[num_species + 2])));
+    
+    for (int si = 0; si < num_species; si++)
+    {
+        F_z_BF[si] = V_z_BF[num_species + 2]*V_z_BF[si];
+    }
+    F_z_BF[num_species] = V_z_BF[num_species + 2]*Q_z_BF[num_species];
+    F_z_BF[num_species + 1] = V_z_BF[num_species + 2]*Q_z_BF[num_species + 1];
+    F_z_BF[num_species + 2] = V_z_BF[num_species + 2]*Q_z_BF[num_species + 2] + V_z_BF[num_species + 3];
+    F_z_BF[num_species + 3] = V_z_BF[num_species + 2]*(Q_z_BF[num_species + 3] + V_z_BF[num_species + 3]);
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
 }
 
@@ -1348,6 +1210,7 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
  * Compute the convective flux and velocity in the x-direction from conservative variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -1434,59 +1297,59 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_L(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_R(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_L(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_R(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     /*
@@ -1528,15 +1391,6 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
     double* c_x_L = sound_speed_x_L->getPointer(0, 0);
     double* c_x_R = sound_speed_x_R->getPointer(0, 0);
     
-    double u_x_L = double(0);
-    double u_x_R = double(0);
-    
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -1775,7 +1629,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D<NUM_SPECIES>(
                     F_x.data(),
                     Q_x_L.data(),
                     Q_x_R.data(),
@@ -1796,14 +1654,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                     d_num_species,
                     num_eqn);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                    u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -1817,7 +1670,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D<NUM_SPECIES>(
                     F_x.data(),
                     Q_x_L.data(),
                     Q_x_R.data(),
@@ -2138,7 +1995,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D<NUM_SPECIES>(
                         F_x.data(),
                         Q_x_L.data(),
                         Q_x_R.data(),
@@ -2159,14 +2020,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                         d_num_species,
                         num_eqn);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                        u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -2186,7 +2042,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D<NUM_SPECIES>(
                         F_x.data(),
                         Q_x_L.data(),
                         Q_x_R.data(),
@@ -2576,7 +2436,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D<NUM_SPECIES>(
                             F_x.data(),
                             Q_x_L.data(),
                             Q_x_R.data(),
@@ -2597,14 +2461,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                             d_num_species,
                             num_eqn);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                            u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -2631,7 +2490,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D<NUM_SPECIES>(
                             F_x.data(),
                             Q_x_L.data(),
                             Q_x_R.data(),
@@ -2663,6 +2526,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
  * Compute the convective flux and velocity in the y-direction from conservative variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -2749,59 +2613,59 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_T(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_T(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     /*
@@ -2843,15 +2707,6 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
     double* c_y_B = sound_speed_y_B->getPointer(1, 0);
     double* c_y_T = sound_speed_y_T->getPointer(1, 0);
     
-    double v_y_B = double(0);
-    double v_y_T = double(0);
-    
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -3158,7 +3013,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D<NUM_SPECIES>(
                         F_y.data(),
                         Q_y_B.data(),
                         Q_y_T.data(),
@@ -3179,14 +3038,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                         d_num_species,
                         num_eqn);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                        v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -3206,7 +3060,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D<NUM_SPECIES>(
                         F_y.data(),
                         Q_y_B.data(),
                         Q_y_T.data(),
@@ -3596,7 +3454,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D<NUM_SPECIES>(
                             F_y.data(),
                             Q_y_B.data(),
                             Q_y_T.data(),
@@ -3617,14 +3479,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                             d_num_species,
                             num_eqn);
 
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                            v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -3651,7 +3508,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D<NUM_SPECIES>(
                             F_y.data(),
                             Q_y_B.data(),
                             Q_y_T.data(),
@@ -3683,6 +3544,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
  * Compute the convective flux and velocity in the z-direction from conservative variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -3769,59 +3631,59 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_F(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_F(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_conservative_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     /*
@@ -3863,15 +3725,6 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
     double* c_z_B = sound_speed_z_B->getPointer(2, 0);
     double* c_z_F = sound_speed_z_F->getPointer(2, 0);
     
-    double w_z_B = double(0);
-    double w_z_F = double(0);
-    
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -4254,7 +4107,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D<NUM_SPECIES>(
                             F_z.data(),
                             Q_z_B.data(),
                             Q_z_F.data(),
@@ -4275,14 +4132,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
                             d_num_species,
                             num_eqn);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = w_z_B + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = w_z_F + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            w_z_B + s_z_minus*(Chi_z_star_BF - double(1)),
+                            w_z_F + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -4309,7 +4161,11 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D<NUM_SPECIES>(
                             F_z.data(),
                             Q_z_B.data(),
                             Q_z_F.data(),
@@ -4341,6 +4197,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
  * Compute the convective flux and velocity in the x-direction from primitive variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -4427,51 +4284,51 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_L(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_x_R(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_L(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_x_R(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     /*
@@ -4510,12 +4367,6 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
     double* epsilon_x_L = internal_energy_x_L->getPointer(0, 0);
     double* epsilon_x_R = internal_energy_x_R->getPointer(0, 0);
     
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -4724,7 +4575,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D<NUM_SPECIES>(
                     F_x.data(),
                     V_x_L.data(),
                     V_x_R.data(),
@@ -4743,14 +4597,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                     d_num_species,
                     num_eqn);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                    V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -4764,7 +4613,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
-                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
+                computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D<NUM_SPECIES>(
                     F_x.data(),
                     V_x_L.data(),
                     V_x_R.data(),
@@ -5043,7 +4895,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D<NUM_SPECIES>(
                         F_x.data(),
                         V_x_L.data(),
                         V_x_R.data(),
@@ -5062,14 +4917,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                         d_num_species,
                         num_eqn);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                        V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -5089,7 +4939,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
+                    computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D<NUM_SPECIES>(
                         F_x.data(),
                         V_x_L.data(),
                         V_x_R.data(),
@@ -5425,7 +5278,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D<NUM_SPECIES>(
                             F_x.data(),
                             V_x_L.data(),
                             V_x_R.data(),
@@ -5444,14 +5300,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                             d_num_species,
                             num_eqn);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            V_x_L[d_num_species][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                            V_x_R[d_num_species][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -5478,7 +5329,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
+                        computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D<NUM_SPECIES>(
                             F_x.data(),
                             V_x_L.data(),
                             V_x_R.data(),
@@ -5508,6 +5362,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDi
  * Compute the convective flux and velocity in the y-direction from primitive variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -5594,51 +5449,51 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_y_T(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_y_T(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     /*
@@ -5677,12 +5532,6 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
     double* epsilon_y_B = internal_energy_y_B->getPointer(1, 0);
     double* epsilon_y_T = internal_energy_y_T->getPointer(1, 0);
     
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -5949,7 +5798,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D<NUM_SPECIES>(
                         F_y.data(),
                         V_y_B.data(),
                         V_y_T.data(),
@@ -5968,14 +5820,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                         d_num_species,
                         num_eqn);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                        V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -5995,7 +5842,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
-                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
+                    computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D<NUM_SPECIES>(
                         F_y.data(),
                         V_y_B.data(),
                         V_y_T.data(),
@@ -6331,7 +6181,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D<NUM_SPECIES>(
                             F_y.data(),
                             V_y_B.data(),
                             V_y_T.data(),
@@ -6350,14 +6203,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                             d_num_species,
                             num_eqn);
                         
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            V_y_B[d_num_species + 1][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                            V_y_T[d_num_species + 1][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -6384,7 +6232,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
+                        computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D<NUM_SPECIES>(
                             F_y.data(),
                             V_y_B.data(),
                             V_y_T.data(),
@@ -6414,6 +6265,7 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDi
  * Compute the convective flux and velocity in the z-direction from primitive variables with
  * HLLC Riemann solver.
  */
+template<int NUM_SPECIES>
 void
 FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC(
     HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux,
@@ -6500,51 +6352,51 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > density_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_B(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions_z_F(
-        new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_B(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities_z_F(
-            new pdat::SideData<double>(interior_box, d_num_species, num_ghosts_primitive_variables,
+            d_scratch_arena->getSideData(interior_box, d_num_species, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     /*
@@ -6583,12 +6435,6 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
     double* epsilon_z_B = internal_energy_z_B->getPointer(2, 0);
     double* epsilon_z_F = internal_energy_z_F->getPointer(2, 0);
     
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -6919,7 +6765,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D<NUM_SPECIES>(
                             F_z.data(),
                             V_z_B.data(),
                             V_z_F.data(),
@@ -6938,14 +6787,9 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
                             d_num_species,
                             num_eqn);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = V_z_B[d_num_species + 2][idx] + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = V_z_F[d_num_species + 2][idx] + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            V_z_B[d_num_species + 2][idx] + s_z_minus*(Chi_z_star_BF - double(1)),
+                            V_z_F[d_num_species + 2][idx] + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -6972,7 +6816,10 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
-                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
+                        computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D<NUM_SPECIES>(
                             F_z.data(),
                             V_z_B.data(),
                             V_z_F.data(),
@@ -6996,3 +6843,58 @@ FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDi
         }
     }
 }
+
+
+/*
+ * Set the functions computing the convective flux and velocity with HLLC Riemann solver. The functions
+ * with the number of species fixed at compile time are used for two and three species.
+ */
+void
+FlowModelRiemannSolverFourEqnConservative::setConvectiveFluxFunctionsHLLC()
+{
+    if (d_num_species == 2)
+    {
+        d_compute_convective_flux_from_conservative_variables_HLLC[0] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC<2>;
+        d_compute_convective_flux_from_conservative_variables_HLLC[1] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC<2>;
+        d_compute_convective_flux_from_conservative_variables_HLLC[2] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC<2>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[0] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC<2>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[1] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC<2>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[2] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC<2>;
+    }
+    else if (d_num_species == 3)
+    {
+        d_compute_convective_flux_from_conservative_variables_HLLC[0] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC<3>;
+        d_compute_convective_flux_from_conservative_variables_HLLC[1] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC<3>;
+        d_compute_convective_flux_from_conservative_variables_HLLC[2] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC<3>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[0] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC<3>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[1] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC<3>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[2] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC<3>;
+    }
+    else
+    {
+        d_compute_convective_flux_from_conservative_variables_HLLC[0] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromConservativeVariablesHLLC<0>;
+        d_compute_convective_flux_from_conservative_variables_HLLC[1] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromConservativeVariablesHLLC<0>;
+        d_compute_convective_flux_from_conservative_variables_HLLC[2] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromConservativeVariablesHLLC<0>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[0] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInXDirectionFromPrimitiveVariablesHLLC<0>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[1] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInYDirectionFromPrimitiveVariablesHLLC<0>;
+        d_compute_convective_flux_from_primitive_variables_HLLC[2] =
+            &FlowModelRiemannSolverFourEqnConservative::computeConvectiveFluxAndVelocityInZDirectionFromPrimitiveVariablesHLLC<0>;
+    }
+}
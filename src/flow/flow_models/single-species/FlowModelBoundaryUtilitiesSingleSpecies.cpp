@@ -43,6 +43,12 @@ FlowModelBoundaryUtilitiesSingleSpecies::FlowModelBoundaryUtilitiesSingleSpecies
         thermo_properties_ptr,
         0);
     
+    d_thermo_properties_ptr.reserve(num_thermo_properties);
+    for (int ti = 0; ti < num_thermo_properties; ti++)
+    {
+        d_thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
+    }
+    
     /*
      * Set default sizes for containers of boundary conditions.
      */
@@ -640,16 +646,30 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         const int idx_cell_rho = i + num_subghosts_conservative_var[0][0];
@@ -693,32 +713,64 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
                             double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_node_adiabatic_no_slip_vel[node_loc];
                         
                         /*
-                         * Set the values for total internal energy.
+                         * Store the density and specific internal energy of the pivot.
                          */
                         
-                        double epsilon_pivot = (Q[2][idx_cell_pivot_E] -
+                        epsilon_pivot_fill[count_fill] = (Q[2][idx_cell_pivot_E] -
                             0.5*Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom]/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                         
-                        double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &Q[0][idx_cell_pivot_rho],
-                                &epsilon_pivot,
-                                thermo_properties_ptr);
+                        rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                        idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                        idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                        idx_cell_E_fill[count_fill] = idx_cell_E;
                         
-                        double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getTemperature(
-                                &Q[0][idx_cell_pivot_rho],
-                                &p_pivot,
-                                thermo_properties_ptr);
+                        count_fill++;
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
                         
-                        double T = T_pivot;
+                        /*
+                         * Set the values for total internal energy.
+                         */
                         
-                        double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getInternalEnergyFromTemperature(
-                                &Q[0][idx_cell_rho],
-                                &T,
-                                thermo_properties_ptr);
+                        double epsilon = epsilon_fill[idx_fill];
                         
                         double E = Q[0][idx_cell_rho]*epsilon +
                             0.5*Q[1][idx_cell_mom]*Q[1][idx_cell_mom]/Q[0][idx_cell_rho];
@@ -732,6 +784,31 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(4*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         const int idx_cell_rho = i + num_subghosts_conservative_var[0][0];
@@ -766,34 +843,80 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
                         }
                         
                         /*
-                         * Set the values for density, momentum and total internal energy.
+                         * Store the density and specific internal energy of the pivot.
                          */
                         
-                        double epsilon_pivot = (Q[2][idx_cell_pivot_E] -
+                        epsilon_pivot_fill[count_fill] = (Q[2][idx_cell_pivot_E] -
                             0.5*Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom]/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                         
-                        double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &Q[0][idx_cell_pivot_rho],
-                                &epsilon_pivot,
-                                thermo_properties_ptr);
-                        
-                        double p = p_pivot;
+                        rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                        idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                        idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                        idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                        idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                         
-                        double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getTemperature(
-                                &Q[0][idx_cell_pivot_rho],
-                                &p_pivot,
-                                thermo_properties_ptr);
+                        count_fill++;
+                    }
+                    
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_node_isothermal_no_slip_T[node_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
                         
-                        double T = -T_pivot + double(2)*d_bdry_node_isothermal_no_slip_T[node_loc];
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
                         
-                        double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getDensity(
-                                &p,
-                                &T,
-                                thermo_properties_ptr);
+                        double rho = rho_fill[idx_fill];
                         
                         double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
                             double(2)*d_bdry_node_isothermal_no_slip_vel[node_loc];
@@ -801,11 +924,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill1dNodeBoundaryData(
                         Q[0][idx_cell_rho] = rho;
                         Q[1][idx_cell_mom] = rho*u;
                         
-                        double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getInternalEnergyFromTemperature(
-                                &rho,
-                                &T,
-                                thermo_properties_ptr);
+                        double epsilon = epsilon_fill[idx_fill];
                         
                         double E = rho*epsilon + 0.5*Q[1][idx_cell_mom]*Q[1][idx_cell_mom]/rho;
                         
@@ -999,16 +1118,30 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1109,48 +1242,106 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                                 double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_edge_adiabatic_no_slip_vel[edge_loc*2 + 1];
                             
                             /*
-                             * Set the values for total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[3][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[3][idx_cell_pivot_E] -
                                 0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                      Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom])/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &epsilon_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getTemperature(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &p_pivot,
-                                    thermo_properties_ptr);
+                            rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                            idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
                             
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergyFromTemperature(
-                                    &Q[0][idx_cell_rho],
-                                    &T,
-                                    thermo_properties_ptr);
-                            
-                            double E = Q[0][idx_cell_rho]*epsilon +
-                                0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                            
-                            Q[3][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                Q[0][idx_cell_rho];
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -1241,59 +1432,103 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             }
                             
                             /*
-                             * Set the values for density, momentum and total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[3][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[3][idx_cell_pivot_E] -
                                 0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                      Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom])/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &epsilon_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double p = p_pivot;
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getTemperature(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &p_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double T = -T_pivot + double(2)*d_bdry_edge_isothermal_no_slip_T[edge_loc];
-                            
-                            double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getDensity(
-                                    &p,
-                                    &T,
-                                    thermo_properties_ptr);
-                            
-                            double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2];
-                            double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2 + 1];
-                            
-                            Q[0][idx_cell_rho] = rho;
-                            Q[1][idx_cell_mom] = rho*u;
-                            Q[2][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    thermo_properties_ptr);
+                            rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                            idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
+                            idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                            idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                             
-                            double E = rho*epsilon +
-                                0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    rho;
-                            
-                            Q[3][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_edge_isothermal_no_slip_T[edge_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc*2 + 1];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                rho;
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
@@ -1375,14 +1610,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (edge_loc == BDRY_LOC::XLO)
                 {
                     const int num_ghosts_to_fill = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
@@ -1394,10 +1621,45 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(5*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = j - fill_box_lo_idx[1];
+                        
+                        const int idx_state_x_R   = idx_line;
+                        const int idx_state_x_RR  = idx_line + num_lines;
+                        const int idx_state_x_RRR = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
                         
                         const int idx_cell_rho_x_R = (interior_box_lo_idx[0] + num_subghosts_conservative_var[0][0]) +
                             (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0];
@@ -1438,45 +1700,25 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                         const double v_x_RR  = Q[2][idx_cell_mom_x_RR]/rho_x_RR;
                         const double v_x_RRR = Q[2][idx_cell_mom_x_RRR]/rho_x_RRR;
                         
-                        const double half = double(1)/double(2);
                         const double epsilon_x_R   = Q[3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                         const double epsilon_x_RR  = Q[3][idx_cell_E_x_RR]/rho_x_RR - half*(u_x_RR*u_x_RR + v_x_RR*v_x_RR);
                         const double epsilon_x_RRR = Q[3][idx_cell_E_x_RRR]/rho_x_RRR - half*(u_x_RRR*u_x_RRR + v_x_RRR*v_x_RRR);
                         
-                        const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_x_R,
-                                &epsilon_x_R,
-                                thermo_properties_ptr);
-                        
-                        const double p_x_RR = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_x_RR,
-                                &epsilon_x_RR,
-                                thermo_properties_ptr);
-                        
-                        const double p_x_RRR = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_x_RRR,
-                                &epsilon_x_RRR,
-                                thermo_properties_ptr);
-                        
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
+                        rho_states[idx_state_x_R]   = rho_x_R;
+                        rho_states[idx_state_x_RR]  = rho_x_RR;
+                        rho_states[idx_state_x_RRR] = rho_x_RRR;
                         
-                        const double drho_dx = -(rho_x_RRR - double(4)*rho_x_RR + double(3)*rho_x_R)/(double(2)*dx[0]);
-                        const double du_dx   = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
-                        const double dv_dx   = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
-                        const double dp_dx   = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
+                        u_states[idx_state_x_R]   = u_x_R;
+                        u_states[idx_state_x_RR]  = u_x_RR;
+                        u_states[idx_state_x_RRR] = u_x_RRR;
                         
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
+                        v_states[idx_state_x_R]   = v_x_R;
+                        v_states[idx_state_x_RR]  = v_x_RR;
+                        v_states[idx_state_x_RRR] = v_x_RRR;
                         
-                        double du_dy = double(0);
-                        double dv_dy = double(0);
-                        double dp_dy = double(0);
+                        epsilon_states[idx_state_x_R]   = epsilon_x_R;
+                        epsilon_states[idx_state_x_RR]  = epsilon_x_RR;
+                        epsilon_states[idx_state_x_RRR] = epsilon_x_RRR;
                         
                         if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                             (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -1502,16 +1744,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_y_T = Q[2][idx_cell_mom_y_T]/rho_y_T;
                             const double epsilon_y_T = Q[3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                             
-                            const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_T]     = rho_y_T;
+                            u_states[idx_state_y_T]       = u_y_T;
+                            v_states[idx_state_y_T]       = v_y_T;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
                             
-                            // One-sided derivatives.
-                            du_dy = (u_y_T - u_x_R)/(dx[1]);
-                            dv_dy = (v_y_T - v_x_R)/(dx[1]);
-                            dp_dy = (p_y_T - p_x_R)/(dx[1]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_B]     = rho_x_R;
+                            epsilon_states[idx_state_y_B] = epsilon_x_R;
                         }
                         else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                  (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -1537,16 +1778,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_y_B = Q[2][idx_cell_mom_y_B]/rho_y_B;
                             const double epsilon_y_B = Q[3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                             
-                            const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_B]     = rho_y_B;
+                            u_states[idx_state_y_B]       = u_y_B;
+                            v_states[idx_state_y_B]       = v_y_B;
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
                             
-                            // One-sided derivatives.
-                            du_dy = (u_x_R - u_y_B)/(dx[1]);
-                            dv_dy = (v_x_R - v_y_B)/(dx[1]);
-                            dp_dy = (p_x_R - p_y_B)/(dx[1]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_T]     = rho_x_R;
+                            epsilon_states[idx_state_y_T] = epsilon_x_R;
                         }
                         else
                         {
@@ -1580,17 +1820,132 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double epsilon_y_B = Q[3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                             const double epsilon_y_T = Q[3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                             
-                            const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_B] = rho_y_B;
+                            rho_states[idx_state_y_T] = rho_y_T;
+                            
+                            u_states[idx_state_y_B] = u_y_B;
+                            u_states[idx_state_y_T] = u_y_T;
+                            
+                            v_states[idx_state_y_B] = v_y_B;
+                            v_states[idx_state_y_T] = v_y_T;
+                            
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        const int idx_line = j - fill_box_lo_idx[1];
+                        
+                        const int idx_state_x_R   = idx_line;
+                        const int idx_state_x_RR  = idx_line + num_lines;
+                        const int idx_state_x_RRR = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
+                        
+                        const double& rho_x_R   = rho_states[idx_state_x_R];
+                        const double& rho_x_RR  = rho_states[idx_state_x_RR];
+                        const double& rho_x_RRR = rho_states[idx_state_x_RRR];
+                        
+                        const double& u_x_R   = u_states[idx_state_x_R];
+                        const double& u_x_RR  = u_states[idx_state_x_RR];
+                        const double& u_x_RRR = u_states[idx_state_x_RRR];
+                        
+                        const double& v_x_R   = v_states[idx_state_x_R];
+                        const double& v_x_RR  = v_states[idx_state_x_RR];
+                        const double& v_x_RRR = v_states[idx_state_x_RRR];
+                        
+                        const double& p_x_R   = p_states[idx_state_x_R];
+                        const double& p_x_RR  = p_states[idx_state_x_RR];
+                        const double& p_x_RRR = p_states[idx_state_x_RRR];
+                        
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
+                        
+                        const double drho_dx = -(rho_x_RRR - double(4)*rho_x_RR + double(3)*rho_x_R)/(double(2)*dx[0]);
+                        const double du_dx   = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
+                        const double dv_dx   = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
+                        const double dp_dx   = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
+                        
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
+                        
+                        double du_dy = double(0);
+                        double dv_dy = double(0);
+                        double dp_dy = double(0);
+                        
+                        if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            (j + num_subghosts_conservative_var[2][1] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                        //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_T = p_states[idx_state_y_T];
                             
-                            const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    thermo_properties_ptr);
+                            // One-sided derivatives.
+                            du_dy = (u_y_T - u_x_R)/(dx[1]);
+                            dv_dy = (v_y_T - v_x_R)/(dx[1]);
+                            dp_dy = (p_y_T - p_x_R)/(dx[1]);
+                        }
+                        else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                 (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                 (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                        //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                        //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                        //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            
+                            // One-sided derivatives.
+                            du_dy = (u_x_R - u_y_B)/(dx[1]);
+                            dv_dy = (v_x_R - v_y_B)/(dx[1]);
+                            dp_dy = (p_x_R - p_y_B)/(dx[1]);
+                        }
+                        else
+                        {
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            const double& p_y_T = p_states[idx_state_y_T];
                             
                             // Central derivatives.
                             du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
@@ -1598,11 +1953,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
                         }
                         
-                        const double c_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getSoundSpeed(
-                                &rho_x_R,
-                                &p_x_R,
-                                thermo_properties_ptr);
+                        const double& c_x_R = c_bdry[idx_line];
                         
                         const double lambda_4 = u_x_R + c_x_R;
                         
@@ -1759,19 +2110,37 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             Q[1][idx_cell_mom] = V_ghost[i*4 + 0]*V_ghost[i*4 + 1];
                             Q[2][idx_cell_mom] = V_ghost[i*4 + 0]*V_ghost[i*4 + 2];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergy(
-                                    &V_ghost[i*4 + 0],
-                                    &V_ghost[i*4 + 3],
-                                    thermo_properties_ptr);
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                             
-                            const double E = V_ghost[i*4 + 0]*epsilon +
-                                half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    V_ghost[i*4 + 0];
+                            rho_ghosts[idx_ghost] = V_ghost[i*4 + 0];
+                            p_ghosts[idx_ghost]   = V_ghost[i*4 + 3];
                             
-                            Q[3][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
                 }
                 else if (edge_loc == BDRY_LOC::XHI)
                 {
@@ -1784,10 +2153,45 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(5*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = j - fill_box_lo_idx[1];
+                        
+                        const int idx_state_x_L   = idx_line;
+                        const int idx_state_x_LL  = idx_line + num_lines;
+                        const int idx_state_x_LLL = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
                         
                         // Compute one-sided derivatives in x-direction.
                         const int idx_cell_rho_x_L = (interior_box_hi_idx[0] + num_subghosts_conservative_var[0][0]) +
@@ -1828,46 +2232,26 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                         const double v_x_L   = Q[2][idx_cell_mom_x_L]/rho_x_L;
                         const double v_x_LL  = Q[2][idx_cell_mom_x_LL]/rho_x_LL;
                         const double v_x_LLL = Q[2][idx_cell_mom_x_LLL]/rho_x_LLL;
-                       
-                        const double half = double(1)/double(2);
+                        
                         const double epsilon_x_L   = Q[3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                         const double epsilon_x_LL  = Q[3][idx_cell_E_x_LL]/rho_x_LL - half*(u_x_LL*u_x_LL + v_x_LL*v_x_LL);
                         const double epsilon_x_LLL = Q[3][idx_cell_E_x_LLL]/rho_x_LLL - half*(u_x_LLL*u_x_LLL + v_x_LLL*v_x_LLL);
                         
-                        const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_x_L,
-                                &epsilon_x_L,
-                                thermo_properties_ptr);
-                        
-                        const double p_x_LL = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_x_LL,
-                                &epsilon_x_LL,
-                                thermo_properties_ptr);
-                        
-                        const double p_x_LLL = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_x_LLL,
-                                &epsilon_x_LLL,
-                                thermo_properties_ptr);
+                        rho_states[idx_state_x_L]   = rho_x_L;
+                        rho_states[idx_state_x_LL]  = rho_x_LL;
+                        rho_states[idx_state_x_LLL] = rho_x_LLL;
                         
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
-                        
-                        const double drho_dx = (rho_x_LLL - double(4)*rho_x_LL + double(3)*rho_x_L)/(double(2)*dx[0]);
-                        const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
-                        const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
-                        const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
+                        u_states[idx_state_x_L]   = u_x_L;
+                        u_states[idx_state_x_LL]  = u_x_LL;
+                        u_states[idx_state_x_LLL] = u_x_LLL;
                         
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
+                        v_states[idx_state_x_L]   = v_x_L;
+                        v_states[idx_state_x_LL]  = v_x_LL;
+                        v_states[idx_state_x_LLL] = v_x_LLL;
                         
-                        double du_dy = double(0);
-                        double dv_dy = double(0);
-                        double dp_dy = double(0);
+                        epsilon_states[idx_state_x_L]   = epsilon_x_L;
+                        epsilon_states[idx_state_x_LL]  = epsilon_x_LL;
+                        epsilon_states[idx_state_x_LLL] = epsilon_x_LLL;
                         
                         if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                             (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -1893,16 +2277,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_y_T = Q[2][idx_cell_mom_y_T]/rho_y_T;
                             const double epsilon_y_T = Q[3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                             
-                            const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_T]     = rho_y_T;
+                            u_states[idx_state_y_T]       = u_y_T;
+                            v_states[idx_state_y_T]       = v_y_T;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
                             
-                            // One-sided derivatives.
-                            du_dy = (u_y_T - u_x_L)/(dx[1]);
-                            dv_dy = (v_y_T - v_x_L)/(dx[1]);
-                            dp_dy = (p_y_T - p_x_L)/(dx[1]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_B]     = rho_x_L;
+                            epsilon_states[idx_state_y_B] = epsilon_x_L;
                         }
                         else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                  (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -1928,16 +2311,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_y_B = Q[2][idx_cell_mom_y_B]/rho_y_B;
                             const double epsilon_y_B = Q[3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                             
-                            const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_B]     = rho_y_B;
+                            u_states[idx_state_y_B]       = u_y_B;
+                            v_states[idx_state_y_B]       = v_y_B;
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
                             
-                            // One-sided derivatives.
-                            du_dy = (u_x_L - u_y_B)/(dx[1]);
-                            dv_dy = (v_x_L - v_y_B)/(dx[1]);
-                            dp_dy = (p_x_L - p_y_B)/(dx[1]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_y_T]     = rho_x_L;
+                            epsilon_states[idx_state_y_T] = epsilon_x_L;
                         }
                         else
                         {
@@ -1971,31 +2353,142 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double epsilon_y_B = Q[3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                             const double epsilon_y_T = Q[3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                             
-                            const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_B] = rho_y_B;
+                            rho_states[idx_state_y_T] = rho_y_T;
                             
-                            const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    thermo_properties_ptr);
+                            u_states[idx_state_y_B] = u_y_B;
+                            u_states[idx_state_y_T] = u_y_T;
                             
-                            // Central derivatives.
-                            du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                            v_states[idx_state_y_B] = v_y_B;
+                            v_states[idx_state_y_T] = v_y_T;
+                            
+                            epsilon_states[idx_state_y_B] = epsilon_y_B;
+                            epsilon_states[idx_state_y_T] = epsilon_y_T;
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        const int idx_line = j - fill_box_lo_idx[1];
+                        
+                        const int idx_state_x_L   = idx_line;
+                        const int idx_state_x_LL  = idx_line + num_lines;
+                        const int idx_state_x_LLL = idx_line + 2*num_lines;
+                        const int idx_state_y_B   = idx_line + 3*num_lines;
+                        const int idx_state_y_T   = idx_line + 4*num_lines;
+                        
+                        const double& rho_x_L   = rho_states[idx_state_x_L];
+                        const double& rho_x_LL  = rho_states[idx_state_x_LL];
+                        const double& rho_x_LLL = rho_states[idx_state_x_LLL];
+                        
+                        const double& u_x_L   = u_states[idx_state_x_L];
+                        const double& u_x_LL  = u_states[idx_state_x_LL];
+                        const double& u_x_LLL = u_states[idx_state_x_LLL];
+                        
+                        const double& v_x_L   = v_states[idx_state_x_L];
+                        const double& v_x_LL  = v_states[idx_state_x_LL];
+                        const double& v_x_LLL = v_states[idx_state_x_LLL];
+                        
+                        const double& p_x_L   = p_states[idx_state_x_L];
+                        const double& p_x_LL  = p_states[idx_state_x_LL];
+                        const double& p_x_LLL = p_states[idx_state_x_LLL];
+                        
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
+                        
+                        const double drho_dx = (rho_x_LLL - double(4)*rho_x_LL + double(3)*rho_x_L)/(double(2)*dx[0]);
+                        const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
+                        const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
+                        const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
+                        
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
+                        
+                        double du_dy = double(0);
+                        double dv_dy = double(0);
+                        double dp_dy = double(0);
+                        
+                        if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            (j + num_subghosts_conservative_var[2][1] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                        //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                        //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_T = p_states[idx_state_y_T];
+                            
+                            // One-sided derivatives.
+                            du_dy = (u_y_T - u_x_L)/(dx[1]);
+                            dv_dy = (v_y_T - v_x_L)/(dx[1]);
+                            dp_dy = (p_y_T - p_x_L)/(dx[1]);
+                        }
+                        else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                 (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                 (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                        //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                        //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                        //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            
+                            // One-sided derivatives.
+                            du_dy = (u_x_L - u_y_B)/(dx[1]);
+                            dv_dy = (v_x_L - v_y_B)/(dx[1]);
+                            dp_dy = (p_x_L - p_y_B)/(dx[1]);
+                        }
+                        else
+                        {
+                            const double& u_y_B = u_states[idx_state_y_B];
+                            const double& u_y_T = u_states[idx_state_y_T];
+                            const double& v_y_B = v_states[idx_state_y_B];
+                            const double& v_y_T = v_states[idx_state_y_T];
+                            const double& p_y_B = p_states[idx_state_y_B];
+                            const double& p_y_T = p_states[idx_state_y_T];
+                            
+                            // Central derivatives.
+                            du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
                             dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
                             dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
                         }
                         
                         // Compute wave speed (u - c) at the boundary.
                         
-                        const double c_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getSoundSpeed(
-                                &rho_x_L,
-                                &p_x_L,
-                                thermo_properties_ptr);
+                        const double& c_x_L = c_bdry[idx_line];
                         
                         const double lambda_1 = u_x_L - c_x_L;
                         
@@ -2152,19 +2645,37 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             Q[1][idx_cell_mom] = V_ghost[i*4 + 0]*V_ghost[i*4 + 1];
                             Q[2][idx_cell_mom] = V_ghost[i*4 + 0]*V_ghost[i*4 + 2];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergy(
-                                    &V_ghost[i*4 + 0],
-                                    &V_ghost[i*4 + 3],
-                                    thermo_properties_ptr);
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                             
-                            const double E = V_ghost[i*4 + 0]*epsilon +
-                                half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    V_ghost[i*4 + 0];
+                            rho_ghosts[idx_ghost] = V_ghost[i*4 + 0];
+                            p_ghosts[idx_ghost]   = V_ghost[i*4 + 3];
                             
-                            Q[3][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
                 }
                 else if (edge_loc == BDRY_LOC::YLO)
                 {
@@ -2177,10 +2688,45 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(5*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = i - fill_box_lo_idx[0];
+                        
+                        const int idx_state_y_T   = idx_line;
+                        const int idx_state_y_TT  = idx_line + num_lines;
+                        const int idx_state_y_TTT = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
                         
                         const int idx_cell_rho_y_T = (i + num_subghosts_conservative_var[0][0]) +
                             (interior_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0];
@@ -2221,45 +2767,25 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                         const double v_y_TT  = Q[2][idx_cell_mom_y_TT]/rho_y_TT;
                         const double v_y_TTT = Q[2][idx_cell_mom_y_TTT]/rho_y_TTT;
                         
-                        const double half = double(1)/double(2);
                         const double epsilon_y_T   = Q[3][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T);
                         const double epsilon_y_TT  = Q[3][idx_cell_E_y_TT]/rho_y_TT - half*(u_y_TT*u_y_TT + v_y_TT*v_y_TT);
                         const double epsilon_y_TTT = Q[3][idx_cell_E_y_TTT]/rho_y_TTT- half*(u_y_TTT*u_y_TTT + v_y_TTT*v_y_TTT);
                         
-                        const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_y_T,
-                                &epsilon_y_T,
-                                thermo_properties_ptr);
-                        
-                        const double p_y_TT = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_y_TT,
-                                &epsilon_y_TT,
-                                thermo_properties_ptr);
-                        
-                        const double p_y_TTT = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_y_TTT,
-                                &epsilon_y_TTT,
-                                thermo_properties_ptr);
-
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
+                        rho_states[idx_state_y_T]   = rho_y_T;
+                        rho_states[idx_state_y_TT]  = rho_y_TT;
+                        rho_states[idx_state_y_TTT] = rho_y_TTT;
                         
-                        const double drho_dy = -(rho_y_TTT - double(4)*rho_y_TT + double(3)*rho_y_T)/(double(2)*dx[1]);
-                        const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
-                        const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
-                        const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
+                        u_states[idx_state_y_T]   = u_y_T;
+                        u_states[idx_state_y_TT]  = u_y_TT;
+                        u_states[idx_state_y_TTT] = u_y_TTT;
                         
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
+                        v_states[idx_state_y_T]   = v_y_T;
+                        v_states[idx_state_y_TT]  = v_y_TT;
+                        v_states[idx_state_y_TTT] = v_y_TTT;
                         
-                        double du_dx = double(0);
-                        double dv_dx = double(0);
-                        double dp_dx = double(0);
+                        epsilon_states[idx_state_y_T]   = epsilon_y_T;
+                        epsilon_states[idx_state_y_TT]  = epsilon_y_TT;
+                        epsilon_states[idx_state_y_TTT] = epsilon_y_TTT;
                         
                         if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                             (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -2285,16 +2811,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_x_R = Q[2][idx_cell_mom_x_R]/rho_x_R;
                             const double epsilon_x_R = Q[3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                             
-                            const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_R]     = rho_x_R;
+                            u_states[idx_state_x_R]       = u_x_R;
+                            v_states[idx_state_x_R]       = v_x_R;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
                             
-                            // One-sided derivatives.
-                            du_dx = (u_x_R - u_y_T)/(dx[0]);
-                            dv_dx = (v_x_R - v_y_T)/(dx[0]);
-                            dp_dx = (p_x_R - p_y_T)/(dx[0]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_L]     = rho_y_T;
+                            epsilon_states[idx_state_x_L] = epsilon_y_T;
                         }
                         else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                  (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -2320,16 +2845,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_x_L = Q[2][idx_cell_mom_x_L]/rho_x_L;
                             const double epsilon_x_L = Q[3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                             
-                            const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_L]     = rho_x_L;
+                            u_states[idx_state_x_L]       = u_x_L;
+                            v_states[idx_state_x_L]       = v_x_L;
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
                             
-                            // One-sided derivatives.
-                            du_dx = (u_y_T - u_x_L)/(dx[0]);
-                            dv_dx = (v_y_T - v_x_L)/(dx[0]);
-                            dp_dx = (p_y_T - p_x_L)/(dx[0]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_R]     = rho_y_T;
+                            epsilon_states[idx_state_x_R] = epsilon_y_T;
                         }
                         else
                         {
@@ -2363,17 +2887,132 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double epsilon_x_L = Q[3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                             const double epsilon_x_R = Q[3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                             
-                            const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_L] = rho_x_L;
+                            rho_states[idx_state_x_R] = rho_x_R;
+                            
+                            u_states[idx_state_x_L] = u_x_L;
+                            u_states[idx_state_x_R] = u_x_R;
+                            
+                            v_states[idx_state_x_L] = v_x_L;
+                            v_states[idx_state_x_R] = v_x_R;
+                            
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                    {
+                        const int idx_line = i - fill_box_lo_idx[0];
+                        
+                        const int idx_state_y_T   = idx_line;
+                        const int idx_state_y_TT  = idx_line + num_lines;
+                        const int idx_state_y_TTT = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
+                        
+                        const double& rho_y_T   = rho_states[idx_state_y_T];
+                        const double& rho_y_TT  = rho_states[idx_state_y_TT];
+                        const double& rho_y_TTT = rho_states[idx_state_y_TTT];
+                        
+                        const double& u_y_T   = u_states[idx_state_y_T];
+                        const double& u_y_TT  = u_states[idx_state_y_TT];
+                        const double& u_y_TTT = u_states[idx_state_y_TTT];
+                        
+                        const double& v_y_T   = v_states[idx_state_y_T];
+                        const double& v_y_TT  = v_states[idx_state_y_TT];
+                        const double& v_y_TTT = v_states[idx_state_y_TTT];
+                        
+                        const double& p_y_T   = p_states[idx_state_y_T];
+                        const double& p_y_TT  = p_states[idx_state_y_TT];
+                        const double& p_y_TTT = p_states[idx_state_y_TTT];
+                        
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
+                        
+                        const double drho_dy = -(rho_y_TTT - double(4)*rho_y_TT + double(3)*rho_y_T)/(double(2)*dx[1]);
+                        const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
+                        const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
+                        const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
+                        
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
+                        
+                        double du_dx = double(0);
+                        double dv_dx = double(0);
+                        double dp_dx = double(0);
+                        
+                        if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            (i + num_subghosts_conservative_var[2][0] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                        //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_R = p_states[idx_state_x_R];
+                            
+                            // One-sided derivatives.
+                            du_dx = (u_x_R - u_y_T)/(dx[0]);
+                            dv_dx = (v_x_R - v_y_T)/(dx[0]);
+                            dp_dx = (p_x_R - p_y_T)/(dx[0]);
+                        }
+                        else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                 (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                 (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                        //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                        //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                        //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& p_x_L = p_states[idx_state_x_L];
                             
-                            const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    thermo_properties_ptr);
+                            // One-sided derivatives.
+                            du_dx = (u_y_T - u_x_L)/(dx[0]);
+                            dv_dx = (v_y_T - v_x_L)/(dx[0]);
+                            dp_dx = (p_y_T - p_x_L)/(dx[0]);
+                        }
+                        else
+                        {
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_L = p_states[idx_state_x_L];
+                            const double& p_x_R = p_states[idx_state_x_R];
                             
                             // Central derivatives.
                             du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
@@ -2383,11 +3022,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                         
                         // Compute wave speed (v + c) at the boundary.
                         
-                        const double c_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getSoundSpeed(
-                                &rho_y_T,
-                                &p_y_T,
-                                thermo_properties_ptr);
+                        const double& c_y_T = c_bdry[idx_line];
                         
                         const double lambda_4 = v_y_T + c_y_T;
                         
@@ -2544,19 +3179,37 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             Q[1][idx_cell_mom] = V_ghost[j*4 + 0]*V_ghost[j*4 + 1];
                             Q[2][idx_cell_mom] = V_ghost[j*4 + 0]*V_ghost[j*4 + 2];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergy(
-                                    &V_ghost[j*4 + 0],
-                                    &V_ghost[j*4 + 3],
-                                    thermo_properties_ptr);
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                             
-                            const double E = V_ghost[j*4 + 0]*epsilon +
-                                half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    V_ghost[j*4 + 0];
+                            rho_ghosts[idx_ghost] = V_ghost[j*4 + 0];
+                            p_ghosts[idx_ghost]   = V_ghost[j*4 + 3];
                             
-                            Q[3][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
                 }
                 else if (edge_loc == BDRY_LOC::YHI)
                 {
@@ -2569,10 +3222,45 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
+                    const int num_states = 5*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(5*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const epsilon_states = v_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
-                        // Get the grid spacing.
-                        const double* const dx = patch_geom->getDx();
+                        const int idx_line = i - fill_box_lo_idx[0];
+                        
+                        const int idx_state_y_B   = idx_line;
+                        const int idx_state_y_BB  = idx_line + num_lines;
+                        const int idx_state_y_BBB = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
                         
                         // Compute one-sided derivatives in y-direction.
                         const int idx_cell_rho_y_B = (i + num_subghosts_conservative_var[0][0]) +
@@ -2613,46 +3301,26 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                         const double v_y_B   = Q[2][idx_cell_mom_y_B]/rho_y_B;
                         const double v_y_BB  = Q[2][idx_cell_mom_y_BB]/rho_y_BB;
                         const double v_y_BBB = Q[2][idx_cell_mom_y_BBB]/rho_y_BBB;
-                       
-                        const double half = double(1)/double(2);
+                        
                         const double epsilon_y_B   = Q[3][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B);
                         const double epsilon_y_BB  = Q[3][idx_cell_E_y_BB]/rho_y_BB - half*(u_y_BB*u_y_BB + v_y_BB*v_y_BB);
                         const double epsilon_y_BBB = Q[3][idx_cell_E_y_BBB]/rho_y_BBB - half*(u_y_BBB*u_y_BBB + v_y_BBB*v_y_BBB);
                         
-                        const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_y_B,
-                                &epsilon_y_B,
-                                thermo_properties_ptr);
-                        
-                        const double p_y_BB = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_y_BB,
-                                &epsilon_y_BB,
-                                thermo_properties_ptr);
-                        
-                        const double p_y_BBB = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getPressure(
-                                &rho_y_BBB,
-                                &epsilon_y_BBB,
-                                thermo_properties_ptr);
-                        
-                        /*
-                         * Compute derivatives in y-direction.
-                         */
+                        rho_states[idx_state_y_B]   = rho_y_B;
+                        rho_states[idx_state_y_BB]  = rho_y_BB;
+                        rho_states[idx_state_y_BBB] = rho_y_BBB;
                         
-                        const double drho_dy = (rho_y_BBB - double(4)*rho_y_BB + double(3)*rho_y_B)/(double(2)*dx[1]);
-                        const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
-                        const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
-                        const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
+                        u_states[idx_state_y_B]   = u_y_B;
+                        u_states[idx_state_y_BB]  = u_y_BB;
+                        u_states[idx_state_y_BBB] = u_y_BBB;
                         
-                        /*
-                         * Compute derivatives in x-direction.
-                         */
+                        v_states[idx_state_y_B]   = v_y_B;
+                        v_states[idx_state_y_BB]  = v_y_BB;
+                        v_states[idx_state_y_BBB] = v_y_BBB;
                         
-                        double du_dx = double(0);
-                        double dv_dx = double(0);
-                        double dp_dx = double(0);
+                        epsilon_states[idx_state_y_B]   = epsilon_y_B;
+                        epsilon_states[idx_state_y_BB]  = epsilon_y_BB;
+                        epsilon_states[idx_state_y_BBB] = epsilon_y_BBB;
                         
                         if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                             (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -2678,16 +3346,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_x_R = Q[2][idx_cell_mom_x_R]/rho_x_R;
                             const double epsilon_x_R = Q[3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                             
-                            const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_R]     = rho_x_R;
+                            u_states[idx_state_x_R]       = u_x_R;
+                            v_states[idx_state_x_R]       = v_x_R;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
                             
-                            // One-sided derivatives.
-                            du_dx = (u_x_R - u_y_B)/(dx[0]);
-                            dv_dx = (v_x_R - v_y_B)/(dx[0]);
-                            dp_dx = (p_x_R - p_y_B)/(dx[0]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_L]     = rho_y_B;
+                            epsilon_states[idx_state_x_L] = epsilon_y_B;
                         }
                         else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                  (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -2713,16 +3380,15 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double v_x_L = Q[2][idx_cell_mom_x_L]/rho_x_L;
                             const double epsilon_x_L = Q[3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                             
-                            const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_L]     = rho_x_L;
+                            u_states[idx_state_x_L]       = u_x_L;
+                            v_states[idx_state_x_L]       = v_x_L;
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
                             
-                            // One-sided derivatives.
-                            du_dx = (u_y_B - u_x_L)/(dx[0]);
-                            dv_dx = (v_y_B - v_x_L)/(dx[0]);
-                            dp_dx = (p_y_B - p_x_L)/(dx[0]);
+                            // Fill the slot of the missing neighbor with the state at the boundary so that the
+                            // equation of state is only evaluated on valid states.
+                            rho_states[idx_state_x_R]     = rho_y_B;
+                            epsilon_states[idx_state_x_R] = epsilon_y_B;
                         }
                         else
                         {
@@ -2756,57 +3422,168 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             const double epsilon_x_L = Q[3][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L);
                             const double epsilon_x_R = Q[3][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R);
                             
-                            const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_L] = rho_x_L;
+                            rho_states[idx_state_x_R] = rho_x_R;
                             
-                            const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    thermo_properties_ptr);
+                            u_states[idx_state_x_L] = u_x_L;
+                            u_states[idx_state_x_R] = u_x_R;
                             
-                            // Central derivatives.
-                            du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                            dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                            dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            v_states[idx_state_x_L] = v_x_L;
+                            v_states[idx_state_x_R] = v_x_R;
+                            
+                            epsilon_states[idx_state_x_L] = epsilon_x_L;
+                            epsilon_states[idx_state_x_R] = epsilon_x_R;
                         }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                    {
+                        const int idx_line = i - fill_box_lo_idx[0];
                         
-                        // Compute wave speed (v - c) at the boundary.
-                        
-                        const double c_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                            getSoundSpeed(
-                                &rho_y_B,
-                                &p_y_B,
-                                thermo_properties_ptr);
-                        
-                        const double lambda_1 = v_y_B - c_y_B;
+                        const int idx_state_y_B   = idx_line;
+                        const int idx_state_y_BB  = idx_line + num_lines;
+                        const int idx_state_y_BBB = idx_line + 2*num_lines;
+                        const int idx_state_x_L   = idx_line + 3*num_lines;
+                        const int idx_state_x_R   = idx_line + 4*num_lines;
                         
-                        // Compute vector Lambda^(-1) * L.
+                        const double& rho_y_B   = rho_states[idx_state_y_B];
+                        const double& rho_y_BB  = rho_states[idx_state_y_BB];
+                        const double& rho_y_BBB = rho_states[idx_state_y_BBB];
                         
-                        double Lambda_inv_L[4];
+                        const double& u_y_B   = u_states[idx_state_y_B];
+                        const double& u_y_BB  = u_states[idx_state_y_BB];
+                        const double& u_y_BBB = u_states[idx_state_y_BBB];
                         
-                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
-                        const double& sigma       = d_bdry_edge_nonreflecting_outflow_sigma[edge_loc];
-                        const double& beta        = d_bdry_edge_nonreflecting_outflow_beta[edge_loc];
-                        const double& length_char = d_bdry_edge_nonreflecting_outflow_length_char[edge_loc];
+                        const double& v_y_B   = v_states[idx_state_y_B];
+                        const double& v_y_BB  = v_states[idx_state_y_BB];
+                        const double& v_y_BBB = v_states[idx_state_y_BBB];
                         
-                        const double T_1 = u_y_B*(dp_dx - rho_y_B*c_y_B*dv_dx) + rho_y_B*c_y_B*c_y_B*du_dx;
+                        const double& p_y_B   = p_states[idx_state_y_B];
+                        const double& p_y_BB  = p_states[idx_state_y_BB];
+                        const double& p_y_BBB = p_states[idx_state_y_BBB];
                         
-                        const double M_sq = (v_y_B*v_y_B + u_y_B*u_y_B)/(c_y_B*c_y_B);
-                        const double K = sigma*c_y_B*(double(1) - M_sq)/length_char;
+                        /*
+                         * Compute derivatives in y-direction.
+                         */
                         
-                        Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_y_B - p_t) - (double(1) - beta)*T_1);
-                        Lambda_inv_L[1] = du_dy;
-                        Lambda_inv_L[2] = c_y_B*c_y_B*drho_dy - dp_dy;
-                        Lambda_inv_L[3] = dp_dy + rho_y_B*c_y_B*dv_dy;
+                        const double drho_dy = (rho_y_BBB - double(4)*rho_y_BB + double(3)*rho_y_B)/(double(2)*dx[1]);
+                        const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
+                        const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
+                        const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
                         
-                        // Compute dV_dy.
+                        /*
+                         * Compute derivatives in x-direction.
+                         */
                         
-                        const double c_sq_inv  = double(1)/(c_y_B*c_y_B);
-                        const double rho_c_inv = double(1)/(rho_y_B*c_y_B);
+                        double du_dx = double(0);
+                        double dv_dx = double(0);
+                        double dp_dx = double(0);
+                        
+                        if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            (i + num_subghosts_conservative_var[2][0] == 0))
+                        // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                        //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                        //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_R = p_states[idx_state_x_R];
+                            
+                            // One-sided derivatives.
+                            du_dx = (u_x_R - u_y_B)/(dx[0]);
+                            dv_dx = (v_x_R - v_y_B)/(dx[0]);
+                            dp_dx = (p_x_R - p_y_B)/(dx[0]);
+                        }
+                        else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                 (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                 (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                        // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                        //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                        //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                        //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                        {
+                            // Patch is touching periodic boundary.
+                            
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& p_x_L = p_states[idx_state_x_L];
+                            
+                            // One-sided derivatives.
+                            du_dx = (u_y_B - u_x_L)/(dx[0]);
+                            dv_dx = (v_y_B - v_x_L)/(dx[0]);
+                            dp_dx = (p_y_B - p_x_L)/(dx[0]);
+                        }
+                        else
+                        {
+                            const double& u_x_L = u_states[idx_state_x_L];
+                            const double& u_x_R = u_states[idx_state_x_R];
+                            const double& v_x_L = v_states[idx_state_x_L];
+                            const double& v_x_R = v_states[idx_state_x_R];
+                            const double& p_x_L = p_states[idx_state_x_L];
+                            const double& p_x_R = p_states[idx_state_x_R];
+                            
+                            // Central derivatives.
+                            du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                            dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                            dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                        }
+                        
+                        // Compute wave speed (v - c) at the boundary.
+                        
+                        const double& c_y_B = c_bdry[idx_line];
+                        
+                        const double lambda_1 = v_y_B - c_y_B;
+                        
+                        // Compute vector Lambda^(-1) * L.
+                        
+                        double Lambda_inv_L[4];
+                        
+                        const double& p_t         = d_bdry_edge_nonreflecting_outflow_p_t[edge_loc];
+                        const double& sigma       = d_bdry_edge_nonreflecting_outflow_sigma[edge_loc];
+                        const double& beta        = d_bdry_edge_nonreflecting_outflow_beta[edge_loc];
+                        const double& length_char = d_bdry_edge_nonreflecting_outflow_length_char[edge_loc];
+                        
+                        const double T_1 = u_y_B*(dp_dx - rho_y_B*c_y_B*dv_dx) + rho_y_B*c_y_B*c_y_B*du_dx;
+                        
+                        const double M_sq = (v_y_B*v_y_B + u_y_B*u_y_B)/(c_y_B*c_y_B);
+                        const double K = sigma*c_y_B*(double(1) - M_sq)/length_char;
+                        
+                        Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_y_B - p_t) - (double(1) - beta)*T_1);
+                        Lambda_inv_L[1] = du_dy;
+                        Lambda_inv_L[2] = c_y_B*c_y_B*drho_dy - dp_dy;
+                        Lambda_inv_L[3] = dp_dy + rho_y_B*c_y_B*dv_dy;
+                        
+                        // Compute dV_dy.
+                        
+                        const double c_sq_inv  = double(1)/(c_y_B*c_y_B);
+                        const double rho_c_inv = double(1)/(rho_y_B*c_y_B);
                         
                         double dV_dy[4];
                         
@@ -2937,19 +3714,37 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dEdgeBoundaryData(
                             Q[1][idx_cell_mom] = V_ghost[j*4 + 0]*V_ghost[j*4 + 1];
                             Q[2][idx_cell_mom] = V_ghost[j*4 + 0]*V_ghost[j*4 + 2];
                             
-                            const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergy(
-                                    &V_ghost[j*4 + 0],
-                                    &V_ghost[j*4 + 3],
-                                    thermo_properties_ptr);
+                            const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                             
-                            const double E = V_ghost[j*4 + 0]*epsilon +
-                                half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    V_ghost[j*4 + 0];
+                            rho_ghosts[idx_ghost] = V_ghost[j*4 + 0];
+                            p_ghosts[idx_ghost]   = V_ghost[j*4 + 3];
                             
-                            Q[3][idx_cell_E] = E;
+                            idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                            idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                rho_ghosts[idx_ghost];
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
                 }
                 
                 // Remove edge locations that have boundary conditions identified.
@@ -3166,16 +3961,30 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3242,48 +4051,102 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
                                 double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_0*2 + 1];
                             
                             /*
-                             * Set the values for total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[3][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[3][idx_cell_pivot_E] -
                                 0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                      Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom])/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &epsilon_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getTemperature(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &p_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergyFromTemperature(
-                                    &Q[0][idx_cell_rho],
-                                    &T,
-                                    thermo_properties_ptr);
+                            rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                            idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
                             
-                            double E = Q[0][idx_cell_rho]*epsilon +
-                                0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                            
-                            Q[3][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                Q[0][idx_cell_rho];
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3350,48 +4213,106 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
                                 double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_edge_adiabatic_no_slip_vel[edge_loc_1*2 + 1];
                             
                             /*
-                             * Set the values for total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[3][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[3][idx_cell_pivot_E] -
                                 0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                      Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom])/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &epsilon_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getTemperature(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &p_pivot,
-                                    thermo_properties_ptr);
+                            rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                            idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
                             
-                            double T = T_pivot;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergyFromTemperature(
-                                    &Q[0][idx_cell_rho],
-                                    &T,
-                                    thermo_properties_ptr);
-                            
-                            double E = Q[0][idx_cell_rho]*epsilon +
-                                0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                Q[0][idx_cell_rho];
-                            
-                            Q[3][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3448,65 +4369,135 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
                             }
                             
                             /*
-                             * Set the values for density, momentum and total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[3][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[3][idx_cell_pivot_E] -
                                 0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                      Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom])/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &epsilon_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double p = p_pivot;
-                            
-                            double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getTemperature(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &p_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double T = -T_pivot + double(2)*d_bdry_edge_isothermal_no_slip_T[edge_loc_0];
-                            
-                            double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getDensity(
-                                    &p,
-                                    &T,
-                                    thermo_properties_ptr);
-                            
-                            double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2];
-                            double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2 + 1];
-                            
-                            Q[0][idx_cell_rho] = rho;
-                            Q[1][idx_cell_mom] = rho*u;
-                            Q[2][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    thermo_properties_ptr);
+                            rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                            idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
+                            idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                            idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                             
-                            double E = rho*epsilon +
-                                0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    rho;
-                            
-                            Q[3][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_edge_isothermal_no_slip_T[edge_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_0*2 + 1];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                rho;
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -3563,59 +4554,103 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill2dNodeBoundaryData(
                             }
                             
                             /*
-                             * Set the values for density, momentum and total internal energy.
+                             * Store the density and specific internal energy of the pivot.
                              */
                             
-                            double epsilon_pivot = (Q[3][idx_cell_pivot_E] -
+                            epsilon_pivot_fill[count_fill] = (Q[3][idx_cell_pivot_E] -
                                 0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                      Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom])/
                                 Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                             
-                            double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &epsilon_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double p = p_pivot;
+                            rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                            idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                            idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                            idx_cell_E_fill[count_fill] = idx_cell_E;
+                            idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                            idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                             
-                            double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getTemperature(
-                                    &Q[0][idx_cell_pivot_rho],
-                                    &p_pivot,
-                                    thermo_properties_ptr);
-                            
-                            double T = -T_pivot + double(2)*d_bdry_edge_isothermal_no_slip_T[edge_loc_1];
-                            
-                            double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getDensity(
-                                    &p,
-                                    &T,
-                                    thermo_properties_ptr);
-                            
-                            double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2];
-                            double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2 + 1];
-                            
-                            Q[0][idx_cell_rho] = rho;
-                            Q[1][idx_cell_mom] = rho*u;
-                            Q[2][idx_cell_mom] = rho*v;
-                            
-                            double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getInternalEnergyFromTemperature(
-                                    &rho,
-                                    &T,
-                                    thermo_properties_ptr);
-                            
-                            double E = rho*epsilon +
-                                0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
-                                    rho;
-                            
-                            Q[3][idx_cell_E] = E;
+                            count_fill++;
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_edge_isothermal_no_slip_T[edge_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[edge_loc_1*2 + 1];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom])/
+                                rho;
+                        
+                        Q[3][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
@@ -3803,16 +4838,30 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (bdry_face_conds[face_loc] == BDRY_COND::FLOW_MODEL::ADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4014,51 +5063,109 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                     double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_face_adiabatic_no_slip_vel[face_loc*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &Q[0][idx_cell_rho],
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = Q[0][idx_cell_rho]*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove face locations that have boundary conditions identified.
                     bdry_face_locs.erase(std::remove(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc),
                         bdry_face_locs.end());
                 }
                 else if (bdry_face_conds[face_loc] == BDRY_COND::FLOW_MODEL::ISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -4248,71 +5355,115 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 }
                                 
                                 /*
-                                 * Set the values for density, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = -T_pivot + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc];
-                                
-                                double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getDensity(
-                                        &p,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_face_isothermal_no_slip_vel[face_loc*3];
-                                double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 1];
-                                double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 2];
-                                
-                                Q[0][idx_cell_rho] = rho;
-                                Q[1][idx_cell_mom] = rho*u;
-                                Q[2][idx_cell_mom] = rho*v;
-                                Q[3][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double E = rho*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
-                    // Remove face locations that have boundary conditions identified.
-                    bdry_face_locs.erase(std::remove(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc),
-                        bdry_face_locs.end());
-                }
-            }
-        }
-    }
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_face_isothermal_no_slip_vel[face_loc*3];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 1];
+                        double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_face_isothermal_no_slip_vel[face_loc*3 + 2];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        Q[3][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
+                    // Remove face locations that have boundary conditions identified.
+                    bdry_face_locs.erase(std::remove(bdry_face_locs.begin(), bdry_face_locs.end(), face_loc),
+                        bdry_face_locs.end());
+                }
+            }
+        }
+    }
     
     /*
      * 2. Fill ghost cells for faces with non-reflecting boundary conditions.
@@ -4387,14 +5538,6 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (face_loc == BDRY_LOC::XLO)
                 {
                     const int num_ghosts_to_fill = fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1;
@@ -4406,12 +5549,51 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(6*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                            
+                            const int idx_state_x_R   = idx_line;
+                            const int idx_state_x_RR  = idx_line + num_lines;
+                            const int idx_state_x_RRR = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_x_R = (interior_box_lo_idx[0] + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -4474,47 +5656,29 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             const double w_x_RR  = Q[3][idx_cell_mom_x_RR]/rho_x_RR;
                             const double w_x_RRR = Q[3][idx_cell_mom_x_RRR]/rho_x_RRR;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_x_R   = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                             const double epsilon_x_RR  = Q[4][idx_cell_E_x_RR]/rho_x_RR - half*(u_x_RR*u_x_RR + v_x_RR*v_x_RR + w_x_RR*w_x_RR);
                             const double epsilon_x_RRR = Q[4][idx_cell_E_x_RRR]/rho_x_RRR - half*(u_x_RRR*u_x_RRR + v_x_RRR*v_x_RRR + w_x_RRR*w_x_RRR);
                             
-                            const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_R,
-                                    &epsilon_x_R,
-                                    thermo_properties_ptr);
-                            
-                            const double p_x_RR = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_RR,
-                                    &epsilon_x_RR,
-                                    thermo_properties_ptr);
-                            
-                            const double p_x_RRR = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_RRR,
-                                    &epsilon_x_RRR,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_R]   = rho_x_R;
+                            rho_states[idx_state_x_RR]  = rho_x_RR;
+                            rho_states[idx_state_x_RRR] = rho_x_RRR;
                             
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
+                            u_states[idx_state_x_R]   = u_x_R;
+                            u_states[idx_state_x_RR]  = u_x_RR;
+                            u_states[idx_state_x_RRR] = u_x_RRR;
                             
-                            const double drho_dx = -(rho_x_RRR - double(4)*rho_x_RR + double(3)*rho_x_R)/(double(2)*dx[0]);
-                            const double du_dx   = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
-                            const double dv_dx   = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
-                            const double dw_dx   = -(w_x_RRR - double(4)*w_x_RR + double(3)*w_x_R)/(double(2)*dx[0]);
-                            const double dp_dx   = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
+                            v_states[idx_state_x_R]   = v_x_R;
+                            v_states[idx_state_x_RR]  = v_x_RR;
+                            v_states[idx_state_x_RRR] = v_x_RRR;
                             
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
+                            w_states[idx_state_x_R]   = w_x_R;
+                            w_states[idx_state_x_RR]  = w_x_RR;
+                            w_states[idx_state_x_RRR] = w_x_RRR;
                             
-                            double du_dy = double(0);
-                            double dv_dy = double(0);
-                            // double dw_dy = double(0);
-                            double dp_dy = double(0);
+                            epsilon_states[idx_state_x_R]   = epsilon_x_R;
+                            epsilon_states[idx_state_x_RR]  = epsilon_x_RR;
+                            epsilon_states[idx_state_x_RRR] = epsilon_x_RRR;
                             
                             if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                                 (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -4547,17 +5711,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_y_T = Q[3][idx_cell_mom_y_T]/rho_y_T;
                                 const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                                 
-                                // One-sided derivatives.
-                                du_dy = (u_y_T - u_x_R)/(dx[1]);
-                                dv_dy = (v_y_T - v_x_R)/(dx[1]);
-                                // dw_dy = (w_y_T - w_x_R)/(dx[1]);
-                                dp_dy = (p_y_T - p_x_R)/(dx[1]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_x_R;
+                                epsilon_states[idx_state_y_B] = epsilon_x_R;
                             }
                             else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                      (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -4590,17 +5753,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_y_B = Q[3][idx_cell_mom_y_B]/rho_y_B;
                                 const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
                                 
-                                // One-sided derivatives.
-                                du_dy = (u_x_R - u_y_B)/(dx[1]);
-                                dv_dy = (v_x_R - v_y_B)/(dx[1]);
-                                // dw_dy = (w_x_R - w_y_B)/(dx[1]);
-                                dp_dy = (p_x_R - p_y_B)/(dx[1]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_x_R;
+                                epsilon_states[idx_state_y_T] = epsilon_x_R;
                             }
                             else
                             {
@@ -4649,34 +5811,22 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
                                 
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
                                 
-                                // Central derivatives.
-                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
-                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
-                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
-                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            double du_dz = double(0);
-                            // double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if ((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0))
@@ -4708,17 +5858,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_F = Q[3][idx_cell_mom_z_F]/rho_z_F;
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                                 
-                                // One-sided derivatives.
-                                du_dz = (u_z_F - u_x_R)/(dx[2]);
-                                // dv_dz = (v_z_F - v_x_R)/(dx[2]);
-                                dw_dz = (w_z_F - w_x_R)/(dx[2]);
-                                dp_dz = (p_z_F - p_x_R)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_x_R;
+                                epsilon_states[idx_state_z_B] = epsilon_x_R;
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -4751,17 +5900,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_B = Q[3][idx_cell_mom_z_B]/rho_z_B;
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                // One-sided derivatives.
-                                du_dz = (u_x_R - u_z_B)/(dx[2]);
-                                // dv_dz = (v_x_R - v_z_B)/(dx[2]);
-                                dw_dz = (w_x_R - w_z_B)/(dx[2]);
-                                dp_dz = (p_x_R - p_z_B)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_x_R;
+                                epsilon_states[idx_state_z_F] = epsilon_x_R;
                             }
                             else
                             {
@@ -4810,17 +5958,222 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
+                                
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
+                                
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
+                            }
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                        {
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                            
+                            const int idx_state_x_R   = idx_line;
+                            const int idx_state_x_RR  = idx_line + num_lines;
+                            const int idx_state_x_RRR = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
+                            
+                            const double& rho_x_R   = rho_states[idx_state_x_R];
+                            const double& rho_x_RR  = rho_states[idx_state_x_RR];
+                            const double& rho_x_RRR = rho_states[idx_state_x_RRR];
+                            
+                            const double& u_x_R   = u_states[idx_state_x_R];
+                            const double& u_x_RR  = u_states[idx_state_x_RR];
+                            const double& u_x_RRR = u_states[idx_state_x_RRR];
+                            
+                            const double& v_x_R   = v_states[idx_state_x_R];
+                            const double& v_x_RR  = v_states[idx_state_x_RR];
+                            const double& v_x_RRR = v_states[idx_state_x_RRR];
+                            
+                            const double& w_x_R   = w_states[idx_state_x_R];
+                            const double& w_x_RR  = w_states[idx_state_x_RR];
+                            const double& w_x_RRR = w_states[idx_state_x_RRR];
+                            
+                            const double& p_x_R   = p_states[idx_state_x_R];
+                            const double& p_x_RR  = p_states[idx_state_x_RR];
+                            const double& p_x_RRR = p_states[idx_state_x_RRR];
+                            
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
+                            
+                            const double drho_dx = -(rho_x_RRR - double(4)*rho_x_RR + double(3)*rho_x_R)/(double(2)*dx[0]);
+                            const double du_dx   = -(u_x_RRR - double(4)*u_x_RR + double(3)*u_x_R)/(double(2)*dx[0]);
+                            const double dv_dx   = -(v_x_RRR - double(4)*v_x_RR + double(3)*v_x_R)/(double(2)*dx[0]);
+                            const double dw_dx   = -(w_x_RRR - double(4)*w_x_RR + double(3)*w_x_R)/(double(2)*dx[0]);
+                            const double dp_dx   = -(p_x_RRR - double(4)*p_x_RR + double(3)*p_x_R)/(double(2)*dx[0]);
+                            
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
+                            
+                            double du_dy = double(0);
+                            double dv_dy = double(0);
+                            // double dw_dy = double(0);
+                            double dp_dy = double(0);
+                            
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // One-sided derivatives.
+                                du_dy = (u_y_T - u_x_R)/(dx[1]);
+                                dv_dy = (v_y_T - v_x_R)/(dx[1]);
+                                // dw_dy = (w_y_T - w_x_R)/(dx[1]);
+                                dp_dy = (p_y_T - p_x_R)/(dx[1]);
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                
+                                // One-sided derivatives.
+                                du_dy = (u_x_R - u_y_B)/(dx[1]);
+                                dv_dy = (v_x_R - v_y_B)/(dx[1]);
+                                // dw_dy = (w_x_R - w_y_B)/(dx[1]);
+                                dp_dy = (p_x_R - p_y_B)/(dx[1]);
+                            }
+                            else
+                            {
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // Central derivatives.
+                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
+                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
+                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            double du_dz = double(0);
+                            // double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                du_dz = (u_z_F - u_x_R)/(dx[2]);
+                                // dv_dz = (v_z_F - v_x_R)/(dx[2]);
+                                dw_dz = (w_z_F - w_x_R)/(dx[2]);
+                                dp_dz = (p_z_F - p_x_R)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                // One-sided derivatives.
+                                du_dz = (u_x_R - u_z_B)/(dx[2]);
+                                // dv_dz = (v_x_R - v_z_B)/(dx[2]);
+                                dw_dz = (w_x_R - w_z_B)/(dx[2]);
+                                dp_dz = (p_x_R - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
                                 
                                 // Central derivatives.
                                 du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
@@ -4829,11 +6182,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
                             }
                             
-                            const double c_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getSoundSpeed(
-                                    &rho_x_R,
-                                    &p_x_R,
-                                    thermo_properties_ptr);
+                            const double& c_x_R = c_bdry[idx_line];
                             
                             const double lambda_5 = u_x_R + c_x_R;
                             
@@ -5019,20 +6368,38 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 Q[2][idx_cell_mom] = V_ghost[i*5 + 0]*V_ghost[i*5 + 2];
                                 Q[3][idx_cell_mom] = V_ghost[i*5 + 0]*V_ghost[i*5 + 3];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergy(
-                                        &V_ghost[i*5 + 0],
-                                        &V_ghost[i*5 + 4],
-                                        thermo_properties_ptr);
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                                 
-                                const double E = V_ghost[i*5 + 0]*epsilon +
-                                    half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                       Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/V_ghost[i*5 + 0];
+                                rho_ghosts[idx_ghost] = V_ghost[i*5 + 0];
+                                p_ghosts[idx_ghost]   = V_ghost[i*5 + 4];
                                 
-                                Q[4][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                               Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho_ghosts[idx_ghost];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::XHI)
                 {
@@ -5045,12 +6412,51 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(6*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                            
+                            const int idx_state_x_L   = idx_line;
+                            const int idx_state_x_LL  = idx_line + num_lines;
+                            const int idx_state_x_LLL = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_x_L = (interior_box_hi_idx[0] + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -5113,47 +6519,29 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             const double w_x_LL  = Q[3][idx_cell_mom_x_LL]/rho_x_LL;
                             const double w_x_LLL = Q[3][idx_cell_mom_x_LLL]/rho_x_LLL;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_x_L   = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                             const double epsilon_x_LL  = Q[4][idx_cell_E_x_LL]/rho_x_LL - half*(u_x_LL*u_x_LL + v_x_LL*v_x_LL + w_x_LL*w_x_LL);
                             const double epsilon_x_LLL = Q[4][idx_cell_E_x_LLL]/rho_x_LLL - half*(u_x_LLL*u_x_LLL + v_x_LLL*v_x_LLL + w_x_LLL*w_x_LLL);
                             
-                            const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_L,
-                                    &epsilon_x_L,
-                                    thermo_properties_ptr);
-                            
-                            const double p_x_LL = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_LL,
-                                    &epsilon_x_LL,
-                                    thermo_properties_ptr);
-                            
-                            const double p_x_LLL = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_x_LLL,
-                                    &epsilon_x_LLL,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_x_L]   = rho_x_L;
+                            rho_states[idx_state_x_LL]  = rho_x_LL;
+                            rho_states[idx_state_x_LLL] = rho_x_LLL;
                             
-                            /*
-                             * Compute derivatives at x-direction.
-                             */
+                            u_states[idx_state_x_L]   = u_x_L;
+                            u_states[idx_state_x_LL]  = u_x_LL;
+                            u_states[idx_state_x_LLL] = u_x_LLL;
                             
-                            const double drho_dx = (rho_x_LLL - double(4)*rho_x_LL + double(3)*rho_x_L)/(double(2)*dx[0]);
-                            const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
-                            const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
-                            const double dw_dx   = (w_x_LLL - double(4)*w_x_LL + double(3)*w_x_L)/(double(2)*dx[0]);
-                            const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
+                            v_states[idx_state_x_L]   = v_x_L;
+                            v_states[idx_state_x_LL]  = v_x_LL;
+                            v_states[idx_state_x_LLL] = v_x_LLL;
                             
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
+                            w_states[idx_state_x_L]   = w_x_L;
+                            w_states[idx_state_x_LL]  = w_x_LL;
+                            w_states[idx_state_x_LLL] = w_x_LLL;
                             
-                            double du_dy = double(0);
-                            double dv_dy = double(0);
-                            // double dw_dy = double(0);
-                            double dp_dy = double(0);
+                            epsilon_states[idx_state_x_L]   = epsilon_x_L;
+                            epsilon_states[idx_state_x_LL]  = epsilon_x_LL;
+                            epsilon_states[idx_state_x_LLL] = epsilon_x_LLL;
                             
                             if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                                 (j + num_subghosts_conservative_var[1][1] == 0) ||
@@ -5186,17 +6574,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_y_T = Q[3][idx_cell_mom_y_T]/rho_y_T;
                                 const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                                 
-                                // One-sided derivatives.
-                                du_dy = (u_y_T - u_x_L)/(dx[1]);
-                                dv_dy = (v_y_T - v_x_L)/(dx[1]);
-                                // dw_dy = (w_y_T - w_x_L)/(dx[1]);
-                                dp_dy = (p_y_T - p_x_L)/(dx[1]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_x_L;
+                                epsilon_states[idx_state_y_B] = epsilon_x_L;
                             }
                             else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                      (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -5229,17 +6616,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_y_B = Q[3][idx_cell_mom_y_B]/rho_y_B;
                                 const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
                                 
-                                // One-sided derivatives.
-                                du_dy = (u_x_L - u_y_B)/(dx[1]);
-                                dv_dy = (v_x_L - v_y_B)/(dx[1]);
-                                // dw_dy = (w_x_L - w_y_B)/(dx[1]);
-                                dp_dy = (p_x_L - p_y_B)/(dx[1]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_x_L;
+                                epsilon_states[idx_state_y_T] = epsilon_x_L;
                             }
                             else
                             {
@@ -5288,34 +6674,22 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
                                 
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
                                 
-                                // Central derivatives.
-                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
-                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
-                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
-                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            double du_dz = double(0);
-                            // double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if ((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0))
@@ -5347,17 +6721,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_F = Q[3][idx_cell_mom_z_F]/rho_z_F;
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                                 
-                                // One-sided derivatives.
-                                du_dz = (u_z_F - u_x_L)/(dx[2]);
-                                // dv_dz = (v_z_F - v_x_L)/(dx[2]);
-                                dw_dz = (w_z_F - w_x_L)/(dx[2]);
-                                dp_dz = (p_z_F - p_x_L)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_x_L;
+                                epsilon_states[idx_state_z_B] = epsilon_x_L;
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -5390,17 +6763,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_B = Q[3][idx_cell_mom_z_B]/rho_z_B;
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                // One-sided derivatives.
-                                du_dz = (u_x_L - u_z_B)/(dx[2]);
-                                // dv_dz = (v_x_L - v_z_B)/(dx[2]);
-                                dw_dz = (w_x_L - w_z_B)/(dx[2]);
-                                dp_dz = (p_x_L - p_z_B)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_x_L;
+                                epsilon_states[idx_state_z_F] = epsilon_x_L;
                             }
                             else
                             {
@@ -5449,17 +6821,222 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
+                                
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
+                                
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
+                            }
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                        {
+                            const int idx_line = (j - fill_box_lo_idx[1]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                            
+                            const int idx_state_x_L   = idx_line;
+                            const int idx_state_x_LL  = idx_line + num_lines;
+                            const int idx_state_x_LLL = idx_line + 2*num_lines;
+                            const int idx_state_y_B   = idx_line + 3*num_lines;
+                            const int idx_state_y_T   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
+                            
+                            const double& rho_x_L   = rho_states[idx_state_x_L];
+                            const double& rho_x_LL  = rho_states[idx_state_x_LL];
+                            const double& rho_x_LLL = rho_states[idx_state_x_LLL];
+                            
+                            const double& u_x_L   = u_states[idx_state_x_L];
+                            const double& u_x_LL  = u_states[idx_state_x_LL];
+                            const double& u_x_LLL = u_states[idx_state_x_LLL];
+                            
+                            const double& v_x_L   = v_states[idx_state_x_L];
+                            const double& v_x_LL  = v_states[idx_state_x_LL];
+                            const double& v_x_LLL = v_states[idx_state_x_LLL];
+                            
+                            const double& w_x_L   = w_states[idx_state_x_L];
+                            const double& w_x_LL  = w_states[idx_state_x_LL];
+                            const double& w_x_LLL = w_states[idx_state_x_LLL];
+                            
+                            const double& p_x_L   = p_states[idx_state_x_L];
+                            const double& p_x_LL  = p_states[idx_state_x_LL];
+                            const double& p_x_LLL = p_states[idx_state_x_LLL];
+                            
+                            /*
+                             * Compute derivatives at x-direction.
+                             */
+                            
+                            const double drho_dx = (rho_x_LLL - double(4)*rho_x_LL + double(3)*rho_x_L)/(double(2)*dx[0]);
+                            const double du_dx   = (u_x_LLL - double(4)*u_x_LL + double(3)*u_x_L)/(double(2)*dx[0]);
+                            const double dv_dx   = (v_x_LLL - double(4)*v_x_LL + double(3)*v_x_L)/(double(2)*dx[0]);
+                            const double dw_dx   = (w_x_LLL - double(4)*w_x_LL + double(3)*w_x_L)/(double(2)*dx[0]);
+                            const double dp_dx   = (p_x_LLL - double(4)*p_x_LL + double(3)*p_x_L)/(double(2)*dx[0]);
+                            
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
+                            
+                            double du_dy = double(0);
+                            double dv_dy = double(0);
+                            // double dw_dy = double(0);
+                            double dp_dy = double(0);
+                            
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // One-sided derivatives.
+                                du_dy = (u_y_T - u_x_L)/(dx[1]);
+                                dv_dy = (v_y_T - v_x_L)/(dx[1]);
+                                // dw_dy = (w_y_T - w_x_L)/(dx[1]);
+                                dp_dy = (p_y_T - p_x_L)/(dx[1]);
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                
+                                // One-sided derivatives.
+                                du_dy = (u_x_L - u_y_B)/(dx[1]);
+                                dv_dy = (v_x_L - v_y_B)/(dx[1]);
+                                // dw_dy = (w_x_L - w_y_B)/(dx[1]);
+                                dp_dy = (p_x_L - p_y_B)/(dx[1]);
+                            }
+                            else
+                            {
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // Central derivatives.
+                                du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
+                                // dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
+                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            double du_dz = double(0);
+                            // double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                du_dz = (u_z_F - u_x_L)/(dx[2]);
+                                // dv_dz = (v_z_F - v_x_L)/(dx[2]);
+                                dw_dz = (w_z_F - w_x_L)/(dx[2]);
+                                dp_dz = (p_z_F - p_x_L)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                // One-sided derivatives.
+                                du_dz = (u_x_L - u_z_B)/(dx[2]);
+                                // dv_dz = (v_x_L - v_z_B)/(dx[2]);
+                                dw_dz = (w_x_L - w_z_B)/(dx[2]);
+                                dp_dz = (p_x_L - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
                                 
                                 // Central derivatives.
                                 du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
@@ -5468,11 +7045,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
                             }
                             
-                            const double c_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getSoundSpeed(
-                                    &rho_x_L,
-                                    &p_x_L,
-                                    thermo_properties_ptr);
+                            const double& c_x_L = c_bdry[idx_line];
                             
                             const double lambda_1 = u_x_L - c_x_L;
                             
@@ -5658,20 +7231,38 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 Q[2][idx_cell_mom] = V_ghost[i*5 + 0]*V_ghost[i*5 + 2];
                                 Q[3][idx_cell_mom] = V_ghost[i*5 + 0]*V_ghost[i*5 + 3];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergy(
-                                        &V_ghost[i*5 + 0],
-                                        &V_ghost[i*5 + 4],
-                                        thermo_properties_ptr);
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + i;
                                 
-                                const double E = V_ghost[i*5 + 0]*epsilon +
-                                    half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                       Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/V_ghost[i*5 + 0];
+                                rho_ghosts[idx_ghost] = V_ghost[i*5 + 0];
+                                p_ghosts[idx_ghost]   = V_ghost[i*5 + 4];
                                 
-                                Q[4][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                               Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho_ghosts[idx_ghost];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::YLO)
                 {
@@ -5684,12 +7275,51 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(6*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_y_T   = idx_line;
+                            const int idx_state_y_TT  = idx_line + num_lines;
+                            const int idx_state_y_TTT = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_y_T = (i + num_subghosts_conservative_var[0][0]) +
                                 (interior_box_lo_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -5752,47 +7382,29 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             const double w_y_TT  = Q[3][idx_cell_mom_y_TT]/rho_y_TT;
                             const double w_y_TTT = Q[3][idx_cell_mom_y_TTT]/rho_y_TTT;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_y_T   = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                             const double epsilon_y_TT  = Q[4][idx_cell_E_y_TT]/rho_y_TT - half*(u_y_TT*u_y_TT + v_y_TT*v_y_TT + w_y_TT*w_y_TT);
                             const double epsilon_y_TTT = Q[4][idx_cell_E_y_TTT]/rho_y_TTT - half*(u_y_TTT*u_y_TTT + v_y_TTT*v_y_TTT + w_y_TTT*w_y_TTT);
                             
-                            const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_T,
-                                    &epsilon_y_T,
-                                    thermo_properties_ptr);
-                            
-                            const double p_y_TT = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_TT,
-                                    &epsilon_y_TT,
-                                    thermo_properties_ptr);
-                            
-                            const double p_y_TTT = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_TTT,
-                                    &epsilon_y_TTT,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_T]   = rho_y_T;
+                            rho_states[idx_state_y_TT]  = rho_y_TT;
+                            rho_states[idx_state_y_TTT] = rho_y_TTT;
                             
-                            /*
-                             * Compute derivatives at y-direction.
-                             */
+                            u_states[idx_state_y_T]   = u_y_T;
+                            u_states[idx_state_y_TT]  = u_y_TT;
+                            u_states[idx_state_y_TTT] = u_y_TTT;
                             
-                            const double drho_dy = -(rho_y_TTT - double(4)*rho_y_TT + double(3)*rho_y_T)/(double(2)*dx[1]);
-                            const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
-                            const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
-                            const double dw_dy   = -(w_y_TTT - double(4)*w_y_TT + double(3)*w_y_T)/(double(2)*dx[1]);
-                            const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
+                            v_states[idx_state_y_T]   = v_y_T;
+                            v_states[idx_state_y_TT]  = v_y_TT;
+                            v_states[idx_state_y_TTT] = v_y_TTT;
                             
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
+                            w_states[idx_state_y_T]   = w_y_T;
+                            w_states[idx_state_y_TT]  = w_y_TT;
+                            w_states[idx_state_y_TTT] = w_y_TTT;
                             
-                            double du_dx = double(0);
-                            double dv_dx = double(0);
-                            // double dw_dx = double(0);
-                            double dp_dx = double(0);
+                            epsilon_states[idx_state_y_T]   = epsilon_y_T;
+                            epsilon_states[idx_state_y_TT]  = epsilon_y_TT;
+                            epsilon_states[idx_state_y_TTT] = epsilon_y_TTT;
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -5825,17 +7437,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_R = Q[3][idx_cell_mom_x_R]/rho_x_R;
                                 const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_y_T)/(dx[0]);
-                                dv_dx = (v_x_R - v_y_T)/(dx[0]);
-                                // dw_dx = (w_x_R - w_y_T)/(dx[0]);
-                                dp_dx = (p_x_R - p_y_T)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_y_T;
+                                epsilon_states[idx_state_x_L] = epsilon_y_T;
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -5868,17 +7479,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_L = Q[3][idx_cell_mom_x_L]/rho_x_L;
                                 const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_y_T - u_x_L)/(dx[0]);
-                                dv_dx = (v_y_T - v_x_L)/(dx[0]);
-                                // dw_dx = (w_y_T - w_x_L)/(dx[0]);
-                                dp_dx = (p_y_T - p_x_L)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_y_T;
+                                epsilon_states[idx_state_x_R] = epsilon_y_T;
                             }
                             else
                             {
@@ -5927,34 +7537,22 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
                                 
-                                // Central derivatives.
-                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
-                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            // double du_dz = double(0);
-                            double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if ((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0))
@@ -5986,17 +7584,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_F = Q[3][idx_cell_mom_z_F]/rho_z_F;
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                                 
-                                // One-sided derivatives.
-                                // du_dz = (u_z_F - u_y_T)/(dx[2]);
-                                dv_dz = (v_z_F - v_y_T)/(dx[2]);
-                                dw_dz = (w_z_F - w_y_T)/(dx[2]);
-                                dp_dz = (p_z_F - p_y_T)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_y_T;
+                                epsilon_states[idx_state_z_B] = epsilon_y_T;
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -6029,17 +7626,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_B = Q[3][idx_cell_mom_z_B]/rho_z_B;
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                // One-sided derivatives.
-                                // du_dz = (u_y_T - u_z_B)/(dx[2]);
-                                dv_dz = (v_y_T - v_z_B)/(dx[2]);
-                                dw_dz = (w_y_T - w_z_B)/(dx[2]);
-                                dp_dz = (p_y_T - p_z_B)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_y_T;
+                                epsilon_states[idx_state_z_F] = epsilon_y_T;
                             }
                             else
                             {
@@ -6088,43 +7684,244 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
                                 
-                                // Central derivatives.
-                                // du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
-                                dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
-                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
-                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                             }
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
                             
-                            const double c_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getSoundSpeed(
-                                    &rho_y_T,
-                                    &p_y_T,
-                                    thermo_properties_ptr);
+                            const int idx_state_y_T   = idx_line;
+                            const int idx_state_y_TT  = idx_line + num_lines;
+                            const int idx_state_y_TTT = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
-                            const double lambda_5 = v_y_T + c_y_T;
+                            const double& rho_y_T   = rho_states[idx_state_y_T];
+                            const double& rho_y_TT  = rho_states[idx_state_y_TT];
+                            const double& rho_y_TTT = rho_states[idx_state_y_TTT];
                             
-                            // Compute vector Lambda^(-1) * L.
+                            const double& u_y_T   = u_states[idx_state_y_T];
+                            const double& u_y_TT  = u_states[idx_state_y_TT];
+                            const double& u_y_TTT = u_states[idx_state_y_TTT];
                             
-                            double Lambda_inv_L[5];
+                            const double& v_y_T   = v_states[idx_state_y_T];
+                            const double& v_y_TT  = v_states[idx_state_y_TT];
+                            const double& v_y_TTT = v_states[idx_state_y_TTT];
                             
-                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
-                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
-                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
-                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            const double& w_y_T   = w_states[idx_state_y_T];
+                            const double& w_y_TT  = w_states[idx_state_y_TT];
+                            const double& w_y_TTT = w_states[idx_state_y_TTT];
                             
-                            const double T_5 = u_y_T*(dp_dx + rho_y_T*c_y_T*dv_dx) + rho_y_T*c_y_T*c_y_T*du_dx +
+                            const double& p_y_T   = p_states[idx_state_y_T];
+                            const double& p_y_TT  = p_states[idx_state_y_TT];
+                            const double& p_y_TTT = p_states[idx_state_y_TTT];
+                            
+                            /*
+                             * Compute derivatives at y-direction.
+                             */
+                            
+                            const double drho_dy = -(rho_y_TTT - double(4)*rho_y_TT + double(3)*rho_y_T)/(double(2)*dx[1]);
+                            const double du_dy   = -(u_y_TTT - double(4)*u_y_TT + double(3)*u_y_T)/(double(2)*dx[1]);
+                            const double dv_dy   = -(v_y_TTT - double(4)*v_y_TT + double(3)*v_y_T)/(double(2)*dx[1]);
+                            const double dw_dy   = -(w_y_TTT - double(4)*w_y_TT + double(3)*w_y_T)/(double(2)*dx[1]);
+                            const double dp_dy   = -(p_y_TTT - double(4)*p_y_TT + double(3)*p_y_T)/(double(2)*dx[1]);
+                            
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
+                            
+                            double du_dx = double(0);
+                            double dv_dx = double(0);
+                            // double dw_dx = double(0);
+                            double dp_dx = double(0);
+                            
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_y_T)/(dx[0]);
+                                dv_dx = (v_x_R - v_y_T)/(dx[0]);
+                                // dw_dx = (w_x_R - w_y_T)/(dx[0]);
+                                dp_dx = (p_x_R - p_y_T)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_y_T - u_x_L)/(dx[0]);
+                                dv_dx = (v_y_T - v_x_L)/(dx[0]);
+                                // dw_dx = (w_y_T - w_x_L)/(dx[0]);
+                                dp_dx = (p_y_T - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // Central derivatives.
+                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
+                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            // double du_dz = double(0);
+                            double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                // du_dz = (u_z_F - u_y_T)/(dx[2]);
+                                dv_dz = (v_z_F - v_y_T)/(dx[2]);
+                                dw_dz = (w_z_F - w_y_T)/(dx[2]);
+                                dp_dz = (p_z_F - p_y_T)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                
+                                // One-sided derivatives.
+                                // du_dz = (u_y_T - u_z_B)/(dx[2]);
+                                dv_dz = (v_y_T - v_z_B)/(dx[2]);
+                                dw_dz = (w_y_T - w_z_B)/(dx[2]);
+                                dp_dz = (p_y_T - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // Central derivatives.
+                                // du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
+                                dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
+                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
+                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                            }
+                            
+                            const double& c_y_T = c_bdry[idx_line];
+                            
+                            const double lambda_5 = v_y_T + c_y_T;
+                            
+                            // Compute vector Lambda^(-1) * L.
+                            
+                            double Lambda_inv_L[5];
+                            
+                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
+                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
+                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
+                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            
+                            const double T_5 = u_y_T*(dp_dx + rho_y_T*c_y_T*dv_dx) + rho_y_T*c_y_T*c_y_T*du_dx +
                                 w_y_T*(dp_dz + rho_y_T*c_y_T*dv_dz) + rho_y_T*c_y_T*c_y_T*dw_dz;
                             
                             const double M_sq = (u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T)/(c_y_T*c_y_T);
@@ -6297,20 +8094,38 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 Q[2][idx_cell_mom] = V_ghost[j*5 + 0]*V_ghost[j*5 + 2];
                                 Q[3][idx_cell_mom] = V_ghost[j*5 + 0]*V_ghost[j*5 + 3];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergy(
-                                        &V_ghost[j*5 + 0],
-                                        &V_ghost[j*5 + 4],
-                                        thermo_properties_ptr);
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                                 
-                                const double E = V_ghost[j*5 + 0]*epsilon +
-                                    half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                       Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/V_ghost[j*5 + 0];
+                                rho_ghosts[idx_ghost] = V_ghost[j*5 + 0];
+                                p_ghosts[idx_ghost]   = V_ghost[j*5 + 4];
                                 
-                                Q[4][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                               Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho_ghosts[idx_ghost];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::YHI)
                 {
@@ -6323,12 +8138,51 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[2] - fill_box_lo_idx[2] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(6*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_y_B   = idx_line;
+                            const int idx_state_y_BB  = idx_line + num_lines;
+                            const int idx_state_y_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_y_B = (i + num_subghosts_conservative_var[0][0]) +
                                 (interior_box_hi_idx[1] + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -6391,47 +8245,29 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             const double w_y_BB  = Q[3][idx_cell_mom_y_BB]/rho_y_BB;
                             const double w_y_BBB = Q[3][idx_cell_mom_y_BBB]/rho_y_BBB;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_y_B   = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                             const double epsilon_y_BB  = Q[4][idx_cell_E_y_BB]/rho_y_BB - half*(u_y_BB*u_y_BB + v_y_BB*v_y_BB + w_y_BB*w_y_BB);
                             const double epsilon_y_BBB = Q[4][idx_cell_E_y_BBB]/rho_y_BBB - half*(u_y_BBB*u_y_BBB + v_y_BBB*v_y_BBB + w_y_BBB*w_y_BBB);
                             
-                            const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_B,
-                                    &epsilon_y_B,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_y_B]   = rho_y_B;
+                            rho_states[idx_state_y_BB]  = rho_y_BB;
+                            rho_states[idx_state_y_BBB] = rho_y_BBB;
                             
-                            const double p_y_BB = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_BB,
-                                    &epsilon_y_BB,
-                                    thermo_properties_ptr);
+                            u_states[idx_state_y_B]   = u_y_B;
+                            u_states[idx_state_y_BB]  = u_y_BB;
+                            u_states[idx_state_y_BBB] = u_y_BBB;
                             
-                            const double p_y_BBB = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_y_BBB,
-                                    &epsilon_y_BBB,
-                                    thermo_properties_ptr);
+                            v_states[idx_state_y_B]   = v_y_B;
+                            v_states[idx_state_y_BB]  = v_y_BB;
+                            v_states[idx_state_y_BBB] = v_y_BBB;
                             
-                            /*
-                             * Compute derivatives at y-direction.
-                             */
-                            
-                            const double drho_dy = (rho_y_BBB - double(4)*rho_y_BB + double(3)*rho_y_B)/(double(2)*dx[1]);
-                            const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
-                            const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
-                            const double dw_dy   = (w_y_BBB - double(4)*w_y_BB + double(3)*w_y_B)/(double(2)*dx[1]);
-                            const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
-                            
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
+                            w_states[idx_state_y_B]   = w_y_B;
+                            w_states[idx_state_y_BB]  = w_y_BB;
+                            w_states[idx_state_y_BBB] = w_y_BBB;
                             
-                            double du_dx = double(0);
-                            double dv_dx = double(0);
-                            // double dw_dx = double(0);
-                            double dp_dx = double(0);
+                            epsilon_states[idx_state_y_B]   = epsilon_y_B;
+                            epsilon_states[idx_state_y_BB]  = epsilon_y_BB;
+                            epsilon_states[idx_state_y_BBB] = epsilon_y_BBB;
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -6464,17 +8300,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_R = Q[3][idx_cell_mom_x_R]/rho_x_R;
                                 const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_y_B)/(dx[0]);
-                                dv_dx = (v_x_R - v_y_B)/(dx[0]);
-                                // dw_dx = (w_x_R - w_y_B)/(dx[0]);
-                                dp_dx = (p_x_R - p_y_B)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_y_B;
+                                epsilon_states[idx_state_x_L] = epsilon_y_B;
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -6507,17 +8342,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_L = Q[3][idx_cell_mom_x_L]/rho_x_L;
                                 const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_y_B - u_x_L)/(dx[0]);
-                                dv_dx = (v_y_B - v_x_L)/(dx[0]);
-                                // dw_dx = (w_y_B - w_x_L)/(dx[0]);
-                                dp_dx = (p_y_B - p_x_L)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_y_B;
+                                epsilon_states[idx_state_x_R] = epsilon_y_B;
                             }
                             else
                             {
@@ -6566,34 +8400,22 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
                                 
-                                // Central derivatives.
-                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
-                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                             }
                             
-                            /*
-                             * Compute derivatives in z-direction.
-                             */
-                            
-                            // double du_dz = double(0);
-                            double dv_dz = double(0);
-                            double dw_dz = double(0);
-                            double dp_dz = double(0);
-                            
                             if ((k + num_subghosts_conservative_var[0][2] == 0) ||
                                 (k + num_subghosts_conservative_var[1][2] == 0) ||
                                 (k + num_subghosts_conservative_var[2][2] == 0))
@@ -6625,17 +8447,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_F = Q[3][idx_cell_mom_z_F]/rho_z_F;
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_F]     = rho_z_F;
+                                u_states[idx_state_z_F]       = u_z_F;
+                                v_states[idx_state_z_F]       = v_z_F;
+                                w_states[idx_state_z_F]       = w_z_F;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                                 
-                                // One-sided derivatives.
-                                // du_dz = (u_z_F - u_y_B)/(dx[2]);
-                                dv_dz = (v_z_F - v_y_B)/(dx[2]);
-                                dw_dz = (w_z_F - w_y_B)/(dx[2]);
-                                dp_dz = (p_z_F - p_y_B)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_B]     = rho_y_B;
+                                epsilon_states[idx_state_z_B] = epsilon_y_B;
                             }
                             else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
                                      (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
@@ -6668,17 +8489,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_z_B = Q[3][idx_cell_mom_z_B]/rho_z_B;
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B]     = rho_z_B;
+                                u_states[idx_state_z_B]       = u_z_B;
+                                v_states[idx_state_z_B]       = v_z_B;
+                                w_states[idx_state_z_B]       = w_z_B;
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
                                 
-                                // One-sided derivatives.
-                                // du_dz = (u_y_B - u_z_B)/(dx[2]);
-                                dv_dz = (v_y_B - v_z_B)/(dx[2]);
-                                dw_dz = (w_y_B - w_z_B)/(dx[2]);
-                                dp_dz = (p_y_B - p_z_B)/(dx[2]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_z_F]     = rho_y_B;
+                                epsilon_states[idx_state_z_F] = epsilon_y_B;
                             }
                             else
                             {
@@ -6727,66 +8547,267 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_z_B = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                                 const double epsilon_z_F = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                                 
-                                const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_B,
-                                        &epsilon_z_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_z_B] = rho_z_B;
+                                rho_states[idx_state_z_F] = rho_z_F;
                                 
-                                const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_z_F,
-                                        &epsilon_z_F,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_z_B] = u_z_B;
+                                u_states[idx_state_z_F] = u_z_F;
                                 
-                                // Central derivatives.
-                                // du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
-                                dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
-                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
-                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                                v_states[idx_state_z_B] = v_z_B;
+                                v_states[idx_state_z_F] = v_z_F;
+                                
+                                w_states[idx_state_z_B] = w_z_B;
+                                w_states[idx_state_z_F] = w_z_F;
+                                
+                                epsilon_states[idx_state_z_B] = epsilon_z_B;
+                                epsilon_states[idx_state_z_F] = epsilon_z_F;
                             }
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int k = fill_box_lo_idx[2]; k <= fill_box_hi_idx[2]; k++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (k - fill_box_lo_idx[2])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
                             
-                            const double c_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getSoundSpeed(
-                                    &rho_y_B,
-                                    &p_y_B,
-                                    thermo_properties_ptr);
-                            
-                            const double lambda_1 = v_y_B - c_y_B;
-                            
-                            // Compute vector Lambda^(-1) * L.
+                            const int idx_state_y_B   = idx_line;
+                            const int idx_state_y_BB  = idx_line + num_lines;
+                            const int idx_state_y_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_z_B   = idx_line + 5*num_lines;
+                            const int idx_state_z_F   = idx_line + 6*num_lines;
                             
-                            double Lambda_inv_L[5];
+                            const double& rho_y_B   = rho_states[idx_state_y_B];
+                            const double& rho_y_BB  = rho_states[idx_state_y_BB];
+                            const double& rho_y_BBB = rho_states[idx_state_y_BBB];
                             
-                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
-                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
-                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
-                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            const double& u_y_B   = u_states[idx_state_y_B];
+                            const double& u_y_BB  = u_states[idx_state_y_BB];
+                            const double& u_y_BBB = u_states[idx_state_y_BBB];
                             
-                            const double T_1 = u_y_B*(dp_dx - rho_y_B*c_y_B*dv_dx) + rho_y_B*c_y_B*c_y_B*du_dx +
-                                w_y_B*(dp_dz - rho_y_B*c_y_B*dv_dz) + rho_y_B*c_y_B*c_y_B*dw_dz;
+                            const double& v_y_B   = v_states[idx_state_y_B];
+                            const double& v_y_BB  = v_states[idx_state_y_BB];
+                            const double& v_y_BBB = v_states[idx_state_y_BBB];
                             
-                            const double M_sq = (u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B)/(c_y_B*c_y_B);
-                            const double K = sigma*c_y_B*(double(1) - M_sq)/length_char;
+                            const double& w_y_B   = w_states[idx_state_y_B];
+                            const double& w_y_BB  = w_states[idx_state_y_BB];
+                            const double& w_y_BBB = w_states[idx_state_y_BBB];
                             
-                            Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_y_B - p_t) - (double(1) - beta)*T_1);
-                            Lambda_inv_L[1] = du_dy;
-                            Lambda_inv_L[2] = c_y_B*c_y_B*drho_dy - dp_dy;
-                            Lambda_inv_L[3] = dw_dy;
-                            Lambda_inv_L[4] = dp_dy + rho_y_B*c_y_B*dv_dy;
+                            const double& p_y_B   = p_states[idx_state_y_B];
+                            const double& p_y_BB  = p_states[idx_state_y_BB];
+                            const double& p_y_BBB = p_states[idx_state_y_BBB];
                             
-                            // Compute dV_dy.
+                            /*
+                             * Compute derivatives at y-direction.
+                             */
                             
-                            const double c_sq_inv  = double(1)/(c_y_B*c_y_B);
-                            const double rho_c_inv = double(1)/(rho_y_B*c_y_B);
+                            const double drho_dy = (rho_y_BBB - double(4)*rho_y_BB + double(3)*rho_y_B)/(double(2)*dx[1]);
+                            const double du_dy   = (u_y_BBB - double(4)*u_y_BB + double(3)*u_y_B)/(double(2)*dx[1]);
+                            const double dv_dy   = (v_y_BBB - double(4)*v_y_BB + double(3)*v_y_B)/(double(2)*dx[1]);
+                            const double dw_dy   = (w_y_BBB - double(4)*w_y_BB + double(3)*w_y_B)/(double(2)*dx[1]);
+                            const double dp_dy   = (p_y_BBB - double(4)*p_y_BB + double(3)*p_y_B)/(double(2)*dx[1]);
                             
-                            double dV_dy[5];
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
                             
-                            dV_dy[0] = half*c_sq_inv*(Lambda_inv_L[0] + Lambda_inv_L[4]) + c_sq_inv*Lambda_inv_L[2];
-                            dV_dy[1] = Lambda_inv_L[1];
-                            dV_dy[2] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[4]);
-                            dV_dy[3] = Lambda_inv_L[3];
-                            dV_dy[4] = half*(Lambda_inv_L[0] + Lambda_inv_L[4]);
+                            double du_dx = double(0);
+                            double dv_dx = double(0);
+                            // double dw_dx = double(0);
+                            double dp_dx = double(0);
+                            
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_y_B)/(dx[0]);
+                                dv_dx = (v_x_R - v_y_B)/(dx[0]);
+                                // dw_dx = (w_x_R - w_y_B)/(dx[0]);
+                                dp_dx = (p_x_R - p_y_B)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_y_B - u_x_L)/(dx[0]);
+                                dv_dx = (v_y_B - v_x_L)/(dx[0]);
+                                // dw_dx = (w_y_B - w_x_L)/(dx[0]);
+                                dp_dx = (p_y_B - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // Central derivatives.
+                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                                dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                                // dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
+                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in z-direction.
+                             */
+                            
+                            // double du_dz = double(0);
+                            double dv_dz = double(0);
+                            double dw_dz = double(0);
+                            double dp_dz = double(0);
+                            
+                            if ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                                (k + num_subghosts_conservative_var[1][2] == 0) ||
+                                (k + num_subghosts_conservative_var[2][2] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(2, 0)) && (k == interior_box_lo_idx[2])) ||
+                            //     ((k + num_subghosts_conservative_var[0][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[1][2] == 0) ||
+                            //      (k + num_subghosts_conservative_var[2][2] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // One-sided derivatives.
+                                // du_dz = (u_z_F - u_y_B)/(dx[2]);
+                                dv_dz = (v_z_F - v_y_B)/(dx[2]);
+                                dw_dz = (w_z_F - w_y_B)/(dx[2]);
+                                dp_dz = (p_z_F - p_y_B)/(dx[2]);
+                            }
+                            else if ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                                     (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                                     (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(2, 1)) && (k == interior_box_hi_idx[2])) ||
+                            //          ((k + num_subghosts_conservative_var[0][2] + 1 == subghostcell_dims_conservative_var[0][2]) ||
+                            //           (k + num_subghosts_conservative_var[1][2] + 1 == subghostcell_dims_conservative_var[1][2]) ||
+                            //           (k + num_subghosts_conservative_var[2][2] + 1 == subghostcell_dims_conservative_var[2][2])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                
+                                // One-sided derivatives.
+                                // du_dz = (u_y_B - u_z_B)/(dx[2]);
+                                dv_dz = (v_y_B - v_z_B)/(dx[2]);
+                                dw_dz = (w_y_B - w_z_B)/(dx[2]);
+                                dp_dz = (p_y_B - p_z_B)/(dx[2]);
+                            }
+                            else
+                            {
+                                const double& u_z_B = u_states[idx_state_z_B];
+                                const double& u_z_F = u_states[idx_state_z_F];
+                                const double& v_z_B = v_states[idx_state_z_B];
+                                const double& v_z_F = v_states[idx_state_z_F];
+                                const double& w_z_B = w_states[idx_state_z_B];
+                                const double& w_z_F = w_states[idx_state_z_F];
+                                const double& p_z_B = p_states[idx_state_z_B];
+                                const double& p_z_F = p_states[idx_state_z_F];
+                                
+                                // Central derivatives.
+                                // du_dz = (u_z_F - u_z_B)/(double(2)*dx[2]);
+                                dv_dz = (v_z_F - v_z_B)/(double(2)*dx[2]);
+                                dw_dz = (w_z_F - w_z_B)/(double(2)*dx[2]);
+                                dp_dz = (p_z_F - p_z_B)/(double(2)*dx[2]);
+                            }
+                            
+                            const double& c_y_B = c_bdry[idx_line];
+                            
+                            const double lambda_1 = v_y_B - c_y_B;
+                            
+                            // Compute vector Lambda^(-1) * L.
+                            
+                            double Lambda_inv_L[5];
+                            
+                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
+                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
+                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
+                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            
+                            const double T_1 = u_y_B*(dp_dx - rho_y_B*c_y_B*dv_dx) + rho_y_B*c_y_B*c_y_B*du_dx +
+                                w_y_B*(dp_dz - rho_y_B*c_y_B*dv_dz) + rho_y_B*c_y_B*c_y_B*dw_dz;
+                            
+                            const double M_sq = (u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B)/(c_y_B*c_y_B);
+                            const double K = sigma*c_y_B*(double(1) - M_sq)/length_char;
+                            
+                            Lambda_inv_L[0] = (double(1)/lambda_1)*(K*(p_y_B - p_t) - (double(1) - beta)*T_1);
+                            Lambda_inv_L[1] = du_dy;
+                            Lambda_inv_L[2] = c_y_B*c_y_B*drho_dy - dp_dy;
+                            Lambda_inv_L[3] = dw_dy;
+                            Lambda_inv_L[4] = dp_dy + rho_y_B*c_y_B*dv_dy;
+                            
+                            // Compute dV_dy.
+                            
+                            const double c_sq_inv  = double(1)/(c_y_B*c_y_B);
+                            const double rho_c_inv = double(1)/(rho_y_B*c_y_B);
+                            
+                            double dV_dy[5];
+                            
+                            dV_dy[0] = half*c_sq_inv*(Lambda_inv_L[0] + Lambda_inv_L[4]) + c_sq_inv*Lambda_inv_L[2];
+                            dV_dy[1] = Lambda_inv_L[1];
+                            dV_dy[2] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[4]);
+                            dV_dy[3] = Lambda_inv_L[3];
+                            dV_dy[4] = half*(Lambda_inv_L[0] + Lambda_inv_L[4]);
                             
                             double V_ghost[5*num_ghosts_to_fill];
                             
@@ -6936,20 +8957,38 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 Q[2][idx_cell_mom] = V_ghost[j*5 + 0]*V_ghost[j*5 + 2];
                                 Q[3][idx_cell_mom] = V_ghost[j*5 + 0]*V_ghost[j*5 + 3];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergy(
-                                        &V_ghost[j*5 + 0],
-                                        &V_ghost[j*5 + 4],
-                                        thermo_properties_ptr);
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + j;
                                 
-                                const double E = V_ghost[j*5 + 0]*epsilon +
-                                    half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                       Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/V_ghost[j*5 + 0];
+                                rho_ghosts[idx_ghost] = V_ghost[j*5 + 0];
+                                p_ghosts[idx_ghost]   = V_ghost[j*5 + 4];
                                 
-                                Q[4][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                               Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho_ghosts[idx_ghost];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::ZLO)
                 {
@@ -6962,12 +9001,51 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(6*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_z_F   = idx_line;
+                            const int idx_state_z_FF  = idx_line + num_lines;
+                            const int idx_state_z_FFF = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_z_F = (i + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -7030,47 +9108,29 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             const double w_z_FF  = Q[3][idx_cell_mom_z_FF]/rho_z_FF;
                             const double w_z_FFF = Q[3][idx_cell_mom_z_FFF]/rho_z_FFF;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_z_F   = Q[4][idx_cell_E_z_F]/rho_z_F - half*(u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F);
                             const double epsilon_z_FF  = Q[4][idx_cell_E_z_FF]/rho_z_FF - half*(u_z_FF*u_z_FF + v_z_FF*v_z_FF + w_z_FF*w_z_FF);
                             const double epsilon_z_FFF = Q[4][idx_cell_E_z_FFF]/rho_z_FFF - half*(u_z_FFF*u_z_FFF + v_z_FFF*v_z_FFF + w_z_FFF*w_z_FFF);
                             
-                            const double p_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_z_F,
-                                    &epsilon_z_F,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_z_F]   = rho_z_F;
+                            rho_states[idx_state_z_FF]  = rho_z_FF;
+                            rho_states[idx_state_z_FFF] = rho_z_FFF;
                             
-                            const double p_z_FF = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_z_FF,
-                                    &epsilon_z_FF,
-                                    thermo_properties_ptr);
-                            
-                            const double p_z_FFF = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_z_FFF,
-                                    &epsilon_z_FFF,
-                                    thermo_properties_ptr);
-                            
-                            /*
-                             * Compute derivatives at z-direction.
-                             */
+                            u_states[idx_state_z_F]   = u_z_F;
+                            u_states[idx_state_z_FF]  = u_z_FF;
+                            u_states[idx_state_z_FFF] = u_z_FFF;
                             
-                            const double drho_dz = -(rho_z_FFF - double(4)*rho_z_FF + double(3)*rho_z_F)/(double(2)*dx[2]);
-                            const double du_dz   = -(u_z_FFF - double(4)*u_z_FF + double(3)*u_z_F)/(double(2)*dx[2]);
-                            const double dv_dz   = -(v_z_FFF - double(4)*v_z_FF + double(3)*v_z_F)/(double(2)*dx[2]);
-                            const double dw_dz   = -(w_z_FFF - double(4)*w_z_FF + double(3)*w_z_F)/(double(2)*dx[2]);
-                            const double dp_dz   = -(p_z_FFF - double(4)*p_z_FF + double(3)*p_z_F)/(double(2)*dx[2]);
+                            v_states[idx_state_z_F]   = v_z_F;
+                            v_states[idx_state_z_FF]  = v_z_FF;
+                            v_states[idx_state_z_FFF] = v_z_FFF;
                             
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
+                            w_states[idx_state_z_F]   = w_z_F;
+                            w_states[idx_state_z_FF]  = w_z_FF;
+                            w_states[idx_state_z_FFF] = w_z_FFF;
                             
-                            double du_dx = double(0);
-                            // double dv_dx = double(0);
-                            double dw_dx = double(0);
-                            double dp_dx = double(0);
+                            epsilon_states[idx_state_z_F]   = epsilon_z_F;
+                            epsilon_states[idx_state_z_FF]  = epsilon_z_FF;
+                            epsilon_states[idx_state_z_FFF] = epsilon_z_FFF;
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -7103,17 +9163,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_R = Q[3][idx_cell_mom_x_R]/rho_x_R;
                                 const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_z_F)/(dx[0]);
-                                // dv_dx = (v_x_R - v_z_F)/(dx[0]);
-                                dw_dx = (w_x_R - w_z_F)/(dx[0]);
-                                dp_dx = (p_x_R - p_z_F)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_z_F;
+                                epsilon_states[idx_state_x_L] = epsilon_z_F;
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -7146,17 +9205,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_L = Q[3][idx_cell_mom_x_L]/rho_x_L;
                                 const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_z_F - u_x_L)/(dx[0]);
-                                // dv_dx = (v_z_F - v_x_L)/(dx[0]);
-                                dw_dx = (w_z_F - w_x_L)/(dx[0]);
-                                dp_dx = (p_z_F - p_x_L)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_z_F;
+                                epsilon_states[idx_state_x_R] = epsilon_z_F;
                             }
                             else
                             {
@@ -7205,34 +9263,22 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
                                 
-                                // Central derivatives.
-                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
-                                // dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
-                                dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
-                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                             }
                             
-                            /*
-                             * Compute derivatives in y-direction.
-                             */
-                            
-                            // double du_dy = double(0);
-                            double dv_dy = double(0);
-                            double dw_dy = double(0);
-                            double dp_dy = double(0);
-                            
                             if ((j + num_subghosts_conservative_var[0][1] == 0) ||
                                 (j + num_subghosts_conservative_var[1][1] == 0) ||
                                 (j + num_subghosts_conservative_var[2][1] == 0))
@@ -7264,17 +9310,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_y_T = Q[3][idx_cell_mom_y_T]/rho_y_T;
                                 const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                                 
-                                // One-sided derivatives.
-                                //du_dy = (u_y_T - u_z_F)/(dx[1]);
-                                dv_dy = (v_y_T - v_z_F)/(dx[1]);
-                                dw_dy = (w_y_T - w_z_F)/(dx[1]);
-                                dp_dy = (p_y_T - p_z_F)/(dx[1]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_z_F;
+                                epsilon_states[idx_state_y_B] = epsilon_z_F;
                             }
                             else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
                                      (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
@@ -7307,17 +9352,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_y_B = Q[3][idx_cell_mom_y_B]/rho_y_B;
                                 const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
                                 
-                                // One-sided derivatives.
-                                //du_dy = (u_z_F - u_y_B)/(dx[1]);
-                                dv_dy = (v_z_F - v_y_B)/(dx[1]);
-                                dw_dy = (w_z_F - w_y_B)/(dx[1]);
-                                dp_dy = (p_z_F - p_y_B)/(dx[1]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_z_F;
+                                epsilon_states[idx_state_y_T] = epsilon_z_F;
                             }
                             else
                             {
@@ -7366,63 +9410,264 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
                                 const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
                                 
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
                                 
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
                                 
-                                // Central derivatives.
-                                // du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
-                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
-                                dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
-                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
                             }
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
                             
-                            const double c_z_F = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getSoundSpeed(
-                                    &rho_z_F,
-                                    &p_z_F,
-                                    thermo_properties_ptr);
-                            
-                            const double lambda_5 = w_z_F + c_z_F;
+                            const int idx_state_z_F   = idx_line;
+                            const int idx_state_z_FF  = idx_line + num_lines;
+                            const int idx_state_z_FFF = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
                             
-                            // Compute vector Lambda^(-1) * L.
+                            const double& rho_z_F   = rho_states[idx_state_z_F];
+                            const double& rho_z_FF  = rho_states[idx_state_z_FF];
+                            const double& rho_z_FFF = rho_states[idx_state_z_FFF];
                             
-                            double Lambda_inv_L[5];
+                            const double& u_z_F   = u_states[idx_state_z_F];
+                            const double& u_z_FF  = u_states[idx_state_z_FF];
+                            const double& u_z_FFF = u_states[idx_state_z_FFF];
                             
-                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
-                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
-                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
-                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            const double& v_z_F   = v_states[idx_state_z_F];
+                            const double& v_z_FF  = v_states[idx_state_z_FF];
+                            const double& v_z_FFF = v_states[idx_state_z_FFF];
                             
-                            const double T_5 = u_z_F*(dp_dx + rho_z_F*c_z_F*dw_dx) + rho_z_F*c_z_F*c_z_F*du_dx +
-                                v_z_F*(dp_dy + rho_z_F*c_z_F*dw_dy) + rho_z_F*c_z_F*c_z_F*dv_dy;
+                            const double& w_z_F   = w_states[idx_state_z_F];
+                            const double& w_z_FF  = w_states[idx_state_z_FF];
+                            const double& w_z_FFF = w_states[idx_state_z_FFF];
                             
-                            const double M_sq = (u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F)/(c_z_F*c_z_F);
-                            const double K = sigma*c_z_F*(double(1) - M_sq)/length_char;
+                            const double& p_z_F   = p_states[idx_state_z_F];
+                            const double& p_z_FF  = p_states[idx_state_z_FF];
+                            const double& p_z_FFF = p_states[idx_state_z_FFF];
                             
-                            Lambda_inv_L[0] = dp_dz - rho_z_F*c_z_F*dw_dz;
-                            Lambda_inv_L[1] = du_dz;
-                            Lambda_inv_L[2] = dv_dz;
-                            Lambda_inv_L[3] = c_z_F*c_z_F*drho_dz - dp_dz;
-                            Lambda_inv_L[4] = (double(1)/lambda_5)*(K*(p_z_F - p_t) - (double(1) - beta)*T_5);
+                            /*
+                             * Compute derivatives at z-direction.
+                             */
                             
-                            // Compute dV_dz.
+                            const double drho_dz = -(rho_z_FFF - double(4)*rho_z_FF + double(3)*rho_z_F)/(double(2)*dx[2]);
+                            const double du_dz   = -(u_z_FFF - double(4)*u_z_FF + double(3)*u_z_F)/(double(2)*dx[2]);
+                            const double dv_dz   = -(v_z_FFF - double(4)*v_z_FF + double(3)*v_z_F)/(double(2)*dx[2]);
+                            const double dw_dz   = -(w_z_FFF - double(4)*w_z_FF + double(3)*w_z_F)/(double(2)*dx[2]);
+                            const double dp_dz   = -(p_z_FFF - double(4)*p_z_FF + double(3)*p_z_F)/(double(2)*dx[2]);
                             
-                            const double c_sq_inv  = double(1)/(c_z_F*c_z_F);
-                            const double rho_c_inv = double(1)/(rho_z_F*c_z_F);
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
                             
-                            double dV_dz[5];
+                            double du_dx = double(0);
+                            // double dv_dx = double(0);
+                            double dw_dx = double(0);
+                            double dp_dx = double(0);
                             
-                            dV_dz[0] = half*c_sq_inv*(Lambda_inv_L[0] + Lambda_inv_L[4]) + c_sq_inv*Lambda_inv_L[3];
-                            dV_dz[1] = Lambda_inv_L[1];
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_z_F)/(dx[0]);
+                                // dv_dx = (v_x_R - v_z_F)/(dx[0]);
+                                dw_dx = (w_x_R - w_z_F)/(dx[0]);
+                                dp_dx = (p_x_R - p_z_F)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                
+                                // One-sided derivatives.
+                                du_dx = (u_z_F - u_x_L)/(dx[0]);
+                                // dv_dx = (v_z_F - v_x_L)/(dx[0]);
+                                dw_dx = (w_z_F - w_x_L)/(dx[0]);
+                                dp_dx = (p_z_F - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
+                                
+                                // Central derivatives.
+                                du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
+                                // dv_dx = (v_x_R - v_x_L)/(double(2)*dx[0]);
+                                dw_dx = (w_x_R - w_x_L)/(double(2)*dx[0]);
+                                dp_dx = (p_x_R - p_x_L)/(double(2)*dx[0]);
+                            }
+                            
+                            /*
+                             * Compute derivatives in y-direction.
+                             */
+                            
+                            // double du_dy = double(0);
+                            double dv_dy = double(0);
+                            double dw_dy = double(0);
+                            double dp_dy = double(0);
+                            
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // One-sided derivatives.
+                                //du_dy = (u_y_T - u_z_F)/(dx[1]);
+                                dv_dy = (v_y_T - v_z_F)/(dx[1]);
+                                dw_dy = (w_y_T - w_z_F)/(dx[1]);
+                                dp_dy = (p_y_T - p_z_F)/(dx[1]);
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                
+                                // One-sided derivatives.
+                                //du_dy = (u_z_F - u_y_B)/(dx[1]);
+                                dv_dy = (v_z_F - v_y_B)/(dx[1]);
+                                dw_dy = (w_z_F - w_y_B)/(dx[1]);
+                                dp_dy = (p_z_F - p_y_B)/(dx[1]);
+                            }
+                            else
+                            {
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
+                                
+                                // Central derivatives.
+                                // du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
+                                dv_dy = (v_y_T - v_y_B)/(double(2)*dx[1]);
+                                dw_dy = (w_y_T - w_y_B)/(double(2)*dx[1]);
+                                dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
+                            }
+                            
+                            const double& c_z_F = c_bdry[idx_line];
+                            
+                            const double lambda_5 = w_z_F + c_z_F;
+                            
+                            // Compute vector Lambda^(-1) * L.
+                            
+                            double Lambda_inv_L[5];
+                            
+                            const double& p_t         = d_bdry_face_nonreflecting_outflow_p_t[face_loc];
+                            const double& sigma       = d_bdry_face_nonreflecting_outflow_sigma[face_loc];
+                            const double& beta        = d_bdry_face_nonreflecting_outflow_beta[face_loc];
+                            const double& length_char = d_bdry_face_nonreflecting_outflow_length_char[face_loc];
+                            
+                            const double T_5 = u_z_F*(dp_dx + rho_z_F*c_z_F*dw_dx) + rho_z_F*c_z_F*c_z_F*du_dx +
+                                v_z_F*(dp_dy + rho_z_F*c_z_F*dw_dy) + rho_z_F*c_z_F*c_z_F*dv_dy;
+                            
+                            const double M_sq = (u_z_F*u_z_F + v_z_F*v_z_F + w_z_F*w_z_F)/(c_z_F*c_z_F);
+                            const double K = sigma*c_z_F*(double(1) - M_sq)/length_char;
+                            
+                            Lambda_inv_L[0] = dp_dz - rho_z_F*c_z_F*dw_dz;
+                            Lambda_inv_L[1] = du_dz;
+                            Lambda_inv_L[2] = dv_dz;
+                            Lambda_inv_L[3] = c_z_F*c_z_F*drho_dz - dp_dz;
+                            Lambda_inv_L[4] = (double(1)/lambda_5)*(K*(p_z_F - p_t) - (double(1) - beta)*T_5);
+                            
+                            // Compute dV_dz.
+                            
+                            const double c_sq_inv  = double(1)/(c_z_F*c_z_F);
+                            const double rho_c_inv = double(1)/(rho_z_F*c_z_F);
+                            
+                            double dV_dz[5];
+                            
+                            dV_dz[0] = half*c_sq_inv*(Lambda_inv_L[0] + Lambda_inv_L[4]) + c_sq_inv*Lambda_inv_L[3];
+                            dV_dz[1] = Lambda_inv_L[1];
                             dV_dz[2] = Lambda_inv_L[2];
                             dV_dz[3] = half*rho_c_inv*(-Lambda_inv_L[0] + Lambda_inv_L[4]);
                             dV_dz[4] = half*(Lambda_inv_L[0] + Lambda_inv_L[4]);
@@ -7575,20 +9820,38 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 Q[2][idx_cell_mom] = V_ghost[k*5 + 0]*V_ghost[k*5 + 2];
                                 Q[3][idx_cell_mom] = V_ghost[k*5 + 0]*V_ghost[k*5 + 3];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergy(
-                                        &V_ghost[k*5 + 0],
-                                        &V_ghost[k*5 + 4],
-                                        thermo_properties_ptr);
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + k;
                                 
-                                const double E = V_ghost[k*5 + 0]*epsilon +
-                                    half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                       Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/V_ghost[k*5 + 0];
+                                rho_ghosts[idx_ghost] = V_ghost[k*5 + 0];
+                                p_ghosts[idx_ghost]   = V_ghost[k*5 + 4];
                                 
-                                Q[4][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                               Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho_ghosts[idx_ghost];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
                 }
                 else if (face_loc == BDRY_LOC::ZHI)
                 {
@@ -7601,12 +9864,51 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             << "Non-reflecting outflow BC doesn't support more than six ghost cells yet!");
                     }
                     
+                    // Get the grid spacing.
+                    const double* const dx = patch_geom->getDx();
+                    
+                    const double half = double(1)/double(2);
+                    
+                    /*
+                     * Gather the states of the one-sided stencils and of the neighbors of the boundary cells first so
+                     * that the equation of state is evaluated in batch over the whole boundary box.
+                     */
+                    
+                    const int num_lines = (fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1)*(fill_box_hi_idx[1] - fill_box_lo_idx[1] + 1);
+                    const int num_states = 7*num_lines;
+                    const int num_ghost_cells = num_ghosts_to_fill*num_lines;
+                    
+                    d_bdry_fill_workspace.resize(6*num_states + num_lines + 3*num_ghost_cells);
+                    d_bdry_fill_idx_workspace.resize(2*num_ghost_cells);
+                    
+                    double* const rho_states     = d_bdry_fill_workspace.data();
+                    double* const u_states       = rho_states + num_states;
+                    double* const v_states       = u_states + num_states;
+                    double* const w_states       = v_states + num_states;
+                    double* const epsilon_states = w_states + num_states;
+                    double* const p_states       = epsilon_states + num_states;
+                    double* const c_bdry         = p_states + num_states;
+                    double* const rho_ghosts     = c_bdry + num_lines;
+                    double* const p_ghosts       = rho_ghosts + num_ghost_cells;
+                    double* const epsilon_ghosts = p_ghosts + num_ghost_cells;
+                    
+                    int* const idx_cell_mom_ghosts = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_E_ghosts   = idx_cell_mom_ghosts + num_ghost_cells;
+                    
                     for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
                     {
                         for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                         {
-                            // Get the grid spacing.
-                            const double* const dx = patch_geom->getDx();
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_z_B   = idx_line;
+                            const int idx_state_z_BB  = idx_line + num_lines;
+                            const int idx_state_z_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
                             
                             const int idx_cell_rho_z_B = (i + num_subghosts_conservative_var[0][0]) +
                                 (j + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
@@ -7669,47 +9971,29 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             const double w_z_BB  = Q[3][idx_cell_mom_z_BB]/rho_z_BB;
                             const double w_z_BBB = Q[3][idx_cell_mom_z_BBB]/rho_z_BBB;
                             
-                            const double half = double(1)/double(2);
                             const double epsilon_z_B   = Q[4][idx_cell_E_z_B]/rho_z_B - half*(u_z_B*u_z_B + v_z_B*v_z_B + w_z_B*w_z_B);
                             const double epsilon_z_BB  = Q[4][idx_cell_E_z_BB]/rho_z_BB - half*(u_z_BB*u_z_BB + v_z_BB*v_z_BB + w_z_BB*w_z_BB);
                             const double epsilon_z_BBB = Q[4][idx_cell_E_z_BBB]/rho_z_BBB - half*(u_z_BBB*u_z_BBB + v_z_BBB*v_z_BBB + w_z_BBB*w_z_BBB);
                             
-                            const double p_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_z_B,
-                                    &epsilon_z_B,
-                                    thermo_properties_ptr);
+                            rho_states[idx_state_z_B]   = rho_z_B;
+                            rho_states[idx_state_z_BB]  = rho_z_BB;
+                            rho_states[idx_state_z_BBB] = rho_z_BBB;
                             
-                            const double p_z_BB = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_z_BB,
-                                    &epsilon_z_BB,
-                                    thermo_properties_ptr);
+                            u_states[idx_state_z_B]   = u_z_B;
+                            u_states[idx_state_z_BB]  = u_z_BB;
+                            u_states[idx_state_z_BBB] = u_z_BBB;
                             
-                            const double p_z_BBB = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getPressure(
-                                    &rho_z_BBB,
-                                    &epsilon_z_BBB,
-                                    thermo_properties_ptr);
+                            v_states[idx_state_z_B]   = v_z_B;
+                            v_states[idx_state_z_BB]  = v_z_BB;
+                            v_states[idx_state_z_BBB] = v_z_BBB;
                             
-                            /*
-                             * Compute derivatives at z-direction.
-                             */
+                            w_states[idx_state_z_B]   = w_z_B;
+                            w_states[idx_state_z_BB]  = w_z_BB;
+                            w_states[idx_state_z_BBB] = w_z_BBB;
                             
-                            const double drho_dz = (rho_z_BBB - double(4)*rho_z_BB + double(3)*rho_z_B)/(double(2)*dx[2]);
-                            const double du_dz   = (u_z_BBB - double(4)*u_z_BB + double(3)*u_z_B)/(double(2)*dx[2]);
-                            const double dv_dz   = (v_z_BBB - double(4)*v_z_BB + double(3)*v_z_B)/(double(2)*dx[2]);
-                            const double dw_dz   = (w_z_BBB - double(4)*w_z_BB + double(3)*w_z_B)/(double(2)*dx[2]);
-                            const double dp_dz   = (p_z_BBB - double(4)*p_z_BB + double(3)*p_z_B)/(double(2)*dx[2]);
-                            
-                            /*
-                             * Compute derivatives in x-direction.
-                             */
-                            
-                            double du_dx = double(0);
-                            // double dv_dx = double(0);
-                            double dw_dx = double(0);
-                            double dp_dx = double(0);
+                            epsilon_states[idx_state_z_B]   = epsilon_z_B;
+                            epsilon_states[idx_state_z_BB]  = epsilon_z_BB;
+                            epsilon_states[idx_state_z_BBB] = epsilon_z_BBB;
                             
                             if ((i + num_subghosts_conservative_var[0][0] == 0) ||
                                 (i + num_subghosts_conservative_var[1][0] == 0) ||
@@ -7742,17 +10026,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_R = Q[3][idx_cell_mom_x_R]/rho_x_R;
                                 const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_R]     = rho_x_R;
+                                u_states[idx_state_x_R]       = u_x_R;
+                                v_states[idx_state_x_R]       = v_x_R;
+                                w_states[idx_state_x_R]       = w_x_R;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_x_R - u_z_B)/(dx[0]);
-                                // dv_dx = (v_x_R - v_z_B)/(dx[0]);
-                                dw_dx = (w_x_R - w_z_B)/(dx[0]);
-                                dp_dx = (p_x_R - p_z_B)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_L]     = rho_z_B;
+                                epsilon_states[idx_state_x_L] = epsilon_z_B;
                             }
                             else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
                                      (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
@@ -7785,17 +10068,16 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double w_x_L = Q[3][idx_cell_mom_x_L]/rho_x_L;
                                 const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                rho_states[idx_state_x_L]     = rho_x_L;
+                                u_states[idx_state_x_L]       = u_x_L;
+                                v_states[idx_state_x_L]       = v_x_L;
+                                w_states[idx_state_x_L]       = w_x_L;
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
                                 
-                                // One-sided derivatives.
-                                du_dx = (u_z_B - u_x_L)/(dx[0]);
-                                // dv_dx = (v_z_B - v_x_L)/(dx[0]);
-                                dw_dx = (w_z_B - w_x_L)/(dx[0]);
-                                dp_dx = (p_z_B - p_x_L)/(dx[0]);
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_x_R]     = rho_z_B;
+                                epsilon_states[idx_state_x_R] = epsilon_z_B;
                             }
                             else
                             {
@@ -7838,23 +10120,306 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 const double v_x_L = Q[2][idx_cell_mom_x_L]/rho_x_L;
                                 const double v_x_R = Q[2][idx_cell_mom_x_R]/rho_x_R;
                                 
-                                const double w_x_L = Q[3][idx_cell_mom_x_L]/rho_x_L;
-                                const double w_x_R = Q[3][idx_cell_mom_x_R]/rho_x_R;
+                                const double w_x_L = Q[3][idx_cell_mom_x_L]/rho_x_L;
+                                const double w_x_R = Q[3][idx_cell_mom_x_R]/rho_x_R;
+                                
+                                const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
+                                const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
+                                
+                                rho_states[idx_state_x_L] = rho_x_L;
+                                rho_states[idx_state_x_R] = rho_x_R;
+                                
+                                u_states[idx_state_x_L] = u_x_L;
+                                u_states[idx_state_x_R] = u_x_R;
+                                
+                                v_states[idx_state_x_L] = v_x_L;
+                                v_states[idx_state_x_R] = v_x_R;
+                                
+                                w_states[idx_state_x_L] = w_x_L;
+                                w_states[idx_state_x_R] = w_x_R;
+                                
+                                epsilon_states[idx_state_x_L] = epsilon_x_L;
+                                epsilon_states[idx_state_x_R] = epsilon_x_R;
+                            }
+                            
+                            if ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                                (j + num_subghosts_conservative_var[1][1] == 0) ||
+                                (j + num_subghosts_conservative_var[2][1] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(1, 0)) && (j == interior_box_lo_idx[1])) ||
+                            //     ((j + num_subghosts_conservative_var[0][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[1][1] == 0) ||
+                            //      (j + num_subghosts_conservative_var[2][1] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const int idx_cell_rho_y_T = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_mom_y_T = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_E_y_T = (i + num_subghosts_conservative_var[2][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
+                                const double& rho_y_T = Q[0][idx_cell_rho_y_T];
+                                const double u_y_T = Q[1][idx_cell_mom_y_T]/rho_y_T;
+                                const double v_y_T = Q[2][idx_cell_mom_y_T]/rho_y_T;
+                                const double w_y_T = Q[3][idx_cell_mom_y_T]/rho_y_T;
+                                const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
+                                
+                                rho_states[idx_state_y_T]     = rho_y_T;
+                                u_states[idx_state_y_T]       = u_y_T;
+                                v_states[idx_state_y_T]       = v_y_T;
+                                w_states[idx_state_y_T]       = w_y_T;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
+                                
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_B]     = rho_z_B;
+                                epsilon_states[idx_state_y_B] = epsilon_z_B;
+                            }
+                            else if ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                                     (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                                     (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(1, 1)) && (j == interior_box_hi_idx[1])) ||
+                            //          ((j + num_subghosts_conservative_var[0][1] + 1 == subghostcell_dims_conservative_var[0][1]) ||
+                            //           (j + num_subghosts_conservative_var[1][1] + 1 == subghostcell_dims_conservative_var[1][1]) ||
+                            //           (j + num_subghosts_conservative_var[2][1] + 1 == subghostcell_dims_conservative_var[2][1])))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const int idx_cell_rho_y_B = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
+                                const double& rho_y_B = Q[0][idx_cell_rho_y_B];
+                                const double u_y_B = Q[1][idx_cell_mom_y_B]/rho_y_B;
+                                const double v_y_B = Q[2][idx_cell_mom_y_B]/rho_y_B;
+                                const double w_y_B = Q[3][idx_cell_mom_y_B]/rho_y_B;
+                                const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
+                                
+                                rho_states[idx_state_y_B]     = rho_y_B;
+                                u_states[idx_state_y_B]       = u_y_B;
+                                v_states[idx_state_y_B]       = v_y_B;
+                                w_states[idx_state_y_B]       = w_y_B;
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                
+                                // Fill the slot of the missing neighbor with the state at the boundary so that the
+                                // equation of state is only evaluated on valid states.
+                                rho_states[idx_state_y_T]     = rho_z_B;
+                                epsilon_states[idx_state_y_T] = epsilon_z_B;
+                            }
+                            else
+                            {
+                                const int idx_cell_rho_y_B = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (interior_box_hi_idx[2] +  num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_rho_y_T = (i + num_subghosts_conservative_var[0][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
+                                        subghostcell_dims_conservative_var[0][1];
+                                
+                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_mom_y_T = (i + num_subghosts_conservative_var[1][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
+                                        subghostcell_dims_conservative_var[1][1];
+                                
+                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
+                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
+                                const int idx_cell_E_y_T = (i + num_subghosts_conservative_var[2][0]) +
+                                    (j + 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
+                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
+                                        subghostcell_dims_conservative_var[2][1];
+                                
+                                const double& rho_y_B = Q[0][idx_cell_rho_y_B];
+                                const double& rho_y_T = Q[0][idx_cell_rho_y_T];
+                                
+                                const double u_y_B = Q[1][idx_cell_mom_y_B]/rho_y_B;
+                                const double u_y_T = Q[1][idx_cell_mom_y_T]/rho_y_T;
+                                
+                                const double v_y_B = Q[2][idx_cell_mom_y_B]/rho_y_B;
+                                const double v_y_T = Q[2][idx_cell_mom_y_T]/rho_y_T;
+                                
+                                const double w_y_B = Q[3][idx_cell_mom_y_B]/rho_y_B;
+                                const double w_y_T = Q[3][idx_cell_mom_y_T]/rho_y_T;
+                                
+                                const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
+                                const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
+                                
+                                rho_states[idx_state_y_B] = rho_y_B;
+                                rho_states[idx_state_y_T] = rho_y_T;
+                                
+                                u_states[idx_state_y_B] = u_y_B;
+                                u_states[idx_state_y_T] = u_y_T;
+                                
+                                v_states[idx_state_y_B] = v_y_B;
+                                v_states[idx_state_y_T] = v_y_T;
+                                
+                                w_states[idx_state_y_B] = w_y_B;
+                                w_states[idx_state_y_T] = w_y_T;
+                                
+                                epsilon_states[idx_state_y_B] = epsilon_y_B;
+                                epsilon_states[idx_state_y_T] = epsilon_y_T;
+                            }
+                        }
+                    }
+                    
+                    // Compute the pressures of all the states and the sound speeds at the boundary in batch.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_states,
+                            rho_states,
+                            epsilon_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_states);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeSoundSpeed(
+                            c_bdry,
+                            rho_states,
+                            p_states,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_lines);
+                    
+                    /*
+                     * Extrapolate the primitive variables to the ghost cells with the characteristic relations.
+                     */
+                    
+                    for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
+                    {
+                        for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
+                        {
+                            const int idx_line = (i - fill_box_lo_idx[0]) +
+                                (j - fill_box_lo_idx[1])*(fill_box_hi_idx[0] - fill_box_lo_idx[0] + 1);
+                            
+                            const int idx_state_z_B   = idx_line;
+                            const int idx_state_z_BB  = idx_line + num_lines;
+                            const int idx_state_z_BBB = idx_line + 2*num_lines;
+                            const int idx_state_x_L   = idx_line + 3*num_lines;
+                            const int idx_state_x_R   = idx_line + 4*num_lines;
+                            const int idx_state_y_B   = idx_line + 5*num_lines;
+                            const int idx_state_y_T   = idx_line + 6*num_lines;
+                            
+                            const double& rho_z_B   = rho_states[idx_state_z_B];
+                            const double& rho_z_BB  = rho_states[idx_state_z_BB];
+                            const double& rho_z_BBB = rho_states[idx_state_z_BBB];
+                            
+                            const double& u_z_B   = u_states[idx_state_z_B];
+                            const double& u_z_BB  = u_states[idx_state_z_BB];
+                            const double& u_z_BBB = u_states[idx_state_z_BBB];
+                            
+                            const double& v_z_B   = v_states[idx_state_z_B];
+                            const double& v_z_BB  = v_states[idx_state_z_BB];
+                            const double& v_z_BBB = v_states[idx_state_z_BBB];
+                            
+                            const double& w_z_B   = w_states[idx_state_z_B];
+                            const double& w_z_BB  = w_states[idx_state_z_BB];
+                            const double& w_z_BBB = w_states[idx_state_z_BBB];
+                            
+                            const double& p_z_B   = p_states[idx_state_z_B];
+                            const double& p_z_BB  = p_states[idx_state_z_BB];
+                            const double& p_z_BBB = p_states[idx_state_z_BBB];
+                            
+                            /*
+                             * Compute derivatives at z-direction.
+                             */
+                            
+                            const double drho_dz = (rho_z_BBB - double(4)*rho_z_BB + double(3)*rho_z_B)/(double(2)*dx[2]);
+                            const double du_dz   = (u_z_BBB - double(4)*u_z_BB + double(3)*u_z_B)/(double(2)*dx[2]);
+                            const double dv_dz   = (v_z_BBB - double(4)*v_z_BB + double(3)*v_z_B)/(double(2)*dx[2]);
+                            const double dw_dz   = (w_z_BBB - double(4)*w_z_BB + double(3)*w_z_B)/(double(2)*dx[2]);
+                            const double dp_dz   = (p_z_BBB - double(4)*p_z_BB + double(3)*p_z_B)/(double(2)*dx[2]);
+                            
+                            /*
+                             * Compute derivatives in x-direction.
+                             */
+                            
+                            double du_dx = double(0);
+                            // double dv_dx = double(0);
+                            double dw_dx = double(0);
+                            double dp_dx = double(0);
+                            
+                            if ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                                (i + num_subghosts_conservative_var[1][0] == 0) ||
+                                (i + num_subghosts_conservative_var[2][0] == 0))
+                            // if (((patch_geom->getTouchesRegularBoundary(0, 0)) && (i == interior_box_lo_idx[0])) ||
+                            //     ((i + num_subghosts_conservative_var[0][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[1][0] == 0) ||
+                            //      (i + num_subghosts_conservative_var[2][0] == 0)))
+                            {
+                                // Patch is touching periodic boundary.
+                                
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_R = p_states[idx_state_x_R];
                                 
-                                const double epsilon_x_L = Q[4][idx_cell_E_x_L]/rho_x_L - half*(u_x_L*u_x_L + v_x_L*v_x_L + w_x_L*w_x_L);
-                                const double epsilon_x_R = Q[4][idx_cell_E_x_R]/rho_x_R - half*(u_x_R*u_x_R + v_x_R*v_x_R + w_x_R*w_x_R);
+                                // One-sided derivatives.
+                                du_dx = (u_x_R - u_z_B)/(dx[0]);
+                                // dv_dx = (v_x_R - v_z_B)/(dx[0]);
+                                dw_dx = (w_x_R - w_z_B)/(dx[0]);
+                                dp_dx = (p_x_R - p_z_B)/(dx[0]);
+                            }
+                            else if ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                                     (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                                     (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0]))
+                            // else if (((patch_geom->getTouchesRegularBoundary(0, 1)) && (i == interior_box_hi_idx[0])) ||
+                            //          ((i + num_subghosts_conservative_var[0][0] + 1 == subghostcell_dims_conservative_var[0][0]) ||
+                            //           (i + num_subghosts_conservative_var[1][0] + 1 == subghostcell_dims_conservative_var[1][0]) ||
+                            //           (i + num_subghosts_conservative_var[2][0] + 1 == subghostcell_dims_conservative_var[2][0])))
+                            {
+                                // Patch is touching periodic boundary.
                                 
-                                const double p_x_L = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_L,
-                                        &epsilon_x_L,
-                                        thermo_properties_ptr);
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& p_x_L = p_states[idx_state_x_L];
                                 
-                                const double p_x_R = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_x_R,
-                                        &epsilon_x_R,
-                                        thermo_properties_ptr);
+                                // One-sided derivatives.
+                                du_dx = (u_z_B - u_x_L)/(dx[0]);
+                                // dv_dx = (v_z_B - v_x_L)/(dx[0]);
+                                dw_dx = (w_z_B - w_x_L)/(dx[0]);
+                                dp_dx = (p_z_B - p_x_L)/(dx[0]);
+                            }
+                            else
+                            {
+                                const double& u_x_L = u_states[idx_state_x_L];
+                                const double& u_x_R = u_states[idx_state_x_R];
+                                const double& v_x_L = v_states[idx_state_x_L];
+                                const double& v_x_R = v_states[idx_state_x_R];
+                                const double& w_x_L = w_states[idx_state_x_L];
+                                const double& w_x_R = w_states[idx_state_x_R];
+                                const double& p_x_L = p_states[idx_state_x_L];
+                                const double& p_x_R = p_states[idx_state_x_R];
                                 
                                 // Central derivatives.
                                 du_dx = (u_x_R - u_x_L)/(double(2)*dx[0]);
@@ -7882,32 +10447,10 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             {
                                 // Patch is touching periodic boundary.
                                 
-                                const int idx_cell_rho_y_T = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_mom_y_T = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
-                                
-                                const int idx_cell_E_y_T = (i + num_subghosts_conservative_var[2][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
-                                
-                                const double& rho_y_T = Q[0][idx_cell_rho_y_T];
-                                const double u_y_T = Q[1][idx_cell_mom_y_T]/rho_y_T;
-                                const double v_y_T = Q[2][idx_cell_mom_y_T]/rho_y_T;
-                                const double w_y_T = Q[3][idx_cell_mom_y_T]/rho_y_T;
-                                const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
-                                
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_T = p_states[idx_state_y_T];
                                 
                                 // One-sided derivatives.
                                 // du_dy = (u_y_T - u_z_B)/(dx[1]);
@@ -7925,32 +10468,10 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             {
                                 // Patch is touching periodic boundary.
                                 
-                                const int idx_cell_rho_y_B = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
-                                
-                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
-                                
-                                const double& rho_y_B = Q[0][idx_cell_rho_y_B];
-                                const double u_y_B = Q[1][idx_cell_mom_y_B]/rho_y_B;
-                                const double v_y_B = Q[2][idx_cell_mom_y_B]/rho_y_B;
-                                const double w_y_B = Q[3][idx_cell_mom_y_B]/rho_y_B;
-                                const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
-                                
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& p_y_B = p_states[idx_state_y_B];
                                 
                                 // One-sided derivatives.
                                 // du_dy = (u_z_B - u_y_B)/(dx[1]);
@@ -7960,62 +10481,14 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                             }
                             else
                             {
-                                const int idx_cell_rho_y_B = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (interior_box_hi_idx[2] +  num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_rho_y_T = (i + num_subghosts_conservative_var[0][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[0][1])*subghostcell_dims_conservative_var[0][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[0][2])*subghostcell_dims_conservative_var[0][0]*
-                                        subghostcell_dims_conservative_var[0][1];
-                                
-                                const int idx_cell_mom_y_B = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
-                                
-                                const int idx_cell_mom_y_T = (i + num_subghosts_conservative_var[1][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[1][1])*subghostcell_dims_conservative_var[1][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[1][2])*subghostcell_dims_conservative_var[1][0]*
-                                        subghostcell_dims_conservative_var[1][1];
-                                
-                                const int idx_cell_E_y_B = (i + num_subghosts_conservative_var[2][0]) +
-                                    (j - 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
-                                
-                                const int idx_cell_E_y_T = (i + num_subghosts_conservative_var[2][0]) +
-                                    (j + 1 + num_subghosts_conservative_var[2][1])*subghostcell_dims_conservative_var[2][0] +
-                                    (interior_box_hi_idx[2] + num_subghosts_conservative_var[2][2])*subghostcell_dims_conservative_var[2][0]*
-                                        subghostcell_dims_conservative_var[2][1];
-                                
-                                const double& rho_y_B = Q[0][idx_cell_rho_y_B];
-                                const double& rho_y_T = Q[0][idx_cell_rho_y_T];
-                                
-                                const double u_y_B = Q[1][idx_cell_mom_y_B]/rho_y_B;
-                                const double u_y_T = Q[1][idx_cell_mom_y_T]/rho_y_T;
-                                
-                                const double v_y_B = Q[2][idx_cell_mom_y_B]/rho_y_B;
-                                const double v_y_T = Q[2][idx_cell_mom_y_T]/rho_y_T;
-                                
-                                const double w_y_B = Q[3][idx_cell_mom_y_B]/rho_y_B;
-                                const double w_y_T = Q[3][idx_cell_mom_y_T]/rho_y_T;
-                                
-                                const double epsilon_y_B = Q[4][idx_cell_E_y_B]/rho_y_B - half*(u_y_B*u_y_B + v_y_B*v_y_B + w_y_B*w_y_B);
-                                const double epsilon_y_T = Q[4][idx_cell_E_y_T]/rho_y_T - half*(u_y_T*u_y_T + v_y_T*v_y_T + w_y_T*w_y_T);
-                                
-                                const double p_y_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_B,
-                                        &epsilon_y_B,
-                                        thermo_properties_ptr);
-                                
-                                const double p_y_T = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &rho_y_T,
-                                        &epsilon_y_T,
-                                        thermo_properties_ptr);
+                                const double& u_y_B = u_states[idx_state_y_B];
+                                const double& u_y_T = u_states[idx_state_y_T];
+                                const double& v_y_B = v_states[idx_state_y_B];
+                                const double& v_y_T = v_states[idx_state_y_T];
+                                const double& w_y_B = w_states[idx_state_y_B];
+                                const double& w_y_T = w_states[idx_state_y_T];
+                                const double& p_y_B = p_states[idx_state_y_B];
+                                const double& p_y_T = p_states[idx_state_y_T];
                                 
                                 // Central derivatives.
                                 // du_dy = (u_y_T - u_y_B)/(double(2)*dx[1]);
@@ -8024,11 +10497,7 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 dp_dy = (p_y_T - p_y_B)/(double(2)*dx[1]);
                             }
                             
-                            const double c_z_B = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                getSoundSpeed(
-                                    &rho_z_B,
-                                    &p_z_B,
-                                    thermo_properties_ptr);
+                            const double& c_z_B = c_bdry[idx_line];
                             
                             const double lambda_1 = w_z_B - c_z_B;
                             
@@ -8214,20 +10683,38 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dFaceBoundaryData(
                                 Q[2][idx_cell_mom] = V_ghost[k*5 + 0]*V_ghost[k*5 + 2];
                                 Q[3][idx_cell_mom] = V_ghost[k*5 + 0]*V_ghost[k*5 + 3];
                                 
-                                const double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergy(
-                                        &V_ghost[k*5 + 0],
-                                        &V_ghost[k*5 + 4],
-                                        thermo_properties_ptr);
+                                const int idx_ghost = idx_line*num_ghosts_to_fill + k;
                                 
-                                const double E = V_ghost[k*5 + 0]*epsilon +
-                                    half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                       Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/V_ghost[k*5 + 0];
+                                rho_ghosts[idx_ghost] = V_ghost[k*5 + 0];
+                                p_ghosts[idx_ghost]   = V_ghost[k*5 + 4];
                                 
-                                Q[4][idx_cell_E] = E;
+                                idx_cell_mom_ghosts[idx_ghost] = idx_cell_mom;
+                                idx_cell_E_ghosts[idx_ghost]   = idx_cell_E;
                             }
                         }
                     }
+                    
+                    // Compute the specific internal energies of the ghost cells in batch and then the total energies.
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergy(
+                            epsilon_ghosts,
+                            rho_ghosts,
+                            p_ghosts,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_ghost_cells);
+                    
+                    for (int idx_ghost = 0; idx_ghost < num_ghost_cells; idx_ghost++)
+                    {
+                        const int idx_cell_mom = idx_cell_mom_ghosts[idx_ghost];
+                        const int idx_cell_E = idx_cell_E_ghosts[idx_ghost];
+                        
+                        const double E = rho_ghosts[idx_ghost]*epsilon_ghosts[idx_ghost] +
+                            half*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                               Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho_ghosts[idx_ghost];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
                 }
                 
                 // Remove face locations that have boundary conditions identified.
@@ -8503,16 +10990,30 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -8610,51 +11111,105 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
                                     double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &Q[0][idx_cell_rho],
-                                        &T,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double E = Q[0][idx_cell_rho]*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -8752,51 +11307,105 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
                                     double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = T_pivot;
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &Q[0][idx_cell_rho],
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = Q[0][idx_cell_rho]*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ZADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -8894,51 +11503,109 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
                                     double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &Q[0][idx_cell_rho],
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = Q[0][idx_cell_rho]*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -9024,70 +11691,140 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Set the values for density, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = -T_pivot + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_0];
-                                
-                                double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getDensity(
-                                        &p,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
-                                double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
-                                double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                Q[0][idx_cell_rho] = rho;
-                                Q[1][idx_cell_mom] = rho*u;
-                                Q[2][idx_cell_mom] = rho*v;
-                                Q[3][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
+                        double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        Q[3][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -9173,70 +11910,140 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Set the values for density, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
-                                         Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
-                                    Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
-                                
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = -T_pivot + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_1];
-                                
-                                double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getDensity(
-                                        &p,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
-                                double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
-                                double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                Q[0][idx_cell_rho] = rho;
-                                Q[1][idx_cell_mom] = rho*u;
-                                Q[2][idx_cell_mom] = rho*v;
-                                Q[3][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        thermo_properties_ptr);
+                                         Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
+                                    Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double E = rho*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
+                        double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        Q[3][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
                 }
                 else if (bdry_edge_conds[edge_loc] == BDRY_COND::FLOW_MODEL::ZISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -9322,64 +12129,108 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dEdgeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Set the values for density, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = -T_pivot + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_2];
-                                
-                                double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getDensity(
-                                        &p,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
-                                double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
-                                double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
-                                
-                                Q[0][idx_cell_rho] = rho;
-                                Q[1][idx_cell_mom] = rho*u;
-                                Q[2][idx_cell_mom] = rho*v;
-                                Q[3][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_2];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
+                        double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        Q[3][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove edge locations that have boundary conditions identified.
                     bdry_edge_locs.erase(std::remove(bdry_edge_locs.begin(), bdry_edge_locs.end(), edge_loc),
                         bdry_edge_locs.end());
@@ -9634,16 +12485,30 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
                         conservative_var_data[vi]->getGhostBox().numberCells());
                 }
                 
-                // Get the thermodynamic properties of the species.
-                std::vector<const double*> thermo_properties_ptr;
-                thermo_properties_ptr.reserve(static_cast<int> (d_thermo_properties.size()));
-                for (int ti = 0; ti < static_cast<int> (d_thermo_properties.size()); ti++)
-                {
-                    thermo_properties_ptr.push_back(&d_thermo_properties[ti]);
-                }
-                
                 if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -9741,51 +12606,105 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
                                     double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_face_adiabatic_no_slip_vel[face_loc_0*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &Q[0][idx_cell_rho],
-                                        &T,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double E = Q[0][idx_cell_rho]*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -9883,51 +12802,105 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
                                     double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_face_adiabatic_no_slip_vel[face_loc_1*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = T_pivot;
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &Q[0][idx_cell_rho],
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = Q[0][idx_cell_rho]*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ZADIABATIC_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(3*num_fill_cells);
+                    d_bdry_fill_workspace.resize(5*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const epsilon_fill = T_pivot_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -10025,51 +12998,109 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
                                     double(2)*Q[0][idx_cell_pivot_rho]*d_bdry_face_adiabatic_no_slip_vel[face_loc_2*3 + 2];
                                 
                                 /*
-                                 * Set the values for total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
                                 
-                                double T = T_pivot;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &Q[0][idx_cell_rho],
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = Q[0][idx_cell_rho]*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
-                                    Q[0][idx_cell_rho];
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_pivot_fill,
+                            T_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for total internal energy.
+                         */
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = Q[0][idx_cell_rho]*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/
+                            Q[0][idx_cell_rho];
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::XISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -10155,70 +13186,140 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Set the values for density, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = -T_pivot + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_0];
-                                
-                                double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getDensity(
-                                        &p,
-                                        &T,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
-                                double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
-                                double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
-                                
-                                Q[0][idx_cell_rho] = rho;
-                                Q[1][idx_cell_mom] = rho*u;
-                                Q[2][idx_cell_mom] = rho*v;
-                                Q[3][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_0];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 1];
+                        double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_0*3 + 2];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        Q[3][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::YISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -10304,70 +13405,140 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Set the values for density, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = -T_pivot + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_1];
-                                
-                                double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getDensity(
-                                        &p,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
-                                double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
-                                double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
-                                
-                                Q[0][idx_cell_rho] = rho;
-                                Q[1][idx_cell_mom] = rho*u;
-                                Q[2][idx_cell_mom] = rho*v;
-                                Q[3][idx_cell_mom] = rho*w;
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_1];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 1];
+                        double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_1*3 + 2];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        Q[3][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
                 }
                 else if (bdry_node_conds[node_loc] == BDRY_COND::FLOW_MODEL::ZISOTHERMAL_NO_SLIP)
                 {
+                    /*
+                     * Gather the states of the pivots first so that the equation of state is evaluated in
+                     * batch for all the ghost cells.
+                     */
+                    
+                    const int num_fill_cells = static_cast<int>(fill_box.size());
+                    
+                    d_bdry_fill_idx_workspace.resize(5*num_fill_cells);
+                    d_bdry_fill_workspace.resize(7*num_fill_cells);
+                    
+                    int* const idx_cell_rho_fill = d_bdry_fill_idx_workspace.data();
+                    int* const idx_cell_mom_fill = idx_cell_rho_fill + num_fill_cells;
+                    int* const idx_cell_E_fill = idx_cell_mom_fill + num_fill_cells;
+                    int* const idx_cell_pivot_rho_fill = idx_cell_E_fill + num_fill_cells;
+                    int* const idx_cell_pivot_mom_fill = idx_cell_pivot_rho_fill + num_fill_cells;
+                    
+                    double* const rho_pivot_fill = d_bdry_fill_workspace.data();
+                    double* const epsilon_pivot_fill = rho_pivot_fill + num_fill_cells;
+                    double* const p_pivot_fill = epsilon_pivot_fill + num_fill_cells;
+                    double* const T_pivot_fill = p_pivot_fill + num_fill_cells;
+                    double* const T_fill = T_pivot_fill + num_fill_cells;
+                    double* const rho_fill = T_fill + num_fill_cells;
+                    double* const epsilon_fill = rho_fill + num_fill_cells;
+                    
+                    int count_fill = 0;
+                    
                     for (int i = fill_box_lo_idx[0]; i <= fill_box_hi_idx[0]; i++)
                     {
                         for (int j = fill_box_lo_idx[1]; j <= fill_box_hi_idx[1]; j++)
@@ -10453,64 +13624,108 @@ FlowModelBoundaryUtilitiesSingleSpecies::fill3dNodeBoundaryData(
                                 }
                                 
                                 /*
-                                 * Set the values for density, momentum and total internal energy.
+                                 * Store the density and specific internal energy of the pivot.
                                  */
                                 
-                                double epsilon_pivot = (Q[4][idx_cell_pivot_E] -
+                                epsilon_pivot_fill[count_fill] = (Q[4][idx_cell_pivot_E] -
                                     0.5*(Q[1][idx_cell_pivot_mom]*Q[1][idx_cell_pivot_mom] +
                                          Q[2][idx_cell_pivot_mom]*Q[2][idx_cell_pivot_mom] +
                                          Q[3][idx_cell_pivot_mom]*Q[3][idx_cell_pivot_mom])/
                                     Q[0][idx_cell_pivot_rho])/Q[0][idx_cell_pivot_rho];
                                 
-                                double p_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getPressure(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &epsilon_pivot,
-                                        thermo_properties_ptr);
+                                rho_pivot_fill[count_fill] = Q[0][idx_cell_pivot_rho];
+                                idx_cell_rho_fill[count_fill] = idx_cell_rho;
+                                idx_cell_mom_fill[count_fill] = idx_cell_mom;
+                                idx_cell_E_fill[count_fill] = idx_cell_E;
+                                idx_cell_pivot_rho_fill[count_fill] = idx_cell_pivot_rho;
+                                idx_cell_pivot_mom_fill[count_fill] = idx_cell_pivot_mom;
                                 
-                                double p = p_pivot;
-                                
-                                double T_pivot = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getTemperature(
-                                        &Q[0][idx_cell_pivot_rho],
-                                        &p_pivot,
-                                        thermo_properties_ptr);
-                                
-                                double T = -T_pivot + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_2];
-                                
-                                double rho = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getDensity(
-                                        &p,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
-                                double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
-                                double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
-                                    double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
-                                
-                                Q[0][idx_cell_rho] = rho;
-                                Q[1][idx_cell_mom] = rho*u;
-                                Q[2][idx_cell_mom] = rho*v;
-                                Q[3][idx_cell_mom] = rho*w;
-                                
-                                double epsilon = d_equation_of_state_mixing_rules->getEquationOfState()->
-                                    getInternalEnergyFromTemperature(
-                                        &rho,
-                                        &T,
-                                        thermo_properties_ptr);
-                                
-                                double E = rho*epsilon +
-                                    0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
-                                         Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
-                                
-                                Q[4][idx_cell_E] = E;
+                                count_fill++;
                             }
                         }
                     }
                     
+                    /*
+                     * Compute the pressure and temperature of the pivots and the specific internal energy
+                     * of the ghost cells in batch.
+                     */
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computePressure(
+                            p_pivot_fill,
+                            rho_pivot_fill,
+                            epsilon_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeTemperature(
+                            T_pivot_fill,
+                            rho_pivot_fill,
+                            p_pivot_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        T_fill[idx_fill] = -T_pivot_fill[idx_fill] + double(2)*d_bdry_face_isothermal_no_slip_T[face_loc_2];
+                    }
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeDensity(
+                            rho_fill,
+                            p_pivot_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    d_equation_of_state_mixing_rules->getEquationOfState()->
+                        computeInternalEnergyFromTemperature(
+                            epsilon_fill,
+                            rho_fill,
+                            T_fill,
+                            d_thermo_properties_ptr.data(),
+                            0,
+                            num_fill_cells);
+                    
+                    for (int idx_fill = 0; idx_fill < num_fill_cells; idx_fill++)
+                    {
+                        const int idx_cell_rho = idx_cell_rho_fill[idx_fill];
+                        const int idx_cell_mom = idx_cell_mom_fill[idx_fill];
+                        const int idx_cell_E = idx_cell_E_fill[idx_fill];
+                        const int idx_cell_pivot_rho = idx_cell_pivot_rho_fill[idx_fill];
+                        const int idx_cell_pivot_mom = idx_cell_pivot_mom_fill[idx_fill];
+                        
+                        /*
+                         * Set the values for density, momentum and total internal energy.
+                         */
+                        
+                        double rho = rho_fill[idx_fill];
+                        
+                        double u = -Q[1][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3];
+                        double v = -Q[2][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 1];
+                        double w = -Q[3][idx_cell_pivot_mom]/Q[0][idx_cell_pivot_rho] +
+                            double(2)*d_bdry_edge_isothermal_no_slip_vel[face_loc_2*3 + 2];
+                        
+                        Q[0][idx_cell_rho] = rho;
+                        Q[1][idx_cell_mom] = rho*u;
+                        Q[2][idx_cell_mom] = rho*v;
+                        Q[3][idx_cell_mom] = rho*w;
+                        
+                        double epsilon = epsilon_fill[idx_fill];
+                        
+                        double E = rho*epsilon +
+                            0.5*(Q[1][idx_cell_mom]*Q[1][idx_cell_mom] + Q[2][idx_cell_mom]*Q[2][idx_cell_mom] +
+                                 Q[3][idx_cell_mom]*Q[3][idx_cell_mom])/rho;
+                        
+                        Q[4][idx_cell_E] = E;
+                    }
+                    
                     // Remove node locations that have boundary conditions identified.
                     bdry_node_locs.erase(std::remove(bdry_node_locs.begin(), bdry_node_locs.end(), node_loc),
                         bdry_node_locs.end());
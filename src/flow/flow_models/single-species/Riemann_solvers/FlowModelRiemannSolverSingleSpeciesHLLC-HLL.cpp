@@ -31,11 +31,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[1][idx]*(s_x_L - u_x_L) - Q_x_R[1][idx]*(s_x_R - u_x_R))/
@@ -44,41 +44,38 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
     double Q_x_star_LR[3];
     double F_x_LR[3];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[3];
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_L[2][idx] + (s_x_star - u_x_L)*(Q_x_L[0][idx]*s_x_star +
-            p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        F_x_LR[0] = Q_x_L[1][idx];
-        F_x_LR[1] = u_x_L*Q_x_L[1][idx] + p_x_L[idx];
-        F_x_LR[2] = u_x_L*(Q_x_L[2][idx] + p_x_L[idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*Q_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*Q_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - u_x_LR)*(Q_x_LR[0]*s_x_star +
+        p_x_LR/(s_x_LR - u_x_LR)));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = u_x_LR*Q_x_LR[1] + p_x_LR;
+    F_x_LR[2] = u_x_LR*(Q_x_LR[2] + p_x_LR);
+    
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_R[2][idx] + (s_x_star - u_x_R)*(Q_x_R[0][idx]*s_x_star +
-            p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        F_x_LR[0] = Q_x_R[1][idx];
-        F_x_LR[1] = u_x_R*Q_x_R[1][idx] + p_x_R[idx];
-        F_x_LR[2] = u_x_R*(Q_x_R[2][idx] + p_x_R[idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -114,11 +111,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[1][idx]*(s_x_L - u_x_L) - Q_x_R[1][idx]*(s_x_R - u_x_R))/
@@ -145,47 +142,51 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
     F_x_HLL[1] = (s_x_R*F_x_L[2] - s_x_L*F_x_R[2] + s_x_R*s_x_L*(Q_x_R[2][idx] - Q_x_L[2][idx]))/
         (s_x_R - s_x_L);
     
-    if (s_x_L > double(0))
-    {
-        F_x_HLL[0] = F_x_L[0];
-        F_x_HLL[1] = F_x_L[2];
-    }
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[2], F_x_HLL[1]);
     
-    if (s_x_R < double(0))
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[2], F_x_HLL[1]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        F_x_HLL[0] = F_x_R[0];
-        F_x_HLL[1] = F_x_R[2];
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
     
-    if (s_x_star > double(0))
+    double F_x_LR[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_L[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_L[3][idx] + (s_x_star - u_x_L)*(Q_x_L[0][idx]*s_x_star +
-            p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*Q_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*Q_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_LR[3] + (s_x_star - u_x_LR)*(Q_x_LR[0]*s_x_star +
+        p_x_LR/(s_x_LR - u_x_LR)));
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_R[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_R[3][idx] + (s_x_star - u_x_R)*(Q_x_R[0][idx]*s_x_star +
-            p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
     
     /*
@@ -196,17 +197,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
     const double v_x_diff = v_x_R - v_x_L;
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -252,11 +247,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[1][idx]*(s_x_L - u_x_L) - Q_x_R[1][idx]*(s_x_R - u_x_R))/
@@ -287,51 +282,54 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
     F_x_HLL[2] = (s_x_R*F_x_L[3] - s_x_L*F_x_R[3] + s_x_R*s_x_L*(Q_x_R[3][idx] - Q_x_L[3][idx]))/
         (s_x_R - s_x_L);
     
-    if (s_x_L > double(0))
-    {
-        F_x_HLL[0] = F_x_L[0];
-        F_x_HLL[1] = F_x_L[2];
-        F_x_HLL[2] = F_x_L[3];
-    }
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[2], F_x_HLL[1]);
+    F_x_HLL[2] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[3], F_x_HLL[2]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[2], F_x_HLL[1]);
+    F_x_HLL[2] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[3], F_x_HLL[2]);
     
-    if (s_x_R < double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_x_HLL[0] = F_x_R[0];
-        F_x_HLL[1] = F_x_R[2];
-        F_x_HLL[2] = F_x_R[3];
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
     
-    if (s_x_star > double(0))
+    double F_x_LR[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_L[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_L[3][idx];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_L[4][idx] + (s_x_star - u_x_L)*(Q_x_L[0][idx]*s_x_star +
-            p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*Q_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*Q_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*Q_x_LR[3];
+    Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_LR[4] + (s_x_star - u_x_LR)*(Q_x_LR[0]*s_x_star +
+        p_x_LR/(s_x_LR - u_x_LR)));
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_R[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_R[3][idx];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_R[4][idx] + (s_x_star - u_x_R)*(Q_x_R[0][idx]*s_x_star +
-            p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 
     /*
@@ -343,17 +341,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_x_diff = w_x_R - w_x_L;
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff + w_x_diff*w_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -397,11 +389,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[2][idx]*(s_y_B - v_y_B) - Q_y_T[2][idx]*(s_y_T - v_y_T))/
@@ -428,47 +420,51 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
     F_y_HLL[1] = (s_y_T*F_y_B[1] - s_y_B*F_y_T[1] + s_y_T*s_y_B*(Q_y_T[1][idx] - Q_y_B[1][idx]))/
         (s_y_T - s_y_B);
     
-    if (s_y_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[1], F_y_HLL[1]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[1], F_y_HLL[1]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        F_y_HLL[0] = F_y_B[0];
-        F_y_HLL[1] = F_y_B[1];
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
     }
     
-    if (s_y_T < double(0))
+    double F_y_BT[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        F_y_HLL[0] = F_y_T[0];
-        F_y_HLL[1] = F_y_T[1];
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
     }
     
-    if (s_y_star > double(0))
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*Q_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*Q_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_BT[3] + (s_y_star - v_y_BT)*(Q_y_BT[0]*s_y_star +
+        p_y_BT/(s_y_BT - v_y_BT)));
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_B[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_B[3][idx] + (s_y_star - v_y_B)*(Q_y_B[0][idx]*s_y_star +
-            p_y_B[idx]/(s_y_B - v_y_B)));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
-    }
-    else
-    {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_T[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_T[3][idx] + (s_y_star - v_y_T)*(Q_y_T[0][idx]*s_y_star +
-            p_y_T[idx]/(s_y_T - v_y_T)));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -479,17 +475,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
     const double v_y_diff = v_y_T - v_y_B;
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -535,11 +525,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[2][idx]*(s_y_B - v_y_B) - Q_y_T[2][idx]*(s_y_T - v_y_T))/
@@ -570,51 +560,54 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
     F_y_HLL[2] = (s_y_T*F_y_B[3] - s_y_B*F_y_T[3] + s_y_T*s_y_B*(Q_y_T[3][idx] - Q_y_B[3][idx]))/
         (s_y_T - s_y_B);
     
-    if (s_y_B > double(0))
-    {
-        F_y_HLL[0] = F_y_B[0];
-        F_y_HLL[1] = F_y_B[1];
-        F_y_HLL[2] = F_y_B[3];
-    }
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[1], F_y_HLL[1]);
+    F_y_HLL[2] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[3], F_y_HLL[2]);
     
-    if (s_y_T < double(0))
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[1], F_y_HLL[1]);
+    F_y_HLL[2] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[3], F_y_HLL[2]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_y_HLL[0] = F_y_T[0];
-        F_y_HLL[1] = F_y_T[1];
-        F_y_HLL[2] = F_y_T[3];
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
     }
     
-    if (s_y_star > double(0))
+    double F_y_BT[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_B[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_B[3][idx];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_B[4][idx] + (s_y_star - v_y_B)*(Q_y_B[0][idx]*s_y_star +
-            p_y_B[idx]/(s_y_B - v_y_B)));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*Q_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*Q_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*Q_y_BT[3];
+    Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_BT[4] + (s_y_star - v_y_BT)*(Q_y_BT[0]*s_y_star +
+        p_y_BT/(s_y_BT - v_y_BT)));
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_T[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_T[3][idx];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_T[4][idx] + (s_y_star - v_y_T)*(Q_y_T[0][idx]*s_y_star +
-            p_y_T[idx]/(s_y_T - v_y_T)));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -626,17 +619,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_y_diff = w_y_T - w_y_B;
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff + w_y_diff*w_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -683,11 +670,11 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_z_average = double(1)/double(2)*(w_z_B + w_z_F);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (p_z_F[idx] - p_z_B[idx] +
         Q_z_B[3][idx]*(s_z_B - w_z_B) - Q_z_F[3][idx]*(s_z_F - w_z_F))/
@@ -718,51 +705,54 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
     F_z_HLL[2] = (s_z_F*F_z_B[2] - s_z_B*F_z_F[2] + s_z_F*s_z_B*(Q_z_F[2][idx] - Q_z_B[2][idx]))/
         (s_z_F - s_z_B);
     
-    if (s_z_B > double(0))
-    {
-        F_z_HLL[0] = F_z_B[0];
-        F_z_HLL[1] = F_z_B[1];
-        F_z_HLL[2] = F_z_B[2];
-    }
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_z_B > double(0));
+    
+    F_z_HLL[0] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[0], F_z_HLL[0]);
+    F_z_HLL[1] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[1], F_z_HLL[1]);
+    F_z_HLL[2] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[2], F_z_HLL[2]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_F = SIMD_BLEND::getMask(s_z_F < double(0));
+    
+    F_z_HLL[0] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[0], F_z_HLL[0]);
+    F_z_HLL[1] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[1], F_z_HLL[1]);
+    F_z_HLL[2] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[2], F_z_HLL[2]);
     
-    if (s_z_F < double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double w_z_BF = SIMD_BLEND::blend(mask_upwind_B, w_z_B, w_z_F);
+    const double p_z_BF = SIMD_BLEND::blend(mask_upwind_B, p_z_B[idx], p_z_F[idx]);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double Q_z_BF[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_z_HLL[0] = F_z_F[0];
-        F_z_HLL[1] = F_z_F[1];
-        F_z_HLL[2] = F_z_F[2];
+        Q_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_z_B[ei][idx], Q_z_F[ei][idx]);
     }
     
-    if (s_z_star > double(0))
+    double F_z_BF[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_B - w_z_B)/(s_z_B - s_z_star);
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*Q_z_B[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_B[1][idx];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_B[2][idx];
-        Q_z_star_BF[3] = Chi_z_star_BF*Q_z_B[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_B[4][idx] + (s_z_star - w_z_B)*(Q_z_B[0][idx]*s_z_star +
-            p_z_B[idx]/(s_z_B - w_z_B)));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z_HLLC[ei] = F_z_B[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_B[ei][idx]);
-        }
+        F_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, F_z_B[ei], F_z_F[ei]);
     }
-    else
+    
+    Chi_z_star_BF = (s_z_BF - w_z_BF)/(s_z_BF - s_z_star);
+    
+    Q_z_star_BF[0] = Chi_z_star_BF*Q_z_BF[0];
+    Q_z_star_BF[1] = Chi_z_star_BF*Q_z_BF[1];
+    Q_z_star_BF[2] = Chi_z_star_BF*Q_z_BF[2];
+    Q_z_star_BF[3] = Chi_z_star_BF*Q_z_BF[0]*s_z_star;
+    Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_BF[4] + (s_z_star - w_z_BF)*(Q_z_BF[0]*s_z_star +
+        p_z_BF/(s_z_BF - w_z_BF)));
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_F - w_z_F)/(s_z_F - s_z_star);
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*Q_z_F[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_F[1][idx];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_F[2][idx];
-        Q_z_star_BF[3] = Chi_z_star_BF*Q_z_F[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_F[4][idx] + (s_z_star - w_z_F)*(Q_z_F[0][idx]*s_z_star +
-            p_z_F[idx]/(s_z_F - w_z_F)));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z_HLLC[ei] = F_z_F[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_F[ei][idx]);
-        }
+        F_z_HLLC[ei] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
     
     /*
@@ -774,17 +764,11 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
     const double w_z_diff = w_z_F - w_z_B;
     const double vel_mag = sqrt(u_z_diff*u_z_diff + v_z_diff*v_z_diff + w_z_diff*w_z_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(w_z_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(w_z_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -820,11 +804,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
     const double u_x_average = double(1)/double(2)*(V_x_L[1][idx] + V_x_R[1][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[2][idx] - V_x_L[2][idx] + V_x_L[0][idx]*V_x_L[1][idx]*(s_x_L - V_x_L[1][idx]) -
         V_x_R[0][idx]*V_x_R[1][idx]*(s_x_R - V_x_R[1][idx]))/
@@ -834,49 +818,42 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
     double Q_x_star_LR[3];
     double F_x_LR[3];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[3];
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[1][idx])/(s_x_L - s_x_star);
-        
-        Q_x_LR[0] = V_x_L[0][idx];
-        Q_x_LR[1] = V_x_L[0][idx]*V_x_L[1][idx];
-        Q_x_LR[2] = V_x_L[0][idx]*(epsilon_x_L[idx] + double(1)/double(2)*V_x_L[1][idx]*V_x_L[1][idx]);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - V_x_L[1][idx])*(V_x_L[0][idx]*s_x_star +
-            V_x_L[2][idx]/(s_x_L - V_x_L[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_L[1][idx] + V_x_L[2][idx];
-        F_x_LR[2] = V_x_L[1][idx]*(Q_x_LR[2] + V_x_L[2][idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[1])/(s_x_LR - s_x_star);
+    
+    Q_x_LR[0] = V_x_LR[0];
+    Q_x_LR[1] = V_x_LR[0]*V_x_LR[1];
+    Q_x_LR[2] = V_x_LR[0]*(epsilon_x_LR + double(1)/double(2)*V_x_LR[1]*V_x_LR[1]);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*V_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*V_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - V_x_LR[1])*(V_x_LR[0]*s_x_star +
+        V_x_LR[2]/(s_x_LR - V_x_LR[1])));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = Q_x_LR[1]*V_x_LR[1] + V_x_LR[2];
+    F_x_LR[2] = V_x_LR[1]*(Q_x_LR[2] + V_x_LR[2]);
+    
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[1][idx])/(s_x_R - s_x_star);
-        
-        Q_x_LR[0] = V_x_R[0][idx];
-        Q_x_LR[1] = V_x_R[0][idx]*V_x_R[1][idx];
-        Q_x_LR[2] = V_x_R[0][idx]*(epsilon_x_R[idx] + double(1)/double(2)*V_x_R[1][idx]*V_x_R[1][idx]);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - V_x_R[1][idx])*(V_x_R[0][idx]*s_x_star +
-            V_x_R[2][idx]/(s_x_R - V_x_R[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_R[1][idx] + V_x_R[2][idx];
-        F_x_LR[2] = V_x_R[1][idx]*(Q_x_LR[2] + V_x_R[2][idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -904,11 +881,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
     const double u_x_average = double(1)/double(2)*(V_x_L[1][idx] + V_x_R[1][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[3][idx] - V_x_L[3][idx] + V_x_L[0][idx]*V_x_L[1][idx]*(s_x_L - V_x_L[1][idx]) -
         V_x_R[0][idx]*V_x_R[1][idx]*(s_x_R - V_x_R[1][idx]))/
@@ -949,47 +926,55 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
     F_x_HLL[1] = (s_x_R*F_x_L[2] - s_x_L*F_x_R[2] + s_x_R*s_x_L*(Q_x_R[2] - Q_x_L[2]))/
         (s_x_R - s_x_L);
     
-    if (s_x_L > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[2], F_x_HLL[1]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[2], F_x_HLL[1]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        F_x_HLL[0] = F_x_L[0];
-        F_x_HLL[1] = F_x_L[2];
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
     
-    if (s_x_R < double(0))
+    double Q_x_LR[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        F_x_HLL[0] = F_x_R[0];
-        F_x_HLL[1] = F_x_R[2];
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei], Q_x_R[ei]);
     }
     
-    if (s_x_star > double(0))
+    double F_x_LR[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[1][idx])/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_L[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_L[3] + (s_x_star - V_x_L[1][idx])*(V_x_L[0][idx]*s_x_star +
-            V_x_L[3][idx]/(s_x_L - V_x_L[1][idx])));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei]);
-        }
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[1])/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*V_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*V_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_LR[3] + (s_x_star - V_x_LR[1])*(V_x_LR[0]*s_x_star +
+        V_x_LR[3]/(s_x_LR - V_x_LR[1])));
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[1][idx])/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_R[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_R[3] + (s_x_star - V_x_R[1][idx])*(V_x_R[0][idx]*s_x_star +
-            V_x_R[3][idx]/(s_x_R - V_x_R[1][idx])));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei]);
-        }
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
     
     /*
@@ -1000,17 +985,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
     const double v_x_diff = V_x_R[2][idx] - V_x_L[2][idx];
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1045,11 +1024,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double u_x_average = double(1)/double(2)*(V_x_L[1][idx] + V_x_R[1][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[4][idx] - V_x_L[4][idx] + V_x_L[0][idx]*V_x_L[1][idx]*(s_x_L - V_x_L[1][idx]) -
         V_x_R[0][idx]*V_x_R[1][idx]*(s_x_R - V_x_R[1][idx]))/
@@ -1096,51 +1075,58 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
     F_x_HLL[2] = (s_x_R*F_x_L[3] - s_x_L*F_x_R[3] + s_x_R*s_x_L*(Q_x_R[3] - Q_x_L[3]))/
         (s_x_R - s_x_L);
     
-    if (s_x_L > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_L = SIMD_BLEND::getMask(s_x_L > double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[2], F_x_HLL[1]);
+    F_x_HLL[2] = SIMD_BLEND::blend(mask_supersonic_L, F_x_L[3], F_x_HLL[2]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_R = SIMD_BLEND::getMask(s_x_R < double(0));
+    
+    F_x_HLL[0] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[0], F_x_HLL[0]);
+    F_x_HLL[1] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[2], F_x_HLL[1]);
+    F_x_HLL[2] = SIMD_BLEND::blend(mask_supersonic_R, F_x_R[3], F_x_HLL[2]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_x_HLL[0] = F_x_L[0];
-        F_x_HLL[1] = F_x_L[2];
-        F_x_HLL[2] = F_x_L[3];
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
     
-    if (s_x_R < double(0))
+    double Q_x_LR[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_x_HLL[0] = F_x_R[0];
-        F_x_HLL[1] = F_x_R[2];
-        F_x_HLL[2] = F_x_R[3];
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei], Q_x_R[ei]);
     }
     
-    if (s_x_star > double(0))
+    double F_x_LR[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[1][idx])/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_L[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_L[3];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_L[4] + (s_x_star - V_x_L[1][idx])*(V_x_L[0][idx]*s_x_star +
-            V_x_L[4][idx]/(s_x_L - V_x_L[1][idx])));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x_HLLC[ei] = F_x_L[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei]);
-        }
+        F_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, F_x_L[ei], F_x_R[ei]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[1])/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*V_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*V_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*Q_x_LR[3];
+    Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_LR[4] + (s_x_star - V_x_LR[1])*(V_x_LR[0]*s_x_star +
+        V_x_LR[4]/(s_x_LR - V_x_LR[1])));
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[1][idx])/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_R[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_R[3];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_R[4] + (s_x_star - V_x_R[1][idx])*(V_x_R[0][idx]*s_x_star +
-            V_x_R[4][idx]/(s_x_R - V_x_R[1][idx])));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x_HLLC[ei] = F_x_R[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei]);
-        }
+        F_x_HLLC[ei] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
     
     /*
@@ -1152,17 +1138,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double w_x_diff = V_x_R[3][idx] - V_x_L[3][idx];
     const double vel_mag = sqrt(u_x_diff*u_x_diff + v_x_diff*v_x_diff + w_x_diff*w_x_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(u_x_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(u_x_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1198,11 +1178,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
     const double v_y_average = double(1)/double(2)*(V_y_B[2][idx] + V_y_T[2][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[3][idx] - V_y_B[3][idx] + V_y_B[0][idx]*V_y_B[2][idx]*(s_y_B - V_y_B[2][idx]) -
         V_y_T[0][idx]*V_y_T[2][idx]*(s_y_T - V_y_T[2][idx]))/
@@ -1243,47 +1223,55 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
     F_y_HLL[1] = (s_y_T*F_y_B[1] - s_y_B*F_y_T[1] + s_y_T*s_y_B*(Q_y_T[1] - Q_y_B[1]))/
         (s_y_T - s_y_B);
     
-    if (s_y_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[1], F_y_HLL[1]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[1], F_y_HLL[1]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        F_y_HLL[0] = F_y_B[0];
-        F_y_HLL[1] = F_y_B[1];
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
     
-    if (s_y_T < double(0))
+    double Q_y_BT[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        F_y_HLL[0] = F_y_T[0];
-        F_y_HLL[1] = F_y_T[1];
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei], Q_y_T[ei]);
     }
     
-    if (s_y_star > double(0))
+    double F_y_BT[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[2][idx])/(s_y_B - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_B[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_B[3] + (s_y_star - V_y_B[2][idx])*(V_y_B[0][idx]*s_y_star +
-            V_y_B[3][idx]/(s_y_B - V_y_B[2][idx])));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei]);
-        }
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - V_y_BT[2])/(s_y_BT - s_y_star);
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*V_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*V_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_BT[3] + (s_y_star - V_y_BT[2])*(V_y_BT[0]*s_y_star +
+        V_y_BT[3]/(s_y_BT - V_y_BT[2])));
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[2][idx])/(s_y_T - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_T[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_T[3] + (s_y_star - V_y_T[2][idx])*(V_y_T[0][idx]*s_y_star +
-            V_y_T[3][idx]/(s_y_T - V_y_T[2][idx])));
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei]);
-        }
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -1294,17 +1282,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
     const double v_y_diff = V_y_T[2][idx] - V_y_B[2][idx];
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1339,11 +1321,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double v_y_average = double(1)/double(2)*(V_y_B[2][idx] + V_y_T[2][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[4][idx] - V_y_B[4][idx] + V_y_B[0][idx]*V_y_B[2][idx]*(s_y_B - V_y_B[2][idx]) -
         V_y_T[0][idx]*V_y_T[2][idx]*(s_y_T - V_y_T[2][idx]))/
@@ -1390,51 +1372,58 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
     F_y_HLL[2] = (s_y_T*F_y_B[3] - s_y_B*F_y_T[3] + s_y_T*s_y_B*(Q_y_T[3] - Q_y_B[3]))/
         (s_y_T - s_y_B);
     
-    if (s_y_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_y_B > double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[1], F_y_HLL[1]);
+    F_y_HLL[2] = SIMD_BLEND::blend(mask_supersonic_B, F_y_B[3], F_y_HLL[2]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_T = SIMD_BLEND::getMask(s_y_T < double(0));
+    
+    F_y_HLL[0] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[0], F_y_HLL[0]);
+    F_y_HLL[1] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[1], F_y_HLL[1]);
+    F_y_HLL[2] = SIMD_BLEND::blend(mask_supersonic_T, F_y_T[3], F_y_HLL[2]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_y_HLL[0] = F_y_B[0];
-        F_y_HLL[1] = F_y_B[1];
-        F_y_HLL[2] = F_y_B[3];
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
     
-    if (s_y_T < double(0))
+    double Q_y_BT[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_y_HLL[0] = F_y_T[0];
-        F_y_HLL[1] = F_y_T[1];
-        F_y_HLL[2] = F_y_T[3];
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei], Q_y_T[ei]);
     }
     
-    if (s_y_star > double(0))
+    double F_y_BT[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[2][idx])/(s_y_B - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_B[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_B[3];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_B[4] + (s_y_star - V_y_B[2][idx])*(V_y_B[0][idx]*s_y_star +
-            V_y_B[4][idx]/(s_y_B - V_y_B[2][idx])));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y_HLLC[ei] = F_y_B[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei]);
-        }
+        F_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, F_y_B[ei], F_y_T[ei]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - V_y_BT[2])/(s_y_BT - s_y_star);
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*V_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*V_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*Q_y_BT[3];
+    Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_BT[4] + (s_y_star - V_y_BT[2])*(V_y_BT[0]*s_y_star +
+        V_y_BT[4]/(s_y_BT - V_y_BT[2])));
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[2][idx])/(s_y_T - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_T[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_T[3];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_T[4] + (s_y_star - V_y_T[2][idx])*(V_y_T[0][idx]*s_y_star +
-            V_y_T[4][idx]/(s_y_T - V_y_T[2][idx])));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y_HLLC[ei] = F_y_T[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei]);
-        }
+        F_y_HLLC[ei] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
     
     /*
@@ -1446,17 +1435,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double w_y_diff = V_y_T[3][idx] - V_y_B[3][idx];
     const double vel_mag = sqrt(u_y_diff*u_y_diff + v_y_diff*v_y_diff + w_y_diff*w_y_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(v_y_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(v_y_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1492,11 +1475,11 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double w_z_average = double(1)/double(2)*(V_z_B[3][idx] + V_z_F[3][idx]);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, V_z_B[3][idx] - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, V_z_F[3][idx] + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, V_z_B[3][idx] - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, V_z_F[3][idx] + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (V_z_F[4][idx] - V_z_B[4][idx] + V_z_B[0][idx]*V_z_B[3][idx]*(s_z_B - V_z_B[3][idx]) -
         V_z_F[0][idx]*V_z_F[3][idx]*(s_z_F - V_z_F[3][idx]))/
@@ -1543,51 +1526,58 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
     F_z_HLL[2] = (s_z_F*F_z_B[2] - s_z_B*F_z_F[2] + s_z_F*s_z_B*(Q_z_F[2] - Q_z_B[2]))/
         (s_z_F - s_z_B);
     
-    if (s_z_B > double(0))
+    const SIMD_BLEND::MASK mask_supersonic_B = SIMD_BLEND::getMask(s_z_B > double(0));
+    
+    F_z_HLL[0] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[0], F_z_HLL[0]);
+    F_z_HLL[1] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[1], F_z_HLL[1]);
+    F_z_HLL[2] = SIMD_BLEND::blend(mask_supersonic_B, F_z_B[2], F_z_HLL[2]);
+    
+    const SIMD_BLEND::MASK mask_supersonic_F = SIMD_BLEND::getMask(s_z_F < double(0));
+    
+    F_z_HLL[0] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[0], F_z_HLL[0]);
+    F_z_HLL[1] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[1], F_z_HLL[1]);
+    F_z_HLL[2] = SIMD_BLEND::blend(mask_supersonic_F, F_z_F[2], F_z_HLL[2]);
+    
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double V_z_BF[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_z_HLL[0] = F_z_B[0];
-        F_z_HLL[1] = F_z_B[1];
-        F_z_HLL[2] = F_z_B[2];
+        V_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, V_z_B[ei][idx], V_z_F[ei][idx]);
     }
     
-    if (s_z_F < double(0))
+    double Q_z_BF[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        F_z_HLL[0] = F_z_F[0];
-        F_z_HLL[1] = F_z_F[1];
-        F_z_HLL[2] = F_z_F[2];
+        Q_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_z_B[ei], Q_z_F[ei]);
     }
     
-    if (s_z_star > double(0))
+    double F_z_BF[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_B - V_z_B[3][idx])/(s_z_B - s_z_star);
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*V_z_B[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_B[1];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_B[2];
-        Q_z_star_BF[3] = Chi_z_star_BF*V_z_B[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_B[4] + (s_z_star - V_z_B[3][idx])*(V_z_B[0][idx]*s_z_star +
-            V_z_B[4][idx]/(s_z_B - V_z_B[3][idx])));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z_HLLC[ei] = F_z_B[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_B[ei]);
-        }
+        F_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, F_z_B[ei], F_z_F[ei]);
     }
-    else
+    
+    Chi_z_star_BF = (s_z_BF - V_z_BF[3])/(s_z_BF - s_z_star);
+    
+    Q_z_star_BF[0] = Chi_z_star_BF*V_z_BF[0];
+    Q_z_star_BF[1] = Chi_z_star_BF*Q_z_BF[1];
+    Q_z_star_BF[2] = Chi_z_star_BF*Q_z_BF[2];
+    Q_z_star_BF[3] = Chi_z_star_BF*V_z_BF[0]*s_z_star;
+    Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_BF[4] + (s_z_star - V_z_BF[3])*(V_z_BF[0]*s_z_star +
+        V_z_BF[4]/(s_z_BF - V_z_BF[3])));
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_F - V_z_F[3][idx])/(s_z_F - s_z_star);
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*V_z_F[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_F[1];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_F[2];
-        Q_z_star_BF[3] = Chi_z_star_BF*V_z_F[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_F[4] + (s_z_star - V_z_F[3][idx])*(V_z_F[0][idx]*s_z_star +
-            V_z_F[4][idx]/(s_z_F - V_z_F[3][idx])));
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z_HLLC[ei] = F_z_F[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_F[ei]);
-        }
+        F_z_HLLC[ei] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
     
     /*
@@ -1599,17 +1589,11 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
     const double w_z_diff = V_z_F[3][idx] - V_z_B[3][idx];
     const double vel_mag = sqrt(u_z_diff*u_z_diff + v_z_diff*v_z_diff + w_z_diff*w_z_diff);
     
-    double alpha_1, alpha_2;
-    if (vel_mag < EPSILON)
-    {
-        alpha_1 = double(1);
-        alpha_2 = double(0);
-    }
-    else
-    {
-        alpha_1 = fabs(w_z_diff)/vel_mag;
-        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
-    }
+    const SIMD_BLEND::MASK mask_zero_vel_diff = SIMD_BLEND::getMask(vel_mag < EPSILON);
+    
+    const double alpha_1 = SIMD_BLEND::blend(mask_zero_vel_diff, double(1), fabs(w_z_diff)/vel_mag);
+    const double alpha_2 = SIMD_BLEND::blend(mask_zero_vel_diff, double(0),
+        sqrt(double(1) - alpha_1*alpha_1));
     
     const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
     const double beta_2 = double(1) - beta_1;
@@ -1740,27 +1724,27 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     /*
@@ -1776,15 +1760,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     double* c_x_L = sound_speed_x_L->getPointer(0, 0);
     double* c_x_R = sound_speed_x_R->getPointer(0, 0);
     
-    double u_x_L = double(0);
-    double u_x_R = double(0);
-    
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -1887,6 +1862,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
                     F_x.data(),
                     Q_x_L.data(),
@@ -1904,14 +1883,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     idx_flux,
                     idx);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                    u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -1925,6 +1899,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL1D(
                     F_x.data(),
                     Q_x_L.data(),
@@ -2074,6 +2052,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
                         F_x.data(),
                         Q_x_L.data(),
@@ -2091,14 +2073,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                        u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -2118,6 +2095,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL2D(
                         F_x.data(),
                         Q_x_L.data(),
@@ -2294,6 +2275,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
                             F_x.data(),
                             Q_x_L.data(),
@@ -2311,14 +2296,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                            u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -2345,6 +2325,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC_HLL3D(
                             F_x.data(),
                             Q_x_L.data(),
@@ -2487,27 +2471,27 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     /*
@@ -2523,15 +2507,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     double* c_y_B = sound_speed_y_B->getPointer(1, 0);
     double* c_y_T = sound_speed_y_T->getPointer(1, 0);
     
-    double v_y_B = double(0);
-    double v_y_T = double(0);
-    
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -2670,6 +2645,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
                         F_y.data(),
                         Q_y_B.data(),
@@ -2687,14 +2666,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                        v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -2714,6 +2688,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL2D(
                         F_y.data(),
                         Q_y_B.data(),
@@ -2890,6 +2868,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
                             F_y.data(),
                             Q_y_B.data(),
@@ -2907,14 +2889,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                            v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -2941,6 +2918,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC_HLL3D(
                             F_y.data(),
                             Q_y_B.data(),
@@ -3083,27 +3064,27 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     /*
@@ -3119,15 +3100,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     double* c_z_B = sound_speed_z_B->getPointer(2, 0);
     double* c_z_F = sound_speed_z_F->getPointer(2, 0);
     
-    double w_z_B = double(0);
-    double w_z_F = double(0);
-    
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -3300,6 +3272,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
                             F_z.data(),
                             Q_z_B.data(),
@@ -3317,14 +3293,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = w_z_B + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = w_z_F + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            w_z_B + s_z_minus*(Chi_z_star_BF - double(1)),
+                            w_z_F + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -3351,6 +3322,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC_HLL3D(
                             F_z.data(),
                             Q_z_B.data(),
@@ -3493,19 +3468,19 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     /*
@@ -3518,12 +3493,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     double* epsilon_x_L = internal_energy_x_L->getPointer(0, 0);
     double* epsilon_x_R = internal_energy_x_R->getPointer(0, 0);
     
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -3598,6 +3567,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
                     F_x.data(),
                     V_x_L.data(),
@@ -3613,14 +3585,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     idx_flux,
                     idx);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                    V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -3634,6 +3601,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL1D(
                     F_x.data(),
                     V_x_L.data(),
@@ -3743,6 +3713,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
                         F_x.data(),
                         V_x_L.data(),
@@ -3758,14 +3731,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                        V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -3785,6 +3753,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL2D(
                         F_x.data(),
                         V_x_L.data(),
@@ -3911,6 +3882,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
                             F_x.data(),
                             V_x_L.data(),
@@ -3926,14 +3900,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                            V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -3960,6 +3929,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC_HLL3D(
                             F_x.data(),
                             V_x_L.data(),
@@ -4100,19 +4072,19 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     /*
@@ -4125,12 +4097,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     double* epsilon_y_B = internal_energy_y_B->getPointer(1, 0);
     double* epsilon_y_T = internal_energy_y_T->getPointer(1, 0);
     
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -4231,6 +4197,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
                         F_y.data(),
                         V_y_B.data(),
@@ -4246,14 +4215,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                        V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -4273,6 +4237,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL2D(
                         F_y.data(),
                         V_y_B.data(),
@@ -4399,6 +4366,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
                             F_y.data(),
                             V_y_B.data(),
@@ -4414,14 +4384,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                            V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -4448,6 +4413,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC_HLL3D(
                             F_y.data(),
                             V_y_B.data(),
@@ -4588,19 +4556,19 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     /*
@@ -4613,12 +4581,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     double* epsilon_z_B = internal_energy_z_B->getPointer(2, 0);
     double* epsilon_z_F = internal_energy_z_F->getPointer(2, 0);
     
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -4743,6 +4705,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
                             F_z.data(),
                             V_z_B.data(),
@@ -4758,14 +4723,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = V_z_B[3][idx] + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = V_z_F[3][idx] + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            V_z_B[3][idx] + s_z_minus*(Chi_z_star_BF - double(1)),
+                            V_z_F[3][idx] + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -4792,6 +4752,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC_HLL3D(
                             F_z.data(),
                             V_z_B.data(),
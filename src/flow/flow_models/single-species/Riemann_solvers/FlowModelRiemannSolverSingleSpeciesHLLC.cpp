@@ -28,11 +28,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[1][idx]*(s_x_L - u_x_L) - Q_x_R[1][idx]*(s_x_R - u_x_R))/
@@ -41,41 +41,38 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
     double Q_x_star_LR[3];
     double F_x_LR[3];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[3];
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_L[2][idx] + (s_x_star - u_x_L)*(Q_x_L[0][idx]*s_x_star +
-            p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        F_x_LR[0] = Q_x_L[1][idx];
-        F_x_LR[1] = u_x_L*Q_x_L[1][idx] + p_x_L[idx];
-        F_x_LR[2] = u_x_L*(Q_x_L[2][idx] + p_x_L[idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*Q_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*Q_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - u_x_LR)*(Q_x_LR[0]*s_x_star +
+        p_x_LR/(s_x_LR - u_x_LR)));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = u_x_LR*Q_x_LR[1] + p_x_LR;
+    F_x_LR[2] = u_x_LR*(Q_x_LR[2] + p_x_LR);
+    
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_R[2][idx] + (s_x_star - u_x_R)*(Q_x_R[0][idx]*s_x_star +
-            p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        F_x_LR[0] = Q_x_R[1][idx];
-        F_x_LR[1] = u_x_R*Q_x_R[1][idx] + p_x_R[idx];
-        F_x_LR[2] = u_x_R*(Q_x_R[2][idx] + p_x_R[idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -108,11 +105,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[1][idx]*(s_x_L - u_x_L) - Q_x_R[1][idx]*(s_x_R - u_x_R))/
@@ -121,45 +118,40 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
     double Q_x_star_LR[4];
     double F_x_LR[4];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_L[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_L[3][idx] + (s_x_star - u_x_L)*(Q_x_L[0][idx]*s_x_star +
-            p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        F_x_LR[0] = Q_x_L[1][idx];
-        F_x_LR[1] = u_x_L*Q_x_L[1][idx] + p_x_L[idx];
-        F_x_LR[2] = u_x_L*Q_x_L[2][idx];
-        F_x_LR[3] = u_x_L*(Q_x_L[3][idx] + p_x_L[idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*Q_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*Q_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_LR[3] + (s_x_star - u_x_LR)*(Q_x_LR[0]*s_x_star +
+        p_x_LR/(s_x_LR - u_x_LR)));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = u_x_LR*Q_x_LR[1] + p_x_LR;
+    F_x_LR[2] = u_x_LR*Q_x_LR[2];
+    F_x_LR[3] = u_x_LR*(Q_x_LR[3] + p_x_LR);
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_R[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_R[3][idx] + (s_x_star - u_x_R)*(Q_x_R[0][idx]*s_x_star +
-            p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        F_x_LR[0] = Q_x_R[1][idx];
-        F_x_LR[1] = u_x_R*Q_x_R[1][idx] + p_x_R[idx];
-        F_x_LR[2] = u_x_R*Q_x_R[2][idx];
-        F_x_LR[3] = u_x_R*(Q_x_R[3][idx] + p_x_R[idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -192,11 +184,11 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
     const double u_x_average = double(1)/double(2)*(u_x_L + u_x_R);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, u_x_L - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, u_x_R + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (p_x_R[idx] - p_x_L[idx] +
         Q_x_L[1][idx]*(s_x_L - u_x_L) - Q_x_R[1][idx]*(s_x_R - u_x_R))/
@@ -205,49 +197,42 @@ computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
     double Q_x_star_LR[5];
     double F_x_LR[5];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double u_x_LR = SIMD_BLEND::blend(mask_upwind_L, u_x_L, u_x_R);
+    const double p_x_LR = SIMD_BLEND::blend(mask_upwind_L, p_x_L[idx], p_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double Q_x_LR[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_L - u_x_L)/(s_x_L - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_L[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_L[3][idx];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_L[4][idx] + (s_x_star - u_x_L)*(Q_x_L[0][idx]*s_x_star +
-            p_x_L[idx]/(s_x_L - u_x_L)));
-        
-        F_x_LR[0] = Q_x_L[1][idx];
-        F_x_LR[1] = u_x_L*Q_x_L[1][idx] + p_x_L[idx];
-        F_x_LR[2] = u_x_L*Q_x_L[2][idx];
-        F_x_LR[3] = u_x_L*Q_x_L[3][idx];
-        F_x_LR[4] = u_x_L*(Q_x_L[4][idx] + p_x_L[idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_L[ei][idx]);
-        }
+        Q_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, Q_x_L[ei][idx], Q_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - u_x_LR)/(s_x_LR - s_x_star);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*Q_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*Q_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*Q_x_LR[3];
+    Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_LR[4] + (s_x_star - u_x_LR)*(Q_x_LR[0]*s_x_star +
+        p_x_LR/(s_x_LR - u_x_LR)));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = u_x_LR*Q_x_LR[1] + p_x_LR;
+    F_x_LR[2] = u_x_LR*Q_x_LR[2];
+    F_x_LR[3] = u_x_LR*Q_x_LR[3];
+    F_x_LR[4] = u_x_LR*(Q_x_LR[4] + p_x_LR);
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_R - u_x_R)/(s_x_R - s_x_star);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*Q_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*Q_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_R[2][idx];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_R[3][idx];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_R[4][idx] + (s_x_star - u_x_R)*(Q_x_R[0][idx]*s_x_star +
-            p_x_R[idx]/(s_x_R - u_x_R)));
-        
-        F_x_LR[0] = Q_x_R[1][idx];
-        F_x_LR[1] = u_x_R*Q_x_R[1][idx] + p_x_R[idx];
-        F_x_LR[2] = u_x_R*Q_x_R[2][idx];
-        F_x_LR[3] = u_x_R*Q_x_R[3][idx];
-        F_x_LR[4] = u_x_R*(Q_x_R[4][idx] + p_x_R[idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_R[ei][idx]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -280,11 +265,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[2][idx]*(s_y_B - v_y_B) - Q_y_T[2][idx]*(s_y_T - v_y_T))/
@@ -293,45 +278,40 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
     double Q_y_star_BT[4];
     double F_y_BT[4];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_B[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_B[3][idx] + (s_y_star - v_y_B)*(Q_y_B[0][idx]*s_y_star +
-            p_y_B[idx]/(s_y_B - v_y_B)));
-        
-        F_y_BT[0] = Q_y_B[2][idx];
-        F_y_BT[1] = v_y_B*Q_y_B[1][idx];
-        F_y_BT[2] = v_y_B*Q_y_B[2][idx] + p_y_B[idx];
-        F_y_BT[3] = v_y_B*(Q_y_B[3][idx] + p_y_B[idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*Q_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*Q_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_BT[3] + (s_y_star - v_y_BT)*(Q_y_BT[0]*s_y_star +
+        p_y_BT/(s_y_BT - v_y_BT)));
+    
+    F_y_BT[0] = Q_y_BT[2];
+    F_y_BT[1] = v_y_BT*Q_y_BT[1];
+    F_y_BT[2] = v_y_BT*Q_y_BT[2] + p_y_BT;
+    F_y_BT[3] = v_y_BT*(Q_y_BT[3] + p_y_BT);
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_T[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_T[3][idx] + (s_y_star - v_y_T)*(Q_y_T[0][idx]*s_y_star +
-            p_y_T[idx]/(s_y_T - v_y_T)));
-        
-        F_y_BT[0] = Q_y_T[2][idx];
-        F_y_BT[1] = v_y_T*Q_y_T[1][idx];
-        F_y_BT[2] = v_y_T*Q_y_T[2][idx] + p_y_T[idx];
-        F_y_BT[3] = v_y_T*(Q_y_T[3][idx] + p_y_T[idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -364,11 +344,11 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
     const double v_y_average = double(1)/double(2)*(v_y_B + v_y_T);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, v_y_B - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, v_y_T + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (p_y_T[idx] - p_y_B[idx] +
         Q_y_B[2][idx]*(s_y_B - v_y_B) - Q_y_T[2][idx]*(s_y_T - v_y_T))/
@@ -377,49 +357,42 @@ computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
     double Q_y_star_BT[5];
     double F_y_BT[5];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double v_y_BT = SIMD_BLEND::blend(mask_upwind_B, v_y_B, v_y_T);
+    const double p_y_BT = SIMD_BLEND::blend(mask_upwind_B, p_y_B[idx], p_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double Q_y_BT[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_B - v_y_B)/(s_y_B - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_B[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_B[3][idx];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_B[4][idx] + (s_y_star - v_y_B)*(Q_y_B[0][idx]*s_y_star +
-            p_y_B[idx]/(s_y_B - v_y_B)));
-        
-        F_y_BT[0] = Q_y_B[2][idx];
-        F_y_BT[1] = v_y_B*Q_y_B[1][idx];
-        F_y_BT[2] = v_y_B*Q_y_B[2][idx] + p_y_B[idx];
-        F_y_BT[3] = v_y_B*Q_y_B[3][idx];
-        F_y_BT[4] = v_y_B*(Q_y_B[4][idx] + p_y_B[idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_B[ei][idx]);
-        }
+        Q_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_y_B[ei][idx], Q_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - v_y_BT)/(s_y_BT - s_y_star);
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*Q_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*Q_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*Q_y_BT[3];
+    Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_BT[4] + (s_y_star - v_y_BT)*(Q_y_BT[0]*s_y_star +
+        p_y_BT/(s_y_BT - v_y_BT)));
+    
+    F_y_BT[0] = Q_y_BT[2];
+    F_y_BT[1] = v_y_BT*Q_y_BT[1];
+    F_y_BT[2] = v_y_BT*Q_y_BT[2] + p_y_BT;
+    F_y_BT[3] = v_y_BT*Q_y_BT[3];
+    F_y_BT[4] = v_y_BT*(Q_y_BT[4] + p_y_BT);
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_T - v_y_T)/(s_y_T - s_y_star);
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*Q_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_T[1][idx];
-        Q_y_star_BT[2] = Chi_y_star_BT*Q_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_T[3][idx];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_T[4][idx] + (s_y_star - v_y_T)*(Q_y_T[0][idx]*s_y_star +
-            p_y_T[idx]/(s_y_T - v_y_T)));
-        
-        F_y_BT[0] = Q_y_T[2][idx];
-        F_y_BT[1] = v_y_T*Q_y_T[1][idx];
-        F_y_BT[2] = v_y_T*Q_y_T[2][idx] + p_y_T[idx];
-        F_y_BT[3] = v_y_T*Q_y_T[3][idx];
-        F_y_BT[4] = v_y_T*(Q_y_T[4][idx] + p_y_T[idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_T[ei][idx]);
-        }
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -452,11 +425,11 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
     const double w_z_average = double(1)/double(2)*(w_z_B + w_z_F);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, w_z_B - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, w_z_F + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (p_z_F[idx] - p_z_B[idx] +
         Q_z_B[3][idx]*(s_z_B - w_z_B) - Q_z_F[3][idx]*(s_z_F - w_z_F))/
@@ -465,49 +438,42 @@ computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
     double Q_z_star_BF[5];
     double F_z_BF[5];
     
-    if (s_z_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double w_z_BF = SIMD_BLEND::blend(mask_upwind_B, w_z_B, w_z_F);
+    const double p_z_BF = SIMD_BLEND::blend(mask_upwind_B, p_z_B[idx], p_z_F[idx]);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double Q_z_BF[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_B - w_z_B)/(s_z_B - s_z_star);
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*Q_z_B[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_B[1][idx];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_B[2][idx];
-        Q_z_star_BF[3] = Chi_z_star_BF*Q_z_B[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_B[4][idx] + (s_z_star - w_z_B)*(Q_z_B[0][idx]*s_z_star +
-            p_z_B[idx]/(s_z_B - w_z_B)));
-        
-        F_z_BF[0] = Q_z_B[3][idx];
-        F_z_BF[1] = w_z_B*Q_z_B[1][idx];
-        F_z_BF[2] = w_z_B*Q_z_B[2][idx];
-        F_z_BF[3] = w_z_B*Q_z_B[3][idx] + p_z_B[idx];
-        F_z_BF[4] = w_z_B*(Q_z_B[4][idx] + p_z_B[idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_B[ei][idx]);
-        }
+        Q_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, Q_z_B[ei][idx], Q_z_F[ei][idx]);
     }
-    else
+    
+    Chi_z_star_BF = (s_z_BF - w_z_BF)/(s_z_BF - s_z_star);
+    
+    Q_z_star_BF[0] = Chi_z_star_BF*Q_z_BF[0];
+    Q_z_star_BF[1] = Chi_z_star_BF*Q_z_BF[1];
+    Q_z_star_BF[2] = Chi_z_star_BF*Q_z_BF[2];
+    Q_z_star_BF[3] = Chi_z_star_BF*Q_z_BF[0]*s_z_star;
+    Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_BF[4] + (s_z_star - w_z_BF)*(Q_z_BF[0]*s_z_star +
+        p_z_BF/(s_z_BF - w_z_BF)));
+    
+    F_z_BF[0] = Q_z_BF[3];
+    F_z_BF[1] = w_z_BF*Q_z_BF[1];
+    F_z_BF[2] = w_z_BF*Q_z_BF[2];
+    F_z_BF[3] = w_z_BF*Q_z_BF[3] + p_z_BF;
+    F_z_BF[4] = w_z_BF*(Q_z_BF[4] + p_z_BF);
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_F - w_z_F)/(s_z_F - s_z_star);
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*Q_z_F[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_F[1][idx];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_F[2][idx];
-        Q_z_star_BF[3] = Chi_z_star_BF*Q_z_F[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_F[4][idx] + (s_z_star - w_z_F)*(Q_z_F[0][idx]*s_z_star +
-            p_z_F[idx]/(s_z_F - w_z_F)));
-        
-        F_z_BF[0] = Q_z_F[3][idx];
-        F_z_BF[1] = w_z_F*Q_z_F[1][idx];
-        F_z_BF[2] = w_z_F*Q_z_F[2][idx];
-        F_z_BF[3] = w_z_F*Q_z_F[3][idx] + p_z_F[idx];
-        F_z_BF[4] = w_z_F*(Q_z_F[4][idx] + p_z_F[idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_F[ei][idx]);
-        }
+        F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
 }
 
@@ -535,11 +501,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
     const double u_x_average = double(1)/double(2)*(V_x_L[1][idx] + V_x_R[1][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[2][idx] - V_x_L[2][idx] + V_x_L[0][idx]*V_x_L[1][idx]*(s_x_L - V_x_L[1][idx]) -
         V_x_R[0][idx]*V_x_R[1][idx]*(s_x_R - V_x_R[1][idx]))/
@@ -549,49 +515,42 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
     double Q_x_star_LR[3];
     double F_x_LR[3];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[3];
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[1][idx])/(s_x_L - s_x_star);
-        
-        Q_x_LR[0] = V_x_L[0][idx];
-        Q_x_LR[1] = V_x_L[0][idx]*V_x_L[1][idx];
-        Q_x_LR[2] = V_x_L[0][idx]*(epsilon_x_L[idx] + double(1)/double(2)*V_x_L[1][idx]*V_x_L[1][idx]);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - V_x_L[1][idx])*(V_x_L[0][idx]*s_x_star +
-            V_x_L[2][idx]/(s_x_L - V_x_L[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_L[1][idx] + V_x_L[2][idx];
-        F_x_LR[2] = V_x_L[1][idx]*(Q_x_LR[2] + V_x_L[2][idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[1])/(s_x_LR - s_x_star);
+    
+    Q_x_LR[0] = V_x_LR[0];
+    Q_x_LR[1] = V_x_LR[0]*V_x_LR[1];
+    Q_x_LR[2] = V_x_LR[0]*(epsilon_x_LR + double(1)/double(2)*V_x_LR[1]*V_x_LR[1]);
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*V_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*V_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - V_x_LR[1])*(V_x_LR[0]*s_x_star +
+        V_x_LR[2]/(s_x_LR - V_x_LR[1])));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = Q_x_LR[1]*V_x_LR[1] + V_x_LR[2];
+    F_x_LR[2] = V_x_LR[1]*(Q_x_LR[2] + V_x_LR[2]);
+    
+    for (int ei = 0; ei < 3; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[1][idx])/(s_x_R - s_x_star);
-        
-        Q_x_LR[0] = V_x_R[0][idx];
-        Q_x_LR[1] = V_x_R[0][idx]*V_x_R[1][idx];
-        Q_x_LR[2] = V_x_R[0][idx]*(epsilon_x_R[idx] + double(1)/double(2)*V_x_R[1][idx]*V_x_R[1][idx]);
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*(Q_x_LR[2] + (s_x_star - V_x_R[1][idx])*(V_x_R[0][idx]*s_x_star +
-            V_x_R[2][idx]/(s_x_R - V_x_R[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_R[1][idx] + V_x_R[2][idx];
-        F_x_LR[2] = V_x_R[1][idx]*(Q_x_LR[2] + V_x_R[2][idx]);
-        
-        for (int ei = 0; ei < 3; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -619,11 +578,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
     const double u_x_average = double(1)/double(2)*(V_x_L[1][idx] + V_x_R[1][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[3][idx] - V_x_L[3][idx] + V_x_L[0][idx]*V_x_L[1][idx]*(s_x_L - V_x_L[1][idx]) -
         V_x_R[0][idx]*V_x_R[1][idx]*(s_x_R - V_x_R[1][idx]))/
@@ -633,57 +592,46 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
     double Q_x_star_LR[4];
     double F_x_LR[4];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[1][idx])/(s_x_L - s_x_star);
-        
-        Q_x_LR[0] = V_x_L[0][idx];
-        Q_x_LR[1] = V_x_L[0][idx]*V_x_L[1][idx];
-        Q_x_LR[2] = V_x_L[0][idx]*V_x_L[2][idx];
-        Q_x_LR[3] = V_x_L[0][idx]*(epsilon_x_L[idx] + double(1)/double(2)*(V_x_L[1][idx]*V_x_L[1][idx] +
-            V_x_L[2][idx]*V_x_L[2][idx]));
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_LR[3] + (s_x_star - V_x_L[1][idx])*(V_x_L[0][idx]*s_x_star +
-            V_x_L[3][idx]/(s_x_L - V_x_L[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_L[1][idx] + V_x_L[3][idx];
-        F_x_LR[2] = Q_x_LR[1]*V_x_L[2][idx];
-        F_x_LR[3] = V_x_L[1][idx]*(Q_x_LR[3] + V_x_L[3][idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[1])/(s_x_LR - s_x_star);
+    
+    Q_x_LR[0] = V_x_LR[0];
+    Q_x_LR[1] = V_x_LR[0]*V_x_LR[1];
+    Q_x_LR[2] = V_x_LR[0]*V_x_LR[2];
+    Q_x_LR[3] = V_x_LR[0]*(epsilon_x_LR + double(1)/double(2)*(V_x_LR[1]*V_x_LR[1] +
+        V_x_LR[2]*V_x_LR[2]));
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*V_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*V_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_LR[3] + (s_x_star - V_x_LR[1])*(V_x_LR[0]*s_x_star +
+        V_x_LR[3]/(s_x_LR - V_x_LR[1])));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = Q_x_LR[1]*V_x_LR[1] + V_x_LR[3];
+    F_x_LR[2] = Q_x_LR[1]*V_x_LR[2];
+    F_x_LR[3] = V_x_LR[1]*(Q_x_LR[3] + V_x_LR[3]);
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[1][idx])/(s_x_R - s_x_star);
-        
-        Q_x_LR[0] = V_x_R[0][idx];
-        Q_x_LR[1] = V_x_R[0][idx]*V_x_R[1][idx];
-        Q_x_LR[2] = V_x_R[0][idx]*V_x_R[2][idx];
-        Q_x_LR[3] = V_x_R[0][idx]*(epsilon_x_R[idx] + double(1)/double(2)*(V_x_R[1][idx]*V_x_R[1][idx] +
-            V_x_R[2][idx]*V_x_R[2][idx]));
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*(Q_x_LR[3] + (s_x_star - V_x_R[1][idx])*(V_x_R[0][idx]*s_x_star +
-            V_x_R[3][idx]/(s_x_R - V_x_R[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_R[1][idx] + V_x_R[3][idx];
-        F_x_LR[2] = Q_x_LR[1]*V_x_R[2][idx];
-        F_x_LR[3] = V_x_R[1][idx]*(Q_x_LR[3] + V_x_R[3][idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -711,11 +659,11 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
     const double u_x_average = double(1)/double(2)*(V_x_L[1][idx] + V_x_R[1][idx]);
     const double c_x_average = double(1)/double(2)*(c_x_L[idx] + c_x_R[idx]);
     
-    const double s_x_L = fmin(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
-    const double s_x_R = fmax(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
+    const double s_x_L = SIMD_BLEND::min(u_x_average - c_x_average, V_x_L[1][idx] - c_x_L[idx]);
+    const double s_x_R = SIMD_BLEND::max(u_x_average + c_x_average, V_x_R[1][idx] + c_x_R[idx]);
     
-    s_x_minus = fmin(double(0), s_x_L);
-    s_x_plus  = fmax(double(0), s_x_R);
+    s_x_minus = SIMD_BLEND::min(double(0), s_x_L);
+    s_x_plus  = SIMD_BLEND::max(double(0), s_x_R);
     
     s_x_star = (V_x_R[4][idx] - V_x_L[4][idx] + V_x_L[0][idx]*V_x_L[1][idx]*(s_x_L - V_x_L[1][idx]) -
         V_x_R[0][idx]*V_x_R[1][idx]*(s_x_R - V_x_R[1][idx]))/
@@ -725,63 +673,49 @@ computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
     double Q_x_star_LR[5];
     double F_x_LR[5];
     
-    if (s_x_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_L = SIMD_BLEND::getMask(s_x_star > double(0));
+    
+    const double s_x_LR = SIMD_BLEND::blend(mask_upwind_L, s_x_L, s_x_R);
+    const double epsilon_x_LR = SIMD_BLEND::blend(mask_upwind_L, epsilon_x_L[idx],
+        epsilon_x_R[idx]);
+    const double s_x_minus_plus = SIMD_BLEND::blend(mask_upwind_L, s_x_minus, s_x_plus);
+    
+    double V_x_LR[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_L - V_x_L[1][idx])/(s_x_L - s_x_star);
-        
-        Q_x_LR[0] = V_x_L[0][idx];
-        Q_x_LR[1] = V_x_L[0][idx]*V_x_L[1][idx];
-        Q_x_LR[2] = V_x_L[0][idx]*V_x_L[2][idx];
-        Q_x_LR[3] = V_x_L[0][idx]*V_x_L[3][idx];
-        Q_x_LR[4] = V_x_L[0][idx]*(epsilon_x_L[idx] + double(1)/double(2)*(V_x_L[1][idx]*V_x_L[1][idx] +
-            V_x_L[2][idx]*V_x_L[2][idx] + V_x_L[3][idx]*V_x_L[3][idx]));
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_L[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_L[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_LR[3];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_LR[4] + (s_x_star - V_x_L[1][idx])*(V_x_L[0][idx]*s_x_star +
-            V_x_L[4][idx]/(s_x_L - V_x_L[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_L[1][idx] + V_x_L[4][idx];
-        F_x_LR[2] = Q_x_LR[1]*V_x_L[2][idx];
-        F_x_LR[3] = Q_x_LR[1]*V_x_L[3][idx];
-        F_x_LR[4] = V_x_L[1][idx]*(Q_x_LR[4] + V_x_L[4][idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        V_x_LR[ei] = SIMD_BLEND::blend(mask_upwind_L, V_x_L[ei][idx], V_x_R[ei][idx]);
     }
-    else
+    
+    Chi_x_star_LR = (s_x_LR - V_x_LR[1])/(s_x_LR - s_x_star);
+    
+    Q_x_LR[0] = V_x_LR[0];
+    Q_x_LR[1] = V_x_LR[0]*V_x_LR[1];
+    Q_x_LR[2] = V_x_LR[0]*V_x_LR[2];
+    Q_x_LR[3] = V_x_LR[0]*V_x_LR[3];
+    Q_x_LR[4] = V_x_LR[0]*(epsilon_x_LR + double(1)/double(2)*(V_x_LR[1]*V_x_LR[1] +
+        V_x_LR[2]*V_x_LR[2] + V_x_LR[3]*V_x_LR[3]));
+    
+    Q_x_star_LR[0] = Chi_x_star_LR*V_x_LR[0];
+    Q_x_star_LR[1] = Chi_x_star_LR*V_x_LR[0]*s_x_star;
+    Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
+    Q_x_star_LR[3] = Chi_x_star_LR*Q_x_LR[3];
+    Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_LR[4] + (s_x_star - V_x_LR[1])*(V_x_LR[0]*s_x_star +
+        V_x_LR[4]/(s_x_LR - V_x_LR[1])));
+    
+    F_x_LR[0] = Q_x_LR[1];
+    F_x_LR[1] = Q_x_LR[1]*V_x_LR[1] + V_x_LR[4];
+    F_x_LR[2] = Q_x_LR[1]*V_x_LR[2];
+    F_x_LR[3] = Q_x_LR[1]*V_x_LR[3];
+    F_x_LR[4] = V_x_LR[1]*(Q_x_LR[4] + V_x_LR[4]);
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_x_star_LR = (s_x_R - V_x_R[1][idx])/(s_x_R - s_x_star);
-        
-        Q_x_LR[0] = V_x_R[0][idx];
-        Q_x_LR[1] = V_x_R[0][idx]*V_x_R[1][idx];
-        Q_x_LR[2] = V_x_R[0][idx]*V_x_R[2][idx];
-        Q_x_LR[3] = V_x_R[0][idx]*V_x_R[3][idx];
-        Q_x_LR[4] = V_x_R[0][idx]*(epsilon_x_R[idx] + double(1)/double(2)*(V_x_R[1][idx]*V_x_R[1][idx] +
-            V_x_R[2][idx]*V_x_R[2][idx] + V_x_R[3][idx]*V_x_R[3][idx]));
-        
-        Q_x_star_LR[0] = Chi_x_star_LR*V_x_R[0][idx];
-        Q_x_star_LR[1] = Chi_x_star_LR*V_x_R[0][idx]*s_x_star;
-        Q_x_star_LR[2] = Chi_x_star_LR*Q_x_LR[2];
-        Q_x_star_LR[3] = Chi_x_star_LR*Q_x_LR[3];
-        Q_x_star_LR[4] = Chi_x_star_LR*(Q_x_LR[4] + (s_x_star - V_x_R[1][idx])*(V_x_R[0][idx]*s_x_star +
-            V_x_R[4][idx]/(s_x_R - V_x_R[1][idx])));
-        
-        F_x_LR[0] = Q_x_LR[1];
-        F_x_LR[1] = Q_x_LR[1]*V_x_R[1][idx] + V_x_R[4][idx];
-        F_x_LR[2] = Q_x_LR[1]*V_x_R[2][idx];
-        F_x_LR[3] = Q_x_LR[1]*V_x_R[3][idx];
-        F_x_LR[4] = V_x_R[1][idx]*(Q_x_LR[4] + V_x_R[4][idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_x[ei][idx_flux] = F_x_LR[ei] + s_x_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
-        }
+        F_x[ei][idx_flux] = F_x_LR[ei] + s_x_minus_plus*(Q_x_star_LR[ei] - Q_x_LR[ei]);
     }
 }
 
@@ -809,11 +743,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
     const double v_y_average = double(1)/double(2)*(V_y_B[2][idx] + V_y_T[2][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[3][idx] - V_y_B[3][idx] + V_y_B[0][idx]*V_y_B[2][idx]*(s_y_B - V_y_B[2][idx]) -
         V_y_T[0][idx]*V_y_T[2][idx]*(s_y_T - V_y_T[2][idx]))/
@@ -823,57 +757,46 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
     double Q_y_star_BT[4];
     double F_y_BT[4];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double epsilon_y_BT = SIMD_BLEND::blend(mask_upwind_B, epsilon_y_B[idx],
+        epsilon_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[4];
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[2][idx])/(s_y_B - s_y_star);
-        
-        Q_y_BT[0] = V_y_B[0][idx];
-        Q_y_BT[1] = V_y_B[0][idx]*V_y_B[1][idx];
-        Q_y_BT[2] = V_y_B[0][idx]*V_y_B[2][idx];
-        Q_y_BT[3] = V_y_B[0][idx]*(epsilon_y_B[idx] + double(1)/double(2)*(V_y_B[1][idx]*V_y_B[1][idx] +
-            V_y_B[2][idx]*V_y_B[2][idx]));
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_BT[3] + (s_y_star - V_y_B[2][idx])*(V_y_B[0][idx]*s_y_star +
-            V_y_B[3][idx]/(s_y_B - V_y_B[2][idx])));
-        
-        F_y_BT[0] = Q_y_BT[2];
-        F_y_BT[1] = Q_y_BT[2]*V_y_B[1][idx];
-        F_y_BT[2] = Q_y_BT[2]*V_y_B[2][idx] + V_y_B[3][idx];
-        F_y_BT[3] = V_y_B[2][idx]*(Q_y_BT[3] + V_y_B[3][idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - V_y_BT[2])/(s_y_BT - s_y_star);
+    
+    Q_y_BT[0] = V_y_BT[0];
+    Q_y_BT[1] = V_y_BT[0]*V_y_BT[1];
+    Q_y_BT[2] = V_y_BT[0]*V_y_BT[2];
+    Q_y_BT[3] = V_y_BT[0]*(epsilon_y_BT + double(1)/double(2)*(V_y_BT[1]*V_y_BT[1] +
+        V_y_BT[2]*V_y_BT[2]));
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*V_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*V_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_BT[3] + (s_y_star - V_y_BT[2])*(V_y_BT[0]*s_y_star +
+        V_y_BT[3]/(s_y_BT - V_y_BT[2])));
+    
+    F_y_BT[0] = Q_y_BT[2];
+    F_y_BT[1] = Q_y_BT[2]*V_y_BT[1];
+    F_y_BT[2] = Q_y_BT[2]*V_y_BT[2] + V_y_BT[3];
+    F_y_BT[3] = V_y_BT[2]*(Q_y_BT[3] + V_y_BT[3]);
+    
+    for (int ei = 0; ei < 4; ei++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[2][idx])/(s_y_T - s_y_star);
-        
-        Q_y_BT[0] = V_y_T[0][idx];
-        Q_y_BT[1] = V_y_T[0][idx]*V_y_T[1][idx];
-        Q_y_BT[2] = V_y_T[0][idx]*V_y_T[2][idx];
-        Q_y_BT[3] = V_y_T[0][idx]*(epsilon_y_T[idx] + double(1)/double(2)*(V_y_T[1][idx]*V_y_T[1][idx] +
-            V_y_T[2][idx]*V_y_T[2][idx]));
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*(Q_y_BT[3] + (s_y_star - V_y_T[2][idx])*(V_y_T[0][idx]*s_y_star +
-            V_y_T[3][idx]/(s_y_T - V_y_T[2][idx])));
-        
-        F_y_BT[0] = Q_y_BT[2];
-        F_y_BT[1] = Q_y_BT[2]*V_y_T[1][idx];
-        F_y_BT[2] = Q_y_BT[2]*V_y_T[2][idx] + V_y_T[3][idx];
-        F_y_BT[3] = V_y_T[2][idx]*(Q_y_BT[3] + V_y_T[3][idx]);
-        
-        for (int ei = 0; ei < 4; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -901,11 +824,11 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
     const double v_y_average = double(1)/double(2)*(V_y_B[2][idx] + V_y_T[2][idx]);
     const double c_y_average = double(1)/double(2)*(c_y_B[idx] + c_y_T[idx]);
     
-    const double s_y_B = fmin(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
-    const double s_y_T = fmax(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
+    const double s_y_B = SIMD_BLEND::min(v_y_average - c_y_average, V_y_B[2][idx] - c_y_B[idx]);
+    const double s_y_T = SIMD_BLEND::max(v_y_average + c_y_average, V_y_T[2][idx] + c_y_T[idx]);
     
-    s_y_minus = fmin(double(0), s_y_B);
-    s_y_plus  = fmax(double(0), s_y_T);
+    s_y_minus = SIMD_BLEND::min(double(0), s_y_B);
+    s_y_plus  = SIMD_BLEND::max(double(0), s_y_T);
     
     s_y_star = (V_y_T[4][idx] - V_y_B[4][idx] + V_y_B[0][idx]*V_y_B[2][idx]*(s_y_B - V_y_B[2][idx]) -
         V_y_T[0][idx]*V_y_T[2][idx]*(s_y_T - V_y_T[2][idx]))/
@@ -915,63 +838,49 @@ computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
     double Q_y_star_BT[5];
     double F_y_BT[5];
     
-    if (s_y_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_y_star > double(0));
+    
+    const double s_y_BT = SIMD_BLEND::blend(mask_upwind_B, s_y_B, s_y_T);
+    const double epsilon_y_BT = SIMD_BLEND::blend(mask_upwind_B, epsilon_y_B[idx],
+        epsilon_y_T[idx]);
+    const double s_y_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_y_minus, s_y_plus);
+    
+    double V_y_BT[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_B - V_y_B[2][idx])/(s_y_B - s_y_star);
-        
-        Q_y_BT[0] = V_y_B[0][idx];
-        Q_y_BT[1] = V_y_B[0][idx]*V_y_B[1][idx];
-        Q_y_BT[2] = V_y_B[0][idx]*V_y_B[2][idx];
-        Q_y_BT[3] = V_y_B[0][idx]*V_y_B[3][idx];
-        Q_y_BT[4] = V_y_B[0][idx]*(epsilon_y_B[idx] + double(1)/double(2)*(V_y_B[1][idx]*V_y_B[1][idx] +
-            V_y_B[2][idx]*V_y_B[2][idx] + V_y_B[3][idx]*V_y_B[3][idx]));
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_B[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_B[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_BT[3];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_BT[4] + (s_y_star - V_y_B[2][idx])*(V_y_B[0][idx]*s_y_star +
-            V_y_B[4][idx]/(s_y_B - V_y_B[2][idx])));
-        
-        F_y_BT[0] = Q_y_BT[2];
-        F_y_BT[1] = Q_y_BT[2]*V_y_B[1][idx];
-        F_y_BT[2] = Q_y_BT[2]*V_y_B[2][idx] + V_y_B[4][idx];
-        F_y_BT[3] = Q_y_BT[2]*V_y_B[3][idx];
-        F_y_BT[4] = V_y_B[2][idx]*(Q_y_BT[4] + V_y_B[4][idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        V_y_BT[ei] = SIMD_BLEND::blend(mask_upwind_B, V_y_B[ei][idx], V_y_T[ei][idx]);
     }
-    else
+    
+    Chi_y_star_BT = (s_y_BT - V_y_BT[2])/(s_y_BT - s_y_star);
+    
+    Q_y_BT[0] = V_y_BT[0];
+    Q_y_BT[1] = V_y_BT[0]*V_y_BT[1];
+    Q_y_BT[2] = V_y_BT[0]*V_y_BT[2];
+    Q_y_BT[3] = V_y_BT[0]*V_y_BT[3];
+    Q_y_BT[4] = V_y_BT[0]*(epsilon_y_BT + double(1)/double(2)*(V_y_BT[1]*V_y_BT[1] +
+        V_y_BT[2]*V_y_BT[2] + V_y_BT[3]*V_y_BT[3]));
+    
+    Q_y_star_BT[0] = Chi_y_star_BT*V_y_BT[0];
+    Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
+    Q_y_star_BT[2] = Chi_y_star_BT*V_y_BT[0]*s_y_star;
+    Q_y_star_BT[3] = Chi_y_star_BT*Q_y_BT[3];
+    Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_BT[4] + (s_y_star - V_y_BT[2])*(V_y_BT[0]*s_y_star +
+        V_y_BT[4]/(s_y_BT - V_y_BT[2])));
+    
+    F_y_BT[0] = Q_y_BT[2];
+    F_y_BT[1] = Q_y_BT[2]*V_y_BT[1];
+    F_y_BT[2] = Q_y_BT[2]*V_y_BT[2] + V_y_BT[4];
+    F_y_BT[3] = Q_y_BT[2]*V_y_BT[3];
+    F_y_BT[4] = V_y_BT[2]*(Q_y_BT[4] + V_y_BT[4]);
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_y_star_BT = (s_y_T - V_y_T[2][idx])/(s_y_T - s_y_star);
-        
-        Q_y_BT[0] = V_y_T[0][idx];
-        Q_y_BT[1] = V_y_T[0][idx]*V_y_T[1][idx];
-        Q_y_BT[2] = V_y_T[0][idx]*V_y_T[2][idx];
-        Q_y_BT[3] = V_y_T[0][idx]*V_y_T[3][idx];
-        Q_y_BT[4] = V_y_T[0][idx]*(epsilon_y_T[idx] + double(1)/double(2)*(V_y_T[1][idx]*V_y_T[1][idx] +
-            V_y_T[2][idx]*V_y_T[2][idx] + V_y_T[3][idx]*V_y_T[3][idx]));
-        
-        Q_y_star_BT[0] = Chi_y_star_BT*V_y_T[0][idx];
-        Q_y_star_BT[1] = Chi_y_star_BT*Q_y_BT[1];
-        Q_y_star_BT[2] = Chi_y_star_BT*V_y_T[0][idx]*s_y_star;
-        Q_y_star_BT[3] = Chi_y_star_BT*Q_y_BT[3];
-        Q_y_star_BT[4] = Chi_y_star_BT*(Q_y_BT[4] + (s_y_star - V_y_T[2][idx])*(V_y_T[0][idx]*s_y_star +
-            V_y_T[4][idx]/(s_y_T - V_y_T[2][idx])));
-        
-        F_y_BT[0] = Q_y_BT[2];
-        F_y_BT[1] = Q_y_BT[2]*V_y_T[1][idx];
-        F_y_BT[2] = Q_y_BT[2]*V_y_T[2][idx] + V_y_T[4][idx];
-        F_y_BT[3] = Q_y_BT[2]*V_y_T[3][idx];
-        F_y_BT[4] = V_y_T[2][idx]*(Q_y_BT[4] + V_y_T[4][idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_y[ei][idx_flux] = F_y_BT[ei] + s_y_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
-        }
+        F_y[ei][idx_flux] = F_y_BT[ei] + s_y_minus_plus*(Q_y_star_BT[ei] - Q_y_BT[ei]);
     }
 }
 
@@ -999,11 +908,11 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
     const double w_z_average = double(1)/double(2)*(V_z_B[3][idx] + V_z_F[3][idx]);
     const double c_z_average = double(1)/double(2)*(c_z_B[idx] + c_z_F[idx]);
     
-    const double s_z_B = fmin(w_z_average - c_z_average, V_z_B[3][idx] - c_z_B[idx]);
-    const double s_z_F = fmax(w_z_average + c_z_average, V_z_F[3][idx] + c_z_F[idx]);
+    const double s_z_B = SIMD_BLEND::min(w_z_average - c_z_average, V_z_B[3][idx] - c_z_B[idx]);
+    const double s_z_F = SIMD_BLEND::max(w_z_average + c_z_average, V_z_F[3][idx] + c_z_F[idx]);
     
-    s_z_minus = fmin(double(0), s_z_B);
-    s_z_plus  = fmax(double(0), s_z_F);
+    s_z_minus = SIMD_BLEND::min(double(0), s_z_B);
+    s_z_plus  = SIMD_BLEND::max(double(0), s_z_F);
     
     s_z_star = (V_z_F[4][idx] - V_z_B[4][idx] + V_z_B[0][idx]*V_z_B[3][idx]*(s_z_B - V_z_B[3][idx]) -
         V_z_F[0][idx]*V_z_F[3][idx]*(s_z_F - V_z_F[3][idx]))/
@@ -1013,63 +922,49 @@ computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
     double Q_z_star_BF[5];
     double F_z_BF[5];
     
-    if (s_z_star > double(0))
+    /*
+     * Select the state on the upwind side of the contact wave with masked blends instead of branches
+     * so that the star state is only computed once per face.
+     */
+    
+    const SIMD_BLEND::MASK mask_upwind_B = SIMD_BLEND::getMask(s_z_star > double(0));
+    
+    const double s_z_BF = SIMD_BLEND::blend(mask_upwind_B, s_z_B, s_z_F);
+    const double epsilon_z_BF = SIMD_BLEND::blend(mask_upwind_B, epsilon_z_B[idx],
+        epsilon_z_F[idx]);
+    const double s_z_minus_plus = SIMD_BLEND::blend(mask_upwind_B, s_z_minus, s_z_plus);
+    
+    double V_z_BF[5];
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_B - V_z_B[3][idx])/(s_z_B - s_z_star);
-        
-        Q_z_BF[0] = V_z_B[0][idx];
-        Q_z_BF[1] = V_z_B[0][idx]*V_z_B[1][idx];
-        Q_z_BF[2] = V_z_B[0][idx]*V_z_B[2][idx];
-        Q_z_BF[3] = V_z_B[0][idx]*V_z_B[3][idx];
-        Q_z_BF[4] = V_z_B[0][idx]*(epsilon_z_B[idx] + double(1)/double(2)*(V_z_B[1][idx]*V_z_B[1][idx] +
-            V_z_B[2][idx]*V_z_B[2][idx] + V_z_B[3][idx]*V_z_B[3][idx]));
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*V_z_B[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_BF[1];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_BF[2];
-        Q_z_star_BF[3] = Chi_z_star_BF*V_z_B[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_BF[4] + (s_z_star - V_z_B[3][idx])*(V_z_B[0][idx]*s_z_star +
-            V_z_B[4][idx]/(s_z_B - V_z_B[3][idx])));
-        
-        F_z_BF[0] = Q_z_BF[3];
-        F_z_BF[1] = Q_z_BF[3]*V_z_B[1][idx];
-        F_z_BF[2] = Q_z_BF[3]*V_z_B[2][idx];
-        F_z_BF[3] = Q_z_BF[3]*V_z_B[3][idx] + V_z_B[4][idx];
-        F_z_BF[4] = V_z_B[3][idx]*(Q_z_BF[4] + V_z_B[4][idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
-        }
+        V_z_BF[ei] = SIMD_BLEND::blend(mask_upwind_B, V_z_B[ei][idx], V_z_F[ei][idx]);
     }
-    else
+    
+    Chi_z_star_BF = (s_z_BF - V_z_BF[3])/(s_z_BF - s_z_star);
+    
+    Q_z_BF[0] = V_z_BF[0];
+    Q_z_BF[1] = V_z_BF[0]*V_z_BF[1];
+    Q_z_BF[2] = V_z_BF[0]*V_z_BF[2];
+    Q_z_BF[3] = V_z_BF[0]*V_z_BF[3];
+    Q_z_BF[4] = V_z_BF[0]*(epsilon_z_BF + double(1)/double(2)*(V_z_BF[1]*V_z_BF[1] +
+        V_z_BF[2]*V_z_BF[2] + V_z_BF[3]*V_z_BF[3]));
+    
+    Q_z_star_BF[0] = Chi_z_star_BF*V_z_BF[0];
+    Q_z_star_BF[1] = Chi_z_star_BF*Q_z_BF[1];
+    Q_z_star_BF[2] = Chi_z_star_BF*Q_z_BF[2];
+    Q_z_star_BF[3] = Chi_z_star_BF*V_z_BF[0]*s_z_star;
+    Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_BF[4] + (s_z_star - V_z_BF[3])*(V_z_BF[0]*s_z_star +
+        V_z_BF[4]/(s_z_BF - V_z_BF[3])));
+    
+    F_z_BF[0] = Q_z_BF[3];
+    F_z_BF[1] = Q_z_BF[3]*V_z_BF[1];
+    F_z_BF[2] = Q_z_BF[3]*V_z_BF[2];
+    F_z_BF[3] = Q_z_BF[3]*V_z_BF[3] + V_z_BF[4];
+    F_z_BF[4] = V_z_BF[3]*(Q_z_BF[4] + V_z_BF[4]);
+    
+    for (int ei = 0; ei < 5; ei++)
     {
-        Chi_z_star_BF = (s_z_F - V_z_F[3][idx])/(s_z_F - s_z_star);
-        
-        Q_z_BF[0] = V_z_F[0][idx];
-        Q_z_BF[1] = V_z_F[0][idx]*V_z_F[1][idx];
-        Q_z_BF[2] = V_z_F[0][idx]*V_z_F[2][idx];
-        Q_z_BF[3] = V_z_F[0][idx]*V_z_F[3][idx];
-        Q_z_BF[4] = V_z_F[0][idx]*(epsilon_z_F[idx] + double(1)/double(2)*(V_z_F[1][idx]*V_z_F[1][idx] +
-            V_z_F[2][idx]*V_z_F[2][idx] + V_z_F[3][idx]*V_z_F[3][idx]));
-        
-        Q_z_star_BF[0] = Chi_z_star_BF*V_z_F[0][idx];
-        Q_z_star_BF[1] = Chi_z_star_BF*Q_z_BF[1];
-        Q_z_star_BF[2] = Chi_z_star_BF*Q_z_BF[2];
-        Q_z_star_BF[3] = Chi_z_star_BF*V_z_F[0][idx]*s_z_star;
-        Q_z_star_BF[4] = Chi_z_star_BF*(Q_z_BF[4] + (s_z_star - V_z_F[3][idx])*(V_z_F[0][idx]*s_z_star +
-            V_z_F[4][idx]/(s_z_F - V_z_F[3][idx])));
-        
-        F_z_BF[0] = Q_z_BF[3];
-        F_z_BF[1] = Q_z_BF[3]*V_z_F[1][idx];
-        F_z_BF[2] = Q_z_BF[3]*V_z_F[2][idx];
-        F_z_BF[3] = Q_z_BF[3]*V_z_F[3][idx] + V_z_F[4][idx];
-        F_z_BF[4] = V_z_F[3][idx]*(Q_z_BF[4] + V_z_F[4][idx]);
-        
-        for (int ei = 0; ei < 5; ei++)
-        {
-            F_z[ei][idx_flux] = F_z_BF[ei] + s_z_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
-        }
+        F_z[ei][idx_flux] = F_z_BF[ei] + s_z_minus_plus*(Q_z_star_BF[ei] - Q_z_BF[ei]);
     }
 }
 
@@ -1192,27 +1087,27 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_x));
     
     /*
@@ -1228,15 +1123,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     double* c_x_L = sound_speed_x_L->getPointer(0, 0);
     double* c_x_R = sound_speed_x_R->getPointer(0, 0);
     
-    double u_x_L = double(0);
-    double u_x_R = double(0);
-    
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -1339,6 +1225,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
                     F_x.data(),
                     Q_x_L.data(),
@@ -1356,14 +1246,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     idx_flux,
                     idx);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                    u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -1377,6 +1262,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_conservative_variables;
                 
+                double u_x_L, u_x_R;
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC1D(
                     F_x.data(),
                     Q_x_L.data(),
@@ -1526,6 +1415,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
                         F_x.data(),
                         Q_x_L.data(),
@@ -1543,14 +1436,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                        u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -1570,6 +1458,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double u_x_L, u_x_R;
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC2D(
                         F_x.data(),
                         Q_x_L.data(),
@@ -1746,6 +1638,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
                             F_x.data(),
                             Q_x_L.data(),
@@ -1763,14 +1659,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = u_x_L + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = u_x_R + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            u_x_L + s_x_minus*(Chi_x_star_LR - double(1)),
+                            u_x_R + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -1797,6 +1688,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double u_x_L, u_x_R;
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromConservativeVariablesHLLC3D(
                             F_x.data(),
                             Q_x_L.data(),
@@ -1939,27 +1834,27 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_y));
     
     /*
@@ -1975,15 +1870,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     double* c_y_B = sound_speed_y_B->getPointer(1, 0);
     double* c_y_T = sound_speed_y_T->getPointer(1, 0);
     
-    double v_y_B = double(0);
-    double v_y_T = double(0);
-    
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -2122,6 +2008,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
                         F_y.data(),
                         Q_y_B.data(),
@@ -2139,14 +2029,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                        v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -2166,6 +2051,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_conservative_variables) +
                         (j + num_ghosts_1_conservative_variables)*ghostcell_dim_0_conservative_variables;
                     
+                    double v_y_B, v_y_T;
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC2D(
                         F_y.data(),
                         Q_y_B.data(),
@@ -2342,6 +2231,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
                             F_y.data(),
                             Q_y_B.data(),
@@ -2359,14 +2252,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = v_y_B + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = v_y_T + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            v_y_B + s_y_minus*(Chi_y_star_BT - double(1)),
+                            v_y_T + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -2393,6 +2281,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double v_y_B, v_y_T;
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromConservativeVariablesHLLC3D(
                             F_y.data(),
                             Q_y_B.data(),
@@ -2535,27 +2427,27 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > pressure_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_conservative_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_conservative_variables,
             direction_z));
     
     /*
@@ -2571,15 +2463,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     double* c_z_B = sound_speed_z_B->getPointer(2, 0);
     double* c_z_F = sound_speed_z_F->getPointer(2, 0);
     
-    double w_z_B = double(0);
-    double w_z_F = double(0);
-    
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -2752,6 +2635,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
                             F_z.data(),
                             Q_z_B.data(),
@@ -2769,14 +2656,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = w_z_B + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = w_z_F + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            w_z_B + s_z_minus*(Chi_z_star_BF - double(1)),
+                            w_z_F + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -2803,6 +2685,10 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_conservative_variables)*ghostcell_dim_0_conservative_variables*
                                 ghostcell_dim_1_conservative_variables;
                         
+                        double w_z_B, w_z_F;
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromConservativeVariablesHLLC3D(
                             F_z.data(),
                             Q_z_B.data(),
@@ -2945,19 +2831,19 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     direction_x[0] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_L(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_x_R(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_x));
     
     /*
@@ -2970,12 +2856,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
     double* epsilon_x_L = internal_energy_x_L->getPointer(0, 0);
     double* epsilon_x_R = internal_energy_x_R->getPointer(0, 0);
     
-    double s_x_minus = double(0);
-    double s_x_plus  = double(0);
-    double s_x_star  = double(0);
-    
-    double Chi_x_star_LR = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         /*
@@ -3050,6 +2930,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_velocity = i + num_ghosts_0_velocity;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
                     F_x.data(),
                     V_x_L.data(),
@@ -3065,14 +2948,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     idx_flux,
                     idx);
                 
-                if (s_x_star > double(0))
-                {
-                    u[idx_velocity] = V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                }
-                else
-                {
-                    u[idx_velocity] = V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                }
+                u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                    V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                    V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
             }
         }
         else
@@ -3086,6 +2964,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                 const int idx_flux = i + num_ghosts_0_convective_flux;
                 const int idx = i + num_ghosts_0_primitive_variables;
                 
+                double s_x_minus, s_x_plus, s_x_star;
+                double Chi_x_star_LR;
+                
                 computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC1D(
                     F_x.data(),
                     V_x_L.data(),
@@ -3195,6 +3076,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
                         F_x.data(),
                         V_x_L.data(),
@@ -3210,14 +3094,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_x_star > double(0))
-                    {
-                        u[idx_velocity] = V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                    }
-                    else
-                    {
-                        u[idx_velocity] = V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                    }
+                    u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                        V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                        V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                 }
             }
         }
@@ -3237,6 +3116,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_x_minus, s_x_plus, s_x_star;
+                    double Chi_x_star_LR;
+                    
                     computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC2D(
                         F_x.data(),
                         V_x_L.data(),
@@ -3363,6 +3245,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
                             F_x.data(),
                             V_x_L.data(),
@@ -3378,14 +3263,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_x_star > double(0))
-                        {
-                            u[idx_velocity] = V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1));
-                        }
-                        else
-                        {
-                            u[idx_velocity] = V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1));
-                        }
+                        u[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_x_star > double(0)),
+                            V_x_L[1][idx] + s_x_minus*(Chi_x_star_LR - double(1)),
+                            V_x_R[1][idx] + s_x_plus*(Chi_x_star_LR - double(1)));
                     }
                 }
             }
@@ -3412,6 +3292,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInXDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_x_minus, s_x_plus, s_x_star;
+                        double Chi_x_star_LR;
+                        
                         computeLocalConvectiveFluxInXDirectionFromPrimitiveVariablesHLLC3D(
                             F_x.data(),
                             V_x_L.data(),
@@ -3552,19 +3435,19 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     direction_y[1] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_y_T(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_y));
     
     /*
@@ -3577,12 +3460,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
     double* epsilon_y_B = internal_energy_y_B->getPointer(1, 0);
     double* epsilon_y_T = internal_energy_y_T->getPointer(1, 0);
     
-    double s_y_minus = double(0);
-    double s_y_plus  = double(0);
-    double s_y_star  = double(0);
-    
-    double Chi_y_star_BT = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -3683,6 +3560,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
                         F_y.data(),
                         V_y_B.data(),
@@ -3698,14 +3578,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                         idx_flux,
                         idx);
                     
-                    if (s_y_star > double(0))
-                    {
-                        v[idx_velocity] = V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                    }
-                    else
-                    {
-                        v[idx_velocity] = V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                    }
+                    v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                        V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                        V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                 }
             }
         }
@@ -3725,6 +3600,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                     const int idx = (i + num_ghosts_0_primitive_variables) +
                         (j + num_ghosts_1_primitive_variables)*ghostcell_dim_0_primitive_variables;
                     
+                    double s_y_minus, s_y_plus, s_y_star;
+                    double Chi_y_star_BT;
+                    
                     computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC2D(
                         F_y.data(),
                         V_y_B.data(),
@@ -3851,6 +3729,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
                             F_y.data(),
                             V_y_B.data(),
@@ -3866,14 +3747,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_y_star > double(0))
-                        {
-                            v[idx_velocity] = V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1));
-                        }
-                        else
-                        {
-                            v[idx_velocity] = V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1));
-                        }
+                        v[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_y_star > double(0)),
+                            V_y_B[2][idx] + s_y_minus*(Chi_y_star_BT - double(1)),
+                            V_y_T[2][idx] + s_y_plus*(Chi_y_star_BT - double(1)));
                     }
                 }
             }
@@ -3900,6 +3776,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInYDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_y_minus, s_y_plus, s_y_star;
+                        double Chi_y_star_BT;
+                        
                         computeLocalConvectiveFluxInYDirectionFromPrimitiveVariablesHLLC3D(
                             F_y.data(),
                             V_y_B.data(),
@@ -4040,19 +3919,19 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     direction_z[2] = 1;
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_B(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
 
     HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy_z_F(
-        new pdat::SideData<double>(interior_box, 1, num_ghosts_primitive_variables,
+        d_scratch_arena->getSideData(interior_box, 1, num_ghosts_primitive_variables,
             direction_z));
     
     /*
@@ -4065,12 +3944,6 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
     double* epsilon_z_B = internal_energy_z_B->getPointer(2, 0);
     double* epsilon_z_F = internal_energy_z_F->getPointer(2, 0);
     
-    double s_z_minus = double(0);
-    double s_z_plus  = double(0);
-    double s_z_star  = double(0);
-    
-    double Chi_z_star_BF = double(0);
-    
     if (d_dim == tbox::Dimension(1))
     {
         TBOX_ERROR(d_object_name
@@ -4195,6 +4068,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
                             F_z.data(),
                             V_z_B.data(),
@@ -4210,14 +4086,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             idx_flux,
                             idx);
                         
-                        if (s_z_star > double(0))
-                        {
-                            w[idx_velocity] = V_z_B[3][idx] + s_z_minus*(Chi_z_star_BF - double(1));
-                        }
-                        else
-                        {
-                            w[idx_velocity] = V_z_F[3][idx] + s_z_plus*(Chi_z_star_BF - double(1));
-                        }
+                        w[idx_velocity] = SIMD_BLEND::blend(SIMD_BLEND::getMask(s_z_star > double(0)),
+                            V_z_B[3][idx] + s_z_minus*(Chi_z_star_BF - double(1)),
+                            V_z_F[3][idx] + s_z_plus*(Chi_z_star_BF - double(1)));
                     }
                 }
             }
@@ -4244,6 +4115,9 @@ FlowModelRiemannSolverSingleSpecies::computeConvectiveFluxAndVelocityInZDirectio
                             (k + num_ghosts_2_primitive_variables)*ghostcell_dim_0_primitive_variables*
                                 ghostcell_dim_1_primitive_variables;
                         
+                        double s_z_minus, s_z_plus, s_z_star;
+                        double Chi_z_star_BF;
+                        
                         computeLocalConvectiveFluxInZDirectionFromPrimitiveVariablesHLLC3D(
                             F_z.data(),
                             V_z_B.data(),
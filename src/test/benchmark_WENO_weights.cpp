@@ -0,0 +1,186 @@
+#include "HAMeRS_config.hpp"
+
+#include "flow/convective_flux_reconstructors/WCNS56/WCNS56NonlinearWeights.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/*
+ * Benchmark of the nonlinear weights of the WCNS schemes with the exponents known at run time against
+ * the weights with the exponents fixed at compile time. The weights are computed with the routines
+ * used by ConvectiveFluxReconstructorWCNS5-JS-HLLC-HLL (exponent p) and by the central part of
+ * ConvectiveFluxReconstructorWCNS6-LD-HLLC-HLL (exponent q) on a line of faces with random smoothness
+ * indicators.
+ */
+
+static const int s_num_faces = 4096;
+static const int s_num_repeats = 2000;
+
+
+/*
+ * Compute the WCNS5-JS weights on a line of faces.
+ */
+template<int P>
+static void computeWeightsJS(
+    double* omega,
+    double** beta,
+    const int num_faces,
+    const int p)
+{
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int idx_face = 0; idx_face < num_faces; idx_face++)
+    {
+        double omega_0, omega_1, omega_2;
+        
+        computeWeightsWCNS5JS<P>(omega_0, omega_1, omega_2,
+            beta[0][idx_face], beta[1][idx_face], beta[2][idx_face], p);
+        
+        omega[idx_face] = omega_0;
+    }
+}
+
+
+/*
+ * Compute the central WCNS6-LD weights on a line of faces.
+ */
+template<int Q>
+static void computeWeightsLD(
+    double* omega,
+    double** beta,
+    const int num_faces,
+    const int q,
+    const double C)
+{
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int idx_face = 0; idx_face < num_faces; idx_face++)
+    {
+        double omega_0, omega_1, omega_2, omega_3;
+        double beta_avg, tau_6;
+        
+        computeCentralWeightsWCNS6LD<Q>(omega_0, omega_1, omega_2, omega_3, beta_avg, tau_6,
+            beta[0][idx_face], beta[1][idx_face], beta[2][idx_face], beta[3][idx_face], q, C);
+        
+        omega[idx_face] = omega_0;
+    }
+}
+
+
+/*
+ * Time a kernel in nanoseconds per face.
+ */
+template<typename Kernel>
+static double timeKernel(Kernel kernel, double* omega, double** beta)
+{
+    const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+    
+    for (int r = 0; r < s_num_repeats; r++)
+    {
+        kernel(omega, beta);
+    }
+    
+    const std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+    
+    return std::chrono::duration<double, std::nano>(end - start).count()/(double(s_num_repeats)*s_num_faces);
+}
+
+
+/*
+ * Function objects of the kernels passed to the timer.
+ */
+template<int P>
+struct KernelJS
+{
+    KernelJS(const int p): d_p(p) {}
+    void operator()(double* omega, double** beta) const { computeWeightsJS<P>(omega, beta, s_num_faces, d_p); }
+    const int d_p;
+};
+
+
+template<int Q>
+struct KernelLD
+{
+    KernelLD(const int q): d_q(q) {}
+    void operator()(double* omega, double** beta) const { computeWeightsLD<Q>(omega, beta, s_num_faces, d_q, double(1.0e9)); }
+    const int d_q;
+};
+
+
+int main(int argc, char *argv[])
+{
+    (void)argc;
+    (void)argv;
+    
+    std::vector<std::vector<double> > beta_data(4, std::vector<double>(s_num_faces));
+    std::vector<double> omega_runtime(s_num_faces);
+    std::vector<double> omega_compile_time(s_num_faces);
+    
+    std::srand(1);
+    for (int m = 0; m < 4; m++)
+    {
+        for (int idx_face = 0; idx_face < s_num_faces; idx_face++)
+        {
+            beta_data[m][idx_face] = double(std::rand())/double(RAND_MAX);
+        }
+    }
+    
+    double* beta[4];
+    for (int m = 0; m < 4; m++)
+    {
+        beta[m] = beta_data[m].data();
+    }
+    
+    bool is_consistent = true;
+    
+    /*
+     * WCNS5-JS weights with p = 2.
+     */
+    
+    const double t_JS_runtime = timeKernel(KernelJS<0>(2), omega_runtime.data(), beta);
+    const double t_JS_compile_time = timeKernel(KernelJS<2>(2), omega_compile_time.data(), beta);
+    
+    for (int idx_face = 0; idx_face < s_num_faces; idx_face++)
+    {
+        is_consistent = is_consistent && (omega_runtime[idx_face] == omega_compile_time[idx_face]);
+    }
+    
+    std::cout << "WCNS5-JS weights (p = 2): "
+              << t_JS_runtime << " ns/face with run-time exponent, "
+              << t_JS_compile_time << " ns/face with compile-time exponent, speedup = "
+              << t_JS_runtime/t_JS_compile_time << std::endl;
+    
+    /*
+     * WCNS6-LD central weights with q = 4.
+     */
+    
+    const double t_LD_runtime = timeKernel(KernelLD<0>(4), omega_runtime.data(), beta);
+    const double t_LD_compile_time = timeKernel(KernelLD<4>(4), omega_compile_time.data(), beta);
+    
+    for (int idx_face = 0; idx_face < s_num_faces; idx_face++)
+    {
+        is_consistent = is_consistent && (omega_runtime[idx_face] == omega_compile_time[idx_face]);
+    }
+    
+    std::cout << "WCNS6-LD central weights (q = 4): "
+              << t_LD_runtime << " ns/face with run-time exponent, "
+              << t_LD_compile_time << " ns/face with compile-time exponent, speedup = "
+              << t_LD_runtime/t_LD_compile_time << std::endl;
+    
+    if (is_consistent)
+    {
+        std::cout << "Weights with compile-time exponents are identical to weights with run-time exponents!" << std::endl;
+    }
+    else
+    {
+        std::cout << "Weights with compile-time exponents differ from weights with run-time exponents!" << std::endl;
+        return 1;
+    }
+    
+    return 0;
+}
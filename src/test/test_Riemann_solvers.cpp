@@ -0,0 +1,912 @@
+#include "HAMeRS_config.hpp"
+
+#include "flow/flow_models/FlowModels.hpp"
+#include "flow/flow_models/five-eqn_Allaire/FlowModelFiveEqnAllaire.hpp"
+#include "flow/flow_models/four-eqn_conservative/FlowModelFourEqnConservative.hpp"
+#include "flow/flow_models/single-species/FlowModelSingleSpecies.hpp"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/Index.h"
+#include "SAMRAI/pdat/SideData.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/InputDatabase.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/SAMRAIManager.h"
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace SAMRAI;
+
+/*
+ * Reference HLLC and HLLC-HLL fluxes and velocity of a face of the flow models. This is the
+ * formulation branching on the wave speeds that the flow models used before the states were
+ * selected with masked blends, written for any flow model, dimension and direction with the
+ * floating-point operations in the same order as in the flow models. W[0] and W[1] are the
+ * conservative or primitive variables on the left and right sides of the face and rho, p, c and
+ * epsilon are the density, pressure, sound speed and internal energy on both sides. The internal
+ * energy is only used with the primitive variables.
+ */
+static void
+computeReferenceConvectiveFlux(
+    std::vector<double>& F,
+    double& vel_face,
+    const std::vector<std::vector<double> >& W,
+    const std::vector<double>& rho,
+    const std::vector<double>& p,
+    const std::vector<double>& c,
+    const std::vector<double>& epsilon,
+    const FLOW_MODEL::TYPE& flow_model_type,
+    const int& num_species,
+    const int& dim,
+    const int& direction,
+    const RIEMANN_SOLVER::TYPE& riemann_solver_type,
+    const bool& use_primitive_variables)
+{
+    const bool is_single_species = (flow_model_type == FLOW_MODEL::SINGLE_SPECIES);
+    
+    const int num_densities = is_single_species ? 1 : num_species;
+    const int num_volume_fractions =
+        (flow_model_type == FLOW_MODEL::FIVE_EQN_ALLAIRE) ? num_species - 1 : 0;
+    const int num_eqn = num_densities + dim + 1 + num_volume_fractions;
+    
+    const int idx_momentum = num_densities;
+    const int idx_normal_momentum = num_densities + direction;
+    const int idx_energy = num_densities + dim;
+    const int idx_volume_fractions = num_densities + dim + 1;
+    
+    /*
+     * Compute the conservative variables, velocity and physical fluxes on both sides.
+     */
+    
+    std::vector<std::vector<double> > Q(2, std::vector<double>(num_eqn));
+    std::vector<std::vector<double> > F_LR(2, std::vector<double>(num_eqn));
+    std::vector<std::vector<double> > vel(2, std::vector<double>(dim));
+    
+    for (int k = 0; k < 2; k++)
+    {
+        if (use_primitive_variables)
+        {
+            for (int si = 0; si < num_densities; si++)
+            {
+                Q[k][si] = W[k][si];
+            }
+            
+            double vel_sq = double(0);
+            for (int di = 0; di < dim; di++)
+            {
+                vel[k][di] = W[k][idx_momentum + di];
+                Q[k][idx_momentum + di] = rho[k]*vel[k][di];
+                vel_sq += vel[k][di]*vel[k][di];
+            }
+            Q[k][idx_energy] = rho[k]*(epsilon[k] + double(1)/double(2)*vel_sq);
+            
+            for (int si = 0; si < num_volume_fractions; si++)
+            {
+                Q[k][idx_volume_fractions + si] = W[k][idx_volume_fractions + si];
+            }
+        }
+        else
+        {
+            Q[k] = W[k];
+            
+            for (int di = 0; di < dim; di++)
+            {
+                vel[k][di] = Q[k][idx_momentum + di]/rho[k];
+            }
+        }
+        
+        const double u_n = vel[k][direction];
+        
+        for (int si = 0; si < num_densities; si++)
+        {
+            F_LR[k][si] = is_single_species ? Q[k][idx_normal_momentum] : u_n*Q[k][si];
+        }
+        for (int di = 0; di < dim; di++)
+        {
+            F_LR[k][idx_momentum + di] = (is_single_species && use_primitive_variables) ?
+                Q[k][idx_normal_momentum]*vel[k][di] : u_n*Q[k][idx_momentum + di];
+        }
+        F_LR[k][idx_normal_momentum] += p[k];
+        F_LR[k][idx_energy] = u_n*(Q[k][idx_energy] + p[k]);
+        for (int si = 0; si < num_volume_fractions; si++)
+        {
+            F_LR[k][idx_volume_fractions + si] = u_n*Q[k][idx_volume_fractions + si];
+        }
+    }
+    
+    /*
+     * Compute the wave speeds.
+     */
+    
+    const double u_L = vel[0][direction];
+    const double u_R = vel[1][direction];
+    
+    const double u_average = double(1)/double(2)*(u_L + u_R);
+    const double c_average = double(1)/double(2)*(c[0] + c[1]);
+    
+    const double s_L = fmin(u_average - c_average, u_L - c[0]);
+    const double s_R = fmax(u_average + c_average, u_R + c[1]);
+    
+    const double s_minus = fmin(double(0), s_L);
+    const double s_plus  = fmax(double(0), s_R);
+    
+    const double s_star = (p[1] - p[0] +
+        Q[0][idx_normal_momentum]*(s_L - u_L) - Q[1][idx_normal_momentum]*(s_R - u_R))/
+        (rho[0]*(s_L - u_L) - rho[1]*(s_R - u_R));
+    
+    /*
+     * Compute the HLLC flux from the star state on the upwind side of the contact wave.
+     */
+    
+    int k;
+    double s_K, u_K, s_minus_plus;
+    if (s_star > double(0))
+    {
+        k = 0;
+        s_K = s_L;
+        u_K = u_L;
+        s_minus_plus = s_minus;
+    }
+    else
+    {
+        k = 1;
+        s_K = s_R;
+        u_K = u_R;
+        s_minus_plus = s_plus;
+    }
+    
+    const double Chi_star = (s_K - u_K)/(s_K - s_star);
+    
+    std::vector<double> Q_star(num_eqn);
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        Q_star[ei] = Chi_star*Q[k][ei];
+    }
+    Q_star[idx_normal_momentum] = Chi_star*rho[k]*s_star;
+    Q_star[idx_energy] = Chi_star*(Q[k][idx_energy] +
+        (s_star - u_K)*(rho[k]*s_star + p[k]/(s_K - u_K)));
+    
+    std::vector<double> F_HLLC(num_eqn);
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        F_HLLC[ei] = F_LR[k][ei] + s_minus_plus*(Q_star[ei] - Q[k][ei]);
+    }
+    
+    vel_face = u_K + s_minus_plus*(Chi_star - double(1));
+    
+    if (riemann_solver_type == RIEMANN_SOLVER::HLLC || dim == 1)
+    {
+        F = F_HLLC;
+        
+        return;
+    }
+    
+    /*
+     * Hybridize the HLLC flux with the HLL flux except for the normal momentum and the total energy.
+     */
+    
+    double vel_mag_sq = double(0);
+    for (int di = 0; di < dim; di++)
+    {
+        const double vel_diff = vel[1][di] - vel[0][di];
+        vel_mag_sq += vel_diff*vel_diff;
+    }
+    const double vel_mag = sqrt(vel_mag_sq);
+    
+    double alpha_1, alpha_2;
+    if (vel_mag < HAMERS_EPSILON)
+    {
+        alpha_1 = double(1);
+        alpha_2 = double(0);
+    }
+    else
+    {
+        alpha_1 = fabs(u_R - u_L)/vel_mag;
+        alpha_2 = sqrt(double(1) - alpha_1*alpha_1);
+    }
+    
+    const double beta_1 = double(1)/double(2)*(double(1) + alpha_1/(alpha_1 + alpha_2));
+    const double beta_2 = double(1) - beta_1;
+    
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        if (ei == idx_normal_momentum || ei == idx_energy)
+        {
+            F[ei] = F_HLLC[ei];
+        }
+        else
+        {
+            double F_HLL = (s_R*F_LR[0][ei] - s_L*F_LR[1][ei] + s_R*s_L*(Q[1][ei] - Q[0][ei]))/
+                (s_R - s_L);
+            
+            if (s_L > double(0))
+            {
+                F_HLL = F_LR[0][ei];
+            }
+            
+            if (s_R < double(0))
+            {
+                F_HLL = F_LR[1][ei];
+            }
+            
+            F[ei] = beta_1*F_HLLC[ei] + beta_2*F_HLL;
+        }
+    }
+}
+
+
+/*
+ * Compute the density, pressure, sound speed and internal energy on the faces in the same way as
+ * the Riemann solvers of the flow models.
+ */
+static void
+computeThermodynamicFields(
+    std::vector<double>& rho,
+    std::vector<double>& p,
+    std::vector<double>& c,
+    std::vector<double>& epsilon,
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model,
+    const FLOW_MODEL::TYPE& flow_model_type,
+    const std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables,
+    const bool& use_primitive_variables,
+    const int& direction,
+    const int& num_faces)
+{
+    const tbox::Dimension& dim = variables[0]->getDim();
+    const int num_species = flow_model->getNumberOfSpecies();
+    const int num_eqn = flow_model->getNumberOfEquations();
+    
+    const hier::Box& interior_box = variables[0]->getBox();
+    const hier::IntVector num_ghosts = hier::IntVector::getZero(dim);
+    const hier::IntVector& direction_vector = variables[0]->getDirectionVector();
+    
+    const HAMERS_SHARED_PTR<EquationOfStateMixingRules> equation_of_state_mixing_rules =
+        flow_model->getEquationOfStateMixingRules();
+    
+    HAMERS_SHARED_PTR<pdat::SideData<double> > density(
+        new pdat::SideData<double>(interior_box, 1, num_ghosts, direction_vector));
+    HAMERS_SHARED_PTR<pdat::SideData<double> > pressure(
+        new pdat::SideData<double>(interior_box, 1, num_ghosts, direction_vector));
+    HAMERS_SHARED_PTR<pdat::SideData<double> > sound_speed(
+        new pdat::SideData<double>(interior_box, 1, num_ghosts, direction_vector));
+    HAMERS_SHARED_PTR<pdat::SideData<double> > internal_energy(
+        new pdat::SideData<double>(interior_box, 1, num_ghosts, direction_vector));
+    
+    double* rho_face = density->getPointer(direction, 0);
+    double* p_face = pressure->getPointer(direction, 0);
+    double* c_face = sound_speed->getPointer(direction, 0);
+    double* epsilon_face = internal_energy->getPointer(direction, 0);
+    
+    std::vector<const double*> W;
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        W.push_back(variables[ei]->getPointer(direction, 0));
+    }
+    
+    const int num_densities = (flow_model_type == FLOW_MODEL::SINGLE_SPECIES) ? 1 : num_species;
+    const int idx_momentum = num_densities;
+    const int idx_energy = num_densities + dim.getValue();
+    
+    for (int i = 0; i < num_faces; i++)
+    {
+        rho_face[i] = double(0);
+        for (int si = 0; si < num_densities; si++)
+        {
+            rho_face[i] += W[si][i];
+        }
+        
+        if (use_primitive_variables)
+        {
+            p_face[i] = W[idx_energy][i];
+        }
+        else
+        {
+            double momentum_sq = W[idx_momentum][i]*W[idx_momentum][i];
+            for (int di = 1; di < dim.getValue(); di++)
+            {
+                momentum_sq += W[idx_momentum + di][i]*W[idx_momentum + di][i];
+            }
+            epsilon_face[i] = (W[idx_energy][i] - double(1)/double(2)*momentum_sq/rho_face[i])/rho_face[i];
+        }
+    }
+    
+    if (flow_model_type == FLOW_MODEL::SINGLE_SPECIES)
+    {
+        const int num_thermo_properties =
+            equation_of_state_mixing_rules->getNumberOfSpeciesThermodynamicProperties();
+        
+        std::vector<double> thermo_properties(num_thermo_properties);
+        std::vector<double*> thermo_properties_ptr;
+        std::vector<const double*> thermo_properties_const_ptr;
+        for (int ti = 0; ti < num_thermo_properties; ti++)
+        {
+            thermo_properties_ptr.push_back(&thermo_properties[ti]);
+            thermo_properties_const_ptr.push_back(&thermo_properties[ti]);
+        }
+        
+        equation_of_state_mixing_rules->getSpeciesThermodynamicProperties(thermo_properties_ptr, 0);
+        
+        const HAMERS_SHARED_PTR<EquationOfState> equation_of_state =
+            equation_of_state_mixing_rules->getEquationOfState();
+        
+        if (use_primitive_variables)
+        {
+            equation_of_state->computeSoundSpeed(
+                sound_speed, variables[0], variables[idx_energy], thermo_properties_const_ptr, direction);
+            equation_of_state->computeInternalEnergy(
+                internal_energy, variables[0], variables[idx_energy], thermo_properties_const_ptr, direction);
+        }
+        else
+        {
+            equation_of_state->computePressure(
+                pressure, variables[0], internal_energy, thermo_properties_const_ptr, direction);
+            equation_of_state->computeSoundSpeed(
+                sound_speed, variables[0], pressure, thermo_properties_const_ptr, direction);
+        }
+    }
+    else
+    {
+        HAMERS_SHARED_PTR<pdat::SideData<double> > mass_fractions(
+            new pdat::SideData<double>(interior_box, num_species, num_ghosts, direction_vector));
+        HAMERS_SHARED_PTR<pdat::SideData<double> > gruneisen_parameter(
+            new pdat::SideData<double>(interior_box, 1, num_ghosts, direction_vector));
+        HAMERS_SHARED_PTR<pdat::SideData<double> > partial_pressure_partial_partial_densities(
+            new pdat::SideData<double>(interior_box, num_species, num_ghosts, direction_vector));
+        
+        for (int si = 0; si < num_species; si++)
+        {
+            double* Y = mass_fractions->getPointer(direction, si);
+            for (int i = 0; i < num_faces; i++)
+            {
+                Y[i] = W[si][i]/rho_face[i];
+            }
+        }
+        
+        const HAMERS_SHARED_PTR<pdat::SideData<double> >& data_pressure =
+            use_primitive_variables ? variables[idx_energy] : pressure;
+        
+        if (flow_model_type == FLOW_MODEL::FOUR_EQN_CONSERVATIVE)
+        {
+            if (!use_primitive_variables)
+            {
+                equation_of_state_mixing_rules->computePressure(
+                    pressure, density, internal_energy, mass_fractions, direction);
+            }
+            equation_of_state_mixing_rules->computeGruneisenParameter(
+                gruneisen_parameter, density, data_pressure, mass_fractions, direction);
+            equation_of_state_mixing_rules->computePressureDerivativeWithPartialDensities(
+                partial_pressure_partial_partial_densities, density, data_pressure, mass_fractions,
+                direction);
+            if (use_primitive_variables)
+            {
+                equation_of_state_mixing_rules->computeInternalEnergy(
+                    internal_energy, density, data_pressure, mass_fractions, direction);
+            }
+        }
+        else
+        {
+            HAMERS_SHARED_PTR<pdat::SideData<double> > volume_fractions(
+                new pdat::SideData<double>(interior_box, num_species - 1, num_ghosts, direction_vector));
+            
+            for (int si = 0; si < num_species - 1; si++)
+            {
+                double* Z = volume_fractions->getPointer(direction, si);
+                for (int i = 0; i < num_faces; i++)
+                {
+                    Z[i] = W[idx_energy + 1 + si][i];
+                }
+            }
+            
+            if (!use_primitive_variables)
+            {
+                equation_of_state_mixing_rules->computePressure(
+                    pressure, density, internal_energy, mass_fractions, volume_fractions, direction);
+            }
+            equation_of_state_mixing_rules->computeGruneisenParameter(
+                gruneisen_parameter, density, data_pressure, mass_fractions, volume_fractions,
+                direction);
+            equation_of_state_mixing_rules->computePressureDerivativeWithPartialDensities(
+                partial_pressure_partial_partial_densities, density, data_pressure, mass_fractions,
+                volume_fractions, direction);
+            if (use_primitive_variables)
+            {
+                equation_of_state_mixing_rules->computeInternalEnergy(
+                    internal_energy, density, data_pressure, mass_fractions, volume_fractions,
+                    direction);
+            }
+        }
+        
+        const double* p_data = data_pressure->getPointer(direction, 0);
+        const double* Gamma = gruneisen_parameter->getPointer(direction, 0);
+        
+        for (int i = 0; i < num_faces; i++)
+        {
+            c_face[i] = Gamma[i]*p_data[i]/rho_face[i];
+        }
+        for (int si = 0; si < num_species; si++)
+        {
+            const double* Y = mass_fractions->getPointer(direction, si);
+            const double* Psi = partial_pressure_partial_partial_densities->getPointer(direction, si);
+            for (int i = 0; i < num_faces; i++)
+            {
+                c_face[i] += Y[i]*Psi[i];
+            }
+        }
+        for (int i = 0; i < num_faces; i++)
+        {
+            c_face[i] = sqrt(c_face[i]);
+        }
+    }
+    
+    for (int i = 0; i < num_faces; i++)
+    {
+        rho[i] = rho_face[i];
+        p[i] = use_primitive_variables ? W[idx_energy][i] : p_face[i];
+        c[i] = c_face[i];
+        epsilon[i] = epsilon_face[i];
+    }
+}
+
+
+/*
+ * Fill the left and right conservative or primitive variables on the faces. The normal velocity
+ * is chosen so that the faces cover contact waves moving to both sides and supersonic flows in
+ * both directions and the states on both sides of every sixth face are identical.
+ */
+static void
+fillStates(
+    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_L,
+    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > >& variables_R,
+    std::mt19937& generator,
+    const FLOW_MODEL::TYPE& flow_model_type,
+    const int& num_species,
+    const bool& use_primitive_variables,
+    const int& direction,
+    const int& num_faces)
+{
+    const int dim = variables_L[0]->getDim().getValue();
+    const int num_eqn = static_cast<int>(variables_L.size());
+    
+    const int num_densities = (flow_model_type == FLOW_MODEL::SINGLE_SPECIES) ? 1 : num_species;
+    const int idx_momentum = num_densities;
+    const int idx_energy = num_densities + dim;
+    
+    const double u_normal[5] = {-3.0, -0.4, 0.0, 0.4, 3.0};
+    
+    std::vector<double*> W_L;
+    std::vector<double*> W_R;
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        W_L.push_back(variables_L[ei]->getPointer(direction, 0));
+        W_R.push_back(variables_R[ei]->getPointer(direction, 0));
+    }
+    
+    for (int i = 0; i < num_faces; i++)
+    {
+        for (int k = 0; k < 2; k++)
+        {
+            std::vector<double*>& W = (k == 0) ? W_L : W_R;
+            
+            if (k == 1 && i%6 == 5)
+            {
+                for (int ei = 0; ei < num_eqn; ei++)
+                {
+                    W_R[ei][i] = W_L[ei][i];
+                }
+                
+                continue;
+            }
+            
+            double rho = double(0);
+            for (int si = 0; si < num_densities; si++)
+            {
+                W[si][i] = 0.2 + 1.8*double(generator())/double(generator.max());
+                rho += W[si][i];
+            }
+            
+            std::vector<double> vel(dim);
+            double vel_sq = double(0);
+            for (int di = 0; di < dim; di++)
+            {
+                const double r = double(generator())/double(generator.max()) - 0.5;
+                vel[di] = (di == direction) ? u_normal[i%5] + 0.3*r : 2.0*r;
+                vel_sq += vel[di]*vel[di];
+            }
+            
+            const double r = double(generator())/double(generator.max());
+            
+            if (use_primitive_variables)
+            {
+                for (int di = 0; di < dim; di++)
+                {
+                    W[idx_momentum + di][i] = vel[di];
+                }
+                W[idx_energy][i] = 0.5 + r;
+            }
+            else
+            {
+                for (int di = 0; di < dim; di++)
+                {
+                    W[idx_momentum + di][i] = rho*vel[di];
+                }
+                W[idx_energy][i] = rho*(1.0 + r + 0.5*vel_sq);
+            }
+            
+            for (int ei = idx_energy + 1; ei < num_eqn; ei++)
+            {
+                W[ei][i] = (0.1 + 0.8*double(generator())/double(generator.max()))/double(num_species);
+            }
+        }
+    }
+}
+
+
+/*
+ * Compare the fluxes and velocity of a Riemann solver bit for bit with the reference on every face.
+ */
+static bool
+compareWithReference(
+    const HAMERS_SHARED_PTR<FlowModel>& flow_model,
+    const FLOW_MODEL::TYPE& flow_model_type,
+    const RIEMANN_SOLVER::TYPE& riemann_solver_type,
+    const bool& use_primitive_variables,
+    const tbox::Dimension& dim,
+    const int& direction,
+    std::mt19937& generator)
+{
+    const int num_species = flow_model->getNumberOfSpecies();
+    const int num_eqn = flow_model->getNumberOfEquations();
+    
+    const HAMERS_SHARED_PTR<FlowModelRiemannSolver> riemann_solver =
+        flow_model->getFlowModelRiemannSolver();
+    
+    /*
+     * Put the variables on the faces of a single row of cells in the direction.
+     */
+    
+    const int num_faces = 64;
+    
+    hier::Index box_lo(dim, 0);
+    hier::Index box_hi(dim, 0);
+    box_hi[direction] = num_faces - 2;
+    
+    const hier::Box interior_box(box_lo, box_hi, hier::BlockId(0));
+    
+    hier::IntVector direction_vector = hier::IntVector::getZero(dim);
+    direction_vector[direction] = 1;
+    
+    const hier::IntVector num_ghosts = hier::IntVector::getZero(dim);
+    
+    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > variables_L;
+    std::vector<HAMERS_SHARED_PTR<pdat::SideData<double> > > variables_R;
+    for (int ei = 0; ei < num_eqn; ei++)
+    {
+        variables_L.push_back(HAMERS_SHARED_PTR<pdat::SideData<double> >(
+            new pdat::SideData<double>(interior_box, 1, num_ghosts, direction_vector)));
+        variables_R.push_back(HAMERS_SHARED_PTR<pdat::SideData<double> >(
+            new pdat::SideData<double>(interior_box, 1, num_ghosts, direction_vector)));
+    }
+    
+    fillStates(
+        variables_L,
+        variables_R,
+        generator,
+        flow_model_type,
+        num_species,
+        use_primitive_variables,
+        direction,
+        num_faces);
+    
+    HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux(
+        new pdat::SideData<double>(interior_box, num_eqn, num_ghosts, direction_vector));
+    HAMERS_SHARED_PTR<pdat::SideData<double> > convective_flux_with_velocity(
+        new pdat::SideData<double>(interior_box, num_eqn, num_ghosts, direction_vector));
+    HAMERS_SHARED_PTR<pdat::SideData<double> > velocity(
+        new pdat::SideData<double>(interior_box, dim.getValue(), num_ghosts, direction_vector));
+    
+    const DIRECTION::TYPE direction_type = (direction == 0) ? DIRECTION::X_DIRECTION :
+        ((direction == 1) ? DIRECTION::Y_DIRECTION : DIRECTION::Z_DIRECTION);
+    
+    if (use_primitive_variables)
+    {
+        riemann_solver->computeConvectiveFluxFromPrimitiveVariables(
+            convective_flux,
+            variables_L,
+            variables_R,
+            direction_type,
+            riemann_solver_type);
+        
+        riemann_solver->computeConvectiveFluxAndVelocityFromPrimitiveVariables(
+            convective_flux_with_velocity,
+            velocity,
+            variables_L,
+            variables_R,
+            direction_type,
+            riemann_solver_type);
+    }
+    else
+    {
+        riemann_solver->computeConvectiveFluxFromConservativeVariables(
+            convective_flux,
+            variables_L,
+            variables_R,
+            direction_type,
+            riemann_solver_type);
+        
+        riemann_solver->computeConvectiveFluxAndVelocityFromConservativeVariables(
+            convective_flux_with_velocity,
+            velocity,
+            variables_L,
+            variables_R,
+            direction_type,
+            riemann_solver_type);
+    }
+    
+    /*
+     * Compute the reference fluxes and velocity and compare them with the ones of the Riemann solver.
+     */
+    
+    std::vector<std::vector<double> > rho(2, std::vector<double>(num_faces));
+    std::vector<std::vector<double> > p(2, std::vector<double>(num_faces));
+    std::vector<std::vector<double> > c(2, std::vector<double>(num_faces));
+    std::vector<std::vector<double> > epsilon(2, std::vector<double>(num_faces));
+    
+    computeThermodynamicFields(rho[0], p[0], c[0], epsilon[0], flow_model, flow_model_type,
+        variables_L, use_primitive_variables, direction, num_faces);
+    computeThermodynamicFields(rho[1], p[1], c[1], epsilon[1], flow_model, flow_model_type,
+        variables_R, use_primitive_variables, direction, num_faces);
+    
+    const double* vel_face = velocity->getPointer(direction, direction);
+    
+    bool is_equal = true;
+    
+    for (int i = 0; i < num_faces; i++)
+    {
+        std::vector<std::vector<double> > W(2, std::vector<double>(num_eqn));
+        for (int ei = 0; ei < num_eqn; ei++)
+        {
+            W[0][ei] = variables_L[ei]->getPointer(direction, 0)[i];
+            W[1][ei] = variables_R[ei]->getPointer(direction, 0)[i];
+        }
+        
+        std::vector<double> rho_face(2), p_face(2), c_face(2), epsilon_face(2);
+        for (int k = 0; k < 2; k++)
+        {
+            rho_face[k] = rho[k][i];
+            p_face[k] = p[k][i];
+            c_face[k] = c[k][i];
+            epsilon_face[k] = epsilon[k][i];
+        }
+        
+        std::vector<double> F_ref(num_eqn);
+        double vel_ref;
+        
+        computeReferenceConvectiveFlux(
+            F_ref,
+            vel_ref,
+            W,
+            rho_face,
+            p_face,
+            c_face,
+            epsilon_face,
+            flow_model_type,
+            num_species,
+            dim.getValue(),
+            direction,
+            riemann_solver_type,
+            use_primitive_variables);
+        
+        for (int ei = 0; ei < num_eqn; ei++)
+        {
+            const double F = convective_flux->getPointer(direction, ei)[i];
+            const double F_with_velocity = convective_flux_with_velocity->getPointer(direction, ei)[i];
+            
+            if (memcmp(&F, &F_ref[ei], sizeof(double)) != 0 ||
+                memcmp(&F_with_velocity, &F_ref[ei], sizeof(double)) != 0)
+            {
+                std::cout.precision(17);
+                std::cout << "Dimension " << dim.getValue() << ", direction " << direction
+                          << (use_primitive_variables ? ", primitive" : ", conservative")
+                          << " variables, face " << i << ", equation " << ei << ": flux = " << F
+                          << ", flux with velocity = " << F_with_velocity << ", reference = "
+                          << F_ref[ei] << std::endl;
+                
+                is_equal = false;
+            }
+        }
+        
+        if (memcmp(&vel_face[i], &vel_ref, sizeof(double)) != 0)
+        {
+            std::cout.precision(17);
+            std::cout << "Dimension " << dim.getValue() << ", direction " << direction
+                      << (use_primitive_variables ? ", primitive" : ", conservative")
+                      << " variables, face " << i << ": velocity = " << vel_face[i] << ", reference = "
+                      << vel_ref << std::endl;
+            
+            is_equal = false;
+        }
+    }
+    
+    return is_equal;
+}
+
+
+/*
+ * Create a flow model of a mixture of ideal gases.
+ */
+static HAMERS_SHARED_PTR<FlowModel>
+createFlowModel(
+    const FLOW_MODEL::TYPE& flow_model_type,
+    const tbox::Dimension& dim,
+    const int& num_species)
+{
+    const double species_gamma[4] = {1.4, 1.67, 1.3, 1.2};
+    const double species_R[4] = {287.0, 2077.0, 189.0, 519.0};
+    
+    HAMERS_SHARED_PTR<tbox::Database> flow_model_db(new tbox::InputDatabase("flow_model_db"));
+    flow_model_db->putString("equation_of_state", "IDEAL_GAS");
+    
+    HAMERS_SHARED_PTR<tbox::Database> equation_of_state_mixing_rules_db =
+        flow_model_db->putDatabase("Equation_of_state_mixing_rules");
+    equation_of_state_mixing_rules_db->putDoubleVector("species_gamma",
+        std::vector<double>(species_gamma, species_gamma + num_species));
+    equation_of_state_mixing_rules_db->putDoubleVector("species_R",
+        std::vector<double>(species_R, species_R + num_species));
+    
+    HAMERS_SHARED_PTR<FlowModel> flow_model;
+    
+    switch (flow_model_type)
+    {
+        case FLOW_MODEL::SINGLE_SPECIES:
+        {
+            flow_model.reset(new FlowModelSingleSpecies(
+                "flow_model",
+                "test_Riemann_solvers",
+                dim,
+                HAMERS_SHARED_PTR<geom::CartesianGridGeometry>(),
+                num_species,
+                flow_model_db));
+            
+            break;
+        }
+        case FLOW_MODEL::FOUR_EQN_CONSERVATIVE:
+        {
+            flow_model.reset(new FlowModelFourEqnConservative(
+                "flow_model",
+                "test_Riemann_solvers",
+                dim,
+                HAMERS_SHARED_PTR<geom::CartesianGridGeometry>(),
+                num_species,
+                flow_model_db));
+            
+            break;
+        }
+        case FLOW_MODEL::FIVE_EQN_ALLAIRE:
+        {
+            flow_model.reset(new FlowModelFiveEqnAllaire(
+                "flow_model",
+                "test_Riemann_solvers",
+                dim,
+                HAMERS_SHARED_PTR<geom::CartesianGridGeometry>(),
+                num_species,
+                flow_model_db));
+            
+            break;
+        }
+    }
+    
+    flow_model->setupRiemannSolver();
+    
+    return flow_model;
+}
+
+
+int main(int argc, char *argv[])
+{
+    tbox::SAMRAI_MPI::init(&argc, &argv);
+    tbox::SAMRAIManager::initialize();
+    tbox::SAMRAIManager::startup();
+    
+    {
+        std::mt19937 generator(2023);
+        
+        /*
+         * Verify that the HLLC and HLLC-HLL Riemann solvers of every flow model give the same results
+         * bit for bit as the branching formulation in all dimensions and directions, from both the
+         * conservative and primitive variables. The numbers of species cover the specialized and the
+         * generic kernels of the multi-species flow models.
+         */
+        
+        const FLOW_MODEL::TYPE flow_model_types[3] = {
+            FLOW_MODEL::SINGLE_SPECIES,
+            FLOW_MODEL::FOUR_EQN_CONSERVATIVE,
+            FLOW_MODEL::FIVE_EQN_ALLAIRE};
+        
+        const std::string flow_model_names[3] = {
+            "FlowModelRiemannSolverSingleSpecies",
+            "FlowModelRiemannSolverFourEqnConservative",
+            "FlowModelRiemannSolverFiveEqnAllaire"};
+        
+        const RIEMANN_SOLVER::TYPE riemann_solver_types[2] = {
+            RIEMANN_SOLVER::HLLC,
+            RIEMANN_SOLVER::HLLC_HLL};
+        
+        const std::string riemann_solver_names[2] = {"HLLC", "HLLC_HLL"};
+        
+        for (int mi = 0; mi < 3; mi++)
+        {
+            std::vector<int> num_species_list;
+            if (flow_model_types[mi] == FLOW_MODEL::SINGLE_SPECIES)
+            {
+                num_species_list.push_back(1);
+            }
+            else
+            {
+                num_species_list.push_back(2);
+                num_species_list.push_back(3);
+                num_species_list.push_back(4);
+            }
+            
+            for (int ri = 0; ri < 2; ri++)
+            {
+                bool is_equal = true;
+                
+                for (int ni = 0; ni < static_cast<int>(num_species_list.size()); ni++)
+                {
+                    for (int d = 1; d <= 3; d++)
+                    {
+                        const tbox::Dimension dim(static_cast<unsigned short>(d));
+                        
+                        HAMERS_SHARED_PTR<FlowModel> flow_model =
+                            createFlowModel(flow_model_types[mi], dim, num_species_list[ni]);
+                        
+                        for (int direction = 0; direction < d; direction++)
+                        {
+                            for (int vi = 0; vi < 2; vi++)
+                            {
+                                if (!compareWithReference(
+                                        flow_model,
+                                        flow_model_types[mi],
+                                        riemann_solver_types[ri],
+                                        vi == 1,
+                                        dim,
+                                        direction,
+                                        generator))
+                                {
+                                    std::cout << "Number of species: " << num_species_list[ni]
+                                              << std::endl;
+                                    
+                                    is_equal = false;
+                                }
+                            }
+                        }
+                        
+                        flow_model.reset();
+                    }
+                }
+                
+                if (is_equal)
+                {
+                    std::cout << flow_model_names[mi] << riemann_solver_names[ri]
+                              << " is implemented correctly!" << std::endl;
+                }
+                else
+                {
+                    std::cout << flow_model_names[mi] << riemann_solver_names[ri]
+                              << " is not implemented correctly!" << std::endl;
+                }
+            }
+        }
+    }
+    
+    tbox::SAMRAIManager::shutdown();
+    tbox::SAMRAIManager::finalize();
+    tbox::SAMRAI_MPI::finalize();
+    
+    return 0;
+}
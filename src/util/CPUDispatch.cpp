@@ -0,0 +1,34 @@
+#include "util/CPUDispatch.hpp"
+
+/*
+ * Get the name of the variant of the kernels selected for the CPU running the program. The features
+ * are checked in the same order of priority as the one used by the dynamic loader to select the
+ * variants of the functions with the HAMERS_CPU_DISPATCH attribute. The variants generated by the Intel
+ * compilers with the -ax option are selected by the runtime of the compiler from features that are not
+ * exposed to the program, so the variant is reported as unknown in that case.
+ */
+std::string
+CPU_DISPATCH::getSelectedVariant()
+{
+#if defined(HAMERS_ENABLE_CPU_DISPATCH) && defined(__x86_64__) && defined(__GNUC__) && \
+    !defined(__INTEL_COMPILER)
+    __builtin_cpu_init();
+    
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return "AVX-512";
+    }
+    else if (__builtin_cpu_supports("avx2"))
+    {
+        return "AVX2";
+    }
+    else
+    {
+        return "DEFAULT";
+    }
+#elif defined(HAMERS_ENABLE_CPU_DISPATCH) && defined(__INTEL_COMPILER)
+    return "UNKNOWN (SELECTED BY INTEL COMPILER RUNTIME)";
+#else
+    return "NONE (CPU DISPATCH DISABLED)";
+#endif
+}
@@ -1,5 +1,12 @@
 #include "util/MPI_helpers/MPIHelper.hpp"
 
+#include <algorithm>
+
+std::map<std::pair<int, int>, HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> >
+    MPIHelper::s_flattened_hierarchies;
+HAMERS_WEAK_PTR<hier::PatchHierarchy> MPIHelper::s_flattened_hierarchies_patch_hierarchy;
+std::vector<HAMERS_WEAK_PTR<hier::PatchLevel> > MPIHelper::s_flattened_hierarchies_patch_levels;
+
 MPIHelper::MPIHelper(
     const std::string& object_name,
     const tbox::Dimension& dim,
@@ -14,7 +21,8 @@ MPIHelper::MPIHelper(
         d_coarsest_level_dims(dim),
         d_dx_coarsest_level_dims(dim.getValue()),
         d_finest_level_dims(dim),
-        d_dx_finest_level_dims(dim.getValue())
+        d_dx_finest_level_dims(dim.getValue()),
+        d_profile_reduction_type(PROFILE_REDUCTION::ALL_REDUCE)
 {
     /*
      * Compute the refinement ratio from the finest level to the coarsest level.
@@ -52,3 +60,215 @@ MPIHelper::MPIHelper(
         d_dx_finest_level_dims[di]   = dx_tmp[di]/d_ratio_finest_level_to_coarsest_level[di];
     }
 }
+
+
+/*
+ * Get the flattened hierarchy of a range of levels of the patch hierarchy. The cached flattened
+ * hierarchies are dropped when the patch hierarchy or any of its patch levels is replaced, since the
+ * visible and overlapped boxes depend on the boxes of the levels. The weak pointers make sure that a
+ * new object allocated at the address of a destroyed one is not taken as unchanged.
+ */
+HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy>
+MPIHelper::getFlattenedHierarchy(
+    const int coarsest_level,
+    const int finest_level) const
+{
+    const int num_levels = d_patch_hierarchy->getNumberOfLevels();
+    
+    bool is_cache_valid =
+        (s_flattened_hierarchies_patch_hierarchy.lock() == d_patch_hierarchy) &&
+        (static_cast<int>(s_flattened_hierarchies_patch_levels.size()) == num_levels);
+    
+    for (int li = 0; li < num_levels && is_cache_valid; li++)
+    {
+        is_cache_valid =
+            (s_flattened_hierarchies_patch_levels[li].lock() == d_patch_hierarchy->getPatchLevel(li));
+    }
+    
+    if (!is_cache_valid)
+    {
+        s_flattened_hierarchies.clear();
+        
+        s_flattened_hierarchies_patch_hierarchy = d_patch_hierarchy;
+        
+        s_flattened_hierarchies_patch_levels.resize(num_levels);
+        for (int li = 0; li < num_levels; li++)
+        {
+            s_flattened_hierarchies_patch_levels[li] = d_patch_hierarchy->getPatchLevel(li);
+        }
+    }
+    
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy>& flattened_hierarchy =
+        s_flattened_hierarchies[std::make_pair(coarsest_level, finest_level)];
+    
+    if (!flattened_hierarchy)
+    {
+        flattened_hierarchy.reset(new ExtendedFlattenedHierarchy(
+            *d_patch_hierarchy,
+            coarsest_level,
+            finest_level));
+    }
+    
+    return flattened_hierarchy;
+}
+
+
+/*
+ * Get the range [index_lo, index_hi) of the entries of a profile with num_points entries that a
+ * process gets with PROFILE_REDUCTION::REDUCE_SCATTER. The entries are split into contiguous blocks
+ * as evenly as possible, the first processes getting one more entry.
+ */
+void
+MPIHelper::getProfileBlockOfProcess(
+    const int num_points,
+    const int rank,
+    int& index_lo,
+    int& index_hi) const
+{
+    const int num_procs = d_mpi.getSize();
+    
+    TBOX_ASSERT(rank >= 0 && rank < num_procs);
+    
+    const int num_points_per_proc = num_points/num_procs;
+    const int num_remaining_points = num_points%num_procs;
+    
+    index_lo = rank*num_points_per_proc + std::min(rank, num_remaining_points);
+    index_hi = index_lo + num_points_per_proc + (rank < num_remaining_points ? 1 : 0);
+}
+
+
+/*
+ * Reduce the local profiles of all processes into the global profile with the profile reduction
+ * type.
+ */
+void
+MPIHelper::reduceProfile(
+    double* profile_local,
+    double* profile_global,
+    const int num_points) const
+{
+    if (d_profile_reduction_type == PROFILE_REDUCTION::REDUCE_TO_ROOT)
+    {
+        d_mpi.Reduce(
+            profile_local,
+            profile_global,
+            num_points,
+            MPI_DOUBLE,
+            MPI_SUM,
+            0);
+    }
+    else if (d_profile_reduction_type == PROFILE_REDUCTION::REDUCE_SCATTER)
+    {
+        int index_lo = 0;
+        int index_hi = 0;
+        getProfileBlockOfProcess(num_points, d_mpi.getRank(), index_lo, index_hi);
+        
+#ifdef HAVE_MPI
+        if (tbox::SAMRAI_MPI::usingMPI())
+        {
+            const int num_procs = d_mpi.getSize();
+            
+            std::vector<int> num_points_procs(num_procs);
+            for (int ri = 0; ri < num_procs; ri++)
+            {
+                int index_lo_proc = 0;
+                int index_hi_proc = 0;
+                getProfileBlockOfProcess(num_points, ri, index_lo_proc, index_hi_proc);
+                num_points_procs[ri] = index_hi_proc - index_lo_proc;
+            }
+            
+            MPI_Reduce_scatter(
+                profile_local,
+                profile_global + index_lo,
+                num_points_procs.data(),
+                MPI_DOUBLE,
+                MPI_SUM,
+                d_mpi.getCommunicator());
+            
+            return;
+        }
+#endif
+        
+        for (int i = index_lo; i < index_hi; i++)
+        {
+            profile_global[i] = profile_local[i];
+        }
+    }
+    else
+    {
+        d_mpi.Allreduce(
+            profile_local,
+            profile_global,
+            num_points,
+            MPI_DOUBLE,
+            MPI_SUM);
+    }
+}
+
+
+/*
+ * Start the reduction of the local profiles of all processes into the global profile with the
+ * profile reduction type without waiting for it to complete. The non-blocking collectives of MPI-3
+ * are used when available. The reduce-scatter is always done right away since the counts of the
+ * processes would have to outlive this call.
+ */
+bool
+MPIHelper::startProfileReduction(
+    double* profile_local,
+    double* profile_global,
+    const int num_points,
+    tbox::SAMRAI_MPI::Request& request) const
+{
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+    if (tbox::SAMRAI_MPI::usingMPI() &&
+        d_profile_reduction_type != PROFILE_REDUCTION::REDUCE_SCATTER)
+    {
+        if (d_profile_reduction_type == PROFILE_REDUCTION::REDUCE_TO_ROOT)
+        {
+            MPI_Ireduce(
+                profile_local,
+                profile_global,
+                num_points,
+                MPI_DOUBLE,
+                MPI_SUM,
+                0,
+                d_mpi.getCommunicator(),
+                &request);
+        }
+        else
+        {
+            MPI_Iallreduce(
+                profile_local,
+                profile_global,
+                num_points,
+                MPI_DOUBLE,
+                MPI_SUM,
+                d_mpi.getCommunicator(),
+                &request);
+        }
+        
+        return true;
+    }
+#endif
+    
+    NULL_USE(request);
+    
+    reduceProfile(profile_local, profile_global, num_points);
+    
+    return false;
+}
+
+
+/*
+ * Wait for a reduction started by startProfileReduction() to complete.
+ */
+void
+MPIHelper::finishProfileReduction(
+    tbox::SAMRAI_MPI::Request& request) const
+{
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+#else
+    NULL_USE(request);
+#endif
+}
@@ -23,11 +23,8 @@ MPIHelperAverage::getAveragedQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -84,11 +81,13 @@ MPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 
                 const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -114,25 +113,10 @@ MPIHelperAverage::getAveragedQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -206,11 +190,15 @@ MPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -244,25 +232,12 @@ MPIHelperAverage::getAveragedQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -339,11 +314,17 @@ MPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -384,25 +365,13 @@ MPIHelperAverage::getAveragedQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -460,11 +429,8 @@ MPIHelperAverage::getAveragedQuantity(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -534,11 +500,13 @@ MPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -569,25 +537,10 @@ MPIHelperAverage::getAveragedQuantity(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -683,11 +636,15 @@ MPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -731,25 +688,12 @@ MPIHelperAverage::getAveragedQuantity(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -849,11 +793,17 @@ MPIHelperAverage::getAveragedQuantity(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -908,25 +858,13 @@ MPIHelperAverage::getAveragedQuantity(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -991,11 +929,8 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -1069,11 +1004,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 
                 const int num_ghosts_0_quantity = num_ghosts_quantity[0];
@@ -1097,25 +1034,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear index and the data to add.
@@ -1140,12 +1062,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -1226,11 +1146,15 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -1264,25 +1188,12 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -1309,12 +1220,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -1396,11 +1305,17 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -1441,25 +1356,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -1489,12 +1392,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(u_avg_local);
     }
@@ -1525,11 +1426,8 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -1616,11 +1514,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 num_ghosts_0_u_qi.reserve(num_quantities);
                 
@@ -1649,25 +1549,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                     for (int i = 0; i < interior_dim_0; i++)
                     {
                         /*
-                         * Compute the index of the data point and count how many times the data is repeated.
+                         * Get how many times the data is repeated from the mask of the patch.
                          */
                         
-                        const hier::Index idx_pt(tbox::Dimension(1), idx_lo_0 + i);
-                        
-                        int n_overlapped = 1;
-                        
-                        for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                patch_overlapped_visible_boxes.begin());
-                             iob != patch_overlapped_visible_boxes.end();
-                             iob++)
-                        {
-                            const hier::Box& patch_overlapped_visible_box = *iob;
-                            
-                            if (patch_overlapped_visible_box.contains(idx_pt))
-                            {
-                                n_overlapped++;
-                            }
-                        }
+                        const int n_overlapped = patch_overlapped_visible_cell_counts[idx_lo_0 + i - patch_lo_0];
                         
                         /*
                          * Compute the linear indices and the data to add.
@@ -1699,12 +1584,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -1798,11 +1681,15 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -1846,25 +1733,12 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -1899,12 +1773,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -1999,11 +1871,17 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -2058,25 +1936,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -2116,12 +1982,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousXDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_0,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_0);
         
         std::free(avg_local);
     }
@@ -2148,11 +2012,8 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -2246,11 +2107,15 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -2284,25 +2149,12 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear index and the data to add.
@@ -2329,12 +2181,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(u_avg_local);
     }
@@ -2416,11 +2266,17 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -2461,25 +2317,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -2509,12 +2353,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(u_avg_local);
     }
@@ -2545,11 +2387,8 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -2656,11 +2495,15 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> ghostcell_dim_0_u_qi;
@@ -2704,25 +2547,12 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         for (int i = 0; i < interior_dim_0; i++)
                         {
                             /*
-                             * Compute the index of the data point and count how many times the data is repeated.
+                             * Get how many times the data is repeated from the mask of the patch.
                              */
                             
-                            const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j);
-                            
-                            int n_overlapped = 1;
-                            
-                            for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                    patch_overlapped_visible_boxes.begin());
-                                 iob != patch_overlapped_visible_boxes.end();
-                                 iob++)
-                            {
-                                const hier::Box& patch_overlapped_visible_box = *iob;
-                                
-                                if (patch_overlapped_visible_box.contains(idx_pt))
-                                {
-                                    n_overlapped++;
-                                }
-                            }
+                            const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                (idx_lo_0 + i - patch_lo_0) +
+                                (idx_lo_1 + j - patch_lo_1)*patch_dim_0];
                             
                             /*
                              * Compute the linear indices and the data to add.
@@ -2757,12 +2587,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(avg_local);
     }
@@ -2857,11 +2685,17 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -2916,25 +2750,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -2974,12 +2796,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousYDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_1,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_1);
         
         std::free(avg_local);
     }
@@ -3006,11 +2826,8 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -3113,11 +2930,17 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 const hier::IntVector num_ghosts_quantity = data_quantity->getGhostCellWidth();
                 const hier::IntVector ghostcell_dims_quantity = data_quantity->getGhostBox().numberCells();
                 
@@ -3158,25 +2981,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -3206,12 +3017,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             u_avg_local,
             u_avg_global,
-            finest_level_dim_2,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_2);
         
         std::free(u_avg_local);
     }
@@ -3242,11 +3051,8 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
      * location in the problem space.
      */
     
-    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy(
-        new ExtendedFlattenedHierarchy(
-            *d_patch_hierarchy,
-            0,
-            num_levels - 1));
+    HAMERS_SHARED_PTR<ExtendedFlattenedHierarchy> flattened_hierarchy =
+        getFlattenedHierarchy(0, num_levels - 1);
     
     /*
      * Get the indices of the physical domain.
@@ -3362,11 +3168,17 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                         patch_box,
                         li);
                 
-                const hier::BoxContainer& patch_overlapped_visible_boxes =
-                    flattened_hierarchy->getOverlappedVisibleBoxes(
+                const std::vector<int>& patch_overlapped_visible_cell_counts =
+                    flattened_hierarchy->getOverlappedVisibleCellCounts(
                         patch_box,
                         li);
                 
+                const int patch_lo_0 = patch_box.lower(0);
+                const int patch_lo_1 = patch_box.lower(1);
+                const int patch_lo_2 = patch_box.lower(2);
+                const int patch_dim_0 = patch_box.numberCells(0);
+                const int patch_dim_1 = patch_box.numberCells(1);
+                
                 std::vector<int> num_ghosts_0_u_qi;
                 std::vector<int> num_ghosts_1_u_qi;
                 std::vector<int> num_ghosts_2_u_qi;
@@ -3421,25 +3233,13 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
                             for (int i = 0; i < interior_dim_0; i++)
                             {
                                 /*
-                                 * Compute the index of the data point and count how many times the data is repeated.
+                                 * Get how many times the data is repeated from the mask of the patch.
                                  */
                                 
-                                const hier::Index idx_pt(idx_lo_0 + i, idx_lo_1 + j, idx_lo_2 + k);
-                                
-                                int n_overlapped = 1;
-                                
-                                for (hier::BoxContainer::BoxContainerConstIterator iob(
-                                        patch_overlapped_visible_boxes.begin());
-                                     iob != patch_overlapped_visible_boxes.end();
-                                     iob++)
-                                {
-                                    const hier::Box& patch_overlapped_visible_box = *iob;
-                                    
-                                    if (patch_overlapped_visible_box.contains(idx_pt))
-                                    {
-                                        n_overlapped++;
-                                    }
-                                }
+                                const int n_overlapped = patch_overlapped_visible_cell_counts[
+                                    (idx_lo_0 + i - patch_lo_0) +
+                                    (idx_lo_1 + j - patch_lo_1)*patch_dim_0 +
+                                    (idx_lo_2 + k - patch_lo_2)*patch_dim_0*patch_dim_1];
                                 
                                 /*
                                  * Compute the linear index and the data to add.
@@ -3479,12 +3279,10 @@ MPIHelperAverage::getAveragedQuantityWithInhomogeneousZDirection(
          * Reduction to get the global average.
          */
         
-        d_mpi.Allreduce(
+        reduceProfile(
             avg_local,
             avg_global,
-            finest_level_dim_2,
-            MPI_DOUBLE,
-            MPI_SUM);
+            finest_level_dim_2);
         
         std::free(avg_local);
     }
@@ -0,0 +1,258 @@
+#include "util/load_balancing/PatchWorkloadMeasurer.hpp"
+
+#include "SAMRAI/geom/CartesianPatchGeometry.h"
+#include "SAMRAI/hier/BoundaryBox.h"
+#include "SAMRAI/pdat/CellData.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <vector>
+
+PatchWorkloadMeasurer::PatchWorkloadMeasurer(
+    const std::string& object_name,
+    const tbox::Dimension& dim,
+    const int workload_data_id):
+        d_object_name(object_name),
+        d_dim(dim),
+        d_workload_data_id(workload_data_id),
+        d_is_measuring(false)
+{
+}
+
+
+/*
+ * Reset the workload on the patches of the level and start measuring the cost of the patch
+ * operations.
+ */
+void
+PatchWorkloadMeasurer::startMeasuringOnLevel(
+    const HAMERS_SHARED_PTR<hier::PatchLevel>& level)
+{
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
+    {
+        const HAMERS_SHARED_PTR<hier::Patch>& patch = *ip;
+        
+        if (!patch->checkAllocated(d_workload_data_id))
+        {
+            patch->allocatePatchData(d_workload_data_id);
+        }
+        
+        HAMERS_SHARED_PTR<pdat::CellData<double> > workload_data(
+            HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
+                patch->getPatchData(d_workload_data_id)));
+        
+        workload_data->fillAll(0.0);
+    }
+    
+    d_is_measuring = true;
+}
+
+
+/*
+ * Stop measuring and scale the workload measured on the level such that the mean cost of the cells
+ * on the level is one. A level without any measured cost is given the uniform workload.
+ */
+void
+PatchWorkloadMeasurer::finishMeasuringOnLevel(
+    const HAMERS_SHARED_PTR<hier::PatchLevel>& level)
+{
+    if (!d_is_measuring)
+    {
+        return;
+    }
+    
+    d_is_measuring = false;
+    
+    // Sum of the workload and number of cells on the level.
+    double workload_sum_and_num_cells[2] = {0.0, 0.0};
+    
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
+    {
+        const HAMERS_SHARED_PTR<hier::Patch>& patch = *ip;
+        
+        HAMERS_SHARED_PTR<pdat::CellData<double> > workload_data(
+            HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
+                patch->getPatchData(d_workload_data_id)));
+        
+        const double* const w = workload_data->getPointer(0);
+        const int num_cells = static_cast<int>(patch->getBox().size());
+        
+        for (int idx = 0; idx < num_cells; idx++)
+        {
+            workload_sum_and_num_cells[0] += w[idx];
+        }
+        
+        workload_sum_and_num_cells[1] += double(num_cells);
+    }
+    
+    level->getBoxLevel()->getMPI().AllReduce(workload_sum_and_num_cells, 2, MPI_SUM);
+    
+    for (hier::PatchLevel::iterator ip(level->begin());
+         ip != level->end();
+         ip++)
+    {
+        const HAMERS_SHARED_PTR<hier::Patch>& patch = *ip;
+        
+        HAMERS_SHARED_PTR<pdat::CellData<double> > workload_data(
+            HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
+                patch->getPatchData(d_workload_data_id)));
+        
+        if (workload_sum_and_num_cells[0] > double(0))
+        {
+            const double scale = workload_sum_and_num_cells[1]/workload_sum_and_num_cells[0];
+            
+            double* const w = workload_data->getPointer(0);
+            const int num_cells = static_cast<int>(patch->getBox().size());
+            
+            for (int idx = 0; idx < num_cells; idx++)
+            {
+                w[idx] *= scale;
+            }
+        }
+        else
+        {
+            workload_data->fillAll(1.0);
+        }
+    }
+}
+
+
+/*
+ * Add the measured cost of an operation on a patch to the workload. The cost is shared evenly among
+ * the cells of the given boxes. Nothing is done on the patches without the workload data, e.g. the
+ * temporary patches used to fill data across coarse-fine boundaries.
+ */
+void
+PatchWorkloadMeasurer::addCostToWorkload(
+    hier::Patch& patch,
+    const hier::BoxContainer& cost_boxes,
+    const double cost) const
+{
+    if (!patch.checkAllocated(d_workload_data_id))
+    {
+        return;
+    }
+    
+    HAMERS_SHARED_PTR<pdat::CellData<double> > workload_data(
+        HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
+            patch.getPatchData(d_workload_data_id)));
+    
+    const size_t num_cost_cells = cost_boxes.getTotalSizeOfBoxes();
+    
+    if (num_cost_cells == 0)
+    {
+        return;
+    }
+    
+    const double cost_per_cell = cost/double(num_cost_cells);
+    
+    double* const w = workload_data->getPointer(0);
+    
+    // The workload data has no ghost cells.
+    const hier::Box& patch_box = patch.getBox();
+    const hier::IntVector patch_dims = patch_box.numberCells();
+    
+    for (hier::BoxContainer::const_iterator ib(cost_boxes.begin());
+         ib != cost_boxes.end();
+         ib++)
+    {
+        const hier::Box& cost_box = *ib;
+        
+        if (d_dim == tbox::Dimension(1))
+        {
+            const int i_lo = cost_box.lower(0) - patch_box.lower(0);
+            const int i_hi = cost_box.upper(0) - patch_box.lower(0);
+            
+            for (int i = i_lo; i <= i_hi; i++)
+            {
+                w[i] += cost_per_cell;
+            }
+        }
+        else if (d_dim == tbox::Dimension(2))
+        {
+            const int i_lo = cost_box.lower(0) - patch_box.lower(0);
+            const int i_hi = cost_box.upper(0) - patch_box.lower(0);
+            const int j_lo = cost_box.lower(1) - patch_box.lower(1);
+            const int j_hi = cost_box.upper(1) - patch_box.lower(1);
+            
+            for (int j = j_lo; j <= j_hi; j++)
+            {
+                for (int i = i_lo; i <= i_hi; i++)
+                {
+                    const int idx = i + j*patch_dims[0];
+                    
+                    w[idx] += cost_per_cell;
+                }
+            }
+        }
+        else if (d_dim == tbox::Dimension(3))
+        {
+            const int i_lo = cost_box.lower(0) - patch_box.lower(0);
+            const int i_hi = cost_box.upper(0) - patch_box.lower(0);
+            const int j_lo = cost_box.lower(1) - patch_box.lower(1);
+            const int j_hi = cost_box.upper(1) - patch_box.lower(1);
+            const int k_lo = cost_box.lower(2) - patch_box.lower(2);
+            const int k_hi = cost_box.upper(2) - patch_box.lower(2);
+            
+            for (int k = k_lo; k <= k_hi; k++)
+            {
+                for (int j = j_lo; j <= j_hi; j++)
+                {
+                    for (int i = i_lo; i <= i_hi; i++)
+                    {
+                        const int idx = i + j*patch_dims[0] + k*patch_dims[0]*patch_dims[1];
+                        
+                        w[idx] += cost_per_cell;
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * Add the measured cost of filling the ghost cells at the physical boundaries of a patch to the
+ * workload. The cost is put on the interior cells within the filled ghost cell width from the
+ * physical boundaries, or on the whole patch if the patch has no face on the physical boundaries.
+ */
+void
+PatchWorkloadMeasurer::addPhysicalBoundaryFillCostToWorkload(
+    hier::Patch& patch,
+    const hier::IntVector& ghost_width_to_fill,
+    const double cost) const
+{
+    const HAMERS_SHARED_PTR<geom::CartesianPatchGeometry> patch_geom(
+        HAMERS_SHARED_PTR_CAST<geom::CartesianPatchGeometry, hier::PatchGeometry>(
+            patch.getPatchGeometry()));
+    
+    const std::vector<hier::BoundaryBox>& face_bdry_boxes =
+        patch_geom->getCodimensionBoundaries(1);
+    
+    hier::BoxContainer cost_boxes;
+    
+    for (int bi = 0; bi < static_cast<int>(face_bdry_boxes.size()); bi++)
+    {
+        hier::Box cost_box(face_bdry_boxes[bi].getBox());
+        cost_box.grow(ghost_width_to_fill);
+        cost_box = cost_box*patch.getBox();
+        
+        hier::BoxContainer new_cost_boxes(cost_box);
+        new_cost_boxes.removeIntersections(cost_boxes);
+        cost_boxes.spliceBack(new_cost_boxes);
+    }
+    
+    if (cost_boxes.empty())
+    {
+        cost_boxes.pushBack(patch.getBox());
+    }
+    
+    addCostToWorkload(
+        patch,
+        cost_boxes,
+        cost);
+}
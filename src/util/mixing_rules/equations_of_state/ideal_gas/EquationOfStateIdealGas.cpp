@@ -44,6 +44,49 @@ EquationOfStateIdealGas::getPressure(
 }
 
 
+/*
+ * Compute the pressure of a batch of states stored contiguously.
+ */
+void
+EquationOfStateIdealGas::computePressure(
+    double* const pressure,
+    const double* const density,
+    const double* const internal_energy,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            pressure[idx_state] = (gamma - double(1))*density[idx_state]*internal_energy[idx_state];
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            pressure[idx_state] = (gamma[idx_state] - double(1))*density[idx_state]*internal_energy[idx_state];
+        }
+    }
+}
+
+
 /*
  * Compute the pressure.
  */
@@ -576,6 +619,49 @@ EquationOfStateIdealGas::getSoundSpeed(
 }
 
 
+/*
+ * Compute the sound speed of a batch of states stored contiguously.
+ */
+void
+EquationOfStateIdealGas::computeSoundSpeed(
+    double* const sound_speed,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            sound_speed[idx_state] = sqrt(gamma*pressure[idx_state]/density[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            sound_speed[idx_state] = sqrt(gamma[idx_state]*pressure[idx_state]/density[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the sound speed.
  */
@@ -1108,6 +1194,49 @@ EquationOfStateIdealGas::getInternalEnergy(
 }
 
 
+/*
+ * Compute the specific internal energy of a batch of states stored contiguously.
+ */
+void
+EquationOfStateIdealGas::computeInternalEnergy(
+    double* const internal_energy,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = pressure[idx_state]/((gamma - double(1))*density[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = pressure[idx_state]/((gamma[idx_state] - double(1))*density[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the specific internal energy.
  */
@@ -2173,6 +2302,51 @@ EquationOfStateIdealGas::getTemperature(
 }
 
 
+/*
+ * Compute the temperature of a batch of states stored contiguously.
+ */
+void
+EquationOfStateIdealGas::computeTemperature(
+    double* const temperature,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        const double c_v = thermo_properties[3][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            temperature[idx_state] = pressure[idx_state]/((gamma - double(1))*c_v*density[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        const double* const c_v = thermo_properties[3];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            temperature[idx_state] = pressure[idx_state]/((gamma[idx_state] - double(1))*c_v[idx_state]*density[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the temperature.
  */
@@ -2714,6 +2888,51 @@ EquationOfStateIdealGas::getInternalEnergyFromTemperature(
 }
 
 
+/*
+ * Compute the specific internal energy from temperature of a batch of states stored contiguously.
+ */
+void
+EquationOfStateIdealGas::computeInternalEnergyFromTemperature(
+    double* const internal_energy,
+    const double* const density,
+    const double* const temperature,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+    NULL_USE(density);
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double c_v = thermo_properties[3][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = c_v*temperature[idx_state];
+        }
+    }
+    else
+    {
+        const double* const c_v = thermo_properties[3];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = c_v[idx_state]*temperature[idx_state];
+        }
+    }
+}
+
+
 /*
  * Compute the specific internal energy from temperature.
  */
@@ -4015,6 +4234,52 @@ EquationOfStateIdealGas::getGruneisenParameter(
 }
 
 
+/*
+ * Compute the Gruneisen parameter of a batch of states stored contiguously.
+ */
+void
+EquationOfStateIdealGas::computeGruneisenParameter(
+    double* const gruneisen_parameter,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+    NULL_USE(density);
+    NULL_USE(pressure);
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            gruneisen_parameter[idx_state] = gamma - double(1);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            gruneisen_parameter[idx_state] = gamma[idx_state] - double(1);
+        }
+    }
+}
+
+
 /*
  * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
  * constant density divided by density).
@@ -4923,6 +5188,49 @@ EquationOfStateIdealGas::getDensity(
 }
 
 
+/*
+ * Compute the density of a batch of states stored contiguously.
+ */
+void
+EquationOfStateIdealGas::computeDensity(
+    double* const density,
+    const double* const pressure,
+    const double* const temperature,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double R = thermo_properties[1][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            density[idx_state] = pressure[idx_state]/(R*temperature[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const R = thermo_properties[1];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            density[idx_state] = pressure[idx_state]/(R[idx_state]*temperature[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the density.
  */
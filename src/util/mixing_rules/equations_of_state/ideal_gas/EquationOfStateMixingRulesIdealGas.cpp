@@ -1,4 +1,293 @@
 #include "util/mixing_rules/equations_of_state/ideal_gas/EquationOfStateMixingRulesIdealGas.hpp"
+#include "util/Padded3DIndexing.hpp"
+
+/*
+ * Kernel to compute the thermodynamic properties of the mixture with the mass fractions of all species of a
+ * batch of states stored contiguously. The number of species is fixed at compile time if NUM_SPECIES is
+ * nonzero and c_p and c_v of each state are summed over the species in a single pass.
+ */
+template<int NUM_SPECIES>
+static inline __attribute__((always_inline)) void computeMixtureThermodynamicPropertiesOfStates(
+    double* const gamma,
+    double* const R,
+    double* const c_p,
+    double* const c_v,
+    const double* const* const mass_fractions,
+    const double* const species_c_p,
+    const double* const species_c_v,
+    const int num_species_runtime,
+    const int offset,
+    const int num_states)
+{
+    // The number of species is known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    
+#ifdef HAMERS_ENABLE_SIMD
+    #pragma omp simd
+#endif
+    for (int idx_state = 0; idx_state < num_states; idx_state++)
+    {
+        double c_p_mixture = double(0);
+        double c_v_mixture = double(0);
+        for (int si = 0; si < num_species; si++)
+        {
+            c_p_mixture += mass_fractions[si][offset + idx_state]*species_c_p[si];
+            c_v_mixture += mass_fractions[si][offset + idx_state]*species_c_v[si];
+        }
+        
+        c_p[idx_state] = c_p_mixture;
+        c_v[idx_state] = c_v_mixture;
+        
+        gamma[idx_state] = c_p_mixture/c_v_mixture;
+        R[idx_state] = c_p_mixture - c_v_mixture;
+    }
+}
+
+
+/*
+ * Kernel to compute the thermodynamic properties of the mixture with the mass fractions of all species on a
+ * domain. The number of dimensions DIM is fixed at compile time and so is the number of species if NUM_SPECIES
+ * is nonzero. c_p and c_v of each cell are summed over the species in a single pass.
+ */
+template<int DIM, int NUM_SPECIES>
+static inline __attribute__((always_inline)) void computeMixtureThermodynamicPropertiesOfCells(
+    double* const gamma,
+    double* const R,
+    double* const c_p,
+    double* const c_v,
+    const std::vector<const double*>& Y,
+    const double* const species_c_p,
+    const double* const species_c_v,
+    const int num_species_runtime,
+    const hier::IntVector& offset_mixture_thermo_properties,
+    const hier::IntVector& offset_mass_fractions,
+    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
+    const hier::IntVector& ghostcell_dims_mass_fractions,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    // The number of species is known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_mixture, offset_Y;
+    int stride_mixture[3], stride_Y[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_mixture, stride_mixture, offset_mixture_thermo_properties,
+        ghostcell_dims_mixture_thermo_properties, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_Y, stride_Y, offset_mass_fractions,
+        ghostcell_dims_mass_fractions, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_mixture_j = offset_mixture + j*stride_mixture[1] + k*stride_mixture[2];
+            const int idx_Y_j = offset_Y + j*stride_Y[1] + k*stride_Y[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                const int idx_mixture = idx_mixture_j + i;
+                const int idx_Y = idx_Y_j + i;
+                
+                double c_p_mixture = double(0);
+                double c_v_mixture = double(0);
+                for (int si = 0; si < num_species; si++)
+                {
+                    c_p_mixture += Y[si][idx_Y]*species_c_p[si];
+                    c_v_mixture += Y[si][idx_Y]*species_c_v[si];
+                }
+                
+                c_p[idx_mixture] = c_p_mixture;
+                c_v[idx_mixture] = c_v_mixture;
+                
+                gamma[idx_mixture] = c_p_mixture/c_v_mixture;
+                R[idx_mixture] = c_p_mixture - c_v_mixture;
+            }
+        }
+    }
+}
+
+
+/*
+ * Dispatch the kernel over cells to the instantiations with two or three species, or with the number of
+ * species at run time otherwise.
+ */
+template<int DIM>
+static inline void computeMixtureThermodynamicPropertiesOfCellsForNumberOfSpecies(
+    double* const gamma,
+    double* const R,
+    double* const c_p,
+    double* const c_v,
+    const std::vector<const double*>& Y,
+    const double* const species_c_p,
+    const double* const species_c_v,
+    const int num_species,
+    const hier::IntVector& offset_mixture_thermo_properties,
+    const hier::IntVector& offset_mass_fractions,
+    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
+    const hier::IntVector& ghostcell_dims_mass_fractions,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    if (num_species == 2)
+    {
+        computeMixtureThermodynamicPropertiesOfCells<DIM, 2>(gamma, R, c_p, c_v, Y, species_c_p, species_c_v,
+            num_species, offset_mixture_thermo_properties, offset_mass_fractions,
+            ghostcell_dims_mixture_thermo_properties, ghostcell_dims_mass_fractions, domain_lo, domain_dims);
+    }
+    else if (num_species == 3)
+    {
+        computeMixtureThermodynamicPropertiesOfCells<DIM, 3>(gamma, R, c_p, c_v, Y, species_c_p, species_c_v,
+            num_species, offset_mixture_thermo_properties, offset_mass_fractions,
+            ghostcell_dims_mixture_thermo_properties, ghostcell_dims_mass_fractions, domain_lo, domain_dims);
+    }
+    else
+    {
+        computeMixtureThermodynamicPropertiesOfCells<DIM, 0>(gamma, R, c_p, c_v, Y, species_c_p, species_c_v,
+            num_species, offset_mixture_thermo_properties, offset_mass_fractions,
+            ghostcell_dims_mixture_thermo_properties, ghostcell_dims_mass_fractions, domain_lo, domain_dims);
+    }
+}
+
+
+/*
+ * Kernel to compute the ratio of specific heats of the mixture with the volume fractions of all species, or of
+ * all species except the last one if WITH_LAST is true, on a domain. The number of dimensions DIM is fixed at
+ * compile time and so is the number of species if NUM_SPECIES is nonzero. The volume fractions are added to
+ * the values of the mixture and of the last volume fraction on entry in a single pass over the cells.
+ */
+template<int DIM, int NUM_SPECIES, bool WITH_LAST>
+static inline __attribute__((always_inline)) void computeMixtureGammaWithVolumeFractionsOfCells(
+    double* const gamma,
+    double* const Z_last,
+    const std::vector<const double*>& Z,
+    const double* const species_gamma,
+    const int num_species_runtime,
+    const hier::IntVector& offset_mixture_thermo_properties,
+    const hier::IntVector& offset_volume_fractions_last,
+    const hier::IntVector& offset_volume_fractions,
+    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
+    const hier::IntVector& ghostcell_dims_volume_fractions_last,
+    const hier::IntVector& ghostcell_dims_volume_fractions,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    // The number of species is known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_volume_fractions = (WITH_LAST ? num_species - 1 : num_species);
+    
+    double one_over_denominator[num_species];
+    for (int si = 0; si < num_species; si++)
+    {
+        one_over_denominator[si] = double(1)/(species_gamma[si] - double(1));
+    }
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_mixture, offset_Z_last, offset_Z;
+    int stride_mixture[3], stride_Z_last[3], stride_Z[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_mixture, stride_mixture, offset_mixture_thermo_properties,
+        ghostcell_dims_mixture_thermo_properties, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_Z_last, stride_Z_last, offset_volume_fractions_last,
+        ghostcell_dims_volume_fractions_last, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_Z, stride_Z, offset_volume_fractions,
+        ghostcell_dims_volume_fractions, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_mixture_j = offset_mixture + j*stride_mixture[1] + k*stride_mixture[2];
+            const int idx_Z_last_j = offset_Z_last + j*stride_Z_last[1] + k*stride_Z_last[2];
+            const int idx_Z_j = offset_Z + j*stride_Z[1] + k*stride_Z[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                const int idx_mixture = idx_mixture_j + i;
+                const int idx_Z = idx_Z_j + i;
+                
+                // Compute xi.
+                double xi = gamma[idx_mixture];
+                for (int si = 0; si < num_volume_fractions; si++)
+                {
+                    xi += Z[si][idx_Z]*one_over_denominator[si];
+                }
+                
+                if (WITH_LAST)
+                {
+                    // Compute the volume fraction of the last species and add its contribution.
+                    const int idx_Z_last = idx_Z_last_j + i;
+                    
+                    double Z_last_cell = Z_last[idx_Z_last];
+                    for (int si = 0; si < num_volume_fractions; si++)
+                    {
+                        Z_last_cell -= Z[si][idx_Z];
+                    }
+                    
+                    Z_last[idx_Z_last] = Z_last_cell;
+                    xi += Z_last_cell/(species_gamma[num_species - 1] - double(1));
+                }
+                
+                gamma[idx_mixture] = double(1)/xi + double(1);
+            }
+        }
+    }
+}
+
+/*
+ * Dispatch the kernel of the ratio of specific heats with volume fractions to the instantiations with two or
+ * three species, or with the number of species at run time otherwise.
+ */
+template<int DIM, bool WITH_LAST>
+static inline void computeMixtureGammaWithVolumeFractionsOfCellsForNumberOfSpecies(
+    double* const gamma,
+    double* const Z_last,
+    const std::vector<const double*>& Z,
+    const double* const species_gamma,
+    const int num_species,
+    const hier::IntVector& offset_mixture_thermo_properties,
+    const hier::IntVector& offset_volume_fractions_last,
+    const hier::IntVector& offset_volume_fractions,
+    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
+    const hier::IntVector& ghostcell_dims_volume_fractions_last,
+    const hier::IntVector& ghostcell_dims_volume_fractions,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    if (num_species == 2)
+    {
+        computeMixtureGammaWithVolumeFractionsOfCells<DIM, 2, WITH_LAST>(gamma, Z_last, Z, species_gamma,
+            num_species, offset_mixture_thermo_properties, offset_volume_fractions_last, offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties, ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions, domain_lo, domain_dims);
+    }
+    else if (num_species == 3)
+    {
+        computeMixtureGammaWithVolumeFractionsOfCells<DIM, 3, WITH_LAST>(gamma, Z_last, Z, species_gamma,
+            num_species, offset_mixture_thermo_properties, offset_volume_fractions_last, offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties, ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions, domain_lo, domain_dims);
+    }
+    else
+    {
+        computeMixtureGammaWithVolumeFractionsOfCells<DIM, 0, WITH_LAST>(gamma, Z_last, Z, species_gamma,
+            num_species, offset_mixture_thermo_properties, offset_volume_fractions_last, offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties, ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions, domain_lo, domain_dims);
+    }
+}
+
 
 EquationOfStateMixingRulesIdealGas::EquationOfStateMixingRulesIdealGas(
     const std::string& object_name,
@@ -237,6 +526,60 @@ EquationOfStateMixingRulesIdealGas::getPressure(
 }
 
 
+/*
+ * Compute the pressure of the mixture of a batch of states stored contiguously with isothermal
+ * and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computePressure(
+    double* const pressure,
+    const double* const density,
+    const double* const internal_energy,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT((num_mass_fractions == d_num_species) ||
+                (num_mass_fractions == d_num_species - 1));
+#endif
+    
+    // Get the mixture thermodynamic properties of the states in chunks stored on the stack.
+    double mixture_thermo_properties[4*s_max_num_states_batch];
+    double* const mixture_thermo_properties_ptr[4] = {
+        &mixture_thermo_properties[0],
+        &mixture_thermo_properties[s_max_num_states_batch],
+        &mixture_thermo_properties[2*s_max_num_states_batch],
+        &mixture_thermo_properties[3*s_max_num_states_batch] };
+    
+    for (int idx_state_begin = 0; idx_state_begin < num_states; idx_state_begin += s_max_num_states_batch)
+    {
+        int num_states_batch = num_states - idx_state_begin;
+        if (num_states_batch > s_max_num_states_batch)
+        {
+            num_states_batch = s_max_num_states_batch;
+        }
+        
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            mixture_thermo_properties_ptr,
+            mass_fractions,
+            num_mass_fractions,
+            idx_state_begin,
+            num_states_batch);
+        
+        d_equation_of_state->computePressure(
+            pressure + idx_state_begin,
+            density + idx_state_begin,
+            internal_energy + idx_state_begin,
+            mixture_thermo_properties_ptr,
+            1,
+            num_states_batch);
+    }
+}
+
+
 /*
  * Compute the pressure of the mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -725,6 +1068,60 @@ EquationOfStateMixingRulesIdealGas::getInternalEnergy(
 }
 
 
+/*
+ * Compute the specific internal energy of the mixture of a batch of states stored contiguously with
+ * isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeInternalEnergy(
+    double* const internal_energy,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT((num_mass_fractions == d_num_species) ||
+                (num_mass_fractions == d_num_species - 1));
+#endif
+    
+    // Get the mixture thermodynamic properties of the states in chunks stored on the stack.
+    double mixture_thermo_properties[4*s_max_num_states_batch];
+    double* const mixture_thermo_properties_ptr[4] = {
+        &mixture_thermo_properties[0],
+        &mixture_thermo_properties[s_max_num_states_batch],
+        &mixture_thermo_properties[2*s_max_num_states_batch],
+        &mixture_thermo_properties[3*s_max_num_states_batch] };
+    
+    for (int idx_state_begin = 0; idx_state_begin < num_states; idx_state_begin += s_max_num_states_batch)
+    {
+        int num_states_batch = num_states - idx_state_begin;
+        if (num_states_batch > s_max_num_states_batch)
+        {
+            num_states_batch = s_max_num_states_batch;
+        }
+        
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            mixture_thermo_properties_ptr,
+            mass_fractions,
+            num_mass_fractions,
+            idx_state_begin,
+            num_states_batch);
+        
+        d_equation_of_state->computeInternalEnergy(
+            internal_energy + idx_state_begin,
+            density + idx_state_begin,
+            pressure + idx_state_begin,
+            mixture_thermo_properties_ptr,
+            1,
+            num_states_batch);
+    }
+}
+
+
 /*
  * Compute the specific internal energy of the mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -1213,6 +1610,60 @@ EquationOfStateMixingRulesIdealGas::getTemperature(
 }
 
 
+/*
+ * Compute the temperature of the mixture of a batch of states stored contiguously with
+ * isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeTemperature(
+    double* const temperature,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT((num_mass_fractions == d_num_species) ||
+                (num_mass_fractions == d_num_species - 1));
+#endif
+    
+    // Get the mixture thermodynamic properties of the states in chunks stored on the stack.
+    double mixture_thermo_properties[4*s_max_num_states_batch];
+    double* const mixture_thermo_properties_ptr[4] = {
+        &mixture_thermo_properties[0],
+        &mixture_thermo_properties[s_max_num_states_batch],
+        &mixture_thermo_properties[2*s_max_num_states_batch],
+        &mixture_thermo_properties[3*s_max_num_states_batch] };
+    
+    for (int idx_state_begin = 0; idx_state_begin < num_states; idx_state_begin += s_max_num_states_batch)
+    {
+        int num_states_batch = num_states - idx_state_begin;
+        if (num_states_batch > s_max_num_states_batch)
+        {
+            num_states_batch = s_max_num_states_batch;
+        }
+        
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            mixture_thermo_properties_ptr,
+            mass_fractions,
+            num_mass_fractions,
+            idx_state_begin,
+            num_states_batch);
+        
+        d_equation_of_state->computeTemperature(
+            temperature + idx_state_begin,
+            density + idx_state_begin,
+            pressure + idx_state_begin,
+            mixture_thermo_properties_ptr,
+            1,
+            num_states_batch);
+    }
+}
+
+
 /*
  * Compute the temperature of the mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -1455,6 +1906,60 @@ EquationOfStateMixingRulesIdealGas::getInternalEnergyFromTemperature(
 }
 
 
+/*
+ * Compute the specific internal energy of the mixture from temperature of a batch of states stored
+ * contiguously with isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeInternalEnergyFromTemperature(
+    double* const internal_energy,
+    const double* const density,
+    const double* const temperature,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT((num_mass_fractions == d_num_species) ||
+                (num_mass_fractions == d_num_species - 1));
+#endif
+    
+    // Get the mixture thermodynamic properties of the states in chunks stored on the stack.
+    double mixture_thermo_properties[4*s_max_num_states_batch];
+    double* const mixture_thermo_properties_ptr[4] = {
+        &mixture_thermo_properties[0],
+        &mixture_thermo_properties[s_max_num_states_batch],
+        &mixture_thermo_properties[2*s_max_num_states_batch],
+        &mixture_thermo_properties[3*s_max_num_states_batch] };
+    
+    for (int idx_state_begin = 0; idx_state_begin < num_states; idx_state_begin += s_max_num_states_batch)
+    {
+        int num_states_batch = num_states - idx_state_begin;
+        if (num_states_batch > s_max_num_states_batch)
+        {
+            num_states_batch = s_max_num_states_batch;
+        }
+        
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            mixture_thermo_properties_ptr,
+            mass_fractions,
+            num_mass_fractions,
+            idx_state_begin,
+            num_states_batch);
+        
+        d_equation_of_state->computeInternalEnergyFromTemperature(
+            internal_energy + idx_state_begin,
+            density + idx_state_begin,
+            temperature + idx_state_begin,
+            mixture_thermo_properties_ptr,
+            1,
+            num_states_batch);
+    }
+}
+
+
 /*
  * Compute the specific internal energy of the mixture from temperature with isothermal
  * and isobaric equilibrium assumptions.
@@ -2641,6 +3146,60 @@ EquationOfStateMixingRulesIdealGas::getGruneisenParameter(
 }
 
 
+/*
+ * Compute the Gruneisen parameter of the mixture of a batch of states stored contiguously with
+ * isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeGruneisenParameter(
+    double* const gruneisen_parameter,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT((num_mass_fractions == d_num_species) ||
+                (num_mass_fractions == d_num_species - 1));
+#endif
+    
+    // Get the mixture thermodynamic properties of the states in chunks stored on the stack.
+    double mixture_thermo_properties[4*s_max_num_states_batch];
+    double* const mixture_thermo_properties_ptr[4] = {
+        &mixture_thermo_properties[0],
+        &mixture_thermo_properties[s_max_num_states_batch],
+        &mixture_thermo_properties[2*s_max_num_states_batch],
+        &mixture_thermo_properties[3*s_max_num_states_batch] };
+    
+    for (int idx_state_begin = 0; idx_state_begin < num_states; idx_state_begin += s_max_num_states_batch)
+    {
+        int num_states_batch = num_states - idx_state_begin;
+        if (num_states_batch > s_max_num_states_batch)
+        {
+            num_states_batch = s_max_num_states_batch;
+        }
+        
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            mixture_thermo_properties_ptr,
+            mass_fractions,
+            num_mass_fractions,
+            idx_state_begin,
+            num_states_batch);
+        
+        d_equation_of_state->computeGruneisenParameter(
+            gruneisen_parameter + idx_state_begin,
+            density + idx_state_begin,
+            pressure + idx_state_begin,
+            mixture_thermo_properties_ptr,
+            1,
+            num_states_batch);
+    }
+}
+
+
 /*
  * Compute the Gruneisen parameter of the mixture with isothermal and isobaric equilibrium assumptions
  * (partial derivative of pressure w.r.t. specific internal energy under constant partial densities
@@ -3151,17 +3710,89 @@ EquationOfStateMixingRulesIdealGas::getPressureDerivativeWithPartialDensities(
 
 
 /*
- * Compute the mixture partial derivative of pressure w.r.t. partial densities under constant specific
- * internal energy with isothermal and isobaric equilibrium assumptions.
+ * Compute the mixture partial derivative of pressure w.r.t. partial densities of a batch of states
+ * stored contiguously under constant specific internal energy with isothermal and isobaric equilibrium
+ * assumptions.
  */
 void
 EquationOfStateMixingRulesIdealGas::computePressureDerivativeWithPartialDensities(
-    HAMERS_SHARED_PTR<pdat::CellData<double> >& data_partial_pressure_partial_partial_densities,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_density,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_pressure,
-    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_mass_fractions,
-    const hier::Box& domain) const
-{
+    double* const* const partial_pressure_partial_partial_densities,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT((num_mass_fractions == d_num_species) ||
+                (num_mass_fractions == d_num_species - 1));
+#endif
+    
+    // Get the mixture thermodynamic properties of the states in chunks stored on the stack.
+    double mixture_thermo_properties[4*s_max_num_states_batch];
+    double* const mixture_thermo_properties_ptr[4] = {
+        &mixture_thermo_properties[0],
+        &mixture_thermo_properties[s_max_num_states_batch],
+        &mixture_thermo_properties[2*s_max_num_states_batch],
+        &mixture_thermo_properties[3*s_max_num_states_batch] };
+    
+    for (int idx_state_begin = 0; idx_state_begin < num_states; idx_state_begin += s_max_num_states_batch)
+    {
+        int num_states_batch = num_states - idx_state_begin;
+        if (num_states_batch > s_max_num_states_batch)
+        {
+            num_states_batch = s_max_num_states_batch;
+        }
+        
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            mixture_thermo_properties_ptr,
+            mass_fractions,
+            num_mass_fractions,
+            idx_state_begin,
+            num_states_batch);
+        
+        const double* const gamma = mixture_thermo_properties_ptr[0];
+        const double* const c_v   = mixture_thermo_properties_ptr[3];
+        
+        const double* const rho = density + idx_state_begin;
+        const double* const p   = pressure + idx_state_begin;
+        
+        for (int si = 0; si < d_num_species; si++)
+        {
+            double* const Psi = partial_pressure_partial_partial_densities[si] + idx_state_begin;
+            
+            const double c_p_i = d_species_c_p[si];
+            const double c_v_i = d_species_c_v[si];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int idx_state = 0; idx_state < num_states_batch; idx_state++)
+            {
+                const double epsilon = p[idx_state]/((gamma[idx_state] - double(1))*rho[idx_state]);
+                
+                Psi[idx_state] = ((c_p_i - gamma[idx_state]*c_v_i)/c_v[idx_state] + gamma[idx_state] - double(1))*
+                    epsilon;
+            }
+        }
+    }
+}
+
+
+/*
+ * Compute the mixture partial derivative of pressure w.r.t. partial densities under constant specific
+ * internal energy with isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computePressureDerivativeWithPartialDensities(
+    HAMERS_SHARED_PTR<pdat::CellData<double> >& data_partial_pressure_partial_partial_densities,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_density,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_pressure,
+    const HAMERS_SHARED_PTR<pdat::CellData<double> >& data_mass_fractions,
+    const hier::Box& domain) const
+{
 #ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
     TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
                 (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
@@ -4279,6 +4910,60 @@ EquationOfStateMixingRulesIdealGas::getMixtureDensity(
 }
 
 
+/*
+ * Compute the density of mixture of a batch of states stored contiguously with isothermal and
+ * isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeMixtureDensity(
+    double* const mixture_density,
+    const double* const pressure,
+    const double* const temperature,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT((d_mixing_closure_model == MIXING_CLOSURE_MODEL::ISOTHERMAL_AND_ISOBARIC) ||
+                (d_mixing_closure_model == MIXING_CLOSURE_MODEL::NO_MODEL && d_num_species == 1));
+    TBOX_ASSERT((num_mass_fractions == d_num_species) ||
+                (num_mass_fractions == d_num_species - 1));
+#endif
+    
+    // Get the mixture thermodynamic properties of the states in chunks stored on the stack.
+    double mixture_thermo_properties[4*s_max_num_states_batch];
+    double* const mixture_thermo_properties_ptr[4] = {
+        &mixture_thermo_properties[0],
+        &mixture_thermo_properties[s_max_num_states_batch],
+        &mixture_thermo_properties[2*s_max_num_states_batch],
+        &mixture_thermo_properties[3*s_max_num_states_batch] };
+    
+    for (int idx_state_begin = 0; idx_state_begin < num_states; idx_state_begin += s_max_num_states_batch)
+    {
+        int num_states_batch = num_states - idx_state_begin;
+        if (num_states_batch > s_max_num_states_batch)
+        {
+            num_states_batch = s_max_num_states_batch;
+        }
+        
+        getMixtureThermodynamicPropertiesWithMassFractions(
+            mixture_thermo_properties_ptr,
+            mass_fractions,
+            num_mass_fractions,
+            idx_state_begin,
+            num_states_batch);
+        
+        d_equation_of_state->computeDensity(
+            mixture_density + idx_state_begin,
+            pressure + idx_state_begin,
+            temperature + idx_state_begin,
+            mixture_thermo_properties_ptr,
+            1,
+            num_states_batch);
+    }
+}
+
+
 /*
  * Compute the density of mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -4732,6 +5417,119 @@ EquationOfStateMixingRulesIdealGas::getMixtureThermodynamicPropertiesWithMassFra
 }
 
 
+/*
+ * Compute the thermodynamic properties of the mixture with mass fractions of the states
+ * [offset, offset + num_states) of a batch of states stored contiguously.
+ */
+void
+EquationOfStateMixingRulesIdealGas::getMixtureThermodynamicPropertiesWithMassFractions(
+    double* const* const mixture_thermo_properties,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int offset,
+    const int num_states) const
+{
+    // Get pointers to gamma and R of mixture.
+    double* const gamma = mixture_thermo_properties[0];
+    double* const R = mixture_thermo_properties[1];
+    
+    // Get pointers to c_p and c_v of mixture.
+    double* const c_p = mixture_thermo_properties[2];
+    double* const c_v = mixture_thermo_properties[3];
+    
+    if (num_mass_fractions == d_num_species)
+    {
+        if (d_num_species == 2)
+        {
+            computeMixtureThermodynamicPropertiesOfStates<2>(gamma, R, c_p, c_v, mass_fractions,
+                d_species_c_p.data(), d_species_c_v.data(), d_num_species, offset, num_states);
+        }
+        else if (d_num_species == 3)
+        {
+            computeMixtureThermodynamicPropertiesOfStates<3>(gamma, R, c_p, c_v, mass_fractions,
+                d_species_c_p.data(), d_species_c_v.data(), d_num_species, offset, num_states);
+        }
+        else
+        {
+            computeMixtureThermodynamicPropertiesOfStates<0>(gamma, R, c_p, c_v, mass_fractions,
+                d_species_c_p.data(), d_species_c_v.data(), d_num_species, offset, num_states);
+        }
+    }
+    else if (num_mass_fractions == d_num_species - 1)
+    {
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            c_p[idx_state] = double(0);
+            c_v[idx_state] = double(0);
+        }
+        
+        // Use the storage of R for the mass fraction of the last species.
+        double* const Y_last = R;
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            Y_last[idx_state] = double(1);
+        }
+        
+        for (int si = 0; si < d_num_species - 1; si++)
+        {
+            const double* const Y = mass_fractions[si] + offset;
+            
+            const double c_p_species = d_species_c_p[si];
+            const double c_v_species = d_species_c_v[si];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int idx_state = 0; idx_state < num_states; idx_state++)
+            {
+                c_p[idx_state] += Y[idx_state]*c_p_species;
+                c_v[idx_state] += Y[idx_state]*c_v_species;
+                
+                // Compute the mass fraction of the last species.
+                Y_last[idx_state] -= Y[idx_state];
+            }
+        }
+        
+        // Add the contribution from the last species.
+        const double c_p_last = d_species_c_p.back();
+        const double c_v_last = d_species_c_v.back();
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            c_p[idx_state] += Y_last[idx_state]*c_p_last;
+            c_v[idx_state] += Y_last[idx_state]*c_v_last;
+        }
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            gamma[idx_state] = c_p[idx_state]/c_v[idx_state];
+            R[idx_state] = c_p[idx_state] - c_v[idx_state];
+        }
+    }
+    else
+    {
+        TBOX_ERROR(d_object_name
+            << ": "
+            << "Number of mass fractions provided is not"
+            << " equal to the total number of species or (total number of species - 1)."
+            << std::endl);
+    }
+}
+
+
 /*
  * Compute the thermodynamic properties of the mixture with mass fractions.
  */
@@ -6955,6 +7753,83 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
     const hier::IntVector& ghostcell_dims_mass_fractions,
     const hier::IntVector& domain_lo,
     const hier::IntVector& domain_dims) const
+{
+    if (d_dim == tbox::Dimension(1))
+    {
+        computeMixtureThermodynamicPropertiesOfCellsForNumberOfSpecies<1>(
+            gamma,
+            R,
+            c_p,
+            c_v,
+            Y,
+            d_species_c_p.data(),
+            d_species_c_v.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_mass_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_mass_fractions,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(2))
+    {
+        computeMixtureThermodynamicPropertiesOfCellsForNumberOfSpecies<2>(
+            gamma,
+            R,
+            c_p,
+            c_v,
+            Y,
+            d_species_c_p.data(),
+            d_species_c_v.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_mass_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_mass_fractions,
+            domain_lo,
+            domain_dims);
+    }
+    else if (d_dim == tbox::Dimension(3))
+    {
+        computeMixtureThermodynamicPropertiesOfCellsForNumberOfSpecies<3>(
+            gamma,
+            R,
+            c_p,
+            c_v,
+            Y,
+            d_species_c_p.data(),
+            d_species_c_v.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_mass_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_mass_fractions,
+            domain_lo,
+            domain_dims);
+    }
+}
+
+
+/*
+ * Compute the thermodynamic properties of the mixture with mass fractions.
+ */
+void
+EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMassFractions(
+    double* const gamma,
+    double* const R,
+    double* const c_p,
+    double* const c_v,
+    double* const Y_last,
+    const std::vector<const double*>& Y,
+    const hier::IntVector& offset_mixture_thermo_properties,
+    const hier::IntVector& offset_mass_fractions_last,
+    const hier::IntVector& offset_mass_fractions,
+    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
+    const hier::IntVector& ghostcell_dims_mass_fractions_last,
+    const hier::IntVector& ghostcell_dims_mass_fractions,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims) const
 {
     if (d_dim == tbox::Dimension(1))
     {
@@ -6966,10 +7841,11 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
         const int domain_dim_0 = domain_dims[0];
         
         const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
+        const int offset_0_mass_fractions_last = offset_mass_fractions_last[0];
         const int offset_0_mass_fractions = offset_mass_fractions[0];
         
         // Compute c_p and c_v.
-        for (int si = 0; si < d_num_species; si++)
+        for (int si = 0; si < d_num_species - 1; si++)
         {
 #ifdef HAMERS_ENABLE_SIMD
             #pragma omp simd
@@ -6978,14 +7854,18 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
             {
                 // Compute the linear indices.
                 const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
+                const int idx_mass_fractions_last = i + offset_0_mass_fractions_last;
                 const int idx_mass_fractions = i + offset_0_mass_fractions;
                 
                 c_p[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_p[si];
                 c_v[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_v[si];
+                
+                // Compute the mass fraction of the last species.
+                Y_last[idx_mass_fractions_last] -= Y[si][idx_mass_fractions];
             }
         }
         
-        // Compute gamma and R.
+        // Add the contribution from the last species and compute gamma and R.
 #ifdef HAMERS_ENABLE_SIMD
         #pragma omp simd
 #endif
@@ -6993,6 +7873,10 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
         {
             // Compute the linear indices.
             const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
+            const int idx_mass_fractions_last = i + offset_0_mass_fractions_last;
+            
+            c_p[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_p.back();
+            c_v[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_v.back();
             
             gamma[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties]/
                 c_v[idx_mixture_thermo_properties];
@@ -7015,12 +7899,16 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
         const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
         const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
         
+        const int offset_0_mass_fractions_last = offset_mass_fractions_last[0];
+        const int offset_1_mass_fractions_last = offset_mass_fractions_last[1];
+        const int ghostcell_dim_0_mass_fractions_last = ghostcell_dims_mass_fractions_last[0];
+        
         const int offset_0_mass_fractions = offset_mass_fractions[0];
         const int offset_1_mass_fractions = offset_mass_fractions[1];
         const int ghostcell_dim_0_mass_fractions = ghostcell_dims_mass_fractions[0];
         
         // Compute c_p and c_v.
-        for (int si = 0; si < d_num_species; si++)
+        for (int si = 0; si < d_num_species - 1; si++)
         {
             for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
             {
@@ -7033,16 +7921,22 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
                     const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
                         (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
                     
+                    const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
+                        (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last;
+                    
                     const int idx_mass_fractions = (i + offset_0_mass_fractions) +
                         (j + offset_1_mass_fractions)*ghostcell_dim_0_mass_fractions;
                     
                     c_p[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_p[si];
                     c_v[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_v[si];
+                    
+                    // Compute the mass fraction of the last species.
+                    Y_last[idx_mass_fractions_last] -= Y[si][idx_mass_fractions];
                 }
             }
         }
         
-        // Compute gamma and R.
+        // Add the contribution from the last species and compute gamma and R.
         for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
         {
 #ifdef HAMERS_ENABLE_SIMD
@@ -7054,6 +7948,12 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
                 const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
                     (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
                 
+                const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
+                    (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last;
+                
+                c_p[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_p.back();
+                c_v[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_v.back();
+                
                 gamma[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties]/
                     c_v[idx_mixture_thermo_properties];
                 R[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties] -
@@ -7080,6 +7980,12 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
         const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
         const int ghostcell_dim_1_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[1];
         
+        const int offset_0_mass_fractions_last = offset_mass_fractions_last[0];
+        const int offset_1_mass_fractions_last = offset_mass_fractions_last[1];
+        const int offset_2_mass_fractions_last = offset_mass_fractions_last[2];
+        const int ghostcell_dim_0_mass_fractions_last = ghostcell_dims_mass_fractions_last[0];
+        const int ghostcell_dim_1_mass_fractions_last = ghostcell_dims_mass_fractions_last[1];
+        
         const int offset_0_mass_fractions = offset_mass_fractions[0];
         const int offset_1_mass_fractions = offset_mass_fractions[1];
         const int offset_2_mass_fractions = offset_mass_fractions[2];
@@ -7087,7 +7993,7 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
         const int ghostcell_dim_1_mass_fractions = ghostcell_dims_mass_fractions[1];
         
         // Compute c_p and c_v.
-        for (int si = 0; si < d_num_species; si++)
+        for (int si = 0; si < d_num_species - 1; si++)
         {
             for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
             {
@@ -7104,6 +8010,11 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
                             (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
                                 ghostcell_dim_1_mixture_thermo_properties;
                         
+                        const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
+                            (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last +
+                            (k + offset_2_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last*
+                                ghostcell_dim_1_mass_fractions_last;
+                        
                         const int idx_mass_fractions = (i + offset_0_mass_fractions) +
                             (j + offset_1_mass_fractions)*ghostcell_dim_0_mass_fractions +
                             (k + offset_2_mass_fractions)*ghostcell_dim_0_mass_fractions*
@@ -7111,12 +8022,15 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
                         
                         c_p[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_p[si];
                         c_v[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_v[si];
+                        
+                        // Compute the mass fraction of the last species.
+                        Y_last[idx_mass_fractions_last] -= Y[si][idx_mass_fractions];
                     }
                 }
             }
         }
         
-        // Compute gamma and R.
+        // Add the contribution from the last species and compute gamma and R.
         for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
         {
             for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
@@ -7132,6 +8046,14 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
                         (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
                             ghostcell_dim_1_mixture_thermo_properties;
                     
+                    const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
+                        (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last +
+                        (k + offset_2_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last*
+                            ghostcell_dim_1_mass_fractions_last;
+                    
+                    c_p[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_p.back();
+                    c_v[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_v.back();
+                    
                     gamma[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties]/
                         c_v[idx_mixture_thermo_properties];
                     R[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties] -
@@ -7144,261 +8066,7 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMas
 
 
 /*
- * Compute the thermodynamic properties of the mixture with mass fractions.
- */
-void
-EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithMassFractions(
-    double* const gamma,
-    double* const R,
-    double* const c_p,
-    double* const c_v,
-    double* const Y_last,
-    const std::vector<const double*>& Y,
-    const hier::IntVector& offset_mixture_thermo_properties,
-    const hier::IntVector& offset_mass_fractions_last,
-    const hier::IntVector& offset_mass_fractions,
-    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
-    const hier::IntVector& ghostcell_dims_mass_fractions_last,
-    const hier::IntVector& ghostcell_dims_mass_fractions,
-    const hier::IntVector& domain_lo,
-    const hier::IntVector& domain_dims) const
-{
-    if (d_dim == tbox::Dimension(1))
-    {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_0_mass_fractions_last = offset_mass_fractions_last[0];
-        const int offset_0_mass_fractions = offset_mass_fractions[0];
-        
-        // Compute c_p and c_v.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-                const int idx_mass_fractions_last = i + offset_0_mass_fractions_last;
-                const int idx_mass_fractions = i + offset_0_mass_fractions;
-                
-                c_p[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_p[si];
-                c_v[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_v[si];
-                
-                // Compute the mass fraction of the last species.
-                Y_last[idx_mass_fractions_last] -= Y[si][idx_mass_fractions];
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma and R.
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear indices.
-            const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-            const int idx_mass_fractions_last = i + offset_0_mass_fractions_last;
-            
-            c_p[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_p.back();
-            c_v[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_v.back();
-            
-            gamma[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties]/
-                c_v[idx_mixture_thermo_properties];
-            R[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties] -
-                c_v[idx_mixture_thermo_properties];
-        }
-    }
-    else if (d_dim == tbox::Dimension(2))
-    {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        
-        const int offset_0_mass_fractions_last = offset_mass_fractions_last[0];
-        const int offset_1_mass_fractions_last = offset_mass_fractions_last[1];
-        const int ghostcell_dim_0_mass_fractions_last = ghostcell_dims_mass_fractions_last[0];
-        
-        const int offset_0_mass_fractions = offset_mass_fractions[0];
-        const int offset_1_mass_fractions = offset_mass_fractions[1];
-        const int ghostcell_dim_0_mass_fractions = ghostcell_dims_mass_fractions[0];
-        
-        // Compute c_p and c_v.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                    
-                    const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
-                        (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last;
-                    
-                    const int idx_mass_fractions = (i + offset_0_mass_fractions) +
-                        (j + offset_1_mass_fractions)*ghostcell_dim_0_mass_fractions;
-                    
-                    c_p[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_p[si];
-                    c_v[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_v[si];
-                    
-                    // Compute the mass fraction of the last species.
-                    Y_last[idx_mass_fractions_last] -= Y[si][idx_mass_fractions];
-                }
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma and R.
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                    (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                
-                const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
-                    (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last;
-                
-                c_p[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_p.back();
-                c_v[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_v.back();
-                
-                gamma[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties]/
-                    c_v[idx_mixture_thermo_properties];
-                R[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties] -
-                    c_v[idx_mixture_thermo_properties];
-            }
-        }
-    }
-    else if (d_dim == tbox::Dimension(3))
-    {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int offset_2_mixture_thermo_properties = offset_mixture_thermo_properties[2];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        const int ghostcell_dim_1_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[1];
-        
-        const int offset_0_mass_fractions_last = offset_mass_fractions_last[0];
-        const int offset_1_mass_fractions_last = offset_mass_fractions_last[1];
-        const int offset_2_mass_fractions_last = offset_mass_fractions_last[2];
-        const int ghostcell_dim_0_mass_fractions_last = ghostcell_dims_mass_fractions_last[0];
-        const int ghostcell_dim_1_mass_fractions_last = ghostcell_dims_mass_fractions_last[1];
-        
-        const int offset_0_mass_fractions = offset_mass_fractions[0];
-        const int offset_1_mass_fractions = offset_mass_fractions[1];
-        const int offset_2_mass_fractions = offset_mass_fractions[2];
-        const int ghostcell_dim_0_mass_fractions = ghostcell_dims_mass_fractions[0];
-        const int ghostcell_dim_1_mass_fractions = ghostcell_dims_mass_fractions[1];
-        
-        // Compute c_p and c_v.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-            {
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                            (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                            (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                                ghostcell_dim_1_mixture_thermo_properties;
-                        
-                        const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
-                            (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last +
-                            (k + offset_2_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last*
-                                ghostcell_dim_1_mass_fractions_last;
-                        
-                        const int idx_mass_fractions = (i + offset_0_mass_fractions) +
-                            (j + offset_1_mass_fractions)*ghostcell_dim_0_mass_fractions +
-                            (k + offset_2_mass_fractions)*ghostcell_dim_0_mass_fractions*
-                                ghostcell_dim_1_mass_fractions;
-                        
-                        c_p[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_p[si];
-                        c_v[idx_mixture_thermo_properties] += Y[si][idx_mass_fractions]*d_species_c_v[si];
-                        
-                        // Compute the mass fraction of the last species.
-                        Y_last[idx_mass_fractions_last] -= Y[si][idx_mass_fractions];
-                    }
-                }
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma and R.
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                        (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                            ghostcell_dim_1_mixture_thermo_properties;
-                    
-                    const int idx_mass_fractions_last = (i + offset_0_mass_fractions_last) +
-                        (j + offset_1_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last +
-                        (k + offset_2_mass_fractions_last)*ghostcell_dim_0_mass_fractions_last*
-                            ghostcell_dim_1_mass_fractions_last;
-                    
-                    c_p[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_p.back();
-                    c_v[idx_mixture_thermo_properties] += Y_last[idx_mass_fractions_last]*d_species_c_v.back();
-                    
-                    gamma[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties]/
-                        c_v[idx_mixture_thermo_properties];
-                    R[idx_mixture_thermo_properties] = c_p[idx_mixture_thermo_properties] -
-                        c_v[idx_mixture_thermo_properties];
-                }
-            }
-        }
-    }
-}
-
-
-/*
- * Compute the thermodynamic properties of the mixture with volume fractions.
+ * Compute the thermodynamic properties of the mixture with volume fractions.
  */
 void
 EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithVolumeFractions(
@@ -7413,181 +8081,54 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithVol
 {
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        
-        // Compute xi and store it in the data of gamma temporarily.
-        for (int si = 0; si < d_num_species; si++)
-        {
-            const double one_over_denominator = double(1)/(d_species_gamma[si] - double(1));
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-                const int idx_volume_fractions = i + offset_0_volume_fractions;
-                
-                gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*one_over_denominator;
-            }
-        }
-        
-        // Compute gamma.
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear index.
-            const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-            
-            gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-        }
+        computeMixtureGammaWithVolumeFractionsOfCellsForNumberOfSpecies<1, false>(
+            gamma,
+            nullptr,
+            Z,
+            d_species_gamma.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        
-        // Compute xi and store it in the data of gamma temporarily.
-        for (int si = 0; si < d_num_species; si++)
-        {
-            const double one_over_denominator = double(1)/(d_species_gamma[si] - double(1));
-            
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                    
-                    const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                        (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
-                    
-                    gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*one_over_denominator;
-                }
-            }
-        }
-        
-        // Compute gamma.
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear index.
-                const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                    (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                
-                gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-            }
-        }
+        computeMixtureGammaWithVolumeFractionsOfCellsForNumberOfSpecies<2, false>(
+            gamma,
+            nullptr,
+            Z,
+            d_species_gamma.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int offset_2_mixture_thermo_properties = offset_mixture_thermo_properties[2];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        const int ghostcell_dim_1_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[1];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int offset_2_volume_fractions = offset_volume_fractions[2];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        const int ghostcell_dim_1_volume_fractions = ghostcell_dims_volume_fractions[1];
-        
-        // Compute xi and store it in the data of gamma temporarily.
-        for (int si = 0; si < d_num_species; si++)
-        {
-            const double one_over_denominator = double(1)/(d_species_gamma[si] - double(1));
-            
-            for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-            {
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                            (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                            (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                                ghostcell_dim_1_mixture_thermo_properties;
-                        
-                        const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                            (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions +
-                            (k + offset_2_volume_fractions)*ghostcell_dim_0_volume_fractions*
-                                ghostcell_dim_1_volume_fractions;
-                        
-                        gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*one_over_denominator;
-                    }
-                }
-            }
-        }
-        
-        // Compute gamma.
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear index.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                        (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                            ghostcell_dim_1_mixture_thermo_properties;
-                    
-                    gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-                }
-            }
-        }
+        computeMixtureGammaWithVolumeFractionsOfCellsForNumberOfSpecies<3, false>(
+            gamma,
+            nullptr,
+            Z,
+            d_species_gamma.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
 }
 
@@ -7611,224 +8152,53 @@ EquationOfStateMixingRulesIdealGas::computeMixtureThermodynamicPropertiesWithVol
 {
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_0_volume_fractions_last = offset_volume_fractions_last[0];
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        
-        // Compute xi and store it in the data of gamma temporarily.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            const double one_over_denominator = double(1)/(d_species_gamma[si] - double(1));
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-                const int idx_volume_fractions_last = i + offset_0_volume_fractions_last;
-                const int idx_volume_fractions = i + offset_0_volume_fractions;
-                
-                gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*one_over_denominator;
-                
-                // Compute the volume fraction of the last species.
-                Z_last[idx_volume_fractions_last] -= Z[si][idx_volume_fractions];
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma.
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear indices.
-            const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-            const int idx_volume_fractions_last = i + offset_0_volume_fractions_last;
-            
-            gamma[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]/
-                (d_species_gamma.back() - double(1));
-            gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-        }
+        computeMixtureGammaWithVolumeFractionsOfCellsForNumberOfSpecies<1, true>(
+            gamma,
+            Z_last,
+            Z,
+            d_species_gamma.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions_last,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        
-        const int offset_0_volume_fractions_last = offset_volume_fractions_last[0];
-        const int offset_1_volume_fractions_last = offset_volume_fractions_last[1];
-        const int ghostcell_dim_0_volume_fractions_last = ghostcell_dims_volume_fractions_last[0];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        
-        // Compute xi and store it in the data of gamma temporarily.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            const double one_over_denominator = double(1)/(d_species_gamma[si] - double(1));
-            
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                    
-                    const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                        (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last;
-                    
-                    const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                        (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
-                    
-                    gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*one_over_denominator;
-                    
-                    // Compute the volume fraction of the last species.
-                    Z_last[idx_volume_fractions_last] -= Z[si][idx_volume_fractions];
-                }
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma.
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                    (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                
-                const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                    (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last;
-                
-                gamma[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]/
-                    (d_species_gamma.back() - double(1));
-                gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-            }
-        }
+        computeMixtureGammaWithVolumeFractionsOfCellsForNumberOfSpecies<2, true>(
+            gamma,
+            Z_last,
+            Z,
+            d_species_gamma.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions_last,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int offset_2_mixture_thermo_properties = offset_mixture_thermo_properties[2];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        const int ghostcell_dim_1_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[1];
-        
-        const int offset_0_volume_fractions_last = offset_volume_fractions_last[0];
-        const int offset_1_volume_fractions_last = offset_volume_fractions_last[1];
-        const int offset_2_volume_fractions_last = offset_volume_fractions_last[2];
-        const int ghostcell_dim_0_volume_fractions_last = ghostcell_dims_volume_fractions_last[0];
-        const int ghostcell_dim_1_volume_fractions_last = ghostcell_dims_volume_fractions_last[1];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int offset_2_volume_fractions = offset_volume_fractions[2];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        const int ghostcell_dim_1_volume_fractions = ghostcell_dims_volume_fractions[1];
-        
-        // Compute xi and store it in the data of gamma temporarily.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            const double one_over_denominator = double(1)/(d_species_gamma[si] - double(1));
-            
-            for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-            {
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                            (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                            (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                                ghostcell_dim_1_mixture_thermo_properties;
-                        
-                        const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                            (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last +
-                            (k + offset_2_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last*
-                                ghostcell_dim_1_volume_fractions_last;
-                        
-                        const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                            (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions +
-                            (k + offset_2_volume_fractions)*ghostcell_dim_0_volume_fractions*
-                                ghostcell_dim_1_volume_fractions;
-                        
-                        gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*one_over_denominator;
-                        
-                        // Compute the volume fraction of the last species.
-                        Z_last[idx_volume_fractions_last] -= Z[si][idx_volume_fractions];
-                    }
-                }
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma.
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                        (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                            ghostcell_dim_1_mixture_thermo_properties;
-                    
-                    const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                        (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last +
-                        (k + offset_2_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last*
-                            ghostcell_dim_1_volume_fractions_last;
-                    
-                    gamma[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]/
-                        (d_species_gamma.back() - double(1));
-                    gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-                }
-            }
-        }
+        computeMixtureGammaWithVolumeFractionsOfCellsForNumberOfSpecies<3, true>(
+            gamma,
+            Z_last,
+            Z,
+            d_species_gamma.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions_last,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
 }
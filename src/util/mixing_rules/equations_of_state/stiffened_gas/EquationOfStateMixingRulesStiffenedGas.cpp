@@ -1,4 +1,153 @@
 #include "util/mixing_rules/equations_of_state/stiffened_gas/EquationOfStateMixingRulesStiffenedGas.hpp"
+#include "util/Padded3DIndexing.hpp"
+
+/*
+ * Kernel to compute the ratio of specific heats and the reference pressure of the mixture with the volume
+ * fractions of all species, or of all species except the last one if WITH_LAST is true, on a domain. The number
+ * of dimensions DIM is fixed at compile time and so is the number of species if NUM_SPECIES is nonzero. The
+ * volume fractions are added to the values of the mixture and of the last volume fraction on entry in a single
+ * pass over the cells.
+ */
+template<int DIM, int NUM_SPECIES, bool WITH_LAST>
+static inline __attribute__((always_inline)) void computeMixturePropertiesWithVolumeFractionsOfCells(
+    double* const gamma,
+    double* const p_inf,
+    double* const Z_last,
+    const std::vector<const double*>& Z,
+    const double* const species_gamma,
+    const double* const species_p_inf,
+    const int num_species_runtime,
+    const hier::IntVector& offset_mixture_thermo_properties,
+    const hier::IntVector& offset_volume_fractions_last,
+    const hier::IntVector& offset_volume_fractions,
+    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
+    const hier::IntVector& ghostcell_dims_volume_fractions_last,
+    const hier::IntVector& ghostcell_dims_volume_fractions,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    // The number of species is known at compile time if NUM_SPECIES is nonzero.
+    const int num_species = (NUM_SPECIES > 0 ? NUM_SPECIES : num_species_runtime);
+    const int num_volume_fractions = (WITH_LAST ? num_species - 1 : num_species);
+    
+    double tmp_1[num_species];
+    double tmp_2[num_species];
+    for (int si = 0; si < num_species; si++)
+    {
+        tmp_1[si] = double(1)/(species_gamma[si] - double(1));
+        tmp_2[si] = species_gamma[si]*species_p_inf[si]/(species_gamma[si] - double(1));
+    }
+    
+    int lo[3];
+    int hi[3];
+    computeLoopBoundsPadded3D<DIM>(lo, hi, domain_lo, domain_dims);
+    
+    int offset_mixture, offset_Z_last, offset_Z;
+    int stride_mixture[3], stride_Z_last[3], stride_Z[3];
+    computeOffsetAndStridesPadded3D<DIM>(offset_mixture, stride_mixture, offset_mixture_thermo_properties,
+        ghostcell_dims_mixture_thermo_properties, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_Z_last, stride_Z_last, offset_volume_fractions_last,
+        ghostcell_dims_volume_fractions_last, -1);
+    computeOffsetAndStridesPadded3D<DIM>(offset_Z, stride_Z, offset_volume_fractions,
+        ghostcell_dims_volume_fractions, -1);
+    
+    for (int k = lo[2]; k < hi[2]; k++)
+    {
+        for (int j = lo[1]; j < hi[1]; j++)
+        {
+            const int idx_mixture_j = offset_mixture + j*stride_mixture[1] + k*stride_mixture[2];
+            const int idx_Z_last_j = offset_Z_last + j*stride_Z_last[1] + k*stride_Z_last[2];
+            const int idx_Z_j = offset_Z + j*stride_Z[1] + k*stride_Z[2];
+            
+#ifdef HAMERS_ENABLE_SIMD
+            #pragma omp simd
+#endif
+            for (int i = lo[0]; i < hi[0]; i++)
+            {
+                const int idx_mixture = idx_mixture_j + i;
+                const int idx_Z = idx_Z_j + i;
+                
+                // Compute the temporary variables.
+                double gamma_cell = gamma[idx_mixture];
+                double p_inf_cell = p_inf[idx_mixture];
+                for (int si = 0; si < num_volume_fractions; si++)
+                {
+                    gamma_cell += Z[si][idx_Z]*tmp_1[si];
+                    p_inf_cell += Z[si][idx_Z]*tmp_2[si];
+                }
+                
+                if (WITH_LAST)
+                {
+                    // Compute the volume fraction of the last species and add its contribution.
+                    const int idx_Z_last = idx_Z_last_j + i;
+                    
+                    double Z_last_cell = Z_last[idx_Z_last];
+                    for (int si = 0; si < num_volume_fractions; si++)
+                    {
+                        Z_last_cell -= Z[si][idx_Z];
+                    }
+                    
+                    Z_last[idx_Z_last] = Z_last_cell;
+                    gamma_cell += Z_last_cell*tmp_1[num_species - 1];
+                    p_inf_cell += Z_last_cell*tmp_2[num_species - 1];
+                }
+                
+                // Compute gamma and p_inf.
+                gamma_cell = double(1)/gamma_cell + double(1);
+                
+                gamma[idx_mixture] = gamma_cell;
+                p_inf[idx_mixture] = (gamma_cell - double(1))/gamma_cell*p_inf_cell;
+            }
+        }
+    }
+}
+
+
+/*
+ * Dispatch the kernel of the ratio of specific heats and the reference pressure with volume fractions to the
+ * instantiations with two or three species, or with the number of species at run time otherwise.
+ */
+template<int DIM, bool WITH_LAST>
+static inline void computeMixturePropertiesWithVolumeFractionsOfCellsForNumberOfSpecies(
+    double* const gamma,
+    double* const p_inf,
+    double* const Z_last,
+    const std::vector<const double*>& Z,
+    const double* const species_gamma,
+    const double* const species_p_inf,
+    const int num_species,
+    const hier::IntVector& offset_mixture_thermo_properties,
+    const hier::IntVector& offset_volume_fractions_last,
+    const hier::IntVector& offset_volume_fractions,
+    const hier::IntVector& ghostcell_dims_mixture_thermo_properties,
+    const hier::IntVector& ghostcell_dims_volume_fractions_last,
+    const hier::IntVector& ghostcell_dims_volume_fractions,
+    const hier::IntVector& domain_lo,
+    const hier::IntVector& domain_dims)
+{
+    if (num_species == 2)
+    {
+        computeMixturePropertiesWithVolumeFractionsOfCells<DIM, 2, WITH_LAST>(gamma, p_inf, Z_last, Z,
+            species_gamma, species_p_inf, num_species, offset_mixture_thermo_properties,
+            offset_volume_fractions_last, offset_volume_fractions, ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last, ghostcell_dims_volume_fractions, domain_lo, domain_dims);
+    }
+    else if (num_species == 3)
+    {
+        computeMixturePropertiesWithVolumeFractionsOfCells<DIM, 3, WITH_LAST>(gamma, p_inf, Z_last, Z,
+            species_gamma, species_p_inf, num_species, offset_mixture_thermo_properties,
+            offset_volume_fractions_last, offset_volume_fractions, ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last, ghostcell_dims_volume_fractions, domain_lo, domain_dims);
+    }
+    else
+    {
+        computeMixturePropertiesWithVolumeFractionsOfCells<DIM, 0, WITH_LAST>(gamma, p_inf, Z_last, Z,
+            species_gamma, species_p_inf, num_species, offset_mixture_thermo_properties,
+            offset_volume_fractions_last, offset_volume_fractions, ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last, ghostcell_dims_volume_fractions, domain_lo, domain_dims);
+    }
+}
+
 
 EquationOfStateMixingRulesStiffenedGas::EquationOfStateMixingRulesStiffenedGas(
     const std::string& object_name,
@@ -308,6 +457,27 @@ EquationOfStateMixingRulesStiffenedGas::getPressure(
 }
 
 
+/*
+ * Compute the pressure of the mixture of a batch of states stored contiguously with isothermal
+ * and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesStiffenedGas::computePressure(
+    double* const pressure,
+    const double* const density,
+    const double* const internal_energy,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+    TBOX_ERROR(d_object_name
+        << ": EquationOfStateMixingRulesStiffenedGas::computePressure()\n"
+        << "Method computePressure() for mixture with isothermal and isobaric equilibrium assumptions"
+        << " is not yet implemented."
+        << std::endl);
+}
+
+
 /*
  * Compute the pressure of the mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -613,6 +783,27 @@ EquationOfStateMixingRulesStiffenedGas::getInternalEnergy(
 }
 
 
+/*
+ * Compute the specific internal energy of the mixture of a batch of states stored contiguously with
+ * isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesStiffenedGas::computeInternalEnergy(
+    double* const internal_energy,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+    TBOX_ERROR(d_object_name
+        << ": EquationOfStateMixingRulesStiffenedGas::computeInternalEnergy()\n"
+        << "Method computeInternalEnergy() for mixture with isothermal and isobaric equilibrium assumptions"
+        << " is not yet implemented."
+        << std::endl);
+}
+
+
 /*
  * Compute the specific internal energy of the mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -918,6 +1109,27 @@ EquationOfStateMixingRulesStiffenedGas::getTemperature(
 }
 
 
+/*
+ * Compute the temperature of the mixture of a batch of states stored contiguously with
+ * isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesStiffenedGas::computeTemperature(
+    double* const temperature,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+    TBOX_ERROR(d_object_name
+        << ": EquationOfStateMixingRulesStiffenedGas::computeTemperature()\n"
+        << "Method computeTemperature() for mixture with isothermal and isobaric equilibrium assumptions"
+        << " is not yet implemented."
+        << std::endl);
+}
+
+
 /*
  * Compute the temperature of the mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -977,6 +1189,27 @@ EquationOfStateMixingRulesStiffenedGas::getInternalEnergyFromTemperature(
 }
 
 
+/*
+ * Compute the specific internal energy of the mixture from temperature of a batch of states stored
+ * contiguously with isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesStiffenedGas::computeInternalEnergyFromTemperature(
+    double* const internal_energy,
+    const double* const density,
+    const double* const temperature,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+    TBOX_ERROR(d_object_name
+        << ": EquationOfStateMixingRulesStiffenedGas::computeInternalEnergyFromTemperature()\n"
+        << "Method computeInternalEnergyFromTemperature() for mixture with isothermal and isobaric equilibrium assumptions"
+        << " is not yet implemented."
+        << std::endl);
+}
+
+
 /*
  * Compute the specific internal energy of the mixture from temperature with isothermal
  * and isobaric equilibrium assumptions.
@@ -1161,6 +1394,27 @@ EquationOfStateMixingRulesStiffenedGas::getGruneisenParameter(
 }
 
 
+/*
+ * Compute the Gruneisen parameter of the mixture of a batch of states stored contiguously with
+ * isothermal and isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesStiffenedGas::computeGruneisenParameter(
+    double* const gruneisen_parameter,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+    TBOX_ERROR(d_object_name
+        << ": EquationOfStateMixingRulesStiffenedGas::computeGruneisenParameter()\n"
+        << "Method computeGruneisenParameter() for mixture with isothermal and isobaric equilibrium assumptions"
+        << " is not yet implemented."
+        << std::endl);
+}
+
+
 /*
  * Compute the Gruneisen parameter of the mixture with isothermal and isobaric equilibrium assumptions
  * (partial derivative of pressure w.r.t. specific internal energy under constant partial densities
@@ -1483,6 +1737,28 @@ EquationOfStateMixingRulesStiffenedGas::getPressureDerivativeWithPartialDensitie
 }
 
 
+/*
+ * Compute the mixture partial derivative of pressure w.r.t. partial densities of a batch of states
+ * stored contiguously under constant specific internal energy with isothermal and isobaric equilibrium
+ * assumptions.
+ */
+void
+EquationOfStateMixingRulesStiffenedGas::computePressureDerivativeWithPartialDensities(
+    double* const* const partial_pressure_partial_partial_densities,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+    TBOX_ERROR(d_object_name
+        << ": EquationOfStateMixingRulesStiffenedGas::computePressureDerivativeWithPartialDensities()\n"
+        << "Method computePressureDerivativeWithPartialDensities() for mixture with isothermal and isobaric equilibrium assumptions"
+        << " is not yet implemented."
+        << std::endl);
+}
+
+
 /*
  * Compute the mixture partial derivative of pressure w.r.t. partial densities under constant specific
  * internal energy with isothermal and isobaric equilibrium assumptions.
@@ -2367,6 +2643,27 @@ EquationOfStateMixingRulesStiffenedGas::getMixtureDensity(
 }
 
 
+/*
+ * Compute the density of mixture of a batch of states stored contiguously with isothermal and
+ * isobaric equilibrium assumptions.
+ */
+void
+EquationOfStateMixingRulesStiffenedGas::computeMixtureDensity(
+    double* const mixture_density,
+    const double* const pressure,
+    const double* const temperature,
+    const double* const* const mass_fractions,
+    const int num_mass_fractions,
+    const int num_states) const
+{
+    TBOX_ERROR(d_object_name
+        << ": EquationOfStateMixingRulesStiffenedGas::computeMixtureDensity()\n"
+        << "Method computeMixtureDensity() for mixture with isothermal and isobaric equilibrium assumptions"
+        << " is not yet implemented."
+        << std::endl);
+}
+
+
 /*
  * Compute the density of mixture with isothermal and isobaric equilibrium assumptions.
  */
@@ -3363,196 +3660,60 @@ EquationOfStateMixingRulesStiffenedGas::computeMixtureThermodynamicPropertiesWit
 {
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        
-        // Compute temporary variables and store them in the data of gamma of p_inf temporarily.
-        for (int si = 0; si < d_num_species; si++)
-        {
-            const double tmp_1 = double(1)/(d_species_gamma[si] - double(1));
-            const double tmp_2 = d_species_gamma[si]*d_species_p_inf[si]/(d_species_gamma[si] - double(1));
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-                const int idx_volume_fractions = i + offset_0_volume_fractions;
-                
-                gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_1;
-                p_inf[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_2;
-            }
-        }
-        
-        // Compute gamma and p_inf.
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear index.
-            const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-            
-            gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-            
-            p_inf[idx_mixture_thermo_properties] = (gamma[idx_mixture_thermo_properties] - double(1))/
-                gamma[idx_mixture_thermo_properties]*p_inf[idx_mixture_thermo_properties];
-        }
+        computeMixturePropertiesWithVolumeFractionsOfCellsForNumberOfSpecies<1, false>(
+            gamma,
+            p_inf,
+            nullptr,
+            Z,
+            d_species_gamma.data(),
+            d_species_p_inf.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        
-        // Compute temporary variables and store them in the data of gamma of p_inf temporarily.
-        for (int si = 0; si < d_num_species; si++)
-        {
-            const double tmp_1 = double(1)/(d_species_gamma[si] - double(1));
-            const double tmp_2 = d_species_gamma[si]*d_species_p_inf[si]/(d_species_gamma[si] - double(1));
-            
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                    
-                    const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                        (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
-                    
-                    gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_1;
-                    p_inf[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_2;
-                }
-            }
-        }
-        
-        // Compute gamma and p_inf.
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear index.
-                const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                    (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                
-                gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-                
-                p_inf[idx_mixture_thermo_properties] = (gamma[idx_mixture_thermo_properties] - double(1))/
-                    gamma[idx_mixture_thermo_properties]*p_inf[idx_mixture_thermo_properties];
-            }
-        }
+        computeMixturePropertiesWithVolumeFractionsOfCellsForNumberOfSpecies<2, false>(
+            gamma,
+            p_inf,
+            nullptr,
+            Z,
+            d_species_gamma.data(),
+            d_species_p_inf.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int offset_2_mixture_thermo_properties = offset_mixture_thermo_properties[2];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        const int ghostcell_dim_1_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[1];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int offset_2_volume_fractions = offset_volume_fractions[2];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        const int ghostcell_dim_1_volume_fractions = ghostcell_dims_volume_fractions[1];
-        
-        // Compute temporary variables and store them in the data of gamma of p_inf temporarily.
-        for (int si = 0; si < d_num_species; si++)
-        {
-            const double tmp_1 = double(1)/(d_species_gamma[si] - double(1));
-            const double tmp_2 = d_species_gamma[si]*d_species_p_inf[si]/(d_species_gamma[si] - double(1));
-            
-            for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-            {
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                            (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                            (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                                ghostcell_dim_1_mixture_thermo_properties;
-                        
-                        const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                            (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions +
-                            (k + offset_2_volume_fractions)*ghostcell_dim_0_volume_fractions*
-                                ghostcell_dim_1_volume_fractions;
-                        
-                        gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_1;
-                        p_inf[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_2;
-                    }
-                }
-            }
-        }
-        
-        // Compute gamma and p_inf.
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear index.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                        (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                            ghostcell_dim_1_mixture_thermo_properties;
-                    
-                    gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-                    
-                    p_inf[idx_mixture_thermo_properties] = (gamma[idx_mixture_thermo_properties] - double(1))/
-                        gamma[idx_mixture_thermo_properties]*p_inf[idx_mixture_thermo_properties];
-                }
-            }
-        }
+        computeMixturePropertiesWithVolumeFractionsOfCellsForNumberOfSpecies<3, false>(
+            gamma,
+            p_inf,
+            nullptr,
+            Z,
+            d_species_gamma.data(),
+            d_species_p_inf.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
 }
 
@@ -3577,254 +3738,59 @@ EquationOfStateMixingRulesStiffenedGas::computeMixtureThermodynamicPropertiesWit
 {
     if (d_dim == tbox::Dimension(1))
     {
-        /*
-         * Get the local lower index, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_dim_0 = domain_dims[0];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_0_volume_fractions_last = offset_volume_fractions_last[0];
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        
-        // Compute temporary variables and store them in the data of gamma of p_inf temporarily.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            const double tmp_1 = double(1)/(d_species_gamma[si] - double(1));
-            const double tmp_2 = d_species_gamma[si]*d_species_p_inf[si]/(d_species_gamma[si] - double(1));
-            
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-                const int idx_volume_fractions_last = i + offset_0_volume_fractions_last;
-                const int idx_volume_fractions = i + offset_0_volume_fractions;
-                
-                gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_1;
-                p_inf[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_2;
-                
-                // Compute the volume fraction of the last species.
-                Z_last[idx_volume_fractions_last] -= Z[si][idx_volume_fractions];
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma and p_inf.
-        
-        const double tmp_1 = double(1)/(d_species_gamma.back() - double(1));
-        const double tmp_2 = d_species_gamma.back()*d_species_p_inf.back()/(d_species_gamma.back() - double(1));
-        
-#ifdef HAMERS_ENABLE_SIMD
-        #pragma omp simd
-#endif
-        for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-        {
-            // Compute the linear indices.
-            const int idx_mixture_thermo_properties = i + offset_0_mixture_thermo_properties;
-            const int idx_volume_fractions_last = i + offset_0_volume_fractions_last;
-            
-            gamma[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]*tmp_1;
-            p_inf[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]*tmp_2;
-            
-            gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-            
-            p_inf[idx_mixture_thermo_properties] = (gamma[idx_mixture_thermo_properties] - double(1))/
-                gamma[idx_mixture_thermo_properties]*p_inf[idx_mixture_thermo_properties];
-        }
+        computeMixturePropertiesWithVolumeFractionsOfCellsForNumberOfSpecies<1, true>(
+            gamma,
+            p_inf,
+            Z_last,
+            Z,
+            d_species_gamma.data(),
+            d_species_p_inf.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions_last,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(2))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        
-        const int offset_0_volume_fractions_last = offset_volume_fractions_last[0];
-        const int offset_1_volume_fractions_last = offset_volume_fractions_last[1];
-        const int ghostcell_dim_0_volume_fractions_last = ghostcell_dims_volume_fractions_last[0];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        
-        // Compute temporary variables and store them in the data of gamma of p_inf temporarily.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            const double tmp_1 = double(1)/(d_species_gamma[si] - double(1));
-            const double tmp_2 = d_species_gamma[si]*d_species_p_inf[si]/(d_species_gamma[si] - double(1));
-            
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                    
-                    const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                        (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last;
-                    
-                    const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                        (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions;
-                    
-                    gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_1;
-                    p_inf[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_2;
-                    
-                    // Compute the volume fraction of the last species.
-                    Z_last[idx_volume_fractions_last] -= Z[si][idx_volume_fractions];
-                }
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma and p_inf.
-        
-        const double tmp_1 = double(1)/(d_species_gamma.back() - double(1));
-        const double tmp_2 = d_species_gamma.back()*d_species_p_inf.back()/(d_species_gamma.back() - double(1));
-        
-        for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-        {
-#ifdef HAMERS_ENABLE_SIMD
-            #pragma omp simd
-#endif
-            for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-            {
-                // Compute the linear indices.
-                const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                    (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties;
-                
-                const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                    (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last;
-                
-                gamma[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]*tmp_1;
-                p_inf[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]*tmp_2;
-                
-                gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-                
-                p_inf[idx_mixture_thermo_properties] = (gamma[idx_mixture_thermo_properties] - double(1))/
-                    gamma[idx_mixture_thermo_properties]*p_inf[idx_mixture_thermo_properties];
-            }
-        }
+        computeMixturePropertiesWithVolumeFractionsOfCellsForNumberOfSpecies<2, true>(
+            gamma,
+            p_inf,
+            Z_last,
+            Z,
+            d_species_gamma.data(),
+            d_species_p_inf.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions_last,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
     else if (d_dim == tbox::Dimension(3))
     {
-        /*
-         * Get the local lower indices, numbers of cells in each dimension and offsets.
-         */
-        
-        const int domain_lo_0 = domain_lo[0];
-        const int domain_lo_1 = domain_lo[1];
-        const int domain_lo_2 = domain_lo[2];
-        const int domain_dim_0 = domain_dims[0];
-        const int domain_dim_1 = domain_dims[1];
-        const int domain_dim_2 = domain_dims[2];
-        
-        const int offset_0_mixture_thermo_properties = offset_mixture_thermo_properties[0];
-        const int offset_1_mixture_thermo_properties = offset_mixture_thermo_properties[1];
-        const int offset_2_mixture_thermo_properties = offset_mixture_thermo_properties[2];
-        const int ghostcell_dim_0_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[0];
-        const int ghostcell_dim_1_mixture_thermo_properties = ghostcell_dims_mixture_thermo_properties[1];
-        
-        const int offset_0_volume_fractions_last = offset_volume_fractions_last[0];
-        const int offset_1_volume_fractions_last = offset_volume_fractions_last[1];
-        const int offset_2_volume_fractions_last = offset_volume_fractions_last[2];
-        const int ghostcell_dim_0_volume_fractions_last = ghostcell_dims_volume_fractions_last[0];
-        const int ghostcell_dim_1_volume_fractions_last = ghostcell_dims_volume_fractions_last[1];
-        
-        const int offset_0_volume_fractions = offset_volume_fractions[0];
-        const int offset_1_volume_fractions = offset_volume_fractions[1];
-        const int offset_2_volume_fractions = offset_volume_fractions[2];
-        const int ghostcell_dim_0_volume_fractions = ghostcell_dims_volume_fractions[0];
-        const int ghostcell_dim_1_volume_fractions = ghostcell_dims_volume_fractions[1];
-        
-        // Compute temporary variables and store them in the data of gamma of p_inf temporarily.
-        for (int si = 0; si < d_num_species - 1; si++)
-        {
-            const double tmp_1 = double(1)/(d_species_gamma[si] - double(1));
-            const double tmp_2 = d_species_gamma[si]*d_species_p_inf[si]/(d_species_gamma[si] - double(1));
-            
-            for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-            {
-                for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-                {
-#ifdef HAMERS_ENABLE_SIMD
-                    #pragma omp simd
-#endif
-                    for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                    {
-                        // Compute the linear indices.
-                        const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                            (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                            (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                                ghostcell_dim_1_mixture_thermo_properties;
-                        
-                        const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                            (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last +
-                            (k + offset_2_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last*
-                                ghostcell_dim_1_volume_fractions_last;
-                        
-                        const int idx_volume_fractions = (i + offset_0_volume_fractions) +
-                            (j + offset_1_volume_fractions)*ghostcell_dim_0_volume_fractions +
-                            (k + offset_2_volume_fractions)*ghostcell_dim_0_volume_fractions*
-                                ghostcell_dim_1_volume_fractions;
-                        
-                        gamma[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_1;
-                        p_inf[idx_mixture_thermo_properties] += Z[si][idx_volume_fractions]*tmp_2;
-                        
-                        // Compute the volume fraction of the last species.
-                        Z_last[idx_volume_fractions_last] -= Z[si][idx_volume_fractions];
-                    }
-                }
-            }
-        }
-        
-        // Add the contribution from the last species and compute gamma and p_inf.
-        
-        const double tmp_1 = double(1)/(d_species_gamma.back() - double(1));
-        const double tmp_2 = d_species_gamma.back()*d_species_p_inf.back()/(d_species_gamma.back() - double(1));
-        
-        for (int k = domain_lo_2; k < domain_lo_2 + domain_dim_2; k++)
-        {
-            for (int j = domain_lo_1; j < domain_lo_1 + domain_dim_1; j++)
-            {
-#ifdef HAMERS_ENABLE_SIMD
-                #pragma omp simd
-#endif
-                for (int i = domain_lo_0; i < domain_lo_0 + domain_dim_0; i++)
-                {
-                    // Compute the linear indices.
-                    const int idx_mixture_thermo_properties = (i + offset_0_mixture_thermo_properties) +
-                        (j + offset_1_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties +
-                        (k + offset_2_mixture_thermo_properties)*ghostcell_dim_0_mixture_thermo_properties*
-                            ghostcell_dim_1_mixture_thermo_properties;
-                    
-                    const int idx_volume_fractions_last = (i + offset_0_volume_fractions_last) +
-                        (j + offset_1_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last +
-                        (k + offset_2_volume_fractions_last)*ghostcell_dim_0_volume_fractions_last*
-                            ghostcell_dim_1_volume_fractions_last;
-                        
-                    gamma[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]*tmp_1;
-                    p_inf[idx_mixture_thermo_properties] += Z_last[idx_volume_fractions_last]*tmp_2;
-                    
-                    gamma[idx_mixture_thermo_properties] = double(1)/gamma[idx_mixture_thermo_properties] + double(1);
-                    
-                    p_inf[idx_mixture_thermo_properties] = (gamma[idx_mixture_thermo_properties] - double(1))/
-                        gamma[idx_mixture_thermo_properties]*p_inf[idx_mixture_thermo_properties];
-                }
-            }
-        }
+        computeMixturePropertiesWithVolumeFractionsOfCellsForNumberOfSpecies<3, true>(
+            gamma,
+            p_inf,
+            Z_last,
+            Z,
+            d_species_gamma.data(),
+            d_species_p_inf.data(),
+            d_num_species,
+            offset_mixture_thermo_properties,
+            offset_volume_fractions_last,
+            offset_volume_fractions,
+            ghostcell_dims_mixture_thermo_properties,
+            ghostcell_dims_volume_fractions_last,
+            ghostcell_dims_volume_fractions,
+            domain_lo,
+            domain_dims);
     }
 }
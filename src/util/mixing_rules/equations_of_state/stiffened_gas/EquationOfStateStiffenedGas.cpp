@@ -45,6 +45,51 @@ EquationOfStateStiffenedGas::getPressure(
 }
 
 
+/*
+ * Compute the pressure of a batch of states stored contiguously.
+ */
+void
+EquationOfStateStiffenedGas::computePressure(
+    double* const pressure,
+    const double* const density,
+    const double* const internal_energy,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        const double p_inf = thermo_properties[1][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            pressure[idx_state] = ((gamma - double(1))*density[idx_state]*internal_energy[idx_state] - gamma*p_inf);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        const double* const p_inf = thermo_properties[1];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            pressure[idx_state] = ((gamma[idx_state] - double(1))*density[idx_state]*internal_energy[idx_state] - gamma[idx_state]*p_inf[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the pressure.
  */
@@ -586,6 +631,51 @@ EquationOfStateStiffenedGas::getSoundSpeed(
 }
 
 
+/*
+ * Compute the sound speed of a batch of states stored contiguously.
+ */
+void
+EquationOfStateStiffenedGas::computeSoundSpeed(
+    double* const sound_speed,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        const double p_inf = thermo_properties[1][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            sound_speed[idx_state] = sqrt(gamma*(pressure[idx_state] + p_inf)/density[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        const double* const p_inf = thermo_properties[1];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            sound_speed[idx_state] = sqrt(gamma[idx_state]*(pressure[idx_state] + p_inf[idx_state])/density[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the sound speed.
  */
@@ -1127,6 +1217,52 @@ EquationOfStateStiffenedGas::getInternalEnergy(
 }
 
 
+/*
+ * Compute the specific internal energy of a batch of states stored contiguously.
+ */
+void
+EquationOfStateStiffenedGas::computeInternalEnergy(
+    double* const internal_energy,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        const double p_inf = thermo_properties[1][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = (pressure[idx_state] + gamma*p_inf)/((gamma - double(1))*density[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        const double* const p_inf = thermo_properties[1];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = (pressure[idx_state] + gamma[idx_state]*p_inf[idx_state])/
+                ((gamma[idx_state] - double(1))*density[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the specific internal energy.
  */
@@ -2210,6 +2346,53 @@ EquationOfStateStiffenedGas::getTemperature(
 }
 
 
+/*
+ * Compute the temperature of a batch of states stored contiguously.
+ */
+void
+EquationOfStateStiffenedGas::computeTemperature(
+    double* const temperature,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        const double p_inf = thermo_properties[1][0];
+        const double c_v = thermo_properties[3][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            temperature[idx_state] = (pressure[idx_state] + p_inf)/((gamma - double(1))*c_v*density[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        const double* const p_inf = thermo_properties[1];
+        const double* const c_v = thermo_properties[3];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            temperature[idx_state] = (pressure[idx_state] + p_inf[idx_state])/((gamma[idx_state] - double(1))*c_v[idx_state]*density[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the temperature.
  */
@@ -2759,6 +2942,51 @@ EquationOfStateStiffenedGas::getInternalEnergyFromTemperature(
 }
 
 
+/*
+ * Compute the specific internal energy from temperature of a batch of states stored contiguously.
+ */
+void
+EquationOfStateStiffenedGas::computeInternalEnergyFromTemperature(
+    double* const internal_energy,
+    const double* const density,
+    const double* const temperature,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double p_inf = thermo_properties[1][0];
+        const double c_v = thermo_properties[3][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = (c_v*temperature[idx_state] + p_inf/density[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const p_inf = thermo_properties[1];
+        const double* const c_v = thermo_properties[3];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            internal_energy[idx_state] = (c_v[idx_state]*temperature[idx_state] + p_inf[idx_state]/density[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the specific internal energy from temperature.
  */
@@ -4124,6 +4352,52 @@ EquationOfStateStiffenedGas::getGruneisenParameter(
 }
 
 
+/*
+ * Compute the Gruneisen parameter of a batch of states stored contiguously.
+ */
+void
+EquationOfStateStiffenedGas::computeGruneisenParameter(
+    double* const gruneisen_parameter,
+    const double* const density,
+    const double* const pressure,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+    NULL_USE(density);
+    NULL_USE(pressure);
+    
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            gruneisen_parameter[idx_state] = gamma - double(1);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            gruneisen_parameter[idx_state] = gamma[idx_state] - double(1);
+        }
+    }
+}
+
+
 /*
  * Compute the Gruneisen parameter (partial derivative of pressure w.r.t. specific internal energy under
  * constant density divided by density).
@@ -5085,6 +5359,53 @@ EquationOfStateStiffenedGas::getDensity(
 }
 
 
+/*
+ * Compute the density of a batch of states stored contiguously.
+ */
+void
+EquationOfStateStiffenedGas::computeDensity(
+    double* const density,
+    const double* const pressure,
+    const double* const temperature,
+    const double* const* const thermo_properties,
+    const int thermo_properties_stride,
+    const int num_states) const
+{
+#ifdef HAMERS_DEBUG_CHECK_DEV_ASSERTIONS
+    TBOX_ASSERT(thermo_properties_stride == 0 || thermo_properties_stride == 1);
+#endif
+    
+    if (thermo_properties_stride == 0)
+    {
+        const double gamma = thermo_properties[0][0];
+        const double p_inf = thermo_properties[1][0];
+        const double c_v = thermo_properties[3][0];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            density[idx_state] = (pressure[idx_state] + p_inf)/((gamma - double(1))*c_v*temperature[idx_state]);
+        }
+    }
+    else
+    {
+        const double* const gamma = thermo_properties[0];
+        const double* const p_inf = thermo_properties[1];
+        const double* const c_v = thermo_properties[3];
+        
+#ifdef HAMERS_ENABLE_SIMD
+        #pragma omp simd
+#endif
+        for (int idx_state = 0; idx_state < num_states; idx_state++)
+        {
+            density[idx_state] = (pressure[idx_state] + p_inf[idx_state])/((gamma[idx_state] - double(1))*c_v[idx_state]*temperature[idx_state]);
+        }
+    }
+}
+
+
 /*
  * Compute the density.
  */
@@ -0,0 +1,631 @@
+#include "util/scratch_arena/ScratchPatchDataArena.hpp"
+
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Statistician.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <utility>
+
+std::vector<const ScratchPatchDataArena*> ScratchPatchDataArena::s_arenas;
+
+std::map<std::string, std::vector<HAMERS_SHARED_PTR<tbox::Statistic> > >
+    ScratchPatchDataArena::s_statistics;
+
+
+ScratchPatchDataArena::ScratchPatchDataArena(
+    const std::string& object_name,
+    const tbox::Dimension& dim,
+    const int max_num_working_sets):
+        d_object_name(object_name),
+        d_dim(dim),
+        d_max_num_working_sets(max_num_working_sets),
+        d_epoch(0),
+        d_num_hits(0),
+        d_num_misses(0),
+        d_num_releases(0),
+        d_num_bytes_held(0),
+        d_num_bytes_in_use(0),
+        d_num_bytes_in_use_peak_epoch(0),
+        d_num_bytes_in_use_peak(0),
+        d_num_bytes_held_peak(0)
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(d_max_num_working_sets >= 1);
+#endif
+
+#ifdef _OPENMP
+#pragma omp critical (ScratchPatchDataArena_registry)
+#endif
+    {
+        s_arenas.push_back(this);
+    }
+}
+
+
+ScratchPatchDataArena::~ScratchPatchDataArena()
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(d_num_bytes_in_use == 0);
+#endif
+    
+#ifdef _OPENMP
+#pragma omp critical (ScratchPatchDataArena_registry)
+#endif
+    {
+        s_arenas.erase(std::remove(s_arenas.begin(), s_arenas.end(), this), s_arenas.end());
+    }
+}
+
+
+/*
+ * Get side data of doubles in all directions.
+ */
+HAMERS_SHARED_PTR<pdat::SideData<double> >
+ScratchPatchDataArena::getSideData(
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts)
+{
+    return getSideData(box, depth, ghosts, hier::IntVector::getOne(d_dim));
+}
+
+
+/*
+ * Get side data of doubles in the directions given by the direction vector.
+ */
+HAMERS_SHARED_PTR<pdat::SideData<double> >
+ScratchPatchDataArena::getSideData(
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts,
+    const hier::IntVector& directions)
+{
+    return HAMERS_SHARED_PTR_CAST<pdat::SideData<double>, hier::PatchData>(
+        getPatchData(SIDE_DOUBLE, box, depth, ghosts, directions));
+}
+
+
+/*
+ * Get side data of integers in all directions.
+ */
+HAMERS_SHARED_PTR<pdat::SideData<int> >
+ScratchPatchDataArena::getSideDataOfIntegers(
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts)
+{
+    return HAMERS_SHARED_PTR_CAST<pdat::SideData<int>, hier::PatchData>(
+        getPatchData(SIDE_INT, box, depth, ghosts, hier::IntVector::getOne(d_dim)));
+}
+
+
+/*
+ * Get cell data of doubles.
+ */
+HAMERS_SHARED_PTR<pdat::CellData<double> >
+ScratchPatchDataArena::getCellData(
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts)
+{
+    return HAMERS_SHARED_PTR_CAST<pdat::CellData<double>, hier::PatchData>(
+        getPatchData(CELL_DOUBLE, box, depth, ghosts, hier::IntVector::getZero(d_dim)));
+}
+
+
+/*
+ * Mark the end of a patch operation. Free entries are released in least-recently-used order
+ * until the memory held by the arena is within the maximum number of working sets, where
+ * the size of a working set is the peak memory in use during a patch operation.
+ */
+void
+ScratchPatchDataArena::reset()
+{
+    const size_t max_num_bytes_held =
+        d_num_bytes_in_use_peak*static_cast<size_t>(d_max_num_working_sets);
+    
+    d_num_bytes_in_use_peak_epoch = 0;
+    d_epoch++;
+    
+    if (d_num_bytes_held <= max_num_bytes_held)
+    {
+        return;
+    }
+    
+    /*
+     * Sort the free entries by the time they were last used and release the oldest ones.
+     */
+    
+    std::vector<std::pair<unsigned long, std::pair<size_t, const hier::PatchData*> > > free_entries;
+    for (std::map<std::vector<int>, std::list<Entry> >::const_iterator it = d_buckets.begin();
+         it != d_buckets.end();
+         it++)
+    {
+        for (std::list<Entry>::const_iterator jt = it->second.begin(); jt != it->second.end(); jt++)
+        {
+            if (!jt->d_in_use)
+            {
+                free_entries.push_back(std::make_pair(jt->d_last_used,
+                    std::make_pair(jt->d_num_bytes, jt->d_data.get())));
+            }
+        }
+    }
+    
+    std::sort(free_entries.begin(), free_entries.end());
+    
+    std::set<const hier::PatchData*> released_entries;
+    for (int i = 0;
+         i < static_cast<int>(free_entries.size()) && d_num_bytes_held > max_num_bytes_held;
+         i++)
+    {
+        released_entries.insert(free_entries[i].second.second);
+        d_num_bytes_held -= free_entries[i].second.first;
+    }
+    
+    for (std::map<std::vector<int>, std::list<Entry> >::iterator it = d_buckets.begin();
+         it != d_buckets.end();)
+    {
+        std::list<Entry>& entries = it->second;
+        for (std::list<Entry>::iterator jt = entries.begin(); jt != entries.end();)
+        {
+            if (released_entries.count(jt->d_data.get()) > 0)
+            {
+                jt = entries.erase(jt);
+                d_num_releases++;
+            }
+            else
+            {
+                jt++;
+            }
+        }
+        
+        if (entries.empty())
+        {
+            d_buckets.erase(it++);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+
+/*
+ * Release all free entries.
+ */
+void
+ScratchPatchDataArena::clear()
+{
+    for (std::map<std::vector<int>, std::list<Entry> >::iterator it = d_buckets.begin();
+         it != d_buckets.end();)
+    {
+        std::list<Entry>& entries = it->second;
+        for (std::list<Entry>::iterator jt = entries.begin(); jt != entries.end();)
+        {
+            if (!jt->d_in_use)
+            {
+                d_num_bytes_held -= jt->d_num_bytes;
+                jt = entries.erase(jt);
+                d_num_releases++;
+            }
+            else
+            {
+                jt++;
+            }
+        }
+        
+        if (entries.empty())
+        {
+            d_buckets.erase(it++);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+
+/*
+ * Print all characteristics of the arena.
+ */
+void
+ScratchPatchDataArena::printClassData(std::ostream& os) const
+{
+    os << "\nPrint ScratchPatchDataArena object..."
+       << std::endl;
+    
+    os << std::endl;
+    
+    os << "ScratchPatchDataArena: this = "
+       << (ScratchPatchDataArena *)this
+       << std::endl;
+    
+    os << "d_object_name = "
+       << d_object_name
+       << std::endl;
+    
+    os << "d_max_num_working_sets = "
+       << d_max_num_working_sets
+       << std::endl;
+    
+    os << "d_num_hits = "
+       << d_num_hits
+       << std::endl;
+    
+    os << "d_num_misses = "
+       << d_num_misses
+       << std::endl;
+    
+    os << "d_num_releases = "
+       << d_num_releases
+       << std::endl;
+    
+    os << "d_num_bytes_held = "
+       << d_num_bytes_held
+       << std::endl;
+    
+    os << "d_num_bytes_held_peak = "
+       << d_num_bytes_held_peak
+       << std::endl;
+    
+    os << "d_num_bytes_in_use_peak = "
+       << d_num_bytes_in_use_peak
+       << std::endl;
+}
+
+
+/*
+ * Record the hit/miss statistics of all live arenas, accumulated by object name, as processor
+ * statistics of the SAMRAI statistician. All processors have to call this the same number of times
+ * since they own arenas with the same names.
+ */
+void
+ScratchPatchDataArena::recordStatistics()
+{
+    const std::map<std::string, Statistics> statistics = accumulateStatistics();
+    
+    tbox::Statistician* statn = tbox::Statistician::getStatistician();
+    
+    for (std::map<std::string, Statistics>::const_iterator it = statistics.begin();
+         it != statistics.end();
+         it++)
+    {
+        std::vector<HAMERS_SHARED_PTR<tbox::Statistic> >& stats = s_statistics[it->first];
+        if (stats.empty())
+        {
+            stats.push_back(statn->getStatistic(it->first + "::hits", "PROC_STAT"));
+            stats.push_back(statn->getStatistic(it->first + "::misses", "PROC_STAT"));
+            stats.push_back(statn->getStatistic(it->first + "::releases", "PROC_STAT"));
+            stats.push_back(statn->getStatistic(it->first + "::peak_bytes_held", "PROC_STAT"));
+        }
+        
+        const Statistics& stat = it->second;
+        stats[0]->recordProcStat(double(stat.d_num_hits));
+        stats[1]->recordProcStat(double(stat.d_num_misses));
+        stats[2]->recordProcStat(double(stat.d_num_releases));
+        stats[3]->recordProcStat(double(stat.d_num_bytes_held_peak));
+    }
+}
+
+
+/*
+ * Print the hit/miss statistics of all live arenas of this processor, accumulated by object name,
+ * and the sums over all processors of the statistics last recorded in the SAMRAI statistician.
+ */
+void
+ScratchPatchDataArena::printStatistics(std::ostream& os)
+{
+    const std::map<std::string, Statistics> statistics = accumulateStatistics();
+    
+    os << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++";
+    os << std::endl;
+    os << "ScratchPatchDataArena statistics of this processor:" << std::endl;
+    
+    os << std::left << std::setw(52) << "Name"
+       << std::right << std::setw(8) << "Arenas"
+       << std::setw(14) << "Hits"
+       << std::setw(14) << "Misses"
+       << std::setw(10) << "Hit %"
+       << std::setw(14) << "Releases"
+       << std::setw(14) << "Peak MB"
+       << std::endl;
+    
+    for (std::map<std::string, Statistics>::const_iterator it = statistics.begin();
+         it != statistics.end();
+         it++)
+    {
+        const Statistics& stat = it->second;
+        const unsigned long num_requests = stat.d_num_hits + stat.d_num_misses;
+        const double hit_rate = num_requests > 0 ?
+            double(100)*double(stat.d_num_hits)/double(num_requests) : double(0);
+        
+        os << std::left << std::setw(52) << it->first
+           << std::right << std::setw(8) << stat.d_num_arenas
+           << std::setw(14) << stat.d_num_hits
+           << std::setw(14) << stat.d_num_misses
+           << std::setw(10) << std::fixed << std::setprecision(1) << hit_rate
+           << std::setw(14) << stat.d_num_releases
+           << std::setw(14) << std::fixed << std::setprecision(1)
+           << double(stat.d_num_bytes_held_peak)/double(1024*1024)
+           << std::endl;
+    }
+    
+    if (!s_statistics.empty())
+    {
+        /*
+         * Gather the recorded statistics of all processors. The global data is only available on
+         * the first processor.
+         */
+        
+        tbox::Statistician* statn = tbox::Statistician::getStatistician();
+        
+        statn->finalize(false);
+        
+        if (tbox::SAMRAI_MPI::getSAMRAIWorld().getRank() == 0)
+        {
+            os << "ScratchPatchDataArena statistics summed over all processors:" << std::endl;
+            
+            os << std::left << std::setw(52) << "Name"
+               << std::right << std::setw(16) << "Hits"
+               << std::setw(16) << "Misses"
+               << std::setw(10) << "Hit %"
+               << std::setw(16) << "Releases"
+               << std::setw(14) << "Max peak MB"
+               << std::endl;
+            
+            typedef std::map<std::string, std::vector<HAMERS_SHARED_PTR<tbox::Statistic> > >
+                StatisticMap;
+            
+            for (StatisticMap::const_iterator it = s_statistics.begin();
+                 it != s_statistics.end();
+                 it++)
+            {
+                const std::vector<HAMERS_SHARED_PTR<tbox::Statistic> >& stats = it->second;
+                const int sn = stats[0]->getStatSequenceLength() - 1;
+                
+                const double num_hits =
+                    statn->getGlobalProcStatSum(stats[0]->getInstanceId(), sn);
+                const double num_misses =
+                    statn->getGlobalProcStatSum(stats[1]->getInstanceId(), sn);
+                const double num_releases =
+                    statn->getGlobalProcStatSum(stats[2]->getInstanceId(), sn);
+                const double num_bytes_held_peak =
+                    statn->getGlobalProcStatMax(stats[3]->getInstanceId(), sn);
+                
+                const double hit_rate = (num_hits + num_misses) > double(0) ?
+                    double(100)*num_hits/(num_hits + num_misses) : double(0);
+                
+                os << std::left << std::setw(52) << it->first
+                   << std::right << std::setw(16) << std::fixed << std::setprecision(0) << num_hits
+                   << std::setw(16) << num_misses
+                   << std::setw(10) << std::setprecision(1) << hit_rate
+                   << std::setw(16) << std::setprecision(0) << num_releases
+                   << std::setw(14) << std::setprecision(1)
+                   << num_bytes_held_peak/double(1024*1024)
+                   << std::endl;
+            }
+        }
+    }
+    
+    os.unsetf(std::ios_base::floatfield);
+    os << std::setprecision(6);
+}
+
+
+/*
+ * Accumulate the statistics of all live arenas by object name.
+ */
+std::map<std::string, ScratchPatchDataArena::Statistics>
+ScratchPatchDataArena::accumulateStatistics()
+{
+    std::map<std::string, Statistics> statistics;
+    for (std::vector<const ScratchPatchDataArena*>::const_iterator it = s_arenas.begin();
+         it != s_arenas.end();
+         it++)
+    {
+        Statistics& stat = statistics[(*it)->d_object_name];
+        stat.d_num_arenas++;
+        stat.d_num_hits += (*it)->d_num_hits;
+        stat.d_num_misses += (*it)->d_num_misses;
+        stat.d_num_releases += (*it)->d_num_releases;
+        stat.d_num_bytes_held_peak += (*it)->d_num_bytes_held_peak;
+    }
+    
+    return statistics;
+}
+
+
+/*
+ * Find a free entry matching the request or allocate a new one.
+ */
+HAMERS_SHARED_PTR<hier::PatchData>
+ScratchPatchDataArena::getPatchData(
+    const CENTERING centering,
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts,
+    const hier::IntVector& directions)
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(depth > 0);
+    TBOX_ASSERT(box.getDim() == d_dim);
+    TBOX_ASSERT(ghosts.getDim() == d_dim);
+    TBOX_ASSERT(directions.getDim() == d_dim);
+#endif
+
+    std::list<Entry>& entries = d_buckets[computeSizeClass(centering, box, depth, ghosts, directions)];
+    
+    /*
+     * Look for a free entry on exactly the same box.
+     */
+    
+    for (std::list<Entry>::iterator it = entries.begin(); it != entries.end(); it++)
+    {
+        if (!it->d_in_use && it->d_data->getBox().isSpatiallyEqual(box))
+        {
+            d_num_hits++;
+            
+            return acquireEntry(*it);
+        }
+    }
+    
+    /*
+     * Allocate a new entry.
+     */
+    
+    const size_t num_bytes = computeNumberOfBytes(centering, box, depth, ghosts, directions);
+    
+    entries.push_back(Entry(
+        allocatePatchData(centering, box, depth, ghosts, directions),
+        num_bytes,
+        d_epoch));
+    d_num_misses++;
+    
+    d_num_bytes_held += num_bytes;
+    d_num_bytes_held_peak = std::max(d_num_bytes_held_peak, d_num_bytes_held);
+    
+    return acquireEntry(entries.back());
+}
+
+
+/*
+ * Hand out an entry to a caller.
+ */
+HAMERS_SHARED_PTR<hier::PatchData>
+ScratchPatchDataArena::acquireEntry(
+    Entry& entry)
+{
+    entry.d_in_use = true;
+    entry.d_last_used = d_epoch;
+    
+    d_num_bytes_in_use += entry.d_num_bytes;
+    d_num_bytes_in_use_peak_epoch = std::max(d_num_bytes_in_use_peak_epoch, d_num_bytes_in_use);
+    d_num_bytes_in_use_peak = std::max(d_num_bytes_in_use_peak, d_num_bytes_in_use_peak_epoch);
+    
+    return HAMERS_SHARED_PTR<hier::PatchData>(entry.d_data.get(), EntryReleaser(this, &entry));
+}
+
+
+/*
+ * Return an entry released by a caller to the arena.
+ */
+void
+ScratchPatchDataArena::releaseEntry(
+    Entry& entry)
+{
+#ifdef HAMERS_DEBUG_CHECK_ASSERTIONS
+    TBOX_ASSERT(entry.d_in_use);
+    TBOX_ASSERT(d_num_bytes_in_use >= entry.d_num_bytes);
+#endif
+    
+    entry.d_in_use = false;
+    d_num_bytes_in_use -= entry.d_num_bytes;
+}
+
+
+/*
+ * Allocate the patch data of a request.
+ */
+HAMERS_SHARED_PTR<hier::PatchData>
+ScratchPatchDataArena::allocatePatchData(
+    const CENTERING centering,
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts,
+    const hier::IntVector& directions) const
+{
+    HAMERS_SHARED_PTR<hier::PatchData> data;
+    switch (centering)
+    {
+        case SIDE_DOUBLE:
+        {
+            data.reset(new pdat::SideData<double>(box, depth, ghosts, directions));
+            break;
+        }
+        case SIDE_INT:
+        {
+            data.reset(new pdat::SideData<int>(box, depth, ghosts, directions));
+            break;
+        }
+        case CELL_DOUBLE:
+        {
+            data.reset(new pdat::CellData<double>(box, depth, ghosts));
+            break;
+        }
+    }
+    
+    return data;
+}
+
+
+/*
+ * Compute the size class of a request.
+ */
+std::vector<int>
+ScratchPatchDataArena::computeSizeClass(
+    const CENTERING centering,
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts,
+    const hier::IntVector& directions) const
+{
+    const int dim = d_dim.getValue();
+    const hier::IntVector box_dims = box.numberCells();
+    
+    std::vector<int> size_class;
+    size_class.reserve(2 + 3*dim);
+    
+    size_class.push_back(static_cast<int>(centering));
+    size_class.push_back(depth);
+    for (int di = 0; di < dim; di++)
+    {
+        size_class.push_back(box_dims[di]);
+        size_class.push_back(ghosts[di]);
+        size_class.push_back(directions[di]);
+    }
+    
+    return size_class;
+}
+
+
+/*
+ * Compute the number of bytes of the array data of a request.
+ */
+size_t
+ScratchPatchDataArena::computeNumberOfBytes(
+    const CENTERING centering,
+    const hier::Box& box,
+    const int depth,
+    const hier::IntVector& ghosts,
+    const hier::IntVector& directions) const
+{
+    const int dim = d_dim.getValue();
+    const hier::IntVector ghostcell_dims = box.numberCells() + ghosts*2;
+    
+    const size_t num_bytes_per_element = (centering == SIDE_INT) ? sizeof(int) : sizeof(double);
+    
+    size_t num_elements = 0;
+    if (centering == CELL_DOUBLE)
+    {
+        num_elements = static_cast<size_t>(ghostcell_dims.getProduct());
+    }
+    else
+    {
+        for (int di = 0; di < dim; di++)
+        {
+            if (directions[di] != 0)
+            {
+                hier::IntVector side_dims = ghostcell_dims;
+                side_dims[di]++;
+                num_elements += static_cast<size_t>(side_dims.getProduct());
+            }
+        }
+    }
+    
+    return num_elements*static_cast<size_t>(depth)*num_bytes_per_element;
+}